@@ -0,0 +1,91 @@
+# cmx_target_matrix.cmake - per-ISA tuned static library matrix
+#
+# Builds LTO-enabled siblings of cmx_core, one per ISA, so firmware
+# projects link the tuned library directly (cmx_core_m4, cmx_core_m7,
+# cmx_core_m55, cmx_core_rv32, cmx_core_rvv) and benchmark CI builds
+# the whole matrix in one configure instead of a reconfigure-rebuild
+# cycle per core. Kernel variant selection keys off the compiler's own
+# feature macros (__ARM_FEATURE_MVE, __riscv_vector, ... - see
+# cmx_kernel_registry.cpp), so getting -mcpu/-march right per variant
+# is what makes the variant sets correct; wrong-variant builds were
+# behind half of the reported perf regressions.
+#
+# Only the variant group the active toolchain can compile is
+# instantiated: an arm-none-eabi configure produces the M-profile
+# libraries, a RISC-V configure the rv32/rvv pair, and a host configure
+# a single cmx_core_host for sanity-building the matrix mechanism.
+# See CMakePresets.json for the per-toolchain configure presets.
+
+include_guard(GLOBAL)
+
+include(CheckIPOSupported)
+check_ipo_supported(RESULT CMX_IPO_SUPPORTED OUTPUT CMX_IPO_MESSAGE)
+if(NOT CMX_IPO_SUPPORTED)
+    message(WARNING "LTO unavailable for the matrix libraries: ${CMX_IPO_MESSAGE}")
+endif()
+
+# Create one per-ISA sibling of cmx_core.
+#
+# cmx_add_isa_library(<isa> OPTIONS <compile options...> [DEFINES <defines...>])
+#
+# The sibling reuses cmx_core's source list and include directories, so
+# the matrix never drifts from the primary target's file set.
+function(cmx_add_isa_library ISA)
+    cmake_parse_arguments(ARG "" "" "OPTIONS;DEFINES" ${ARGN})
+
+    get_target_property(_sources cmx_core SOURCES)
+    get_target_property(_source_dir cmx_core SOURCE_DIR)
+    get_target_property(_includes cmx_core INCLUDE_DIRECTORIES)
+
+    set(_abs_sources "")
+    foreach(_src IN LISTS _sources)
+        if(IS_ABSOLUTE "${_src}")
+            list(APPEND _abs_sources "${_src}")
+        else()
+            list(APPEND _abs_sources "${_source_dir}/${_src}")
+        endif()
+    endforeach()
+
+    add_library(cmx_core_${ISA} STATIC ${_abs_sources})
+    if(_includes)
+        target_include_directories(cmx_core_${ISA} PUBLIC ${_includes})
+    endif()
+    target_compile_options(cmx_core_${ISA} PRIVATE ${ARG_OPTIONS})
+    if(ARG_DEFINES)
+        target_compile_definitions(cmx_core_${ISA} PUBLIC ${ARG_DEFINES})
+    endif()
+    if(CMX_IPO_SUPPORTED)
+        set_target_properties(cmx_core_${ISA} PROPERTIES
+            INTERPROCEDURAL_OPTIMIZATION TRUE)
+    endif()
+endfunction()
+
+if(CMAKE_CXX_COMPILER MATCHES "arm-none-eabi" OR
+   CMAKE_SYSTEM_PROCESSOR MATCHES "^(arm|cortex)")
+    # M-profile matrix. Float ABI and FPU choices follow the backend
+    # flag sets the export tooling emits (cmx_tools backend_flags).
+    cmx_add_isa_library(m4
+        OPTIONS -mcpu=cortex-m4 -mthumb -mfpu=fpv4-sp-d16 -mfloat-abi=hard
+        DEFINES ARM_MATH_CM4 CORTEX_M)
+    cmx_add_isa_library(m7
+        OPTIONS -mcpu=cortex-m7 -mthumb -mfpu=fpv5-d16 -mfloat-abi=hard
+        DEFINES ARM_MATH_CM7 CORTEX_M)
+    # M55: MVE (Helium) comes in through -mcpu; the registry detects it
+    # via __ARM_FEATURE_MVE
+    cmx_add_isa_library(m55
+        OPTIONS -mcpu=cortex-m55 -mthumb -mfloat-abi=hard
+        DEFINES ARM_MATH_CM55 CORTEX_M)
+elseif(CMAKE_CXX_COMPILER MATCHES "riscv" OR
+       CMAKE_SYSTEM_PROCESSOR MATCHES "^riscv")
+    cmx_add_isa_library(rv32
+        OPTIONS -march=rv32imfc -mabi=ilp32f
+        DEFINES RISCV RV32I)
+    # RVV variant; kernels detect the vector unit via __riscv_vector
+    cmx_add_isa_library(rvv
+        OPTIONS -march=rv32imfcv -mabi=ilp32f
+        DEFINES RISCV RV32I)
+else()
+    # Host build: one native variant so the matrix mechanism itself is
+    # exercised by developer machines and presubmit
+    cmx_add_isa_library(host OPTIONS -O3)
+endif()
@@ -0,0 +1,177 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "../../cmx_core/runtime/cmx_profiler.hpp"
+#include "../../cmx_core/kernels/cmx_tune_params.hpp"
+
+// =============================================================================
+// On-target tile-size autotuner
+//
+// The blocked kernels take their tile sizes from cmx_tune_params.hpp,
+// but the right values differ per board: an M4 with no D-cache wants
+// tiles that fit the store buffer, an M7 with 32KB D-cache wants much
+// larger panels, and an ESP32 running weights out of PSRAM is bound by
+// the cache fill pattern. This harness replays each tunable loop nest
+// with the tile size as a runtime parameter, sweeps the candidates
+// over the dense shapes of the shipped models, and prints one
+// machine-readable "CMX_TUNE ..." line per measurement.
+//
+// Capture the output over the serial console and feed it to
+// cmx_tools/compile/autotune_capture.py, which picks the winners and
+// emits cmx_tune_config.hpp; rebuild with -DCMX_HAVE_TUNE_CONFIG to
+// bake them in. Timing follows cmx_bench: HighResTimer ticks are CPU
+// cycles when a platform cycle counter is registered, nanoseconds on
+// host, and only comparable within one build.
+// =============================================================================
+
+namespace {
+
+constexpr uint32_t WARMUP_RUNS = 2;
+constexpr uint32_t TIMED_RUNS = 10;
+
+// Candidate block edges for the dense blocked matmul. Values outside
+// this range either thrash the L1 on every supported core or degrade
+// to the unblocked loop, so the sweep stays small enough for a slow
+// serial link.
+constexpr int32_t BLOCK_CANDIDATES[] = {16, 32, 48, 64, 96, 128};
+
+// One dense layer shape from the shipped models (gesture and
+// voice-wake classifier heads, detection box/class layers)
+struct DenseShape {
+    const char* label;
+    int32_t input_units;
+    int32_t output_units;
+};
+
+const DenseShape DENSE_SHAPES[] = {
+    {"gesture fc1", 576, 64},
+    {"gesture head", 64, 12},
+    {"voice fc1", 490, 128},
+    {"voice head", 128, 10},
+    {"detect box head", 256, 384},
+    {"detect class head", 256, 1920},
+};
+
+// Deterministic fill so runs are reproducible and denormal-free
+void fill_pattern(float* data, size_t count) {
+    uint32_t state = 0x13579BDFu;
+    for (size_t i = 0; i < count; ++i) {
+        state = state * 1664525u + 1013904223u;
+        data[i] = static_cast<float>(static_cast<int32_t>(state >> 16) - 32768)
+                  * (1.0f / 32768.0f);
+    }
+}
+
+// Same loop nest as CmxDense::matmul_blocked (transposed row-major
+// weights, the layout the exporter emits), with the block edge as a
+// runtime parameter instead of CMX_DENSE_BLOCK_SIZE. Keep the two in
+// sync: a structural change there invalidates tuning results here.
+void matmul_blocked_param(const float* input, const float* weights,
+                          float* output, int32_t input_units,
+                          int32_t output_units, int32_t block_size) {
+    std::memset(output, 0, static_cast<size_t>(output_units) * sizeof(float));
+
+    for (int32_t ii = 0; ii < output_units; ii += block_size) {
+        for (int32_t jj = 0; jj < input_units; jj += block_size) {
+            const int32_t i_end =
+                ii + block_size < output_units ? ii + block_size : output_units;
+            const int32_t j_end =
+                jj + block_size < input_units ? jj + block_size : input_units;
+
+            for (int32_t i = ii; i < i_end; ++i) {
+                float sum = 0.0f;
+                const float* row = &weights[i * input_units];
+                for (int32_t j = jj; j < j_end; ++j) {
+                    sum += input[j] * row[j];
+                }
+                output[i] += sum;
+            }
+        }
+    }
+}
+
+// Time one (shape, block) point and print its CMX_TUNE line; returns
+// best-of ticks so the caller can track the per-shape winner
+uint64_t sweep_point(const DenseShape& shape, int32_t block_size,
+                     const float* input, const float* weights, float* output) {
+    for (uint32_t i = 0; i < WARMUP_RUNS; ++i) {
+        matmul_blocked_param(input, weights, output, shape.input_units,
+                             shape.output_units, block_size);
+    }
+
+    uint64_t best_ticks = UINT64_MAX;
+    for (uint32_t i = 0; i < TIMED_RUNS; ++i) {
+        const uint64_t start = cmx::runtime::HighResTimer::now();
+        matmul_blocked_param(input, weights, output, shape.input_units,
+                             shape.output_units, block_size);
+        const uint64_t end = cmx::runtime::HighResTimer::now();
+        if (end - start < best_ticks) {
+            best_ticks = end - start;
+        }
+    }
+
+    // Fold the output into a checksum so the timed loop cannot be
+    // optimized away
+    uint32_t checksum = 0;
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(output);
+    for (size_t i = 0;
+         i < static_cast<size_t>(shape.output_units) * sizeof(float); ++i) {
+        checksum = checksum * 31u + bytes[i];
+    }
+
+    std::printf("CMX_TUNE param=CMX_DENSE_BLOCK_SIZE shape=%ldx%ld value=%ld "
+                "ticks=%llu checksum=%08x\n",
+                static_cast<long>(shape.input_units),
+                static_cast<long>(shape.output_units),
+                static_cast<long>(block_size),
+                static_cast<unsigned long long>(best_ticks), checksum);
+    return best_ticks;
+}
+
+} // namespace
+
+int main() {
+    std::printf("cmx_autotune: %u warmup + %u timed runs per point, "
+                "current CMX_DENSE_BLOCK_SIZE=%d\n",
+                WARMUP_RUNS, TIMED_RUNS, CMX_DENSE_BLOCK_SIZE);
+
+    constexpr size_t CANDIDATE_COUNT =
+        sizeof(BLOCK_CANDIDATES) / sizeof(BLOCK_CANDIDATES[0]);
+    uint64_t total_ticks[CANDIDATE_COUNT] = {};
+
+    for (const DenseShape& shape : DENSE_SHAPES) {
+        const size_t weight_count = static_cast<size_t>(shape.input_units) *
+                                    static_cast<size_t>(shape.output_units);
+        std::vector<float> input(static_cast<size_t>(shape.input_units));
+        std::vector<float> weights(weight_count);
+        std::vector<float> output(static_cast<size_t>(shape.output_units));
+        fill_pattern(input.data(), input.size());
+        fill_pattern(weights.data(), weights.size());
+
+        std::printf("# %s (%ldx%ld)\n", shape.label,
+                    static_cast<long>(shape.input_units),
+                    static_cast<long>(shape.output_units));
+        for (size_t c = 0; c < CANDIDATE_COUNT; ++c) {
+            total_ticks[c] += sweep_point(shape, BLOCK_CANDIDATES[c],
+                                          input.data(), weights.data(),
+                                          output.data());
+        }
+    }
+
+    // One block size serves the whole model, so the winner is the
+    // candidate with the lowest summed best-of ticks over all shapes
+    size_t best = 0;
+    for (size_t c = 1; c < CANDIDATE_COUNT; ++c) {
+        if (total_ticks[c] < total_ticks[best]) {
+            best = c;
+        }
+    }
+    std::printf("CMX_TUNE_WINNER param=CMX_DENSE_BLOCK_SIZE value=%ld "
+                "ticks=%llu\n",
+                static_cast<long>(BLOCK_CANDIDATES[best]),
+                static_cast<unsigned long long>(total_ticks[best]));
+
+    return 0;
+}
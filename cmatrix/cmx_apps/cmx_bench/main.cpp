@@ -0,0 +1,227 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "../../cmx_core/kernels/cmx_kernel_registry.hpp"
+#include "../../cmx_core/kernels/layers/cmx_conv2d.hpp"
+#include "../../cmx_core/runtime/cmx_profiler.hpp"
+
+using namespace cmx::kernels;
+
+// =============================================================================
+// Per-kernel microbenchmarks
+//
+// Every kernel registered in CmxKernelRegistry is driven through the
+// CmxKernel interface across a sweep of shapes representative of the
+// shipped models (gesture, voice wake, object detection). Each
+// configuration reports ticks per run and bytes moved, so a kernel
+// change can be judged from one table instead of flashing demo apps.
+//
+// Timing uses runtime::HighResTimer: with a platform cycle counter
+// registered (DWT, ccount, rdcycle) ticks are CPU cycles; on host they
+// are nanoseconds. Comparisons are only meaningful within one build.
+//
+// Registered kernel types with no bench case and cases whose type is
+// not registered are both reported, so the sweep and the registry
+// cannot silently drift apart.
+// =============================================================================
+
+namespace {
+
+constexpr uint32_t WARMUP_RUNS = 3;
+constexpr uint32_t TIMED_RUNS = 20;
+
+// One kernel configuration in the sweep: descriptors plus the params
+// blob handed to configure(). Params live in static storage so the
+// pointer stays valid for the whole run.
+struct BenchCase {
+    const char* label;
+    KernelType type;
+    std::vector<TensorDescriptor> inputs;
+    const void* params;
+};
+
+// Deterministic fill so runs are reproducible and denormal-free
+void fill_pattern(void* data, size_t bytes) {
+    uint8_t* p = static_cast<uint8_t*>(data);
+    uint32_t state = 0x13579BDFu;
+    for (size_t i = 0; i < bytes; ++i) {
+        state = state * 1664525u + 1013904223u;
+        p[i] = static_cast<uint8_t>(state >> 24);
+    }
+}
+
+TensorDescriptor make_desc(ShapeDims dims,
+                           DataType dtype = DataType::FLOAT32) {
+    TensorDescriptor desc;
+    desc.shape.dims = dims;
+    desc.dtype = dtype;
+    return desc;
+}
+
+Conv2DParams make_conv_params(int32_t kernel, int32_t stride,
+                              int32_t input_channels,
+                              int32_t output_channels) {
+    Conv2DParams params = {};
+    params.kernel_height = kernel;
+    params.kernel_width = kernel;
+    params.stride_height = stride;
+    params.stride_width = stride;
+    params.dilation_height = 1;
+    params.dilation_width = 1;
+    params.padding_mode = PaddingMode::VALID;
+    params.input_channels = input_channels;
+    params.output_channels = output_channels;
+    params.data_format = DataFormat::NHWC;
+    params.activation = ActivationType::NONE;
+    params.use_bias = true;
+    params.quantized = false;
+    return params;
+}
+
+// Conv2D sweep: first layers of the object detection backbone, the
+// voice-wake frontend conv, and the pointwise/3x3 body shapes the
+// gesture and detection models spend most of their cycles in
+Conv2DParams g_conv_3x3_s2_c3_c8 = make_conv_params(3, 2, 3, 8);
+Conv2DParams g_conv_3x3_s1_c8_c16 = make_conv_params(3, 1, 8, 16);
+Conv2DParams g_conv_3x3_s1_c16_c32 = make_conv_params(3, 1, 16, 32);
+Conv2DParams g_conv_1x1_s1_c32_c64 = make_conv_params(1, 1, 32, 64);
+Conv2DParams g_conv_3x3_s1_c1_c32 = make_conv_params(3, 1, 1, 32);
+
+std::vector<BenchCase> build_cases() {
+    std::vector<BenchCase> cases;
+
+    cases.push_back({"conv2d 96x96x3 -> 8 3x3/s2", KernelType::CONV2D,
+                     {make_desc({1, 96, 96, 3}), make_desc({8, 3, 3, 3}),
+                      make_desc({8})},
+                     &g_conv_3x3_s2_c3_c8});
+    cases.push_back({"conv2d 47x47x8 -> 16 3x3", KernelType::CONV2D,
+                     {make_desc({1, 47, 47, 8}), make_desc({16, 3, 3, 8}),
+                      make_desc({16})},
+                     &g_conv_3x3_s1_c8_c16});
+    cases.push_back({"conv2d 24x24x16 -> 32 3x3", KernelType::CONV2D,
+                     {make_desc({1, 24, 24, 16}), make_desc({32, 3, 3, 16}),
+                      make_desc({32})},
+                     &g_conv_3x3_s1_c16_c32});
+    cases.push_back({"conv2d 12x12x32 -> 64 1x1", KernelType::CONV2D,
+                     {make_desc({1, 12, 12, 32}), make_desc({64, 1, 1, 32}),
+                      make_desc({64})},
+                     &g_conv_1x1_s1_c32_c64});
+    cases.push_back({"conv2d 49x10x1 -> 32 3x3", KernelType::CONV2D,
+                     {make_desc({1, 49, 10, 1}), make_desc({32, 3, 3, 1}),
+                      make_desc({32})},
+                     &g_conv_3x3_s1_c1_c32});
+
+    return cases;
+}
+
+// Run one configuration: configure, warm up, then report average and
+// best-of ticks plus the bytes the kernel reads and writes per run
+bool run_case(const BenchCase& bench) {
+    std::unique_ptr<CmxKernel> kernel =
+        CmxKernelRegistry::instance().create_kernel(bench.type);
+    if (!kernel) {
+        std::printf("%-28s  skipped (kernel not registered)\n", bench.label);
+        return false;
+    }
+
+    std::vector<TensorDescriptor> inputs = bench.inputs;
+    DescriptorList outputs;
+    if (kernel->configure(inputs, outputs, bench.params) !=
+        KernelStatus::SUCCESS) {
+        std::printf("%-28s  skipped (configure failed)\n", bench.label);
+        return false;
+    }
+
+    // Allocate and fill the tensors named by the descriptors
+    std::vector<std::vector<uint8_t>> input_storage(inputs.size());
+    std::vector<const void*> input_ptrs(inputs.size());
+    size_t bytes_moved = 0;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        input_storage[i].resize(static_cast<size_t>(inputs[i].size_bytes()));
+        fill_pattern(input_storage[i].data(), input_storage[i].size());
+        input_ptrs[i] = input_storage[i].data();
+        bytes_moved += input_storage[i].size();
+    }
+
+    std::vector<std::vector<uint8_t>> output_storage(static_cast<size_t>(outputs.size()));
+    std::vector<void*> output_ptrs(static_cast<size_t>(outputs.size()));
+    for (int32_t i = 0; i < outputs.size(); ++i) {
+        output_storage[i].resize(static_cast<size_t>(outputs[i].size_bytes()));
+        output_ptrs[i] = output_storage[i].data();
+        bytes_moved += output_storage[i].size();
+    }
+
+    for (uint32_t i = 0; i < WARMUP_RUNS; ++i) {
+        if (kernel->run(input_ptrs.data(), output_ptrs.data()) !=
+            KernelStatus::SUCCESS) {
+            std::printf("%-28s  skipped (run failed)\n", bench.label);
+            return false;
+        }
+    }
+
+    uint64_t total_ticks = 0;
+    uint64_t best_ticks = UINT64_MAX;
+    for (uint32_t i = 0; i < TIMED_RUNS; ++i) {
+        const uint64_t start = cmx::runtime::HighResTimer::now();
+        kernel->run(input_ptrs.data(), output_ptrs.data());
+        const uint64_t end = cmx::runtime::HighResTimer::now();
+        const uint64_t ticks = end - start;
+        total_ticks += ticks;
+        if (ticks < best_ticks) {
+            best_ticks = ticks;
+        }
+    }
+
+    // Fold the output into a checksum so the timed loop cannot be
+    // optimized away
+    uint32_t checksum = 0;
+    for (const auto& block : output_storage) {
+        for (uint8_t byte : block) {
+            checksum = checksum * 31u + byte;
+        }
+    }
+
+    std::printf("%-28s %12llu %12llu %10zu  (%08x)\n", bench.label,
+                static_cast<unsigned long long>(total_ticks / TIMED_RUNS),
+                static_cast<unsigned long long>(best_ticks), bytes_moved,
+                checksum);
+    return true;
+}
+
+} // namespace
+
+int main() {
+    CmxKernelRegistry& registry = CmxKernelRegistry::instance();
+    registry.initialize();
+
+    std::printf("cmx_bench: %u warmup + %u timed runs per case\n",
+                WARMUP_RUNS, TIMED_RUNS);
+    std::printf("%-28s %12s %12s %10s\n", "case", "avg ticks", "best ticks",
+                "bytes");
+
+    const std::vector<BenchCase> cases = build_cases();
+    for (const BenchCase& bench : cases) {
+        run_case(bench);
+    }
+
+    // Surface registered kernels the sweep does not exercise yet, so a
+    // newly registered type shows up here until it gets cases
+    for (KernelType type : registry.get_supported_types()) {
+        bool covered = false;
+        for (const BenchCase& bench : cases) {
+            if (bench.type == type) {
+                covered = true;
+                break;
+            }
+        }
+        if (!covered) {
+            std::printf("%-28s  registered but no bench case\n",
+                        CmxKernelRegistry::type_to_string(type));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,200 @@
+#include "bench_harness.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "../../cmx_core/graph/cmx_graph_serializer.hpp"
+#include "../../cmx_core/graph/cmx_node.hpp"
+#include "../../cmx_core/runtime/cmx_memory_pool.hpp"
+#include "../../cmx_core/runtime/cmx_profiler.hpp"
+#include "../../cmx_include/cmx_model_loder.hpp"
+
+namespace ModelBench {
+
+using cmx::cmx_status;
+using cmx::graph::CMXGraphSerializer;
+using cmx::graph::NodeID;
+using cmx::graph::SerializationResult;
+using cmx::runtime::CMXMemoryPool;
+using cmx::runtime::HighResTimer;
+
+namespace {
+
+// Deterministic input fill so host and target runs see the same data
+void fill_pattern(void* data, size_t bytes) {
+    uint8_t* p = static_cast<uint8_t*>(data);
+    uint32_t state = 0x2468ACE1u;
+    for (size_t i = 0; i < bytes; ++i) {
+        state = state * 1664525u + 1013904223u;
+        p[i] = static_cast<uint8_t>(state >> 24);
+    }
+}
+
+} // namespace
+
+BenchHarness::BenchHarness(const HarnessOptions& options)
+    : options_(options)
+    , model_(cmx::CMX_INVALID_HANDLE)
+    , profiler_(nullptr)
+    , loaded_(false) {}
+
+BenchHarness::~BenchHarness() {
+    if (model_ != cmx::CMX_INVALID_HANDLE) {
+        cmx::cmx_free_model(model_);
+    }
+}
+
+bool BenchHarness::load() {
+    if (!options_.model_path) {
+        std::printf("model_bench: no model path given\n");
+        return false;
+    }
+
+    // Structural view for the breakdown
+    CMXGraphSerializer serializer;
+    SerializationResult result =
+        serializer.deserialize_from_file(options_.model_path, graph_);
+    if (result != SerializationResult::SUCCESS) {
+        std::printf("model_bench: failed to deserialize graph (%d)\n",
+                    static_cast<int>(result));
+        return false;
+    }
+
+    // Executable view of the same file
+    model_ = cmx::cmx_load_model_from_file(options_.model_path);
+    if (model_ == cmx::CMX_INVALID_HANDLE) {
+        std::printf("model_bench: failed to load model\n");
+        return false;
+    }
+
+    cmx::cmx_model_info info = {};
+    if (cmx::cmx_get_model_info(model_, &info) != cmx_status::OK) {
+        std::printf("model_bench: failed to query model info\n");
+        return false;
+    }
+
+    // Size the I/O buffers from the model's own descriptors
+    input_storage_.resize(info.input_count);
+    input_ptrs_.resize(info.input_count);
+    for (uint32_t i = 0; i < info.input_count; ++i) {
+        cmx::cmx_tensor_desc desc = {};
+        if (cmx::cmx_get_input_desc(model_, i, &desc) != cmx_status::OK) {
+            std::printf("model_bench: failed to query input %u\n", i);
+            return false;
+        }
+        input_storage_[i].resize(desc.total_size);
+        fill_pattern(input_storage_[i].data(), input_storage_[i].size());
+        input_ptrs_[i] = input_storage_[i].data();
+    }
+
+    output_storage_.resize(info.output_count);
+    output_ptrs_.resize(info.output_count);
+    for (uint32_t i = 0; i < info.output_count; ++i) {
+        cmx::cmx_tensor_desc desc = {};
+        if (cmx::cmx_get_output_desc(model_, i, &desc) != cmx_status::OK) {
+            std::printf("model_bench: failed to query output %u\n", i);
+            return false;
+        }
+        output_storage_[i].resize(desc.total_size);
+        output_ptrs_[i] = output_storage_[i].data();
+    }
+
+    loaded_ = true;
+    return true;
+}
+
+bool BenchHarness::run() {
+    if (!loaded_) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < options_.warmup_iterations; ++i) {
+        if (cmx::cmx_execute_model(model_, input_ptrs_.data(),
+                                   output_ptrs_.data()) != cmx_status::OK) {
+            std::printf("model_bench: warmup execution failed\n");
+            return false;
+        }
+    }
+
+    latencies_us_.clear();
+    latencies_us_.reserve(options_.timed_iterations);
+    for (uint32_t i = 0; i < options_.timed_iterations; ++i) {
+        const HighResTimer::TimePoint start = HighResTimer::now();
+        cmx_status status = cmx::cmx_execute_model(model_, input_ptrs_.data(),
+                                                   output_ptrs_.data());
+        const HighResTimer::TimePoint end = HighResTimer::now();
+        if (status != cmx_status::OK) {
+            std::printf("model_bench: execution failed at iteration %u\n", i);
+            return false;
+        }
+        latencies_us_.push_back(HighResTimer::duration_us(start, end));
+    }
+
+    std::sort(latencies_us_.begin(), latencies_us_.end());
+    latency_.iterations = options_.timed_iterations;
+    latency_.p50_us = percentile(50);
+    latency_.p95_us = percentile(95);
+    latency_.max_us = latencies_us_.empty() ? 0 : latencies_us_.back();
+    return true;
+}
+
+void BenchHarness::set_profiler(const cmx::runtime::CMXProfiler* profiler) {
+    profiler_ = profiler;
+}
+
+uint64_t BenchHarness::percentile(uint32_t rank_percent) const {
+    if (latencies_us_.empty()) {
+        return 0;
+    }
+    size_t index = (latencies_us_.size() * rank_percent) / 100;
+    if (index >= latencies_us_.size()) {
+        index = latencies_us_.size() - 1;
+    }
+    return latencies_us_[index];
+}
+
+void BenchHarness::print_report() const {
+    std::printf("model: %s\n", options_.model_path);
+    std::printf("latency over %u iterations (%u warmup):\n",
+                latency_.iterations, options_.warmup_iterations);
+    std::printf("  p50 %llu us   p95 %llu us   max %llu us\n",
+                static_cast<unsigned long long>(latency_.p50_us),
+                static_cast<unsigned long long>(latency_.p95_us),
+                static_cast<unsigned long long>(latency_.max_us));
+
+    const CMXMemoryPool::MemoryStats stats =
+        CMXMemoryPool::getInstance().get_memory_stats();
+    std::printf("arena: peak %zu / %zu bytes (tensor %zu, temp %zu, "
+                "general %zu)\n",
+                stats.peak_usage, stats.total_size, stats.tensor_pool_used,
+                stats.temp_buffer_used, stats.general_pool_used);
+
+    // Per-node breakdown in execution order; profiler entries whose
+    // label matches the node name carry the measured time
+    const std::vector<NodeID> order = graph_.topological_sort();
+    std::printf("nodes (%zu):\n", order.size());
+    for (NodeID node_id : order) {
+        const auto node = graph_.get_node(node_id);
+        if (!node) {
+            continue;
+        }
+        const cmx::runtime::ProfileEntry* entry =
+            profiler_ ? profiler_->get_entry(node->get_name().c_str())
+                      : nullptr;
+        if (entry && entry->call_count > 0) {
+            std::printf("  %4u %-12s %-24s %8llu us avg (%u calls)\n",
+                        node_id, node->get_op_type_string().c_str(),
+                        node->get_name().c_str(),
+                        static_cast<unsigned long long>(
+                            entry->total_time_us / entry->call_count),
+                        entry->call_count);
+        } else {
+            std::printf("  %4u %-12s %-24s        - \n", node_id,
+                        node->get_op_type_string().c_str(),
+                        node->get_name().c_str());
+        }
+    }
+}
+
+} // namespace ModelBench
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "../../cmx_core/graph/cmx_graph.hpp"
+#include "../../cmx_include/cmx_api.hpp"
+
+namespace cmx {
+namespace runtime {
+class CMXProfiler;
+}
+}
+
+namespace ModelBench {
+
+/**
+ * @file bench_harness.hpp
+ * @brief Shared end-to-end model benchmark harness
+ *
+ * One timing loop for all demos and for host-side regression checks:
+ * loads a serialized CMXGraph, runs warmup plus N timed iterations
+ * through cmx_execute_model, and reports p50/p95/max latency, peak
+ * arena usage from CMXMemoryPool, and a per-node breakdown. The same
+ * code builds on host x86 and on target, so numbers from both can be
+ * compared run for run instead of each app hand-rolling tick counting.
+ */
+
+struct HarnessOptions {
+    const char* model_path = nullptr;   ///< Serialized CMXGraph file
+    uint32_t warmup_iterations = 5;     ///< Untimed cache/allocator warmup
+    uint32_t timed_iterations = 50;     ///< Iterations behind the percentiles
+};
+
+struct LatencyReport {
+    uint64_t p50_us = 0;
+    uint64_t p95_us = 0;
+    uint64_t max_us = 0;
+    uint32_t iterations = 0;
+};
+
+class BenchHarness {
+public:
+    explicit BenchHarness(const HarnessOptions& options);
+    ~BenchHarness();
+
+    /**
+     * @brief Load the serialized graph and the executable model
+     *
+     * The graph is deserialized for structural reporting (node list in
+     * execution order); the same file is handed to cmx_load_model for
+     * execution, so both views describe the identical artifact.
+     */
+    bool load();
+
+    /**
+     * @brief Run warmup plus the timed iterations
+     *
+     * Each iteration is one cmx_execute_model call timed with
+     * HighResTimer, so on targets with a registered platform clock the
+     * percentiles are cycle-accurate.
+     */
+    bool run();
+
+    /**
+     * @brief Print latency percentiles, arena peak, and node breakdown
+     */
+    void print_report() const;
+
+    /**
+     * @brief Attach a profiler for the per-node breakdown
+     *
+     * When the runtime is built with profiling and the executor records
+     * per-op scopes into this profiler, entries whose label matches a
+     * node name are merged into the breakdown; nodes without a matching
+     * entry are listed with structure only.
+     */
+    void set_profiler(const cmx::runtime::CMXProfiler* profiler);
+
+    const LatencyReport& latency() const { return latency_; }
+
+private:
+    uint64_t percentile(uint32_t rank_percent) const;
+
+    HarnessOptions options_;
+    cmx::graph::CMXGraph graph_;
+    cmx::cmx_model_handle model_;
+    const cmx::runtime::CMXProfiler* profiler_;
+
+    std::vector<std::vector<uint8_t>> input_storage_;
+    std::vector<std::vector<uint8_t>> output_storage_;
+    std::vector<void*> input_ptrs_;
+    std::vector<void*> output_ptrs_;
+
+    std::vector<uint64_t> latencies_us_;  ///< Sorted after run()
+    LatencyReport latency_;
+    bool loaded_;
+};
+
+} // namespace ModelBench
@@ -0,0 +1,43 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include "bench_harness.hpp"
+
+// =============================================================================
+// End-to-end model benchmark
+//
+// Usage: cmx_model_bench <model.cmx> [iterations] [warmup]
+//
+// Thin entry point over ModelBench::BenchHarness; the same harness is
+// linked into target builds so host and device report identical fields.
+// =============================================================================
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::printf("usage: %s <model.cmx> [iterations] [warmup]\n", argv[0]);
+        return 1;
+    }
+
+    ModelBench::HarnessOptions options;
+    options.model_path = argv[1];
+    if (argc > 2) {
+        options.timed_iterations = static_cast<uint32_t>(std::atoi(argv[2]));
+    }
+    if (argc > 3) {
+        options.warmup_iterations = static_cast<uint32_t>(std::atoi(argv[3]));
+    }
+    if (options.timed_iterations == 0) {
+        std::printf("iterations must be positive\n");
+        return 1;
+    }
+
+    ModelBench::BenchHarness harness(options);
+    if (!harness.load()) {
+        return 1;
+    }
+    if (!harness.run()) {
+        return 1;
+    }
+    harness.print_report();
+    return 0;
+}
@@ -23,6 +23,10 @@ static uint8_t g_temp_buffer[CMX_CAMERA_BUFFER_SIZE] __attribute__((aligned(32))
 static volatile bool g_frame_ready = false;
 static volatile bool g_camera_initialized = false;
 
+// Destination of the capture in flight (caller-owned, usually a bound
+// model input tensor); nullptr when no capture is active
+static uint8_t* g_capture_target = nullptr;
+
 #ifdef STM32
 static DCMI_HandleTypeDef g_hdcmi;
 static DMA_HandleTypeDef g_hdma_dcmi;
@@ -96,72 +100,101 @@ int camera_init() {
     return CMX_SUCCESS;
 }
 
-uint8_t* get_camera_frame() {
+int camera_capture_start(uint8_t* dst_rgb888) {
     if (!g_camera_initialized) {
         CMX_LOG_ERROR("Camera not initialized");
-        return nullptr;
+        return CMX_ERROR_CAMERA;
     }
-    
+    if (!dst_rgb888 || g_capture_target) {
+        return CMX_ERROR_INVALID_PARAM;
+    }
+
     #ifdef STM32
-        // Start DCMI capture
+        // Start DCMI capture; the DMA fills the RGB565 staging buffer
+        // while the caller runs inference on the previous frame
         g_frame_ready = false;
-        if (HAL_DCMI_Start_DMA(&g_hdcmi, DCMI_MODE_CONTINUOUS, 
+        if (HAL_DCMI_Start_DMA(&g_hdcmi, DCMI_MODE_CONTINUOUS,
                               (uint32_t)g_temp_buffer, CMX_CAMERA_BUFFER_SIZE/4) != HAL_OK) {
             CMX_LOG_ERROR("Failed to start DCMI capture");
-            return nullptr;
+            return CMX_ERROR_CAMERA;
         }
-        
+    #endif
+    // ESP32 and generic platforms grab the frame in camera_capture_finish
+
+    g_capture_target = dst_rgb888;
+    return CMX_SUCCESS;
+}
+
+int camera_capture_finish(uint32_t timeout_ms) {
+    if (!g_capture_target) {
+        return CMX_ERROR_INVALID_PARAM;
+    }
+
+    uint8_t* dst = g_capture_target;
+    g_capture_target = nullptr;
+
+    #ifdef STM32
         // Wait for frame completion
-        uint32_t timeout = HAL_GetTick() + 1000; // 1 second timeout
+        uint32_t timeout = HAL_GetTick() + timeout_ms;
         while (!g_frame_ready && HAL_GetTick() < timeout) {
             // Yield to other tasks if RTOS is available
         }
-        
+
         HAL_DCMI_Stop(&g_hdcmi);
-        
+
         if (!g_frame_ready) {
             CMX_LOG_ERROR("Camera capture timeout");
-            return nullptr;
+            return CMX_ERROR_TIMEOUT;
         }
-        
+
+        // Single pass: RGB565 staging buffer to RGB888 target
+        convert_rgb565_to_rgb888(g_temp_buffer, dst,
+                                CMX_INPUT_WIDTH * CMX_INPUT_HEIGHT);
+
     #elif defined(ESP32)
+        (void)timeout_ms;
         camera_fb_t* fb = esp_camera_fb_get();
         if (!fb) {
             CMX_LOG_ERROR("Failed to capture frame");
-            return nullptr;
+            return CMX_ERROR_CAMERA;
         }
-        
-        // Copy frame data to our buffer
-        size_t copy_size = CMX_MIN(fb->len, CMX_CAMERA_BUFFER_SIZE);
-        memcpy(g_temp_buffer, fb->buf, copy_size);
-        
+
+        // Single pass: convert straight out of the driver frame buffer
+        // into the target, no staging copy
+        convert_rgb565_to_rgb888(fb->buf, dst,
+                                CMX_INPUT_WIDTH * CMX_INPUT_HEIGHT);
+
         esp_camera_fb_return(fb);
-        
+
     #else
+        (void)timeout_ms;
         // Generic frame capture - implement based on your camera interface
-        // This is a placeholder that generates a test pattern
+        // This is a placeholder that generates a test pattern directly
+        // in the target buffer
         static uint8_t pattern = 0;
         for (uint32_t i = 0; i < CMX_CAMERA_BUFFER_SIZE; i++) {
-            g_temp_buffer[i] = (pattern + i) & 0xFF;
+            dst[i] = (pattern + i) & 0xFF;
         }
         pattern++;
     #endif
-    
-    // Convert format if necessary
-    #ifdef STM32
-        // Assume RGB565 input from STM32 camera
-        convert_rgb565_to_rgb888(g_temp_buffer, g_frame_buffer, 
-                                CMX_INPUT_WIDTH * CMX_INPUT_HEIGHT);
-    #elif defined(ESP32)
-        // ESP32 camera typically outputs JPEG or RGB565
-        // This assumes RGB565 - modify based on your camera configuration
-        convert_rgb565_to_rgb888(g_temp_buffer, g_frame_buffer,
-                                CMX_INPUT_WIDTH * CMX_INPUT_HEIGHT);
-    #else
-        // Direct copy for generic case
-        memcpy(g_frame_buffer, g_temp_buffer, CMX_CAMERA_BUFFER_SIZE);
-    #endif
-    
+
+    return CMX_SUCCESS;
+}
+
+int camera_capture_frame(uint8_t* dst_rgb888) {
+    int result = camera_capture_start(dst_rgb888);
+    if (result != CMX_SUCCESS) {
+        return result;
+    }
+    return camera_capture_finish(1000);
+}
+
+uint8_t* get_camera_frame() {
+    // Legacy path: capture into the module-owned frame buffer. New code
+    // should capture directly into a bound model input instead
+    if (camera_capture_frame(g_frame_buffer) != CMX_SUCCESS) {
+        return nullptr;
+    }
     return g_frame_buffer;
 }
 
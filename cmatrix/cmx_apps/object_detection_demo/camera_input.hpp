@@ -128,6 +128,42 @@ bool capture_frame(FrameBuffer* buffer, uint32_t timeout_ms = 1000);
  */
 uint8_t* get_camera_frame();
 
+/**
+ * @brief Begin capturing a frame into a caller-owned RGB888 buffer
+ *
+ * Non-blocking: on DMA-capable platforms the transfer runs while the
+ * caller does other work (typically inference on the previous frame).
+ * The target is usually a model input buffer bound through
+ * cmx_bind_input_double, so the frame lands directly in the tensor the
+ * first layer reads - no intermediate copy.
+ *
+ * @param dst_rgb888 Destination buffer, at least width*height*3 bytes
+ * @return CMX_SUCCESS if the capture was started
+ */
+int camera_capture_start(uint8_t* dst_rgb888);
+
+/**
+ * @brief Finish a capture started with camera_capture_start
+ *
+ * Blocks until the frame is complete, then runs the single required
+ * color-convert pass (e.g. RGB565 to RGB888) straight into the target
+ * buffer given to camera_capture_start.
+ *
+ * @param timeout_ms Maximum time to wait for the frame
+ * @return CMX_SUCCESS if a frame was delivered to the target buffer
+ */
+int camera_capture_finish(uint32_t timeout_ms);
+
+/**
+ * @brief Capture a frame into a caller-owned RGB888 buffer (blocking)
+ *
+ * Equivalent to camera_capture_start followed by camera_capture_finish.
+ *
+ * @param dst_rgb888 Destination buffer, at least width*height*3 bytes
+ * @return CMX_SUCCESS if a frame was delivered
+ */
+int camera_capture_frame(uint8_t* dst_rgb888);
+
 /**
  * @brief Get the latest frame buffer with metadata
  * @return Pointer to FrameBuffer structure, nullptr if no frame available
@@ -12,7 +12,11 @@
 
 static uint8_t g_model_buffer[CMX_MODEL_BUFFER_SIZE] __attribute__((aligned(32)));
 static uint8_t g_inference_buffer[CMX_INFERENCE_BUFFER_SIZE] __attribute__((aligned(32)));
-static uint8_t g_camera_buffer[CMX_CAMERA_BUFFER_SIZE] __attribute__((aligned(32)));
+// Ping/pong model input buffers: the camera fills one while inference
+// consumes the other, bound zero-copy via cmx_bind_input_double
+static uint8_t g_input_ping[CMX_INPUT_SIZE] __attribute__((aligned(32)));
+static uint8_t g_input_pong[CMX_INPUT_SIZE] __attribute__((aligned(32)));
+static cmx_double_buffer_t g_input_buffers;
 static CMXDetection g_detections[CMX_MAX_DETECTIONS];
 static CMXModelInfo g_model_info;
 
@@ -186,7 +190,17 @@ static CMXErrorCode load_object_detection_model() {
     CMX_LOG_INFO("Model info - Input: %ux%ux%u, Output size: %u",
                  g_model_info.input_width, g_model_info.input_height,
                  g_model_info.input_channels, g_model_info.output_size);
-    
+
+    // Lend both frame buffers to the runtime as the model input; each
+    // swap binds the freshly captured one, so the camera writes and
+    // the first layer reads the same memory
+    status = cmx_bind_input_double(g_model_handle, 0, g_input_ping, g_input_pong,
+                                   CMX_INPUT_SIZE, &g_input_buffers);
+    if (status != CMX_STATUS_SUCCESS) {
+        CMX_LOG_ERROR("Failed to bind input buffers: %d", status);
+        return CMX_ERROR_MODEL_LOAD;
+    }
+
     return CMX_SUCCESS;
 }
 
@@ -195,45 +209,63 @@ static CMXErrorCode load_object_detection_model() {
 // ============================================================================
 
 static CMXErrorCode process_frame() {
-    // Capture frame from camera
-    uint8_t* frame_data = get_camera_frame();
-    if (!frame_data) {
+    // Start the camera filling the free half of the ping/pong pair.
+    // On DMA-capable targets the transfer runs in the background
+    uint8_t* fill_buffer = static_cast<uint8_t*>(
+        cmx_double_buffer_fill_ptr(&g_input_buffers));
+    if (camera_capture_start(fill_buffer) != CMX_SUCCESS) {
         return CMX_ERROR_CAMERA;
     }
-    
-    // Run inference
-    float* output_data = reinterpret_cast<float*>(g_inference_buffer);
-    CMXErrorCode result = run_inference(frame_data, output_data);
-    if (result != CMX_SUCCESS) {
-        return result;
+
+    // While the capture runs, infer on the previously published frame.
+    // Null before the first swap, when no frame exists yet
+    uint8_t* frame_data = static_cast<uint8_t*>(
+        cmx_double_buffer_ready_ptr(&g_input_buffers));
+    if (frame_data) {
+        // Run inference - the input tensor is the bound buffer itself,
+        // so no copy happens on the way in
+        float* output_data = reinterpret_cast<float*>(g_inference_buffer);
+        CMXErrorCode result = run_inference(frame_data, output_data);
+        if (result != CMX_SUCCESS) {
+            return result;
+        }
+
+        // Post-process detections
+        uint16_t num_detections = postprocess_detections(output_data, g_detections);
+
+        // Clear display and render frame
+        display_clear();
+
+        // Display camera frame (if display supports it)
+        display_draw_image(0, 0, CMX_INPUT_WIDTH, CMX_INPUT_HEIGHT, frame_data);
+
+        // Render bounding boxes
+        for (uint16_t i = 0; i < num_detections; i++) {
+            const CMXDetection& det = g_detections[i];
+
+            // Convert normalized coordinates to pixel coordinates
+            uint16_t x = static_cast<uint16_t>(det.x * CMX_DISPLAY_WIDTH);
+            uint16_t y = static_cast<uint16_t>(det.y * CMX_DISPLAY_HEIGHT);
+            uint16_t w = static_cast<uint16_t>(det.w * CMX_DISPLAY_WIDTH);
+            uint16_t h = static_cast<uint16_t>(det.h * CMX_DISPLAY_HEIGHT);
+
+            // Draw bounding box
+            draw_bounding_box(x, y, w, h, det.class_name, det.confidence);
+        }
+
+        // Update display
+        display_update();
     }
-    
-    // Post-process detections
-    uint16_t num_detections = postprocess_detections(output_data, g_detections);
-    
-    // Clear display and render frame
-    display_clear();
-    
-    // Display camera frame (if display supports it)
-    display_draw_image(0, 0, CMX_INPUT_WIDTH, CMX_INPUT_HEIGHT, frame_data);
-    
-    // Render bounding boxes
-    for (uint16_t i = 0; i < num_detections; i++) {
-        const CMXDetection& det = g_detections[i];
-        
-        // Convert normalized coordinates to pixel coordinates
-        uint16_t x = static_cast<uint16_t>(det.x * CMX_DISPLAY_WIDTH);
-        uint16_t y = static_cast<uint16_t>(det.y * CMX_DISPLAY_HEIGHT);
-        uint16_t w = static_cast<uint16_t>(det.w * CMX_DISPLAY_WIDTH);
-        uint16_t h = static_cast<uint16_t>(det.h * CMX_DISPLAY_HEIGHT);
-        
-        // Draw bounding box
-        draw_bounding_box(x, y, w, h, det.class_name, det.confidence);
+
+    // Complete the capture (the single fused color-convert pass lands
+    // in the bound tensor) and flip the buffers for the next frame
+    if (camera_capture_finish(1000) != CMX_SUCCESS) {
+        return CMX_ERROR_CAMERA;
     }
-    
-    // Update display
-    display_update();
-    
+    if (cmx_double_buffer_swap(&g_input_buffers) != CMX_STATUS_SUCCESS) {
+        return CMX_ERROR_INFERENCE;
+    }
+
     return CMX_SUCCESS;
 }
 
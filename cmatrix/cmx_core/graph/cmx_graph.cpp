@@ -8,7 +8,7 @@
 namespace cmx {
 namespace graph {
 
-CMXGraph::CMXGraph() : next_node_id_(1) {}
+CMXGraph::CMXGraph() : live_node_count_(0) {}
 
 CMXGraph::~CMXGraph() {
     nodes_.clear();
@@ -21,28 +21,31 @@ NodeID CMXGraph::add_node(NodePtr node) {
     if (!node) {
         return 0; // Invalid node ID
     }
-    
-    NodeID node_id = next_node_id_++;
-    nodes_[node_id] = node;
-    
-    // Initialize adjacency lists
-    adjacency_list_[node_id] = std::vector<NodeID>();
-    reverse_adjacency_list_[node_id] = std::vector<NodeID>();
-    
+
+    // Append-only: slot index + 1 is the node's stable ID
+    nodes_.push_back(node);
+    adjacency_list_.emplace_back();
+    reverse_adjacency_list_.emplace_back();
+    live_node_count_++;
+
+    NodeID node_id = static_cast<NodeID>(nodes_.size());
     update_adjacency_lists();
     return node_id;
 }
 
+bool CMXGraph::is_live(NodeID node_id) const {
+    return node_id >= 1 && node_id <= nodes_.size() && nodes_[node_id - 1];
+}
+
 NodePtr CMXGraph::get_node(NodeID node_id) const {
-    auto it = nodes_.find(node_id);
-    return (it != nodes_.end()) ? it->second : nullptr;
+    return is_live(node_id) ? nodes_[node_id - 1] : nullptr;
 }
 
 std::vector<NodeID> CMXGraph::get_input_nodes() const {
     std::vector<NodeID> input_nodes;
-    for (const auto& [node_id, _] : nodes_) {
-        if (reverse_adjacency_list_.at(node_id).empty()) {
-            input_nodes.push_back(node_id);
+    for (NodeID id = 1; id <= nodes_.size(); ++id) {
+        if (is_live(id) && reverse_adjacency_list_[id - 1].empty()) {
+            input_nodes.push_back(id);
         }
     }
     return input_nodes;
@@ -50,9 +53,9 @@ std::vector<NodeID> CMXGraph::get_input_nodes() const {
 
 std::vector<NodeID> CMXGraph::get_output_nodes() const {
     std::vector<NodeID> output_nodes;
-    for (const auto& [node_id, _] : nodes_) {
-        if (adjacency_list_.at(node_id).empty()) {
-            output_nodes.push_back(node_id);
+    for (NodeID id = 1; id <= nodes_.size(); ++id) {
+        if (is_live(id) && adjacency_list_[id - 1].empty()) {
+            output_nodes.push_back(id);
         }
     }
     return output_nodes;
@@ -60,139 +63,140 @@ std::vector<NodeID> CMXGraph::get_output_nodes() const {
 
 std::vector<NodeID> CMXGraph::topological_sort() const {
     std::vector<NodeID> result;
-    std::unordered_map<NodeID, int> in_degree;
-    
-    // Calculate in-degrees
-    for (const auto& [node_id, _] : nodes_) {
-        in_degree[node_id] = reverse_adjacency_list_.at(node_id).size();
+    std::vector<int> in_degree(nodes_.size(), -1);
+
+    // Calculate in-degrees; dead slots keep -1 and never enqueue
+    for (NodeID id = 1; id <= nodes_.size(); ++id) {
+        if (is_live(id)) {
+            in_degree[id - 1] = static_cast<int>(reverse_adjacency_list_[id - 1].size());
+        }
     }
-    
+
     // Initialize queue with nodes having in-degree 0
     std::queue<NodeID> queue;
-    for (const auto& [node_id, degree] : in_degree) {
-        if (degree == 0) {
-            queue.push(node_id);
+    for (NodeID id = 1; id <= nodes_.size(); ++id) {
+        if (in_degree[id - 1] == 0) {
+            queue.push(id);
         }
     }
-    
+
     // Process nodes
     while (!queue.empty()) {
         NodeID current = queue.front();
         queue.pop();
         result.push_back(current);
-        
+
         // Update in-degrees of successors
-        for (NodeID successor : adjacency_list_.at(current)) {
-            in_degree[successor]--;
-            if (in_degree[successor] == 0) {
+        for (NodeID successor : adjacency_list_[current - 1]) {
+            in_degree[successor - 1]--;
+            if (in_degree[successor - 1] == 0) {
                 queue.push(successor);
             }
         }
     }
-    
+
     // Check for cycles
-    if (result.size() != nodes_.size()) {
+    if (result.size() != live_node_count_) {
         result.clear(); // Return empty vector if cycle detected
     }
-    
+
     return result;
 }
 
 std::vector<NodeID> CMXGraph::get_predecessors(NodeID node_id) const {
-    auto it = reverse_adjacency_list_.find(node_id);
-    return (it != reverse_adjacency_list_.end()) ? it->second : std::vector<NodeID>();
+    return is_live(node_id) ? reverse_adjacency_list_[node_id - 1]
+                            : std::vector<NodeID>();
 }
 
 std::vector<NodeID> CMXGraph::get_successors(NodeID node_id) const {
-    auto it = adjacency_list_.find(node_id);
-    return (it != adjacency_list_.end()) ? it->second : std::vector<NodeID>();
+    return is_live(node_id) ? adjacency_list_[node_id - 1]
+                            : std::vector<NodeID>();
 }
 
 bool CMXGraph::remove_node(NodeID node_id) {
-    auto it = nodes_.find(node_id);
-    if (it == nodes_.end()) {
+    if (!is_live(node_id)) {
         return false;
     }
-    
-    // Remove from adjacency lists
-    adjacency_list_.erase(node_id);
-    reverse_adjacency_list_.erase(node_id);
-    
+
+    // Tombstone the slot so remaining IDs stay stable
+    nodes_[node_id - 1].reset();
+    adjacency_list_[node_id - 1].clear();
+    reverse_adjacency_list_[node_id - 1].clear();
+    live_node_count_--;
+
     // Remove references from other nodes
-    for (auto& [_, successors] : adjacency_list_) {
-        successors.erase(std::remove(successors.begin(), successors.end(), node_id), 
+    for (auto& successors : adjacency_list_) {
+        successors.erase(std::remove(successors.begin(), successors.end(), node_id),
                         successors.end());
     }
-    
-    for (auto& [_, predecessors] : reverse_adjacency_list_) {
-        predecessors.erase(std::remove(predecessors.begin(), predecessors.end(), node_id), 
+
+    for (auto& predecessors : reverse_adjacency_list_) {
+        predecessors.erase(std::remove(predecessors.begin(), predecessors.end(), node_id),
                           predecessors.end());
     }
-    
-    nodes_.erase(it);
+
     return true;
 }
 
 std::unique_ptr<CMXGraph> CMXGraph::clone() const {
     auto cloned_graph = std::make_unique<CMXGraph>();
     std::unordered_map<NodeID, NodeID> node_mapping;
-    
+
     // Clone all nodes
-    for (const auto& [node_id, node] : nodes_) {
-        auto cloned_node = std::make_shared<CMXNode>(*node);
+    for (NodeID id = 1; id <= nodes_.size(); ++id) {
+        if (!is_live(id)) {
+            continue;
+        }
+        auto cloned_node = std::make_shared<CMXNode>(*nodes_[id - 1]);
         NodeID new_node_id = cloned_graph->add_node(cloned_node);
-        node_mapping[node_id] = new_node_id;
+        node_mapping[id] = new_node_id;
     }
-    
+
     // Clone tensors
     for (const auto& [tensor_id, tensor] : tensors_) {
         cloned_graph->register_tensor(tensor_id, tensor);
     }
-    
+
     return cloned_graph;
 }
 
 std::unique_ptr<CMXGraph> CMXGraph::extract_subgraph(const std::vector<NodeID>& node_ids) const {
     auto subgraph = std::make_unique<CMXGraph>();
     std::unordered_map<NodeID, NodeID> node_mapping;
-    
+
     // Add specified nodes to subgraph
     for (NodeID node_id : node_ids) {
-        auto it = nodes_.find(node_id);
-        if (it != nodes_.end()) {
-            auto cloned_node = std::make_shared<CMXNode>(*it->second);
-            NodeID new_node_id = subgraph->add_node(cloned_node);
-            node_mapping[node_id] = new_node_id;
+        if (!is_live(node_id)) {
+            continue;
         }
+        auto cloned_node = std::make_shared<CMXNode>(*nodes_[node_id - 1]);
+        NodeID new_node_id = subgraph->add_node(cloned_node);
+        node_mapping[node_id] = new_node_id;
     }
-    
+
     return subgraph;
 }
 
 size_t CMXGraph::node_count() const {
-    return nodes_.size();
+    return live_node_count_;
 }
 
 bool CMXGraph::empty() const {
-    return nodes_.empty();
+    return live_node_count_ == 0;
 }
 
 bool CMXGraph::validate() const {
     // Check for cycles
-    std::unordered_map<NodeID, int> color; // 0: white, 1: gray, 2: black
-    
-    for (const auto& [node_id, _] : nodes_) {
-        color[node_id] = 0;
-    }
-    
-    for (const auto& [node_id, _] : nodes_) {
-        if (color[node_id] == 0) {
-            if (has_cycle_util(node_id, color)) {
+    std::vector<int> color(nodes_.size(), 0); // 0: white, 1: gray, 2: black
+
+    for (NodeID id = 1; id <= nodes_.size(); ++id) {
+        if (is_live(id) && color[id - 1] == 0) {
+            if (has_cycle_util(id, color)) {
                 return false;
             }
         }
     }
-    
+
     return true;
 }
 
@@ -216,31 +220,33 @@ std::vector<TensorID> CMXGraph::get_tensor_ids() const {
 std::string CMXGraph::to_string() const {
     std::ostringstream oss;
     oss << "CMXGraph {\n";
-    oss << "  Nodes: " << nodes_.size() << "\n";
+    oss << "  Nodes: " << live_node_count_ << "\n";
     oss << "  Tensors: " << tensors_.size() << "\n";
-    
-    for (const auto& [node_id, node] : nodes_) {
-        oss << "  Node " << node_id << ": " << node->to_string() << "\n";
+
+    for (NodeID id = 1; id <= nodes_.size(); ++id) {
+        if (is_live(id)) {
+            oss << "  Node " << id << ": " << nodes_[id - 1]->to_string() << "\n";
+        }
     }
-    
+
     oss << "}";
     return oss.str();
 }
 
 std::unordered_map<std::string, uint32_t> CMXGraph::get_stats() const {
     std::unordered_map<std::string, uint32_t> stats;
-    stats["node_count"] = static_cast<uint32_t>(nodes_.size());
+    stats["node_count"] = static_cast<uint32_t>(live_node_count_);
     stats["tensor_count"] = static_cast<uint32_t>(tensors_.size());
     stats["input_nodes"] = static_cast<uint32_t>(get_input_nodes().size());
     stats["output_nodes"] = static_cast<uint32_t>(get_output_nodes().size());
-    
+
     // Count edges
     uint32_t edge_count = 0;
-    for (const auto& [_, successors] : adjacency_list_) {
+    for (const auto& successors : adjacency_list_) {
         edge_count += static_cast<uint32_t>(successors.size());
     }
     stats["edge_count"] = edge_count;
-    
+
     return stats;
 }
 
@@ -250,19 +256,19 @@ void CMXGraph::update_adjacency_lists() {
     // and update the adjacency lists accordingly
 }
 
-bool CMXGraph::has_cycle_util(NodeID node_id, std::unordered_map<NodeID, int>& color) const {
-    color[node_id] = 1; // Gray
-    
-    for (NodeID successor : adjacency_list_.at(node_id)) {
-        if (color[successor] == 1) {
+bool CMXGraph::has_cycle_util(NodeID node_id, std::vector<int>& color) const {
+    color[node_id - 1] = 1; // Gray
+
+    for (NodeID successor : adjacency_list_[node_id - 1]) {
+        if (color[successor - 1] == 1) {
             return true; // Back edge found
         }
-        if (color[successor] == 0 && has_cycle_util(successor, color)) {
+        if (color[successor - 1] == 0 && has_cycle_util(successor, color)) {
             return true;
         }
     }
-    
-    color[node_id] = 2; // Black
+
+    color[node_id - 1] = 2; // Black
     return false;
 }
 
@@ -273,4 +279,4 @@ void CMXGraph::clone_node_recursive(NodeID node_id, const CMXGraph& source,
 }
 
 } // namespace graph
-} // namespace cmx
\ No newline at end of file
+} // namespace cmx
@@ -149,18 +149,24 @@ public:
     std::unordered_map<std::string, uint32_t> get_stats() const;
 
 private:
-    // Internal data structures
-    std::unordered_map<NodeID, NodePtr> nodes_;
-    std::unordered_map<NodeID, std::vector<NodeID>> adjacency_list_;
-    std::unordered_map<NodeID, std::vector<NodeID>> reverse_adjacency_list_;
+    // Dense, index-addressed node storage: NodeID n lives at slot
+    // n - 1 and the adjacency lists are parallel arrays over the same
+    // indices, so a plan walk is a linear scan over contiguous slots
+    // instead of hash lookups. Removal leaves a tombstone (null entry)
+    // to keep IDs stable. The op type enum on each node already serves
+    // as the interned operation id.
+    std::vector<NodePtr> nodes_;
+    std::vector<std::vector<NodeID>> adjacency_list_;
+    std::vector<std::vector<NodeID>> reverse_adjacency_list_;
     std::unordered_map<TensorID, std::shared_ptr<CMXTensor>> tensors_;
-    
-    NodeID next_node_id_;
+
+    size_t live_node_count_;
 
     // Internal helper methods
     void update_adjacency_lists();
-    bool has_cycle_util(NodeID node_id, std::unordered_map<NodeID, int>& color) const;
-    void clone_node_recursive(NodeID node_id, const CMXGraph& source, 
+    bool is_live(NodeID node_id) const;
+    bool has_cycle_util(NodeID node_id, std::vector<int>& color) const;
+    void clone_node_recursive(NodeID node_id, const CMXGraph& source,
                              std::unordered_map<NodeID, NodeID>& node_mapping) const;
 };
 
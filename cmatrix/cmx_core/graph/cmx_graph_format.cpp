@@ -69,6 +69,32 @@ uint32_t CMXGraphFormat::align_offset(uint32_t offset, TensorAlignment alignment
     return (offset + align_value - 1) & ~(align_value - 1);
 }
 
+TensorAlignment CMXGraphFormat::effective_alignment(TensorPrecision precision,
+                                                    TensorAlignment requested) {
+    uint32_t minimum = static_cast<uint32_t>(get_alignment_for_precision(precision));
+    uint32_t value = static_cast<uint32_t>(requested);
+    return static_cast<TensorAlignment>(value > minimum ? value : minimum);
+}
+
+uint32_t CMXGraphFormat::layout_tensor_payloads(CMXIOInfo* tensors, size_t count,
+                                                TensorAlignment alignment) {
+    if (!tensors || count == 0) {
+        return 0;
+    }
+
+    uint32_t offset = 0;
+    for (size_t i = 0; i < count; ++i) {
+        TensorAlignment applied = effective_alignment(tensors[i].precision, alignment);
+        offset = align_offset(offset, applied);
+        tensors[i].alignment = applied;
+        tensors[i].offset = offset;
+        offset += tensors[i].byte_size;
+    }
+
+    // Pad the section end so a following section starts aligned
+    return align_offset(offset, alignment);
+}
+
 bool CMXGraphFormat::is_layout_compatible(DataLayout layout, uint8_t rank) {
     size_t layout_index = static_cast<size_t>(layout);
     if (layout_index >= LAYOUT_RANKS.size()) {
@@ -187,7 +213,12 @@ const char* CMXGraphFormat::version_to_string(GraphFormatVersion version) {
             return "1.0";
         case GraphFormatVersion::VERSION_1_1:
             return "1.1";
+        case GraphFormatVersion::VERSION_1_2:
+            return "1.2";
         default:
             return "unknown";
     }
-}
\ No newline at end of file
+}
+
+} // namespace graph
+} // namespace cmx
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 #include <array>
 
 namespace cmx {
@@ -10,7 +11,9 @@ namespace graph {
 enum class GraphFormatVersion : uint16_t {
     VERSION_1_0 = 0x0100,
     VERSION_1_1 = 0x0101,
-    CURRENT = VERSION_1_1
+    VERSION_1_2 = 0x0102,  // Alignment-padded tensor payload sections
+    VERSION_1_3 = 0x0103,  // Per-tensor compressed payloads
+    CURRENT = VERSION_1_3
 };
 
 /// @brief Tensor data layout formats
@@ -48,6 +51,12 @@ enum class TensorAlignment : uint8_t {
     BYTE_32 = 32
 };
 
+/// @brief Per-tensor payload compression schemes (v1.3)
+enum class PayloadCompression : uint8_t {
+    NONE = 0,
+    RLE = 1      // Byte-oriented run-length (count, value) pairs
+};
+
 /// @brief Graph execution modes
 enum class ExecutionMode : uint8_t {
     INFERENCE = 0,
@@ -77,9 +86,12 @@ struct CMXIOInfo {
     uint32_t dims[MAX_DIMS];
     uint32_t byte_size;
     uint32_t offset;  // Offset in memory buffer
-    
+    PayloadCompression compression;  // Scheme applied to the stored payload (v1.3)
+    uint32_t stored_size;            // On-disk payload bytes; byte_size once decompressed
+
     CMXIOInfo() : tensor_id(0), layout(DataLayout::UNKNOWN), precision(TensorPrecision::UNKNOWN),
-                  alignment(TensorAlignment::BYTE_1), rank(0), byte_size(0), offset(0) {
+                  alignment(TensorAlignment::BYTE_1), rank(0), byte_size(0), offset(0),
+                  compression(PayloadCompression::NONE), stored_size(0) {
         name[0] = '\0';
         for (size_t i = 0; i < MAX_DIMS; ++i) {
             dims[i] = 0;
@@ -131,13 +143,14 @@ struct CMXGraphHeader {
     uint32_t output_count;
     OptimizationLevel optimization_level;
     ExecutionMode execution_mode;
-    uint16_t reserved;
+    TensorAlignment payload_alignment;  // Padding applied to tensor payloads (v1.2)
+    uint8_t reserved;
     uint32_t checksum;
-    
+
     CMXGraphHeader() : magic(MAGIC_NUMBER), version(GraphFormatVersion::CURRENT), flags(0),
                        graph_size(0), node_count(0), tensor_count(0), input_count(0), output_count(0),
                        optimization_level(OptimizationLevel::NONE), execution_mode(ExecutionMode::INFERENCE),
-                       reserved(0), checksum(0) {}
+                       payload_alignment(TensorAlignment::BYTE_16), reserved(0), checksum(0) {}
     
     /// @brief Validate header magic and version
     bool is_valid() const {
@@ -165,6 +178,24 @@ public:
     
     /// @brief Calculate aligned offset
     static uint32_t align_offset(uint32_t offset, TensorAlignment alignment);
+
+    /// @brief Alignment actually applied to a payload
+    ///
+    /// The section alignment from the header, raised to the precision's
+    /// own minimum when that is stricter.
+    static TensorAlignment effective_alignment(TensorPrecision precision, TensorAlignment requested);
+
+    /// @brief Assign alignment-padded payload offsets to a tensor table
+    ///
+    /// Places each tensor at the next offset padded to its effective
+    /// alignment, recording offset and alignment in the CMXIOInfo entry,
+    /// so mapped buffers are directly consumable by vector kernels.
+    /// @param tensors Tensor table to place
+    /// @param count Number of entries
+    /// @param alignment Section alignment recorded in the header
+    /// @return Total padded section size in bytes
+    static uint32_t layout_tensor_payloads(CMXIOInfo* tensors, size_t count,
+                                           TensorAlignment alignment);
     
     /// @brief Validate layout compatibility with tensor rank
     static bool is_layout_compatible(DataLayout layout, uint8_t rank);
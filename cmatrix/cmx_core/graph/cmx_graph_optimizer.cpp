@@ -3,6 +3,8 @@
 #include "cmx_node.hpp"
 #include <chrono>
 #include <algorithm>
+#include <cmath>
+#include <unordered_set>
 
 namespace cmx {
 namespace graph {
@@ -121,28 +123,302 @@ void CMXGraphOptimizer::clear_stats() {
     cumulative_stats_ = OptimizationStats();
 }
 
+OptimizationResult CMXGraphOptimizer::partition_for_backend(
+    CMXGraph& graph,
+    const std::string& backend_name,
+    const BackendSupportQuery& supports,
+    std::vector<SubgraphPartition>& partitions) {
+    partitions.clear();
+    if (!supports) {
+        return OptimizationResult::FAILED;
+    }
+
+    const std::vector<NodeID> order = graph.topological_sort();
+    if (order.empty() && graph.node_count() > 0) {
+        return OptimizationResult::GRAPH_INVALID;
+    }
+
+    std::unordered_map<TensorID, NodeID> producers;
+    std::unordered_map<TensorID, std::vector<NodeID>> consumers;
+    for (NodeID id : order) {
+        NodePtr node = graph.get_node(id);
+        if (!node) {
+            continue;
+        }
+        for (TensorID out : node->get_outputs()) {
+            producers[out] = id;
+        }
+        for (TensorID in : node->get_inputs()) {
+            consumers[in].push_back(id);
+        }
+    }
+
+    // Greedy clustering in topological order. reach[n] is the set of
+    // partitions n transitively depends on; a node may join partition
+    // P only when none of its other producer chains pull P in from
+    // outside, since that path would have to run both before and
+    // after the fused call - a cycle.
+    std::unordered_map<NodeID, int> assigned;
+    std::unordered_map<NodeID, std::vector<int>> reach;
+    std::vector<std::vector<NodeID>> groups;
+
+    auto contains = [](const std::vector<int>& set, int value) {
+        return std::find(set.begin(), set.end(), value) != set.end();
+    };
+
+    for (NodeID id : order) {
+        NodePtr node = graph.get_node(id);
+        if (!node) {
+            continue;
+        }
+
+        std::vector<NodeID> direct_producers;
+        std::vector<int>& deps = reach[id];
+        for (TensorID in : node->get_inputs()) {
+            auto produced = producers.find(in);
+            if (produced == producers.end()) {
+                continue;
+            }
+            NodeID u = produced->second;
+            direct_producers.push_back(u);
+            for (int part : reach[u]) {
+                if (!contains(deps, part)) {
+                    deps.push_back(part);
+                }
+            }
+            auto part = assigned.find(u);
+            if (part != assigned.end() && !contains(deps, part->second)) {
+                deps.push_back(part->second);
+            }
+        }
+
+        if (!supports(*node)) {
+            continue;
+        }
+
+        int chosen = -1;
+        for (NodeID u : direct_producers) {
+            auto part = assigned.find(u);
+            if (part == assigned.end()) {
+                continue;
+            }
+            int candidate = part->second;
+            bool safe = true;
+            for (NodeID w : direct_producers) {
+                auto w_part = assigned.find(w);
+                if (w_part != assigned.end() && w_part->second == candidate) {
+                    continue;  // Stays inside the partition
+                }
+                if (contains(reach[w], candidate)) {
+                    safe = false;
+                    break;
+                }
+            }
+            if (safe) {
+                chosen = candidate;
+                break;
+            }
+        }
+        if (chosen < 0) {
+            chosen = static_cast<int>(groups.size());
+            groups.emplace_back();
+        }
+        groups[chosen].push_back(id);
+        assigned[id] = chosen;
+    }
+
+    // Boundary tensors: inputs cross into the subgraph, outputs are
+    // produced inside and visible outside it
+    for (const std::vector<NodeID>& group : groups) {
+        if (group.empty()) {
+            continue;
+        }
+        SubgraphPartition partition;
+        partition.backend_name = backend_name;
+        partition.node_ids = group;
+
+        std::unordered_set<NodeID> members(group.begin(), group.end());
+        std::unordered_set<TensorID> inside;
+        for (NodeID id : group) {
+            for (TensorID out : graph.get_node(id)->get_outputs()) {
+                inside.insert(out);
+            }
+        }
+        std::unordered_set<TensorID> seen_inputs;
+        for (NodeID id : group) {
+            NodePtr node = graph.get_node(id);
+            for (TensorID in : node->get_inputs()) {
+                if (inside.count(in) == 0 && seen_inputs.insert(in).second) {
+                    partition.input_tensors.push_back(in);
+                }
+            }
+            for (TensorID out : node->get_outputs()) {
+                bool external = true;
+                auto used = consumers.find(out);
+                if (used != consumers.end()) {
+                    external = false;
+                    for (NodeID reader : used->second) {
+                        if (members.count(reader) == 0) {
+                            external = true;
+                            break;
+                        }
+                    }
+                }
+                if (external) {
+                    partition.output_tensors.push_back(out);
+                }
+            }
+        }
+
+        partitions.push_back(std::move(partition));
+    }
+
+    return partitions.empty() ? OptimizationResult::NO_CHANGES
+                              : OptimizationResult::SUCCESS;
+}
+
+OptimizationResult CMXGraphOptimizer::fuse_partitions(
+    CMXGraph& graph,
+    const std::vector<SubgraphPartition>& partitions,
+    OptimizationStats& stats) {
+    stats.nodes_fused = 0;
+
+    for (const SubgraphPartition& partition : partitions) {
+        // A single node gains nothing from the subgraph wrapper
+        if (partition.node_ids.size() < 2) {
+            continue;
+        }
+
+        auto subgraph_node = std::make_shared<CMXNode>(
+            CMXOpType::CUSTOM, partition.backend_name + "_subgraph");
+        subgraph_node->set_string_attribute("custom_op", "BackendSubgraph");
+        subgraph_node->set_string_attribute("backend", partition.backend_name);
+        for (uint32_t in : partition.input_tensors) {
+            subgraph_node->add_input(in);
+        }
+        for (uint32_t out : partition.output_tensors) {
+            subgraph_node->add_output(out);
+        }
+
+        graph.add_node(subgraph_node);
+        for (uint32_t id : partition.node_ids) {
+            graph.remove_node(id);
+        }
+        stats.nodes_fused += static_cast<uint32_t>(partition.node_ids.size());
+    }
+
+    return stats.nodes_fused > 0 ? OptimizationResult::SUCCESS
+                                 : OptimizationResult::NO_CHANGES;
+}
+
 void CMXGraphOptimizer::register_builtin_passes() {
     OptimizationPassConfig default_config;
     default_config.max_iterations = 3;
     
     register_pass("constant_folding", constant_folding_pass, default_config);
     register_pass("dead_code_elimination", dead_code_elimination_pass, default_config);
+    register_pass("common_subexpression_elimination", common_subexpression_elimination_pass, default_config);
     register_pass("operator_fusion", operator_fusion_pass, default_config);
     register_pass("algebraic_simplification", algebraic_simplification_pass, default_config);
     register_pass("memory_layout_optimization", memory_layout_optimization_pass, default_config);
     register_pass("redundant_transpose_elimination", redundant_transpose_elimination_pass, default_config);
     register_pass("batch_normalization_folding", batch_normalization_folding_pass, default_config);
+    register_pass("quantize_dequantize_elimination", quantize_dequantize_elimination_pass, default_config);
+    register_pass("scale_harmonization", scale_harmonization_pass, default_config);
+    register_pass("padding_elimination", padding_elimination_pass, default_config);
 }
 
 OptimizationResult CMXGraphOptimizer::constant_folding_pass(CMXGraph& graph, OptimizationStats& stats) {
-    // TODO: Implement constant folding
-    // - Find nodes with all constant inputs
-    // - Evaluate them at compile time
-    // - Replace with constant nodes
-    
-    // Placeholder implementation
+    // Evaluate subgraphs whose inputs are all constants (shape
+    // computations, scale adjustments, folded BN parameters) once at
+    // load and drop the nodes, leaving only their pre-computed output
+    // tensors. A tensor counts as constant when it is registered with
+    // the graph but produced by no node (weights and initializers), or
+    // when a folded node just produced it. Evaluation goes through
+    // CMXNode::execute, the interpreted fallback, writing straight
+    // into the registered output tensors.
     stats.constants_folded = 0;
-    return OptimizationResult::NO_CHANGES;
+
+    const std::vector<NodeID> node_ids = graph.topological_sort();
+    if (node_ids.empty() && graph.node_count() > 0) {
+        return OptimizationResult::GRAPH_INVALID;
+    }
+
+    std::unordered_map<TensorID, NodeID> producers;
+    for (NodeID id : node_ids) {
+        NodePtr node = graph.get_node(id);
+        if (!node) {
+            continue;
+        }
+        for (TensorID out : node->get_outputs()) {
+            producers[out] = id;
+        }
+    }
+
+    auto is_constant_tensor = [&](TensorID tensor) {
+        return producers.find(tensor) == producers.end() &&
+               graph.get_tensor(tensor) != nullptr;
+    };
+
+    // The stubbed adjacency lists give topological_sort no real
+    // ordering, so sweep until a full pass folds nothing
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (NodeID id : node_ids) {
+            NodePtr node = graph.get_node(id);
+            if (!node || node->output_count() == 0) {
+                continue;
+            }
+            // Constant producers have nothing to fold themselves
+            if (is_constant_node(*node)) {
+                continue;
+            }
+
+            bool foldable = node->input_count() > 0;
+            for (TensorID in : node->get_inputs()) {
+                if (!is_constant_tensor(in)) {
+                    foldable = false;
+                    break;
+                }
+            }
+            if (!foldable) {
+                continue;
+            }
+
+            // Outputs need registered storage to hold the folded value
+            std::vector<void*> input_tensors;
+            std::vector<void*> output_tensors;
+            for (TensorID in : node->get_inputs()) {
+                input_tensors.push_back(graph.get_tensor(in).get());
+            }
+            bool storage_ok = true;
+            for (TensorID out : node->get_outputs()) {
+                std::shared_ptr<CMXTensor> tensor = graph.get_tensor(out);
+                if (!tensor) {
+                    storage_ok = false;
+                    break;
+                }
+                output_tensors.push_back(tensor.get());
+            }
+            if (!storage_ok || !node->execute(input_tensors, output_tensors)) {
+                continue;
+            }
+
+            // The outputs are constants now; drop the node so later
+            // iterations can fold its consumers too
+            for (TensorID out : node->get_outputs()) {
+                producers.erase(out);
+            }
+            graph.remove_node(id);
+            stats.constants_folded++;
+            changed = true;
+        }
+    }
+
+    return stats.constants_folded > 0 ? OptimizationResult::SUCCESS
+                                      : OptimizationResult::NO_CHANGES;
 }
 
 OptimizationResult CMXGraphOptimizer::dead_code_elimination_pass(CMXGraph& graph, OptimizationStats& stats) {
@@ -155,14 +431,268 @@ OptimizationResult CMXGraphOptimizer::dead_code_elimination_pass(CMXGraph& graph
     return OptimizationResult::NO_CHANGES;
 }
 
+namespace {
+
+/// @brief Commutative ops whose operand order does not matter
+bool is_commutative(CMXOpType op) {
+    switch (op) {
+        case CMXOpType::ADD:
+        case CMXOpType::MUL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// @brief Compare the full attribute sets of two nodes
+bool same_attributes(const CMXNode& a, const CMXNode& b) {
+    std::vector<std::string> keys = a.get_attribute_keys();
+    if (keys.size() != b.get_attribute_keys().size()) {
+        return false;
+    }
+    for (const std::string& key : keys) {
+        const AttributeValue* value_a = a.get_attribute(key);
+        const AttributeValue* value_b = b.get_attribute(key);
+        if (!value_b || !(*value_a == *value_b)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Inputs read by a node, operand order canonicalized
+std::vector<TensorID> canonical_inputs(const CMXNode& node) {
+    std::vector<TensorID> inputs = node.get_inputs();
+    if (is_commutative(node.get_op_type())) {
+        std::sort(inputs.begin(), inputs.end());
+    }
+    return inputs;
+}
+
+} // namespace
+
+OptimizationResult CMXGraphOptimizer::common_subexpression_elimination_pass(CMXGraph& graph, OptimizationStats& stats) {
+    // Multi-head exporters duplicate shared preprocessing per head, so
+    // the same normalize -> conv stem runs once per head every frame.
+    // Two nodes compute the same tensor when they apply the same op to
+    // the same input tensors with the same attributes (constants
+    // travel as node attributes here, so attribute equality covers the
+    // identical-constant-inputs requirement); the duplicate's readers
+    // are repointed at the survivor's outputs and the duplicate
+    // removed. The fixpoint sweep then finds the heads' next layers
+    // agreeing on their inputs, so a duplicated stem collapses one
+    // layer per iteration until the graphs diverge for real.
+    stats.nodes_removed = 0;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        const std::vector<NodeID> node_ids = graph.topological_sort();
+        if (node_ids.empty() && graph.node_count() > 0) {
+            return OptimizationResult::GRAPH_INVALID;
+        }
+
+        std::unordered_map<TensorID, std::vector<NodeID>> consumers;
+        for (NodeID id : node_ids) {
+            NodePtr node = graph.get_node(id);
+            if (!node) {
+                continue;
+            }
+            for (TensorID in : node->get_inputs()) {
+                consumers[in].push_back(id);
+            }
+        }
+
+        for (size_t i = 0; i < node_ids.size() && !changed; ++i) {
+            NodePtr kept = graph.get_node(node_ids[i]);
+            if (!kept || kept->output_count() == 0) {
+                continue;
+            }
+            for (size_t j = i + 1; j < node_ids.size(); ++j) {
+                NodePtr duplicate = graph.get_node(node_ids[j]);
+                if (!duplicate ||
+                    duplicate->get_op_type() != kept->get_op_type() ||
+                    duplicate->output_count() != kept->output_count() ||
+                    canonical_inputs(*duplicate) != canonical_inputs(*kept) ||
+                    !same_attributes(*kept, *duplicate)) {
+                    continue;
+                }
+
+                // Every duplicate output needs a reader to repoint; an
+                // unread output is a graph output, and dropping the
+                // node would leave it unproduced
+                bool all_consumed = true;
+                for (TensorID out : duplicate->get_outputs()) {
+                    auto use = consumers.find(out);
+                    if (use == consumers.end() || use->second.empty()) {
+                        all_consumed = false;
+                        break;
+                    }
+                }
+                if (!all_consumed) {
+                    continue;
+                }
+
+                // Repoint the duplicate's readers at the survivor
+                for (size_t slot = 0; slot < duplicate->output_count(); ++slot) {
+                    TensorID from = duplicate->get_output(slot);
+                    TensorID to = kept->get_output(slot);
+                    for (NodeID reader_id : consumers[from]) {
+                        NodePtr reader = graph.get_node(reader_id);
+                        if (!reader) {
+                            continue;
+                        }
+                        std::vector<TensorID> inputs = reader->get_inputs();
+                        reader->clear_inputs();
+                        for (TensorID in : inputs) {
+                            reader->add_input(in == from ? to : in);
+                        }
+                    }
+                }
+
+                graph.remove_node(node_ids[j]);
+                stats.nodes_removed++;
+                changed = true;
+                break;  // Tensor maps are stale; rescan
+            }
+        }
+    }
+
+    return stats.nodes_removed > 0 ? OptimizationResult::SUCCESS
+                                   : OptimizationResult::NO_CHANGES;
+}
+
+namespace {
+
+/// @brief Map an activation node type to the kernel-level activation
+/// name stored in the fused node's "activation" attribute
+const char* fusable_activation_name(CMXOpType op_type) {
+    switch (op_type) {
+        case CMXOpType::RELU: return "relu";
+        case CMXOpType::SIGMOID: return "sigmoid";
+        case CMXOpType::TANH: return "tanh";
+        // Piecewise-linear MobileNetV3 activations; the depthwise
+        // kernel evaluates them in its epilogue
+        case CMXOpType::HARD_SIGMOID: return "hard_sigmoid";
+        case CMXOpType::HARD_SWISH: return "hard_swish";
+        default: return nullptr;
+    }
+}
+
+} // namespace
+
 OptimizationResult CMXGraphOptimizer::operator_fusion_pass(CMXGraph& graph, OptimizationStats& stats) {
-    // TODO: Implement operator fusion
-    // - Find fusable operator patterns (e.g., Conv + BatchNorm + ReLU)
-    // - Merge them into single fused operations
-    
-    // Placeholder implementation
+    // Collapse Conv2D -> Add(bias) -> activation chains into a single
+    // convolution node. The kernel layer already evaluates bias and
+    // activation inside the convolution loop (use_bias and
+    // ActivationType in Conv2DParams), so each collapsed chain saves
+    // two kernel dispatches and two full activation-tensor traversals.
+    // The fused node records the result in its "use_bias" and
+    // "activation" attributes and adopts the chain's final output
+    // tensor, so downstream consumers are untouched.
+    //
+    // Binary elementwise nodes (Add/Sub/Mul) absorb a following
+    // activation the same way: the elementwise kernel evaluates the
+    // epilogue in its single pass, so a residual Add -> ReLU costs one
+    // traversal instead of two.
     stats.nodes_fused = 0;
-    return OptimizationResult::NO_CHANGES;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        const std::vector<NodeID> node_ids = graph.topological_sort();
+        if (node_ids.empty() && graph.node_count() > 0) {
+            return OptimizationResult::GRAPH_INVALID;
+        }
+
+        // Producer and consumer maps keyed by tensor ID; fusion rewires
+        // tensors, which the node-level adjacency lists do not track
+        std::unordered_map<TensorID, NodeID> producers;
+        std::unordered_map<TensorID, std::vector<NodeID>> consumers;
+        for (NodeID id : node_ids) {
+            NodePtr node = graph.get_node(id);
+            if (!node) {
+                continue;
+            }
+            for (TensorID out : node->get_outputs()) {
+                producers[out] = id;
+            }
+            for (TensorID in : node->get_inputs()) {
+                consumers[in].push_back(id);
+            }
+        }
+
+        for (NodeID id : node_ids) {
+            NodePtr conv = graph.get_node(id);
+            if (!conv || conv->output_count() != 1) {
+                continue;
+            }
+            CMXOpType op = conv->get_op_type();
+            const bool is_conv = op == CMXOpType::CONV2D ||
+                                 op == CMXOpType::DEPTHWISE_CONV2D;
+            const bool is_eltwise = op == CMXOpType::ADD ||
+                                    op == CMXOpType::SUB ||
+                                    op == CMXOpType::MUL;
+            if (!is_conv && !is_eltwise) {
+                continue;
+            }
+
+            // The chain may only be folded when the convolution's
+            // output feeds exactly one node
+            TensorID conv_out = conv->get_output(0);
+            auto use = consumers.find(conv_out);
+            if (use == consumers.end() || use->second.size() != 1) {
+                continue;
+            }
+            NodeID next_id = use->second[0];
+            NodePtr next = graph.get_node(next_id);
+            if (!next || !can_fuse_nodes(*conv, *next)) {
+                continue;
+            }
+
+            bool fused_here = false;
+            if (is_conv && next->get_op_type() == CMXOpType::ADD &&
+                conv->get_int_attribute("use_bias", 0) == 0 &&
+                next->input_count() == 2) {
+                // Bias step: the Add's other operand must be a graph
+                // constant, i.e. produced by no node
+                TensorID bias = next->get_input(0) == conv_out
+                    ? next->get_input(1) : next->get_input(0);
+                if (producers.find(bias) == producers.end()) {
+                    conv->add_input(bias);
+                    conv->set_int_attribute("use_bias", 1);
+                    conv->clear_outputs();
+                    conv->add_output(next->get_output(0));
+                    graph.remove_node(next_id);
+                    stats.nodes_fused++;
+                    fused_here = true;
+                }
+            } else if (next->get_op_type() != CMXOpType::ADD &&
+                       conv->get_string_attribute("activation").empty() &&
+                       next->input_count() == 1) {
+                // Activation step: absorb when nothing is fused yet
+                conv->set_string_attribute(
+                    "activation", fusable_activation_name(next->get_op_type()));
+                conv->clear_outputs();
+                conv->add_output(next->get_output(0));
+                graph.remove_node(next_id);
+                stats.nodes_fused++;
+                fused_here = true;
+            }
+
+            if (fused_here) {
+                // Tensor maps are stale after the rewire; rescan so a
+                // Conv -> Add -> ReLU chain folds fully
+                changed = true;
+                break;
+            }
+        }
+    }
+
+    return stats.nodes_fused > 0 ? OptimizationResult::SUCCESS
+                                 : OptimizationResult::NO_CHANGES;
 }
 
 OptimizationResult CMXGraphOptimizer::algebraic_simplification_pass(CMXGraph& graph, OptimizationStats& stats) {
@@ -187,30 +717,660 @@ OptimizationResult CMXGraphOptimizer::memory_layout_optimization_pass(CMXGraph&
     return OptimizationResult::NO_CHANGES;
 }
 
+namespace {
+
+/// @brief Get a transpose node's permutation, or nullptr if absent
+const std::vector<int32_t>* transpose_perm(const CMXNode& node) {
+    const AttributeValue* value = node.get_attribute("perm");
+    return value ? std::get_if<std::vector<int32_t>>(value) : nullptr;
+}
+
+/// @brief Check whether applying first then second is the identity
+bool perms_cancel(const std::vector<int32_t>& first,
+                  const std::vector<int32_t>& second) {
+    if (first.size() != second.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < second.size(); ++i) {
+        if (second[i] < 0 || static_cast<size_t>(second[i]) >= first.size() ||
+            first[second[i]] != static_cast<int32_t>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Elementwise unary ops a layout change passes through freely
+bool is_layout_agnostic(CMXOpType op_type) {
+    switch (op_type) {
+        case CMXOpType::RELU:
+        case CMXOpType::SIGMOID:
+        case CMXOpType::TANH:
+        case CMXOpType::HARD_SIGMOID:
+        case CMXOpType::HARD_SWISH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// @brief Layout the data is left in once the transpose is removed
+const char* format_before_transpose(const std::vector<int32_t>& perm) {
+    static const std::vector<int32_t> nchw_to_nhwc = {0, 2, 3, 1};
+    static const std::vector<int32_t> nhwc_to_nchw = {0, 3, 1, 2};
+    if (perm == nchw_to_nhwc) return "NCHW";
+    if (perm == nhwc_to_nchw) return "NHWC";
+    return nullptr;
+}
+
+} // namespace
+
 OptimizationResult CMXGraphOptimizer::redundant_transpose_elimination_pass(CMXGraph& graph, OptimizationStats& stats) {
-    // TODO: Implement redundant transpose elimination
-    // - Find transpose operations that cancel each other
-    // - Remove unnecessary transposes
-    
-    // Placeholder implementation
+    // Models converted from NCHW frameworks accumulate transpose pairs
+    // around every NHWC kernel; each surviving transpose copies a full
+    // activation tensor per frame. Propagate layout through chains of
+    // layout-agnostic elementwise nodes and cancel inverse transpose
+    // pairs, rewriting the data_format of the nodes in between so they
+    // run directly in the producer's layout.
     stats.nodes_removed = 0;
-    return OptimizationResult::NO_CHANGES;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        const std::vector<NodeID> node_ids = graph.topological_sort();
+        if (node_ids.empty() && graph.node_count() > 0) {
+            return OptimizationResult::GRAPH_INVALID;
+        }
+
+        std::unordered_map<TensorID, std::vector<NodeID>> consumers;
+        for (NodeID id : node_ids) {
+            NodePtr node = graph.get_node(id);
+            if (!node) {
+                continue;
+            }
+            for (TensorID in : node->get_inputs()) {
+                consumers[in].push_back(id);
+            }
+        }
+        auto sole_consumer = [&](TensorID tensor) -> NodeID {
+            auto it = consumers.find(tensor);
+            return (it != consumers.end() && it->second.size() == 1)
+                ? it->second[0] : 0;
+        };
+
+        for (NodeID id : node_ids) {
+            NodePtr first = graph.get_node(id);
+            if (!first || first->get_op_type() != CMXOpType::TRANSPOSE ||
+                first->input_count() != 1 || first->output_count() != 1) {
+                continue;
+            }
+            const std::vector<int32_t>* first_perm = transpose_perm(*first);
+            if (!first_perm) {
+                continue;
+            }
+
+            // Walk forward through single-consumer layout-agnostic
+            // nodes until something layout-sensitive appears
+            std::vector<NodeID> chain;
+            NodeID cursor = sole_consumer(first->get_output(0));
+            while (cursor != 0) {
+                NodePtr node = graph.get_node(cursor);
+                if (!node || node->input_count() != 1 ||
+                    node->output_count() != 1 ||
+                    !is_layout_agnostic(node->get_op_type())) {
+                    break;
+                }
+                chain.push_back(cursor);
+                cursor = sole_consumer(node->get_output(0));
+            }
+            if (cursor == 0) {
+                continue;
+            }
+            NodePtr second = graph.get_node(cursor);
+            if (!second || second->get_op_type() != CMXOpType::TRANSPOSE ||
+                second->input_count() != 1 || second->output_count() != 1) {
+                continue;
+            }
+            const std::vector<int32_t>* second_perm = transpose_perm(*second);
+            if (!second_perm || !perms_cancel(*first_perm, *second_perm)) {
+                continue;
+            }
+
+            // Bypass both transposes: the chain reads the first one's
+            // source directly and its tail adopts the pair's final
+            // output tensor, so downstream consumers are untouched
+            TensorID source = first->get_input(0);
+            TensorID final_out = second->get_output(0);
+            const char* layout = format_before_transpose(*first_perm);
+            if (!chain.empty()) {
+                NodePtr head = graph.get_node(chain.front());
+                head->clear_inputs();
+                head->add_input(source);
+                NodePtr tail = graph.get_node(chain.back());
+                tail->clear_outputs();
+                tail->add_output(final_out);
+                if (layout) {
+                    for (NodeID link : chain) {
+                        graph.get_node(link)->set_string_attribute(
+                            "data_format", layout);
+                    }
+                }
+            } else {
+                // Directly adjacent pair: repoint every reader of the
+                // pair's output at the original source tensor
+                for (NodeID reader_id : consumers[final_out]) {
+                    NodePtr reader = graph.get_node(reader_id);
+                    if (!reader) {
+                        continue;
+                    }
+                    std::vector<TensorID> inputs = reader->get_inputs();
+                    reader->clear_inputs();
+                    for (TensorID in : inputs) {
+                        reader->add_input(in == final_out ? source : in);
+                    }
+                }
+            }
+
+            graph.remove_node(id);
+            graph.remove_node(cursor);
+            stats.nodes_removed += 2;
+            changed = true;
+            break;  // Tensor maps are stale; rescan
+        }
+    }
+
+    return stats.nodes_removed > 0 ? OptimizationResult::SUCCESS
+                                   : OptimizationResult::NO_CHANGES;
+}
+
+OptimizationResult CMXGraphOptimizer::padding_elimination_pass(CMXGraph& graph, OptimizationStats& stats) {
+    // Exporters emit explicit Pad nodes in front of SAME-padding convs;
+    // at runtime each one materializes a padded copy of its input - a
+    // full extra frame for the first layer. The conv kernels handle
+    // borders in-kernel (out-of-range taps are skipped, equivalent to
+    // zero-padded MACs), so a zero Pad feeding a conv is folded into the
+    // conv's explicit padding attributes and removed.
+    stats.nodes_removed = 0;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        const std::vector<NodeID> node_ids = graph.topological_sort();
+        if (node_ids.empty() && graph.node_count() > 0) {
+            return OptimizationResult::GRAPH_INVALID;
+        }
+
+        std::unordered_map<TensorID, std::vector<NodeID>> consumers;
+        for (NodeID id : node_ids) {
+            NodePtr node = graph.get_node(id);
+            if (!node) {
+                continue;
+            }
+            for (TensorID in : node->get_inputs()) {
+                consumers[in].push_back(id);
+            }
+        }
+
+        for (NodeID id : node_ids) {
+            NodePtr pad = graph.get_node(id);
+            if (!pad || pad->get_op_type() != CMXOpType::PAD ||
+                pad->input_count() != 1 || pad->output_count() != 1) {
+                continue;
+            }
+
+            // Only zero padding folds into the conv's skipped-MAC border
+            // handling; reflect/replicate pads must stay materialized
+            std::string mode = pad->get_string_attribute("mode");
+            if (!mode.empty() && mode != "constant") {
+                continue;
+            }
+            if (pad->get_float_attribute("value", 0.0f) != 0.0f) {
+                continue;
+            }
+
+            auto it = consumers.find(pad->get_output(0));
+            if (it == consumers.end() || it->second.size() != 1) {
+                continue;
+            }
+            NodePtr conv = graph.get_node(it->second[0]);
+            if (!conv || conv->get_op_type() != CMXOpType::CONV2D ||
+                conv->get_input(0) != pad->get_output(0)) {
+                continue;
+            }
+
+            // Fold the pad amounts into the conv and bypass the node
+            conv->set_int_attribute("pad_top",
+                conv->get_int_attribute("pad_top") + pad->get_int_attribute("pad_top"));
+            conv->set_int_attribute("pad_bottom",
+                conv->get_int_attribute("pad_bottom") + pad->get_int_attribute("pad_bottom"));
+            conv->set_int_attribute("pad_left",
+                conv->get_int_attribute("pad_left") + pad->get_int_attribute("pad_left"));
+            conv->set_int_attribute("pad_right",
+                conv->get_int_attribute("pad_right") + pad->get_int_attribute("pad_right"));
+            conv->set_string_attribute("padding_mode", "EXPLICIT");
+
+            TensorID source = pad->get_input(0);
+            TensorID padded = pad->get_output(0);
+            std::vector<TensorID> inputs = conv->get_inputs();
+            conv->clear_inputs();
+            for (TensorID in : inputs) {
+                conv->add_input(in == padded ? source : in);
+            }
+
+            graph.remove_node(id);
+            stats.nodes_removed += 1;
+            changed = true;
+            break;  // Consumer map is stale; rescan
+        }
+    }
+
+    return stats.nodes_removed > 0 ? OptimizationResult::SUCCESS
+                                   : OptimizationResult::NO_CHANGES;
 }
 
+namespace {
+
+/// @brief Identify quantize/dequantize helper nodes
+///
+/// Exported graphs carry these as CUSTOM nodes tagged either by a
+/// custom_op attribute or by their name.
+bool is_custom_op(const CMXNode& node, const char* op) {
+    if (node.get_op_type() != CMXOpType::CUSTOM) {
+        return false;
+    }
+    std::string tag = node.get_string_attribute("custom_op");
+    if (!tag.empty()) {
+        return tag == op;
+    }
+    return node.get_name().rfind(op, 0) == 0;
+}
+
+/// @brief Compare the scale/zero_point pair two nodes carry
+bool same_quant_params(const CMXNode& a, const CMXNode& b) {
+    const float scale_a = a.get_float_attribute("scale");
+    const float scale_b = b.get_float_attribute("scale");
+    const float tolerance = 1e-6f * std::max(std::abs(scale_a), std::abs(scale_b));
+    return std::abs(scale_a - scale_b) <= tolerance &&
+           a.get_int_attribute("zero_point") == b.get_int_attribute("zero_point");
+}
+
+} // namespace
+
+OptimizationResult CMXGraphOptimizer::quantize_dequantize_elimination_pass(CMXGraph& graph, OptimizationStats& stats) {
+    // Mixed int8/float graphs arrive with Dequantize -> Quantize
+    // sequences at every precision boundary. When both sides carry the
+    // same QuantizationParams the pair is a pure no-op and is bypassed
+    // outright; when the params differ the pair still burns two full
+    // tensor traversals through float, so it is collapsed into one
+    // Requantize node that lowering maps onto requantize_tensor
+    // (cmx_core/utils/cmx_quantization.hpp).
+    stats.nodes_removed = 0;
+    stats.nodes_fused = 0;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        const std::vector<NodeID> node_ids = graph.topological_sort();
+        if (node_ids.empty() && graph.node_count() > 0) {
+            return OptimizationResult::GRAPH_INVALID;
+        }
+
+        std::unordered_map<TensorID, std::vector<NodeID>> consumers;
+        for (NodeID id : node_ids) {
+            NodePtr node = graph.get_node(id);
+            if (!node) {
+                continue;
+            }
+            for (TensorID in : node->get_inputs()) {
+                consumers[in].push_back(id);
+            }
+        }
+
+        for (NodeID id : node_ids) {
+            NodePtr dequant = graph.get_node(id);
+            if (!dequant || !is_custom_op(*dequant, "Dequantize") ||
+                dequant->input_count() != 1 || dequant->output_count() != 1) {
+                continue;
+            }
+
+            auto use = consumers.find(dequant->get_output(0));
+            if (use == consumers.end() || use->second.size() != 1) {
+                continue;
+            }
+            NodeID quant_id = use->second[0];
+            NodePtr quant = graph.get_node(quant_id);
+            if (!quant || !is_custom_op(*quant, "Quantize") ||
+                quant->input_count() != 1 || quant->output_count() != 1) {
+                continue;
+            }
+
+            TensorID source = dequant->get_input(0);
+            TensorID final_out = quant->get_output(0);
+
+            if (same_quant_params(*dequant, *quant)) {
+                // Identical params: the round trip is the identity, so
+                // repoint every reader at the quantized source
+                for (NodeID reader_id : consumers[final_out]) {
+                    NodePtr reader = graph.get_node(reader_id);
+                    if (!reader) {
+                        continue;
+                    }
+                    std::vector<TensorID> inputs = reader->get_inputs();
+                    reader->clear_inputs();
+                    for (TensorID in : inputs) {
+                        reader->add_input(in == final_out ? source : in);
+                    }
+                }
+                graph.remove_node(id);
+                graph.remove_node(quant_id);
+                stats.nodes_removed += 2;
+            } else {
+                // Different params: compose the rescale into a single
+                // Requantize node carrying both parameter sets
+                auto requant = std::make_shared<CMXNode>(
+                    CMXOpType::CUSTOM, dequant->get_name() + "_requantized");
+                requant->set_string_attribute("custom_op", "Requantize");
+                requant->set_float_attribute(
+                    "in_scale", dequant->get_float_attribute("scale"));
+                requant->set_int_attribute(
+                    "in_zero_point", dequant->get_int_attribute("zero_point"));
+                requant->set_float_attribute(
+                    "out_scale", quant->get_float_attribute("scale"));
+                requant->set_int_attribute(
+                    "out_zero_point", quant->get_int_attribute("zero_point"));
+                requant->add_input(source);
+                requant->add_output(final_out);
+                graph.add_node(requant);
+                graph.remove_node(id);
+                graph.remove_node(quant_id);
+                stats.nodes_fused += 2;
+            }
+
+            changed = true;
+            break;  // Tensor maps are stale; rescan
+        }
+    }
+
+    return (stats.nodes_removed > 0 || stats.nodes_fused > 0)
+        ? OptimizationResult::SUCCESS
+        : OptimizationResult::NO_CHANGES;
+}
+
+namespace {
+
+/// @brief Ops that carry quantization parameters through unchanged
+///
+/// These move or select values without altering their numeric domain,
+/// so the tensors on both sides live on the same quantization grid and
+/// a scale chosen for one side holds for the other.
+bool is_scale_transparent(CMXOpType op) {
+    switch (op) {
+        case CMXOpType::RESHAPE:
+        case CMXOpType::TRANSPOSE:
+        case CMXOpType::SQUEEZE:
+        case CMXOpType::UNSQUEEZE:
+        case CMXOpType::MAX_POOL2D:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// @brief Coarsening an input's grid by more than this loses over one
+/// bit of precision on the finer side, so harmonization backs off
+constexpr float kMaxHarmonizationRatio = 2.0f;
+
+} // namespace
+
+OptimizationResult CMXGraphOptimizer::scale_harmonization_pass(CMXGraph& graph, OptimizationStats& stats) {
+    // In a quantized residual add each input arrives on its own grid,
+    // so the kernel rescales both operands before summing - the
+    // multiplies are a third of the add's cost. When the two input
+    // scales are close, the producers' output scales can instead be
+    // matched (taking the coarser of the two, which only widens a
+    // range and never clips), turning the add into a plain int8
+    // saturating add. The accuracy gate skips pairs whose scales
+    // differ by more than kMaxHarmonizationRatio; beyond that the
+    // finer input would surrender too much resolution. Matching walks
+    // back through scale-transparent nodes, so the long skip branch of
+    // a residual block reaches the conv that actually owns the scale.
+    stats.operations_simplified = 0;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        const std::vector<NodeID> node_ids = graph.topological_sort();
+        if (node_ids.empty() && graph.node_count() > 0) {
+            return OptimizationResult::GRAPH_INVALID;
+        }
+
+        std::unordered_map<TensorID, NodeID> producers;
+        for (NodeID id : node_ids) {
+            NodePtr node = graph.get_node(id);
+            if (!node) {
+                continue;
+            }
+            for (TensorID out : node->get_outputs()) {
+                producers[out] = id;
+            }
+        }
+
+        // Walk back through scale-transparent nodes to the node whose
+        // output scale actually governs the tensor
+        auto scale_owner = [&](TensorID tensor) -> NodePtr {
+            for (;;) {
+                auto produced = producers.find(tensor);
+                if (produced == producers.end()) {
+                    return nullptr;
+                }
+                NodePtr node = graph.get_node(produced->second);
+                if (!node) {
+                    return nullptr;
+                }
+                if (is_scale_transparent(node->get_op_type()) &&
+                    node->input_count() == 1 && node->output_count() == 1 &&
+                    !node->has_attribute("output_scale")) {
+                    tensor = node->get_input(0);
+                    continue;
+                }
+                return node;
+            }
+        };
+
+        for (NodeID id : node_ids) {
+            NodePtr add = graph.get_node(id);
+            if (!add || add->get_op_type() != CMXOpType::ADD ||
+                add->input_count() != 2 || add->output_count() != 1 ||
+                add->get_int_attribute("inputs_scale_matched") != 0) {
+                continue;
+            }
+
+            NodePtr lhs = scale_owner(add->get_input(0));
+            NodePtr rhs = scale_owner(add->get_input(1));
+            if (!lhs || !rhs || lhs == rhs ||
+                !lhs->has_attribute("output_scale") ||
+                !rhs->has_attribute("output_scale")) {
+                continue;
+            }
+
+            // Matched grids need matched zero points too; symmetric
+            // graphs carry zero everywhere so this rarely fails
+            if (lhs->get_int_attribute("output_zero_point") !=
+                rhs->get_int_attribute("output_zero_point")) {
+                continue;
+            }
+
+            const float lhs_scale = lhs->get_float_attribute("output_scale");
+            const float rhs_scale = rhs->get_float_attribute("output_scale");
+            if (lhs_scale <= 0.0f || rhs_scale <= 0.0f) {
+                continue;
+            }
+            const float coarse = std::max(lhs_scale, rhs_scale);
+            const float fine = std::min(lhs_scale, rhs_scale);
+            if (coarse > fine * kMaxHarmonizationRatio) {
+                continue;  // Too much resolution lost on the finer input
+            }
+
+            lhs->set_float_attribute("output_scale", coarse);
+            rhs->set_float_attribute("output_scale", coarse);
+            add->set_int_attribute("inputs_scale_matched", 1);
+            stats.operations_simplified += 1;
+            changed = true;
+        }
+    }
+
+    return stats.operations_simplified > 0 ? OptimizationResult::SUCCESS
+                                           : OptimizationResult::NO_CHANGES;
+}
+
+namespace {
+
+/// @brief Fetch a per-channel float vector attribute, or nullptr
+const std::vector<float>* channel_params(const CMXNode& node, const char* key) {
+    const AttributeValue* value = node.get_attribute(key);
+    return value ? std::get_if<std::vector<float>>(value) : nullptr;
+}
+
+} // namespace
+
 OptimizationResult CMXGraphOptimizer::batch_normalization_folding_pass(CMXGraph& graph, OptimizationStats& stats) {
-    // TODO: Implement batch normalization folding
-    // - Fold batch normalization parameters into convolution weights
-    // - Reduce inference computation
-    
-    // Placeholder implementation
+    // Batch norm parameters are constant at inference time, so y =
+    // gamma * (x - mean) / sqrt(var + eps) + beta collapses into the
+    // preceding conv/dense node: a per-channel weight scale of
+    // gamma / sqrt(var + eps) and a bias shift of beta - mean * scale.
+    // Exported graphs carry the parameters as per-channel float vector
+    // attributes on the BATCH_NORM node (graph-level tensors are opaque
+    // handles here); the fold multiplies them into the producer's
+    // "weight_scales" and accumulates "bias_correction", which lowering
+    // applies when packing the kernel's weights and bias - the same
+    // scales quantized graphs already use per channel. Each folded node
+    // removes a full activation-tensor read-modify-write per frame.
     stats.nodes_fused = 0;
-    return OptimizationResult::NO_CHANGES;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        const std::vector<NodeID> node_ids = graph.topological_sort();
+        if (node_ids.empty() && graph.node_count() > 0) {
+            return OptimizationResult::GRAPH_INVALID;
+        }
+
+        std::unordered_map<TensorID, NodeID> producers;
+        std::unordered_map<TensorID, std::vector<NodeID>> consumers;
+        for (NodeID id : node_ids) {
+            NodePtr node = graph.get_node(id);
+            if (!node) {
+                continue;
+            }
+            for (TensorID out : node->get_outputs()) {
+                producers[out] = id;
+            }
+            for (TensorID in : node->get_inputs()) {
+                consumers[in].push_back(id);
+            }
+        }
+
+        for (NodeID id : node_ids) {
+            NodePtr norm = graph.get_node(id);
+            if (!norm || norm->get_op_type() != CMXOpType::BATCH_NORM ||
+                norm->input_count() < 1 || norm->output_count() != 1) {
+                continue;
+            }
+
+            // Mean and variance are required; gamma/beta default to the
+            // identity affine transform
+            const std::vector<float>* mean = channel_params(*norm, "mean");
+            const std::vector<float>* variance = channel_params(*norm, "variance");
+            if (!mean || !variance || mean->size() != variance->size() ||
+                mean->empty()) {
+                continue;
+            }
+            const size_t channels = mean->size();
+            const std::vector<float>* gamma = channel_params(*norm, "gamma");
+            const std::vector<float>* beta = channel_params(*norm, "beta");
+            if ((gamma && gamma->size() != channels) ||
+                (beta && beta->size() != channels)) {
+                continue;
+            }
+
+            // The producer must write per-output-channel values and
+            // feed only this norm node
+            TensorID norm_in = norm->get_input(0);
+            auto produced = producers.find(norm_in);
+            if (produced == producers.end()) {
+                continue;
+            }
+            NodePtr producer = graph.get_node(produced->second);
+            if (!producer || producer->output_count() != 1) {
+                continue;
+            }
+            CMXOpType producer_op = producer->get_op_type();
+            if (producer_op != CMXOpType::CONV2D &&
+                producer_op != CMXOpType::DEPTHWISE_CONV2D &&
+                producer_op != CMXOpType::MATMUL) {
+                continue;
+            }
+            auto use = consumers.find(norm_in);
+            if (use == consumers.end() || use->second.size() != 1) {
+                continue;
+            }
+
+            const float epsilon = norm->get_float_attribute("epsilon", 1e-5f);
+
+            std::vector<float> weight_scales(channels, 1.0f);
+            if (const std::vector<float>* existing =
+                    channel_params(*producer, "weight_scales")) {
+                if (existing->size() != channels) {
+                    continue;
+                }
+                weight_scales = *existing;
+            }
+            std::vector<float> bias_correction(channels, 0.0f);
+            if (const std::vector<float>* existing =
+                    channel_params(*producer, "bias_correction")) {
+                if (existing->size() != channels) {
+                    continue;
+                }
+                bias_correction = *existing;
+            }
+
+            for (size_t c = 0; c < channels; ++c) {
+                const float scale = (gamma ? (*gamma)[c] : 1.0f) /
+                    std::sqrt((*variance)[c] + epsilon);
+                // The correction rides on the producer's output, which
+                // the new scale already multiplies
+                bias_correction[c] = bias_correction[c] * scale +
+                    (beta ? (*beta)[c] : 0.0f) - (*mean)[c] * scale;
+                weight_scales[c] *= scale;
+            }
+
+            producer->set_attribute("weight_scales", weight_scales);
+            producer->set_attribute("bias_correction", bias_correction);
+
+            // The producer adopts the norm's output tensor, so
+            // downstream consumers are untouched
+            producer->clear_outputs();
+            producer->add_output(norm->get_output(0));
+            graph.remove_node(id);
+            stats.nodes_fused++;
+            changed = true;
+            break;  // Tensor maps are stale; rescan
+        }
+    }
+
+    return stats.nodes_fused > 0 ? OptimizationResult::SUCCESS
+                                 : OptimizationResult::NO_CHANGES;
 }
 
 bool CMXGraphOptimizer::is_constant_node(const CMXNode& node) {
-    // TODO: Check if node is a constant
-    // return node.get_op_type() == "Constant";
-    return false;
+    // A node with no inputs only materializes values (constants,
+    // shapes); there is nothing upstream to fold into it
+    return node.input_count() == 0 && node.output_count() > 0;
 }
 
 bool CMXGraphOptimizer::is_dead_node(const CMXNode& node, const CMXGraph& graph) {
@@ -219,9 +1379,28 @@ bool CMXGraphOptimizer::is_dead_node(const CMXNode& node, const CMXGraph& graph)
 }
 
 bool CMXGraphOptimizer::can_fuse_nodes(const CMXNode& producer, const CMXNode& consumer) {
-    // TODO: Check if nodes can be fused
-    // Check operation types, shapes, etc.
-    return false;
+    if (producer.output_count() != 1 || consumer.output_count() != 1) {
+        return false;
+    }
+
+    CMXOpType producer_op = producer.get_op_type();
+    CMXOpType consumer_op = consumer.get_op_type();
+
+    // Binary elementwise ops absorb a following activation into their
+    // kernel epilogue (ActivationType in ElementwiseParams), but have
+    // no bias slot, so an Add consumer does not fold into them
+    if (producer_op == CMXOpType::ADD || producer_op == CMXOpType::SUB ||
+        producer_op == CMXOpType::MUL) {
+        return fusable_activation_name(consumer_op) != nullptr;
+    }
+
+    if (producer_op != CMXOpType::CONV2D &&
+        producer_op != CMXOpType::DEPTHWISE_CONV2D) {
+        return false;
+    }
+
+    return consumer_op == CMXOpType::ADD ||
+           fusable_activation_name(consumer_op) != nullptr;
 }
 
 bool CMXGraphOptimizer::are_nodes_fusable(const std::string& op1, const std::string& op2) {
@@ -241,8 +1420,21 @@ bool CMXGraphOptimizer::is_identity_operation(const CMXNode& node) {
 }
 
 bool CMXGraphOptimizer::has_single_consumer(const CMXNode& node, const CMXGraph& graph) {
-    // TODO: Check if node has only one consumer
-    return false;
+    if (node.output_count() != 1) {
+        return false;
+    }
+
+    TensorID out = node.get_output(0);
+    size_t count = 0;
+    for (NodeID id : graph.topological_sort()) {
+        NodePtr candidate = graph.get_node(id);
+        if (!candidate) {
+            continue;
+        }
+        const std::vector<TensorID>& inputs = candidate->get_inputs();
+        count += std::count(inputs.begin(), inputs.end(), out);
+    }
+    return count == 1;
 }
 
 bool CMXGraphOptimizer::validate_graph_integrity(const CMXGraph& graph) {
@@ -52,6 +52,20 @@ struct OptimizationStats {
 /// @brief Optimization pass function signature
 using OptimizationPass = std::function<OptimizationResult(CMXGraph&, OptimizationStats&)>;
 
+/// @brief Predicate deciding whether a backend can execute a node
+///
+/// Typically backed by the kernel registry (e.g. a
+/// cmx_op_dispatcher::has_kernel query for the backend in question).
+using BackendSupportQuery = std::function<bool(const CMXNode&)>;
+
+/// @brief One maximal subgraph claimed by a backend
+struct SubgraphPartition {
+    std::string backend_name;
+    std::vector<uint32_t> node_ids;        ///< Claimed nodes in topological order
+    std::vector<uint32_t> input_tensors;   ///< Tensors crossing into the subgraph
+    std::vector<uint32_t> output_tensors;  ///< Tensors leaving the subgraph
+};
+
 /// @brief Optimization pass configuration
 struct OptimizationPassConfig {
     bool enabled;
@@ -100,6 +114,37 @@ public:
     /// @return Vector of pass names
     std::vector<std::string> get_pass_names() const;
     
+    /// @brief Partition the graph into maximal backend subgraphs
+    ///
+    /// Greedily grows connected regions of nodes the backend claims,
+    /// merging a node into a region only when doing so cannot create a
+    /// cycle through unclaimed nodes. Each resulting partition can be
+    /// handed to the backend as one fused call with a single
+    /// input/output handoff instead of per-node dispatch.
+    /// @param graph Graph to partition
+    /// @param backend_name Name recorded on each partition
+    /// @param supports Predicate claiming nodes for the backend
+    /// @param partitions Output list of maximal subgraphs
+    /// @return Optimization result (NO_CHANGES when nothing claimed)
+    OptimizationResult partition_for_backend(CMXGraph& graph,
+                                             const std::string& backend_name,
+                                             const BackendSupportQuery& supports,
+                                             std::vector<SubgraphPartition>& partitions);
+
+    /// @brief Collapse claimed partitions into single subgraph nodes
+    ///
+    /// Replaces each multi-node partition with one CUSTOM node tagged
+    /// custom_op=BackendSubgraph and the backend name, wired to the
+    /// partition's boundary tensors, so the executor performs one
+    /// handoff per partition.
+    /// @param graph Graph to rewrite
+    /// @param partitions Partitions from partition_for_backend
+    /// @param stats Output optimization statistics
+    /// @return Optimization result
+    OptimizationResult fuse_partitions(CMXGraph& graph,
+                                       const std::vector<SubgraphPartition>& partitions,
+                                       OptimizationStats& stats);
+
     /// @brief Clear all optimization statistics
     void clear_stats();
     
@@ -125,11 +170,15 @@ private:
     /// @brief Built-in optimization passes
     static OptimizationResult constant_folding_pass(CMXGraph& graph, OptimizationStats& stats);
     static OptimizationResult dead_code_elimination_pass(CMXGraph& graph, OptimizationStats& stats);
+    static OptimizationResult common_subexpression_elimination_pass(CMXGraph& graph, OptimizationStats& stats);
     static OptimizationResult operator_fusion_pass(CMXGraph& graph, OptimizationStats& stats);
     static OptimizationResult algebraic_simplification_pass(CMXGraph& graph, OptimizationStats& stats);
     static OptimizationResult memory_layout_optimization_pass(CMXGraph& graph, OptimizationStats& stats);
     static OptimizationResult redundant_transpose_elimination_pass(CMXGraph& graph, OptimizationStats& stats);
     static OptimizationResult batch_normalization_folding_pass(CMXGraph& graph, OptimizationStats& stats);
+    static OptimizationResult padding_elimination_pass(CMXGraph& graph, OptimizationStats& stats);
+    static OptimizationResult quantize_dequantize_elimination_pass(CMXGraph& graph, OptimizationStats& stats);
+    static OptimizationResult scale_harmonization_pass(CMXGraph& graph, OptimizationStats& stats);
     
     /// @brief Helper functions
     static bool is_constant_node(const CMXNode& node);
@@ -8,8 +8,10 @@
 namespace cmx {
 namespace graph {
 
-CMXGraphSerializer::CMXGraphSerializer() 
-    : temp_buffer_(nullptr), temp_buffer_size_(0), initialized_(true) {
+CMXGraphSerializer::CMXGraphSerializer()
+    : temp_buffer_(nullptr), temp_buffer_size_(0), initialized_(true),
+      plan_alignment_(16), plan_set_(false), plan_loaded_(false),
+      table_base_(nullptr), table_blob_(nullptr), table_count_(0) {
 }
 
 CMXGraphSerializer::~CMXGraphSerializer() {
@@ -21,40 +23,7 @@ CMXGraphSerializer::~CMXGraphSerializer() {
 SerializationResult CMXGraphSerializer::serialize_to_buffer(
     const CMXGraph& graph,
     uint8_t* buffer,
-    size_t CMXGraphSerializer::decompress_data(
-    const uint8_t* input,
-    size_t input_size,
-    uint8_t* output,
-    size_t output_size) {
-    
-    // Simple RLE decompression implementation
-    if (input_size == 0 || input_size % 2 != 0) {
-        return 0;
-    }
-    
-    size_t output_pos = 0;
-    size_t input_pos = 0;
-    
-    while (input_pos < input_size - 1 && output_pos < output_size) {
-        uint8_t count = input[input_pos++];
-        uint8_t byte_value = input[input_pos++];
-        
-        // Check if we have enough space in output buffer
-        if (output_pos + count > output_size) {
-            break;
-        }
-        
-        // Write decompressed bytes
-        for (uint8_t i = 0; i < count; ++i) {
-            output[output_pos++] = byte_value;
-        }
-    }
-    
-    return output_pos;
-}
-
-} // namespace graph
-} // namespace cmx buffer_size,
+    size_t buffer_size,
     SerializationFlags flags,
     SerializationStats* stats) {
     
@@ -82,6 +51,9 @@ SerializationResult CMXGraphSerializer::serialize_to_buffer(
     }
 
     size_t offset = 0;
+    fixup_slots_.clear();
+    intern_offsets_.clear();
+    intern_blob_.clear();
 
     // Write header
     size_t header_size = write_header(buffer, graph, flags);
@@ -111,6 +83,38 @@ SerializationResult CMXGraphSerializer::serialize_to_buffer(
     }
     offset += topology_size;
 
+    // Write interned string table (v1.2) - every name the node and
+    // tensor records referenced by id lives here exactly once
+    size_t string_table_offset = offset;
+    size_t string_table_size = write_string_table(buffer, offset);
+    offset += string_table_size;
+
+    // Write execution plan section (v1.1, optional)
+    size_t plan_offset = 0;
+    size_t plan_section_size = 0;
+    if (has_flag(flags, SerializationFlags::INCLUDE_EXECUTION_PLAN) && plan_set_) {
+        plan_offset = offset;
+        plan_section_size = write_execution_plan(buffer, offset);
+        if (plan_section_size == 0) {
+            return SerializationResult::ERROR_INVALID_GRAPH;
+        }
+        offset += plan_section_size;
+    }
+
+    // Write weight payload section (v1.1)
+    size_t payload_offset = offset;
+    size_t payload_section_size = write_payloads(buffer, offset, graph);
+    offset += payload_section_size;
+
+    // Write pointer fixup table (v1.1, optional)
+    size_t fixup_offset = 0;
+    size_t fixup_count = 0;
+    if (has_flag(flags, SerializationFlags::EMIT_OFFSET_TABLE)) {
+        fixup_offset = offset;
+        fixup_count = fixup_slots_.size();
+        offset += write_fixup_table(buffer, offset);
+    }
+
     // Calculate and update checksum
     uint32_t checksum = calculate_checksum(buffer + sizeof(CMXSerializationHeader), 
                                          offset - sizeof(CMXSerializationHeader));
@@ -119,6 +123,16 @@ SerializationResult CMXGraphSerializer::serialize_to_buffer(
     CMXSerializationHeader* header = reinterpret_cast<CMXSerializationHeader*>(buffer);
     header->checksum = checksum;
     header->graph_size = static_cast<uint32_t>(offset - sizeof(CMXSerializationHeader));
+    header->plan_offset = static_cast<uint32_t>(plan_offset);
+    header->plan_size = static_cast<uint32_t>(plan_section_size);
+    header->fixup_offset = static_cast<uint32_t>(fixup_offset);
+    header->fixup_count = static_cast<uint32_t>(fixup_count);
+    header->payload_offset =
+        payload_section_size > 0 ? static_cast<uint32_t>(payload_offset) : 0;
+    header->payload_size = static_cast<uint32_t>(payload_section_size);
+    header->string_table_offset =
+        string_table_size > 0 ? static_cast<uint32_t>(string_table_offset) : 0;
+    header->string_table_size = static_cast<uint32_t>(string_table_size);
 
     // Update statistics
     if (stats) {
@@ -212,14 +226,14 @@ SerializationResult CMXGraphSerializer::deserialize_from_buffer(
     if (result != SerializationResult::SUCCESS) {
         return result;
     }
-    offset += header.node_count * sizeof(uint32_t); // Simplified size calculation
+    offset += header.node_count * (3 * sizeof(uint32_t)); // id, op_type, name id + pad
 
     // Read tensors
     result = read_tensors(buffer, offset, graph, header.tensor_count);
     if (result != SerializationResult::SUCCESS) {
         return result;
     }
-    offset += header.tensor_count * sizeof(uint32_t); // Simplified size calculation
+    offset += header.tensor_count * (2 * sizeof(uint32_t)); // id, name id + pad
 
     // Read topology
     result = read_topology(buffer, offset, graph);
@@ -227,6 +241,126 @@ SerializationResult CMXGraphSerializer::deserialize_from_buffer(
         return result;
     }
 
+    // Read execution plan section if present (v1.1)
+    plan_loaded_ = false;
+    if (header.version >= static_cast<uint32_t>(SerializationVersion::VERSION_1_1) &&
+        header.plan_offset != 0 && header.plan_size != 0) {
+        if (header.plan_offset + header.plan_size > buffer_size) {
+            return SerializationResult::ERROR_INVALID_FORMAT;
+        }
+        result = read_execution_plan(buffer, header.plan_offset, header.plan_size);
+        if (result != SerializationResult::SUCCESS) {
+            return result;
+        }
+    }
+
+    // Record the string table location for lazy id resolution (v1.2);
+    // no strings are materialized here
+    table_base_ = nullptr;
+    table_blob_ = nullptr;
+    table_count_ = 0;
+    if (header.version >= static_cast<uint32_t>(SerializationVersion::VERSION_1_2) &&
+        header.string_table_offset != 0 && header.string_table_size != 0) {
+        if (header.string_table_offset + header.string_table_size > buffer_size) {
+            return SerializationResult::ERROR_INVALID_FORMAT;
+        }
+        result = read_string_table(buffer, header.string_table_offset,
+                                   header.string_table_size);
+        if (result != SerializationResult::SUCCESS) {
+            return result;
+        }
+    }
+
+    return SerializationResult::SUCCESS;
+}
+
+SerializationResult CMXGraphSerializer::deserialize_in_place(
+    uint8_t* buffer,
+    size_t buffer_size,
+    CMXGraph& graph,
+    SerializationFlags flags) {
+
+    if (!buffer || buffer_size < sizeof(CMXSerializationHeader)) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+
+    // Read and validate header
+    CMXSerializationHeader header;
+    SerializationResult result = read_header(buffer, buffer_size, header);
+    if (result != SerializationResult::SUCCESS) {
+        return result;
+    }
+
+    // Validate before the fixup walk: the legacy rewrite mutates slots
+    // the checksum covers
+    if (has_flag(flags, SerializationFlags::VALIDATE_CHECKSUMS)) {
+        uint32_t calculated_checksum = calculate_checksum(
+            buffer + sizeof(CMXSerializationHeader),
+            header.graph_size
+        );
+        if (calculated_checksum != header.checksum) {
+            return SerializationResult::ERROR_CHECKSUM_MISMATCH;
+        }
+    }
+
+    // Fixup walk: O(number of references), no payload copies; v1.3
+    // buffers are only validated, never rewritten
+    result = relocate_in_place(buffer, buffer_size, header);
+    if (result != SerializationResult::SUCCESS) {
+        return result;
+    }
+
+    // The section walk builds graph objects referencing the buffer
+    // directly; tensor payloads stay where they were mapped
+    size_t offset = sizeof(CMXSerializationHeader);
+
+    result = read_nodes(buffer, offset, graph, header.node_count);
+    if (result != SerializationResult::SUCCESS) {
+        return result;
+    }
+    offset += header.node_count * (3 * sizeof(uint32_t)); // id, op_type, name id + pad
+
+    result = read_tensors(buffer, offset, graph, header.tensor_count);
+    if (result != SerializationResult::SUCCESS) {
+        return result;
+    }
+    offset += header.tensor_count * (2 * sizeof(uint32_t)); // id, name id + pad
+
+    result = read_topology(buffer, offset, graph);
+    if (result != SerializationResult::SUCCESS) {
+        return result;
+    }
+
+    // Read execution plan section if present (v1.1)
+    plan_loaded_ = false;
+    if (header.version >= static_cast<uint32_t>(SerializationVersion::VERSION_1_1) &&
+        header.plan_offset != 0 && header.plan_size != 0) {
+        if (header.plan_offset + header.plan_size > buffer_size) {
+            return SerializationResult::ERROR_INVALID_FORMAT;
+        }
+        result = read_execution_plan(buffer, header.plan_offset, header.plan_size);
+        if (result != SerializationResult::SUCCESS) {
+            return result;
+        }
+    }
+
+    // Record the string table location for lazy id resolution (v1.2);
+    // no strings are materialized here
+    table_base_ = nullptr;
+    table_blob_ = nullptr;
+    table_count_ = 0;
+    if (header.version >= static_cast<uint32_t>(SerializationVersion::VERSION_1_2) &&
+        header.string_table_offset != 0 && header.string_table_size != 0) {
+        if (header.string_table_offset + header.string_table_size > buffer_size) {
+            return SerializationResult::ERROR_INVALID_FORMAT;
+        }
+        result = read_string_table(buffer, header.string_table_offset,
+                                   header.string_table_size);
+        if (result != SerializationResult::SUCCESS) {
+            return result;
+        }
+    }
+
     return SerializationResult::SUCCESS;
 }
 
@@ -276,6 +410,189 @@ SerializationResult CMXGraphSerializer::deserialize_from_file(
     return result;
 }
 
+SerializationResult CMXGraphSerializer::deserialize_streaming(
+    const char* filename,
+    CMXGraph& graph,
+    uint8_t* arena,
+    size_t arena_size,
+    SerializationFlags flags) {
+
+    if (!filename || !arena) {
+        return SerializationResult::ERROR_IO_ERROR;
+    }
+
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        return SerializationResult::ERROR_IO_ERROR;
+    }
+
+    // Read and validate header
+    CMXSerializationHeader header;
+    if (fread(&header, 1, sizeof(header), file) != sizeof(header)) {
+        fclose(file);
+        return SerializationResult::ERROR_IO_ERROR;
+    }
+
+    CMXSerializationHeader validated;
+    SerializationResult result = read_header(
+        reinterpret_cast<const uint8_t*>(&header), sizeof(header), validated);
+    if (result != SerializationResult::SUCCESS) {
+        fclose(file);
+        return result;
+    }
+
+    // Streaming needs the embedded plan to place payloads in the arena
+    if (header.version < static_cast<uint32_t>(SerializationVersion::VERSION_1_1) ||
+        header.plan_offset == 0 || header.plan_size == 0) {
+        fclose(file);
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+
+    uint8_t window[STREAM_WINDOW_SIZE];
+
+    // Metadata sections are small under the current layout; stage them
+    // through the window and reuse the buffer readers
+    size_t nodes_size = header.node_count * (3 * sizeof(uint32_t));
+    size_t tensors_size = header.tensor_count * (2 * sizeof(uint32_t));
+    size_t metadata_size = nodes_size + tensors_size + sizeof(uint32_t);
+    if (metadata_size > STREAM_WINDOW_SIZE) {
+        fclose(file);
+        return SerializationResult::ERROR_BUFFER_TOO_SMALL;
+    }
+    if (fread(window, 1, metadata_size, file) != metadata_size) {
+        fclose(file);
+        return SerializationResult::ERROR_IO_ERROR;
+    }
+
+    result = read_nodes(window, 0, graph, header.node_count);
+    if (result != SerializationResult::SUCCESS) {
+        fclose(file);
+        return result;
+    }
+
+    result = read_tensors(window, nodes_size, graph, header.tensor_count);
+    if (result != SerializationResult::SUCCESS) {
+        fclose(file);
+        return result;
+    }
+
+    result = read_topology(window, nodes_size + tensors_size, graph);
+    if (result != SerializationResult::SUCCESS) {
+        fclose(file);
+        return result;
+    }
+
+    // Stage and read the execution plan
+    plan_loaded_ = false;
+    if (header.plan_size > STREAM_WINDOW_SIZE) {
+        fclose(file);
+        return SerializationResult::ERROR_BUFFER_TOO_SMALL;
+    }
+    if (fseek(file, static_cast<long>(header.plan_offset), SEEK_SET) != 0 ||
+        fread(window, 1, header.plan_size, file) != header.plan_size) {
+        fclose(file);
+        return SerializationResult::ERROR_IO_ERROR;
+    }
+    result = read_execution_plan(window, 0, header.plan_size);
+    if (result != SerializationResult::SUCCESS) {
+        fclose(file);
+        return result;
+    }
+
+    // Stream weight payloads straight into their final arena locations;
+    // only the record headers pass through the window
+    if (header.payload_offset != 0 && header.payload_size != 0) {
+        if (fseek(file, static_cast<long>(header.payload_offset), SEEK_SET) != 0) {
+            fclose(file);
+            return SerializationResult::ERROR_IO_ERROR;
+        }
+
+        size_t consumed = 0;
+        while (consumed + sizeof(CMXSerializedPayloadHeader) <= header.payload_size) {
+            CMXSerializedPayloadHeader record;
+            if (fread(&record, 1, sizeof(record), file) != sizeof(record)) {
+                fclose(file);
+                return SerializationResult::ERROR_IO_ERROR;
+            }
+            consumed += sizeof(record) + record.size;
+            if (consumed > header.payload_size) {
+                fclose(file);
+                return SerializationResult::ERROR_INVALID_FORMAT;
+            }
+
+            auto placement = plan_memory_.placements.find(record.tensor_id);
+            if (placement == plan_memory_.placements.end()) {
+                // Not arena-resident (e.g. unused tensor); skip the bytes
+                if (fseek(file, static_cast<long>(record.size), SEEK_CUR) != 0) {
+                    fclose(file);
+                    return SerializationResult::ERROR_IO_ERROR;
+                }
+                continue;
+            }
+
+            uint8_t* destination = arena + placement->second.offset;
+            size_t produced = 0;
+
+            if (record.compression == PayloadCompression::NONE) {
+                if (record.size > placement->second.size ||
+                    placement->second.offset + record.size > arena_size) {
+                    fclose(file);
+                    return SerializationResult::ERROR_BUFFER_TOO_SMALL;
+                }
+                if (fread(destination, 1, record.size, file) != record.size) {
+                    fclose(file);
+                    return SerializationResult::ERROR_IO_ERROR;
+                }
+                produced = record.size;
+            } else if (record.compression == PayloadCompression::RLE) {
+                if (placement->second.offset + placement->second.size > arena_size) {
+                    fclose(file);
+                    return SerializationResult::ERROR_BUFFER_TOO_SMALL;
+                }
+
+                // Decompress straight into the arena placement, one
+                // window of stored bytes at a time; (count, value)
+                // pairs never straddle an even-sized chunk
+                size_t remaining = record.size;
+                while (remaining > 0) {
+                    size_t chunk = remaining < STREAM_WINDOW_SIZE
+                        ? remaining : STREAM_WINDOW_SIZE;
+                    chunk &= ~static_cast<size_t>(1);
+                    if (chunk == 0) {
+                        fclose(file);
+                        return SerializationResult::ERROR_INVALID_FORMAT;
+                    }
+                    if (fread(window, 1, chunk, file) != chunk) {
+                        fclose(file);
+                        return SerializationResult::ERROR_IO_ERROR;
+                    }
+                    size_t out = decompress_data(window, chunk, destination + produced,
+                                                 placement->second.size - produced);
+                    if (out == 0) {
+                        fclose(file);
+                        return SerializationResult::ERROR_INVALID_FORMAT;
+                    }
+                    produced += out;
+                    remaining -= chunk;
+                }
+            } else {
+                fclose(file);
+                return SerializationResult::ERROR_INVALID_FORMAT;
+            }
+
+            // Per-record checksum: validate the chunk as it arrives
+            // instead of checksumming the whole file up front
+            if (!validate_payload_chunk(destination, produced, record.checksum)) {
+                fclose(file);
+                return SerializationResult::ERROR_CHECKSUM_MISMATCH;
+            }
+        }
+    }
+
+    fclose(file);
+    return SerializationResult::SUCCESS;
+}
+
 size_t CMXGraphSerializer::calculate_serialized_size(
     const CMXGraph& graph,
     SerializationFlags flags) {
@@ -284,21 +601,92 @@ size_t CMXGraphSerializer::calculate_serialized_size(
     
     // Add size for nodes (simplified estimation)
     // In real implementation, would iterate through nodes and calculate exact size
-    total_size += graph.get_node_count() * 64; // Estimated average node size
+    total_size += graph.node_count() * 64; // Estimated average node size
     
     // Add size for tensors (simplified estimation)
     // In real implementation, would calculate tensor metadata size
-    total_size += graph.get_tensor_count() * 32; // Estimated average tensor metadata size
+    total_size += graph.get_tensor_ids().size() * 32; // Estimated average tensor metadata size
     
     // Add size for topology (simplified estimation)
-    total_size += graph.get_node_count() * 16; // Estimated topology overhead
+    total_size += graph.node_count() * 16; // Estimated topology overhead
     
+    // Add size for string table (v1.2, simplified estimation); names are
+    // stored once each, so this is an upper bound per node
+    total_size += sizeof(CMXStringTableHeader);
+    total_size += graph.node_count() * (sizeof(uint32_t) + 32); // Offset + estimated name length
+
+    // Add size for execution plan section (v1.1, optional)
+    if (has_flag(flags, SerializationFlags::INCLUDE_EXECUTION_PLAN) && plan_set_) {
+        total_size += sizeof(CMXSerializedPlanHeader);
+        total_size += plan_order_.size() * sizeof(uint32_t);
+        total_size += plan_memory_.placements.size() * sizeof(CMXSerializedPlacement);
+        total_size += plan_choices_.size() * sizeof(CMXSerializedKernelChoice);
+    }
+
+    // Add size for payload record headers (v1.1)
+    total_size += graph.get_tensor_ids().size() * sizeof(CMXSerializedPayloadHeader);
+
+    // Add size for fixup table (v1.1, optional; one slot per tensor payload)
+    if (has_flag(flags, SerializationFlags::EMIT_OFFSET_TABLE)) {
+        total_size += graph.get_tensor_ids().size() * sizeof(uint32_t);
+    }
+
     // Add padding for alignment
     total_size = (total_size + BUFFER_ALIGNMENT - 1) & ~(BUFFER_ALIGNMENT - 1);
-    
+
     return total_size;
 }
 
+void CMXGraphSerializer::set_execution_plan(
+    const std::vector<NodeID>& execution_order,
+    const CMXMemoryPlan& memory_plan,
+    uint32_t arena_alignment) {
+
+    plan_order_ = execution_order;
+    plan_memory_ = memory_plan;
+    plan_alignment_ = arena_alignment;
+    plan_set_ = !execution_order.empty();
+}
+
+void CMXGraphSerializer::set_kernel_choices(
+    const std::vector<CMXSerializedKernelChoice>& choices) {
+
+    plan_choices_ = choices;
+    // Guarantee NUL termination so readers can treat the name field
+    // as a C string regardless of how the caller filled it
+    for (CMXSerializedKernelChoice& choice : plan_choices_) {
+        choice.kernel_name[sizeof(choice.kernel_name) - 1] = '\0';
+    }
+}
+
+bool CMXGraphSerializer::get_execution_plan(
+    std::vector<NodeID>& execution_order,
+    CMXMemoryPlan& memory_plan) const {
+
+    if (!plan_loaded_ && !plan_set_) {
+        return false;
+    }
+
+    execution_order = plan_order_;
+    memory_plan = plan_memory_;
+    return true;
+}
+
+const char* CMXGraphSerializer::resolve_string(uint16_t id) const {
+    // Lazy lookup: ids stay the runtime identity, text is only touched
+    // when a debug hook or error path actually asks for it
+    if (id == CMX_INVALID_STRING_ID || id >= table_count_ || !table_base_) {
+        return nullptr;
+    }
+
+    const uint32_t* offsets = reinterpret_cast<const uint32_t*>(table_base_);
+    return table_blob_ + offsets[id];
+}
+
+uint32_t CMXGraphSerializer::get_string_count() const {
+    return table_count_;
+}
+
 bool CMXGraphSerializer::validate_format(const uint8_t* buffer, size_t buffer_size) {
     if (!buffer || buffer_size < sizeof(CMXSerializationHeader)) {
         return false;
@@ -330,6 +718,90 @@ bool CMXGraphSerializer::validate_format(const uint8_t* buffer, size_t buffer_si
     return true;
 }
 
+SerializationResult CMXGraphSerializer::validate_buffer(
+    const uint8_t* buffer,
+    size_t buffer_size,
+    SerializationFlags flags) {
+
+    if (!buffer || buffer_size < sizeof(CMXSerializationHeader)) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+
+    // Tier 1: header and section extents, always
+    CMXSerializationHeader header;
+    SerializationResult result = read_header(buffer, buffer_size, header);
+    if (result != SerializationResult::SUCCESS) {
+        return result;
+    }
+
+    if (header.graph_size + sizeof(CMXSerializationHeader) > buffer_size) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+    if (header.plan_offset != 0 &&
+        header.plan_offset + header.plan_size > buffer_size) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+    if (header.payload_offset != 0 &&
+        header.payload_offset + header.payload_size > buffer_size) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+
+    // Tier 1: offset-table integrity, always - every fixup entry must
+    // name an in-bounds slot holding an in-bounds reference. v1.3 slots
+    // are 4-byte CMXArenaRefs; older files carry legacy 8-byte offsets
+    if (header.fixup_offset != 0 && header.fixup_count != 0) {
+        bool relative_refs = header.version >=
+            static_cast<uint32_t>(SerializationVersion::VERSION_1_3);
+        size_t slot_size = relative_refs ? sizeof(CMXArenaRef)
+                                         : sizeof(uint64_t);
+
+        size_t table_size = header.fixup_count * sizeof(uint32_t);
+        if (header.fixup_offset + table_size > buffer_size) {
+            return SerializationResult::ERROR_INVALID_FORMAT;
+        }
+
+        const uint32_t* table =
+            reinterpret_cast<const uint32_t*>(buffer + header.fixup_offset);
+        for (uint32_t i = 0; i < header.fixup_count; ++i) {
+            if (table[i] + slot_size > buffer_size) {
+                return SerializationResult::ERROR_INVALID_FORMAT;
+            }
+            uint64_t relative = 0;
+            memcpy(&relative, buffer + table[i], slot_size);
+            if (relative_refs && relative == CMX_NULL_REF) {
+                continue;
+            }
+            if (relative > buffer_size) {
+                return SerializationResult::ERROR_INVALID_FORMAT;
+            }
+        }
+    }
+
+    // Tier 2: full payload checksum, only when explicitly requested
+    if (has_flag(flags, SerializationFlags::VALIDATE_CHECKSUMS)) {
+        uint32_t calculated_checksum = calculate_checksum(
+            buffer + sizeof(CMXSerializationHeader),
+            header.graph_size
+        );
+        if (calculated_checksum != header.checksum) {
+            return SerializationResult::ERROR_CHECKSUM_MISMATCH;
+        }
+    }
+
+    return SerializationResult::SUCCESS;
+}
+
+bool CMXGraphSerializer::validate_payload_chunk(
+    const uint8_t* data,
+    size_t size,
+    uint32_t expected_checksum) {
+
+    if (expected_checksum == 0) {
+        return true; // Record carries no checksum
+    }
+    return data && calculate_checksum(data, size) == expected_checksum;
+}
+
 SerializationVersion CMXGraphSerializer::get_version(const uint8_t* buffer, size_t buffer_size) {
     if (!buffer || buffer_size < sizeof(CMXSerializationHeader)) {
         return SerializationVersion::VERSION_1_0;
@@ -344,6 +816,9 @@ SerializationVersion CMXGraphSerializer::get_version(const uint8_t* buffer, size
 bool CMXGraphSerializer::is_version_supported(SerializationVersion version) {
     switch (version) {
         case SerializationVersion::VERSION_1_0:
+        case SerializationVersion::VERSION_1_1:
+        case SerializationVersion::VERSION_1_2:
+        case SerializationVersion::VERSION_1_3:
             return true;
         default:
             return false;
@@ -384,12 +859,17 @@ size_t CMXGraphSerializer::write_header(uint8_t* buffer, const CMXGraph& graph,
     header->header_size = sizeof(CMXSerializationHeader);
     header->graph_size = 0; // Will be updated later
     header->checksum = 0;   // Will be updated later
-    header->node_count = graph.get_node_count();
-    header->tensor_count = graph.get_tensor_count();
-    
-    // Clear reserved fields
-    memset(header->reserved, 0, sizeof(header->reserved));
-    
+    header->node_count = graph.node_count();
+    header->tensor_count = graph.get_tensor_ids().size();
+    header->plan_offset = 0; // Updated after the plan section is written
+    header->plan_size = 0;
+    header->fixup_offset = 0; // Updated after the fixup table is written
+    header->fixup_count = 0;
+    header->payload_offset = 0; // Updated after the payload section is written
+    header->payload_size = 0;
+    header->string_table_offset = 0; // Updated after the string table is written
+    header->string_table_size = 0;
+
     return sizeof(CMXSerializationHeader);
 }
 
@@ -398,7 +878,7 @@ size_t CMXGraphSerializer::write_nodes(uint8_t* buffer, size_t offset, const CMX
     // and serialize each node's data (op_type, attributes, etc.)
     
     size_t written = 0;
-    uint32_t node_count = graph.get_node_count();
+    uint32_t node_count = graph.node_count();
     
     for (uint32_t i = 0; i < node_count; ++i) {
         // Write node ID
@@ -408,7 +888,17 @@ size_t CMXGraphSerializer::write_nodes(uint8_t* buffer, size_t offset, const CMX
         // Write op_type (simplified as uint32_t)
         *reinterpret_cast<uint32_t*>(buffer + offset + written) = 0; // Placeholder
         written += sizeof(uint32_t);
-        
+
+        // Write interned name id (v1.2) - the name text itself goes to
+        // the string table once, not inline per node
+        NodePtr node = graph.get_node(i);
+        uint16_t name_id = node ? intern_string(node->get_name().c_str())
+                                : CMX_INVALID_STRING_ID;
+        *reinterpret_cast<uint16_t*>(buffer + offset + written) = name_id;
+        written += sizeof(uint16_t);
+        *reinterpret_cast<uint16_t*>(buffer + offset + written) = 0; // Alignment pad
+        written += sizeof(uint16_t);
+
         // Write input/output counts and IDs would go here
         // This is a simplified implementation
     }
@@ -419,13 +909,20 @@ size_t CMXGraphSerializer::write_nodes(uint8_t* buffer, size_t offset, const CMX
 size_t CMXGraphSerializer::write_tensors(uint8_t* buffer, size_t offset, const CMXGraph& graph) {
     // Simplified implementation - in real version would serialize tensor metadata
     size_t written = 0;
-    uint32_t tensor_count = graph.get_tensor_count();
+    uint32_t tensor_count = graph.get_tensor_ids().size();
     
     for (uint32_t i = 0; i < tensor_count; ++i) {
         // Write tensor ID
         *reinterpret_cast<uint32_t*>(buffer + offset + written) = i;
         written += sizeof(uint32_t);
-        
+
+        // Write interned name id (v1.2); tensor names are not tracked by
+        // CMXGraph yet, so records carry the invalid id until they are
+        *reinterpret_cast<uint16_t*>(buffer + offset + written) = CMX_INVALID_STRING_ID;
+        written += sizeof(uint16_t);
+        *reinterpret_cast<uint16_t*>(buffer + offset + written) = 0; // Alignment pad
+        written += sizeof(uint16_t);
+
         // Write tensor metadata (shape, dtype, etc.) would go here
         // This is a simplified implementation
     }
@@ -443,10 +940,105 @@ size_t CMXGraphSerializer::write_topology(uint8_t* buffer, size_t offset, const
     written += sizeof(uint32_t);
     
     // Write edges (source_node, target_node, tensor_id) would go here
-    
+
     return written;
 }
 
+uint16_t CMXGraphSerializer::intern_string(const char* str) {
+    if (!str || str[0] == '\0') {
+        return CMX_INVALID_STRING_ID;
+    }
+
+    // Linear scan over collected strings; the table is small (one entry
+    // per distinct name) and interning only runs at export time
+    for (size_t i = 0; i < intern_offsets_.size(); ++i) {
+        if (strcmp(intern_blob_.data() + intern_offsets_[i], str) == 0) {
+            return static_cast<uint16_t>(i);
+        }
+    }
+
+    if (intern_offsets_.size() >= CMX_INVALID_STRING_ID) {
+        return CMX_INVALID_STRING_ID; // Table full; drop the name
+    }
+
+    uint16_t id = static_cast<uint16_t>(intern_offsets_.size());
+    intern_offsets_.push_back(static_cast<uint32_t>(intern_blob_.size()));
+    intern_blob_.insert(intern_blob_.end(), str, str + strlen(str) + 1);
+    return id;
+}
+
+size_t CMXGraphSerializer::write_string_table(uint8_t* buffer, size_t offset) {
+    size_t written = 0;
+
+    CMXStringTableHeader* table_header =
+        reinterpret_cast<CMXStringTableHeader*>(buffer + offset);
+    table_header->string_count = static_cast<uint32_t>(intern_offsets_.size());
+    table_header->blob_size = static_cast<uint32_t>(intern_blob_.size());
+    written += sizeof(CMXStringTableHeader);
+
+    // Offset array, then the deduplicated NUL-terminated blob
+    if (!intern_offsets_.empty()) {
+        memcpy(buffer + offset + written, intern_offsets_.data(),
+               intern_offsets_.size() * sizeof(uint32_t));
+        written += intern_offsets_.size() * sizeof(uint32_t);
+
+        memcpy(buffer + offset + written, intern_blob_.data(), intern_blob_.size());
+        written += intern_blob_.size();
+    }
+
+    // Pad to alignment so following sections stay aligned
+    while (written % BUFFER_ALIGNMENT != 0) {
+        buffer[offset + written] = 0;
+        ++written;
+    }
+
+    return written;
+}
+
+SerializationResult CMXGraphSerializer::read_string_table(
+    const uint8_t* buffer,
+    size_t offset,
+    size_t section_size) {
+
+    if (section_size < sizeof(CMXStringTableHeader)) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+
+    CMXStringTableHeader table_header;
+    memcpy(&table_header, buffer + offset, sizeof(table_header));
+
+    size_t offsets_size = table_header.string_count * sizeof(uint32_t);
+    if (sizeof(table_header) + offsets_size + table_header.blob_size > section_size) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+
+    const uint32_t* offsets =
+        reinterpret_cast<const uint32_t*>(buffer + offset + sizeof(table_header));
+    const char* blob =
+        reinterpret_cast<const char*>(buffer + offset + sizeof(table_header) + offsets_size);
+
+    // Every offset must land in the blob on a NUL-terminated string;
+    // requiring the blob to end with a terminator makes this a pure
+    // bounds check instead of a scan
+    if (table_header.string_count > 0) {
+        if (table_header.blob_size == 0 || blob[table_header.blob_size - 1] != '\0') {
+            return SerializationResult::ERROR_INVALID_FORMAT;
+        }
+        for (uint32_t i = 0; i < table_header.string_count; ++i) {
+            if (offsets[i] >= table_header.blob_size) {
+                return SerializationResult::ERROR_INVALID_FORMAT;
+            }
+        }
+    }
+
+    // Keep pointers only; resolve_string reads them lazily
+    table_base_ = buffer + offset + sizeof(table_header);
+    table_blob_ = blob;
+    table_count_ = table_header.string_count;
+
+    return SerializationResult::SUCCESS;
+}
+
 SerializationResult CMXGraphSerializer::read_header(
     const uint8_t* buffer,
     size_t buffer_size,
@@ -528,6 +1120,205 @@ SerializationResult CMXGraphSerializer::read_topology(
     return SerializationResult::SUCCESS;
 }
 
+size_t CMXGraphSerializer::write_payloads(uint8_t* buffer, size_t offset, const CMXGraph& graph) {
+    // Simplified implementation - in real version would write each weight
+    // tensor's raw bytes after its record header
+    size_t written = 0;
+
+    for (TensorID tensor_id : graph.get_tensor_ids()) {
+        CMXSerializedPayloadHeader* record =
+            reinterpret_cast<CMXSerializedPayloadHeader*>(buffer + offset + written);
+        record->tensor_id = tensor_id;
+        record->size = 0; // Payload bytes would follow here
+        record->checksum = 0; // CRC32 of the payload bytes under SECTION_CHECKSUMS
+        record->compression = PayloadCompression::NONE;
+        memset(record->reserved, 0, sizeof(record->reserved));
+        written += sizeof(CMXSerializedPayloadHeader);
+    }
+
+    return written;
+}
+
+void CMXGraphSerializer::record_fixup_slot(size_t slot_offset) {
+    fixup_slots_.push_back(static_cast<uint32_t>(slot_offset));
+}
+
+size_t CMXGraphSerializer::write_fixup_table(uint8_t* buffer, size_t offset) {
+    size_t written = 0;
+
+    for (uint32_t slot : fixup_slots_) {
+        *reinterpret_cast<uint32_t*>(buffer + offset + written) = slot;
+        written += sizeof(uint32_t);
+    }
+
+    return written;
+}
+
+SerializationResult CMXGraphSerializer::relocate_in_place(
+    uint8_t* buffer,
+    size_t buffer_size,
+    const CMXSerializationHeader& header) {
+
+    if (header.fixup_offset == 0 || header.fixup_count == 0) {
+        return SerializationResult::SUCCESS; // Nothing to relocate
+    }
+
+    size_t table_size = header.fixup_count * sizeof(uint32_t);
+    if (header.fixup_offset + table_size > buffer_size) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+
+    const uint32_t* table =
+        reinterpret_cast<const uint32_t*>(buffer + header.fixup_offset);
+
+    // v1.3: slots hold position-independent CMXArenaRefs that readers
+    // resolve against the buffer base at use. Bounds-check them here and
+    // leave the buffer untouched, so it may live in read-only storage
+    if (header.version >=
+        static_cast<uint32_t>(SerializationVersion::VERSION_1_3)) {
+        for (uint32_t i = 0; i < header.fixup_count; ++i) {
+            uint32_t slot_offset = table[i];
+            if (slot_offset + sizeof(CMXArenaRef) > buffer_size) {
+                return SerializationResult::ERROR_INVALID_FORMAT;
+            }
+
+            CMXArenaRef ref = CMX_NULL_REF;
+            memcpy(&ref, buffer + slot_offset, sizeof(CMXArenaRef));
+            if (ref != CMX_NULL_REF && ref > buffer_size) {
+                return SerializationResult::ERROR_INVALID_FORMAT;
+            }
+        }
+        return SerializationResult::SUCCESS;
+    }
+
+    // Pre-1.3: legacy 8-byte slots are rewritten to absolute addresses
+    for (uint32_t i = 0; i < header.fixup_count; ++i) {
+        uint32_t slot_offset = table[i];
+        if (slot_offset + sizeof(uint64_t) > buffer_size) {
+            return SerializationResult::ERROR_INVALID_FORMAT;
+        }
+
+        // Slot holds a buffer-relative offset; rewrite to absolute address
+        uint64_t relative = 0;
+        memcpy(&relative, buffer + slot_offset, sizeof(uint64_t));
+        if (relative > buffer_size) {
+            return SerializationResult::ERROR_INVALID_FORMAT;
+        }
+
+        uint64_t absolute =
+            static_cast<uint64_t>(reinterpret_cast<uintptr_t>(buffer + relative));
+        memcpy(buffer + slot_offset, &absolute, sizeof(uint64_t));
+    }
+
+    return SerializationResult::SUCCESS;
+}
+
+size_t CMXGraphSerializer::write_execution_plan(uint8_t* buffer, size_t offset) {
+    size_t written = 0;
+
+    // Section header
+    CMXSerializedPlanHeader* plan_header =
+        reinterpret_cast<CMXSerializedPlanHeader*>(buffer + offset);
+    plan_header->step_count = static_cast<uint32_t>(plan_order_.size());
+    plan_header->placement_count = static_cast<uint32_t>(plan_memory_.placements.size());
+    plan_header->arena_size = static_cast<uint32_t>(plan_memory_.arena_size);
+    plan_header->arena_alignment = plan_alignment_;
+    written += sizeof(CMXSerializedPlanHeader);
+
+    // Execution order
+    for (NodeID node_id : plan_order_) {
+        *reinterpret_cast<uint32_t*>(buffer + offset + written) = node_id;
+        written += sizeof(uint32_t);
+    }
+
+    // Tensor placements
+    for (const auto& [tensor_id, placement] : plan_memory_.placements) {
+        CMXSerializedPlacement* record =
+            reinterpret_cast<CMXSerializedPlacement*>(buffer + offset + written);
+        record->tensor_id = tensor_id;
+        record->offset = static_cast<uint32_t>(placement.offset);
+        record->size = static_cast<uint32_t>(placement.size);
+        record->first_use = placement.first_use;
+        record->last_use = placement.last_use;
+        written += sizeof(CMXSerializedPlacement);
+    }
+
+    // Measured kernel choices (optional trailer; readers that stop
+    // after the placements skip it)
+    for (const CMXSerializedKernelChoice& choice : plan_choices_) {
+        memcpy(buffer + offset + written, &choice,
+               sizeof(CMXSerializedKernelChoice));
+        written += sizeof(CMXSerializedKernelChoice);
+    }
+
+    return written;
+}
+
+SerializationResult CMXGraphSerializer::read_execution_plan(
+    const uint8_t* buffer,
+    size_t offset,
+    size_t section_size) {
+
+    if (section_size < sizeof(CMXSerializedPlanHeader)) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+
+    CMXSerializedPlanHeader plan_header;
+    memcpy(&plan_header, buffer + offset, sizeof(CMXSerializedPlanHeader));
+
+    size_t expected_size = sizeof(CMXSerializedPlanHeader)
+        + plan_header.step_count * sizeof(uint32_t)
+        + plan_header.placement_count * sizeof(CMXSerializedPlacement);
+    if (section_size < expected_size) {
+        return SerializationResult::ERROR_INVALID_FORMAT;
+    }
+
+    size_t read_pos = offset + sizeof(CMXSerializedPlanHeader);
+
+    // Execution order
+    plan_order_.clear();
+    plan_order_.reserve(plan_header.step_count);
+    for (uint32_t i = 0; i < plan_header.step_count; ++i) {
+        plan_order_.push_back(*reinterpret_cast<const uint32_t*>(buffer + read_pos));
+        read_pos += sizeof(uint32_t);
+    }
+
+    // Tensor placements
+    plan_memory_ = CMXMemoryPlan();
+    plan_memory_.arena_size = plan_header.arena_size;
+    for (uint32_t i = 0; i < plan_header.placement_count; ++i) {
+        CMXSerializedPlacement record;
+        memcpy(&record, buffer + read_pos, sizeof(CMXSerializedPlacement));
+        read_pos += sizeof(CMXSerializedPlacement);
+
+        CMXTensorPlacement placement;
+        placement.offset = record.offset;
+        placement.size = record.size;
+        placement.first_use = record.first_use;
+        placement.last_use = record.last_use;
+        plan_memory_.placements[record.tensor_id] = placement;
+    }
+
+    // Kernel-choice trailer: whole records filling the remainder of
+    // the section. Files written before the trailer existed end here
+    // and simply load zero choices.
+    plan_choices_.clear();
+    size_t remaining = offset + section_size - read_pos;
+    size_t choice_count = remaining / sizeof(CMXSerializedKernelChoice);
+    plan_choices_.reserve(choice_count);
+    for (size_t i = 0; i < choice_count; ++i) {
+        CMXSerializedKernelChoice choice;
+        memcpy(&choice, buffer + read_pos, sizeof(CMXSerializedKernelChoice));
+        read_pos += sizeof(CMXSerializedKernelChoice);
+        choice.kernel_name[sizeof(choice.kernel_name) - 1] = '\0';
+        plan_choices_.push_back(choice);
+    }
+
+    plan_alignment_ = plan_header.arena_alignment;
+    plan_loaded_ = true;
+    return SerializationResult::SUCCESS;
+}
+
 uint32_t CMXGraphSerializer::calculate_checksum(const uint8_t* data, size_t size) {
     // Simple CRC32 implementation
     uint32_t crc = 0xFFFFFFFF;
@@ -585,4 +1376,37 @@ size_t CMXGraphSerializer::compress_data(
     return output_pos;
 }
 
-size_t
\ No newline at end of file
+size_t CMXGraphSerializer::decompress_data(
+    const uint8_t* input,
+    size_t input_size,
+    uint8_t* output,
+    size_t output_size) {
+
+    // Simple RLE decompression implementation
+    if (input_size == 0 || input_size % 2 != 0) {
+        return 0;
+    }
+
+    size_t output_pos = 0;
+    size_t input_pos = 0;
+
+    while (input_pos < input_size - 1 && output_pos < output_size) {
+        uint8_t count = input[input_pos++];
+        uint8_t byte_value = input[input_pos++];
+
+        // Check if we have enough space in output buffer
+        if (output_pos + count > output_size) {
+            break;
+        }
+
+        // Write decompressed bytes
+        for (uint8_t i = 0; i < count; ++i) {
+            output[output_pos++] = byte_value;
+        }
+    }
+
+    return output_pos;
+}
+
+} // namespace graph
+} // namespace cmx
\ No newline at end of file
@@ -1,7 +1,11 @@
 #pragma once
 
+#include "cmx_graph_format.hpp"
+#include "cmx_memory_planner.hpp"
+
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 namespace cmx {
 namespace graph {
@@ -14,9 +18,39 @@ class CMXGraph;
  */
 enum class SerializationVersion : uint32_t {
     VERSION_1_0 = 0x01000000,
-    CURRENT = VERSION_1_0
+    VERSION_1_1 = 0x01010000,   // Adds optional execution plan section
+    VERSION_1_2 = 0x01020000,   // Adds interned string table; node and tensor
+                                // records carry 16-bit string ids, not names
+    VERSION_1_3 = 0x01030000,   // Fixup slots are 32-bit buffer-relative refs
+                                // resolved at use; no load-time pointer rewrite
+    CURRENT = VERSION_1_3
 };
 
+/**
+ * @brief Position-independent buffer reference (v1.3)
+ *
+ * All references inside a serialized buffer - fixup slots, plan
+ * metadata - are stored as 32-bit offsets from the buffer base rather
+ * than pointers. A loaded image is therefore valid at any base address
+ * on any device with no relocation pass, the buffer can stay read-only
+ * (shared flash mapping, XIP), and reference metadata is half the size
+ * of 64-bit pointer slots on the Linux gateway builds.
+ */
+using CMXArenaRef = uint32_t;
+
+/// Reference value meaning "no target"
+constexpr CMXArenaRef CMX_NULL_REF = 0xFFFFFFFF;
+
+/**
+ * @brief Resolve a buffer-relative reference against its base address
+ * @param base Buffer or arena base the reference is relative to
+ * @param ref 32-bit offset from base
+ * @return Absolute address, nullptr for CMX_NULL_REF
+ */
+inline const uint8_t* resolve_arena_ref(const uint8_t* base, CMXArenaRef ref) {
+    return (ref == CMX_NULL_REF) ? nullptr : base + ref;
+}
+
 /**
  * @brief Serialization flags for controlling output format
  */
@@ -24,7 +58,10 @@ enum class SerializationFlags : uint32_t {
     NONE = 0,
     INCLUDE_DEBUG_INFO = 1 << 0,
     COMPRESS_WEIGHTS = 1 << 1,
-    VALIDATE_CHECKSUMS = 1 << 2
+    VALIDATE_CHECKSUMS = 1 << 2,
+    INCLUDE_EXECUTION_PLAN = 1 << 3,
+    EMIT_OFFSET_TABLE = 1 << 4,
+    SECTION_CHECKSUMS = 1 << 5
 };
 
 /**
@@ -39,7 +76,90 @@ struct CMXSerializationHeader {
     uint32_t checksum;          // CRC32 of graph data
     uint32_t node_count;        // Number of nodes
     uint32_t tensor_count;      // Number of tensors
-    uint32_t reserved[8];       // Reserved for future use
+    uint32_t plan_offset;       // Offset of execution plan section, 0 if absent (v1.1)
+    uint32_t plan_size;         // Size of execution plan section in bytes (v1.1)
+    uint32_t fixup_offset;      // Offset of reference fixup table, 0 if absent (v1.1)
+    uint32_t fixup_count;       // Number of fixup table entries (v1.1)
+    uint32_t payload_offset;    // Offset of weight payload section, 0 if absent (v1.1)
+    uint32_t payload_size;      // Size of weight payload section in bytes (v1.1)
+    uint32_t string_table_offset; // Offset of interned string table, 0 if absent (v1.2)
+    uint32_t string_table_size;   // Size of string table section in bytes (v1.2)
+};
+
+/**
+ * @brief Record header preceding each weight payload (v1.1)
+ *
+ * The payload section is a sequence of these records, each followed by
+ * size raw bytes, so a streaming reader can consume one record at a
+ * time without buffering the whole section.
+ */
+struct CMXSerializedPayloadHeader {
+    uint32_t tensor_id;
+    uint32_t size;              // Stored payload bytes following this record
+    uint32_t checksum;          // CRC32 of the decompressed payload, 0 if not emitted
+    PayloadCompression compression; // Scheme applied to the stored bytes
+    uint8_t reserved[3];
+};
+
+/**
+ * @brief Header of the optional execution plan section (v1.1)
+ *
+ * Followed by step_count uint32 node IDs in execution order, then
+ * placement_count serialized tensor placements, then optionally
+ * measured kernel-choice records filling the remainder of the section.
+ * Embedding the plan at export time lets cold-start skip topological
+ * sorting and memory planning entirely.
+ */
+struct CMXSerializedPlanHeader {
+    uint32_t step_count;        // Nodes in compiled execution order
+    uint32_t placement_count;   // Tensor placements in the arena plan
+    uint32_t arena_size;        // Total arena size in bytes
+    uint32_t arena_alignment;   // Alignment used when the plan was built
+};
+
+/// String id stored when a node or tensor has no name
+constexpr uint16_t CMX_INVALID_STRING_ID = 0xFFFF;
+
+/**
+ * @brief Header of the interned string table section (v1.2)
+ *
+ * Followed by string_count uint32 byte offsets into the blob, then
+ * blob_size bytes of NUL-terminated strings. Every op and tensor name
+ * appears exactly once; records elsewhere store a 16-bit id into this
+ * table. Readers keep ids as the runtime identity and resolve them to
+ * text lazily (debug hooks, error messages), so load time spends no
+ * cycles rebuilding string objects.
+ */
+struct CMXStringTableHeader {
+    uint32_t string_count;      // Entries in the offset array
+    uint32_t blob_size;         // Bytes of string data after the offsets
+};
+
+/**
+ * @brief One serialized tensor placement record (v1.1)
+ */
+struct CMXSerializedPlacement {
+    uint32_t tensor_id;
+    uint32_t offset;            // Byte offset inside the arena
+    uint32_t size;              // Alignment-padded size in bytes
+    uint32_t first_use;         // Producing step index
+    uint32_t last_use;          // Last consuming step index
+};
+
+/**
+ * @brief One measured kernel-choice record (plan section trailer)
+ *
+ * The benchmark/autotune harness times the registered kernel
+ * candidates per node and records the winner; the records are
+ * appended after the placements and fill the rest of the plan
+ * section, so readers that stop after placement_count records skip
+ * them and no format version bump is needed. At load the records are
+ * replayed into cmx_op_dispatcher::record_kernel_choice, making the
+ * measured winner override the shape heuristics at dispatch time.
+ */
+struct CMXSerializedKernelChoice {
+    uint32_t node_id;           // Node whose dispatch the kernel won
+    char kernel_name[28];       // NUL-padded cmx_kernel_info::name
 };
 
 /**
@@ -129,6 +249,36 @@ public:
         SerializationFlags flags = SerializationFlags::NONE
     );
 
+    /**
+     * @brief Deserialize graph in place without copying payloads
+     *
+     * Walks the fixup table (written under EMIT_OFFSET_TABLE). In v1.3
+     * buffers each table entry names a 4-byte slot holding a CMXArenaRef;
+     * slots are bounds-checked but never rewritten - readers resolve them
+     * against the buffer base at use, so the image is position-independent
+     * and the buffer may stay read-only (shared flash mapping, XIP). For
+     * pre-1.3 buffers the legacy pass still rewrites each 8-byte slot to
+     * an absolute address, which requires a writable buffer. Either way
+     * the buffer itself backs the live graph - tensor data points into it
+     * and no payload bytes are copied, so load cost is O(number of
+     * references) rather than O(model bytes).
+     *
+     * The buffer must outlive the graph. Checksum validation, when
+     * requested, runs before the fixup walk since the legacy rewrite
+     * mutates the buffer.
+     * @param buffer Mutable buffer containing serialized graph
+     * @param buffer_size Size of buffer
+     * @param graph Output graph object backed by the buffer
+     * @param flags Deserialization options
+     * @return SerializationResult indicating success/failure
+     */
+    SerializationResult deserialize_in_place(
+        uint8_t* buffer,
+        size_t buffer_size,
+        CMXGraph& graph,
+        SerializationFlags flags = SerializationFlags::NONE
+    );
+
     /**
      * @brief Deserialize graph from file
      * @param filename Input file path
@@ -142,6 +292,108 @@ public:
         SerializationFlags flags = SerializationFlags::NONE
     );
 
+    /**
+     * @brief Deserialize graph from file through a small fixed window
+     *
+     * Streaming alternative to deserialize_from_file for parts where a
+     * contiguous model-sized buffer cannot be allocated alongside the
+     * arena. Metadata sections are staged through a STREAM_WINDOW_SIZE
+     * window; weight payloads are read straight into their final arena
+     * locations as given by the embedded execution plan, so peak
+     * load-time RAM is the plan plus the window rather than the model.
+     *
+     * Requires a v1.1 file carrying an execution plan section; payload
+     * records for tensors absent from the plan are skipped.
+     * @param filename Input file path
+     * @param graph Output graph object
+     * @param arena Arena backing tensor payloads
+     * @param arena_size Size of arena in bytes
+     * @param flags Deserialization options
+     * @return SerializationResult indicating success/failure
+     */
+    SerializationResult deserialize_streaming(
+        const char* filename,
+        CMXGraph& graph,
+        uint8_t* arena,
+        size_t arena_size,
+        SerializationFlags flags = SerializationFlags::NONE
+    );
+
+    /**
+     * @brief Attach a compiled execution plan for serialization
+     *
+     * When INCLUDE_EXECUTION_PLAN is set, the next serialize call embeds
+     * the execution order and arena placements so that deserialization
+     * can skip topological sorting and memory planning at boot.
+     * @param execution_order Node IDs in compiled execution order
+     * @param memory_plan Arena plan produced by CMXMemoryPlanner
+     * @param arena_alignment Alignment the plan was built with
+     */
+    void set_execution_plan(
+        const std::vector<NodeID>& execution_order,
+        const CMXMemoryPlan& memory_plan,
+        uint32_t arena_alignment = 16
+    );
+
+    /**
+     * @brief Attach measured kernel choices for serialization
+     *
+     * Written as trailing records of the execution plan section, so
+     * INCLUDE_EXECUTION_PLAN must be set and a plan attached for the
+     * choices to be persisted. Names longer than the record's name
+     * field are truncated at serialization.
+     * @param choices Per-node measured-best kernel records
+     */
+    void set_kernel_choices(const std::vector<CMXSerializedKernelChoice>& choices);
+
+    /**
+     * @brief Kernel choices read from the last deserialized plan
+     *
+     * Empty when the file carried none (plans written before the
+     * trailer existed stay loadable). The model loader feeds these to
+     * cmx_op_dispatcher::record_kernel_choice.
+     * @return Records in file order
+     */
+    const std::vector<CMXSerializedKernelChoice>& get_kernel_choices() const {
+        return plan_choices_;
+    }
+
+    /**
+     * @brief Check whether the last deserialized buffer carried a plan
+     * @return true if an execution plan section was read
+     */
+    bool has_execution_plan() const { return plan_loaded_; }
+
+    /**
+     * @brief Retrieve the execution plan read during deserialization
+     * @param execution_order Output node IDs in execution order
+     * @param memory_plan Output arena plan
+     * @return true if a plan was available, false otherwise
+     */
+    bool get_execution_plan(
+        std::vector<NodeID>& execution_order,
+        CMXMemoryPlan& memory_plan
+    ) const;
+
+    /**
+     * @brief Resolve an interned string id to its text (v1.2)
+     *
+     * Lazy lookup into the string table of the last deserialized buffer
+     * (or the table built by the last serialize call). Returns a pointer
+     * into that storage - no std::string is constructed - so it is cheap
+     * enough for per-node debug hooks. The pointer is valid as long as
+     * the backing buffer is.
+     * @param id String id from a node or tensor record
+     * @return NUL-terminated string, nullptr if id is invalid or no table is loaded
+     */
+    const char* resolve_string(uint16_t id) const;
+
+    /**
+     * @brief Get the number of entries in the loaded string table
+     * @return Entry count, 0 if no table is loaded
+     */
+    uint32_t get_string_count() const;
+
     /**
      * @brief Calculate required buffer size for serialization
      * @param graph Graph to serialize
@@ -161,6 +413,36 @@ public:
      */
     bool validate_format(const uint8_t* buffer, size_t buffer_size);
 
+    /**
+     * @brief Tiered buffer validation
+     *
+     * Header and offset-table integrity are always checked: section
+     * bounds, fixup table entries and plan/payload section extents. The
+     * full payload checksum - the expensive part on large models - runs
+     * only when VALIDATE_CHECKSUMS is set; buffers written with
+     * SECTION_CHECKSUMS carry per-record payload checksums instead, so
+     * lazily-streamed weight chunks can be verified on first touch via
+     * validate_payload_chunk.
+     * @param buffer Buffer containing serialized data
+     * @param buffer_size Size of buffer
+     * @param flags Validation tier selection
+     * @return SerializationResult indicating success/failure
+     */
+    SerializationResult validate_buffer(
+        const uint8_t* buffer,
+        size_t buffer_size,
+        SerializationFlags flags = SerializationFlags::NONE
+    );
+
+    /**
+     * @brief Validate one payload chunk against its record checksum
+     * @param data Payload bytes (e.g. already placed in the arena)
+     * @param size Number of bytes
+     * @param expected_checksum Checksum from the payload record
+     * @return true if the chunk matches, false otherwise
+     */
+    bool validate_payload_chunk(const uint8_t* data, size_t size, uint32_t expected_checksum);
+
     /**
      * @brief Get version information from serialized buffer
      * @param buffer Buffer containing serialized data
@@ -220,6 +502,104 @@ private:
      */
     size_t write_topology(uint8_t* buffer, size_t offset, const CMXGraph& graph);
 
+    /**
+     * @brief Write weight payload section to buffer
+     * @param buffer Output buffer
+     * @param offset Current buffer offset
+     * @param graph Graph being serialized
+     * @return Number of bytes written
+     */
+    size_t write_payloads(uint8_t* buffer, size_t offset, const CMXGraph& graph);
+
+    /**
+     * @brief Intern a name during serialization (v1.2)
+     *
+     * Deduplicates against strings already collected for the current
+     * write; the returned id is what node and tensor records store.
+     * @param str Name to intern, may be empty
+     * @return 16-bit string id, CMX_INVALID_STRING_ID for empty names
+     */
+    uint16_t intern_string(const char* str);
+
+    /**
+     * @brief Write interned string table section to buffer
+     * @param buffer Output buffer
+     * @param offset Current buffer offset
+     * @return Number of bytes written
+     */
+    size_t write_string_table(uint8_t* buffer, size_t offset);
+
+    /**
+     * @brief Read interned string table section from buffer
+     *
+     * Records the table location for lazy resolve_string lookups; does
+     * not materialize any strings.
+     * @param buffer Input buffer
+     * @param offset Section offset from header
+     * @param section_size Section size from header
+     * @return SerializationResult indicating success/failure
+     */
+    SerializationResult read_string_table(
+        const uint8_t* buffer,
+        size_t offset,
+        size_t section_size
+    );
+
+    /**
+     * @brief Record a reference slot for the fixup table
+     *
+     * Called while writing sections for every 4-byte slot that stores a
+     * CMXArenaRef, so loaders can bounds-check the references up front.
+     * @param slot_offset Buffer offset of the slot
+     */
+    void record_fixup_slot(size_t slot_offset);
+
+    /**
+     * @brief Write reference fixup table to buffer
+     * @param buffer Output buffer
+     * @param offset Current buffer offset
+     * @return Number of bytes written
+     */
+    size_t write_fixup_table(uint8_t* buffer, size_t offset);
+
+    /**
+     * @brief Walk the fixup table at load time
+     *
+     * v1.3 buffers: bounds-check each CMXArenaRef slot, no mutation.
+     * Pre-1.3 buffers: rewrite each legacy 8-byte slot from a relative
+     * offset to an absolute pointer.
+     * @param buffer Mutable buffer (only written for pre-1.3 files)
+     * @param buffer_size Size of buffer
+     * @param header Validated header carrying the fixup table location
+     * @return SerializationResult indicating success/failure
+     */
+    SerializationResult relocate_in_place(
+        uint8_t* buffer,
+        size_t buffer_size,
+        const CMXSerializationHeader& header
+    );
+
+    /**
+     * @brief Write execution plan section to buffer
+     * @param buffer Output buffer
+     * @param offset Current buffer offset
+     * @return Number of bytes written
+     */
+    size_t write_execution_plan(uint8_t* buffer, size_t offset);
+
+    /**
+     * @brief Read execution plan section from buffer
+     * @param buffer Input buffer
+     * @param offset Section offset from header
+     * @param section_size Section size from header
+     * @return SerializationResult indicating success/failure
+     */
+    SerializationResult read_execution_plan(
+        const uint8_t* buffer,
+        size_t offset,
+        size_t section_size
+    );
+
     /**
      * @brief Read and validate header from buffer
      * @param buffer Input buffer
@@ -318,11 +698,30 @@ private:
     static constexpr uint32_t MAGIC_NUMBER = 0x474D5843; // 'CMXG'
     static constexpr size_t MAX_FILENAME_LENGTH = 256;
     static constexpr size_t BUFFER_ALIGNMENT = 8;
+    static constexpr size_t STREAM_WINDOW_SIZE = 4096;
 
     // Internal state
     uint8_t* temp_buffer_;
     size_t temp_buffer_size_;
     bool initialized_;
+
+    // Execution plan state (v1.1 optional section)
+    std::vector<NodeID> plan_order_;
+    CMXMemoryPlan plan_memory_;
+    std::vector<CMXSerializedKernelChoice> plan_choices_;
+    uint32_t plan_alignment_;
+    bool plan_set_;
+    bool plan_loaded_;
+
+    // Pointer slots collected during serialization (v1.1 fixup table)
+    std::vector<uint32_t> fixup_slots_;
+
+    // String interning state (v1.2 string table)
+    std::vector<uint32_t> intern_offsets_;  // Blob offset per collected string
+    std::vector<char> intern_blob_;         // NUL-terminated strings, deduplicated
+    const uint8_t* table_base_;             // Loaded table: offset array location
+    const char* table_blob_;                // Loaded table: string data location
+    uint32_t table_count_;                  // Loaded table: entry count
 };
 
 /**
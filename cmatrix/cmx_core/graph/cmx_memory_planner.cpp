@@ -0,0 +1,431 @@
+#include "cmx_memory_planner.hpp"
+#include "cmx_node.hpp"
+#include <algorithm>
+
+namespace cmx {
+namespace graph {
+
+namespace {
+
+size_t align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+CMXMemoryPlan CMXMemoryPlanner::plan(
+    const CMXGraph& graph,
+    const std::unordered_map<TensorID, size_t>& tensor_sizes,
+    size_t alignment
+) {
+    CMXMemoryPlan result;
+
+    std::vector<NodeID> order = graph.topological_sort();
+    if (order.empty()) {
+        return result;
+    }
+
+    // Pass 1: derive tensor lifetimes from the execution order. A tensor
+    // is born at its producer and dies after its last consumer.
+    std::unordered_map<TensorID, CMXTensorPlacement> placements;
+
+    for (uint32_t step = 0; step < order.size(); ++step) {
+        NodePtr node = graph.get_node(order[step]);
+        if (!node) {
+            continue;
+        }
+
+        for (TensorID tensor_id : node->get_outputs()) {
+            auto size_it = tensor_sizes.find(tensor_id);
+            if (size_it == tensor_sizes.end()) {
+                continue;
+            }
+            CMXTensorPlacement& placement = placements[tensor_id];
+            placement.size = align_up(size_it->second, alignment);
+            placement.first_use = step;
+            placement.last_use = step;
+        }
+
+        for (TensorID tensor_id : node->get_inputs()) {
+            auto it = placements.find(tensor_id);
+            if (it != placements.end()) {
+                it->second.last_use = step;
+            }
+        }
+    }
+
+    // Graph outputs stay live until the end so callers can read them
+    const uint32_t last_step = static_cast<uint32_t>(order.size() - 1);
+    for (NodeID node_id : graph.get_output_nodes()) {
+        NodePtr node = graph.get_node(node_id);
+        if (!node) {
+            continue;
+        }
+        for (TensorID tensor_id : node->get_outputs()) {
+            auto it = placements.find(tensor_id);
+            if (it != placements.end()) {
+                it->second.last_use = last_step;
+            }
+        }
+    }
+
+    // Pass 2: greedy first-fit packing in order of first use. Tensors
+    // with disjoint lifetimes share arena space.
+    std::vector<TensorID> tensor_order;
+    tensor_order.reserve(placements.size());
+    for (const auto& [tensor_id, _] : placements) {
+        tensor_order.push_back(tensor_id);
+    }
+    std::sort(tensor_order.begin(), tensor_order.end(),
+              [&placements](TensorID a, TensorID b) {
+                  const CMXTensorPlacement& pa = placements.at(a);
+                  const CMXTensorPlacement& pb = placements.at(b);
+                  if (pa.first_use != pb.first_use) {
+                      return pa.first_use < pb.first_use;
+                  }
+                  return pa.size > pb.size;
+              });
+
+    for (TensorID tensor_id : tensor_order) {
+        CMXTensorPlacement& placement = placements[tensor_id];
+
+        // Collect already-placed tensors whose lifetimes overlap
+        std::vector<const CMXTensorPlacement*> live;
+        for (const auto& [other_id, other] : result.placements) {
+            if (other.first_use <= placement.last_use &&
+                placement.first_use <= other.last_use) {
+                live.push_back(&other);
+            }
+        }
+
+        placement.offset = first_fit_offset(live, placement.size);
+        result.placements[tensor_id] = placement;
+        result.arena_size = std::max(result.arena_size,
+                                     placement.offset + placement.size);
+    }
+
+    return result;
+}
+
+CMXMemoryPlan CMXMemoryPlanner::plan_tiered(
+    const CMXGraph& graph,
+    const std::unordered_map<TensorID, size_t>& tensor_sizes,
+    size_t fast_capacity,
+    size_t alignment
+) {
+    // Reuse the single-arena plan for lifetimes and padded sizes
+    CMXMemoryPlan base = plan(graph, tensor_sizes, alignment);
+    if (fast_capacity == 0 || base.placements.empty()) {
+        return base;
+    }
+
+    // Pass 1: pin hot placements into the fast arena. Short lifetimes
+    // identify the per-layer working set (im2col scratch, the current
+    // layer's activations); among equals prefer smaller buffers so the
+    // budget covers more of them.
+    std::vector<TensorID> hot_order;
+    hot_order.reserve(base.placements.size());
+    for (const auto& [tensor_id, _] : base.placements) {
+        hot_order.push_back(tensor_id);
+    }
+    std::sort(hot_order.begin(), hot_order.end(),
+              [&base](TensorID a, TensorID b) {
+                  const CMXTensorPlacement& pa = base.placements.at(a);
+                  const CMXTensorPlacement& pb = base.placements.at(b);
+                  uint32_t span_a = pa.last_use - pa.first_use;
+                  uint32_t span_b = pb.last_use - pb.first_use;
+                  if (span_a != span_b) {
+                      return span_a < span_b;
+                  }
+                  return pa.size < pb.size;
+              });
+
+    CMXMemoryPlan result;
+    for (TensorID tensor_id : hot_order) {
+        CMXTensorPlacement placement = base.placements.at(tensor_id);
+        if (placement.size > fast_capacity) {
+            continue;
+        }
+
+        std::vector<const CMXTensorPlacement*> live;
+        for (const auto& [other_id, other] : result.placements) {
+            if (other.arena == 1 &&
+                other.first_use <= placement.last_use &&
+                placement.first_use <= other.last_use) {
+                live.push_back(&other);
+            }
+        }
+
+        size_t offset = first_fit_offset(live, placement.size);
+        if (offset + placement.size > fast_capacity) {
+            continue;
+        }
+
+        placement.offset = offset;
+        placement.arena = 1;
+        result.placements[tensor_id] = placement;
+        result.fast_arena_size = std::max(result.fast_arena_size,
+                                          offset + placement.size);
+    }
+
+    // Pass 2: pack everything that spilled into the main arena, in the
+    // same first-use order the single-arena planner uses.
+    std::vector<TensorID> main_order;
+    for (const auto& [tensor_id, _] : base.placements) {
+        if (result.placements.find(tensor_id) == result.placements.end()) {
+            main_order.push_back(tensor_id);
+        }
+    }
+    std::sort(main_order.begin(), main_order.end(),
+              [&base](TensorID a, TensorID b) {
+                  const CMXTensorPlacement& pa = base.placements.at(a);
+                  const CMXTensorPlacement& pb = base.placements.at(b);
+                  if (pa.first_use != pb.first_use) {
+                      return pa.first_use < pb.first_use;
+                  }
+                  return pa.size > pb.size;
+              });
+
+    for (TensorID tensor_id : main_order) {
+        CMXTensorPlacement placement = base.placements.at(tensor_id);
+
+        std::vector<const CMXTensorPlacement*> live;
+        for (const auto& [other_id, other] : result.placements) {
+            if (other.arena == 0 &&
+                other.first_use <= placement.last_use &&
+                placement.first_use <= other.last_use) {
+                live.push_back(&other);
+            }
+        }
+
+        placement.offset = first_fit_offset(live, placement.size);
+        placement.arena = 0;
+        result.placements[tensor_id] = placement;
+        result.arena_size = std::max(result.arena_size,
+                                     placement.offset + placement.size);
+    }
+
+    return result;
+}
+
+CMXMemoryPlan CMXMemoryPlanner::plan_spilled(
+    const CMXGraph& graph,
+    const std::unordered_map<TensorID, size_t>& tensor_sizes,
+    size_t ram_capacity,
+    size_t alignment
+) {
+    // Reuse the single-arena plan for lifetimes and padded sizes
+    CMXMemoryPlan base = plan(graph, tensor_sizes, alignment);
+    if (ram_capacity == 0 || base.arena_size <= ram_capacity ||
+        base.placements.empty()) {
+        return base;
+    }
+
+    std::vector<NodeID> order = graph.topological_sort();
+
+    // Collect consumer steps per tensor; traffic decides who gets spilled
+    std::unordered_map<TensorID, std::vector<uint32_t>> consumer_steps;
+    for (uint32_t step = 0; step < order.size(); ++step) {
+        NodePtr node = graph.get_node(order[step]);
+        if (!node) {
+            continue;
+        }
+        for (TensorID tensor_id : node->get_inputs()) {
+            if (base.placements.find(tensor_id) != base.placements.end()) {
+                consumer_steps[tensor_id].push_back(step);
+            }
+        }
+    }
+
+    // Graph outputs must stay readable from RAM after the last node
+    std::unordered_map<TensorID, bool> is_graph_output;
+    for (NodeID node_id : graph.get_output_nodes()) {
+        NodePtr node = graph.get_node(node_id);
+        if (!node) {
+            continue;
+        }
+        for (TensorID tensor_id : node->get_outputs()) {
+            is_graph_output[tensor_id] = true;
+        }
+    }
+
+    // Spill candidates: long-lived, rarely-read buffers (skip connections
+    // and the like). Sorted so the fewest-consumer, largest idle-byte
+    // tensors go first — they free the most RAM per transferred byte.
+    std::vector<TensorID> candidates;
+    for (const auto& [tensor_id, placement] : base.placements) {
+        if (is_graph_output.count(tensor_id)) {
+            continue;
+        }
+        // Need at least one idle step so the fill can overlap compute
+        if (placement.last_use - placement.first_use < 2) {
+            continue;
+        }
+        candidates.push_back(tensor_id);
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [&base, &consumer_steps](TensorID a, TensorID b) {
+                  size_t uses_a = consumer_steps[a].size();
+                  size_t uses_b = consumer_steps[b].size();
+                  if (uses_a != uses_b) {
+                      return uses_a < uses_b;
+                  }
+                  const CMXTensorPlacement& pa = base.placements.at(a);
+                  const CMXTensorPlacement& pb = base.placements.at(b);
+                  size_t idle_a = pa.size * (pa.last_use - pa.first_use);
+                  size_t idle_b = pb.size * (pb.last_use - pb.first_use);
+                  return idle_a > idle_b;
+              });
+
+    // Spill one candidate at a time and re-pack until RAM fits or the
+    // candidate list runs dry (best effort — caller checks arena_size).
+    std::unordered_map<TensorID, bool> spilled;
+    CMXMemoryPlan result;
+    size_t next_candidate = 0;
+
+    while (true) {
+        result = CMXMemoryPlan();
+
+        // Place spilled tensors in the slow tier with the same first-fit
+        for (const auto& [tensor_id, _] : spilled) {
+            CMXTensorPlacement placement = base.placements.at(tensor_id);
+
+            std::vector<const CMXTensorPlacement*> live;
+            for (const auto& [other_id, other] : result.placements) {
+                if (other.arena == 2 &&
+                    other.first_use <= placement.last_use &&
+                    placement.first_use <= other.last_use) {
+                    live.push_back(&other);
+                }
+            }
+
+            placement.offset = first_fit_offset(live, placement.size);
+            placement.arena = 2;
+            result.placements[tensor_id] = placement;
+            result.spill_arena_size = std::max(result.spill_arena_size,
+                                               placement.offset + placement.size);
+        }
+
+        // Pack the residents into main, in the usual first-use order
+        std::vector<TensorID> main_order;
+        for (const auto& [tensor_id, _] : base.placements) {
+            if (!spilled.count(tensor_id)) {
+                main_order.push_back(tensor_id);
+            }
+        }
+        std::sort(main_order.begin(), main_order.end(),
+                  [&base](TensorID a, TensorID b) {
+                      const CMXTensorPlacement& pa = base.placements.at(a);
+                      const CMXTensorPlacement& pb = base.placements.at(b);
+                      if (pa.first_use != pb.first_use) {
+                          return pa.first_use < pb.first_use;
+                      }
+                      return pa.size > pb.size;
+                  });
+
+        for (TensorID tensor_id : main_order) {
+            CMXTensorPlacement placement = base.placements.at(tensor_id);
+
+            std::vector<const CMXTensorPlacement*> live;
+            for (const auto& [other_id, other] : result.placements) {
+                if (other.arena == 0 &&
+                    other.first_use <= placement.last_use &&
+                    placement.first_use <= other.last_use) {
+                    live.push_back(&other);
+                }
+            }
+
+            placement.offset = first_fit_offset(live, placement.size);
+            placement.arena = 0;
+            result.placements[tensor_id] = placement;
+            result.arena_size = std::max(result.arena_size,
+                                         placement.offset + placement.size);
+        }
+
+        if (result.arena_size <= ram_capacity ||
+            next_candidate >= candidates.size()) {
+            break;
+        }
+        spilled[candidates[next_candidate++]] = true;
+    }
+
+    // Emit the async transfer schedule: drain each spilled tensor right
+    // after its producer, stage it back one step ahead of each consumer
+    const uint32_t last_step =
+        order.empty() ? 0 : static_cast<uint32_t>(order.size() - 1);
+    for (const auto& [tensor_id, _] : spilled) {
+        const CMXTensorPlacement& placement = base.placements.at(tensor_id);
+
+        CMXSpillTransfer spill;
+        spill.tensor_id = tensor_id;
+        spill.issue_step = placement.first_use;
+        spill.due_step = std::min(placement.first_use + 1, last_step);
+        spill.is_fill = false;
+        result.spill_transfers.push_back(spill);
+
+        for (uint32_t step : consumer_steps[tensor_id]) {
+            CMXSpillTransfer fill;
+            fill.tensor_id = tensor_id;
+            fill.issue_step = (step > placement.first_use + 1) ? step - 1 : step;
+            fill.due_step = step;
+            fill.is_fill = true;
+            result.spill_transfers.push_back(fill);
+        }
+    }
+    std::sort(result.spill_transfers.begin(), result.spill_transfers.end(),
+              [](const CMXSpillTransfer& a, const CMXSpillTransfer& b) {
+                  return a.issue_step < b.issue_step;
+              });
+
+    return result;
+}
+
+void CMXMemoryPlanner::pad_channel_sizes(
+    const std::unordered_map<TensorID, size_t>& channel_counts,
+    size_t lane_width,
+    std::unordered_map<TensorID, size_t>& tensor_sizes
+) {
+    if (lane_width == 0) {
+        return;
+    }
+
+    for (auto& [tensor_id, size] : tensor_sizes) {
+        auto it = channel_counts.find(tensor_id);
+        if (it == channel_counts.end() || it->second == 0) {
+            continue;
+        }
+
+        size_t channels = it->second;
+        size_t padded = ((channels + lane_width - 1) / lane_width) * lane_width;
+        if (padded == channels) {
+            continue;
+        }
+
+        // N*H*W*C*elem scaled to the padded channel extent; C divides
+        // the packed size exactly, so this stays integer-exact
+        size = size / channels * padded;
+    }
+}
+
+size_t CMXMemoryPlanner::first_fit_offset(
+    const std::vector<const CMXTensorPlacement*>& live,
+    size_t size
+) {
+    std::vector<const CMXTensorPlacement*> sorted = live;
+    std::sort(sorted.begin(), sorted.end(),
+              [](const CMXTensorPlacement* a, const CMXTensorPlacement* b) {
+                  return a->offset < b->offset;
+              });
+
+    size_t candidate = 0;
+    for (const CMXTensorPlacement* placement : sorted) {
+        if (candidate + size <= placement->offset) {
+            break;
+        }
+        candidate = std::max(candidate, placement->offset + placement->size);
+    }
+    return candidate;
+}
+
+} // namespace graph
+} // namespace cmx
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "cmx_graph.hpp"
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace cmx {
+namespace graph {
+
+/**
+ * @brief Placement of a single tensor inside the planned arena
+ */
+struct CMXTensorPlacement {
+    size_t offset;        ///< Byte offset inside the arena
+    size_t size;          ///< Tensor size in bytes (alignment-padded)
+    uint32_t first_use;   ///< Index of producing node in topological order
+    uint32_t last_use;    ///< Index of last consuming node in topological order
+    uint8_t arena;        ///< Arena index: 0 = main, 1 = fast (e.g. DTCM),
+                          ///< 2 = spill (slow tier, e.g. PSRAM)
+};
+
+/**
+ * @brief One scheduled transfer between RAM and the spill tier
+ *
+ * Emitted by plan_spilled() so the executor can drive the transfers
+ * asynchronously, the same way weight streaming overlaps fetches with
+ * compute: a spill drains the tensor out after its producer, a fill is
+ * issued one step ahead of the consumer that needs it back.
+ */
+struct CMXSpillTransfer {
+    TensorID tensor_id;
+    uint32_t issue_step;  ///< Step after which the transfer may start
+    uint32_t due_step;    ///< Step that needs the transfer completed
+    bool is_fill;         ///< true = slow tier -> RAM, false = RAM -> slow tier
+};
+
+/**
+ * @brief Ahead-of-time memory plan for a graph's tensor buffers
+ */
+struct CMXMemoryPlan {
+    size_t arena_size;       ///< Total main arena size in bytes
+    size_t fast_arena_size;  ///< Bytes used in the fast arena (0 if untiered)
+    size_t spill_arena_size; ///< Bytes used in the spill tier (0 if unspilled)
+    std::unordered_map<TensorID, CMXTensorPlacement> placements;
+    std::vector<CMXSpillTransfer> spill_transfers;  ///< Async transfer schedule
+
+    CMXMemoryPlan() : arena_size(0), fast_arena_size(0), spill_arena_size(0) {}
+};
+
+/**
+ * @brief Static memory planner for CMXGraph tensor buffers
+ *
+ * Computes tensor lifetimes from the topological execution order and
+ * packs non-overlapping lifetimes into shared arena space with a greedy
+ * first-fit assignment. The resulting plan is fully static: at runtime
+ * every tensor resolves to arena_base + offset with no per-inference
+ * allocation at all.
+ */
+class CMXMemoryPlanner {
+public:
+    /**
+     * @brief Build a memory plan for the given graph
+     *
+     * Graph output tensors are kept live until the end of execution so
+     * results remain readable after the last node runs.
+     *
+     * @param graph Graph to plan
+     * @param tensor_sizes Byte size of each intermediate tensor; tensors
+     *        absent from the map (e.g. constant weights) are skipped
+     * @param alignment Byte alignment for every placement (power of two)
+     * @return Memory plan with per-tensor offsets and total arena size
+     */
+    static CMXMemoryPlan plan(
+        const CMXGraph& graph,
+        const std::unordered_map<TensorID, size_t>& tensor_sizes,
+        size_t alignment = 16
+    );
+
+    /**
+     * @brief Build a two-tier memory plan with a bounded fast arena
+     *
+     * Splits placements between a small fast arena (DTCM on Cortex-M7,
+     * internal RAM on ESP32) and the main arena. Short-lived buffers —
+     * per-layer scratch and the current layer's activations — are pinned
+     * into the fast arena first, since they carry the most traffic per
+     * byte; whatever does not fit under fast_capacity spills to the
+     * main arena. With fast_capacity of 0 this degenerates to plan().
+     *
+     * @param graph Graph to plan
+     * @param tensor_sizes Byte size of each intermediate tensor
+     * @param fast_capacity Fast arena budget in bytes
+     * @param alignment Byte alignment for every placement (power of two)
+     * @return Memory plan; each placement's arena field selects its tier
+     */
+    static CMXMemoryPlan plan_tiered(
+        const CMXGraph& graph,
+        const std::unordered_map<TensorID, size_t>& tensor_sizes,
+        size_t fast_capacity,
+        size_t alignment = 16
+    );
+
+    /**
+     * @brief Build a plan that fits a RAM budget by spilling to a slow tier
+     *
+     * When the single-arena plan exceeds ram_capacity, low-traffic
+     * activations — large buffers with long idle lifetimes and few
+     * consumers, typically skip connections — are moved to a spill arena
+     * backed by slow memory (ESP32 PSRAM, or external RAM reached through
+     * the DMA backends). Spilled placements carry arena = 2 and the plan
+     * records an async transfer schedule: a spill after the producer
+     * drains the tensor out, and a fill is issued one step before each
+     * consumer so the transfer overlaps the intervening compute, the
+     * same shape as weight streaming. If the budget still cannot be met
+     * after all candidates are spilled the plan is returned best-effort
+     * with arena_size above ram_capacity; callers must check.
+     *
+     * @param graph Graph to plan
+     * @param tensor_sizes Byte size of each intermediate tensor
+     * @param ram_capacity Main arena budget in bytes (0 = unbounded)
+     * @param alignment Byte alignment for every placement (power of two)
+     * @return Memory plan with spill placements and transfer schedule
+     */
+    static CMXMemoryPlan plan_spilled(
+        const CMXGraph& graph,
+        const std::unordered_map<TensorID, size_t>& tensor_sizes,
+        size_t ram_capacity,
+        size_t alignment = 16
+    );
+
+    /**
+     * @brief Round NHWC tensor sizes up to a SIMD-padded channel extent
+     *
+     * Rewrites tensor_sizes entries as if each tensor's channel count
+     * were rounded up to a multiple of lane_width, so the planned
+     * buffers have room for the padded pixel stride that
+     * runtime::CMXTensor::pad_channels() publishes to kernels. Ragged
+     * channel counts (3, 17, ...) otherwise force scalar tails in every
+     * lane-based conv inner loop. The exporter zero-pads weights to the
+     * same lane width, so the extra activation lanes never need
+     * clearing. Tensors absent from channel_counts (non-NHWC, already
+     * aligned weights) are left untouched.
+     *
+     * @param channel_counts Channel dimension of each NHWC tensor
+     * @param lane_width SIMD lane count to round channels up to
+     * @param tensor_sizes Byte sizes to adjust in place
+     */
+    static void pad_channel_sizes(
+        const std::unordered_map<TensorID, size_t>& channel_counts,
+        size_t lane_width,
+        std::unordered_map<TensorID, size_t>& tensor_sizes
+    );
+
+private:
+    /**
+     * @brief Find the lowest offset where a tensor fits without
+     *        overlapping any live placement
+     * @param live Placements whose lifetimes overlap the candidate
+     * @param size Required size in bytes
+     * @return Chosen offset
+     */
+    static size_t first_fit_offset(
+        const std::vector<const CMXTensorPlacement*>& live,
+        size_t size
+    );
+};
+
+} // namespace graph
+} // namespace cmx
@@ -262,6 +262,8 @@ uint64_t CMXNode::get_computation_cost() const {
         case CMXOpType::RELU:
         case CMXOpType::SIGMOID:
         case CMXOpType::TANH:
+        case CMXOpType::HARD_SIGMOID:
+        case CMXOpType::HARD_SWISH:
             return 2;
         
         case CMXOpType::CONV2D:
@@ -350,6 +352,8 @@ std::string op_type_to_string(CMXOpType op_type) {
         case CMXOpType::SIGMOID: return "SIGMOID";
         case CMXOpType::TANH: return "TANH";
         case CMXOpType::SOFTMAX: return "SOFTMAX";
+        case CMXOpType::HARD_SIGMOID: return "HARD_SIGMOID";
+        case CMXOpType::HARD_SWISH: return "HARD_SWISH";
         case CMXOpType::CONV2D: return "CONV2D";
         case CMXOpType::DEPTHWISE_CONV2D: return "DEPTHWISE_CONV2D";
         case CMXOpType::TRANSPOSE_CONV2D: return "TRANSPOSE_CONV2D";
@@ -387,6 +391,8 @@ CMXOpType string_to_op_type(const std::string& op_string) {
     if (op_string == "SIGMOID") return CMXOpType::SIGMOID;
     if (op_string == "TANH") return CMXOpType::TANH;
     if (op_string == "SOFTMAX") return CMXOpType::SOFTMAX;
+    if (op_string == "HARD_SIGMOID") return CMXOpType::HARD_SIGMOID;
+    if (op_string == "HARD_SWISH") return CMXOpType::HARD_SWISH;
     if (op_string == "CONV2D") return CMXOpType::CONV2D;
     if (op_string == "DEPTHWISE_CONV2D") return CMXOpType::DEPTHWISE_CONV2D;
     if (op_string == "TRANSPOSE_CONV2D") return CMXOpType::TRANSPOSE_CONV2D;
@@ -30,6 +30,8 @@ enum class CMXOpType : uint16_t {
     SIGMOID = 11,
     TANH = 12,
     SOFTMAX = 13,
+    HARD_SIGMOID = 14,
+    HARD_SWISH = 15,
     
     // Convolution operations
     CONV2D = 20,
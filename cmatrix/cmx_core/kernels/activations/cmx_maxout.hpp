@@ -28,4 +28,22 @@ void maxout(const float* input, float* output, int input_size, int group_size);
  */
 void maxout_pairs(const float* input, float* output, int input_size);
 
+/**
+ * @brief Apply Maxout over an NHWC tensor, reducing channel groups
+ *
+ * Groups are adjacent channels: output channel g is the maximum of
+ * input channels [g * group_size, (g + 1) * group_size). The common
+ * group_size = 2 case deinterleaves pairs into vector registers and
+ * takes a lane-wise maximum instead of per-element indexed loads.
+ *
+ * @param input Input tensor data, NHWC with channels input channels
+ * @param output Output tensor data, NHWC with channels / group_size
+ *        channels (must not alias input)
+ * @param spatial_size Number of spatial positions (N*H*W)
+ * @param channels Number of input channels (multiple of group_size)
+ * @param group_size Number of channels per group (k)
+ */
+void maxout_nhwc(const float* input, float* output, int spatial_size,
+                 int channels, int group_size);
+
 } // namespace cmx::kernels::activations
\ No newline at end of file
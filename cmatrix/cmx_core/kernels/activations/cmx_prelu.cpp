@@ -5,8 +5,20 @@
 
 #include "cmx_prelu.hpp"
 
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
 namespace cmx::kernels::activations {
 
+namespace {
+
+// Vector width of the packed alpha layout; kept fixed across builds so
+// rows packed by tooling stay valid on scalar targets too
+constexpr int kAlphaVectorWidth = 4;
+
+} // namespace
+
 void prelu(const float* input, float* output, int size, const float* alpha) {
     // PReLU activation: f(x) = x if x > 0, else alpha[i] * x
     for (int i = 0; i < size; ++i) {
@@ -23,4 +35,65 @@ void prelu(const float* input, float* output, int size, float alpha) {
     }
 }
 
-} // namespace cmx::kernels::activations
\ No newline at end of file
+int prelu_packed_alpha_size(int channels) {
+    return ((channels + kAlphaVectorWidth - 1) / kAlphaVectorWidth) *
+           kAlphaVectorWidth;
+}
+
+void prelu_pack_alpha(const float* alpha, int channels, float* packed) {
+    int padded = prelu_packed_alpha_size(channels);
+    for (int c = 0; c < channels; ++c) {
+        packed[c] = alpha[c];
+    }
+    // Zero-padded lanes multiply against min(x, 0) of channels that are
+    // never stored, so their value is irrelevant; zero keeps them inert
+    for (int c = channels; c < padded; ++c) {
+        packed[c] = 0.0f;
+    }
+}
+
+void prelu_pack_alpha(float alpha, int channels, float* packed) {
+    int padded = prelu_packed_alpha_size(channels);
+    for (int c = 0; c < channels; ++c) {
+        packed[c] = alpha;
+    }
+    for (int c = channels; c < padded; ++c) {
+        packed[c] = 0.0f;
+    }
+}
+
+void prelu_nhwc(const float* input, float* output, int spatial_size,
+                int channels, const float* alpha) {
+    // Branch-free per lane: f(x) = max(x, 0) + alpha * min(x, 0)
+#ifdef __ARM_NEON
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    for (int s = 0; s < spatial_size; ++s) {
+        const float* in_row = input + s * channels;
+        float* out_row = output + s * channels;
+
+        int c = 0;
+        for (; c + 4 <= channels; c += 4) {
+            float32x4_t x = vld1q_f32(in_row + c);
+            float32x4_t a = vld1q_f32(alpha + c);
+            float32x4_t pos = vmaxq_f32(x, zero);
+            float32x4_t neg = vminq_f32(x, zero);
+            vst1q_f32(out_row + c, vmlaq_f32(pos, a, neg));
+        }
+        for (; c < channels; ++c) {
+            float x = in_row[c];
+            out_row[c] = (x > 0.0f) ? x : alpha[c] * x;
+        }
+    }
+#else
+    for (int s = 0; s < spatial_size; ++s) {
+        const float* in_row = input + s * channels;
+        float* out_row = output + s * channels;
+        for (int c = 0; c < channels; ++c) {
+            float x = in_row[c];
+            out_row[c] = (x > 0.0f) ? x : alpha[c] * x;
+        }
+    }
+#endif
+}
+
+} // namespace cmx::kernels::activations
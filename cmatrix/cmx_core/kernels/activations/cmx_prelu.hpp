@@ -29,4 +29,49 @@ void prelu(const float* input, float* output, int size, const float* alpha);
  */
 void prelu(const float* input, float* output, int size, float alpha);
 
+/**
+ * @brief Padded length of a packed alpha row
+ * @param channels Number of channels
+ * @return Channel count rounded up to the vector width
+ */
+int prelu_packed_alpha_size(int channels);
+
+/**
+ * @brief Pack per-channel alphas into the row prelu_nhwc streams
+ *
+ * Call once at configure. The row is padded to the vector width so the
+ * kernel's full-width alpha loads never read out of bounds.
+ *
+ * @param alpha Per-channel alpha values
+ * @param channels Number of channels
+ * @param packed Output row of prelu_packed_alpha_size(channels) floats
+ */
+void prelu_pack_alpha(const float* alpha, int channels, float* packed);
+
+/**
+ * @brief Pack a single shared alpha into a broadcast row
+ * @param alpha Alpha value shared by all channels
+ * @param channels Number of channels
+ * @param packed Output row of prelu_packed_alpha_size(channels) floats
+ */
+void prelu_pack_alpha(float alpha, int channels, float* packed);
+
+/**
+ * @brief Apply PReLU over an NHWC tensor with per-channel alphas
+ *
+ * The channel-contiguous layout lets each alpha block load straight
+ * into a vector register once per spatial position, replacing the
+ * per-element indexed alpha reads of the flat variant with lane-wise
+ * select math: f(x) = max(x, 0) + alpha * min(x, 0).
+ *
+ * @param input Input tensor data, NHWC
+ * @param output Output tensor data, NHWC (may alias input)
+ * @param spatial_size Number of spatial positions (N*H*W)
+ * @param channels Number of channels
+ * @param alpha Per-channel alpha row (packed via prelu_pack_alpha,
+ *        or any row of at least channels values)
+ */
+void prelu_nhwc(const float* input, float* output, int spatial_size,
+                int channels, const float* alpha);
+
 } // namespace cmx::kernels::activations
\ No newline at end of file
@@ -5,9 +5,34 @@
 
 #include "cmx_softmax.hpp"
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 namespace cmx::kernels::activations {
 
+namespace {
+
+/**
+ * @brief Fast exponential approximation via the IEEE-754 exponent field
+ *
+ * Schraudolph-style: scales x into the float exponent bits directly.
+ * Branch-free and a handful of integer ops, which lets the surrounding
+ * loops vectorize. Relative error stays under ~2% over the softmax
+ * operating range (inputs are already max-subtracted, so x <= 0).
+ */
+inline float fast_exp(float x) {
+    // Clamp so strongly negative inputs flush to ~0 instead of wrapping
+    if (x < -87.0f) {
+        return 0.0f;
+    }
+    const int32_t i = static_cast<int32_t>(12102203.0f * x) + 1064866805;
+    float f;
+    std::memcpy(&f, &i, sizeof(f));
+    return f;
+}
+
+} // namespace
+
 void softmax(const float* input, float* output, int size) {
     // Softmax with numerical stability: f(x_i) = exp(x_i - max) / Σ(exp(x_j - max))
     
@@ -33,4 +58,31 @@ void softmax(const float* input, float* output, int size) {
     }
 }
 
+void softmax_fast(const float* input, float* output, int size) {
+    if (size <= 0) {
+        return;
+    }
+
+    // Single fused pass: track the running maximum and keep the partial
+    // exponential sum renormalized to it (online softmax recurrence)
+    float running_max = input[0];
+    float running_sum = 1.0f;
+
+    for (int i = 1; i < size; ++i) {
+        const float x = input[i];
+        if (x > running_max) {
+            running_sum = running_sum * fast_exp(running_max - x) + 1.0f;
+            running_max = x;
+        } else {
+            running_sum += fast_exp(x - running_max);
+        }
+    }
+
+    // Branch-free normalization pass
+    const float inv_sum = 1.0f / running_sum;
+    for (int i = 0; i < size; ++i) {
+        output[i] = fast_exp(input[i] - running_max) * inv_sum;
+    }
+}
+
 } // namespace cmx::kernels::activations
\ No newline at end of file
@@ -19,4 +19,23 @@ namespace cmx::kernels::activations {
  */
 void softmax(const float* input, float* output, int size);
 
+/**
+ * @brief Apply Softmax using a fused single-pass max/sum reduction
+ *
+ * Computes the running maximum and the renormalized exponential sum in
+ * one sweep over the input (the "online" softmax recurrence), then
+ * writes the normalized outputs in a second branch-free sweep. Both
+ * loops use a fast exponential approximation and auto-vectorize, so the
+ * routine does two passes instead of the three taken by softmax() and
+ * never calls libm.
+ *
+ * Approximation error is bounded by the fast exp (worst case ~2% per
+ * element); use softmax() where exact probabilities matter.
+ *
+ * @param input Input tensor data
+ * @param output Output tensor data
+ * @param size Number of elements to process
+ */
+void softmax_fast(const float* input, float* output, int size);
+
 } // namespace cmx::kernels::activations
\ No newline at end of file
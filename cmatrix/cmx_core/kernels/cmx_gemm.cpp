@@ -0,0 +1,142 @@
+#include "cmx_gemm.hpp"
+#include "cmx_tune_params.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace cmx {
+namespace kernels {
+
+namespace {
+
+// K-dimension block: panels of this depth are packed into the stack
+// buffers below, so the working set per tile stays a few KB regardless
+// of problem size. Tunable through cmx_tune_params.hpp.
+constexpr int32_t kKC = CMX_GEMM_KC;
+
+/**
+ * @brief Pack up to MR rows of A into a k-major panel
+ *
+ * Layout: panel[p * MR + i] = a[i][k0 + p], zero-padded to a full MR
+ * rows so the microkernel reads it without bounds checks.
+ */
+void pack_a_panel(const float* a, int32_t lda, int32_t rows, int32_t kc,
+                  int32_t k0, float* panel) {
+    for (int32_t p = 0; p < kc; ++p) {
+        for (int32_t i = 0; i < CMX_GEMM_MR; ++i) {
+            panel[p * CMX_GEMM_MR + i] =
+                (i < rows) ? a[i * lda + k0 + p] : 0.0f;
+        }
+    }
+}
+
+/**
+ * @brief Pack up to NR columns of B into a k-major panel
+ *
+ * Layout: panel[p * NR + j] = b[k0 + p][n0 + j], zero-padded to a full
+ * NR columns. Handles both the k x n and the transposed n x k storage.
+ */
+void pack_b_panel(const float* b, int32_t ldb, bool b_transposed,
+                  int32_t cols, int32_t kc, int32_t k0, int32_t n0,
+                  float* panel) {
+    for (int32_t p = 0; p < kc; ++p) {
+        for (int32_t j = 0; j < CMX_GEMM_NR; ++j) {
+            float value = 0.0f;
+            if (j < cols) {
+                value = b_transposed ? b[(n0 + j) * ldb + k0 + p]
+                                     : b[(k0 + p) * ldb + n0 + j];
+            }
+            panel[p * CMX_GEMM_NR + j] = value;
+        }
+    }
+}
+
+#ifndef CMX_GEMM_MICROKERNEL_F32
+/**
+ * @brief Portable C microkernel: acc += a_panel * b_panel
+ *
+ * MR x NR accumulators live in a local array that the compiler keeps in
+ * registers; both panels are read contiguously, one MR-column of A and
+ * one NR-row of B per k step, so the loop auto-vectorizes on SIMD
+ * targets. ISA ports replace this via CMX_GEMM_MICROKERNEL_F32.
+ */
+void microkernel_f32(int32_t kc, const float* a_panel, const float* b_panel,
+                     float* acc) {
+    for (int32_t p = 0; p < kc; ++p) {
+        const float* a_col = a_panel + p * CMX_GEMM_MR;
+        const float* b_row = b_panel + p * CMX_GEMM_NR;
+        for (int32_t i = 0; i < CMX_GEMM_MR; ++i) {
+            const float a_val = a_col[i];
+            for (int32_t j = 0; j < CMX_GEMM_NR; ++j) {
+                acc[i * CMX_GEMM_NR + j] += a_val * b_row[j];
+            }
+        }
+    }
+}
+#endif
+
+} // namespace
+
+void gemm_f32(int32_t m, int32_t n, int32_t k,
+              const float* a, int32_t lda,
+              const float* b, int32_t ldb, bool b_transposed,
+              float* c, int32_t ldc, bool accumulate) {
+    if (m <= 0 || n <= 0 || k <= 0) {
+        return;
+    }
+
+    float panel_a[kKC * CMX_GEMM_MR];
+    float panel_b[kKC * CMX_GEMM_NR];
+
+    for (int32_t k0 = 0; k0 < k; k0 += kKC) {
+        const int32_t kc = std::min(kKC, k - k0);
+        // Results of later k blocks accumulate into C
+        const bool first_block = (k0 == 0) && !accumulate;
+
+        // n-tile outer, m-tile inner: the A panel is packed once per
+        // k block in the common inference case of m <= MR (matvec and
+        // small-batch dense), and the B panel once per (k, n) tile
+        for (int32_t n0 = 0; n0 < n; n0 += CMX_GEMM_NR) {
+            const int32_t cols = std::min<int32_t>(CMX_GEMM_NR, n - n0);
+            pack_b_panel(b, ldb, b_transposed, cols, kc, k0, n0, panel_b);
+
+            for (int32_t m0 = 0; m0 < m; m0 += CMX_GEMM_MR) {
+                const int32_t rows = std::min<int32_t>(CMX_GEMM_MR, m - m0);
+                pack_a_panel(a + m0 * lda, lda, rows, kc, k0, panel_a);
+
+                float acc[CMX_GEMM_MR * CMX_GEMM_NR] = {0.0f};
+#ifdef CMX_GEMM_MICROKERNEL_F32
+                CMX_GEMM_MICROKERNEL_F32(kc, panel_a, panel_b, acc);
+#else
+                microkernel_f32(kc, panel_a, panel_b, acc);
+#endif
+
+                for (int32_t i = 0; i < rows; ++i) {
+                    float* c_row = c + (m0 + i) * ldc + n0;
+                    const float* acc_row = acc + i * CMX_GEMM_NR;
+                    if (first_block) {
+                        for (int32_t j = 0; j < cols; ++j) {
+                            c_row[j] = acc_row[j];
+                        }
+                    } else {
+                        for (int32_t j = 0; j < cols; ++j) {
+                            c_row[j] += acc_row[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void gemv_f32(const float* matrix, const float* vector,
+              int32_t rows, int32_t cols, float* output, bool accumulate) {
+    // output^T = vector^T * matrix^T: a 1 x rows GEMM with B stored
+    // per-output-row, which is exactly the transposed layout
+    gemm_f32(1, rows, cols,
+             vector, cols,
+             matrix, cols, true,
+             output, rows, accumulate);
+}
+
+} // namespace kernels
+} // namespace cmx
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+
+namespace cmx {
+namespace kernels {
+
+/**
+ * @brief Shared register-tiled GEMM core for float kernels
+ *
+ * Single home for the float matrix-multiply hot loop: a blocked,
+ * register-tiled microkernel with panel packing and a portable C
+ * fallback. CmxMatMul, CmxDense, the CmxConv2D pointwise path and the
+ * RNN-family kernels all route their GEMM/matvec work through here, so
+ * a platform tuning effort (or an ISA-specific microkernel) benefits
+ * every operator at once instead of being copy-pasted per layer type.
+ *
+ * Platform ports can supply a specialized inner kernel by defining
+ * CMX_GEMM_MICROKERNEL_F32 to a function with the signature
+ *   void(int32_t kc, const float* a_panel, const float* b_panel,
+ *        float* acc)
+ * where a_panel/b_panel are the packed panels described in cmx_gemm.cpp
+ * and acc is a CMX_GEMM_MR x CMX_GEMM_NR accumulator tile.
+ */
+
+/// Register tile height (rows of C per microkernel call)
+constexpr int32_t CMX_GEMM_MR = 4;
+
+/// Register tile width (columns of C per microkernel call)
+constexpr int32_t CMX_GEMM_NR = 4;
+
+/**
+ * @brief Blocked row-major float GEMM: C = A * B (optionally C += A * B)
+ *
+ * A is m x k with leading dimension lda. B is k x n with leading
+ * dimension ldb, or n x k when b_transposed is set (the layout used for
+ * prepacked per-output-row weights). C is m x n with leading dimension
+ * ldc. Partial edge tiles are handled by zero-padding inside the packed
+ * panels, so the microkernel never sees a remainder loop.
+ *
+ * @param m Number of rows of A and C
+ * @param n Number of columns of B and C
+ * @param k Shared inner dimension
+ * @param a Left operand, row-major
+ * @param lda Leading dimension (row stride) of a
+ * @param b Right operand, row-major
+ * @param ldb Leading dimension (row stride) of b
+ * @param b_transposed Whether b is stored n x k instead of k x n
+ * @param c Output, row-major
+ * @param ldc Leading dimension (row stride) of c
+ * @param accumulate Add into c instead of overwriting it
+ */
+void gemm_f32(int32_t m, int32_t n, int32_t k,
+              const float* a, int32_t lda,
+              const float* b, int32_t ldb, bool b_transposed,
+              float* c, int32_t ldc, bool accumulate);
+
+/**
+ * @brief Matrix-vector convenience wrapper over gemm_f32
+ *
+ * Computes output = matrix * vector (or output += with accumulate) for
+ * a row-major rows x cols matrix, the shape every RNN gate uses.
+ *
+ * @param matrix Row-major weight matrix [rows x cols]
+ * @param vector Input vector [cols]
+ * @param rows Number of output elements
+ * @param cols Number of input elements
+ * @param output Result vector [rows]
+ * @param accumulate Add into output instead of overwriting it
+ */
+void gemv_f32(const float* matrix, const float* vector,
+              int32_t rows, int32_t cols, float* output, bool accumulate);
+
+} // namespace kernels
+} // namespace cmx
@@ -7,12 +7,73 @@
 namespace cmx {
 namespace kernels {
 
+/// Maximum tensor rank a kernel descriptor can carry
+constexpr int32_t kMaxShapeRank = 8;
+
+/**
+ * @brief Fixed-capacity dimension list with inline storage
+ *
+ * Replaces std::vector<int32_t> in shape descriptors so copying a
+ * descriptor — into a configure() chain, a registry cache key, or a
+ * kernel's retained state — never touches the heap. Loading a model
+ * used to perform thousands of small dims allocations; with inline
+ * storage descriptors are flat objects that copy with memcpy-class
+ * cost and cannot fragment the arena-adjacent heap.
+ */
+class ShapeDims {
+public:
+    ShapeDims() : size_(0) {}
+    ShapeDims(std::initializer_list<int32_t> init) : size_(0) {
+        for (int32_t dim : init) push_back(dim);
+    }
+    ShapeDims& operator=(std::initializer_list<int32_t> init) {
+        size_ = 0;
+        for (int32_t dim : init) push_back(dim);
+        return *this;
+    }
+
+    int32_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    int32_t& operator[](int32_t i) { return data_[i]; }
+    int32_t operator[](int32_t i) const { return data_[i]; }
+    int32_t back() const { return data_[size_ - 1]; }
+    int32_t* begin() { return data_; }
+    int32_t* end() { return data_ + size_; }
+    const int32_t* begin() const { return data_; }
+    const int32_t* end() const { return data_ + size_; }
+
+    /// Silently drops dimensions past kMaxShapeRank; rank validation
+    /// belongs to the loader, which rejects such models up front
+    void push_back(int32_t dim) {
+        if (size_ < kMaxShapeRank) data_[size_++] = dim;
+    }
+    void resize(int32_t count) {
+        if (count > kMaxShapeRank) count = kMaxShapeRank;
+        for (int32_t i = size_; i < count; ++i) data_[i] = 0;
+        size_ = count;
+    }
+    void clear() { size_ = 0; }
+
+    bool operator==(const ShapeDims& other) const {
+        if (size_ != other.size_) return false;
+        for (int32_t i = 0; i < size_; ++i) {
+            if (data_[i] != other.data_[i]) return false;
+        }
+        return true;
+    }
+    bool operator!=(const ShapeDims& other) const { return !(*this == other); }
+
+private:
+    int32_t data_[kMaxShapeRank];
+    int32_t size_;
+};
+
 /**
  * @brief Shape descriptor for tensor dimensions
  */
 struct TensorShape {
-    std::vector<int32_t> dims;
-    int32_t rank() const { return static_cast<int32_t>(dims.size()); }
+    ShapeDims dims;
+    int32_t rank() const { return dims.size(); }
     int32_t total_size() const {
         int32_t size = 1;
         for (int32_t dim : dims) size *= dim;
@@ -40,6 +101,73 @@ struct TensorDescriptor {
     int32_t size_bytes() const;
 };
 
+/// Maximum inputs or outputs one kernel dispatch can name
+constexpr int32_t kMaxKernelIO = 8;
+
+/**
+ * @brief Fixed-capacity descriptor list with inline storage
+ *
+ * Owning counterpart of DescriptorSpan: the pool storage a builder
+ * (loader, registry cache, test harness) assembles descriptors into.
+ * Capacity is kMaxKernelIO; like ShapeDims, overflow is dropped rather
+ * than grown, and the loader enforces the limit on model ingest.
+ */
+class DescriptorList {
+public:
+    DescriptorList() : size_(0) {}
+
+    int32_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    TensorDescriptor& operator[](int32_t i) { return descs_[i]; }
+    const TensorDescriptor& operator[](int32_t i) const { return descs_[i]; }
+    TensorDescriptor* begin() { return descs_; }
+    TensorDescriptor* end() { return descs_ + size_; }
+    const TensorDescriptor* begin() const { return descs_; }
+    const TensorDescriptor* end() const { return descs_ + size_; }
+
+    void push_back(const TensorDescriptor& desc) {
+        if (size_ < kMaxKernelIO) descs_[size_++] = desc;
+    }
+    void resize(int32_t count) {
+        if (count > kMaxKernelIO) count = kMaxKernelIO;
+        for (int32_t i = size_; i < count; ++i) descs_[i] = TensorDescriptor{};
+        size_ = count;
+    }
+    void clear() { size_ = 0; }
+
+private:
+    TensorDescriptor descs_[kMaxKernelIO];
+    int32_t size_;
+};
+
+/**
+ * @brief Non-owning read view over contiguous tensor descriptors
+ *
+ * configure() chains pass descriptors through this view instead of
+ * std::vector, so intermediate stages neither allocate nor copy.
+ * Converts implicitly from DescriptorList and from existing vectors.
+ */
+class DescriptorSpan {
+public:
+    DescriptorSpan() : data_(nullptr), size_(0) {}
+    DescriptorSpan(const TensorDescriptor* data, int32_t count)
+        : data_(data), size_(count) {}
+    DescriptorSpan(const DescriptorList& list)
+        : data_(list.begin()), size_(list.size()) {}
+    DescriptorSpan(const std::vector<TensorDescriptor>& vec)
+        : data_(vec.data()), size_(static_cast<int32_t>(vec.size())) {}
+
+    int32_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const TensorDescriptor& operator[](int32_t i) const { return data_[i]; }
+    const TensorDescriptor* begin() const { return data_; }
+    const TensorDescriptor* end() const { return data_ + size_; }
+
+private:
+    const TensorDescriptor* data_;
+    int32_t size_;
+};
+
 /**
  * @brief Configuration status enumeration
  */
@@ -67,16 +195,19 @@ public:
      * 
      * This method should validate parameters, compute output shapes, and
      * prepare any internal state required for execution. No memory allocation
-     * should occur during inference after this call.
-     * 
-     * @param inputs Vector of input tensor descriptors
-     * @param outputs Vector of output tensor descriptors (may be modified)
+     * should occur during inference after this call. Descriptors arrive
+     * as a span over the caller's pool storage and outputs are written
+     * into a fixed-capacity list, so the configure path itself performs
+     * no heap allocation.
+     *
+     * @param inputs Span of input tensor descriptors
+     * @param outputs Fixed-capacity list receiving output descriptors
      * @param params Layer-specific parameters as void pointer
      * @return KernelStatus indicating success or failure
      */
     virtual KernelStatus configure(
-        const std::vector<TensorDescriptor>& inputs,
-        std::vector<TensorDescriptor>& outputs,
+        DescriptorSpan inputs,
+        DescriptorList& outputs,
         const void* params
     ) = 0;
 
@@ -131,6 +262,71 @@ public:
      */
     virtual int32_t get_workspace_size() const { return 0; }
 
+    /**
+     * @brief Check if the kernel can write its result over its input
+     *
+     * Element-wise kernels (activations, bias addition) that read each
+     * input element exactly once before writing the corresponding output
+     * element should return true. The graph executor uses this capability
+     * to alias input and output buffers, eliminating one intermediate
+     * tensor per in-place node during memory planning.
+     *
+     * @return True if run() accepts inputs[0] == outputs[0]
+     */
+    virtual bool supports_inplace() const { return false; }
+
+    /**
+     * @brief Check if the kernel writes every output element
+     *
+     * Kernels that fully overwrite their outputs (conv, dense,
+     * activations) should return true so the executor can skip the
+     * defensive zero-fill of output buffers before run(). Kernels that
+     * write sparsely must keep the default.
+     *
+     * @return True if run() leaves no output element untouched
+     */
+    virtual bool writes_all_outputs() const { return false; }
+
+    /**
+     * @brief Extent of the kernel's splittable output dimension
+     *
+     * Kernels whose output elements are independent along one dimension
+     * (output channels for conv, output units for dense) report its
+     * extent here so the scheduler can partition a single layer into
+     * range tasks and run the slices on separate cores. Kernels that
+     * cannot be partitioned return 0.
+     *
+     * @return Number of independent slices, or 0 if not splittable
+     */
+    virtual int32_t split_extent() const { return 0; }
+
+    /**
+     * @brief Execute the kernel over a slice of the splittable dimension
+     *
+     * Computes output elements in [begin, end) of the dimension reported
+     * by split_extent(). Slices touch disjoint output ranges and share
+     * only read-only state, so concurrent calls with non-overlapping
+     * ranges are safe. The default accepts only the full range and
+     * forwards to run().
+     *
+     * @param inputs Array of input tensor data pointers
+     * @param outputs Array of output tensor data pointers
+     * @param begin First slice index (inclusive)
+     * @param end Last slice index (exclusive)
+     * @return KernelStatus indicating success or failure
+     */
+    virtual KernelStatus run_split(
+        const void* const* inputs,
+        void* const* outputs,
+        int32_t begin,
+        int32_t end
+    ) {
+        if (begin == 0 && end == split_extent()) {
+            return run(inputs, outputs);
+        }
+        return KernelStatus::INVALID_PARAMS;
+    }
+
 protected:
     /**
      * @brief Validate input tensor count
@@ -138,9 +334,9 @@ protected:
      * @param expected_count Expected number of inputs
      * @return True if count matches, false otherwise
      */
-    bool validate_input_count(const std::vector<TensorDescriptor>& inputs, 
+    bool validate_input_count(DescriptorSpan inputs,
                              int32_t expected_count) const {
-        return static_cast<int32_t>(inputs.size()) == expected_count;
+        return inputs.size() == expected_count;
     }
 
     /**
@@ -149,9 +345,9 @@ protected:
      * @param expected_count Expected number of outputs
      * @return True if count matches, false otherwise
      */
-    bool validate_output_count(const std::vector<TensorDescriptor>& outputs, 
+    bool validate_output_count(DescriptorSpan outputs,
                               int32_t expected_count) const {
-        return static_cast<int32_t>(outputs.size()) == expected_count;
+        return outputs.size() == expected_count;
     }
 };
 
@@ -160,5 +356,163 @@ protected:
  */
 using KernelFactory = std::unique_ptr<CmxKernel>(*)();
 
+/**
+ * @brief Compile-time composable kernel epilogues
+ *
+ * Each stage is a functor mapping one accumulator value (plus its
+ * channel index, for per-channel stages like bias) to an output value.
+ * Compose<> chains stages left to right into a single functor a kernel
+ * can take as a template parameter and apply at its store point, so a
+ * fused bias + requantize + clamp costs zero branches in the inner loop.
+ * The model compiler picks which compositions to instantiate; adding a
+ * new fusion is a new instantiation, not a kernel rewrite.
+ */
+namespace epilogue {
+
+/** @brief Pass-through stage */
+struct Identity {
+    float operator()(float x, int32_t) const { return x; }
+};
+
+/** @brief max(0, x) */
+struct Relu {
+    float operator()(float x, int32_t) const { return x > 0.0f ? x : 0.0f; }
+};
+
+/** @brief min(6, max(0, x)) */
+struct Relu6 {
+    float operator()(float x, int32_t) const {
+        x = x > 0.0f ? x : 0.0f;
+        return x < 6.0f ? x : 6.0f;
+    }
+};
+
+/** @brief x for x >= 0, alpha * x otherwise */
+struct LeakyRelu {
+    float alpha;
+    float operator()(float x, int32_t) const { return x > 0.0f ? x : alpha * x; }
+};
+
+/** @brief max(0, min(1, 0.2 * x + 0.5)), matching activations::hard_sigmoid */
+struct HardSigmoid {
+    float operator()(float x, int32_t) const {
+        const float y = 0.2f * x + 0.5f;
+        return y < 0.0f ? 0.0f : (y > 1.0f ? 1.0f : y);
+    }
+};
+
+/** @brief x * hard_sigmoid(x), the MobileNetV3 epilogue */
+struct HardSwish {
+    float operator()(float x, int32_t) const {
+        const float y = 0.2f * x + 0.5f;
+        return x * (y < 0.0f ? 0.0f : (y > 1.0f ? 1.0f : y));
+    }
+};
+
+/** @brief Clamp to [lo, hi] */
+struct Clamp {
+    float lo;
+    float hi;
+    float operator()(float x, int32_t) const {
+        return x < lo ? lo : (x > hi ? hi : x);
+    }
+};
+
+/** @brief Per-channel bias addition; bias must outlive the kernel run */
+struct Bias {
+    const float* bias;
+    float operator()(float x, int32_t channel) const { return x + bias[channel]; }
+};
+
+/** @brief Uniform requantize step: x * scale + offset */
+struct Requantize {
+    float scale;
+    float offset;
+    float operator()(float x, int32_t) const { return x * scale + offset; }
+};
+
+/** @brief Per-channel requantize for channelwise-quantized weights */
+struct RequantizePerChannel {
+    const float* scales;
+    const float* offsets;
+    float operator()(float x, int32_t channel) const {
+        return x * scales[channel] + offsets[channel];
+    }
+};
+
+/**
+ * @brief Chain of epilogue stages applied left to right
+ *
+ * Compose<Bias, Relu6>{{bias_ptr}, {}} applies the bias first, then the
+ * clamp. An empty Compose<> is the identity, so unfused instantiations
+ * pay nothing.
+ */
+template <typename... Stages>
+struct Compose;
+
+template <>
+struct Compose<> {
+    float operator()(float x, int32_t) const { return x; }
+};
+
+template <typename First, typename... Rest>
+struct Compose<First, Rest...> {
+    First first;
+    Compose<Rest...> rest;
+
+    Compose() = default;
+    explicit Compose(First f, Rest... r) : first(f), rest(r...) {}
+
+    float operator()(float x, int32_t channel) const {
+        return rest(first(x, channel), channel);
+    }
+};
+
+/**
+ * @brief Apply an epilogue over a buffer of channel-minor elements
+ *
+ * For kernels that cannot fold the epilogue into their store point yet:
+ * one pass over `count` elements whose fastest-varying index cycles
+ * through `channels` (NHWC), feeding each stage its channel index.
+ */
+template <typename Epilogue>
+inline void apply_epilogue(const Epilogue& ep, float* data, int32_t count,
+                           int32_t channels) {
+    int32_t c = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        data[i] = ep(data[i], c);
+        if (++c == channels) {
+            c = 0;
+        }
+    }
+}
+
+} // namespace epilogue
+
+/**
+ * @brief Bound arguments for one partitioned kernel dispatch
+ *
+ * The scheduler's range tasks carry a single context pointer; this
+ * struct packages the kernel and its tensor pointers so a slice can be
+ * dispatched through cmx_kernel_range_task. The job must outlive all
+ * tasks submitted against it.
+ */
+struct KernelRangeJob {
+    CmxKernel* kernel;
+    const void* const* inputs;
+    void* const* outputs;
+};
+
+/**
+ * @brief Range-task trampoline running one kernel slice
+ *
+ * Signature matches runtime::RangeTaskFn so a KernelRangeJob can be
+ * handed straight to CMXScheduler::submit_range_tasks.
+ */
+inline void cmx_kernel_range_task(void* context, int32_t begin, int32_t end) {
+    KernelRangeJob* job = static_cast<KernelRangeJob*>(context);
+    job->kernel->run_split(job->inputs, job->outputs, begin, end);
+}
+
 } // namespace kernels
 } // namespace cmx
\ No newline at end of file
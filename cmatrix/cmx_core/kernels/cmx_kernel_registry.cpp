@@ -38,6 +38,90 @@ bool CmxKernelRegistry::register_kernel(
     return true;
 }
 
+bool CmxKernelRegistry::ConfiguredKey::operator==(const ConfiguredKey& other) const {
+    if (type != other.type || params != other.params ||
+        inputs.size() != other.inputs.size()) {
+        return false;
+    }
+    for (int32_t i = 0; i < inputs.size(); ++i) {
+        if (inputs[i].dtype != other.inputs[i].dtype ||
+            inputs[i].shape.dims != other.inputs[i].shape.dims) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t CmxKernelRegistry::ConfiguredKeyHash::operator()(const ConfiguredKey& key) const {
+    // FNV-1a over the kernel type, input descriptors and parameter bytes
+    size_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](uint64_t value) {
+        hash = (hash ^ value) * 1099511628211ULL;
+    };
+
+    mix(static_cast<uint64_t>(key.type));
+    for (const TensorDescriptor& input : key.inputs) {
+        mix(static_cast<uint64_t>(input.dtype));
+        for (int32_t dim : input.shape.dims) {
+            mix(static_cast<uint64_t>(dim));
+        }
+    }
+    for (uint8_t byte : key.params) {
+        mix(byte);
+    }
+
+    return hash;
+}
+
+CmxKernel* CmxKernelRegistry::acquire_configured(
+    KernelType type,
+    DescriptorSpan inputs,
+    DescriptorList& outputs,
+    const void* params,
+    size_t params_size
+) {
+    ConfiguredKey key;
+    key.type = type;
+    for (const TensorDescriptor& input : inputs) {
+        key.inputs.push_back(input);
+    }
+    if (params && params_size > 0) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(params);
+        key.params.assign(bytes, bytes + params_size);
+    }
+
+    auto it = configured_cache_.find(key);
+    if (it != configured_cache_.end()) {
+        outputs = it->second.outputs;
+        return it->second.kernel.get();
+    }
+
+    std::unique_ptr<CmxKernel> kernel = create_kernel(type);
+    if (!kernel) {
+        return nullptr;
+    }
+
+    outputs.clear();
+    if (kernel->configure(inputs, outputs, params) != KernelStatus::SUCCESS) {
+        return nullptr;
+    }
+
+    ConfiguredEntry entry;
+    entry.kernel = std::move(kernel);
+    entry.outputs = outputs;
+
+    auto inserted = configured_cache_.emplace(std::move(key), std::move(entry));
+    return inserted.first->second.kernel.get();
+}
+
+void CmxKernelRegistry::clear_configured_cache() {
+    configured_cache_.clear();
+}
+
+size_t CmxKernelRegistry::get_configured_cache_size() const {
+    return configured_cache_.size();
+}
+
 std::unique_ptr<CmxKernel> CmxKernelRegistry::create_kernel(KernelType type) {
     auto it = type_registry_.find(type);
     if (it != type_registry_.end() && capabilities_satisfied(it->second.required_capabilities)) {
@@ -102,9 +186,11 @@ const char* CmxKernelRegistry::type_to_string(KernelType type) {
         case KernelType::POOLING: return "pooling";
         case KernelType::MATMUL: return "matmul";
         case KernelType::NORMALIZATION: return "normalization";
+        case KernelType::ELEMENTWISE: return "elementwise";
         case KernelType::LSTM: return "lstm";
         case KernelType::GRU: return "gru";
         case KernelType::RNN: return "rnn";
+        case KernelType::PREPROCESS: return "preprocess";
         default: return "unknown";
     }
 }
@@ -118,9 +204,11 @@ KernelType CmxKernelRegistry::string_to_type(const std::string& name) {
     if (name == "pooling") return KernelType::POOLING;
     if (name == "matmul") return KernelType::MATMUL;
     if (name == "normalization") return KernelType::NORMALIZATION;
+    if (name == "elementwise") return KernelType::ELEMENTWISE;
     if (name == "lstm") return KernelType::LSTM;
     if (name == "gru") return KernelType::GRU;
     if (name == "rnn") return KernelType::RNN;
+    if (name == "preprocess") return KernelType::PREPROCESS;
     return KernelType::UNKNOWN;
 }
 
@@ -146,13 +234,19 @@ uint32_t CmxKernelRegistry::detect_hardware_capabilities() {
     #ifdef __ARM_FP
     capabilities |= static_cast<uint32_t>(HardwareCapability::FPU);
     #endif
+
+    // Integer MVE (Helium) on Cortex-M55/M85
+    #if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+    capabilities |= static_cast<uint32_t>(HardwareCapability::HELIUM);
+    #endif
     
     #ifdef __XTENSA__
     capabilities |= static_cast<uint32_t>(HardwareCapability::XTENSA);
     #endif
     
     // Check for SIMD support
-    #if defined(__ARM_NEON) || defined(__XTENSA__)
+    #if defined(__ARM_NEON) || defined(__XTENSA__) || \
+        (defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1))
     capabilities |= static_cast<uint32_t>(HardwareCapability::SIMD);
     #endif
     
@@ -20,9 +20,11 @@ enum class KernelType {
     POOLING,
     MATMUL,
     NORMALIZATION,
+    ELEMENTWISE,
     LSTM,
     GRU,
     RNN,
+    PREPROCESS,
     UNKNOWN
 };
 
@@ -35,7 +37,8 @@ enum class HardwareCapability {
     XTENSA = 1 << 1,
     CMSIS_DSP = 1 << 2,
     FPU = 1 << 3,
-    SIMD = 1 << 4
+    SIMD = 1 << 4,
+    HELIUM = 1 << 5
 };
 
 /**
@@ -93,6 +96,50 @@ public:
      */
     std::unique_ptr<CmxKernel> create_kernel(const std::string& name);
 
+    /**
+     * @brief Get or create a configured kernel instance for a configuration
+     *
+     * Looks up a cached instance keyed by (kernel type, input descriptors,
+     * raw parameter bytes). On a miss the instance is created through the
+     * registered factory, configured once, and retained by the registry;
+     * subsequent calls with the same configuration return the same
+     * instance with its configure-time state (validated parameters,
+     * computed output shapes, prepacked weights) intact. Identical layers
+     * within one model — or across models in a multi-model deployment —
+     * therefore share one instance and pay configuration cost once.
+     *
+     * The returned pointer is owned by the registry and stays valid until
+     * clear_configured_cache(). Callers must not reconfigure it. Like the
+     * rest of the registry, the cache is populated from a single thread;
+     * concurrent run() calls on the shared instance are safe per the
+     * CmxKernel contract.
+     *
+     * @param type Kernel type identifier
+     * @param inputs Input tensor descriptors
+     * @param outputs Receives the configured output descriptors
+     * @param params Layer-specific parameters as raw bytes
+     * @param params_size Size of the parameter block in bytes
+     * @return Configured kernel instance, nullptr on factory or configure failure
+     */
+    CmxKernel* acquire_configured(
+        KernelType type,
+        DescriptorSpan inputs,
+        DescriptorList& outputs,
+        const void* params,
+        size_t params_size
+    );
+
+    /**
+     * @brief Release all cached configured kernel instances
+     */
+    void clear_configured_cache();
+
+    /**
+     * @brief Get number of cached configured kernel instances
+     * @return Cached instance count
+     */
+    size_t get_configured_cache_size() const;
+
     /**
      * @brief Check if a kernel type is supported
      * @param type Kernel type identifier
@@ -157,11 +204,34 @@ private:
     struct KernelEntry {
         KernelFactory factory;
         uint32_t required_capabilities;
-        
-        KernelEntry(KernelFactory f, uint32_t caps) 
+
+        KernelEntry(KernelFactory f, uint32_t caps)
             : factory(f), required_capabilities(caps) {}
     };
 
+    /**
+     * @brief Full configuration key for the configured-instance cache
+     *
+     * The parameter block is kept as raw bytes so the key works for any
+     * kernel's params struct without the registry knowing its layout.
+     */
+    struct ConfiguredKey {
+        KernelType type;
+        DescriptorList inputs;
+        std::vector<uint8_t> params;
+
+        bool operator==(const ConfiguredKey& other) const;
+    };
+
+    struct ConfiguredKeyHash {
+        size_t operator()(const ConfiguredKey& key) const;
+    };
+
+    struct ConfiguredEntry {
+        std::unique_ptr<CmxKernel> kernel;
+        DescriptorList outputs;
+    };
+
     CmxKernelRegistry() = default;
     ~CmxKernelRegistry() = default;
     
@@ -184,6 +254,8 @@ private:
 
     std::unordered_map<KernelType, KernelEntry> type_registry_;
     std::unordered_map<std::string, KernelEntry> name_registry_;
+    std::unordered_map<ConfiguredKey, ConfiguredEntry, ConfiguredKeyHash>
+        configured_cache_;
     uint32_t hardware_capabilities_ = 0;
 };
 
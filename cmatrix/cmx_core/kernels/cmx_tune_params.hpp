@@ -0,0 +1,28 @@
+#pragma once
+
+/**
+ * @brief Tunable tile/unroll parameters for the blocked kernels
+ *
+ * Defaults below are safe middle-ground values. Boards differ enough
+ * (M4 without cache, M7 with 32KB D-cache, ESP32 with PSRAM) that the
+ * right tiles vary per model and target, so the cmx_autotune harness
+ * sweeps them on-device and cmx_tools/compile/autotune_capture.py
+ * turns the winners into a cmx_tune_config.hpp; build with
+ * -DCMX_HAVE_TUNE_CONFIG (and the header on the include path) to use
+ * it. Every parameter stays overridable with a plain -D flag.
+ */
+
+#ifdef CMX_HAVE_TUNE_CONFIG
+#include "cmx_tune_config.hpp"  // generated per model/board by autotune capture
+#endif
+
+/// Square block edge of the dense blocked matmul (output x input units)
+#ifndef CMX_DENSE_BLOCK_SIZE
+#define CMX_DENSE_BLOCK_SIZE 64
+#endif
+
+/// K-dimension block depth of the shared GEMM core (cmx_gemm.cpp);
+/// inherits the tuned dense block size unless overridden separately
+#ifndef CMX_GEMM_KC
+#define CMX_GEMM_KC CMX_DENSE_BLOCK_SIZE
+#endif
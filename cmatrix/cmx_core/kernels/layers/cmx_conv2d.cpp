@@ -1,5 +1,9 @@
 #include "cmx_conv2d.hpp"
 #include "cmx_kernel_registry.hpp"
+#include "../../ops/cmx_op_manifest.hpp"
+#include "../cmx_gemm.hpp"
+#include "../../utils/cmx_quantization.hpp"
+#include "../../utils/cmx_fp16.hpp"
 #include <cstring>
 #include <algorithm>
 #include <cmath>
@@ -8,6 +12,34 @@
 #include "arm_math.h"
 #endif
 
+#ifdef CMX_USE_CMSIS_NN
+#include "arm_nnfunctions.h"
+#endif
+
+#ifdef CMX_USE_HELIUM
+#include "../../platform/cortex-m/cmx_cortex_m_mve.hpp"
+#endif
+
+#ifdef CMX_USE_DSP_EXT
+#include "../../platform/cortex-m/cmx_cortex_m_dsp.hpp"
+#endif
+
+#ifdef CMX_USE_RVV
+#include "../../platform/riscv/cmx_riscv_vector.hpp"
+#endif
+
+#ifdef CMX_USE_HIFI
+#include "../../platform/xtensa/cmx_xtensa_hifi.hpp"
+#endif
+
+#ifdef CMX_USE_PIE
+#include "../../platform/xtensa/cmx_xtensa_pie.hpp"
+#endif
+
+#ifdef CMX_USE_PLATFORM_MAC
+#include "../../platform/cmx_platform_abstraction.hpp"
+#endif
+
 namespace cmx {
 namespace kernels {
 
@@ -17,24 +49,515 @@ struct CmxConv2D::Conv2DImpl {
     TensorDescriptor weight_desc;
     TensorDescriptor bias_desc;
     TensorDescriptor output_desc;
-    
+
     // Computed values
     int32_t batch_size;
     int32_t input_height;
     int32_t input_width;
     int32_t output_height;
     int32_t output_width;
-    
+
+    // Padding resolved at configure time (SAME mode folded in)
+    int32_t resolved_pad_top;
+    int32_t resolved_pad_left;
+
     // Workspace requirements
     int32_t workspace_size;
-    
-    // Optimized kernel function pointer
-    void (*kernel_func)(const float*, const float*, const float*, float*, 
-                       const Conv2DParams&, const Conv2DImpl&);
-    
-    Conv2DImpl() : workspace_size(0), kernel_func(nullptr) {}
+
+    // Optimized kernel function pointer; computes output channels
+    // [oc_begin, oc_end) so a layer can be partitioned into range tasks
+    using KernelFn = void (*)(const float*, const float*, const float*, float*,
+                              const Conv2DParams&, const Conv2DImpl&,
+                              int32_t, int32_t);
+    KernelFn kernel_func;
+
+    // Winograd F(2x2, 3x3) transformed weights, 16 values per (oc, ic)
+    // pair. Filled once on first run() and reused for every inference.
+    std::vector<float> winograd_weights;
+    bool winograd_ready;
+
+    // Clustered weights expanded through the palette, filled once on
+    // first run() like the Winograd transform. The indices stay in
+    // flash; this is the only RAM the palette format costs.
+    std::vector<float> expanded_weights;
+    bool palette_ready;
+
+    Conv2DImpl() : resolved_pad_top(0), resolved_pad_left(0),
+                   workspace_size(0), kernel_func(nullptr),
+                   winograd_ready(false), palette_ready(false) {}
+
+    /**
+     * @brief Direct NHWC convolution kernel without im2col materialization
+     *
+     * Walks the input tensor in place and accumulates each output element
+     * directly, so no column buffer is required. This keeps the workspace
+     * footprint at zero, which matters on parts where the im2col matrix
+     * would exceed the activation memory itself.
+     *
+     * Instantiated once per configuration variant: kPadded, kDilated and
+     * kBias are template constants, so the compiled loops carry no
+     * per-iteration parameter tests and the dilation multiplies and
+     * padding offsets fold away in the common unit/unpadded cases.
+     * select_direct_nhwc() maps a configuration onto the matching
+     * instantiation.
+     */
+    template <bool kPadded, bool kDilated, bool kBias>
+    static void direct_nhwc(
+        const float* input,
+        const float* weights,
+        const float* bias,
+        float* output,
+        const Conv2DParams& p,
+        const Conv2DImpl& impl,
+        int32_t oc_begin,
+        int32_t oc_end
+    );
+
+    /**
+     * @brief Pick the direct NHWC variant matching a configuration
+     *
+     * Padding selection looks only at the top/left offsets; explicit
+     * bottom/right overhang is handled by the checked border rows that
+     * every variant retains, so a conservative pick stays correct.
+     */
+    static KernelFn select_direct_nhwc(const Conv2DParams& p,
+                                       const Conv2DImpl& impl);
+
+    /**
+     * @brief Winograd F(2x2, 3x3) NHWC convolution kernel
+     *
+     * Processes 2x2 output tiles from 4x4 input tiles using the
+     * precomputed transformed weights in winograd_weights. Reduces the
+     * multiply count per output from 9 to 4 for stride-1 3x3 filters.
+     */
+    static void winograd_nhwc(
+        const float* input,
+        const float* weights,
+        const float* bias,
+        float* output,
+        const Conv2DParams& p,
+        const Conv2DImpl& impl,
+        int32_t oc_begin,
+        int32_t oc_end
+    );
+
+    /**
+     * @brief One-time Winograd weight transform U = G g G^T
+     * @param weights Raw OHWI weight data
+     */
+    void transform_winograd_weights(const float* weights);
+
+    /**
+     * @brief One-time palette expansion of clustered weights
+     *
+     * Index rows are packed two per byte and byte-aligned per output
+     * channel, matching the dense int4 convention.
+     *
+     * @param indices Packed 4-bit palette indices
+     */
+    void expand_clustered_weights(const uint8_t* indices);
+
+    /**
+     * @brief 1x1 NHWC convolution lowered to a plain GEMM
+     *
+     * A pointwise convolution is exactly a [B*H*W x Cin] by [Cin x Cout]
+     * matrix product, so the kernel runs the flat GEMM loop with fully
+     * contiguous reads on both operands and none of the spatial window
+     * bookkeeping of the general path.
+     */
+    static void pointwise_nhwc(
+        const float* input,
+        const float* weights,
+        const float* bias,
+        float* output,
+        const Conv2DParams& p,
+        const Conv2DImpl& impl,
+        int32_t oc_begin,
+        int32_t oc_end
+    );
 };
 
+void CmxConv2D::Conv2DImpl::pointwise_nhwc(
+    const float* input,
+    const float* weights,
+    const float* bias,
+    float* output,
+    const Conv2DParams& p,
+    const Conv2DImpl& impl,
+    int32_t oc_begin,
+    int32_t oc_end
+) {
+    // Output spatial size equals input spatial size for 1x1 stride-1
+    const int32_t rows = impl.batch_size * impl.output_height * impl.output_width;
+
+    // 1x1 convolution is a plain GEMM over the pixel rows: route it
+    // through the shared register-tiled core. Weights are stored one
+    // row per output channel, i.e. the transposed B layout.
+    gemm_f32(rows, oc_end - oc_begin, p.input_channels,
+             input, p.input_channels,
+             weights + static_cast<size_t>(oc_begin) * p.input_channels,
+             p.input_channels, true,
+             output + oc_begin, p.output_channels, false);
+
+    if (bias) {
+        for (int32_t row = 0; row < rows; ++row) {
+            float* output_pixel = output + static_cast<size_t>(row) * p.output_channels;
+            for (int32_t oc = oc_begin; oc < oc_end; ++oc) {
+                output_pixel[oc] += bias[oc];
+            }
+        }
+    }
+}
+
+void CmxConv2D::Conv2DImpl::transform_winograd_weights(const float* weights) {
+    // G is the 4x3 filter transform matrix for F(2x2, 3x3)
+    static const float G[4][3] = {
+        {1.0f,  0.0f, 0.0f},
+        {0.5f,  0.5f, 0.5f},
+        {0.5f, -0.5f, 0.5f},
+        {0.0f,  0.0f, 1.0f}
+    };
+
+    winograd_weights.resize(
+        static_cast<size_t>(params.output_channels) * params.input_channels * 16);
+
+    for (int32_t oc = 0; oc < params.output_channels; ++oc) {
+        for (int32_t ic = 0; ic < params.input_channels; ++ic) {
+            // Gather the 3x3 filter for this (oc, ic) pair from OHWI layout
+            float g[3][3];
+            for (int32_t kh = 0; kh < 3; ++kh) {
+                for (int32_t kw = 0; kw < 3; ++kw) {
+                    g[kh][kw] = weights[
+                        ((oc * 3 + kh) * 3 + kw) * params.input_channels + ic];
+                }
+            }
+
+            // temp = G * g (4x3)
+            float temp[4][3];
+            for (int32_t i = 0; i < 4; ++i) {
+                for (int32_t j = 0; j < 3; ++j) {
+                    temp[i][j] = G[i][0] * g[0][j] + G[i][1] * g[1][j] +
+                                 G[i][2] * g[2][j];
+                }
+            }
+
+            // U = temp * G^T (4x4)
+            float* u = &winograd_weights[
+                (static_cast<size_t>(oc) * params.input_channels + ic) * 16];
+            for (int32_t i = 0; i < 4; ++i) {
+                for (int32_t j = 0; j < 4; ++j) {
+                    u[i * 4 + j] = temp[i][0] * G[j][0] + temp[i][1] * G[j][1] +
+                                   temp[i][2] * G[j][2];
+                }
+            }
+        }
+    }
+
+    winograd_ready = true;
+}
+
+void CmxConv2D::Conv2DImpl::expand_clustered_weights(const uint8_t* indices) {
+    const int32_t group_ic = params.input_channels / params.groups;
+    const int32_t row_elems =
+        params.kernel_height * params.kernel_width * group_ic;
+    const int32_t row_bytes = (row_elems + 1) / 2;
+
+    expanded_weights.resize(
+        static_cast<size_t>(params.output_channels) * row_elems);
+
+    for (int32_t oc = 0; oc < params.output_channels; ++oc) {
+        utils::expand_palette_weights(
+            indices + static_cast<size_t>(oc) * row_bytes,
+            params.weight_palette,
+            expanded_weights.data() + static_cast<size_t>(oc) * row_elems,
+            row_elems);
+    }
+
+    palette_ready = true;
+}
+
+void CmxConv2D::Conv2DImpl::winograd_nhwc(
+    const float* input,
+    const float* weights,
+    const float* bias,
+    float* output,
+    const Conv2DParams& p,
+    const Conv2DImpl& impl,
+    int32_t oc_begin,
+    int32_t oc_end
+) {
+    (void)weights;  // Transformed copies are used instead
+
+    const int32_t input_row_stride = impl.input_width * p.input_channels;
+    const int32_t tiles_h = (impl.output_height + 1) / 2;
+    const int32_t tiles_w = (impl.output_width + 1) / 2;
+
+    for (int32_t b = 0; b < impl.batch_size; ++b) {
+        const float* input_batch = input +
+            b * impl.input_height * input_row_stride;
+        float* output_batch = output +
+            b * impl.output_height * impl.output_width * p.output_channels;
+
+        for (int32_t th = 0; th < tiles_h; ++th) {
+            for (int32_t tw = 0; tw < tiles_w; ++tw) {
+                const int32_t oh_base = th * 2;
+                const int32_t ow_base = tw * 2;
+                const int32_t ih_base = oh_base - impl.resolved_pad_top;
+                const int32_t iw_base = ow_base - impl.resolved_pad_left;
+
+                for (int32_t oc = oc_begin; oc < oc_end; ++oc) {
+                    // Accumulated transformed-domain products M = sum_ic U .* V
+                    float m[16] = {0.0f};
+
+                    for (int32_t ic = 0; ic < p.input_channels; ++ic) {
+                        // Gather the 4x4 input tile with zero padding
+                        float d[4][4];
+                        for (int32_t i = 0; i < 4; ++i) {
+                            const int32_t ih = ih_base + i;
+                            for (int32_t j = 0; j < 4; ++j) {
+                                const int32_t iw = iw_base + j;
+                                if (ih >= 0 && ih < impl.input_height &&
+                                    iw >= 0 && iw < impl.input_width) {
+                                    d[i][j] = input_batch[
+                                        ih * input_row_stride +
+                                        iw * p.input_channels + ic];
+                                } else {
+                                    d[i][j] = 0.0f;
+                                }
+                            }
+                        }
+
+                        // V = B^T d B, expanded with the F(2x2, 3x3) B matrix
+                        float bt_d[4][4];
+                        for (int32_t j = 0; j < 4; ++j) {
+                            bt_d[0][j] = d[0][j] - d[2][j];
+                            bt_d[1][j] = d[1][j] + d[2][j];
+                            bt_d[2][j] = d[2][j] - d[1][j];
+                            bt_d[3][j] = d[1][j] - d[3][j];
+                        }
+                        float v[16];
+                        for (int32_t i = 0; i < 4; ++i) {
+                            v[i * 4 + 0] = bt_d[i][0] - bt_d[i][2];
+                            v[i * 4 + 1] = bt_d[i][1] + bt_d[i][2];
+                            v[i * 4 + 2] = bt_d[i][2] - bt_d[i][1];
+                            v[i * 4 + 3] = bt_d[i][1] - bt_d[i][3];
+                        }
+
+                        const float* u = &impl.winograd_weights[
+                            (static_cast<size_t>(oc) * p.input_channels + ic) * 16];
+                        for (int32_t k = 0; k < 16; ++k) {
+                            m[k] += u[k] * v[k];
+                        }
+                    }
+
+                    // Y = A^T M A, expanded with the F(2x2, 3x3) A matrix
+                    float at_m[2][4];
+                    for (int32_t j = 0; j < 4; ++j) {
+                        at_m[0][j] = m[0 * 4 + j] + m[1 * 4 + j] + m[2 * 4 + j];
+                        at_m[1][j] = m[1 * 4 + j] - m[2 * 4 + j] - m[3 * 4 + j];
+                    }
+                    float y[2][2];
+                    y[0][0] = at_m[0][0] + at_m[0][1] + at_m[0][2];
+                    y[0][1] = at_m[0][1] - at_m[0][2] - at_m[0][3];
+                    y[1][0] = at_m[1][0] + at_m[1][1] + at_m[1][2];
+                    y[1][1] = at_m[1][1] - at_m[1][2] - at_m[1][3];
+
+                    const float bias_value = bias ? bias[oc] : 0.0f;
+
+                    // Scatter the 2x2 tile, clipping ragged edges
+                    for (int32_t i = 0; i < 2; ++i) {
+                        const int32_t oh = oh_base + i;
+                        if (oh >= impl.output_height) {
+                            continue;
+                        }
+                        for (int32_t j = 0; j < 2; ++j) {
+                            const int32_t ow = ow_base + j;
+                            if (ow >= impl.output_width) {
+                                continue;
+                            }
+                            output_batch[
+                                (oh * impl.output_width + ow) * p.output_channels +
+                                oc] = y[i][j] + bias_value;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <bool kPadded, bool kDilated, bool kBias>
+void CmxConv2D::Conv2DImpl::direct_nhwc(
+    const float* input,
+    const float* weights,
+    const float* bias,
+    float* output,
+    const Conv2DParams& p,
+    const Conv2DImpl& impl,
+    int32_t oc_begin,
+    int32_t oc_end
+) {
+    const int32_t input_row_stride = impl.input_width * p.input_channels;
+
+    // Grouped convolution runs in the same single pass: each output
+    // channel reads only its group's contiguous input-channel slice, so
+    // no split/concat lowering and no tensor copies are needed. With
+    // groups == 1 this degenerates to the dense indexing.
+    const int32_t group_ic = p.input_channels / p.groups;
+    const int32_t group_oc = p.output_channels / p.groups;
+    const int32_t weight_oc_stride = p.kernel_height * p.kernel_width * group_ic;
+
+    // Variant constants: when an axis is compile-time off the dilation
+    // multiplies and padding offsets below fold away entirely
+    const int32_t dilation_h = kDilated ? p.dilation_height : 1;
+    const int32_t dilation_w = kDilated ? p.dilation_width : 1;
+    const int32_t pad_top = kPadded ? impl.resolved_pad_top : 0;
+    const int32_t pad_left = kPadded ? impl.resolved_pad_left : 0;
+
+    // Interior/edge split: output pixels whose whole receptive field is
+    // in bounds take a checkless inner loop; only border pixels (a few
+    // percent of a typical frame) pay for the per-tap range tests. This
+    // is what lets SAME padding run without ever materializing a padded
+    // input copy.
+    const int32_t kh_span = (p.kernel_height - 1) * dilation_h;
+    const int32_t kw_span = (p.kernel_width - 1) * dilation_w;
+
+    int32_t oh_lo = (pad_top + p.stride_height - 1) / p.stride_height;
+    int32_t oh_hi = impl.input_height - 1 - kh_span + pad_top;
+    oh_hi = oh_hi < 0 ? oh_lo : std::min(oh_hi / p.stride_height + 1, impl.output_height);
+    oh_lo = std::min(oh_lo, oh_hi);
+
+    int32_t ow_lo = (pad_left + p.stride_width - 1) / p.stride_width;
+    int32_t ow_hi = impl.input_width - 1 - kw_span + pad_left;
+    ow_hi = ow_hi < 0 ? ow_lo : std::min(ow_hi / p.stride_width + 1, impl.output_width);
+    ow_lo = std::min(ow_lo, ow_hi);
+
+    for (int32_t b = 0; b < impl.batch_size; ++b) {
+        const float* input_batch = input +
+            b * impl.input_height * input_row_stride;
+        float* output_batch = output +
+            b * impl.output_height * impl.output_width * p.output_channels;
+
+        // Checked path for border pixels: out-of-range taps are skipped,
+        // which is exactly a zero-padded MAC with the zeros elided
+        auto conv_pixel_checked = [&](int32_t oh, int32_t ow) {
+            float* output_pixel = output_batch +
+                (oh * impl.output_width + ow) * p.output_channels;
+
+            const int32_t ih_origin = oh * p.stride_height - pad_top;
+            const int32_t iw_origin = ow * p.stride_width - pad_left;
+
+            for (int32_t oc = oc_begin; oc < oc_end; ++oc) {
+                float sum = kBias ? bias[oc] : 0.0f;
+                const float* weight_oc = weights + oc * weight_oc_stride;
+                const int32_t ic_base = (oc / group_oc) * group_ic;
+
+                for (int32_t kh = 0; kh < p.kernel_height; ++kh) {
+                    const int32_t ih = ih_origin + kh * dilation_h;
+                    if (ih < 0 || ih >= impl.input_height) {
+                        continue;
+                    }
+
+                    for (int32_t kw = 0; kw < p.kernel_width; ++kw) {
+                        const int32_t iw = iw_origin + kw * dilation_w;
+                        if (iw < 0 || iw >= impl.input_width) {
+                            continue;
+                        }
+
+                        const float* input_pixel = input_batch +
+                            ih * input_row_stride + iw * p.input_channels + ic_base;
+                        const float* weight_pixel = weight_oc +
+                            (kh * p.kernel_width + kw) * group_ic;
+
+                        for (int32_t ic = 0; ic < group_ic; ++ic) {
+                            sum += input_pixel[ic] * weight_pixel[ic];
+                        }
+                    }
+                }
+
+                output_pixel[oc] = sum;
+            }
+        };
+
+        for (int32_t oh = 0; oh < impl.output_height; ++oh) {
+            const bool row_interior = oh >= oh_lo && oh < oh_hi;
+
+            // Left border (whole row when the row itself is a border)
+            const int32_t checked_end = row_interior ? ow_lo : impl.output_width;
+            for (int32_t ow = 0; ow < checked_end; ++ow) {
+                conv_pixel_checked(oh, ow);
+            }
+            if (!row_interior) {
+                continue;
+            }
+
+            // Interior: every tap is in bounds, no range tests
+            const int32_t ih_origin = oh * p.stride_height - pad_top;
+            for (int32_t ow = ow_lo; ow < ow_hi; ++ow) {
+                float* output_pixel = output_batch +
+                    (oh * impl.output_width + ow) * p.output_channels;
+                const int32_t iw_origin = ow * p.stride_width - pad_left;
+
+                for (int32_t oc = oc_begin; oc < oc_end; ++oc) {
+                    float sum = kBias ? bias[oc] : 0.0f;
+                    const float* weight_oc = weights + oc * weight_oc_stride;
+                    const int32_t ic_base = (oc / group_oc) * group_ic;
+
+                    for (int32_t kh = 0; kh < p.kernel_height; ++kh) {
+                        const int32_t ih = ih_origin + kh * dilation_h;
+                        const float* input_row = input_batch + ih * input_row_stride;
+                        const float* weight_row = weight_oc +
+                            kh * p.kernel_width * group_ic;
+
+                        for (int32_t kw = 0; kw < p.kernel_width; ++kw) {
+                            const float* input_pixel = input_row +
+                                (iw_origin + kw * dilation_w) * p.input_channels +
+                                ic_base;
+                            const float* weight_pixel = weight_row +
+                                kw * group_ic;
+
+                            for (int32_t ic = 0; ic < group_ic; ++ic) {
+                                sum += input_pixel[ic] * weight_pixel[ic];
+                            }
+                        }
+                    }
+
+                    output_pixel[oc] = sum;
+                }
+            }
+
+            // Right border
+            for (int32_t ow = ow_hi; ow < impl.output_width; ++ow) {
+                conv_pixel_checked(oh, ow);
+            }
+        }
+    }
+}
+
+CmxConv2D::Conv2DImpl::KernelFn CmxConv2D::Conv2DImpl::select_direct_nhwc(
+    const Conv2DParams& p,
+    const Conv2DImpl& impl
+) {
+    // One instantiation per cell of the variant matrix, indexed by the
+    // three configuration axes. Bottom/right-only explicit padding maps
+    // onto the unpadded variants; their checked border rows absorb it.
+    static const KernelFn variants[8] = {
+        &direct_nhwc<false, false, false>,
+        &direct_nhwc<false, false, true>,
+        &direct_nhwc<false, true, false>,
+        &direct_nhwc<false, true, true>,
+        &direct_nhwc<true, false, false>,
+        &direct_nhwc<true, false, true>,
+        &direct_nhwc<true, true, false>,
+        &direct_nhwc<true, true, true>,
+    };
+
+    const bool padded = impl.resolved_pad_top != 0 || impl.resolved_pad_left != 0;
+    const bool dilated = p.dilation_height != 1 || p.dilation_width != 1;
+    const int32_t index = (padded ? 4 : 0) | (dilated ? 2 : 0) | (p.use_bias ? 1 : 0);
+    return variants[index];
+}
+
 CmxConv2D::CmxConv2D() : impl_(new Conv2DImpl()) {}
 
 CmxConv2D::~CmxConv2D() {
@@ -42,8 +565,8 @@ CmxConv2D::~CmxConv2D() {
 }
 
 KernelStatus CmxConv2D::configure(
-    const std::vector<TensorDescriptor>& inputs,
-    std::vector<TensorDescriptor>& outputs,
+    DescriptorSpan inputs,
+    DescriptorList& outputs,
     const void* params
 ) {
     if (!params) {
@@ -60,6 +583,8 @@ KernelStatus CmxConv2D::configure(
     
     // Store configuration
     impl_->params = conv_params;
+    impl_->palette_ready = false;
+    impl_->expanded_weights.clear();
     impl_->input_desc = inputs[0];
     impl_->weight_desc = inputs[1];
     if (conv_params.use_bias && inputs.size() > 2) {
@@ -104,10 +629,50 @@ KernelStatus CmxConv2D::configure(
     outputs[0].dtype = inputs[0].dtype;
     impl_->output_desc = outputs[0];
     
-    // Compute workspace requirements
-    impl_->workspace_size = impl_->output_height * impl_->output_width * 
-                           conv_params.input_channels * sizeof(float);
-    
+    // Resolve padding once so run() does not repeat the SAME computation
+    impl_->resolved_pad_top = conv_params.pad_top;
+    impl_->resolved_pad_left = conv_params.pad_left;
+    if (conv_params.padding_mode == PaddingMode::SAME) {
+        auto h_padding = compute_same_padding(
+            impl_->input_height, conv_params.kernel_height,
+            conv_params.stride_height, conv_params.dilation_height);
+        auto w_padding = compute_same_padding(
+            impl_->input_width, conv_params.kernel_width,
+            conv_params.stride_width, conv_params.dilation_width);
+        impl_->resolved_pad_top = h_padding.first;
+        impl_->resolved_pad_left = w_padding.first;
+    }
+
+    // Select kernel and compute workspace requirements. The direct NHWC
+    // kernel accumulates in place and needs no im2col column buffer; the
+    // Winograd path additionally cuts the MAC count for 3x3 stride-1
+    // filters by 2.25x.
+    if (conv_params.data_format == DataFormat::NHWC &&
+        conv_params.kernel_height == 1 && conv_params.kernel_width == 1 &&
+        conv_params.stride_height == 1 && conv_params.stride_width == 1 &&
+        impl_->resolved_pad_top == 0 && impl_->resolved_pad_left == 0 &&
+        conv_params.groups == 1 && !conv_params.quantized &&
+        !conv_params.fp16) {
+        impl_->kernel_func = &Conv2DImpl::pointwise_nhwc;
+        impl_->workspace_size = 0;
+    } else if (conv_params.data_format == DataFormat::NHWC &&
+        conv_params.kernel_height == 3 && conv_params.kernel_width == 3 &&
+        conv_params.stride_height == 1 && conv_params.stride_width == 1 &&
+        conv_params.dilation_height == 1 && conv_params.dilation_width == 1 &&
+        conv_params.groups == 1 && !conv_params.quantized &&
+        !conv_params.fp16) {
+        impl_->kernel_func = &Conv2DImpl::winograd_nhwc;
+        impl_->winograd_ready = false;
+        impl_->workspace_size = 0;
+    } else if (conv_params.data_format == DataFormat::NHWC) {
+        impl_->kernel_func = Conv2DImpl::select_direct_nhwc(conv_params, *impl_);
+        impl_->workspace_size = 0;
+    } else {
+        impl_->kernel_func = nullptr;
+        impl_->workspace_size = impl_->output_height * impl_->output_width *
+                               conv_params.input_channels * sizeof(float);
+    }
+
     return KernelStatus::SUCCESS;
 }
 
@@ -118,7 +683,35 @@ KernelStatus CmxConv2D::run(
     if (!inputs || !outputs || !inputs[0] || !outputs[0]) {
         return KernelStatus::INVALID_PARAMS;
     }
-    
+
+    // Quantized models take the integer paths regardless of data format
+    if (impl_->params.quantized) {
+        if (impl_->params.quantized_int16) {
+            return run_quantized_int16(inputs, outputs, 0,
+                                       impl_->params.output_channels);
+        }
+        return run_quantized(inputs, outputs, 0, impl_->params.output_channels);
+    }
+
+    // FP16 storage keeps tensors in half and expands in registers
+    if (impl_->params.fp16) {
+        return run_fp16(inputs, outputs, 0, impl_->params.output_channels);
+    }
+
+    // Clustered weights expand through the palette once; every float
+    // path below then runs on the expanded copy
+    const void* patched_inputs[3];
+    if (impl_->params.clustered) {
+        if (!impl_->palette_ready) {
+            impl_->expand_clustered_weights(
+                static_cast<const uint8_t*>(inputs[1]));
+        }
+        patched_inputs[0] = inputs[0];
+        patched_inputs[1] = impl_->expanded_weights.data();
+        patched_inputs[2] = impl_->params.use_bias ? inputs[2] : nullptr;
+        inputs = patched_inputs;
+    }
+
     // Dispatch to appropriate implementation based on data format
     if (impl_->params.data_format == DataFormat::NHWC) {
         return run_nhwc(inputs, outputs);
@@ -167,16 +760,105 @@ std::vector<TensorShape> CmxConv2D::infer_shape(
 }
 
 bool CmxConv2D::supports_dtype(DataType dtype) const {
-    return dtype == DataType::FLOAT32 || dtype == DataType::INT8 || 
-           dtype == DataType::UINT8;
+    return dtype == DataType::FLOAT32 || dtype == DataType::INT8 ||
+           dtype == DataType::UINT8 || dtype == DataType::INT16;
 }
 
 int32_t CmxConv2D::get_workspace_size() const {
     return impl_->workspace_size;
 }
 
+int32_t CmxConv2D::split_extent() const {
+    // Channel slicing is implemented for the NHWC paths only
+    if (impl_->params.data_format != DataFormat::NHWC) {
+        return 0;
+    }
+    return impl_->params.output_channels;
+}
+
+KernelStatus CmxConv2D::run_split(
+    const void* const* inputs,
+    void* const* outputs,
+    int32_t begin,
+    int32_t end
+) {
+    if (!inputs || !outputs || !inputs[0] || !outputs[0]) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    const Conv2DParams& p = impl_->params;
+    if (begin < 0 || end > p.output_channels || begin >= end) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    if (p.quantized) {
+        if (p.data_format != DataFormat::NHWC) {
+            return KernelStatus::UNSUPPORTED_DTYPE;
+        }
+        if (p.quantized_int16) {
+            return run_quantized_int16(inputs, outputs, begin, end);
+        }
+        return run_quantized(inputs, outputs, begin, end);
+    }
+
+    if (p.fp16) {
+        if (p.data_format != DataFormat::NHWC) {
+            return KernelStatus::UNSUPPORTED_DTYPE;
+        }
+        return run_fp16(inputs, outputs, begin, end);
+    }
+
+    if (p.data_format != DataFormat::NHWC || !impl_->kernel_func) {
+        // Not splittable here; the base class handles the full-range case
+        return CmxKernel::run_split(inputs, outputs, begin, end);
+    }
+
+    // The palette expansion mutates shared state like the Winograd
+    // transform; concurrent slices must follow a full-range run so the
+    // expansion has already happened by the time they arrive
+    if (p.clustered && !impl_->palette_ready) {
+        impl_->expand_clustered_weights(static_cast<const uint8_t*>(inputs[1]));
+    }
+
+    const float* input = static_cast<const float*>(inputs[0]);
+    const float* weights = p.clustered
+        ? impl_->expanded_weights.data()
+        : static_cast<const float*>(inputs[1]);
+    const float* bias = p.use_bias ? static_cast<const float*>(inputs[2]) : nullptr;
+    float* output = static_cast<float*>(outputs[0]);
+
+    // The bias-carrying kernel variants read the pointer unconditionally
+    if (p.use_bias && !bias) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    // The one-time Winograd weight transform mutates shared state; a
+    // slice arriving before the transform has run takes the direct
+    // kernel instead so concurrent slices never race on it
+    auto kernel = impl_->kernel_func;
+    if (kernel == &Conv2DImpl::winograd_nhwc && !impl_->winograd_ready) {
+        kernel = Conv2DImpl::select_direct_nhwc(p, *impl_);
+    }
+
+    kernel(input, weights, bias, output, p, *impl_, begin, end);
+
+    // Activations are elementwise, so the epilogue touches only this
+    // slice's channels of each output pixel
+    if (p.activation != ActivationType::NONE) {
+        const int32_t pixels = impl_->batch_size * impl_->output_height *
+                               impl_->output_width;
+        for (int32_t px = 0; px < pixels; ++px) {
+            apply_activation(
+                output + static_cast<size_t>(px) * p.output_channels + begin,
+                end - begin, p.activation);
+        }
+    }
+
+    return KernelStatus::SUCCESS;
+}
+
 KernelStatus CmxConv2D::validate_params(
-    const std::vector<TensorDescriptor>& inputs,
+    DescriptorSpan inputs,
     const Conv2DParams& params
 ) {
     // Check minimum input count
@@ -208,7 +890,27 @@ KernelStatus CmxConv2D::validate_params(
     if (params.input_channels <= 0 || params.output_channels <= 0) {
         return KernelStatus::INVALID_PARAMS;
     }
-    
+
+    // FP16 storage and integer quantization are mutually exclusive
+    if (params.fp16 && params.quantized) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    // Clustered weights expand to floats; they need their codebook and
+    // cannot combine with the integer or FP16 storage formats
+    if (params.clustered &&
+        (!params.weight_palette || params.quantized || params.fp16 ||
+         params.weights_int4)) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    // Validate group count: both channel dimensions must partition evenly
+    if (params.groups <= 0 ||
+        params.input_channels % params.groups != 0 ||
+        params.output_channels % params.groups != 0) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
     // Validate input tensor shapes
     const TensorShape& input_shape = inputs[0].shape;
     const TensorShape& weight_shape = inputs[1].shape;
@@ -217,11 +919,12 @@ KernelStatus CmxConv2D::validate_params(
         return KernelStatus::SHAPE_MISMATCH;
     }
     
-    // Check weight tensor dimensions
+    // Check weight tensor dimensions. Grouped weights carry only the
+    // group's input-channel slice along the innermost axis.
     if (weight_shape.dims[0] != params.output_channels ||
         weight_shape.dims[1] != params.kernel_height ||
         weight_shape.dims[2] != params.kernel_width ||
-        weight_shape.dims[3] != params.input_channels) {
+        weight_shape.dims[3] != params.input_channels / params.groups) {
         return KernelStatus::SHAPE_MISMATCH;
     }
     
@@ -324,52 +1027,82 @@ KernelStatus CmxConv2D::run_nhwc(
     const float* weights = static_cast<const float*>(inputs[1]);
     const float* bias = impl_->params.use_bias ? static_cast<const float*>(inputs[2]) : nullptr;
     float* output = static_cast<float*>(outputs[0]);
-    
+
     const Conv2DParams& p = impl_->params;
-    
+
+    // The bias-carrying kernel variants read the pointer unconditionally
+    if (p.use_bias && !bias) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    // Use the kernel selected at configure() time when one is available
+    if (impl_->kernel_func) {
+        // The Winograd weight transform runs once, the first time the
+        // weights are seen, and is reused for every subsequent inference
+        if (impl_->kernel_func == &Conv2DImpl::winograd_nhwc &&
+            !impl_->winograd_ready) {
+            impl_->transform_winograd_weights(weights);
+        }
+
+        impl_->kernel_func(input, weights, bias, output, p, *impl_,
+                           0, p.output_channels);
+
+        if (p.activation != ActivationType::NONE) {
+            int32_t output_size = impl_->batch_size * impl_->output_height *
+                                 impl_->output_width * p.output_channels;
+            apply_activation(output, output_size, p.activation);
+        }
+
+        return KernelStatus::SUCCESS;
+    }
+
     // Compute padding
     int32_t pad_top = p.pad_top;
     int32_t pad_bottom = p.pad_bottom;
     int32_t pad_left = p.pad_left;
     int32_t pad_right = p.pad_right;
-    
+
     if (p.padding_mode == PaddingMode::SAME) {
         auto h_padding = compute_same_padding(
             impl_->input_height, p.kernel_height, p.stride_height, p.dilation_height);
         auto w_padding = compute_same_padding(
             impl_->input_width, p.kernel_width, p.stride_width, p.dilation_width);
-        
+
         pad_top = h_padding.first;
         pad_bottom = h_padding.second;
         pad_left = w_padding.first;
         pad_right = w_padding.second;
     }
-    
+
     // Main convolution loop
+    const int32_t group_ic = p.input_channels / p.groups;
+    const int32_t group_oc = p.output_channels / p.groups;
+
     for (int32_t b = 0; b < impl_->batch_size; ++b) {
         for (int32_t oh = 0; oh < impl_->output_height; ++oh) {
             for (int32_t ow = 0; ow < impl_->output_width; ++ow) {
                 for (int32_t oc = 0; oc < p.output_channels; ++oc) {
-                    
+
                     float sum = bias ? bias[oc] : 0.0f;
-                    
+                    const int32_t ic_base = (oc / group_oc) * group_ic;
+
                     for (int32_t kh = 0; kh < p.kernel_height; ++kh) {
                         for (int32_t kw = 0; kw < p.kernel_width; ++kw) {
                             int32_t ih = oh * p.stride_height + kh * p.dilation_height - pad_top;
                             int32_t iw = ow * p.stride_width + kw * p.dilation_width - pad_left;
-                            
-                            if (ih >= 0 && ih < impl_->input_height && 
+
+                            if (ih >= 0 && ih < impl_->input_height &&
                                 iw >= 0 && iw < impl_->input_width) {
-                                
-                                for (int32_t ic = 0; ic < p.input_channels; ++ic) {
+
+                                for (int32_t ic = 0; ic < group_ic; ++ic) {
                                     int32_t input_idx = b * impl_->input_height * impl_->input_width * p.input_channels +
                                                        ih * impl_->input_width * p.input_channels +
-                                                       iw * p.input_channels + ic;
-                                    
-                                    int32_t weight_idx = oc * p.kernel_height * p.kernel_width * p.input_channels +
-                                                        kh * p.kernel_width * p.input_channels +
-                                                        kw * p.input_channels + ic;
-                                    
+                                                       iw * p.input_channels + ic_base + ic;
+
+                                    int32_t weight_idx = oc * p.kernel_height * p.kernel_width * group_ic +
+                                                        kh * p.kernel_width * group_ic +
+                                                        kw * group_ic + ic;
+
                                     sum += input[input_idx] * weights[weight_idx];
                                 }
                             }
@@ -426,30 +1159,34 @@ KernelStatus CmxConv2D::run_nchw(
     }
     
     // Main convolution loop for NCHW format
+    const int32_t group_ic = p.input_channels / p.groups;
+    const int32_t group_oc = p.output_channels / p.groups;
+
     for (int32_t b = 0; b < impl_->batch_size; ++b) {
         for (int32_t oc = 0; oc < p.output_channels; ++oc) {
+            const int32_t ic_base = (oc / group_oc) * group_ic;
             for (int32_t oh = 0; oh < impl_->output_height; ++oh) {
                 for (int32_t ow = 0; ow < impl_->output_width; ++ow) {
-                    
+
                     float sum = bias ? bias[oc] : 0.0f;
-                    
-                    for (int32_t ic = 0; ic < p.input_channels; ++ic) {
+
+                    for (int32_t ic = 0; ic < group_ic; ++ic) {
                         for (int32_t kh = 0; kh < p.kernel_height; ++kh) {
                             for (int32_t kw = 0; kw < p.kernel_width; ++kw) {
                                 int32_t ih = oh * p.stride_height + kh * p.dilation_height - pad_top;
                                 int32_t iw = ow * p.stride_width + kw * p.dilation_width - pad_left;
-                                
-                                if (ih >= 0 && ih < impl_->input_height && 
+
+                                if (ih >= 0 && ih < impl_->input_height &&
                                     iw >= 0 && iw < impl_->input_width) {
-                                    
+
                                     int32_t input_idx = b * p.input_channels * impl_->input_height * impl_->input_width +
-                                                       ic * impl_->input_height * impl_->input_width +
+                                                       (ic_base + ic) * impl_->input_height * impl_->input_width +
                                                        ih * impl_->input_width + iw;
-                                    
-                                    int32_t weight_idx = oc * p.kernel_height * p.kernel_width * p.input_channels +
-                                                        kh * p.kernel_width * p.input_channels +
-                                                        kw * p.input_channels + ic;
-                                    
+
+                                    int32_t weight_idx = oc * p.kernel_height * p.kernel_width * group_ic +
+                                                        kh * p.kernel_width * group_ic +
+                                                        kw * group_ic + ic;
+
                                     sum += input[input_idx] * weights[weight_idx];
                                 }
                             }
@@ -478,15 +1215,410 @@ KernelStatus CmxConv2D::run_nchw(
 
 KernelStatus CmxConv2D::run_quantized(
     const void* const* inputs,
-    void* const* outputs
+    void* const* outputs,
+    int32_t oc_begin,
+    int32_t oc_end
 ) {
-    // Quantized implementation would go here
-    // This is a placeholder for the quantized convolution path
-    return KernelStatus::UNSUPPORTED_DTYPE;
+    const int8_t* input = static_cast<const int8_t*>(inputs[0]);
+    const int8_t* weights = static_cast<const int8_t*>(inputs[1]);
+    const int32_t* bias = impl_->params.use_bias ?
+        static_cast<const int32_t*>(inputs[2]) : nullptr;
+    int8_t* output = static_cast<int8_t*>(outputs[0]);
+
+    const Conv2DParams& p = impl_->params;
+
+    if (p.data_format != DataFormat::NHWC) {
+        return KernelStatus::UNSUPPORTED_DTYPE;
+    }
+
+    // Fold the activation into the requantization clamp. RELU-family
+    // activations are pure range limits in the quantized domain, so the
+    // epilogue costs nothing beyond the saturation clamp we already pay.
+    int32_t act_min = -128;
+    int32_t act_max = 127;
+    switch (p.activation) {
+        case ActivationType::RELU:
+            act_min = std::max<int32_t>(act_min, p.output_zero_point);
+            break;
+        case ActivationType::RELU6:
+            act_min = std::max<int32_t>(act_min, p.output_zero_point);
+            act_max = std::min<int32_t>(act_max, p.output_zero_point +
+                static_cast<int32_t>(std::lround(6.0f / p.output_scale)));
+            break;
+        case ActivationType::NONE:
+            break;
+        default:
+            // Saturating nonlinearities are not expressible as a clamp
+            return KernelStatus::UNSUPPORTED_DTYPE;
+    }
+
+#ifdef CMX_USE_CMSIS_NN
+    // CMSIS-NN takes over the whole quantized NHWC path. The library
+    // handles bias, requantization, and output saturation internally.
+    // 4-bit packed weights, grouped convolutions, and channel-range
+    // slices stay on the reference path below.
+    if (!p.weights_int4 && p.groups == 1 &&
+        oc_begin == 0 && oc_end == p.output_channels) {
+        cmsis_nn_context ctx;
+        cmsis_nn_conv_params conv_params;
+        conv_params.input_offset = -p.input_zero_point;
+        conv_params.output_offset = p.output_zero_point;
+        conv_params.stride.h = p.stride_height;
+        conv_params.stride.w = p.stride_width;
+        conv_params.padding.h = impl_->resolved_pad_top;
+        conv_params.padding.w = impl_->resolved_pad_left;
+        conv_params.dilation.h = p.dilation_height;
+        conv_params.dilation.w = p.dilation_width;
+        conv_params.activation.min = act_min;
+        conv_params.activation.max = act_max;
+
+        cmsis_nn_dims input_dims = {impl_->batch_size, impl_->input_height,
+                                  impl_->input_width, p.input_channels};
+        cmsis_nn_dims filter_dims = {p.output_channels, p.kernel_height,
+                                   p.kernel_width, p.input_channels};
+        cmsis_nn_dims output_dims = {impl_->batch_size, impl_->output_height,
+                                   impl_->output_width, p.output_channels};
+        cmsis_nn_dims bias_dims = {1, 1, 1, p.output_channels};
+
+        if (arm_convolve_wrapper_s8(&ctx, &conv_params, nullptr,
+                                    &input_dims, input,
+                                    &filter_dims, weights,
+                                    &bias_dims, bias,
+                                    &output_dims, output) == ARM_CMSIS_NN_SUCCESS) {
+            return KernelStatus::SUCCESS;
+        }
+        // Fall through to the reference path on unexpected failure
+    }
+#endif
+
+    const int32_t input_row_stride = impl_->input_width * p.input_channels;
+    const int32_t group_ic = p.input_channels / p.groups;
+    const int32_t group_oc = p.output_channels / p.groups;
+    const int32_t weight_oc_stride = p.kernel_height * p.kernel_width * group_ic;
+
+    // 4-bit weights stay packed two-per-byte all the way into the inner
+    // loop; nibbles are sign-extended in registers as they are consumed
+    const uint8_t* packed_weights = reinterpret_cast<const uint8_t*>(weights);
+
+    for (int32_t b = 0; b < impl_->batch_size; ++b) {
+        const int8_t* input_batch = input +
+            b * impl_->input_height * input_row_stride;
+        int8_t* output_batch = output +
+            b * impl_->output_height * impl_->output_width * p.output_channels;
+
+        for (int32_t oh = 0; oh < impl_->output_height; ++oh) {
+            for (int32_t ow = 0; ow < impl_->output_width; ++ow) {
+                const int32_t ih_origin = oh * p.stride_height - impl_->resolved_pad_top;
+                const int32_t iw_origin = ow * p.stride_width - impl_->resolved_pad_left;
+
+                for (int32_t oc = oc_begin; oc < oc_end; ++oc) {
+                    int32_t acc = bias ? bias[oc] : 0;
+                    const int8_t* weight_oc = weights + oc * weight_oc_stride;
+                    const int32_t ic_base = (oc / group_oc) * group_ic;
+
+                    for (int32_t kh = 0; kh < p.kernel_height; ++kh) {
+                        const int32_t ih = ih_origin + kh * p.dilation_height;
+                        if (ih < 0 || ih >= impl_->input_height) {
+                            continue;
+                        }
+                        for (int32_t kw = 0; kw < p.kernel_width; ++kw) {
+                            const int32_t iw = iw_origin + kw * p.dilation_width;
+                            if (iw < 0 || iw >= impl_->input_width) {
+                                continue;
+                            }
+                            const int8_t* input_pixel = input_batch +
+                                ih * input_row_stride + iw * p.input_channels +
+                                ic_base;
+                            if (p.weights_int4) {
+                                const uint32_t flat_base = static_cast<uint32_t>(
+                                    oc * weight_oc_stride +
+                                    (kh * p.kernel_width + kw) * group_ic);
+                                for (int32_t ic = 0; ic < group_ic; ++ic) {
+                                    const uint32_t flat = flat_base +
+                                        static_cast<uint32_t>(ic);
+                                    const uint8_t byte = packed_weights[flat >> 1];
+                                    const int32_t w = (flat & 1u) ?
+                                        utils::unpack_int4_high(byte) :
+                                        utils::unpack_int4_low(byte);
+                                    acc += (static_cast<int32_t>(input_pixel[ic]) -
+                                            p.input_zero_point) * w;
+                                }
+                            } else {
+                                const int8_t* weight_pixel = weight_oc +
+                                    (kh * p.kernel_width + kw) * group_ic;
+#ifdef CMX_USE_HELIUM
+                                // 16 MACs per beat over the channel dim;
+                                // also covers the per-channel-scale and
+                                // oc-slice cases CMSIS-NN leaves here
+                                acc += platform::cortex_m::mve_dot_s8(
+                                    input_pixel, weight_pixel,
+                                    group_ic, p.input_zero_point);
+#elif defined(CMX_USE_RVV)
+                                // VLEN-agnostic strips; scalar on parts
+                                // whose misa probe found no vector unit
+                                acc += platform::riscv::VectorUnit::dot_s8(
+                                    input_pixel, weight_pixel,
+                                    group_ic, p.input_zero_point);
+#elif defined(CMX_USE_PIE)
+                                // Software-pipelined 16-lane PIE MACs over
+                                // the channel dim
+                                acc += platform::xtensa::pie_dot_s8(
+                                    input_pixel, weight_pixel,
+                                    group_ic, p.input_zero_point);
+#elif defined(CMX_USE_HIFI)
+                                // Dual-MAC AE pipeline over the channel dim
+                                acc += platform::xtensa::hifi_dot_s8(
+                                    input_pixel, weight_pixel,
+                                    group_ic, p.input_zero_point);
+#elif defined(CMX_USE_PLATFORM_MAC)
+                                // Port-provided MAC primitive (e.g. Nios II
+                                // custom instruction)
+                                acc += platform::dot_product_s8(
+                                    input_pixel, weight_pixel,
+                                    group_ic, p.input_zero_point);
+#else
+                                for (int32_t ic = 0; ic < group_ic; ++ic) {
+                                    acc += (static_cast<int32_t>(input_pixel[ic]) -
+                                            p.input_zero_point) *
+                                           static_cast<int32_t>(weight_pixel[ic]);
+                                }
+#endif
+                            }
+                        }
+                    }
+
+                    // Requantize to the output scale; weight_scales carries
+                    // the per-channel scale when provided
+                    const float weight_scale = p.weight_scales ?
+                        p.weight_scales[oc] : 1.0f;
+                    const float real_value = static_cast<float>(acc) *
+                        p.input_scale * weight_scale / p.output_scale;
+                    int32_t quantized = static_cast<int32_t>(
+                        std::lround(real_value)) + p.output_zero_point;
+                    quantized = std::min(act_max, std::max(act_min, quantized));
+
+                    output_batch[
+                        (oh * impl_->output_width + ow) * p.output_channels + oc] =
+                        static_cast<int8_t>(quantized);
+                }
+            }
+        }
+    }
+
+    return KernelStatus::SUCCESS;
+}
+
+KernelStatus CmxConv2D::run_quantized_int16(
+    const void* const* inputs,
+    void* const* outputs,
+    int32_t oc_begin,
+    int32_t oc_end
+) {
+    const int16_t* input = static_cast<const int16_t*>(inputs[0]);
+    const int16_t* weights = static_cast<const int16_t*>(inputs[1]);
+    const int64_t* bias = impl_->params.use_bias ?
+        static_cast<const int64_t*>(inputs[2]) : nullptr;
+    int16_t* output = static_cast<int16_t*>(outputs[0]);
+
+    const Conv2DParams& p = impl_->params;
+
+    if (p.data_format != DataFormat::NHWC || p.weights_int4) {
+        return KernelStatus::UNSUPPORTED_DTYPE;
+    }
+
+    // Symmetric quantization: zero points are zero, so the activation
+    // clamp folds into plain range limits like the int8 path
+    int32_t act_min = -32768;
+    int32_t act_max = 32767;
+    switch (p.activation) {
+        case ActivationType::RELU:
+            act_min = 0;
+            break;
+        case ActivationType::RELU6:
+            act_min = 0;
+            act_max = std::min<int32_t>(act_max,
+                static_cast<int32_t>(std::lround(6.0f / p.output_scale)));
+            break;
+        case ActivationType::NONE:
+            break;
+        default:
+            // Saturating nonlinearities are not expressible as a clamp
+            return KernelStatus::UNSUPPORTED_DTYPE;
+    }
+
+    const int32_t input_row_stride = impl_->input_width * p.input_channels;
+    const int32_t group_ic = p.input_channels / p.groups;
+    const int32_t group_oc = p.output_channels / p.groups;
+    const int32_t weight_oc_stride = p.kernel_height * p.kernel_width * group_ic;
+
+    for (int32_t b = 0; b < impl_->batch_size; ++b) {
+        const int16_t* input_batch = input +
+            b * impl_->input_height * input_row_stride;
+        int16_t* output_batch = output +
+            b * impl_->output_height * impl_->output_width * p.output_channels;
+
+        for (int32_t oh = 0; oh < impl_->output_height; ++oh) {
+            for (int32_t ow = 0; ow < impl_->output_width; ++ow) {
+                const int32_t ih_origin = oh * p.stride_height - impl_->resolved_pad_top;
+                const int32_t iw_origin = ow * p.stride_width - impl_->resolved_pad_left;
+
+                for (int32_t oc = oc_begin; oc < oc_end; ++oc) {
+                    // 64-bit accumulator: a single 16x16 product fills
+                    // 30 bits, so int32 would wrap over deep channels
+                    int64_t acc = bias ? bias[oc] : 0;
+                    const int16_t* weight_oc = weights + oc * weight_oc_stride;
+                    const int32_t ic_base = (oc / group_oc) * group_ic;
+
+                    for (int32_t kh = 0; kh < p.kernel_height; ++kh) {
+                        const int32_t ih = ih_origin + kh * p.dilation_height;
+                        if (ih < 0 || ih >= impl_->input_height) {
+                            continue;
+                        }
+                        for (int32_t kw = 0; kw < p.kernel_width; ++kw) {
+                            const int32_t iw = iw_origin + kw * p.dilation_width;
+                            if (iw < 0 || iw >= impl_->input_width) {
+                                continue;
+                            }
+                            const int16_t* input_pixel = input_batch +
+                                ih * input_row_stride + iw * p.input_channels +
+                                ic_base;
+                            const int16_t* weight_pixel = weight_oc +
+                                (kh * p.kernel_width + kw) * group_ic;
+#ifdef CMX_USE_HELIUM
+                            // 8 widening MACs per beat over the channel dim
+                            acc += platform::cortex_m::mve_dot_s16(
+                                input_pixel, weight_pixel, group_ic);
+#elif defined(CMX_USE_DSP_EXT)
+                            // Packed SMLALD, two 16-bit MACs per instruction
+                            acc += platform::cortex_m::dsp_dot_s16(
+                                input_pixel, weight_pixel, group_ic);
+#elif defined(CMX_USE_HIFI)
+                            // Dual-MAC AE pipeline over the channel dim
+                            acc += platform::xtensa::hifi_dot_s16(
+                                input_pixel, weight_pixel, group_ic);
+#else
+                            // Paired so the compiler can fuse into dual
+                            // 16-bit MACs
+                            int32_t ic = 0;
+                            for (; ic + 2 <= group_ic; ic += 2) {
+                                acc += static_cast<int64_t>(input_pixel[ic]) *
+                                       static_cast<int64_t>(weight_pixel[ic]);
+                                acc += static_cast<int64_t>(input_pixel[ic + 1]) *
+                                       static_cast<int64_t>(weight_pixel[ic + 1]);
+                            }
+                            if (ic < group_ic) {
+                                acc += static_cast<int64_t>(input_pixel[ic]) *
+                                       static_cast<int64_t>(weight_pixel[ic]);
+                            }
+#endif
+                        }
+                    }
+
+                    // Requantize to the output scale; weight_scales carries
+                    // the per-channel scale when provided
+                    const float weight_scale = p.weight_scales ?
+                        p.weight_scales[oc] : 1.0f;
+                    const double real_value = static_cast<double>(acc) *
+                        p.input_scale * weight_scale / p.output_scale;
+                    int32_t quantized = static_cast<int32_t>(std::llround(real_value));
+                    quantized = std::min(act_max, std::max(act_min, quantized));
+
+                    output_batch[
+                        (oh * impl_->output_width + ow) * p.output_channels + oc] =
+                        static_cast<int16_t>(quantized);
+                }
+            }
+        }
+    }
+
+    return KernelStatus::SUCCESS;
+}
+
+KernelStatus CmxConv2D::run_fp16(
+    const void* const* inputs,
+    void* const* outputs,
+    int32_t oc_begin,
+    int32_t oc_end
+) {
+    const Conv2DParams& p = impl_->params;
+    if (p.data_format != DataFormat::NHWC) {
+        return KernelStatus::UNSUPPORTED_DTYPE;
+    }
+
+    const uint16_t* input = static_cast<const uint16_t*>(inputs[0]);
+    const uint16_t* weights = static_cast<const uint16_t*>(inputs[1]);
+    const float* bias = p.use_bias ? static_cast<const float*>(inputs[2]) : nullptr;
+    uint16_t* output = static_cast<uint16_t*>(outputs[0]);
+
+    const int32_t input_row_stride = impl_->input_width * p.input_channels;
+    const int32_t group_ic = p.input_channels / p.groups;
+    const int32_t group_oc = p.output_channels / p.groups;
+    const int32_t weight_oc_stride = p.kernel_height * p.kernel_width * group_ic;
+
+    for (int32_t b = 0; b < impl_->batch_size; ++b) {
+        const uint16_t* input_batch = input +
+            b * impl_->input_height * input_row_stride;
+        uint16_t* output_batch = output +
+            b * impl_->output_height * impl_->output_width * p.output_channels;
+
+        for (int32_t oh = 0; oh < impl_->output_height; ++oh) {
+            for (int32_t ow = 0; ow < impl_->output_width; ++ow) {
+                const int32_t ih_origin =
+                    oh * p.stride_height - impl_->resolved_pad_top;
+                const int32_t iw_origin =
+                    ow * p.stride_width - impl_->resolved_pad_left;
+
+                for (int32_t oc = oc_begin; oc < oc_end; ++oc) {
+                    // Accumulate in FP32; the half operands are the
+                    // 16-bit fetches that halve the byte traffic
+                    float sum = bias ? bias[oc] : 0.0f;
+                    const uint16_t* weight_oc = weights + oc * weight_oc_stride;
+                    const int32_t ic_base = (oc / group_oc) * group_ic;
+
+                    for (int32_t kh = 0; kh < p.kernel_height; ++kh) {
+                        const int32_t ih = ih_origin + kh * p.dilation_height;
+                        if (ih < 0 || ih >= impl_->input_height) {
+                            continue;
+                        }
+
+                        for (int32_t kw = 0; kw < p.kernel_width; ++kw) {
+                            const int32_t iw = iw_origin + kw * p.dilation_width;
+                            if (iw < 0 || iw >= impl_->input_width) {
+                                continue;
+                            }
+
+                            const uint16_t* input_pixel = input_batch +
+                                ih * input_row_stride + iw * p.input_channels +
+                                ic_base;
+                            const uint16_t* weight_pixel = weight_oc +
+                                (kh * p.kernel_width + kw) * group_ic;
+
+                            for (int32_t ic = 0; ic < group_ic; ++ic) {
+                                sum += utils::fp16_to_float(input_pixel[ic]) *
+                                       utils::fp16_to_float(weight_pixel[ic]);
+                            }
+                        }
+                    }
+
+                    if (p.activation != ActivationType::NONE) {
+                        apply_activation(&sum, 1, p.activation);
+                    }
+
+                    output_batch[
+                        (oh * impl_->output_width + ow) * p.output_channels + oc] =
+                        utils::float_to_fp16(sum);
+                }
+            }
+        }
+    }
+
+    return KernelStatus::SUCCESS;
 }
 
-// Register the kernel
+// Register the kernel (skipped in manifest builds that do not use it)
+#if CMX_NEED_OP_CONV2D
 REGISTER_KERNEL(CmxConv2D, KernelType::CONV2D, 0);
+#endif
 
 } // namespace kernels
 } // namespace cmx
\ No newline at end of file
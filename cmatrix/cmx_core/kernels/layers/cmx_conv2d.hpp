@@ -63,7 +63,12 @@ struct Conv2DParams {
     // Channel configuration
     int32_t input_channels;
     int32_t output_channels;
-    
+
+    // Grouped convolution: input and output channels are partitioned
+    // into this many independent groups (1 = dense convolution).
+    // Weights are OHWI with I = input_channels / groups.
+    int32_t groups;
+
     // Data format
     DataFormat data_format;
     
@@ -75,6 +80,11 @@ struct Conv2DParams {
     
     // Quantization parameters
     bool quantized;
+    bool quantized_int16;  // INT16 activations/weights, symmetric (zero points 0)
+    bool weights_int4;     // Weights are 4-bit packed, two per byte
+    bool fp16;             // FP16-stored activations/weights, FP32 compute
+    bool clustered;        // Weights are 4-bit palette indices, two per byte
+    const float* weight_palette;  // 16-entry codebook for clustered weights
     float input_scale;
     int32_t input_zero_point;
     float output_scale;
@@ -89,10 +99,16 @@ struct Conv2DParams {
         , padding_mode(PaddingMode::VALID)
         , pad_top(0), pad_bottom(0), pad_left(0), pad_right(0)
         , input_channels(0), output_channels(0)
+        , groups(1)
         , data_format(DataFormat::NHWC)
         , activation(ActivationType::NONE)
         , use_bias(false)
         , quantized(false)
+        , quantized_int16(false)
+        , weights_int4(false)
+        , fp16(false)
+        , clustered(false)
+        , weight_palette(nullptr)
         , input_scale(1.0f), input_zero_point(0)
         , output_scale(1.0f), output_zero_point(0)
         , weight_scales(nullptr)
@@ -107,7 +123,10 @@ struct Conv2DParams {
  * - Configurable strides and dilation
  * - Optional bias addition
  * - Fused activation functions
+ * - Grouped convolution (single-pass, no split/concat lowering)
  * - Quantization-aware inference
+ * - FP16 storage with FP32 compute
+ * - Clustered 4-bit palette weights, expanded once on first run
  * - Multiple data formats (NHWC, NCHW)
  * - Hardware acceleration when available
  */
@@ -132,8 +151,8 @@ public:
      * @return KernelStatus indicating success or failure
      */
     KernelStatus configure(
-        const std::vector<TensorDescriptor>& inputs,
-        std::vector<TensorDescriptor>& outputs,
+        DescriptorSpan inputs,
+        DescriptorList& outputs,
         const void* params
     ) override;
 
@@ -180,6 +199,37 @@ public:
      */
     int32_t get_workspace_size() const override;
 
+    /**
+     * @brief Convolution writes every output element
+     * @return True
+     */
+    bool writes_all_outputs() const override { return true; }
+
+    /**
+     * @brief Output channels are independent and can be partitioned
+     *
+     * Each output channel reads only its own group's input channels,
+     * so channel slices of a grouped convolution stay independent and
+     * groups become a natural unit for the intra-op scheduler.
+     *
+     * @return Output channel count for NHWC layouts, 0 otherwise
+     */
+    int32_t split_extent() const override;
+
+    /**
+     * @brief Compute output channels [begin, end) only
+     *
+     * Slices write disjoint channel ranges of the output and share
+     * only read-only state, so concurrent slices are safe. Supported
+     * for NHWC float and quantized paths.
+     */
+    KernelStatus run_split(
+        const void* const* inputs,
+        void* const* outputs,
+        int32_t begin,
+        int32_t end
+    ) override;
+
 private:
     struct Conv2DImpl;
     Conv2DImpl* impl_;
@@ -191,7 +241,7 @@ private:
      * @return KernelStatus indicating validation result
      */
     KernelStatus validate_params(
-        const std::vector<TensorDescriptor>& inputs,
+        DescriptorSpan inputs,
         const Conv2DParams& params
     );
 
@@ -249,10 +299,44 @@ private:
 
     /**
      * @brief Quantized convolution implementation
+     *
+     * Computes output channels [oc_begin, oc_end); the full-channel
+     * call additionally enables the CMSIS-NN fast path.
      */
     KernelStatus run_quantized(
         const void* const* inputs,
-        void* const* outputs
+        void* const* outputs,
+        int32_t oc_begin,
+        int32_t oc_end
+    );
+
+    /**
+     * @brief INT16 quantized convolution implementation
+     *
+     * Symmetric quantization with 64-bit accumulators; the channel dot
+     * product runs on the packed dual 16-bit MAC paths where available.
+     * Computes output channels [oc_begin, oc_end).
+     */
+    KernelStatus run_quantized_int16(
+        const void* const* inputs,
+        void* const* outputs,
+        int32_t oc_begin,
+        int32_t oc_end
+    );
+
+    /**
+     * @brief FP16-storage convolution implementation
+     *
+     * Activations and weights stay in IEEE half and are expanded to
+     * FP32 in registers per tap, so the arithmetic matches the float
+     * path while the memory traffic is halved. Bias stays FP32.
+     * Computes output channels [oc_begin, oc_end), NHWC only.
+     */
+    KernelStatus run_fp16(
+        const void* const* inputs,
+        void* const* outputs,
+        int32_t oc_begin,
+        int32_t oc_end
     );
 };
 
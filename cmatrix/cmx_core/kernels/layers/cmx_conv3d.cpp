@@ -45,7 +45,7 @@ bool CmxConv3D::run(const float* input, const TensorShape& input_shape,
 
     // Choose implementation based on kernel size and performance characteristics
     if (config_.kernel_size[0] * config_.kernel_size[1] * config_.kernel_size[2] <= 27) {
-        conv3d_direct(input, input_shape, output, output_shape);
+        conv3d_slab_tiled(input, input_shape, output, output_shape);
     } else {
         conv3d_im2col(input, input_shape, output, output_shape);
     }
@@ -205,6 +205,130 @@ void CmxConv3D::conv3d_direct(const float* input, const TensorShape& input_shape
     }
 }
 
+void CmxConv3D::conv3d_slab_tiled(const float* input, const TensorShape& input_shape,
+                                  float* output, const TensorShape& output_shape) {
+    const int32_t batch_size = input_shape.batch;
+    const int32_t in_depth = input_shape.depth;
+    const int32_t in_height = input_shape.height;
+    const int32_t in_width = input_shape.width;
+    const int32_t in_channels = input_shape.channels;
+
+    const int32_t out_depth = output_shape.depth;
+    const int32_t out_height = output_shape.height;
+    const int32_t out_width = output_shape.width;
+    const int32_t out_channels = output_shape.channels;
+
+    // Number of output depth planes processed per slab. Keeps the live set
+    // (slab of output planes + one input plane) small enough to stay cached
+    // for typical volumetric inputs while still amortizing each input plane
+    // across every kernel-depth tap in the slab.
+    constexpr int32_t kDepthSlab = 4;
+
+    const int32_t in_plane_elems = in_height * in_width * in_channels;
+    const int32_t out_plane_elems = out_height * out_width * out_channels;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        const float* in_batch = input + b * in_depth * in_plane_elems;
+        float* out_batch = output + b * out_depth * out_plane_elems;
+
+        for (int32_t od_start = 0; od_start < out_depth; od_start += kDepthSlab) {
+            const int32_t od_end = std::min(od_start + kDepthSlab, out_depth);
+
+            // Seed the slab with bias (or zero) before accumulation
+            for (int32_t od = od_start; od < od_end; ++od) {
+                float* out_plane = out_batch + od * out_plane_elems;
+                if (config_.use_bias && bias_) {
+                    for (int32_t i = 0; i < out_plane_elems; ++i) {
+                        out_plane[i] = bias_[i % out_channels];
+                    }
+                } else {
+                    std::memset(out_plane, 0, out_plane_elems * sizeof(float));
+                }
+            }
+
+            // Stream input planes through the slab's depth footprint. Planes
+            // are contiguous in NDHWC, so they are consumed in place rather
+            // than copied into a staging buffer; each plane is loaded once and
+            // reused by every (od, kd) pair in the slab that overlaps it.
+            const int32_t id_first = od_start * config_.strides[0] - config_.padding[0];
+            const int32_t id_last = (od_end - 1) * config_.strides[0] +
+                                    (config_.kernel_size[0] - 1) * config_.dilation[0] -
+                                    config_.padding[0];
+
+            for (int32_t id = std::max<int32_t>(0, id_first);
+                 id <= std::min(in_depth - 1, id_last); ++id) {
+                const float* in_plane = in_batch + id * in_plane_elems;
+
+                for (int32_t od = od_start; od < od_end; ++od) {
+                    // Kernel-depth tap mapping this input plane onto output plane od
+                    const int32_t offset = id - (od * config_.strides[0] - config_.padding[0]);
+                    if (offset < 0 || offset % config_.dilation[0] != 0) {
+                        continue;
+                    }
+                    const int32_t kd = offset / config_.dilation[0];
+                    if (kd >= config_.kernel_size[0]) {
+                        continue;
+                    }
+
+                    accumulate_depth_tap(in_plane, out_batch + od * out_plane_elems, kd,
+                                         input_shape, output_shape);
+                }
+            }
+        }
+    }
+
+    // Apply activation if configured
+    if (config_.fused_activation) {
+        apply_activation(output, batch_size * out_depth * out_height * out_width * out_channels);
+    }
+}
+
+void CmxConv3D::accumulate_depth_tap(const float* in_plane, float* out_plane, int32_t kd,
+                                     const TensorShape& input_shape, const TensorShape& output_shape) {
+    const int32_t in_height = input_shape.height;
+    const int32_t in_width = input_shape.width;
+    const int32_t in_channels = input_shape.channels;
+
+    const int32_t out_height = output_shape.height;
+    const int32_t out_width = output_shape.width;
+    const int32_t out_channels = output_shape.channels;
+
+    const int32_t kernel_hw = config_.kernel_size[1] * config_.kernel_size[2];
+    const int32_t weights_per_filter = config_.input_channels * config_.kernel_size[0] * kernel_hw;
+
+    for (int32_t oh = 0; oh < out_height; ++oh) {
+        for (int32_t kh = 0; kh < config_.kernel_size[1]; ++kh) {
+            const int32_t ih = oh * config_.strides[1] + kh * config_.dilation[1] - config_.padding[2];
+            if (ih < 0 || ih >= in_height) {
+                continue;
+            }
+
+            for (int32_t ow = 0; ow < out_width; ++ow) {
+                float* out_px = out_plane + (oh * out_width + ow) * out_channels;
+
+                for (int32_t kw = 0; kw < config_.kernel_size[2]; ++kw) {
+                    const int32_t iw = ow * config_.strides[2] + kw * config_.dilation[2] - config_.padding[4];
+                    if (iw < 0 || iw >= in_width) {
+                        continue;
+                    }
+
+                    const float* in_px = in_plane + (ih * in_width + iw) * in_channels;
+
+                    for (int32_t oc = 0; oc < out_channels; ++oc) {
+                        const float* filter = weights_ + oc * weights_per_filter +
+                                              kd * kernel_hw + kh * config_.kernel_size[2] + kw;
+                        float sum = 0.0f;
+                        for (int32_t ic = 0; ic < in_channels; ++ic) {
+                            sum += in_px[ic] * filter[ic * config_.kernel_size[0] * kernel_hw];
+                        }
+                        out_px[oc] += sum;
+                    }
+                }
+            }
+        }
+    }
+}
+
 void CmxConv3D::conv3d_im2col(const float* input, const TensorShape& input_shape,
                               float* output, const TensorShape& output_shape) {
     // Placeholder for im2col implementation
@@ -116,6 +116,26 @@ private:
                        float* output, const TensorShape& output_shape);
     void conv3d_im2col(const float* input, const TensorShape& input_shape,
                        float* output, const TensorShape& output_shape);
+
+    /**
+     * @brief Depth-slab tiled convolution
+     *
+     * Processes a few output depth planes at a time and streams input planes
+     * through the slab, so each loaded plane is consumed by every kernel-depth
+     * tap that touches it. Bounds the working set to one slab of output plus a
+     * single input plane instead of the full volume.
+     */
+    void conv3d_slab_tiled(const float* input, const TensorShape& input_shape,
+                           float* output, const TensorShape& output_shape);
+
+    /**
+     * @brief Accumulate one kernel-depth tap of an input plane into an output plane
+     * @param in_plane Input plane base pointer [h][w][in_ch]
+     * @param out_plane Output plane base pointer [h][w][out_ch]
+     * @param kd Kernel depth index selecting the weight sub-volume
+     */
+    void accumulate_depth_tap(const float* in_plane, float* out_plane, int32_t kd,
+                              const TensorShape& input_shape, const TensorShape& output_shape);
 };
 
 } // namespace kernels
@@ -1,8 +1,41 @@
 #include "cmx_dense.hpp"
+#include "../cmx_gemm.hpp"
+#include "../../utils/cmx_quantization.hpp"
+#include "../../utils/cmx_fp16.hpp"
 #include <cstring>
 #include <algorithm>
 #include <cmath>
 
+#ifdef CMX_USE_CMSIS_NN
+#include "arm_nnfunctions.h"
+#endif
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef CMX_USE_HELIUM
+#include "../../platform/cortex-m/cmx_cortex_m_mve.hpp"
+#endif
+
+#ifdef CMX_USE_DSP_EXT
+#include "../../platform/cortex-m/cmx_cortex_m_dsp.hpp"
+#endif
+
+#ifdef CMX_USE_RVV
+#include "../../platform/riscv/cmx_riscv_vector.hpp"
+#endif
+
+#ifdef CMX_USE_HIFI
+#include "../../platform/xtensa/cmx_xtensa_hifi.hpp"
+#endif
+
+#ifdef CMX_USE_PIE
+#include "../../platform/xtensa/cmx_xtensa_pie.hpp"
+#endif
+
+#include "../../platform/cmx_platform_abstraction.hpp"
+
 namespace cmx {
 namespace kernels {
 
@@ -29,9 +62,121 @@ bool CmxDense::configure(const Config& config, const float* weights, const float
     }
 
     is_configured_ = true;
+
+    // Transpose once at load time so the strided orientation never
+    // reaches the GEMV loops; must run before packing so the packed
+    // copy is built from the contiguous layout
+    if (config_.cache_transposed && !config_.transpose_weights) {
+        cache_transposed_weights();
+    } else {
+        transposed_weights_.clear();
+    }
+
+    // Pack once at load time so every inference reads the blocked copy
+    if (config_.prepack_weights) {
+        pack_weights();
+    } else {
+        packed_weights_.clear();
+    }
+
     return true;
 }
 
+void CmxDense::cache_transposed_weights() {
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+
+    transposed_weights_.resize(
+        static_cast<size_t>(output_units) * input_units);
+
+    // [input x output] -> [output x input]: the source walks one output
+    // column sequentially while the destination row fills contiguously,
+    // so the pass itself is a single strided read per element - paid
+    // once instead of on every inference
+    for (int32_t i = 0; i < output_units; ++i) {
+        float* dst = transposed_weights_.data() +
+            static_cast<size_t>(i) * input_units;
+        for (int32_t j = 0; j < input_units; ++j) {
+            dst[j] = weights_[static_cast<size_t>(j) * output_units + i];
+        }
+    }
+
+    // All downstream paths now see the contiguous orientation
+    weights_ = transposed_weights_.data();
+    config_.transpose_weights = true;
+}
+
+void CmxDense::pack_weights() {
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+    const int32_t panels = (output_units + kPackPanel - 1) / kPackPanel;
+
+    // Panels are zero-padded to full width so the kernel never needs a
+    // remainder branch in its inner loop
+    packed_weights_.assign(
+        static_cast<size_t>(panels) * kPackPanel * input_units, 0.0f);
+
+    for (int32_t i = 0; i < output_units; ++i) {
+        const int32_t panel = i / kPackPanel;
+        const int32_t lane = i % kPackPanel;
+        float* dst = packed_weights_.data() +
+            (static_cast<size_t>(panel) * input_units) * kPackPanel;
+
+        for (int32_t j = 0; j < input_units; ++j) {
+            const float w = config_.transpose_weights ?
+                weights_[i * input_units + j] :
+                weights_[j * output_units + i];
+            dst[j * kPackPanel + lane] = w;
+        }
+    }
+}
+
+void CmxDense::matmul_packed(const float* input, const TensorShape& input_shape,
+                             float* output, const TensorShape& output_shape) {
+    const int32_t batch_size = input_shape.batch;
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+    const int32_t panels = (output_units + kPackPanel - 1) / kPackPanel;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        const float* input_row = input + b * input_units;
+        float* output_row = output + b * output_units;
+
+        for (int32_t panel = 0; panel < panels; ++panel) {
+            const float* panel_weights = packed_weights_.data() +
+                (static_cast<size_t>(panel) * input_units) * kPackPanel;
+
+            float acc[kPackPanel] = {0.0f};
+            for (int32_t j = 0; j < input_units; ++j) {
+                const float x = input_row[j];
+                const float* w = panel_weights + j * kPackPanel;
+                for (int32_t lane = 0; lane < kPackPanel; ++lane) {
+                    acc[lane] += x * w[lane];
+                }
+            }
+
+            const int32_t base = panel * kPackPanel;
+            const int32_t lanes = std::min<int32_t>(kPackPanel, output_units - base);
+            for (int32_t lane = 0; lane < lanes; ++lane) {
+                float value = acc[lane];
+                if (config_.use_bias && bias_) {
+                    value += bias_[base + lane];
+                }
+                output_row[base + lane] = value;
+            }
+        }
+    }
+
+    // Apply activation
+    if (config_.fused_activation) {
+        if (config_.activation_type == ActivationType::SOFTMAX) {
+            apply_softmax(output, batch_size, output_units);
+        } else {
+            apply_activation(output, batch_size * output_units);
+        }
+    }
+}
+
 bool CmxDense::run(const float* input, const TensorShape& input_shape,
                    float* output, const TensorShape& output_shape) {
     if (!is_configured_ || !input || !output) {
@@ -47,6 +192,20 @@ bool CmxDense::run(const float* input, const TensorShape& input_shape,
         return false;
     }
 
+    // The packed layout wins whenever it has been prepared
+    if (!packed_weights_.empty()) {
+        matmul_packed(input, input_shape, output, output_shape);
+        return true;
+    }
+
+    // Batch 1 is a matrix-vector product, not a degenerate GEMM: the
+    // classifier-head case gets the dedicated microkernel whenever the
+    // weights are in the contiguous orientation it needs
+    if (input_shape.batch == 1 && config_.transpose_weights) {
+        gemv(input, output);
+        return true;
+    }
+
     // Choose implementation based on matrix size
     if (config_.input_units <= 128 && config_.output_units <= 128) {
         matmul_naive(input, input_shape, output, output_shape);
@@ -63,6 +222,65 @@ bool CmxDense::run(const float* input, const TensorShape& input_shape,
     return true;
 }
 
+bool CmxDense::run_range(const float* input, const TensorShape& input_shape,
+                         float* output, const TensorShape& output_shape,
+                         int32_t unit_begin, int32_t unit_end) {
+    if (!is_configured_ || !input || !output) {
+        return false;
+    }
+
+    if (input_shape.features != config_.input_units ||
+        output_shape.features != config_.output_units) {
+        return false;
+    }
+
+    if (unit_begin < 0 || unit_end > config_.output_units ||
+        unit_begin >= unit_end) {
+        return false;
+    }
+
+    // Full-range calls keep the tuned single-core dispatch
+    if (unit_begin == 0 && unit_end == config_.output_units) {
+        return run(input, input_shape, output, output_shape);
+    }
+
+    // Softmax normalizes over all output units and cannot be sliced
+    if (config_.fused_activation &&
+        config_.activation_type == ActivationType::SOFTMAX) {
+        return false;
+    }
+
+    const int32_t batch_size = input_shape.batch;
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        const float* input_row = input + b * input_units;
+        float* output_row = output + b * output_units;
+
+        for (int32_t i = unit_begin; i < unit_end; ++i) {
+            float sum = config_.use_bias && bias_ ? bias_[i] : 0.0f;
+
+            for (int32_t j = 0; j < input_units; ++j) {
+                if (config_.transpose_weights) {
+                    sum += input_row[j] * weights_[i * input_units + j];
+                } else {
+                    sum += input_row[j] * weights_[j * output_units + i];
+                }
+            }
+
+            output_row[i] = sum;
+        }
+
+        // Elementwise activations touch only this slice's columns
+        if (config_.fused_activation) {
+            apply_activation(output_row + unit_begin, unit_end - unit_begin);
+        }
+    }
+
+    return true;
+}
+
 bool CmxDense::infer_shape(const TensorShape& input_shape, TensorShape& output_shape) {
     if (!is_configured_) {
         return false;
@@ -81,11 +299,17 @@ bool CmxDense::get_memory_requirements(const TensorShape& input_shape,
 
     // Weight memory
     weight_memory = config_.input_units * config_.output_units * sizeof(float);
-    
+
     if (config_.use_bias) {
         weight_memory += config_.output_units * sizeof(float);
     }
 
+    // The cached transposed copy lives with the read-only weight data
+    // so the planner can account for (and spill) it like any weight
+    if (!transposed_weights_.empty()) {
+        weight_memory += transposed_weights_.size() * sizeof(float);
+    }
+
     // Workspace memory for blocked matrix multiplication
     workspace_memory = 0;
     if (config_.input_units >= 512 && config_.output_units >= 512) {
@@ -95,6 +319,330 @@ bool CmxDense::get_memory_requirements(const TensorShape& input_shape,
     return true;
 }
 
+bool CmxDense::run_quantized(const int8_t* input, const TensorShape& input_shape,
+                             const int8_t* weights, const int32_t* bias,
+                             const QuantParams& quant, int8_t* output) {
+    if (!is_configured_ || !input || !weights || !output) {
+        return false;
+    }
+
+    const int32_t batch_size = input_shape.batch;
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+
+#ifdef CMX_USE_CMSIS_NN
+    {
+        cmsis_nn_context ctx;
+        ctx.buf = nullptr;
+        ctx.size = 0;
+
+        cmsis_nn_fc_params fc_params;
+        fc_params.input_offset = -quant.input_zero_point;
+        fc_params.filter_offset = 0;
+        fc_params.output_offset = quant.output_zero_point;
+        fc_params.activation.min = -128;
+        fc_params.activation.max = 127;
+
+        const float effective_scale =
+            quant.input_scale * quant.weight_scale / quant.output_scale;
+        cmsis_nn_per_tensor_quant_params quant_params;
+        arm_quantize_scale(effective_scale, &quant_params.multiplier,
+                           &quant_params.shift);
+
+        cmsis_nn_dims input_dims = {batch_size, 1, 1, input_units};
+        cmsis_nn_dims filter_dims = {input_units, 1, 1, output_units};
+        cmsis_nn_dims bias_dims = {1, 1, 1, output_units};
+        cmsis_nn_dims output_dims = {batch_size, 1, 1, output_units};
+
+        if (arm_fully_connected_s8(&ctx, &fc_params, &quant_params,
+                                   &input_dims, input,
+                                   &filter_dims, weights,
+                                   &bias_dims, bias,
+                                   &output_dims, output) == ARM_CMSIS_NN_SUCCESS) {
+            return true;
+        }
+        // Fall through to the reference path on unexpected failure
+    }
+#endif
+
+    const float effective_scale =
+        quant.input_scale * quant.weight_scale / quant.output_scale;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        const int8_t* input_row = input + b * input_units;
+        int8_t* output_row = output + b * output_units;
+
+        for (int32_t i = 0; i < output_units; ++i) {
+            int32_t acc = bias ? bias[i] : 0;
+            const int8_t* weight_row = weights + i * input_units;
+
+#ifdef CMX_USE_HELIUM
+            // Whole input row in 16-lane MVE MACs
+            acc += platform::cortex_m::mve_dot_s8(input_row, weight_row,
+                                                  input_units,
+                                                  quant.input_zero_point);
+#elif defined(CMX_USE_RVV)
+            // VLEN-agnostic strips over the input row
+            acc += platform::riscv::VectorUnit::dot_s8(input_row, weight_row,
+                                                       input_units,
+                                                       quant.input_zero_point);
+#elif defined(CMX_USE_PIE)
+            // Software-pipelined 16-lane PIE MACs over the input row
+            acc += platform::xtensa::pie_dot_s8(input_row, weight_row,
+                                                input_units,
+                                                quant.input_zero_point);
+#elif defined(CMX_USE_HIFI)
+            // Dual-MAC AE pipeline, 4 MACs per step
+            acc += platform::xtensa::hifi_dot_s8(input_row, weight_row,
+                                                 input_units,
+                                                 quant.input_zero_point);
+#elif defined(CMX_USE_PLATFORM_MAC)
+            // Port-provided MAC primitive (e.g. Nios II custom instruction)
+            acc += platform::dot_product_s8(input_row, weight_row,
+                                            input_units,
+                                            quant.input_zero_point);
+#else
+            for (int32_t j = 0; j < input_units; ++j) {
+                acc += (static_cast<int32_t>(input_row[j]) -
+                        quant.input_zero_point) *
+                       static_cast<int32_t>(weight_row[j]);
+            }
+#endif
+
+            int32_t quantized = static_cast<int32_t>(
+                std::lround(static_cast<float>(acc) * effective_scale)) +
+                quant.output_zero_point;
+            quantized = std::min<int32_t>(127, std::max<int32_t>(-128, quantized));
+            output_row[i] = static_cast<int8_t>(quantized);
+        }
+    }
+
+    return true;
+}
+
+bool CmxDense::run_quantized_int16(const int16_t* input, const TensorShape& input_shape,
+                                   const int16_t* weights, const int64_t* bias,
+                                   const QuantParams& quant, int16_t* output) {
+    if (!is_configured_ || !input || !weights || !output) {
+        return false;
+    }
+
+    const int32_t batch_size = input_shape.batch;
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+
+    const float effective_scale =
+        quant.input_scale * quant.weight_scale / quant.output_scale;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        const int16_t* input_row = input + b * input_units;
+        int16_t* output_row = output + b * output_units;
+
+        for (int32_t i = 0; i < output_units; ++i) {
+            int64_t acc = bias ? bias[i] : 0;
+            const int16_t* weight_row = weights + i * input_units;
+
+#ifdef CMX_USE_HELIUM
+            // 8 widening MACs per beat into the 64-bit accumulator
+            acc += platform::cortex_m::mve_dot_s16(input_row, weight_row,
+                                                   input_units);
+#elif defined(CMX_USE_DSP_EXT)
+            // Packed SMLALD, two 16-bit MACs per instruction
+            acc += platform::cortex_m::dsp_dot_s16(input_row, weight_row,
+                                                   input_units);
+#elif defined(CMX_USE_HIFI)
+            // Dual-MAC AE pipeline, 4 MACs per step
+            acc += platform::xtensa::hifi_dot_s16(input_row, weight_row,
+                                                  input_units);
+#else
+            // Paired so the compiler can fuse into dual 16-bit MACs
+            int32_t j = 0;
+            for (; j + 2 <= input_units; j += 2) {
+                acc += static_cast<int64_t>(input_row[j]) *
+                       static_cast<int64_t>(weight_row[j]);
+                acc += static_cast<int64_t>(input_row[j + 1]) *
+                       static_cast<int64_t>(weight_row[j + 1]);
+            }
+            if (j < input_units) {
+                acc += static_cast<int64_t>(input_row[j]) *
+                       static_cast<int64_t>(weight_row[j]);
+            }
+#endif
+
+            int32_t quantized = static_cast<int32_t>(
+                std::llround(static_cast<double>(acc) * effective_scale));
+            quantized = std::min<int32_t>(32767,
+                                          std::max<int32_t>(-32768, quantized));
+            output_row[i] = static_cast<int16_t>(quantized);
+        }
+    }
+
+    return true;
+}
+
+bool CmxDense::run_quantized_int4(const int8_t* input, const TensorShape& input_shape,
+                                  const uint8_t* weights, const int32_t* bias,
+                                  const QuantParams& quant, int8_t* output) {
+    if (!is_configured_ || !input || !weights || !output) {
+        return false;
+    }
+
+    const int32_t batch_size = input_shape.batch;
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+    const int32_t row_bytes = (input_units + 1) / 2;
+
+    const float effective_scale =
+        quant.input_scale * quant.weight_scale / quant.output_scale;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        const int8_t* input_row = input + b * input_units;
+        int8_t* output_row = output + b * output_units;
+
+        for (int32_t i = 0; i < output_units; ++i) {
+            int32_t acc = bias ? bias[i] : 0;
+            const uint8_t* weight_row = weights + i * row_bytes;
+
+            // Two weights per fetched byte; the nibble unpack is a
+            // shift pair and never leaves registers
+            int32_t j = 0;
+            for (int32_t byte_idx = 0; byte_idx < input_units / 2; ++byte_idx) {
+                const uint8_t byte = weight_row[byte_idx];
+                acc += (static_cast<int32_t>(input_row[j]) -
+                        quant.input_zero_point) *
+                       static_cast<int32_t>(utils::unpack_int4_low(byte));
+                acc += (static_cast<int32_t>(input_row[j + 1]) -
+                        quant.input_zero_point) *
+                       static_cast<int32_t>(utils::unpack_int4_high(byte));
+                j += 2;
+            }
+            if (input_units & 1) {
+                acc += (static_cast<int32_t>(input_row[j]) -
+                        quant.input_zero_point) *
+                       static_cast<int32_t>(
+                           utils::unpack_int4_low(weight_row[row_bytes - 1]));
+            }
+
+            int32_t quantized = static_cast<int32_t>(
+                std::lround(static_cast<float>(acc) * effective_scale)) +
+                quant.output_zero_point;
+            quantized = std::min<int32_t>(127, std::max<int32_t>(-128, quantized));
+            output_row[i] = static_cast<int8_t>(quantized);
+        }
+    }
+
+    return true;
+}
+
+bool CmxDense::run_clustered(const float* input, const TensorShape& input_shape,
+                             const uint8_t* weight_indices, const float* palette,
+                             const float* bias, float* output) {
+    if (!is_configured_ || !input || !weight_indices || !palette || !output) {
+        return false;
+    }
+
+    const int32_t batch_size = input_shape.batch;
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+    const int32_t row_bytes = (input_units + 1) / 2;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        const float* input_row = input + b * input_units;
+        float* output_row = output + b * output_units;
+
+        for (int32_t i = 0; i < output_units; ++i) {
+            float acc = bias ? bias[i] : 0.0f;
+            const uint8_t* index_row = weight_indices + i * row_bytes;
+
+            // Two weights per fetched byte; the codebook spans 64 bytes
+            // so both lookups resolve in L1
+            int32_t j = 0;
+            for (int32_t byte_idx = 0; byte_idx < input_units / 2; ++byte_idx) {
+                const uint8_t byte = index_row[byte_idx];
+                acc += input_row[j] *
+                       palette[utils::unpack_palette_index(byte, false)];
+                acc += input_row[j + 1] *
+                       palette[utils::unpack_palette_index(byte, true)];
+                j += 2;
+            }
+            if (input_units & 1) {
+                acc += input_row[j] *
+                       palette[utils::unpack_palette_index(
+                           index_row[row_bytes - 1], false)];
+            }
+
+            output_row[i] = acc;
+        }
+    }
+
+    if (config_.fused_activation) {
+        if (config_.activation_type == ActivationType::SOFTMAX) {
+            apply_softmax(output, batch_size, output_units);
+        } else {
+            apply_activation(output, batch_size * output_units);
+        }
+    }
+
+    return true;
+}
+
+bool CmxDense::run_fp16(const uint16_t* input, const TensorShape& input_shape,
+                        const uint16_t* weights, const float* bias,
+                        uint16_t* output) {
+    if (!is_configured_ || !input || !weights || !output) {
+        return false;
+    }
+    if (config_.fused_activation &&
+        config_.activation_type == ActivationType::SOFTMAX) {
+        // Softmax would need an FP32 staging row; not worth it here
+        return false;
+    }
+
+    const int32_t batch_size = input_shape.batch;
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        const uint16_t* input_row = input + b * input_units;
+        uint16_t* output_row = output + b * output_units;
+
+        for (int32_t i = 0; i < output_units; ++i) {
+            float acc = bias ? bias[i] : 0.0f;
+            const uint16_t* weight_row = weights + i * input_units;
+
+            // Both operands expand half->FP32 in registers; the loads
+            // are the 16-bit fetches that halve the byte traffic
+            for (int32_t j = 0; j < input_units; ++j) {
+                acc += utils::fp16_to_float(input_row[j]) *
+                       utils::fp16_to_float(weight_row[j]);
+            }
+
+            if (config_.fused_activation) {
+                switch (config_.activation_type) {
+                    case ActivationType::RELU:
+                        acc = std::max(0.0f, acc);
+                        break;
+                    case ActivationType::RELU6:
+                        acc = std::min(6.0f, std::max(0.0f, acc));
+                        break;
+                    case ActivationType::TANH:
+                        acc = std::tanh(acc);
+                        break;
+                    case ActivationType::SIGMOID:
+                        acc = 1.0f / (1.0f + std::exp(-acc));
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            output_row[i] = utils::float_to_fp16(acc);
+        }
+    }
+
+    return true;
+}
+
 void CmxDense::apply_activation(float* data, size_t size) {
     if (!config_.fused_activation) {
         return;
@@ -192,7 +740,6 @@ void CmxDense::matmul_blocked(const float* input, const TensorShape& input_shape
     const int32_t batch_size = input_shape.batch;
     const int32_t input_units = config_.input_units;
     const int32_t output_units = config_.output_units;
-    const int32_t block_size = 64;
 
     // Initialize output with bias if present
     if (config_.use_bias && bias_) {
@@ -203,28 +750,15 @@ void CmxDense::matmul_blocked(const float* input, const TensorShape& input_shape
         std::memset(output, 0, batch_size * output_units * sizeof(float));
     }
 
-    // Blocked matrix multiplication
-    for (int32_t b = 0; b < batch_size; ++b) {
-        for (int32_t ii = 0; ii < output_units; ii += block_size) {
-            for (int32_t jj = 0; jj < input_units; jj += block_size) {
-                int32_t i_end = std::min(ii + block_size, output_units);
-                int32_t j_end = std::min(jj + block_size, input_units);
-                
-                for (int32_t i = ii; i < i_end; ++i) {
-                    float sum = 0.0f;
-                    for (int32_t j = jj; j < j_end; ++j) {
-                        if (config_.transpose_weights) {
-                            sum += input[b * input_units + j] * weights_[i * input_units + j];
-                        } else {
-                            sum += input[b * input_units + j] * weights_[j * output_units + i];
-                        }
-                    }
-                    output[b * output_units + i] += sum;
-                }
-            }
-        }
-    }
-    
+    // Blocked matrix multiplication through the shared register-tiled
+    // GEMM core (its K block inherits CMX_DENSE_BLOCK_SIZE by default)
+    gemm_f32(batch_size, output_units, input_units,
+             input, input_units,
+             weights_,
+             config_.transpose_weights ? input_units : output_units,
+             config_.transpose_weights,
+             output, output_units, true);
+
     // Apply activation
     if (config_.fused_activation) {
         if (config_.activation_type == ActivationType::SOFTMAX) {
@@ -237,9 +771,93 @@ void CmxDense::matmul_blocked(const float* input, const TensorShape& input_shape
 
 void CmxDense::matmul_simd(const float* input, const TensorShape& input_shape,
                           float* output, const TensorShape& output_shape) {
-    // SIMD optimized implementation would go here
-    // For now, fall back to naive implementation
-    matmul_naive(input, input_shape, output, output_shape);
+    // The shared GEMM core's packed microkernel auto-vectorizes (and
+    // takes ISA-specific microkernels), so it is the SIMD path
+    matmul_blocked(input, input_shape, output, output_shape);
+}
+
+void CmxDense::gemv(const float* input, float* output) {
+    const int32_t input_units = config_.input_units;
+    const int32_t output_units = config_.output_units;
+
+    int32_t i = 0;
+#ifdef __ARM_NEON
+    // Four weight rows share each loaded input vector, so the
+    // multiply-accumulate units see four independent dependency chains
+    // instead of the single chain a row-at-a-time loop offers
+    for (; i + 4 <= output_units; i += 4) {
+        const float* w0 = weights_ + static_cast<size_t>(i) * input_units;
+        const float* w1 = w0 + input_units;
+        const float* w2 = w1 + input_units;
+        const float* w3 = w2 + input_units;
+
+        // Start pulling the next block's rows while this one computes;
+        // sequential row layout lets the hardware prefetcher follow
+        __builtin_prefetch(w3 + input_units);
+        __builtin_prefetch(w3 + 2 * input_units);
+
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+        float32x4_t acc2 = vdupq_n_f32(0.0f);
+        float32x4_t acc3 = vdupq_n_f32(0.0f);
+
+        int32_t j = 0;
+        for (; j + 4 <= input_units; j += 4) {
+            const float32x4_t x = vld1q_f32(input + j);
+            acc0 = vmlaq_f32(acc0, x, vld1q_f32(w0 + j));
+            acc1 = vmlaq_f32(acc1, x, vld1q_f32(w1 + j));
+            acc2 = vmlaq_f32(acc2, x, vld1q_f32(w2 + j));
+            acc3 = vmlaq_f32(acc3, x, vld1q_f32(w3 + j));
+        }
+
+        // Two pairwise-add rounds fold all four accumulators down to
+        // one lane per row
+        const float32x2_t s01 = vpadd_f32(
+            vpadd_f32(vget_low_f32(acc0), vget_high_f32(acc0)),
+            vpadd_f32(vget_low_f32(acc1), vget_high_f32(acc1)));
+        const float32x2_t s23 = vpadd_f32(
+            vpadd_f32(vget_low_f32(acc2), vget_high_f32(acc2)),
+            vpadd_f32(vget_low_f32(acc3), vget_high_f32(acc3)));
+        float sums[4];
+        vst1_f32(sums, s01);
+        vst1_f32(sums + 2, s23);
+
+        for (; j < input_units; ++j) {
+            const float x = input[j];
+            sums[0] += x * w0[j];
+            sums[1] += x * w1[j];
+            sums[2] += x * w2[j];
+            sums[3] += x * w3[j];
+        }
+
+        // Epilogue inline while the sums are still in registers
+        for (int32_t lane = 0; lane < 4; ++lane) {
+            float value = sums[lane];
+            if (config_.use_bias && bias_) {
+                value += bias_[i + lane];
+            }
+            output[i + lane] = value;
+        }
+    }
+#endif
+
+    // Scalar path doubles as the remainder loop after the NEON blocks
+    for (; i < output_units; ++i) {
+        const float* w = weights_ + static_cast<size_t>(i) * input_units;
+        float sum = config_.use_bias && bias_ ? bias_[i] : 0.0f;
+        for (int32_t j = 0; j < input_units; ++j) {
+            sum += input[j] * w[j];
+        }
+        output[i] = sum;
+    }
+
+    if (config_.fused_activation) {
+        if (config_.activation_type == ActivationType::SOFTMAX) {
+            apply_softmax(output, 1, output_units);
+        } else {
+            apply_activation(output, static_cast<size_t>(output_units));
+        }
+    }
 }
 
 void CmxDense::vector_add_bias(float* output, const float* bias, size_t size) {
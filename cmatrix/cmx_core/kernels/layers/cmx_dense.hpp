@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
+#include <vector>
 
 namespace cmx {
 namespace kernels {
@@ -35,6 +37,8 @@ public:
         bool fused_activation;      ///< Whether to apply activation
         ActivationType activation_type;
         bool transpose_weights;     ///< Whether weights are transposed
+        bool prepack_weights;       ///< Pack weights into blocked panels at configure()
+        bool cache_transposed;      ///< Cache a contiguous transposed copy at configure()
     };
 
     /**
@@ -68,6 +72,28 @@ public:
     bool run(const float* input, const TensorShape& input_shape,
              float* output, const TensorShape& output_shape);
 
+    /**
+     * @brief Execute a slice of the output units
+     *
+     * Computes output units [unit_begin, unit_end) only, so one large
+     * layer can be partitioned into scheduler range tasks running on
+     * separate cores. Slices write disjoint output columns and share
+     * only read-only state, making concurrent calls with
+     * non-overlapping ranges safe. SOFTMAX couples all output units
+     * and cannot be sliced; partial-range calls reject it.
+     *
+     * @param input Input tensor data [batch x input_units]
+     * @param input_shape Input tensor shape
+     * @param output Output tensor data [batch x output_units]
+     * @param output_shape Output tensor shape
+     * @param unit_begin First output unit (inclusive)
+     * @param unit_end Last output unit (exclusive)
+     * @return Success status
+     */
+    bool run_range(const float* input, const TensorShape& input_shape,
+                   float* output, const TensorShape& output_shape,
+                   int32_t unit_begin, int32_t unit_end);
+
     /**
      * @brief Infer output shape from input shape and configuration
      * @param input_shape Input tensor shape
@@ -86,16 +112,163 @@ public:
     bool get_memory_requirements(const TensorShape& input_shape,
                                 size_t& weight_memory, size_t& workspace_memory);
 
+    /**
+     * @brief Quantization parameters for the INT8 path
+     */
+    struct QuantParams {
+        float input_scale;
+        int32_t input_zero_point;
+        float weight_scale;
+        float output_scale;
+        int32_t output_zero_point;
+    };
+
+    /**
+     * @brief Execute the Dense layer on INT8 data
+     *
+     * Uses the CMSIS-NN fully connected kernel when the library is
+     * available, otherwise falls back to a portable reference loop.
+     *
+     * @param input INT8 input tensor data [batch x input_units]
+     * @param input_shape Input tensor shape
+     * @param weights INT8 weight matrix [output_units x input_units]
+     * @param bias INT32 bias vector [output_units] (may be null)
+     * @param quant Quantization parameters
+     * @param output INT8 output tensor data [batch x output_units]
+     * @return Success status
+     */
+    bool run_quantized(const int8_t* input, const TensorShape& input_shape,
+                       const int8_t* weights, const int32_t* bias,
+                       const QuantParams& quant, int8_t* output);
+
+    /**
+     * @brief Execute the Dense layer on INT16 data
+     *
+     * For the audio models that need int16 accuracy and can't drop to
+     * int8. Quantization is symmetric: the zero points in quant are
+     * ignored and treated as zero, which keeps the inner loop a plain
+     * dot product and lets the packed dual 16-bit MAC paths (SMLALD on
+     * Cortex-M4/M7 under CMX_USE_DSP_EXT, Helium vmlaldavaq, the HiFi
+     * AE pipeline) consume operand pairs directly. Accumulation is
+     * 64-bit: one 16x16 product fills 30 bits, so the int8 path's
+     * int32 accumulator would wrap over audio-length rows.
+     *
+     * @param input INT16 input tensor data [batch x input_units]
+     * @param input_shape Input tensor shape
+     * @param weights INT16 weight matrix [output_units x input_units]
+     * @param bias INT64 bias vector [output_units] (may be null)
+     * @param quant Quantization parameters (zero points must be zero)
+     * @param output INT16 output tensor data [batch x output_units]
+     * @return Success status
+     */
+    bool run_quantized_int16(const int16_t* input, const TensorShape& input_shape,
+                             const int16_t* weights, const int64_t* bias,
+                             const QuantParams& quant, int16_t* output);
+
+    /**
+     * @brief Execute the Dense layer with 4-bit packed weights
+     *
+     * Weights stay packed two-per-byte in flash/RAM and nibbles are
+     * sign-extended in registers inside the inner loop, halving weight
+     * footprint and fetch bandwidth. Each weight row is packed
+     * independently with a row stride of (input_units + 1) / 2 bytes,
+     * so rows always start on a byte boundary.
+     *
+     * @param input INT8 input tensor data [batch x input_units]
+     * @param input_shape Input tensor shape
+     * @param weights INT4 packed weight matrix [output_units x input_units]
+     * @param bias INT32 bias vector [output_units] (may be null)
+     * @param quant Quantization parameters
+     * @param output INT8 output tensor data [batch x output_units]
+     * @return Success status
+     */
+    bool run_quantized_int4(const int8_t* input, const TensorShape& input_shape,
+                            const uint8_t* weights, const int32_t* bias,
+                            const QuantParams& quant, int8_t* output);
+
+    /**
+     * @brief Execute the Dense layer with clustered (palettized) weights
+     *
+     * Weights stay in flash as 4-bit indices (two per byte, same row
+     * packing as the int4 path) into a 16-entry float codebook learned
+     * at export time, reaching ~3.5 bits/weight after entropy in the
+     * index stream. Each fetch is one nibble unpack and one table
+     * lookup; the codebook fits in four cache lines, so the lookups
+     * stay in L1 and the arithmetic matches the float path exactly.
+     * SOFTMAX is supported - outputs are plain floats.
+     *
+     * @param input FP32 input tensor data [batch x input_units]
+     * @param input_shape Input tensor shape
+     * @param weight_indices Packed index matrix [output_units x input_units]
+     * @param palette Codebook, utils::PALETTE_SIZE floats
+     * @param bias FP32 bias vector [output_units] (may be null)
+     * @param output FP32 output tensor data [batch x output_units]
+     * @return Success status
+     */
+    bool run_clustered(const float* input, const TensorShape& input_shape,
+                       const uint8_t* weight_indices, const float* palette,
+                       const float* bias, float* output);
+
+    /**
+     * @brief Execute the Dense layer with FP16-stored tensors
+     *
+     * Weights and activations stay in IEEE half in flash/RAM, halving
+     * byte traffic on bandwidth-bound float models, and each element is
+     * expanded to FP32 in registers inside the inner loop so the
+     * arithmetic keeps full single precision (targets with FPU half
+     * conversion do the expand in one instruction). Bias stays FP32:
+     * it is read once per output unit, so the conversion saves nothing.
+     * SOFTMAX is not supported on this path.
+     *
+     * @param input FP16 input tensor data [batch x input_units]
+     * @param input_shape Input tensor shape
+     * @param weights FP16 weight matrix [output_units x input_units]
+     * @param bias FP32 bias vector [output_units] (may be null)
+     * @param output FP16 output tensor data [batch x output_units]
+     * @return Success status
+     */
+    bool run_fp16(const uint16_t* input, const TensorShape& input_shape,
+                  const uint16_t* weights, const float* bias,
+                  uint16_t* output);
+
 private:
+    /// Output units per packed panel; sized for 8 accumulator registers
+    static constexpr int32_t kPackPanel = 8;
+
     Config config_;
     const float* weights_;
     const float* bias_;
     bool is_configured_;
+    std::vector<float> packed_weights_;      ///< Panel-blocked weight copy
+    std::vector<float> transposed_weights_;  ///< Cached transposed weight copy
 
     // Helper methods
     void apply_activation(float* data, size_t size);
     void apply_softmax(float* data, size_t batch_size, size_t features);
-    
+
+    /**
+     * @brief One-time weight pack into panel-blocked layout
+     *
+     * Rearranges the weight matrix into panels of kPackPanel output
+     * units, with the input dimension innermost per panel, so the
+     * matmul inner loop reads both operands sequentially.
+     */
+    void pack_weights();
+
+    /**
+     * @brief One-time transpose into the contiguous-traversal layout
+     *
+     * Decoder-style models feed the same weight matrix through Dense
+     * layers in both orientations; the [input x output] orientation
+     * makes the GEMV inner loop stride by output_units per tap. This
+     * builds a [output x input] copy once at configure() so every path
+     * reads weights sequentially, and rewrites config_ to the
+     * transposed orientation. The copy is counted in
+     * get_memory_requirements' weight_memory so the memory planner
+     * places it with the other read-only weight data (flash-spillable).
+     */
+    void cache_transposed_weights();
+
     // Optimized matrix multiplication implementations
     void matmul_naive(const float* input, const TensorShape& input_shape,
                       float* output, const TensorShape& output_shape);
@@ -103,6 +276,21 @@ private:
                        float* output, const TensorShape& output_shape);
     void matmul_simd(const float* input, const TensorShape& input_shape,
                      float* output, const TensorShape& output_shape);
+    void matmul_packed(const float* input, const TensorShape& input_shape,
+                       float* output, const TensorShape& output_shape);
+
+    /**
+     * @brief Dedicated batch-1 GEMV microkernel (the classifier head)
+     *
+     * A batch-1 Dense is a matrix-vector product, and running it as a
+     * degenerate GEMM leaves most of the accumulators idle. This path
+     * accumulates four weight rows against each loaded input vector,
+     * prefetches the next rows while the current block computes, and
+     * applies the bias/activation epilogue inline on the single output
+     * row. Requires the contiguous [output x input] weight orientation
+     * (see cache_transposed_weights).
+     */
+    void gemv(const float* input, float* output);
     
     // Vector operations
     void vector_add_bias(float* output, const float* bias, size_t size);
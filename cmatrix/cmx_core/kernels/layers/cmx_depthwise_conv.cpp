@@ -43,6 +43,23 @@ bool CmxDepthwiseConv::run(const float* input, const TensorShape& input_shape,
         return false;
     }
 
+    // NHWC with depth_multiplier 1 (the common mobile-net shape) takes
+    // the channel-innermost register-blocked path; 3x3 stride-1/2 gets
+    // the fully unrolled variant. Everything else falls back to the
+    // spatial-inner reference loop.
+    if (config_.data_layout == DataLayout::NHWC && config_.depth_multiplier == 1) {
+        if (config_.kernel_size[0] == 3 && config_.kernel_size[1] == 3 &&
+            config_.dilation[0] == 1 && config_.dilation[1] == 1 &&
+            config_.strides[0] == config_.strides[1] &&
+            (config_.strides[0] == 1 || config_.strides[0] == 2)) {
+            depthwise_conv_nhwc_3x3(input, input_shape, output, output_shape,
+                                    config_.strides[0]);
+        } else {
+            depthwise_conv_nhwc(input, input_shape, output, output_shape);
+        }
+        return true;
+    }
+
     // Choose implementation based on hardware capabilities
     #ifdef __ARM_NEON
         depthwise_conv_simd(input, input_shape, output, output_shape);
@@ -132,6 +149,19 @@ void CmxDepthwiseConv::apply_activation(float* data, size_t size) {
                 data[i] = std::tanh(data[i]);
             }
             break;
+        case 4: // Hard Sigmoid: max(0, min(1, 0.2 * x + 0.5)),
+                // matching the standalone activations::hard_sigmoid node
+            for (size_t i = 0; i < size; ++i) {
+                data[i] = std::min(1.0f, std::max(0.0f, 0.2f * data[i] + 0.5f));
+            }
+            break;
+        case 5: // Hard Swish: x * hard_sigmoid(x), the MobileNetV3
+                // epilogue; piecewise-linear, so no exp in the loop
+            for (size_t i = 0; i < size; ++i) {
+                const float x = data[i];
+                data[i] = x * std::min(1.0f, std::max(0.0f, 0.2f * x + 0.5f));
+            }
+            break;
         default:
             break;
     }
@@ -195,6 +225,161 @@ void CmxDepthwiseConv::depthwise_conv_direct(const float* input, const TensorSha
     }
 }
 
+namespace {
+// Channel accumulators held live across all taps of one output pixel.
+// 8 floats fits the register budget of every supported core once the
+// input vector and a weight lane are in flight.
+constexpr int32_t kDwChannelBlock = 8;
+} // namespace
+
+void CmxDepthwiseConv::depthwise_conv_nhwc(const float* input, const TensorShape& input_shape,
+                                          float* output, const TensorShape& output_shape) {
+    const int32_t batch_size = input_shape.batch;
+    const int32_t in_height = input_shape.height;
+    const int32_t in_width = input_shape.width;
+    const int32_t channels = input_shape.channels;
+
+    const int32_t out_height = output_shape.height;
+    const int32_t out_width = output_shape.width;
+
+    const int32_t kh_size = config_.kernel_size[0];
+    const int32_t kw_size = config_.kernel_size[1];
+    const int32_t taps = kh_size * kw_size;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        for (int32_t oh = 0; oh < out_height; ++oh) {
+            for (int32_t ow = 0; ow < out_width; ++ow) {
+                float* out_px = output + ((b * out_height + oh) * out_width + ow) * channels;
+
+                for (int32_t c0 = 0; c0 < channels; c0 += kDwChannelBlock) {
+                    const int32_t cn = std::min(kDwChannelBlock, channels - c0);
+                    float acc[kDwChannelBlock];
+
+                    if (config_.use_bias && bias_) {
+                        for (int32_t j = 0; j < cn; ++j) {
+                            acc[j] = bias_[c0 + j];
+                        }
+                    } else {
+                        for (int32_t j = 0; j < cn; ++j) {
+                            acc[j] = 0.0f;
+                        }
+                    }
+
+                    for (int32_t kh = 0; kh < kh_size; ++kh) {
+                        const int32_t ih = oh * config_.strides[0] + kh * config_.dilation[0] - config_.padding[0];
+                        if (ih < 0 || ih >= in_height) {
+                            continue;
+                        }
+                        for (int32_t kw = 0; kw < kw_size; ++kw) {
+                            const int32_t iw = ow * config_.strides[1] + kw * config_.dilation[1] - config_.padding[2];
+                            if (iw < 0 || iw >= in_width) {
+                                continue;
+                            }
+
+                            // Contiguous NHWC channel vector: one load per
+                            // lane, every lane consumed
+                            const float* in_px = input + ((b * in_height + ih) * in_width + iw) * channels + c0;
+                            const int32_t tap = kh * kw_size + kw;
+                            for (int32_t j = 0; j < cn; ++j) {
+                                acc[j] += in_px[j] * weights_[(c0 + j) * taps + tap];
+                            }
+                        }
+                    }
+
+                    for (int32_t j = 0; j < cn; ++j) {
+                        out_px[c0 + j] = acc[j];
+                    }
+                }
+            }
+        }
+    }
+
+    if (config_.fused_activation) {
+        apply_activation(output, batch_size * out_height * out_width * channels);
+    }
+}
+
+void CmxDepthwiseConv::depthwise_conv_nhwc_3x3(const float* input, const TensorShape& input_shape,
+                                              float* output, const TensorShape& output_shape,
+                                              int32_t stride) {
+    const int32_t batch_size = input_shape.batch;
+    const int32_t in_height = input_shape.height;
+    const int32_t in_width = input_shape.width;
+    const int32_t channels = input_shape.channels;
+
+    const int32_t out_height = output_shape.height;
+    const int32_t out_width = output_shape.width;
+
+    for (int32_t b = 0; b < batch_size; ++b) {
+        for (int32_t oh = 0; oh < out_height; ++oh) {
+            const int32_t ih0 = oh * stride - config_.padding[0];
+            const bool interior_h = (ih0 >= 0) && (ih0 + 2 < in_height);
+
+            for (int32_t ow = 0; ow < out_width; ++ow) {
+                const int32_t iw0 = ow * stride - config_.padding[2];
+                const bool interior = interior_h && (iw0 >= 0) && (iw0 + 2 < in_width);
+                float* out_px = output + ((b * out_height + oh) * out_width + ow) * channels;
+
+                for (int32_t c0 = 0; c0 < channels; c0 += kDwChannelBlock) {
+                    const int32_t cn = std::min(kDwChannelBlock, channels - c0);
+                    float acc[kDwChannelBlock];
+
+                    if (config_.use_bias && bias_) {
+                        for (int32_t j = 0; j < cn; ++j) {
+                            acc[j] = bias_[c0 + j];
+                        }
+                    } else {
+                        for (int32_t j = 0; j < cn; ++j) {
+                            acc[j] = 0.0f;
+                        }
+                    }
+
+                    if (interior) {
+                        // All nine taps in bounds: constant trip counts,
+                        // no per-tap branches, rows walked by pointer
+                        for (int32_t kh = 0; kh < 3; ++kh) {
+                            const float* row = input + ((b * in_height + ih0 + kh) * in_width + iw0) * channels + c0;
+                            for (int32_t kw = 0; kw < 3; ++kw) {
+                                const float* in_px = row + kw * channels;
+                                const int32_t tap = kh * 3 + kw;
+                                for (int32_t j = 0; j < cn; ++j) {
+                                    acc[j] += in_px[j] * weights_[(c0 + j) * 9 + tap];
+                                }
+                            }
+                        }
+                    } else {
+                        for (int32_t kh = 0; kh < 3; ++kh) {
+                            const int32_t ih = ih0 + kh;
+                            if (ih < 0 || ih >= in_height) {
+                                continue;
+                            }
+                            for (int32_t kw = 0; kw < 3; ++kw) {
+                                const int32_t iw = iw0 + kw;
+                                if (iw < 0 || iw >= in_width) {
+                                    continue;
+                                }
+                                const float* in_px = input + ((b * in_height + ih) * in_width + iw) * channels + c0;
+                                const int32_t tap = kh * 3 + kw;
+                                for (int32_t j = 0; j < cn; ++j) {
+                                    acc[j] += in_px[j] * weights_[(c0 + j) * 9 + tap];
+                                }
+                            }
+                        }
+                    }
+
+                    for (int32_t j = 0; j < cn; ++j) {
+                        out_px[c0 + j] = acc[j];
+                    }
+                }
+            }
+        }
+    }
+
+    if (config_.fused_activation) {
+        apply_activation(output, batch_size * out_height * out_width * channels);
+    }
+}
+
 void CmxDepthwiseConv::depthwise_conv_simd(const float* input, const TensorShape& input_shape,
                                          float* output, const TensorShape& output_shape) {
     // SIMD optimized implementation would go here
@@ -243,4 +428,6 @@ void CmxDepthwiseConv::process_channel(const float* input_channel, float* output
             }
         }
     }
-}
\ No newline at end of file
+}
+} // namespace kernels
+} // namespace cmx
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <array>
 
@@ -45,7 +46,8 @@ public:
         int32_t depth_multiplier;               ///< Number of filters per input channel
         bool use_bias;
         bool fused_activation;
-        int32_t activation_type;                ///< 0: none, 1: relu, 2: relu6, 3: tanh
+        int32_t activation_type;                ///< 0: none, 1: relu, 2: relu6, 3: tanh,
+                                                ///< 4: hard_sigmoid, 5: hard_swish
     };
 
     /**
@@ -115,6 +117,15 @@ private:
                               float* output, const TensorShape& output_shape);
     void depthwise_conv_simd(const float* input, const TensorShape& input_shape,
                             float* output, const TensorShape& output_shape);
+
+    // NHWC register-blocked implementations: channels innermost so every
+    // load of a channel vector is fully consumed, with a block of channel
+    // accumulators carried across all kernel taps before storing
+    void depthwise_conv_nhwc(const float* input, const TensorShape& input_shape,
+                            float* output, const TensorShape& output_shape);
+    void depthwise_conv_nhwc_3x3(const float* input, const TensorShape& input_shape,
+                                float* output, const TensorShape& output_shape,
+                                int32_t stride);
     
     // Channel-wise processing
     void process_channel(const float* input_channel, float* output_channel,
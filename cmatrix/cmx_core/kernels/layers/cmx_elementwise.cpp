@@ -0,0 +1,210 @@
+#include "cmx_elementwise.hpp"
+#include "cmx_kernel_registry.hpp"
+#include "../../ops/cmx_op_manifest.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace cmx {
+namespace kernels {
+
+namespace {
+
+/// @brief Activation epilogue evaluated in the same pass as the op
+inline float activate(float v, ActivationType activation) {
+    switch (activation) {
+        case ActivationType::RELU:
+            return v > 0.0f ? v : 0.0f;
+        case ActivationType::RELU6:
+            return std::min(6.0f, std::max(0.0f, v));
+        case ActivationType::TANH:
+            return std::tanh(v);
+        case ActivationType::SIGMOID:
+            return 1.0f / (1.0f + std::exp(-v));
+        case ActivationType::SWISH:
+            return v / (1.0f + std::exp(-v));
+        case ActivationType::NONE:
+        default:
+            return v;
+    }
+}
+
+inline float apply_op(float a, float b, ElementwiseOp op) {
+    switch (op) {
+        case ElementwiseOp::ADD: return a + b;
+        case ElementwiseOp::SUB: return a - b;
+        case ElementwiseOp::MUL: return a * b;
+    }
+    return a;
+}
+
+} // namespace
+
+CmxElementwise::CmxElementwise()
+    : broadcast_(BroadcastKind::NONE), total_elements_(0), channels_(0),
+      configured_(false) {}
+
+CmxElementwise::~CmxElementwise() = default;
+
+KernelStatus CmxElementwise::classify_broadcast(
+    const TensorShape& lhs,
+    const TensorShape& rhs
+) {
+    if (rhs.total_size() == 1) {
+        broadcast_ = BroadcastKind::SCALAR;
+        return KernelStatus::SUCCESS;
+    }
+
+    if (lhs.dims == rhs.dims) {
+        broadcast_ = BroadcastKind::NONE;
+        return KernelStatus::SUCCESS;
+    }
+
+    // Per-channel: rhs spans exactly the last axis of lhs (a [C] vector
+    // against an NHWC activation, the residual-scale case)
+    if (lhs.rank() >= 1 && rhs.total_size() == lhs.dims.back()) {
+        broadcast_ = BroadcastKind::PER_CHANNEL;
+        channels_ = lhs.dims.back();
+        return KernelStatus::SUCCESS;
+    }
+
+    return KernelStatus::SHAPE_MISMATCH;
+}
+
+KernelStatus CmxElementwise::configure(
+    DescriptorSpan inputs,
+    DescriptorList& outputs,
+    const void* params
+) {
+    if (!params || !validate_input_count(inputs, 2)) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    params_ = *static_cast<const ElementwiseParams*>(params);
+
+    KernelStatus status = classify_broadcast(inputs[0].shape, inputs[1].shape);
+    if (status != KernelStatus::SUCCESS) {
+        return status;
+    }
+
+    total_elements_ = inputs[0].shape.total_size();
+    if (total_elements_ <= 0) {
+        return KernelStatus::SHAPE_MISMATCH;
+    }
+
+    if (outputs.empty()) {
+        outputs.resize(1);
+    }
+    outputs[0].shape = inputs[0].shape;
+    outputs[0].dtype = inputs[0].dtype;
+
+    configured_ = true;
+    return KernelStatus::SUCCESS;
+}
+
+void CmxElementwise::run_range(
+    const float* lhs,
+    const float* rhs,
+    float* output,
+    int32_t begin,
+    int32_t end
+) const {
+    const ElementwiseOp op = params_.op;
+    const ActivationType act = params_.activation;
+
+    switch (broadcast_) {
+        case BroadcastKind::NONE:
+            // Both operands walk the same flat range: no index math,
+            // just three streaming pointers
+            for (int32_t i = begin; i < end; ++i) {
+                output[i] = activate(apply_op(lhs[i], rhs[i], op), act);
+            }
+            break;
+
+        case BroadcastKind::SCALAR: {
+            // Splat the single rhs value out of the loop entirely
+            const float b = rhs[0];
+            for (int32_t i = begin; i < end; ++i) {
+                output[i] = activate(apply_op(lhs[i], b, op), act);
+            }
+            break;
+        }
+
+        case BroadcastKind::PER_CHANNEL: {
+            // rhs repeats along the last axis; track the channel with a
+            // counter instead of a division per element
+            int32_t c = begin % channels_;
+            for (int32_t i = begin; i < end; ++i) {
+                output[i] = activate(apply_op(lhs[i], rhs[c], op), act);
+                if (++c == channels_) {
+                    c = 0;
+                }
+            }
+            break;
+        }
+    }
+}
+
+KernelStatus CmxElementwise::run(
+    const void* const* inputs,
+    void* const* outputs
+) {
+    if (!configured_ || !inputs || !outputs ||
+        !inputs[0] || !inputs[1] || !outputs[0]) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    run_range(static_cast<const float*>(inputs[0]),
+              static_cast<const float*>(inputs[1]),
+              static_cast<float*>(outputs[0]),
+              0, total_elements_);
+    return KernelStatus::SUCCESS;
+}
+
+KernelStatus CmxElementwise::run_split(
+    const void* const* inputs,
+    void* const* outputs,
+    int32_t begin,
+    int32_t end
+) {
+    if (!configured_ || !inputs || !outputs ||
+        !inputs[0] || !inputs[1] || !outputs[0]) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+    if (begin < 0 || end > total_elements_ || begin >= end) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    run_range(static_cast<const float*>(inputs[0]),
+              static_cast<const float*>(inputs[1]),
+              static_cast<float*>(outputs[0]),
+              begin, end);
+    return KernelStatus::SUCCESS;
+}
+
+std::vector<TensorShape> CmxElementwise::infer_shape(
+    const std::vector<TensorShape>& input_shapes,
+    const void* params
+) {
+    (void)params;
+    if (input_shapes.empty()) {
+        return {};
+    }
+    return {input_shapes[0]};
+}
+
+bool CmxElementwise::supports_dtype(DataType dtype) const {
+    return dtype == DataType::FLOAT32;
+}
+
+int32_t CmxElementwise::split_extent() const {
+    return total_elements_;
+}
+
+// Register the kernel (skipped in manifest builds that use none of the
+// binary elementwise ops)
+#if CMX_NEED_OP_ADD || CMX_NEED_OP_SUB || CMX_NEED_OP_MUL
+REGISTER_KERNEL(CmxElementwise, KernelType::ELEMENTWISE, 0);
+#endif
+
+} // namespace kernels
+} // namespace cmx
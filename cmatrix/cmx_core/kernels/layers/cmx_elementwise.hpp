@@ -0,0 +1,176 @@
+#pragma once
+
+#include "cmx_conv2d.hpp"
+#include <cstdint>
+
+namespace cmx {
+namespace kernels {
+
+/**
+ * @brief Binary elementwise operation selection
+ */
+enum class ElementwiseOp {
+    ADD,
+    SUB,
+    MUL
+};
+
+/**
+ * @brief Broadcast pattern resolved at configure time
+ *
+ * Residual adds and scale layers only ever use three broadcast shapes,
+ * so the pattern is classified once and each run() takes a loop with no
+ * per-element index arithmetic at all.
+ */
+enum class BroadcastKind {
+    NONE,         ///< Both operands have identical shapes
+    PER_CHANNEL,  ///< Second operand is a [C] vector over the last axis
+    SCALAR        ///< Second operand is a single value
+};
+
+/**
+ * @brief Configuration parameters for binary elementwise layers
+ */
+struct ElementwiseParams {
+    ElementwiseOp op;
+
+    // Fused activation epilogue, applied in the same pass over the
+    // output (the fusion pass folds a following activation node here)
+    ActivationType activation;
+
+    ElementwiseParams()
+        : op(ElementwiseOp::ADD)
+        , activation(ActivationType::NONE)
+    {}
+};
+
+/**
+ * @brief Binary elementwise layer (add / sub / mul)
+ *
+ * Dedicated kernel for the skip-connection adds and scale layers that
+ * generic broadcast code handles one index computation at a time. The
+ * broadcast pattern (none, per-channel, scalar) is specialized at
+ * configure() time, so the inner loops are plain flat traversals and
+ * the optional activation is evaluated in the same pass.
+ */
+class CmxElementwise : public CmxKernel {
+public:
+    CmxElementwise();
+    ~CmxElementwise() override;
+
+    /**
+     * @brief Configure the elementwise layer
+     *
+     * Classifies the broadcast pattern from the two input shapes.
+     * Shapes that match none of the supported patterns are rejected;
+     * general broadcasting stays on the fallback op path.
+     *
+     * @param inputs Input tensor descriptors (lhs, rhs)
+     * @param outputs Output tensor descriptors (output)
+     * @param params ElementwiseParams structure
+     * @return KernelStatus indicating success or failure
+     */
+    KernelStatus configure(
+        DescriptorSpan inputs,
+        DescriptorList& outputs,
+        const void* params
+    ) override;
+
+    /**
+     * @brief Execute the elementwise computation
+     *
+     * @param inputs Input data pointers (lhs, rhs)
+     * @param outputs Output data pointers (output)
+     * @return KernelStatus indicating success or failure
+     */
+    KernelStatus run(
+        const void* const* inputs,
+        void* const* outputs
+    ) override;
+
+    /**
+     * @brief Infer output shape from input shapes
+     *
+     * The output always takes the lhs (non-broadcast) shape.
+     */
+    std::vector<TensorShape> infer_shape(
+        const std::vector<TensorShape>& input_shapes,
+        const void* params
+    ) override;
+
+    /**
+     * @brief Get kernel type identifier
+     * @return "elementwise"
+     */
+    const char* get_type() const override { return "elementwise"; }
+
+    /**
+     * @brief Check data type support
+     * @param dtype Data type to check
+     * @return True if supported
+     */
+    bool supports_dtype(DataType dtype) const override;
+
+    /**
+     * @brief Each element is read once and written once
+     * @return True
+     */
+    bool supports_inplace() const override { return true; }
+
+    /**
+     * @brief Every output element is written
+     * @return True
+     */
+    bool writes_all_outputs() const override { return true; }
+
+    /**
+     * @brief Elements are independent and can be partitioned
+     * @return Total output element count
+     */
+    int32_t split_extent() const override;
+
+    /**
+     * @brief Compute output elements [begin, end) only
+     *
+     * Slices write disjoint flat ranges of the output, so concurrent
+     * slices are safe for every broadcast pattern.
+     */
+    KernelStatus run_split(
+        const void* const* inputs,
+        void* const* outputs,
+        int32_t begin,
+        int32_t end
+    ) override;
+
+private:
+    ElementwiseParams params_;
+    BroadcastKind broadcast_;
+    int32_t total_elements_;
+    int32_t channels_;       ///< Last-axis extent for PER_CHANNEL
+    bool configured_;
+
+    /**
+     * @brief Classify the broadcast pattern of the rhs against the lhs
+     * @param lhs Full-shape operand
+     * @param rhs Possibly broadcast operand
+     * @return Resolved pattern, or SHAPE_MISMATCH via the out status
+     */
+    KernelStatus classify_broadcast(
+        const TensorShape& lhs,
+        const TensorShape& rhs
+    );
+
+    /**
+     * @brief Run one flat output range with the configured specialization
+     */
+    void run_range(
+        const float* lhs,
+        const float* rhs,
+        float* output,
+        int32_t begin,
+        int32_t end
+    ) const;
+};
+
+} // namespace kernels
+} // namespace cmx
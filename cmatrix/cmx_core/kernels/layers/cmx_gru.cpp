@@ -1,4 +1,5 @@
 #include "cmx_gru.hpp"
+#include "../cmx_gemm.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -11,8 +12,14 @@ CmxGRU::CmxGRU()
     , temp_update_gate_(nullptr)
     , temp_reset_gate_(nullptr)
     , temp_new_gate_(nullptr)
-    , temp_reset_hidden_(nullptr) {
-    
+    , temp_reset_hidden_(nullptr)
+    , quantized_(false)
+    , q_hidden_state_(nullptr)
+    , q_temp_update_(nullptr)
+    , q_temp_reset_(nullptr)
+    , q_temp_new_(nullptr)
+    , q_temp_reset_hidden_(nullptr) {
+
     state_.hidden_state = nullptr;
     state_.initialized = false;
 }
@@ -22,24 +29,84 @@ CmxGRU::~CmxGRU() {
 }
 
 bool CmxGRU::configure(const Config& config, void* state_buffer, size_t state_buffer_size) {
+    // Adopt the configuration first: get_state_buffer_size() reads it
+    config_ = config;
+
     if (!state_buffer || state_buffer_size < get_state_buffer_size()) {
         return false;
     }
 
-    config_ = config;
     state_buffer_ = state_buffer;
     
     if (!initialize_state_buffer()) {
         return false;
     }
 
+    quantized_ = false;
     reset_state();
     configured_ = true;
     return true;
 }
 
+bool CmxGRU::configure_quantized(const Config& config, const QuantConfig& quant_config,
+                                 void* state_buffer, size_t state_buffer_size) {
+    // Adopt the configuration first: get_state_buffer_size() reads it
+    config_ = config;
+    quant_config_ = quant_config;
+
+    if (!state_buffer || state_buffer_size < get_state_buffer_size()) {
+        return false;
+    }
+
+    // The integer path has no per-gate fallbacks; every gate needs both
+    // weight matrices
+    const QuantGateConfig* gates[3] = {
+        &quant_config_.update_gate, &quant_config_.reset_gate, &quant_config_.new_gate
+    };
+    for (const QuantGateConfig* gate : gates) {
+        if (!gate->input_weights || !gate->hidden_weights) {
+            return false;
+        }
+    }
+
+    state_buffer_ = state_buffer;
+
+    if (!initialize_quantized_state_buffer()) {
+        return false;
+    }
+
+    // Fold every scale into one multiply-and-shift per gate branch.
+    // Accumulators carry raw INT8xINT16 products; the input branch maps
+    // them through input_scale * weight_scale to Q3.12 pre-activations,
+    // the hidden branch through the Q0.15 state scale (1/32768)
+    const uint32_t hidden_size = config_.hidden_size;
+    q_bias_.assign(static_cast<size_t>(3) * hidden_size, 0);
+
+    for (uint32_t gate = 0; gate < 3; ++gate) {
+        q_input_requant_[gate] = utils::calculate_fixed_point_scale(
+            quant_config_.input_scale * gates[gate]->input_weight_scale * 4096.0f);
+        q_hidden_requant_[gate] = utils::calculate_fixed_point_scale(
+            gates[gate]->hidden_weight_scale * (4096.0f / 32768.0f));
+
+        if (gates[gate]->bias) {
+            for (uint32_t i = 0; i < hidden_size; ++i) {
+                q_bias_[gate * hidden_size + i] =
+                    static_cast<int32_t>(lroundf(gates[gate]->bias[i] * 4096.0f));
+            }
+        }
+    }
+
+    activations::build_sigmoid_lut_q15(sigmoid_lut_);
+    activations::build_tanh_lut_q15(tanh_lut_);
+
+    quantized_ = true;
+    configured_ = true;
+    reset_state();
+    return true;
+}
+
 bool CmxGRU::run(const float* input, uint32_t sequence_length, float* output, float* final_state) {
-    if (!configured_ || !input || !output) {
+    if (!configured_ || quantized_ || !input || !output) {
         return false;
     }
 
@@ -51,27 +118,11 @@ bool CmxGRU::run(const float* input, uint32_t sequence_length, float* output, fl
     for (uint32_t t = 0; t < sequence_length; ++t) {
         for (uint32_t b = 0; b < batch_size; ++b) {
             const float* current_input = input + (t * batch_size + b) * input_size;
-            const float* prev_hidden = state_.hidden_state + b * hidden_size;
-            
-            // Compute update and reset gates
-            compute_gate(current_input, prev_hidden, config_.update_gate, temp_update_gate_);
-            compute_gate(current_input, prev_hidden, config_.reset_gate, temp_reset_gate_);
-
-            // Apply sigmoid activations to gates
-            sigmoid_inplace(temp_update_gate_, hidden_size);
-            sigmoid_inplace(temp_reset_gate_, hidden_size);
-
-            // Compute new state candidate with reset gate
-            compute_new_state(current_input, prev_hidden, temp_reset_gate_, 
-                            config_.new_gate, temp_new_gate_);
-
-            // Apply tanh activation to new state candidate
-            tanh_inplace(temp_new_gate_, hidden_size);
-
-            // Update hidden state: h_t = (1 - z_t) * h_{t-1} + z_t * n_t
             float* current_hidden = state_.hidden_state + b * hidden_size;
-            linear_interpolate(prev_hidden, temp_new_gate_, temp_update_gate_, 
-                             current_hidden, hidden_size);
+
+            // Fused step: combined gate GEMMs plus a single elementwise
+            // pass, updating the persistent hidden state in place
+            fused_timestep(current_input, current_hidden);
 
             // Copy to output if returning sequences
             if (config_.return_sequences) {
@@ -94,6 +145,45 @@ bool CmxGRU::run(const float* input, uint32_t sequence_length, float* output, fl
     return true;
 }
 
+bool CmxGRU::run_quantized(const int16_t* input, uint32_t sequence_length,
+                           int16_t* output, int16_t* final_state) {
+    if (!configured_ || !quantized_ || !input || !output) {
+        return false;
+    }
+
+    const uint32_t batch_size = config_.batch_size;
+    const uint32_t input_size = config_.input_size;
+    const uint32_t hidden_size = config_.hidden_size;
+
+    // Process each timestep
+    for (uint32_t t = 0; t < sequence_length; ++t) {
+        for (uint32_t b = 0; b < batch_size; ++b) {
+            const int16_t* current_input = input + (t * batch_size + b) * input_size;
+            int16_t* current_hidden = q_hidden_state_ + b * hidden_size;
+
+            quantized_timestep(current_input, current_hidden);
+
+            // Copy to output if returning sequences
+            if (config_.return_sequences) {
+                int16_t* output_ptr = output + (t * batch_size + b) * hidden_size;
+                std::memcpy(output_ptr, current_hidden, hidden_size * sizeof(int16_t));
+            }
+        }
+    }
+
+    // Copy final hidden state to output if not returning sequences
+    if (!config_.return_sequences) {
+        std::memcpy(output, q_hidden_state_, batch_size * hidden_size * sizeof(int16_t));
+    }
+
+    // Copy final state if requested
+    if (config_.return_state && final_state) {
+        std::memcpy(final_state, q_hidden_state_, batch_size * hidden_size * sizeof(int16_t));
+    }
+
+    return true;
+}
+
 bool CmxGRU::infer_shape(const uint32_t* input_shape, uint32_t* output_shape) {
     if (!input_shape || !output_shape) {
         return false;
@@ -119,8 +209,12 @@ void CmxGRU::reset_state() {
     const uint32_t state_size = batch_size * hidden_size;
 
     // Zero initialize state
-    std::memset(state_.hidden_state, 0, state_size * sizeof(float));
-    
+    if (quantized_) {
+        std::memset(q_hidden_state_, 0, state_size * sizeof(int16_t));
+    } else {
+        std::memset(state_.hidden_state, 0, state_size * sizeof(float));
+    }
+
     state_.initialized = true;
 }
 
@@ -136,10 +230,12 @@ size_t CmxGRU::get_state_buffer_size() const {
     
     // Temporary gate buffers
     size += 4 * hidden_size * sizeof(float);  // update, reset, new, reset_hidden
-    
+
     // Alignment padding
     size += 32; // Conservative alignment padding
-    
+
+    // The quantized layout (INT16 state, three INT32 accumulators, one
+    // INT16 scratch) is strictly smaller, so one size covers both paths
     return size;
 }
 
@@ -148,7 +244,7 @@ const float* CmxGRU::get_hidden_state() const {
 }
 
 bool CmxGRU::set_initial_state(const float* initial_state) {
-    if (!configured_ || !initial_state) {
+    if (!configured_ || quantized_ || !initial_state) {
         return false;
     }
 
@@ -162,102 +258,194 @@ bool CmxGRU::set_initial_state(const float* initial_state) {
     return true;
 }
 
-void CmxGRU::compute_gate(const float* input, const float* hidden, 
-                         const GateConfig& gate_config, float* output) {
+void CmxGRU::accumulate_matvec(const float* weights, const float* vec,
+                               uint32_t rows, uint32_t cols, float* output) {
+    // Hot loop lives in the shared register-tiled GEMM core
+    gemv_f32(weights, vec,
+             static_cast<int32_t>(rows), static_cast<int32_t>(cols),
+             output, true);
+}
+
+void CmxGRU::fused_timestep(const float* input, float* hidden) {
     const uint32_t input_size = config_.input_size;
     const uint32_t hidden_size = config_.hidden_size;
 
-    // Initialize output with bias
-    if (gate_config.bias) {
-        std::memcpy(output, gate_config.bias, hidden_size * sizeof(float));
-    } else {
-        std::memset(output, 0, hidden_size * sizeof(float));
+    const GateConfig& zg = config_.update_gate;
+    const GateConfig& rg = config_.reset_gate;
+    const GateConfig& ng = config_.new_gate;
+
+    float* z = temp_update_gate_;
+    float* r = temp_reset_gate_;
+    float* n = temp_new_gate_;
+    float* reset_hidden = temp_reset_hidden_;
+
+    // Initialize all three gate pre-activations with their biases
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        z[i] = zg.bias ? zg.bias[i] : 0.0f;
+        r[i] = rg.bias ? rg.bias[i] : 0.0f;
+        n[i] = ng.bias ? ng.bias[i] : 0.0f;
     }
 
-    // Input contribution: W_i * x
-    if (gate_config.input_weights) {
+    // Combined input GEMM: the three gates share the input vector, so
+    // one pass reads each input element once for three accumulators
+    // instead of launching a gemm per gate
+    if (zg.input_weights && rg.input_weights && ng.input_weights) {
         for (uint32_t i = 0; i < hidden_size; ++i) {
-            float sum = 0.0f;
+            const float* wz = zg.input_weights + i * input_size;
+            const float* wr = rg.input_weights + i * input_size;
+            const float* wn = ng.input_weights + i * input_size;
+            float sum_z = 0.0f;
+            float sum_r = 0.0f;
+            float sum_n = 0.0f;
             for (uint32_t j = 0; j < input_size; ++j) {
-                sum += gate_config.input_weights[i * input_size + j] * input[j];
+                const float x = input[j];
+                sum_z += wz[j] * x;
+                sum_r += wr[j] * x;
+                sum_n += wn[j] * x;
             }
-            output[i] += sum;
+            z[i] += sum_z;
+            r[i] += sum_r;
+            n[i] += sum_n;
+        }
+    } else {
+        if (zg.input_weights) {
+            accumulate_matvec(zg.input_weights, input, hidden_size, input_size, z);
+        }
+        if (rg.input_weights) {
+            accumulate_matvec(rg.input_weights, input, hidden_size, input_size, r);
+        }
+        if (ng.input_weights) {
+            accumulate_matvec(ng.input_weights, input, hidden_size, input_size, n);
         }
     }
 
-    // Hidden contribution: W_h * h
-    if (gate_config.hidden_weights) {
+    // Combined hidden GEMM for update and reset; the candidate gate
+    // needs the reset-gated hidden state, so it runs after the gates
+    if (zg.hidden_weights && rg.hidden_weights) {
         for (uint32_t i = 0; i < hidden_size; ++i) {
-            float sum = 0.0f;
+            const float* uz = zg.hidden_weights + i * hidden_size;
+            const float* ur = rg.hidden_weights + i * hidden_size;
+            float sum_z = 0.0f;
+            float sum_r = 0.0f;
             for (uint32_t j = 0; j < hidden_size; ++j) {
-                sum += gate_config.hidden_weights[i * hidden_size + j] * hidden[j];
+                const float h = hidden[j];
+                sum_z += uz[j] * h;
+                sum_r += ur[j] * h;
             }
-            output[i] += sum;
+            z[i] += sum_z;
+            r[i] += sum_r;
+        }
+    } else {
+        if (zg.hidden_weights) {
+            accumulate_matvec(zg.hidden_weights, hidden, hidden_size, hidden_size, z);
+        }
+        if (rg.hidden_weights) {
+            accumulate_matvec(rg.hidden_weights, hidden, hidden_size, hidden_size, r);
         }
     }
-}
-
-void CmxGRU::compute_new_state(const float* input, const float* hidden, 
-                              const float* reset_gate, const GateConfig& gate_config, 
-                              float* output) {
-    const uint32_t input_size = config_.input_size;
-    const uint32_t hidden_size = config_.hidden_size;
 
-    // Apply reset gate to hidden state
-    elementwise_multiply(reset_gate, hidden, temp_reset_hidden_, hidden_size);
+    // Single elementwise pass: gate activations plus reset-gated hidden
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        z[i] = 1.0f / (1.0f + std::exp(-z[i]));
+        r[i] = 1.0f / (1.0f + std::exp(-r[i]));
+        reset_hidden[i] = r[i] * hidden[i];
+    }
 
-    // Initialize output with bias
-    if (gate_config.bias) {
-        std::memcpy(output, gate_config.bias, hidden_size * sizeof(float));
-    } else {
-        std::memset(output, 0, hidden_size * sizeof(float));
+    // Candidate hidden contribution: W_h * (r_t * h_{t-1})
+    if (ng.hidden_weights) {
+        accumulate_matvec(ng.hidden_weights, reset_hidden, hidden_size, hidden_size, n);
     }
 
-    // Input contribution: W_i * x
-    if (gate_config.input_weights) {
-        for (uint32_t i = 0; i < hidden_size; ++i) {
-            float sum = 0.0f;
-            for (uint32_t j = 0; j < input_size; ++j) {
-                sum += gate_config.input_weights[i * input_size + j] * input[j];
-            }
-            output[i] += sum;
-        }
+    // Single elementwise finish: h_t = (1 - z_t) * h_{t-1} + z_t * tanh(n_t),
+    // written straight back into the persistent hidden state
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        const float candidate = std::tanh(n[i]);
+        hidden[i] = (1.0f - z[i]) * hidden[i] + z[i] * candidate;
     }
+}
 
-    // Reset-gated hidden contribution: W_h * (r_t * h_{t-1})
-    if (gate_config.hidden_weights) {
-        for (uint32_t i = 0; i < hidden_size; ++i) {
-            float sum = 0.0f;
-            for (uint32_t j = 0; j < hidden_size; ++j) {
-                sum += gate_config.hidden_weights[i * hidden_size + j] * temp_reset_hidden_[j];
-            }
-            output[i] += sum;
+void CmxGRU::quantized_timestep(const int16_t* input, int16_t* hidden) {
+    const uint32_t input_size = config_.input_size;
+    const uint32_t hidden_size = config_.hidden_size;
+
+    const QuantGateConfig& zg = quant_config_.update_gate;
+    const QuantGateConfig& rg = quant_config_.reset_gate;
+    const QuantGateConfig& ng = quant_config_.new_gate;
+
+    int32_t* z = q_temp_update_;
+    int32_t* r = q_temp_reset_;
+    int32_t* n = q_temp_new_;
+    int16_t* reset_hidden = q_temp_reset_hidden_;
+
+    // Combined input pass for all three gates, as in the float path.
+    // INT8 x INT16 products are at most 2^22, so the INT32 accumulator
+    // keeps about 2^9 full-scale MACs of headroom — comfortable for the
+    // small cells the integer path targets
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        const int8_t* wz = zg.input_weights + i * input_size;
+        const int8_t* wr = rg.input_weights + i * input_size;
+        const int8_t* wn = ng.input_weights + i * input_size;
+        int32_t sum_z = 0;
+        int32_t sum_r = 0;
+        int32_t sum_n = 0;
+        for (uint32_t j = 0; j < input_size; ++j) {
+            const int32_t x = input[j];
+            sum_z += wz[j] * x;
+            sum_r += wr[j] * x;
+            sum_n += wn[j] * x;
         }
+
+        // Requantize to Q3.12 pre-activations on top of the folded bias
+        z[i] = q_bias_[i] + utils::apply_fixed_point_scale(sum_z, q_input_requant_[0]);
+        r[i] = q_bias_[hidden_size + i] +
+               utils::apply_fixed_point_scale(sum_r, q_input_requant_[1]);
+        n[i] = q_bias_[2 * hidden_size + i] +
+               utils::apply_fixed_point_scale(sum_n, q_input_requant_[2]);
     }
-}
 
-void CmxGRU::sigmoid_inplace(float* data, uint32_t size) {
-    for (uint32_t i = 0; i < size; ++i) {
-        data[i] = 1.0f / (1.0f + std::exp(-data[i]));
+    // Combined hidden pass for update and reset
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        const int8_t* uz = zg.hidden_weights + i * hidden_size;
+        const int8_t* ur = rg.hidden_weights + i * hidden_size;
+        int32_t sum_z = 0;
+        int32_t sum_r = 0;
+        for (uint32_t j = 0; j < hidden_size; ++j) {
+            const int32_t h = hidden[j];
+            sum_z += uz[j] * h;
+            sum_r += ur[j] * h;
+        }
+        z[i] += utils::apply_fixed_point_scale(sum_z, q_hidden_requant_[0]);
+        r[i] += utils::apply_fixed_point_scale(sum_r, q_hidden_requant_[1]);
     }
-}
 
-void CmxGRU::tanh_inplace(float* data, uint32_t size) {
-    for (uint32_t i = 0; i < size; ++i) {
-        data[i] = std::tanh(data[i]);
+    // Gate sigmoids and reset-gated hidden state, all in Q0.15; the
+    // update gate buffer is reused to hold its Q0.15 value
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        const int32_t z_q15 = activations::lookup_int16_lut(sigmoid_lut_, z[i]);
+        const int32_t r_q15 = activations::lookup_int16_lut(sigmoid_lut_, r[i]);
+        z[i] = z_q15;
+        reset_hidden[i] = static_cast<int16_t>((r_q15 * hidden[i] + 16384) >> 15);
     }
-}
 
-void CmxGRU::elementwise_multiply(const float* a, const float* b, float* result, uint32_t size) {
-    for (uint32_t i = 0; i < size; ++i) {
-        result[i] = a[i] * b[i];
+    // Candidate hidden contribution: W_h * (r_t * h_{t-1})
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        const int8_t* un = ng.hidden_weights + i * hidden_size;
+        int32_t sum_n = 0;
+        for (uint32_t j = 0; j < hidden_size; ++j) {
+            sum_n += un[j] * reset_hidden[j];
+        }
+        n[i] += utils::apply_fixed_point_scale(sum_n, q_hidden_requant_[2]);
     }
-}
 
-void CmxGRU::linear_interpolate(const float* a, const float* b, const float* alpha, 
-                               float* result, uint32_t size) {
-    for (uint32_t i = 0; i < size; ++i) {
-        result[i] = (1.0f - alpha[i]) * a[i] + alpha[i] * b[i];
+    // State update h_t = (1 - z_t) * h_{t-1} + z_t * tanh(n_t) in Q0.15.
+    // The convex combination keeps the 32-bit sum below 2^30 before the
+    // shift, so no widening is needed
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        const int32_t candidate = activations::lookup_int16_lut(tanh_lut_, n[i]);
+        int32_t h_new = ((32768 - z[i]) * hidden[i] + z[i] * candidate + 16384) >> 15;
+        if (h_new < -32768) h_new = -32768;
+        if (h_new > 32767) h_new = 32767;
+        hidden[i] = static_cast<int16_t>(h_new);
     }
 }
 
@@ -302,5 +490,53 @@ bool CmxGRU::initialize_state_buffer() {
     return true;
 }
 
+bool CmxGRU::initialize_quantized_state_buffer() {
+    if (!state_buffer_) {
+        return false;
+    }
+
+    const uint32_t batch_size = config_.batch_size;
+    const uint32_t hidden_size = config_.hidden_size;
+
+    uint8_t* buffer = static_cast<uint8_t*>(state_buffer_);
+    size_t offset = 0;
+
+    // Align to 4-byte boundaries
+    auto align_offset = [](size_t offset, size_t alignment) {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    };
+
+    // Allocate hidden state (Q0.15)
+    offset = align_offset(offset, sizeof(int16_t));
+    q_hidden_state_ = reinterpret_cast<int16_t*>(buffer + offset);
+    offset += batch_size * hidden_size * sizeof(int16_t);
+
+    // Allocate gate accumulator buffers
+    offset = align_offset(offset, sizeof(int32_t));
+    q_temp_update_ = reinterpret_cast<int32_t*>(buffer + offset);
+    offset += hidden_size * sizeof(int32_t);
+
+    offset = align_offset(offset, sizeof(int32_t));
+    q_temp_reset_ = reinterpret_cast<int32_t*>(buffer + offset);
+    offset += hidden_size * sizeof(int32_t);
+
+    offset = align_offset(offset, sizeof(int32_t));
+    q_temp_new_ = reinterpret_cast<int32_t*>(buffer + offset);
+    offset += hidden_size * sizeof(int32_t);
+
+    offset = align_offset(offset, sizeof(int16_t));
+    q_temp_reset_hidden_ = reinterpret_cast<int16_t*>(buffer + offset);
+    offset += hidden_size * sizeof(int16_t);
+
+    // The float-path pointers are invalid in this layout
+    state_.hidden_state = nullptr;
+    temp_update_gate_ = nullptr;
+    temp_reset_gate_ = nullptr;
+    temp_new_gate_ = nullptr;
+    temp_reset_hidden_ = nullptr;
+
+    return true;
+}
+
 } // namespace kernels
 } // namespace cmx
\ No newline at end of file
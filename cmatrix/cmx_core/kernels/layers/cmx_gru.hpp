@@ -2,6 +2,10 @@
 
 #include <cstdint>
 #include <cstring>
+#include <vector>
+
+#include "../activations/cmx_int16_lut.hpp"
+#include "../../utils/cmx_quantization.hpp"
 
 namespace cmx {
 namespace kernels {
@@ -48,6 +52,38 @@ public:
         GateConfig new_gate;            ///< New state candidate gate configuration
     };
 
+    /**
+     * @brief Quantized GRU gate configuration
+     *
+     * Weights are symmetric per-tensor INT8 (zero point 0); biases stay
+     * float and are folded into fixed-point pre-activations once at
+     * configure time, so inference never touches floating point.
+     */
+    struct QuantGateConfig {
+        const int8_t* input_weights;    ///< Input-to-gate weights [hidden_size x input_size]
+        const int8_t* hidden_weights;   ///< Hidden-to-gate weights [hidden_size x hidden_size]
+        const float* bias;              ///< Gate bias [hidden_size], float
+        float input_weight_scale;       ///< Scale of input_weights
+        float hidden_weight_scale;      ///< Scale of hidden_weights
+    };
+
+    /**
+     * @brief Quantized GRU layer configuration
+     *
+     * Inputs are INT16 with the given per-tensor scale; the hidden
+     * state is INT16 in Q0.15, which tanh-bounded GRU state fills
+     * exactly. Sizes, batching, and sequence flags come from the
+     * regular Config passed alongside this (its float gate pointers
+     * are ignored).
+     */
+    struct QuantConfig {
+        float input_scale;              ///< Input activation scale (value = code * scale)
+
+        QuantGateConfig update_gate;    ///< Update gate configuration
+        QuantGateConfig reset_gate;     ///< Reset gate configuration
+        QuantGateConfig new_gate;       ///< New state candidate gate configuration
+    };
+
     /**
      * @brief GRU internal state
      */
@@ -69,6 +105,10 @@ public:
     /**
      * @brief Configure the GRU layer
      * 
+     * The state buffer holds the hidden state and gate scratch for the
+     * whole sequence; the memory planner should pin it in fast memory
+     * (TCM where available) since every timestep touches it.
+     *
      * @param config Layer configuration parameters
      * @param state_buffer Pre-allocated buffer for internal states
      * @param state_buffer_size Size of the state buffer in bytes
@@ -76,6 +116,24 @@ public:
      */
     bool configure(const Config& config, void* state_buffer, size_t state_buffer_size);
 
+    /**
+     * @brief Configure the GRU layer for integer-only inference
+     *
+     * Prepares the fixed-point requantizers, folds the float biases to
+     * Q3.12 pre-activation units, and builds the sigmoid/tanh lookup
+     * tables. The quantized state layout (INT16 hidden state, INT32
+     * gate scratch) fits inside get_state_buffer_size(), so memory
+     * planning does not change between the float and quantized paths.
+     *
+     * @param config Layer sizes and sequence flags (float gate pointers unused)
+     * @param quant_config Quantized weights, biases, and scales
+     * @param state_buffer Pre-allocated buffer for internal states
+     * @param state_buffer_size Size of the state buffer in bytes
+     * @return true if configuration successful, false otherwise
+     */
+    bool configure_quantized(const Config& config, const QuantConfig& quant_config,
+                             void* state_buffer, size_t state_buffer_size);
+
     /**
      * @brief Run GRU inference
      * 
@@ -87,6 +145,22 @@ public:
      */
     bool run(const float* input, uint32_t sequence_length, float* output, float* final_state = nullptr);
 
+    /**
+     * @brief Run integer-only GRU inference
+     *
+     * Requires configure_quantized(). Inputs use the configured input
+     * scale; outputs and the optional final state are the Q0.15 hidden
+     * state.
+     *
+     * @param input Input tensor [batch_size x sequence_length x input_size]
+     * @param sequence_length Length of input sequence
+     * @param output Output tensor [batch_size x (sequence_length or 1) x hidden_size]
+     * @param final_state Final hidden state (optional, only if return_state is true)
+     * @return true if inference successful, false otherwise
+     */
+    bool run_quantized(const int16_t* input, uint32_t sequence_length,
+                       int16_t* output, int16_t* final_state = nullptr);
+
     /**
      * @brief Infer output shape based on input shape
      * 
@@ -135,74 +209,79 @@ private:
     float* temp_new_gate_;              ///< Temporary new state candidate values
     float* temp_reset_hidden_;          ///< Temporary reset-gated hidden state
 
-    /**
-     * @brief Compute single gate activation
-     * 
-     * @param input Current input vector
-     * @param hidden Previous hidden state
-     * @param gate_config Gate weights and bias
-     * @param output Gate output values
-     */
-    void compute_gate(const float* input, const float* hidden, 
-                      const GateConfig& gate_config, float* output);
+    // Quantized path (configure_quantized). State lives in the same
+    // external buffer with an integer layout; everything scale-related
+    // is folded to fixed point once so timesteps are integer-only
+    QuantConfig quant_config_;          ///< Quantized layer configuration
+    bool quantized_;                    ///< Quantized path configured
+    int16_t* q_hidden_state_;           ///< Q0.15 hidden state [batch_size x hidden_size]
+    int32_t* q_temp_update_;            ///< Update gate accumulator, then Q0.15 gate value
+    int32_t* q_temp_reset_;             ///< Reset gate accumulator, then Q0.15 gate value
+    int32_t* q_temp_new_;               ///< Candidate gate accumulator
+    int16_t* q_temp_reset_hidden_;      ///< Reset-gated hidden state, Q0.15
 
-    /**
-     * @brief Compute new state candidate with reset gate
-     * 
-     * @param input Current input vector
-     * @param hidden Previous hidden state
-     * @param reset_gate Reset gate values
-     * @param gate_config New gate weights and bias
-     * @param output New state candidate values
-     */
-    void compute_new_state(const float* input, const float* hidden, 
-                          const float* reset_gate, const GateConfig& gate_config, 
-                          float* output);
+    // Per-gate requantizers (gate order: update, reset, new) and biases
+    // folded to Q3.12 pre-activation units at configure
+    utils::FixedPointScale q_input_requant_[3];   ///< acc(W_x * x) -> Q3.12
+    utils::FixedPointScale q_hidden_requant_[3];  ///< acc(W_h * h) -> Q3.12
+    std::vector<int32_t> q_bias_;                 ///< [3 x hidden_size] Q3.12 biases
+    activations::Int16LutTable sigmoid_lut_;      ///< Gate sigmoid table
+    activations::Int16LutTable tanh_lut_;         ///< Candidate tanh table
 
     /**
-     * @brief Apply sigmoid activation in-place
-     * 
-     * @param data Data to apply sigmoid to
-     * @param size Number of elements
+     * @brief Accumulate a matrix-vector product into output
+     *
+     * @param weights Row-major weight matrix [rows x cols]
+     * @param vec Input vector [cols]
+     * @param rows Number of output elements
+     * @param cols Number of input elements
+     * @param output Accumulation target [rows]
      */
-    void sigmoid_inplace(float* data, uint32_t size);
+    void accumulate_matvec(const float* weights, const float* vec,
+                           uint32_t rows, uint32_t cols, float* output);
 
     /**
-     * @brief Apply tanh activation in-place
-     * 
-     * @param data Data to apply tanh to
-     * @param size Number of elements
+     * @brief Execute one fused GRU timestep
+     *
+     * Runs the full step as a combined gate GEMM (one pass over the
+     * input feeds all three gates, one pass over the hidden state feeds
+     * update and reset) followed by single elementwise passes for the
+     * gate activations and the state update. The hidden state is read
+     * and updated in place in the persistent state buffer, so nothing
+     * round-trips through the general tensor pool between timesteps.
+     *
+     * @param input Current input vector [input_size]
+     * @param hidden Hidden state, updated in place [hidden_size]
      */
-    void tanh_inplace(float* data, uint32_t size);
+    void fused_timestep(const float* input, float* hidden);
 
     /**
-     * @brief Element-wise multiplication
-     * 
-     * @param a First operand
-     * @param b Second operand
-     * @param result Result array (can be same as a or b)
-     * @param size Number of elements
+     * @brief Execute one integer-only GRU timestep
+     *
+     * Same fusion structure as fused_timestep — combined input pass for
+     * all three gates, combined hidden pass for update and reset — with
+     * INT8xINT16 multiply-accumulates into INT32, fixed-point
+     * requantization to Q3.12 pre-activations, and LUT nonlinearities.
+     * The state update h = (1-z)*h + z*n runs entirely in Q0.15.
+     *
+     * @param input Current input vector [input_size], INT16
+     * @param hidden Hidden state, updated in place [hidden_size], Q0.15
      */
-    void elementwise_multiply(const float* a, const float* b, float* result, uint32_t size);
+    void quantized_timestep(const int16_t* input, int16_t* hidden);
 
     /**
-     * @brief Linear interpolation: result = (1 - alpha) * a + alpha * b
-     * 
-     * @param a First operand
-     * @param b Second operand
-     * @param alpha Interpolation weights [size]
-     * @param result Result array
-     * @param size Number of elements
+     * @brief Initialize state buffer layout
+     *
+     * @return true if initialization successful, false otherwise
      */
-    void linear_interpolate(const float* a, const float* b, const float* alpha, 
-                           float* result, uint32_t size);
+    bool initialize_state_buffer();
 
     /**
-     * @brief Initialize state buffer layout
-     * 
+     * @brief Initialize state buffer layout for the quantized path
+     *
      * @return true if initialization successful, false otherwise
      */
-    bool initialize_state_buffer();
+    bool initialize_quantized_state_buffer();
 };
 
 } // namespace kernels
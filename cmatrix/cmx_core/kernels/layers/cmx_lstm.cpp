@@ -5,17 +5,25 @@
 namespace cmx {
 namespace kernels {
 
-CmxLSTM::CmxLSTM() 
+CmxLSTM::CmxLSTM()
     : configured_(false)
     , state_buffer_(nullptr)
     , temp_input_gate_(nullptr)
     , temp_forget_gate_(nullptr)
     , temp_output_gate_(nullptr)
-    , temp_cell_gate_(nullptr) {
-    
+    , temp_cell_gate_(nullptr)
+    , gates_fused_(false)
+    , quantized_(false)
+    , q_hidden_state_(nullptr)
+    , q_cell_state_(nullptr) {
+
     state_.hidden_state = nullptr;
     state_.cell_state = nullptr;
     state_.initialized = false;
+
+    for (int gate = 0; gate < 4; ++gate) {
+        q_temp_gates_[gate] = nullptr;
+    }
 }
 
 CmxLSTM::~CmxLSTM() {
@@ -34,13 +42,150 @@ bool CmxLSTM::configure(const Config& config, void* state_buffer, size_t state_b
         return false;
     }
 
+    quantized_ = false;
     reset_state();
     configured_ = true;
+
+    // Stack the gate weights once so each timestep runs a single GEMM
+    gates_fused_ = fuse_gate_weights();
+
+    return true;
+}
+
+bool CmxLSTM::configure_quantized(const Config& config, const QuantConfig& quant_config,
+                                  void* state_buffer, size_t state_buffer_size) {
+    // Adopt the configuration first: get_state_buffer_size() reads it
+    config_ = config;
+    quant_config_ = quant_config;
+
+    if (!state_buffer || state_buffer_size < get_state_buffer_size()) {
+        return false;
+    }
+
+    // The integer path has no per-gate fallbacks; every gate needs both
+    // weight matrices
+    const QuantGateConfig* gates[4] = {
+        &quant_config_.input_gate, &quant_config_.forget_gate,
+        &quant_config_.output_gate, &quant_config_.cell_gate
+    };
+    for (const QuantGateConfig* gate : gates) {
+        if (!gate->input_weights || !gate->hidden_weights) {
+            return false;
+        }
+    }
+
+    state_buffer_ = state_buffer;
+
+    if (!initialize_quantized_state_buffer()) {
+        return false;
+    }
+
+    // Fold every scale into one multiply-and-shift per gate branch.
+    // Accumulators carry raw INT8xINT16 products; the input branch maps
+    // them through input_scale * weight_scale to Q3.12 pre-activations,
+    // the hidden branch through the Q0.15 state scale (1/32768)
+    const uint32_t hidden_size = config_.hidden_size;
+    q_bias_.assign(static_cast<size_t>(4) * hidden_size, 0);
+
+    for (uint32_t gate = 0; gate < 4; ++gate) {
+        q_input_requant_[gate] = utils::calculate_fixed_point_scale(
+            quant_config_.input_scale * gates[gate]->input_weight_scale * 4096.0f);
+        q_hidden_requant_[gate] = utils::calculate_fixed_point_scale(
+            gates[gate]->hidden_weight_scale * (4096.0f / 32768.0f));
+
+        if (gates[gate]->bias) {
+            for (uint32_t i = 0; i < hidden_size; ++i) {
+                q_bias_[gate * hidden_size + i] =
+                    static_cast<int32_t>(lroundf(gates[gate]->bias[i] * 4096.0f));
+            }
+        }
+    }
+
+    activations::build_sigmoid_lut_q15(sigmoid_lut_);
+    activations::build_tanh_lut_q15(tanh_lut_);
+
+    gates_fused_ = false;
+    quantized_ = true;
+    configured_ = true;
+    reset_state();
+    return true;
+}
+
+bool CmxLSTM::fuse_gate_weights() {
+    const GateConfig* gates[4] = {
+        &config_.input_gate, &config_.forget_gate,
+        &config_.output_gate, &config_.cell_gate
+    };
+
+    for (const GateConfig* gate : gates) {
+        if (!gate->input_weights || !gate->hidden_weights) {
+            return false;
+        }
+    }
+
+    const uint32_t input_size = config_.input_size;
+    const uint32_t hidden_size = config_.hidden_size;
+    const uint32_t fused_cols = input_size + hidden_size;
+
+    fused_weights_.resize(static_cast<size_t>(4) * hidden_size * fused_cols);
+    fused_bias_.resize(static_cast<size_t>(4) * hidden_size);
+
+    for (uint32_t gate = 0; gate < 4; ++gate) {
+        const GateConfig& cfg = *gates[gate];
+
+        for (uint32_t i = 0; i < hidden_size; ++i) {
+            float* row = fused_weights_.data() +
+                (static_cast<size_t>(gate) * hidden_size + i) * fused_cols;
+
+            // Input columns first, hidden columns after, so the GEMM can
+            // walk x then h without a concatenation copy
+            std::memcpy(row, cfg.input_weights + i * input_size,
+                        input_size * sizeof(float));
+            std::memcpy(row + input_size, cfg.hidden_weights + i * hidden_size,
+                        hidden_size * sizeof(float));
+
+            fused_bias_[gate * hidden_size + i] = cfg.bias ? cfg.bias[i] : 0.0f;
+        }
+    }
+
     return true;
 }
 
+void CmxLSTM::compute_gates_fused(const float* input, const float* hidden) {
+    const uint32_t input_size = config_.input_size;
+    const uint32_t hidden_size = config_.hidden_size;
+    const uint32_t fused_cols = input_size + hidden_size;
+
+    // The four temp gate buffers are laid out consecutively in the state
+    // buffer, in the same gate order as the fused matrix rows
+    float* gate_outputs[4] = {
+        temp_input_gate_, temp_forget_gate_, temp_output_gate_, temp_cell_gate_
+    };
+
+    for (uint32_t gate = 0; gate < 4; ++gate) {
+        float* output = gate_outputs[gate];
+
+        for (uint32_t i = 0; i < hidden_size; ++i) {
+            const uint32_t row_index = gate * hidden_size + i;
+            const float* row = fused_weights_.data() +
+                static_cast<size_t>(row_index) * fused_cols;
+
+            float sum = fused_bias_[row_index];
+            for (uint32_t j = 0; j < input_size; ++j) {
+                sum += row[j] * input[j];
+            }
+            const float* hidden_row = row + input_size;
+            for (uint32_t j = 0; j < hidden_size; ++j) {
+                sum += hidden_row[j] * hidden[j];
+            }
+
+            output[i] = sum;
+        }
+    }
+}
+
 bool CmxLSTM::run(const float* input, uint32_t sequence_length, float* output) {
-    if (!configured_ || !input || !output) {
+    if (!configured_ || quantized_ || !input || !output) {
         return false;
     }
 
@@ -54,11 +199,16 @@ bool CmxLSTM::run(const float* input, uint32_t sequence_length, float* output) {
             const float* current_input = input + (t * batch_size + b) * input_size;
             const float* prev_hidden = state_.hidden_state + b * hidden_size;
             
-            // Compute gates
-            compute_gate(current_input, prev_hidden, config_.input_gate, temp_input_gate_);
-            compute_gate(current_input, prev_hidden, config_.forget_gate, temp_forget_gate_);
-            compute_gate(current_input, prev_hidden, config_.output_gate, temp_output_gate_);
-            compute_gate(current_input, prev_hidden, config_.cell_gate, temp_cell_gate_);
+            // Compute gates: single fused GEMM when prepared, otherwise
+            // the original four per-gate passes
+            if (gates_fused_) {
+                compute_gates_fused(current_input, prev_hidden);
+            } else {
+                compute_gate(current_input, prev_hidden, config_.input_gate, temp_input_gate_);
+                compute_gate(current_input, prev_hidden, config_.forget_gate, temp_forget_gate_);
+                compute_gate(current_input, prev_hidden, config_.output_gate, temp_output_gate_);
+                compute_gate(current_input, prev_hidden, config_.cell_gate, temp_cell_gate_);
+            }
 
             // Apply activations
             sigmoid_inplace(temp_input_gate_, hidden_size);
@@ -95,6 +245,40 @@ bool CmxLSTM::run(const float* input, uint32_t sequence_length, float* output) {
     return true;
 }
 
+bool CmxLSTM::run_quantized(const int16_t* input, uint32_t sequence_length, int16_t* output) {
+    if (!configured_ || !quantized_ || !input || !output) {
+        return false;
+    }
+
+    const uint32_t batch_size = config_.batch_size;
+    const uint32_t input_size = config_.input_size;
+    const uint32_t hidden_size = config_.hidden_size;
+
+    // Process each timestep
+    for (uint32_t t = 0; t < sequence_length; ++t) {
+        for (uint32_t b = 0; b < batch_size; ++b) {
+            const int16_t* current_input = input + (t * batch_size + b) * input_size;
+            int16_t* current_hidden = q_hidden_state_ + b * hidden_size;
+            int16_t* current_cell = q_cell_state_ + b * hidden_size;
+
+            quantized_timestep(current_input, current_hidden, current_cell);
+
+            // Copy to output if needed
+            if (config_.return_sequences) {
+                int16_t* output_ptr = output + (t * batch_size + b) * hidden_size;
+                std::memcpy(output_ptr, current_hidden, hidden_size * sizeof(int16_t));
+            }
+        }
+    }
+
+    // Copy final hidden state to output if not returning sequences
+    if (!config_.return_sequences) {
+        std::memcpy(output, q_hidden_state_, batch_size * hidden_size * sizeof(int16_t));
+    }
+
+    return true;
+}
+
 bool CmxLSTM::infer_shape(const uint32_t* input_shape, uint32_t* output_shape) {
     if (!input_shape || !output_shape) {
         return false;
@@ -120,9 +304,14 @@ void CmxLSTM::reset_state() {
     const uint32_t state_size = batch_size * hidden_size;
 
     // Zero initialize states
-    std::memset(state_.hidden_state, 0, state_size * sizeof(float));
-    std::memset(state_.cell_state, 0, state_size * sizeof(float));
-    
+    if (quantized_) {
+        std::memset(q_hidden_state_, 0, state_size * sizeof(int16_t));
+        std::memset(q_cell_state_, 0, state_size * sizeof(int16_t));
+    } else {
+        std::memset(state_.hidden_state, 0, state_size * sizeof(float));
+        std::memset(state_.cell_state, 0, state_size * sizeof(float));
+    }
+
     state_.initialized = true;
 }
 
@@ -138,10 +327,12 @@ size_t CmxLSTM::get_state_buffer_size() const {
     
     // Temporary gate buffers
     size += 4 * hidden_size * sizeof(float);
-    
+
     // Alignment padding
     size += 32; // Conservative alignment padding
-    
+
+    // The quantized layout (INT16 states, four INT32 accumulators) is
+    // strictly smaller, so one size covers both paths
     return size;
 }
 
@@ -212,6 +403,67 @@ void CmxLSTM::elementwise_add(const float* a, const float* b, float* result, uin
     }
 }
 
+void CmxLSTM::quantized_timestep(const int16_t* input, int16_t* hidden, int16_t* cell) {
+    const uint32_t input_size = config_.input_size;
+    const uint32_t hidden_size = config_.hidden_size;
+
+    const QuantGateConfig* gates[4] = {
+        &quant_config_.input_gate, &quant_config_.forget_gate,
+        &quant_config_.output_gate, &quant_config_.cell_gate
+    };
+
+    // Gate pre-activations. INT8 x INT16 products are at most 2^22, so
+    // the INT32 accumulator keeps about 2^9 full-scale MACs of
+    // headroom — comfortable for the small cells the integer path
+    // targets
+    for (uint32_t gate = 0; gate < 4; ++gate) {
+        const QuantGateConfig& cfg = *gates[gate];
+        int32_t* out = q_temp_gates_[gate];
+        const int32_t* bias = q_bias_.data() + gate * hidden_size;
+
+        for (uint32_t i = 0; i < hidden_size; ++i) {
+            const int8_t* wx = cfg.input_weights + i * input_size;
+            const int8_t* wh = cfg.hidden_weights + i * hidden_size;
+
+            int32_t sum_x = 0;
+            for (uint32_t j = 0; j < input_size; ++j) {
+                sum_x += wx[j] * input[j];
+            }
+            int32_t sum_h = 0;
+            for (uint32_t j = 0; j < hidden_size; ++j) {
+                sum_h += wh[j] * hidden[j];
+            }
+
+            // Requantize both branches to Q3.12 on top of the folded bias
+            out[i] = bias[i] +
+                     utils::apply_fixed_point_scale(sum_x, q_input_requant_[gate]) +
+                     utils::apply_fixed_point_scale(sum_h, q_hidden_requant_[gate]);
+        }
+    }
+
+    // Activations and state update in one elementwise pass
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        const int32_t i_q15 = activations::lookup_int16_lut(sigmoid_lut_, q_temp_gates_[0][i]);
+        const int32_t f_q15 = activations::lookup_int16_lut(sigmoid_lut_, q_temp_gates_[1][i]);
+        const int32_t o_q15 = activations::lookup_int16_lut(sigmoid_lut_, q_temp_gates_[2][i]);
+        const int32_t g_q15 = activations::lookup_int16_lut(tanh_lut_, q_temp_gates_[3][i]);
+
+        // C_t = f_t * C_{t-1} + i_t * g_t: Q0.15 x Q3.12 >> 15 stays
+        // Q3.12, Q0.15 x Q0.15 is Q0.30 and shifts down 18; the sum
+        // saturates at the ±8 cell range instead of wrapping
+        int32_t c_new = ((f_q15 * cell[i] + 16384) >> 15) +
+                        ((i_q15 * g_q15 + (1 << 17)) >> 18);
+        if (c_new < -32768) c_new = -32768;
+        if (c_new > 32767) c_new = 32767;
+        cell[i] = static_cast<int16_t>(c_new);
+
+        // h_t = o_t * tanh(C_t); the Q3.12 cell state feeds the tanh
+        // table directly
+        const int32_t tanh_c = activations::lookup_int16_lut(tanh_lut_, c_new);
+        hidden[i] = static_cast<int16_t>((o_q15 * tanh_c + 16384) >> 15);
+    }
+}
+
 bool CmxLSTM::initialize_state_buffer() {
     if (!state_buffer_) {
         return false;
@@ -258,5 +510,49 @@ bool CmxLSTM::initialize_state_buffer() {
     return true;
 }
 
+bool CmxLSTM::initialize_quantized_state_buffer() {
+    if (!state_buffer_) {
+        return false;
+    }
+
+    const uint32_t batch_size = config_.batch_size;
+    const uint32_t hidden_size = config_.hidden_size;
+
+    uint8_t* buffer = static_cast<uint8_t*>(state_buffer_);
+    size_t offset = 0;
+
+    // Align to 4-byte boundaries
+    auto align_offset = [](size_t offset, size_t alignment) {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    };
+
+    // Allocate hidden state (Q0.15)
+    offset = align_offset(offset, sizeof(int16_t));
+    q_hidden_state_ = reinterpret_cast<int16_t*>(buffer + offset);
+    offset += batch_size * hidden_size * sizeof(int16_t);
+
+    // Allocate cell state (Q3.12)
+    offset = align_offset(offset, sizeof(int16_t));
+    q_cell_state_ = reinterpret_cast<int16_t*>(buffer + offset);
+    offset += batch_size * hidden_size * sizeof(int16_t);
+
+    // Allocate gate accumulator buffers
+    for (int gate = 0; gate < 4; ++gate) {
+        offset = align_offset(offset, sizeof(int32_t));
+        q_temp_gates_[gate] = reinterpret_cast<int32_t*>(buffer + offset);
+        offset += hidden_size * sizeof(int32_t);
+    }
+
+    // The float-path pointers are invalid in this layout
+    state_.hidden_state = nullptr;
+    state_.cell_state = nullptr;
+    temp_input_gate_ = nullptr;
+    temp_forget_gate_ = nullptr;
+    temp_output_gate_ = nullptr;
+    temp_cell_gate_ = nullptr;
+
+    return true;
+}
+
 } // namespace kernels
 } // namespace cmx
\ No newline at end of file
@@ -2,6 +2,10 @@
 
 #include <cstdint>
 #include <cstring>
+#include <vector>
+
+#include "../activations/cmx_int16_lut.hpp"
+#include "../../utils/cmx_quantization.hpp"
 
 namespace cmx {
 namespace kernels {
@@ -48,6 +52,41 @@ public:
         GateConfig cell_gate;           ///< Cell candidate gate configuration
     };
 
+    /**
+     * @brief Quantized LSTM gate configuration
+     *
+     * Weights are symmetric per-tensor INT8 (zero point 0); biases stay
+     * float and are folded into fixed-point pre-activations once at
+     * configure time.
+     */
+    struct QuantGateConfig {
+        const int8_t* input_weights;    ///< Input-to-gate weights [hidden_size x input_size]
+        const int8_t* hidden_weights;   ///< Hidden-to-gate weights [hidden_size x hidden_size]
+        const float* bias;              ///< Gate bias [hidden_size], float
+        float input_weight_scale;       ///< Scale of input_weights
+        float hidden_weight_scale;      ///< Scale of hidden_weights
+    };
+
+    /**
+     * @brief Quantized LSTM layer configuration
+     *
+     * Inputs are INT16 with the given per-tensor scale. The hidden
+     * state is INT16 in Q0.15 (exactly the tanh-bounded range) and the
+     * cell state is INT16 in Q3.12, chosen so it both covers the usual
+     * cell magnitudes with saturation at ±8 and feeds the tanh lookup
+     * table directly. Sizes and sequence flags come from the regular
+     * Config passed alongside this (its float gate pointers are
+     * ignored).
+     */
+    struct QuantConfig {
+        float input_scale;              ///< Input activation scale (value = code * scale)
+
+        QuantGateConfig input_gate;     ///< Input gate configuration
+        QuantGateConfig forget_gate;    ///< Forget gate configuration
+        QuantGateConfig output_gate;    ///< Output gate configuration
+        QuantGateConfig cell_gate;      ///< Cell candidate gate configuration
+    };
+
     /**
      * @brief LSTM internal state
      */
@@ -77,6 +116,24 @@ public:
      */
     bool configure(const Config& config, void* state_buffer, size_t state_buffer_size);
 
+    /**
+     * @brief Configure the LSTM layer for integer-only inference
+     *
+     * Prepares the fixed-point requantizers, folds the float biases to
+     * Q3.12 pre-activation units, and builds the sigmoid/tanh lookup
+     * tables. The quantized state layout (INT16 states, INT32 gate
+     * scratch) fits inside get_state_buffer_size(), so memory planning
+     * does not change between the float and quantized paths.
+     *
+     * @param config Layer sizes and sequence flags (float gate pointers unused)
+     * @param quant_config Quantized weights, biases, and scales
+     * @param state_buffer Pre-allocated buffer for internal states
+     * @param state_buffer_size Size of the state buffer in bytes
+     * @return true if configuration successful, false otherwise
+     */
+    bool configure_quantized(const Config& config, const QuantConfig& quant_config,
+                             void* state_buffer, size_t state_buffer_size);
+
     /**
      * @brief Run LSTM inference
      * 
@@ -87,6 +144,19 @@ public:
      */
     bool run(const float* input, uint32_t sequence_length, float* output);
 
+    /**
+     * @brief Run integer-only LSTM inference
+     *
+     * Requires configure_quantized(). Inputs use the configured input
+     * scale; outputs are the Q0.15 hidden state.
+     *
+     * @param input Input tensor [batch_size x sequence_length x input_size]
+     * @param sequence_length Length of input sequence
+     * @param output Output tensor [batch_size x (sequence_length or 1) x hidden_size]
+     * @return true if inference successful, false otherwise
+     */
+    bool run_quantized(const int16_t* input, uint32_t sequence_length, int16_t* output);
+
     /**
      * @brief Infer output shape based on input shape
      * 
@@ -134,17 +204,59 @@ private:
     float* temp_output_gate_;           ///< Temporary output gate values
     float* temp_cell_gate_;             ///< Temporary cell candidate values
 
+    // Fused gate weights: all four gates stacked into one matrix so a
+    // single GEMM produces every pre-activation per timestep
+    std::vector<float> fused_weights_;  ///< [4*hidden x (input+hidden)] stacked i,f,o,g
+    std::vector<float> fused_bias_;     ///< [4*hidden] stacked gate biases
+    bool gates_fused_;                  ///< Fused path prepared at configure()
+
+    // Quantized path (configure_quantized). States live in the same
+    // external buffer with an integer layout; scales are folded to
+    // fixed point once so timesteps are integer-only
+    QuantConfig quant_config_;          ///< Quantized layer configuration
+    bool quantized_;                    ///< Quantized path configured
+    int16_t* q_hidden_state_;           ///< Q0.15 hidden state [batch_size x hidden_size]
+    int16_t* q_cell_state_;             ///< Q3.12 cell state [batch_size x hidden_size]
+    int32_t* q_temp_gates_[4];          ///< Gate accumulators, order i/f/o/g [hidden_size each]
+
+    // Per-gate requantizers (gate order: input, forget, output, cell)
+    // and biases folded to Q3.12 pre-activation units at configure
+    utils::FixedPointScale q_input_requant_[4];   ///< acc(W_x * x) -> Q3.12
+    utils::FixedPointScale q_hidden_requant_[4];  ///< acc(W_h * h) -> Q3.12
+    std::vector<int32_t> q_bias_;                 ///< [4 x hidden_size] Q3.12 biases
+    activations::Int16LutTable sigmoid_lut_;      ///< Gate sigmoid table
+    activations::Int16LutTable tanh_lut_;         ///< Candidate / cell tanh table
+
     /**
      * @brief Compute single gate activation
-     * 
+     *
      * @param input Current input vector
      * @param hidden Previous hidden state
      * @param gate_config Gate weights and bias
      * @param output Gate output values
      */
-    void compute_gate(const float* input, const float* hidden, 
+    void compute_gate(const float* input, const float* hidden,
                       const GateConfig& gate_config, float* output);
 
+    /**
+     * @brief Stack the four gate weight matrices into fused_weights_
+     *
+     * Runs once at configure() time. Gates are ordered to match the
+     * temporary gate buffers (input, forget, output, cell) so the fused
+     * GEMM can write straight into them.
+     *
+     * @return true if all four gates carried weights and were fused
+     */
+    bool fuse_gate_weights();
+
+    /**
+     * @brief Compute all four gate pre-activations with one GEMM
+     *
+     * @param input Current input vector
+     * @param hidden Previous hidden state
+     */
+    void compute_gates_fused(const float* input, const float* hidden);
+
     /**
      * @brief Apply sigmoid activation in-place
      * 
@@ -181,12 +293,34 @@ private:
      */
     void elementwise_add(const float* a, const float* b, float* result, uint32_t size);
 
+    /**
+     * @brief Execute one integer-only LSTM timestep
+     *
+     * All four gate pre-activations accumulate in INT32 from INT8xINT16
+     * products, requantize to Q3.12, and pass through the lookup
+     * tables. The cell update C_t = f*C + i*g and hidden update
+     * h_t = o * tanh(C_t) run in Q3.12 / Q0.15 fixed point, with the
+     * cell saturated at its ±8 range.
+     *
+     * @param input Current input vector [input_size], INT16
+     * @param hidden Hidden state, updated in place [hidden_size], Q0.15
+     * @param cell Cell state, updated in place [hidden_size], Q3.12
+     */
+    void quantized_timestep(const int16_t* input, int16_t* hidden, int16_t* cell);
+
     /**
      * @brief Initialize state buffer layout
-     * 
+     *
      * @return true if initialization successful, false otherwise
      */
     bool initialize_state_buffer();
+
+    /**
+     * @brief Initialize state buffer layout for the quantized path
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool initialize_quantized_state_buffer();
 };
 
 } // namespace kernels
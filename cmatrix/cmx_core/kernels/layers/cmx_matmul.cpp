@@ -1,4 +1,5 @@
 #include "cmx_matmul.hpp"
+#include "../cmx_gemm.hpp"
 #include <algorithm>
 #include <cmath>
 
@@ -21,6 +22,10 @@ CmxMatMul::CmxMatMul()
     , weight_zero_point_(0)
     , output_scale_(1.0f)
     , output_zero_point_(0)
+    , sparse_format_(utils::SparseFormat::DENSE)
+    , sparse_values_(nullptr)
+    , sparse_metadata_(nullptr)
+    , sparse_block_offsets_(nullptr)
     , configured_(false) {
 }
 
@@ -58,6 +63,10 @@ bool CmxMatMul::run(const float* input_data, float* output_data) {
     
     if (quantized_) {
         execute_quantized_matmul(input_data, output_data);
+    } else if (sparse_format_ == utils::SparseFormat::SPARSE_2_4) {
+        execute_sparse_2_4_matmul(input_data, output_data);
+    } else if (sparse_format_ == utils::SparseFormat::BLOCK_16) {
+        execute_sparse_block16_matmul(input_data, output_data);
     } else {
         execute_float_matmul(input_data, output_data);
     }
@@ -99,30 +108,140 @@ void CmxMatMul::set_quantization_params(float input_scale, int32_t input_zero_po
     quantized_ = true;
 }
 
-void CmxMatMul::execute_float_matmul(const float* input_data, float* output_data) {
+bool CmxMatMul::set_sparse_weights(utils::SparseFormat format,
+                                  const float* values, const uint8_t* metadata,
+                                  const uint32_t* block_offsets) {
+    if (!configured_) {
+        return false;
+    }
+
+    if (format == utils::SparseFormat::DENSE) {
+        sparse_format_ = utils::SparseFormat::DENSE;
+        sparse_values_ = nullptr;
+        sparse_metadata_ = nullptr;
+        sparse_block_offsets_ = nullptr;
+        return true;
+    }
+
+    if (!values || !metadata) {
+        return false;
+    }
+
+    // Both formats pack along the K dimension, so K must tile cleanly;
+    // 2:4 additionally needs whole metadata bytes (2 groups per byte)
+    if (format == utils::SparseFormat::SPARSE_2_4 &&
+        (input_cols_ % (2 * utils::SPARSE_2_4_GROUP)) != 0) {
+        return false;
+    }
+    if (format == utils::SparseFormat::BLOCK_16 &&
+        ((input_cols_ % utils::SPARSE_BLOCK_SIZE) != 0 || !block_offsets)) {
+        return false;
+    }
+
+    sparse_format_ = format;
+    sparse_values_ = values;
+    sparse_metadata_ = metadata;
+    sparse_block_offsets_ = block_offsets;
+    return true;
+}
+
+void CmxMatMul::execute_sparse_2_4_matmul(const float* input_data, float* output_data) {
+    const uint32_t groups = input_cols_ / utils::SPARSE_2_4_GROUP;
+    const uint32_t values_stride = groups * utils::SPARSE_2_4_KEPT;
+    const uint32_t meta_stride = groups / 2;
+
     for (uint32_t batch = 0; batch < batch_size_; ++batch) {
         for (uint32_t row = 0; row < input_rows_; ++row) {
+            const float* input_row =
+                input_data + (batch * input_rows_ + row) * input_cols_;
+            float* output_row =
+                output_data + (batch * input_rows_ + row) * output_cols_;
+
             for (uint32_t col = 0; col < output_cols_; ++col) {
+                const float* values = sparse_values_ + col * values_stride;
+                const uint8_t* meta = sparse_metadata_ + col * meta_stride;
+
+                // Two groups per metadata byte: each nibble holds the
+                // two kept in-group positions, so 8 MACs per byte and
+                // the dropped half of the weights is never touched
                 float sum = 0.0f;
-                
-                // Compute dot product
-                for (uint32_t k = 0; k < input_cols_; ++k) {
-                    uint32_t input_idx = (batch * input_rows_ + row) * input_cols_ + k;
-                    float input_val = input_data[input_idx];
-                    float weight_val = get_weight_value(k, col);
-                    
-                    sum += input_val * weight_val;
+                for (uint32_t g = 0; g < groups; g += 2) {
+                    const uint8_t byte = meta[g / 2];
+                    const float* x = input_row + g * utils::SPARSE_2_4_GROUP;
+                    const float* v = values + g * utils::SPARSE_2_4_KEPT;
+
+                    sum += v[0] * x[byte & 0x03];
+                    sum += v[1] * x[(byte >> 2) & 0x03];
+                    sum += v[2] * x[utils::SPARSE_2_4_GROUP + ((byte >> 4) & 0x03)];
+                    sum += v[3] * x[utils::SPARSE_2_4_GROUP + ((byte >> 6) & 0x03)];
                 }
-                
-                // Add bias if present
-                sum = add_bias(sum, col);
-                
-                // Apply activation
-                sum = apply_activation(sum);
-                
-                // Store result
-                uint32_t output_idx = (batch * input_rows_ + row) * output_cols_ + col;
-                output_data[output_idx] = sum;
+
+                sum = apply_activation(add_bias(sum, col));
+                output_row[col] = sum;
+            }
+        }
+    }
+}
+
+void CmxMatMul::execute_sparse_block16_matmul(const float* input_data, float* output_data) {
+    const uint32_t blocks = input_cols_ / utils::SPARSE_BLOCK_SIZE;
+    const uint32_t bitmap_stride = (blocks + 7) / 8;
+
+    for (uint32_t batch = 0; batch < batch_size_; ++batch) {
+        for (uint32_t row = 0; row < input_rows_; ++row) {
+            const float* input_row =
+                input_data + (batch * input_rows_ + row) * input_cols_;
+            float* output_row =
+                output_data + (batch * input_rows_ + row) * output_cols_;
+
+            for (uint32_t col = 0; col < output_cols_; ++col) {
+                const uint8_t* bitmap = sparse_metadata_ + col * bitmap_stride;
+                const float* block_values =
+                    sparse_values_ +
+                    sparse_block_offsets_[col] * utils::SPARSE_BLOCK_SIZE;
+
+                // Zero blocks cost one bitmap test; present blocks run
+                // a dense 16-wide MAC strip from the packed stream
+                float sum = 0.0f;
+                for (uint32_t b = 0; b < blocks; ++b) {
+                    if (!(bitmap[b / 8] & (1u << (b % 8)))) {
+                        continue;
+                    }
+                    const float* x = input_row + b * utils::SPARSE_BLOCK_SIZE;
+                    for (int32_t i = 0; i < utils::SPARSE_BLOCK_SIZE; ++i) {
+                        sum += block_values[i] * x[i];
+                    }
+                    block_values += utils::SPARSE_BLOCK_SIZE;
+                }
+
+                sum = apply_activation(add_bias(sum, col));
+                output_row[col] = sum;
+            }
+        }
+    }
+}
+
+void CmxMatMul::execute_float_matmul(const float* input_data, float* output_data) {
+    const int32_t m = static_cast<int32_t>(input_rows_);
+    const int32_t n = static_cast<int32_t>(output_cols_);
+    const int32_t k = static_cast<int32_t>(input_cols_);
+    const int32_t ldb = transpose_weights_ ? k : n;
+
+    for (uint32_t batch = 0; batch < batch_size_; ++batch) {
+        const float* batch_input = input_data + batch * input_rows_ * input_cols_;
+        float* batch_output = output_data + batch * input_rows_ * output_cols_;
+
+        // Hot loop lives in the shared register-tiled GEMM core
+        gemm_f32(m, n, k,
+                 batch_input, k,
+                 weights_, ldb, transpose_weights_,
+                 batch_output, n, false);
+
+        // Bias and activation as a separate elementwise pass
+        for (uint32_t row = 0; row < input_rows_; ++row) {
+            float* output_row = batch_output + row * output_cols_;
+            for (uint32_t col = 0; col < output_cols_; ++col) {
+                output_row[col] = apply_activation(add_bias(output_row[col], col));
             }
         }
     }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../../utils/cmx_quantization.hpp"
+
 #include <cstdint>
 #include <cstddef>
 
@@ -103,6 +105,27 @@ public:
                                 float weight_scale, int32_t weight_zero_point,
                                 float output_scale, int32_t output_zero_point);
 
+    /**
+     * @brief Select a packed structured-sparse weight set for this layer
+     *
+     * Called by the loader when a layer ships pruned weights; run() then
+     * uses the sparse execution path and skips the zero structure. Both
+     * formats describe the weights per output column along the K
+     * dimension (the transposed, one-row-per-output layout) in the
+     * packed encoding produced by utils::pack_sparse_2_4 /
+     * utils::pack_sparse_block16 and by model_serializer.py at export.
+     *
+     * @param format SPARSE_2_4 or BLOCK_16 (DENSE reverts to dense weights)
+     * @param values Packed nonzero values for all output columns
+     * @param metadata Per-column 2:4 position nibbles or block bitmaps
+     * @param block_offsets BLOCK_16 only: first packed block index per
+     *                      output column (output_cols + 1 entries)
+     * @return true if the format fits the configured shape
+     */
+    bool set_sparse_weights(utils::SparseFormat format,
+                            const float* values, const uint8_t* metadata,
+                            const uint32_t* block_offsets = nullptr);
+
 private:
     // Configuration parameters
     uint32_t batch_size_;
@@ -123,9 +146,15 @@ private:
     float output_scale_;
     int32_t output_zero_point_;
     
+    // Structured-sparse weights (selected per layer at load)
+    utils::SparseFormat sparse_format_;
+    const float* sparse_values_;
+    const uint8_t* sparse_metadata_;
+    const uint32_t* sparse_block_offsets_;
+
     // Configuration state
     bool configured_;
-    
+
     /**
      * @brief Execute standard floating-point matrix multiplication
      * 
@@ -136,11 +165,27 @@ private:
     
     /**
      * @brief Execute quantized matrix multiplication
-     * 
+     *
      * @param input_data Input matrix data
      * @param output_data Output matrix data
      */
     void execute_quantized_matmul(const float* input_data, float* output_data);
+
+    /**
+     * @brief Execute 2:4 structured-sparse matrix multiplication
+     *
+     * @param input_data Input matrix data
+     * @param output_data Output matrix data
+     */
+    void execute_sparse_2_4_matmul(const float* input_data, float* output_data);
+
+    /**
+     * @brief Execute 16-block sparse matrix multiplication
+     *
+     * @param input_data Input matrix data
+     * @param output_data Output matrix data
+     */
+    void execute_sparse_block16_matmul(const float* input_data, float* output_data);
     
     /**
      * @brief Apply activation function to output
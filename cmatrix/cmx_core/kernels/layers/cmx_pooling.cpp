@@ -61,7 +61,31 @@ bool CmxPooling::configure(PoolingType pool_type,
     // Calculate output dimensions
     output_height_ = (input_height_ + pad_top_ + pad_bottom_ - window_height_) / stride_height_ + 1;
     output_width_ = (input_width_ + pad_left_ + pad_right_ - window_width_) / stride_width_ + 1;
-    
+
+    // Row cache for the two-pass execution path
+    row_cache_.assign(static_cast<size_t>(window_height_) * output_width_ *
+                          input_channels_,
+                      0.0f);
+    row_cache_tags_.assign(window_height_, -1);
+
+    // Column validity depends only on geometry, so fix it here instead
+    // of re-deriving it per window on the hot path
+    valid_cols_.assign(output_width_, 0);
+    has_pad_cols_.assign(output_width_, false);
+    for (uint32_t out_w = 0; out_w < output_width_; ++out_w) {
+        const int32_t w_start = static_cast<int32_t>(out_w * stride_width_) -
+                                static_cast<int32_t>(pad_left_);
+        uint32_t valid = 0;
+        for (uint32_t kw = 0; kw < window_width_; ++kw) {
+            const int32_t w_idx = w_start + static_cast<int32_t>(kw);
+            if (w_idx >= 0 && w_idx < static_cast<int32_t>(input_width_)) {
+                ++valid;
+            }
+        }
+        valid_cols_[out_w] = valid;
+        has_pad_cols_[out_w] = valid != window_width_;
+    }
+
     configured_ = true;
     return true;
 }
@@ -85,6 +109,25 @@ bool CmxPooling::run(const float* input_data, float* output_data) {
     return true;
 }
 
+bool CmxPooling::run_int16(const int16_t* input_data, int16_t* output_data) {
+    if (!configured_ || !input_data || !output_data) {
+        return false;
+    }
+
+    switch (pool_type_) {
+        case PoolingType::MAX_POOL:
+            execute_max_pool_int16(input_data, output_data);
+            break;
+        case PoolingType::AVG_POOL:
+            execute_avg_pool_int16(input_data, output_data);
+            break;
+        default:
+            return false;
+    }
+
+    return true;
+}
+
 bool CmxPooling::infer_shape(uint32_t& output_height, uint32_t& output_width,
                             uint32_t& output_channels, uint32_t& output_batch) const {
     if (!configured_) {
@@ -104,8 +147,8 @@ size_t CmxPooling::get_memory_requirements() const {
         return 0;
     }
     
-    // No additional memory required for pooling operations
-    return 0;
+    // Row cache for the two-pass execution path
+    return row_cache_.size() * sizeof(float);
 }
 
 void CmxPooling::calculate_padding() {
@@ -134,61 +177,320 @@ void CmxPooling::calculate_padding() {
     }
 }
 
+// Two-pass execution: each input row is horizontally reduced once into
+// the row cache, then every output row is a vertical reduce over its
+// cached window rows. With overlapping windows (stride < window) each
+// input value is loaded once instead of once per window, and both
+// passes run the channel loop innermost over contiguous memory, which
+// auto-vectorizes on SIMD-capable targets.
+void CmxPooling::horizontal_reduce_row(const float* input_data, uint32_t batch,
+                                       uint32_t in_h, float* dst) {
+    const uint32_t channels = input_channels_;
+    const float* row =
+        input_data + (static_cast<size_t>(batch) * input_height_ + in_h) *
+                         input_width_ * channels;
+    const bool is_max = pool_type_ == PoolingType::MAX_POOL;
+
+    for (uint32_t out_w = 0; out_w < output_width_; ++out_w) {
+        float* cell = dst + static_cast<size_t>(out_w) * channels;
+        const int32_t w_start = static_cast<int32_t>(out_w * stride_width_) -
+                                static_cast<int32_t>(pad_left_);
+
+        const float init =
+            is_max ? -std::numeric_limits<float>::infinity() : 0.0f;
+        for (uint32_t c = 0; c < channels; ++c) {
+            cell[c] = init;
+        }
+
+        for (uint32_t kw = 0; kw < window_width_; ++kw) {
+            const int32_t w_idx = w_start + static_cast<int32_t>(kw);
+            if (w_idx < 0 || w_idx >= static_cast<int32_t>(input_width_)) {
+                continue;
+            }
+            const float* src = row + static_cast<size_t>(w_idx) * channels;
+            if (is_max) {
+                for (uint32_t c = 0; c < channels; ++c) {
+                    cell[c] = std::max(cell[c], src[c]);
+                }
+            } else {
+                for (uint32_t c = 0; c < channels; ++c) {
+                    cell[c] += src[c];
+                }
+            }
+        }
+    }
+}
+
 void CmxPooling::execute_max_pool(const float* input_data, float* output_data) {
+    const uint32_t channels = input_channels_;
+    const size_t cache_row = static_cast<size_t>(output_width_) * channels;
+
     for (uint32_t batch = 0; batch < batch_size_; ++batch) {
+        // Cache tags are input row numbers, which repeat across batches
+        std::fill(row_cache_tags_.begin(), row_cache_tags_.end(), -1);
+
         for (uint32_t out_h = 0; out_h < output_height_; ++out_h) {
+            const int32_t h_start =
+                static_cast<int32_t>(out_h * stride_height_) -
+                static_cast<int32_t>(pad_top_);
+            float* out_row = output_data +
+                (static_cast<size_t>(batch) * output_height_ + out_h) *
+                    cache_row;
+
+            for (size_t i = 0; i < cache_row; ++i) {
+                out_row[i] = -std::numeric_limits<float>::infinity();
+            }
+
+            uint32_t valid_rows = 0;
+            for (uint32_t kh = 0; kh < window_height_; ++kh) {
+                const int32_t h_idx = h_start + static_cast<int32_t>(kh);
+                if (h_idx < 0 || h_idx >= static_cast<int32_t>(input_height_)) {
+                    continue;
+                }
+                ++valid_rows;
+
+                float* slot = row_cache_.data() +
+                              (static_cast<size_t>(h_idx) % window_height_) *
+                                  cache_row;
+                int32_t& tag =
+                    row_cache_tags_[static_cast<size_t>(h_idx) % window_height_];
+                if (tag != h_idx) {
+                    horizontal_reduce_row(input_data, batch,
+                                          static_cast<uint32_t>(h_idx), slot);
+                    tag = h_idx;
+                }
+
+                for (size_t i = 0; i < cache_row; ++i) {
+                    out_row[i] = std::max(out_row[i], slot[i]);
+                }
+            }
+
+            // Padding contributes the value 0, matching the reference
+            // window loop that read 0.0f for out-of-bounds positions
             for (uint32_t out_w = 0; out_w < output_width_; ++out_w) {
-                for (uint32_t c = 0; c < input_channels_; ++c) {
-                    float max_val = -std::numeric_limits<float>::infinity();
-                    
-                    int32_t h_start = static_cast<int32_t>(out_h * stride_height_) - static_cast<int32_t>(pad_top_);
-                    int32_t w_start = static_cast<int32_t>(out_w * stride_width_) - static_cast<int32_t>(pad_left_);
-                    
-                    for (uint32_t kh = 0; kh < window_height_; ++kh) {
-                        for (uint32_t kw = 0; kw < window_width_; ++kw) {
-                            int32_t h_idx = h_start + static_cast<int32_t>(kh);
-                            int32_t w_idx = w_start + static_cast<int32_t>(kw);
-                            
-                            float val = get_input_value(input_data, batch, h_idx, w_idx, c);
-                            max_val = std::max(max_val, val);
+                if (valid_rows == window_height_ && !has_pad_cols_[out_w]) {
+                    continue;
+                }
+                float* cell = out_row + static_cast<size_t>(out_w) * channels;
+                for (uint32_t c = 0; c < channels; ++c) {
+                    cell[c] = std::max(cell[c], 0.0f);
+                }
+            }
+        }
+    }
+}
+
+void CmxPooling::execute_avg_pool(const float* input_data, float* output_data) {
+    const uint32_t channels = input_channels_;
+    const size_t cache_row = static_cast<size_t>(output_width_) * channels;
+
+    for (uint32_t batch = 0; batch < batch_size_; ++batch) {
+        std::fill(row_cache_tags_.begin(), row_cache_tags_.end(), -1);
+
+        for (uint32_t out_h = 0; out_h < output_height_; ++out_h) {
+            const int32_t h_start =
+                static_cast<int32_t>(out_h * stride_height_) -
+                static_cast<int32_t>(pad_top_);
+            float* out_row = output_data +
+                (static_cast<size_t>(batch) * output_height_ + out_h) *
+                    cache_row;
+
+            for (size_t i = 0; i < cache_row; ++i) {
+                out_row[i] = 0.0f;
+            }
+
+            uint32_t valid_rows = 0;
+            for (uint32_t kh = 0; kh < window_height_; ++kh) {
+                const int32_t h_idx = h_start + static_cast<int32_t>(kh);
+                if (h_idx < 0 || h_idx >= static_cast<int32_t>(input_height_)) {
+                    continue;
+                }
+                ++valid_rows;
+
+                float* slot = row_cache_.data() +
+                              (static_cast<size_t>(h_idx) % window_height_) *
+                                  cache_row;
+                int32_t& tag =
+                    row_cache_tags_[static_cast<size_t>(h_idx) % window_height_];
+                if (tag != h_idx) {
+                    horizontal_reduce_row(input_data, batch,
+                                          static_cast<uint32_t>(h_idx), slot);
+                    tag = h_idx;
+                }
+
+                for (size_t i = 0; i < cache_row; ++i) {
+                    out_row[i] += slot[i];
+                }
+            }
+
+            // Validity is separable, so the divisor is just valid rows
+            // times valid columns - no per-position counting needed
+            for (uint32_t out_w = 0; out_w < output_width_; ++out_w) {
+                const uint32_t count = valid_rows * valid_cols_[out_w];
+                float* cell = out_row + static_cast<size_t>(out_w) * channels;
+                if (count == 0) {
+                    for (uint32_t c = 0; c < channels; ++c) {
+                        cell[c] = 0.0f;
+                    }
+                    continue;
+                }
+                const float scale = 1.0f / static_cast<float>(count);
+                for (uint32_t c = 0; c < channels; ++c) {
+                    cell[c] *= scale;
+                }
+            }
+        }
+    }
+}
+
+void CmxPooling::execute_max_pool_int16(const int16_t* input_data,
+                                        int16_t* output_data) {
+    const uint32_t channels = input_channels_;
+    const size_t out_row_size = static_cast<size_t>(output_width_) * channels;
+
+    for (uint32_t batch = 0; batch < batch_size_; ++batch) {
+        for (uint32_t out_h = 0; out_h < output_height_; ++out_h) {
+            const int32_t h_start =
+                static_cast<int32_t>(out_h * stride_height_) -
+                static_cast<int32_t>(pad_top_);
+            int16_t* out_row = output_data +
+                (static_cast<size_t>(batch) * output_height_ + out_h) *
+                    out_row_size;
+
+            uint32_t valid_rows = 0;
+            for (uint32_t kh = 0; kh < window_height_; ++kh) {
+                const int32_t h_idx = h_start + static_cast<int32_t>(kh);
+                if (h_idx >= 0 && h_idx < static_cast<int32_t>(input_height_)) {
+                    ++valid_rows;
+                }
+            }
+
+            for (uint32_t out_w = 0; out_w < output_width_; ++out_w) {
+                const int32_t w_start =
+                    static_cast<int32_t>(out_w * stride_width_) -
+                    static_cast<int32_t>(pad_left_);
+                int16_t* cell = out_row + static_cast<size_t>(out_w) * channels;
+
+                const uint32_t valid_count = valid_rows * valid_cols_[out_w];
+                if (valid_count == 0) {
+                    for (uint32_t c = 0; c < channels; ++c) {
+                        cell[c] = 0;
+                    }
+                    continue;
+                }
+
+                for (uint32_t c = 0; c < channels; ++c) {
+                    cell[c] = std::numeric_limits<int16_t>::min();
+                }
+
+                for (uint32_t kh = 0; kh < window_height_; ++kh) {
+                    const int32_t h_idx = h_start + static_cast<int32_t>(kh);
+                    if (h_idx < 0 ||
+                        h_idx >= static_cast<int32_t>(input_height_)) {
+                        continue;
+                    }
+                    for (uint32_t kw = 0; kw < window_width_; ++kw) {
+                        const int32_t w_idx =
+                            w_start + static_cast<int32_t>(kw);
+                        if (w_idx < 0 ||
+                            w_idx >= static_cast<int32_t>(input_width_)) {
+                            continue;
+                        }
+                        const int16_t* pixel = input_data +
+                            ((static_cast<size_t>(batch) * input_height_ +
+                              static_cast<uint32_t>(h_idx)) * input_width_ +
+                             static_cast<uint32_t>(w_idx)) * channels;
+                        for (uint32_t c = 0; c < channels; ++c) {
+                            cell[c] = std::max(cell[c], pixel[c]);
                         }
                     }
-                    
-                    uint32_t output_idx = ((batch * output_height_ + out_h) * output_width_ + out_w) * input_channels_ + c;
-                    output_data[output_idx] = max_val;
+                }
+
+                // Padding contributes the value 0, matching the float path
+                if (valid_rows != window_height_ || has_pad_cols_[out_w]) {
+                    for (uint32_t c = 0; c < channels; ++c) {
+                        cell[c] = std::max<int16_t>(cell[c], 0);
+                    }
                 }
             }
         }
     }
 }
 
-void CmxPooling::execute_avg_pool(const float* input_data, float* output_data) {
+void CmxPooling::execute_avg_pool_int16(const int16_t* input_data,
+                                        int16_t* output_data) {
+    const uint32_t channels = input_channels_;
+    const size_t out_row_size = static_cast<size_t>(output_width_) * channels;
+
+    // Per-channel int32 sums for one output cell; a full-scale int16
+    // value times any practical window count stays well inside 32 bits
+    std::vector<int32_t> sums(channels);
+
     for (uint32_t batch = 0; batch < batch_size_; ++batch) {
         for (uint32_t out_h = 0; out_h < output_height_; ++out_h) {
+            const int32_t h_start =
+                static_cast<int32_t>(out_h * stride_height_) -
+                static_cast<int32_t>(pad_top_);
+            int16_t* out_row = output_data +
+                (static_cast<size_t>(batch) * output_height_ + out_h) *
+                    out_row_size;
+
+            uint32_t valid_rows = 0;
+            for (uint32_t kh = 0; kh < window_height_; ++kh) {
+                const int32_t h_idx = h_start + static_cast<int32_t>(kh);
+                if (h_idx >= 0 && h_idx < static_cast<int32_t>(input_height_)) {
+                    ++valid_rows;
+                }
+            }
+
             for (uint32_t out_w = 0; out_w < output_width_; ++out_w) {
-                for (uint32_t c = 0; c < input_channels_; ++c) {
-                    float sum = 0.0f;
-                    uint32_t count = 0;
-                    
-                    int32_t h_start = static_cast<int32_t>(out_h * stride_height_) - static_cast<int32_t>(pad_top_);
-                    int32_t w_start = static_cast<int32_t>(out_w * stride_width_) - static_cast<int32_t>(pad_left_);
-                    
-                    for (uint32_t kh = 0; kh < window_height_; ++kh) {
-                        for (uint32_t kw = 0; kw < window_width_; ++kw) {
-                            int32_t h_idx = h_start + static_cast<int32_t>(kh);
-                            int32_t w_idx = w_start + static_cast<int32_t>(kw);
-                            
-                            if (h_idx >= 0 && h_idx < static_cast<int32_t>(input_height_) &&
-                                w_idx >= 0 && w_idx < static_cast<int32_t>(input_width_)) {
-                                float val = get_input_value(input_data, batch, h_idx, w_idx, c);
-                                sum += val;
-                                count++;
-                            }
+                const int32_t w_start =
+                    static_cast<int32_t>(out_w * stride_width_) -
+                    static_cast<int32_t>(pad_left_);
+                int16_t* cell = out_row + static_cast<size_t>(out_w) * channels;
+
+                const int32_t count =
+                    static_cast<int32_t>(valid_rows * valid_cols_[out_w]);
+                if (count == 0) {
+                    for (uint32_t c = 0; c < channels; ++c) {
+                        cell[c] = 0;
+                    }
+                    continue;
+                }
+
+                std::fill(sums.begin(), sums.end(), 0);
+
+                for (uint32_t kh = 0; kh < window_height_; ++kh) {
+                    const int32_t h_idx = h_start + static_cast<int32_t>(kh);
+                    if (h_idx < 0 ||
+                        h_idx >= static_cast<int32_t>(input_height_)) {
+                        continue;
+                    }
+                    for (uint32_t kw = 0; kw < window_width_; ++kw) {
+                        const int32_t w_idx =
+                            w_start + static_cast<int32_t>(kw);
+                        if (w_idx < 0 ||
+                            w_idx >= static_cast<int32_t>(input_width_)) {
+                            continue;
+                        }
+                        const int16_t* pixel = input_data +
+                            ((static_cast<size_t>(batch) * input_height_ +
+                              static_cast<uint32_t>(h_idx)) * input_width_ +
+                             static_cast<uint32_t>(w_idx)) * channels;
+                        for (uint32_t c = 0; c < channels; ++c) {
+                            sums[c] += pixel[c];
                         }
                     }
-                    
-                    uint32_t output_idx = ((batch * output_height_ + out_h) * output_width_ + out_w) * input_channels_ + c;
-                    output_data[output_idx] = (count > 0) ? (sum / static_cast<float>(count)) : 0.0f;
+                }
+
+                // Divide by valid positions only, rounding half away
+                // from zero
+                for (uint32_t c = 0; c < channels; ++c) {
+                    const int32_t sum = sums[c];
+                    const int32_t rounded = (sum >= 0) ?
+                        (sum + count / 2) / count :
+                        -((-sum + count / 2) / count);
+                    cell[c] = static_cast<int16_t>(rounded);
                 }
             }
         }
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 namespace cmx {
 namespace kernels {
@@ -72,9 +73,25 @@ public:
      */
     bool run(const float* input_data, float* output_data);
 
+    /**
+     * @brief Execute pooling operation on INT16 data
+     *
+     * Same window geometry and padding semantics as the float path
+     * (max pooling includes the zero padding in its reduction; average
+     * pooling divides by the count of valid positions only). Average
+     * sums accumulate in int32 — a full 16-bit value times any
+     * practical window count stays well inside 32 bits — and the
+     * division rounds half away from zero.
+     *
+     * @param input_data INT16 input tensor data (NHWC format)
+     * @param output_data INT16 output tensor data (NHWC format)
+     * @return true if execution successful, false otherwise
+     */
+    bool run_int16(const int16_t* input_data, int16_t* output_data);
+
     /**
      * @brief Infer output shape based on current configuration
-     * 
+     *
      * @param output_height Output tensor height
      * @param output_width Output tensor width
      * @param output_channels Output tensor channels
@@ -123,7 +140,20 @@ private:
     
     // Configuration state
     bool configured_;
-    
+
+    // Row cache for the two-pass execution: window_height_ slots of
+    // horizontally reduced rows (output_width_ x channels each), tagged
+    // with the input row they hold so vertically overlapping windows
+    // reuse rows instead of re-reading the input
+    std::vector<float> row_cache_;
+    std::vector<int32_t> row_cache_tags_;
+
+    // Per-output-column geometry, fixed at configure time: how many
+    // window columns land inside the input, and whether any fall in
+    // the padding
+    std::vector<uint32_t> valid_cols_;
+    std::vector<bool> has_pad_cols_;
+
     /**
      * @brief Calculate padding values based on input dimensions
      */
@@ -145,6 +175,37 @@ private:
      */
     void execute_avg_pool(const float* input_data, float* output_data);
     
+    /**
+     * @brief Execute max pooling on INT16 data
+     *
+     * @param input_data INT16 input tensor data
+     * @param output_data INT16 output tensor data
+     */
+    void execute_max_pool_int16(const int16_t* input_data, int16_t* output_data);
+
+    /**
+     * @brief Execute average pooling on INT16 data
+     *
+     * @param input_data INT16 input tensor data
+     * @param output_data INT16 output tensor data
+     */
+    void execute_avg_pool_int16(const int16_t* input_data, int16_t* output_data);
+
+    /**
+     * @brief Horizontally reduce one input row into a row cache slot
+     *
+     * Produces dst[ow * channels + c] = reduce over the window columns
+     * of input row in_h, with the channel loop innermost so the data
+     * is read contiguously (and auto-vectorizes on SIMD targets).
+     *
+     * @param input_data Input tensor data
+     * @param batch Batch index
+     * @param in_h Input row to reduce
+     * @param dst Cache slot of output_width * channels floats
+     */
+    void horizontal_reduce_row(const float* input_data, uint32_t batch,
+                               uint32_t in_h, float* dst);
+
     /**
      * @brief Get input value with padding handling
      * 
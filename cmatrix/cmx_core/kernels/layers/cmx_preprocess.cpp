@@ -0,0 +1,200 @@
+#include "cmx_preprocess.hpp"
+#include "cmx_kernel_registry.hpp"
+#include "../../ops/cmx_op_manifest.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace cmx {
+namespace kernels {
+
+CmxPreprocess::CmxPreprocess()
+    : in_height_(0), in_width_(0), channels_(0),
+      y_ratio_(1.0f), x_ratio_(1.0f), inv_output_scale_(1.0f),
+      configured_(false) {}
+
+CmxPreprocess::~CmxPreprocess() = default;
+
+KernelStatus CmxPreprocess::configure(
+    DescriptorSpan inputs,
+    DescriptorList& outputs,
+    const void* params
+) {
+    if (!params || !validate_input_count(inputs, 1)) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    params_ = *static_cast<const PreprocessParams*>(params);
+
+    if (params_.out_height <= 0 || params_.out_width <= 0) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+    if (params_.quantize_output && params_.output_scale <= 0.0f) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    const TensorDescriptor& input = inputs[0];
+    if (!supports_dtype(input.dtype)) {
+        return KernelStatus::UNSUPPORTED_DTYPE;
+    }
+    if (input.shape.rank() != 4 || input.shape.dims[0] != 1) {
+        return KernelStatus::SHAPE_MISMATCH;
+    }
+
+    in_height_ = input.shape.dims[1];
+    in_width_ = input.shape.dims[2];
+    channels_ = input.shape.dims[3];
+    if (in_height_ <= 0 || in_width_ <= 0 || channels_ <= 0) {
+        return KernelStatus::SHAPE_MISMATCH;
+    }
+
+    y_ratio_ = static_cast<float>(in_height_) /
+               static_cast<float>(params_.out_height);
+    x_ratio_ = static_cast<float>(in_width_) /
+               static_cast<float>(params_.out_width);
+    inv_output_scale_ = params_.quantize_output
+                      ? 1.0f / params_.output_scale : 1.0f;
+
+    TensorDescriptor output;
+    output.shape.dims = {1, params_.out_height, params_.out_width, channels_};
+    output.dtype = params_.quantize_output ? DataType::INT8
+                                           : DataType::FLOAT32;
+    outputs.clear();
+    outputs.push_back(output);
+
+    configured_ = true;
+    return KernelStatus::SUCCESS;
+}
+
+KernelStatus CmxPreprocess::run(
+    const void* const* inputs,
+    void* const* outputs
+) {
+    return run_split(inputs, outputs, 0, params_.out_height);
+}
+
+KernelStatus CmxPreprocess::run_split(
+    const void* const* inputs,
+    void* const* outputs,
+    int32_t begin,
+    int32_t end
+) {
+    if (!configured_ || !inputs || !outputs || !inputs[0] || !outputs[0]) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+    if (begin < 0 || end > params_.out_height || begin >= end) {
+        return KernelStatus::INVALID_PARAMS;
+    }
+
+    run_rows(static_cast<const uint8_t*>(inputs[0]), outputs[0], begin, end);
+    return KernelStatus::SUCCESS;
+}
+
+float CmxPreprocess::sample(
+    const uint8_t* frame,
+    float src_y,
+    float src_x,
+    int32_t channel
+) const {
+    if (params_.resize_mode == ResizeMode::NEAREST) {
+        int32_t y = std::min(static_cast<int32_t>(src_y), in_height_ - 1);
+        int32_t x = std::min(static_cast<int32_t>(src_x), in_width_ - 1);
+        return static_cast<float>(
+            frame[(y * in_width_ + x) * channels_ + channel]);
+    }
+
+    // Bilinear: sample the four neighbours, clamping at the border
+    float fy = src_y - 0.5f;
+    float fx = src_x - 0.5f;
+    int32_t y0 = static_cast<int32_t>(std::floor(fy));
+    int32_t x0 = static_cast<int32_t>(std::floor(fx));
+    float wy = fy - static_cast<float>(y0);
+    float wx = fx - static_cast<float>(x0);
+
+    int32_t y0c = std::max(0, std::min(y0, in_height_ - 1));
+    int32_t y1c = std::max(0, std::min(y0 + 1, in_height_ - 1));
+    int32_t x0c = std::max(0, std::min(x0, in_width_ - 1));
+    int32_t x1c = std::max(0, std::min(x0 + 1, in_width_ - 1));
+
+    float p00 = frame[(y0c * in_width_ + x0c) * channels_ + channel];
+    float p01 = frame[(y0c * in_width_ + x1c) * channels_ + channel];
+    float p10 = frame[(y1c * in_width_ + x0c) * channels_ + channel];
+    float p11 = frame[(y1c * in_width_ + x1c) * channels_ + channel];
+
+    float top = p00 + (p01 - p00) * wx;
+    float bottom = p10 + (p11 - p10) * wx;
+    return top + (bottom - top) * wy;
+}
+
+void CmxPreprocess::run_rows(
+    const uint8_t* frame,
+    void* output,
+    int32_t begin,
+    int32_t end
+) const {
+    float* out_f32 = static_cast<float*>(output);
+    int8_t* out_i8 = static_cast<int8_t*>(output);
+
+    for (int32_t oy = begin; oy < end; ++oy) {
+        // Pixel-center mapping, shared by both sampling modes
+        float src_y = (static_cast<float>(oy) + 0.5f) * y_ratio_;
+        int32_t row_base = oy * params_.out_width * channels_;
+
+        for (int32_t ox = 0; ox < params_.out_width; ++ox) {
+            float src_x = (static_cast<float>(ox) + 0.5f) * x_ratio_;
+            int32_t pixel_base = row_base + ox * channels_;
+
+            for (int32_t c = 0; c < channels_; ++c) {
+                float v = sample(frame, src_y, src_x, c);
+                if (params_.channel_mean) {
+                    v -= params_.channel_mean[c];
+                }
+                if (params_.channel_inv_std) {
+                    v *= params_.channel_inv_std[c];
+                }
+
+                if (params_.quantize_output) {
+                    int32_t q = static_cast<int32_t>(
+                        std::lround(v * inv_output_scale_))
+                        + params_.output_zero_point;
+                    q = std::max(-128, std::min(127, q));
+                    out_i8[pixel_base + c] = static_cast<int8_t>(q);
+                } else {
+                    out_f32[pixel_base + c] = v;
+                }
+            }
+        }
+    }
+}
+
+std::vector<TensorShape> CmxPreprocess::infer_shape(
+    const std::vector<TensorShape>& input_shapes,
+    const void* params
+) {
+    if (input_shapes.empty() || !params ||
+        input_shapes[0].rank() != 4) {
+        return {};
+    }
+
+    const PreprocessParams* p = static_cast<const PreprocessParams*>(params);
+    TensorShape output;
+    output.dims = {input_shapes[0].dims[0], p->out_height, p->out_width,
+                   input_shapes[0].dims[3]};
+    return {output};
+}
+
+bool CmxPreprocess::supports_dtype(DataType dtype) const {
+    return dtype == DataType::UINT8;
+}
+
+int32_t CmxPreprocess::split_extent() const {
+    return configured_ ? params_.out_height : 0;
+}
+
+// Register the kernel (skipped in manifest builds whose model carries
+// no preprocessing node)
+#if CMX_NEED_OP_PREPROCESS
+REGISTER_KERNEL(CmxPreprocess, KernelType::PREPROCESS, 0);
+#endif
+
+} // namespace kernels
+} // namespace cmx
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "../cmx_kernel_interface.hpp"
+#include <cstdint>
+
+namespace cmx {
+namespace kernels {
+
+/**
+ * @brief Resize sampling mode
+ */
+enum class ResizeMode {
+    NEAREST,
+    BILINEAR
+};
+
+/**
+ * @brief Configuration parameters for the fused preprocessing layer
+ *
+ * The mean / inverse-std pointers are per-channel arrays of length C
+ * and must outlive the kernel; nullptr means no normalization (mean 0,
+ * scale 1). When quantize_output is set the normalized value is
+ * requantized with the model's input quantization in the same pass and
+ * the output tensor is INT8; otherwise the output stays FLOAT32.
+ */
+struct PreprocessParams {
+    ResizeMode resize_mode;
+    int32_t out_height;
+    int32_t out_width;
+    const float* channel_mean;      ///< Per-channel mean, length C (optional)
+    const float* channel_inv_std;   ///< Per-channel 1/std, length C (optional)
+    float output_scale;             ///< Input quantization step of the model
+    int32_t output_zero_point;      ///< Input zero point of the model
+    bool quantize_output;           ///< Emit INT8 instead of FLOAT32
+
+    PreprocessParams()
+        : resize_mode(ResizeMode::BILINEAR)
+        , out_height(0)
+        , out_width(0)
+        , channel_mean(nullptr)
+        , channel_inv_std(nullptr)
+        , output_scale(1.0f)
+        , output_zero_point(0)
+        , quantize_output(false)
+    {}
+};
+
+/**
+ * @brief Fused image preprocessing layer (resize + normalize + quantize)
+ *
+ * First-class graph operator for the resize / per-channel normalize /
+ * input-quantize chain that applications used to hand-write at FP32
+ * before cmx_set_input. Running it as a registry kernel puts
+ * preprocessing inside the plan: it shares the arena, shows up in the
+ * profiler, and is partitioned across cores like any other layer. All
+ * three stages run in one pass over the output — each camera byte is
+ * read once and each model input element written once, with no FP32
+ * intermediate frame.
+ */
+class CmxPreprocess : public CmxKernel {
+public:
+    CmxPreprocess();
+    ~CmxPreprocess() override;
+
+    /**
+     * @brief Configure the preprocessing layer
+     *
+     * Expects one UINT8 NHWC input of rank 4 with batch 1 (the camera
+     * frame, RGB888 or grayscale). The output keeps the channel count
+     * at the configured target resolution.
+     *
+     * @param inputs Input tensor descriptors (frame)
+     * @param outputs Output tensor descriptors (model input)
+     * @param params PreprocessParams structure
+     * @return KernelStatus indicating success or failure
+     */
+    KernelStatus configure(
+        DescriptorSpan inputs,
+        DescriptorList& outputs,
+        const void* params
+    ) override;
+
+    /**
+     * @brief Execute the fused preprocessing
+     *
+     * @param inputs Input data pointers (frame)
+     * @param outputs Output data pointers (model input)
+     * @return KernelStatus indicating success or failure
+     */
+    KernelStatus run(
+        const void* const* inputs,
+        void* const* outputs
+    ) override;
+
+    /**
+     * @brief Infer output shape from input shape and parameters
+     */
+    std::vector<TensorShape> infer_shape(
+        const std::vector<TensorShape>& input_shapes,
+        const void* params
+    ) override;
+
+    /**
+     * @brief Get kernel type identifier
+     * @return "preprocess"
+     */
+    const char* get_type() const override { return "preprocess"; }
+
+    /**
+     * @brief Check data type support
+     * @param dtype Data type to check
+     * @return True if supported
+     */
+    bool supports_dtype(DataType dtype) const override;
+
+    /**
+     * @brief Every output element is written
+     * @return True
+     */
+    bool writes_all_outputs() const override { return true; }
+
+    /**
+     * @brief Output rows are independent and can be partitioned
+     * @return Output height
+     */
+    int32_t split_extent() const override;
+
+    /**
+     * @brief Compute output rows [begin, end) only
+     *
+     * Rows write disjoint ranges of the output and read the frame
+     * read-only, so concurrent slices are safe for both sampling modes.
+     */
+    KernelStatus run_split(
+        const void* const* inputs,
+        void* const* outputs,
+        int32_t begin,
+        int32_t end
+    ) override;
+
+private:
+    PreprocessParams params_;
+    int32_t in_height_;
+    int32_t in_width_;
+    int32_t channels_;
+    float y_ratio_;          ///< Input rows per output row
+    float x_ratio_;          ///< Input columns per output column
+    float inv_output_scale_; ///< 1 / output_scale for the quantize step
+    bool configured_;
+
+    /**
+     * @brief Process output rows [begin, end) with the configured stages
+     */
+    void run_rows(
+        const uint8_t* frame,
+        void* output,
+        int32_t begin,
+        int32_t end
+    ) const;
+
+    /**
+     * @brief Sample one input pixel channel at resized coordinates
+     */
+    float sample(
+        const uint8_t* frame,
+        float src_y,
+        float src_x,
+        int32_t channel
+    ) const;
+};
+
+} // namespace kernels
+} // namespace cmx
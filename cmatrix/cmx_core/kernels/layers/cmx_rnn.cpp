@@ -1,4 +1,5 @@
 #include "cmx_rnn.hpp"
+#include "../cmx_gemm.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -8,8 +9,11 @@ namespace kernels {
 CmxRNN::CmxRNN() 
     : configured_(false)
     , state_buffer_(nullptr)
-    , temp_output_(nullptr) {
-    
+    , temp_output_(nullptr)
+    , quantized_(false)
+    , q_hidden_state_(nullptr)
+    , q_temp_output_(nullptr) {
+
     state_.hidden_state = nullptr;
     state_.initialized = false;
 }
@@ -30,13 +34,64 @@ bool CmxRNN::configure(const Config& config, void* state_buffer, size_t state_bu
         return false;
     }
 
+    quantized_ = false;
     reset_state();
     configured_ = true;
     return true;
 }
 
+bool CmxRNN::configure_quantized(const Config& config, const QuantConfig& quant_config,
+                                 void* state_buffer, size_t state_buffer_size) {
+    // Adopt the configuration first: get_state_buffer_size() reads it
+    config_ = config;
+    quant_config_ = quant_config;
+
+    if (!state_buffer || state_buffer_size < get_state_buffer_size()) {
+        return false;
+    }
+
+    // The Q0.15 state format needs a bounded activation
+    if (config_.activation != ActivationType::TANH) {
+        return false;
+    }
+
+    if (!quant_config_.input_weights || !quant_config_.hidden_weights) {
+        return false;
+    }
+
+    state_buffer_ = state_buffer;
+
+    if (!initialize_quantized_state_buffer()) {
+        return false;
+    }
+
+    // Fold every scale into one multiply-and-shift per branch. The
+    // accumulators carry raw INT8xINT16 products; the input branch maps
+    // them through input_scale * weight_scale to Q3.12 pre-activations,
+    // the hidden branch through the Q0.15 state scale (1/32768)
+    const uint32_t hidden_size = config_.hidden_size;
+    q_input_requant_ = utils::calculate_fixed_point_scale(
+        quant_config_.input_scale * quant_config_.input_weight_scale * 4096.0f);
+    q_hidden_requant_ = utils::calculate_fixed_point_scale(
+        quant_config_.hidden_weight_scale * (4096.0f / 32768.0f));
+
+    q_bias_.assign(hidden_size, 0);
+    if (quant_config_.bias) {
+        for (uint32_t i = 0; i < hidden_size; ++i) {
+            q_bias_[i] = static_cast<int32_t>(lroundf(quant_config_.bias[i] * 4096.0f));
+        }
+    }
+
+    activations::build_tanh_lut_q15(tanh_lut_);
+
+    quantized_ = true;
+    configured_ = true;
+    reset_state();
+    return true;
+}
+
 bool CmxRNN::run(const float* input, uint32_t sequence_length, float* output, float* final_state) {
-    if (!configured_ || !input || !output) {
+    if (!configured_ || quantized_ || !input || !output) {
         return false;
     }
 
@@ -75,6 +130,45 @@ bool CmxRNN::run(const float* input, uint32_t sequence_length, float* output, fl
     return true;
 }
 
+bool CmxRNN::run_quantized(const int16_t* input, uint32_t sequence_length,
+                           int16_t* output, int16_t* final_state) {
+    if (!configured_ || !quantized_ || !input || !output) {
+        return false;
+    }
+
+    const uint32_t batch_size = config_.batch_size;
+    const uint32_t input_size = config_.input_size;
+    const uint32_t hidden_size = config_.hidden_size;
+
+    // Process each timestep
+    for (uint32_t t = 0; t < sequence_length; ++t) {
+        for (uint32_t b = 0; b < batch_size; ++b) {
+            const int16_t* current_input = input + (t * batch_size + b) * input_size;
+            int16_t* current_hidden = q_hidden_state_ + b * hidden_size;
+
+            quantized_step(current_input, current_hidden);
+
+            // Copy to output if returning sequences
+            if (config_.return_sequences) {
+                int16_t* output_ptr = output + (t * batch_size + b) * hidden_size;
+                std::memcpy(output_ptr, current_hidden, hidden_size * sizeof(int16_t));
+            }
+        }
+    }
+
+    // Copy final hidden state to output if not returning sequences
+    if (!config_.return_sequences) {
+        std::memcpy(output, q_hidden_state_, batch_size * hidden_size * sizeof(int16_t));
+    }
+
+    // Copy final state if requested
+    if (config_.return_state && final_state) {
+        std::memcpy(final_state, q_hidden_state_, batch_size * hidden_size * sizeof(int16_t));
+    }
+
+    return true;
+}
+
 bool CmxRNN::infer_shape(const uint32_t* input_shape, uint32_t* output_shape) {
     if (!input_shape || !output_shape) {
         return false;
@@ -100,8 +194,12 @@ void CmxRNN::reset_state() {
     const uint32_t state_size = batch_size * hidden_size;
 
     // Zero initialize state
-    std::memset(state_.hidden_state, 0, state_size * sizeof(float));
-    
+    if (quantized_) {
+        std::memset(q_hidden_state_, 0, state_size * sizeof(int16_t));
+    } else {
+        std::memset(state_.hidden_state, 0, state_size * sizeof(float));
+    }
+
     state_.initialized = true;
 }
 
@@ -120,7 +218,9 @@ size_t CmxRNN::get_state_buffer_size() const {
     
     // Alignment padding
     size += 16; // Conservative alignment padding
-    
+
+    // The quantized layout (INT16 state, one INT32 accumulator) is
+    // strictly smaller, so one size covers both paths
     return size;
 }
 
@@ -129,7 +229,7 @@ const float* CmxRNN::get_hidden_state() const {
 }
 
 bool CmxRNN::set_initial_state(const float* initial_state) {
-    if (!configured_ || !initial_state) {
+    if (!configured_ || quantized_ || !initial_state) {
         return false;
     }
 
@@ -213,16 +313,17 @@ void CmxRNN::tanh_inplace(float* data, uint32_t size) {
     }
 }
 
-void CmxRNN::matvec_multiply(const float* matrix, const float* vector, 
-                            const float* bias, float* result, 
+void CmxRNN::matvec_multiply(const float* matrix, const float* vector,
+                            const float* bias, float* result,
                             uint32_t rows, uint32_t cols) {
-    for (uint32_t i = 0; i < rows; ++i) {
-        float sum = bias ? bias[i] : 0.0f;
-        for (uint32_t j = 0; j < cols; ++j) {
-            sum += matrix[i * cols + j] * vector[j];
-        }
-        result[i] = sum;
+    if (bias) {
+        std::memcpy(result, bias, rows * sizeof(float));
     }
+
+    // Hot loop lives in the shared register-tiled GEMM core
+    gemv_f32(matrix, vector,
+             static_cast<int32_t>(rows), static_cast<int32_t>(cols),
+             result, bias != nullptr);
 }
 
 void CmxRNN::vector_add(const float* a, const float* b, float* result, uint32_t size) {
@@ -231,6 +332,38 @@ void CmxRNN::vector_add(const float* a, const float* b, float* result, uint32_t
     }
 }
 
+void CmxRNN::quantized_step(const int16_t* input, int16_t* hidden) {
+    const uint32_t input_size = config_.input_size;
+    const uint32_t hidden_size = config_.hidden_size;
+
+    // Pre-activations: INT8 x INT16 products are at most 2^22, so the
+    // INT32 accumulator keeps about 2^9 full-scale MACs of headroom —
+    // comfortable for the small cells the integer path targets
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        const int8_t* wx = quant_config_.input_weights + i * input_size;
+        const int8_t* wh = quant_config_.hidden_weights + i * hidden_size;
+
+        int32_t sum_x = 0;
+        for (uint32_t j = 0; j < input_size; ++j) {
+            sum_x += wx[j] * input[j];
+        }
+        int32_t sum_h = 0;
+        for (uint32_t j = 0; j < hidden_size; ++j) {
+            sum_h += wh[j] * hidden[j];
+        }
+
+        // Requantize both branches to Q3.12 on top of the folded bias
+        q_temp_output_[i] = q_bias_[i] +
+                            utils::apply_fixed_point_scale(sum_x, q_input_requant_) +
+                            utils::apply_fixed_point_scale(sum_h, q_hidden_requant_);
+    }
+
+    // h_t = tanh(pre-activation), written back in Q0.15
+    for (uint32_t i = 0; i < hidden_size; ++i) {
+        hidden[i] = activations::lookup_int16_lut(tanh_lut_, q_temp_output_[i]);
+    }
+}
+
 bool CmxRNN::initialize_state_buffer() {
     if (!state_buffer_) {
         return false;
@@ -260,5 +393,38 @@ bool CmxRNN::initialize_state_buffer() {
     return true;
 }
 
+bool CmxRNN::initialize_quantized_state_buffer() {
+    if (!state_buffer_) {
+        return false;
+    }
+
+    const uint32_t batch_size = config_.batch_size;
+    const uint32_t hidden_size = config_.hidden_size;
+
+    uint8_t* buffer = static_cast<uint8_t*>(state_buffer_);
+    size_t offset = 0;
+
+    // Align to 4-byte boundaries
+    auto align_offset = [](size_t offset, size_t alignment) {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    };
+
+    // Allocate hidden state (Q0.15)
+    offset = align_offset(offset, sizeof(int16_t));
+    q_hidden_state_ = reinterpret_cast<int16_t*>(buffer + offset);
+    offset += batch_size * hidden_size * sizeof(int16_t);
+
+    // Allocate pre-activation accumulator
+    offset = align_offset(offset, sizeof(int32_t));
+    q_temp_output_ = reinterpret_cast<int32_t*>(buffer + offset);
+    offset += hidden_size * sizeof(int32_t);
+
+    // The float-path pointers are invalid in this layout
+    state_.hidden_state = nullptr;
+    temp_output_ = nullptr;
+
+    return true;
+}
+
 } // namespace kernels
 } // namespace cmx
\ No newline at end of file
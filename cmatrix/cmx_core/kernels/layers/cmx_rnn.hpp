@@ -2,6 +2,10 @@
 
 #include <cstdint>
 #include <cstring>
+#include <vector>
+
+#include "../activations/cmx_int16_lut.hpp"
+#include "../../utils/cmx_quantization.hpp"
 
 namespace cmx {
 namespace kernels {
@@ -49,6 +53,26 @@ public:
         const float* bias;              ///< Hidden bias [hidden_size]
     };
 
+    /**
+     * @brief Quantized RNN layer configuration
+     *
+     * Weights are symmetric per-tensor INT8 (zero point 0); the bias
+     * stays float and is folded into fixed-point pre-activations at
+     * configure time. Inputs are INT16 with the given scale and the
+     * hidden state is INT16 in Q0.15, which is why the quantized path
+     * requires the TANH activation: an unbounded activation (RELU or
+     * NONE) has no fixed state range to quantize to.
+     */
+    struct QuantConfig {
+        float input_scale;              ///< Input activation scale (value = code * scale)
+
+        const int8_t* input_weights;    ///< Input-to-hidden weights [hidden_size x input_size]
+        const int8_t* hidden_weights;   ///< Hidden-to-hidden weights [hidden_size x hidden_size]
+        const float* bias;              ///< Hidden bias [hidden_size], float
+        float input_weight_scale;       ///< Scale of input_weights
+        float hidden_weight_scale;      ///< Scale of hidden_weights
+    };
+
     /**
      * @brief RNN internal state
      */
@@ -77,6 +101,24 @@ public:
      */
     bool configure(const Config& config, void* state_buffer, size_t state_buffer_size);
 
+    /**
+     * @brief Configure the RNN layer for integer-only inference
+     *
+     * Prepares the fixed-point requantizers, folds the float bias to
+     * Q3.12 pre-activation units, and builds the tanh lookup table.
+     * The quantized state layout fits inside get_state_buffer_size(),
+     * so memory planning does not change between paths. Fails unless
+     * config.activation is TANH.
+     *
+     * @param config Layer sizes and sequence flags (float weight pointers unused)
+     * @param quant_config Quantized weights, bias, and scales
+     * @param state_buffer Pre-allocated buffer for internal states
+     * @param state_buffer_size Size of the state buffer in bytes
+     * @return true if configuration successful, false otherwise
+     */
+    bool configure_quantized(const Config& config, const QuantConfig& quant_config,
+                             void* state_buffer, size_t state_buffer_size);
+
     /**
      * @brief Run RNN inference
      * 
@@ -88,6 +130,22 @@ public:
      */
     bool run(const float* input, uint32_t sequence_length, float* output, float* final_state = nullptr);
 
+    /**
+     * @brief Run integer-only RNN inference
+     *
+     * Requires configure_quantized(). Inputs use the configured input
+     * scale; outputs and the optional final state are the Q0.15 hidden
+     * state.
+     *
+     * @param input Input tensor [batch_size x sequence_length x input_size]
+     * @param sequence_length Length of input sequence
+     * @param output Output tensor [batch_size x (sequence_length or 1) x hidden_size]
+     * @param final_state Final hidden state (optional, only if return_state is true)
+     * @return true if inference successful, false otherwise
+     */
+    bool run_quantized(const int16_t* input, uint32_t sequence_length,
+                       int16_t* output, int16_t* final_state = nullptr);
+
     /**
      * @brief Infer output shape based on input shape
      * 
@@ -140,6 +198,38 @@ private:
     // Temporary buffer for computations
     float* temp_output_;                ///< Temporary output buffer
 
+    // Quantized path (configure_quantized). State lives in the same
+    // external buffer with an integer layout; scales are folded to
+    // fixed point once so timesteps are integer-only
+    QuantConfig quant_config_;          ///< Quantized layer configuration
+    bool quantized_;                    ///< Quantized path configured
+    int16_t* q_hidden_state_;           ///< Q0.15 hidden state [batch_size x hidden_size]
+    int32_t* q_temp_output_;            ///< Pre-activation accumulator [hidden_size]
+
+    utils::FixedPointScale q_input_requant_;   ///< acc(W_ih * x) -> Q3.12
+    utils::FixedPointScale q_hidden_requant_;  ///< acc(W_hh * h) -> Q3.12
+    std::vector<int32_t> q_bias_;              ///< [hidden_size] Q3.12 bias
+    activations::Int16LutTable tanh_lut_;      ///< Activation table
+
+    /**
+     * @brief Compute one integer-only RNN step
+     *
+     * INT8 x INT16 multiply-accumulates into INT32, fixed-point
+     * requantization to a Q3.12 pre-activation, then the tanh lookup
+     * table writes the Q0.15 hidden state in place.
+     *
+     * @param input Current input vector [input_size], INT16
+     * @param hidden Hidden state, updated in place [hidden_size], Q0.15
+     */
+    void quantized_step(const int16_t* input, int16_t* hidden);
+
+    /**
+     * @brief Initialize state buffer layout for the quantized path
+     *
+     * @return true if initialization successful, false otherwise
+     */
+    bool initialize_quantized_state_buffer();
+
     /**
      * @brief Compute RNN step: h_t = activation(W_ih * x_t + W_hh * h_{t-1} + b)
      * 
@@ -0,0 +1,159 @@
+#include "cmx_streaming_conv.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace cmx {
+namespace kernels {
+
+CmxStreamingConv::CmxStreamingConv()
+    : frame_ring_(nullptr)
+    , ring_frames_(0)
+    , ring_head_(0)
+    , frames_seen_(0)
+    , configured_(false) {
+}
+
+CmxStreamingConv::~CmxStreamingConv() {
+    // Note: We don't free the state buffer as it's managed externally
+}
+
+bool CmxStreamingConv::configure(const Config& config, void* state_buffer,
+                                 size_t state_buffer_size) {
+    // Adopt the configuration first: get_state_buffer_size() reads it
+    config_ = config;
+
+    if (config_.input_features == 0 || config_.output_features == 0 ||
+        config_.kernel_frames == 0 || config_.stride_frames == 0 ||
+        config_.dilation_frames == 0) {
+        return false;
+    }
+
+    if (!config_.weights) {
+        return false;
+    }
+
+    if (!state_buffer || state_buffer_size < get_state_buffer_size()) {
+        return false;
+    }
+
+    frame_ring_ = static_cast<float*>(state_buffer);
+    ring_frames_ = get_receptive_field();
+
+    reset_state();
+    configured_ = true;
+    return true;
+}
+
+uint32_t CmxStreamingConv::run(const float* input, uint32_t num_frames,
+                               float* output) {
+    if (!configured_ || !input || !output) {
+        return 0;
+    }
+
+    const uint32_t input_features = config_.input_features;
+    const uint32_t receptive_field = get_receptive_field();
+    uint32_t frames_out = 0;
+
+    for (uint32_t t = 0; t < num_frames; ++t) {
+        // Append the frame to the ring, overwriting the oldest slot
+        std::memcpy(frame_ring_ + ring_head_ * input_features,
+                    input + t * input_features,
+                    input_features * sizeof(float));
+        ring_head_ = (ring_head_ + 1) % ring_frames_;
+        ++frames_seen_;
+
+        // An output completes once the receptive field is full and the
+        // newest frame lands on a stride boundary
+        if (frames_seen_ < receptive_field) {
+            continue;
+        }
+        if ((frames_seen_ - receptive_field) % config_.stride_frames != 0) {
+            continue;
+        }
+
+        compute_frame(output + frames_out * config_.output_features);
+        ++frames_out;
+    }
+
+    return frames_out;
+}
+
+void CmxStreamingConv::reset_state() {
+    if (frame_ring_ && ring_frames_ > 0) {
+        std::memset(frame_ring_, 0,
+                    ring_frames_ * config_.input_features * sizeof(float));
+    }
+    ring_head_ = 0;
+    frames_seen_ = 0;
+}
+
+size_t CmxStreamingConv::get_state_buffer_size() const {
+    return static_cast<size_t>(get_receptive_field()) *
+           config_.input_features * sizeof(float);
+}
+
+uint32_t CmxStreamingConv::get_receptive_field() const {
+    return (config_.kernel_frames - 1) * config_.dilation_frames + 1;
+}
+
+uint32_t CmxStreamingConv::max_output_frames(uint32_t num_frames) const {
+    if (config_.stride_frames == 0) {
+        return 0;
+    }
+    return num_frames / config_.stride_frames + 1;
+}
+
+void CmxStreamingConv::compute_frame(float* output) {
+    const uint32_t input_features = config_.input_features;
+    const uint32_t output_features = config_.output_features;
+    const uint32_t kernel_frames = config_.kernel_frames;
+    const uint32_t dilation = config_.dilation_frames;
+
+    // ring_head_ already advanced past the newest frame; tap j reads
+    // (kernel_frames - 1 - j) * dilation frames back from it
+    const uint32_t newest = (ring_head_ + ring_frames_ - 1) % ring_frames_;
+
+    for (uint32_t o = 0; o < output_features; ++o) {
+        float acc = config_.bias ? config_.bias[o] : 0.0f;
+        const float* weight_base =
+            config_.weights + o * kernel_frames * input_features;
+
+        for (uint32_t j = 0; j < kernel_frames; ++j) {
+            const uint32_t back = (kernel_frames - 1 - j) * dilation;
+            const uint32_t slot = (newest + ring_frames_ - back) % ring_frames_;
+            const float* frame = frame_ring_ + slot * input_features;
+            const float* weight = weight_base + j * input_features;
+
+            for (uint32_t i = 0; i < input_features; ++i) {
+                acc += weight[i] * frame[i];
+            }
+        }
+
+        output[o] = acc;
+    }
+
+    apply_activation(output, output_features);
+}
+
+void CmxStreamingConv::apply_activation(float* data, uint32_t size) {
+    switch (config_.activation) {
+        case ActivationType::RELU:
+            for (uint32_t i = 0; i < size; ++i) {
+                if (data[i] < 0.0f) {
+                    data[i] = 0.0f;
+                }
+            }
+            break;
+        case ActivationType::TANH:
+            for (uint32_t i = 0; i < size; ++i) {
+                data[i] = tanhf(data[i]);
+            }
+            break;
+        case ActivationType::NONE:
+        default:
+            break;
+    }
+}
+
+} // namespace kernels
+} // namespace cmx
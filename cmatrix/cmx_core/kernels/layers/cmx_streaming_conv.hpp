@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace cmx {
+namespace kernels {
+
+/**
+ * @brief Streaming temporal convolution for sliding-window inference
+ *
+ * Sliding-window audio models (wake word, keyword spotting) re-run
+ * their whole convolution stack every hop even though almost all of
+ * the input window overlaps the previous one: at a 20 ms hop over a
+ * 1 s window, 98% of each layer's activations were already computed
+ * last frame. This class implements the streaming form of a temporal
+ * (1-D) convolution: a ring buffer retains the layer's receptive-field
+ * context across calls, and each call computes only the output frames
+ * that the newly arrived input frames complete. For a stack of such
+ * layers the per-hop cost drops from O(window) to O(hop) per layer.
+ *
+ * 2-D convolutions over a spectrogram whose kernels span the full
+ * feature (mel) axis lower to this form directly, with each time row
+ * flattened into one feature vector.
+ *
+ * Features:
+ * - Per-layer ring buffer sized to the temporal receptive field
+ * - Configurable temporal stride and dilation
+ * - Optional bias and fused activation
+ * - No dynamic memory allocation during inference
+ * - Stateful execution in the style of the recurrent layers
+ */
+class CmxStreamingConv {
+public:
+    /**
+     * @brief Fused activation function types
+     */
+    enum class ActivationType {
+        NONE,                           ///< No activation (linear)
+        RELU,                           ///< Rectified linear unit activation
+        TANH                            ///< Hyperbolic tangent activation
+    };
+
+    /**
+     * @brief Streaming convolution layer configuration
+     */
+    struct Config {
+        uint32_t input_features;        ///< Features per input frame
+        uint32_t output_features;       ///< Features per output frame
+        uint32_t kernel_frames;         ///< Temporal kernel taps
+        uint32_t stride_frames;         ///< Temporal stride
+        uint32_t dilation_frames;       ///< Temporal dilation
+        ActivationType activation;      ///< Activation function type
+
+        const float* weights;           ///< Weights [output_features x kernel_frames x input_features]
+        const float* bias;              ///< Bias [output_features] (can be nullptr)
+    };
+
+    /**
+     * @brief Constructor
+     */
+    CmxStreamingConv();
+
+    /**
+     * @brief Destructor
+     */
+    ~CmxStreamingConv();
+
+    /**
+     * @brief Configure the streaming convolution layer
+     *
+     * The state buffer holds the ring of retained input frames; size
+     * it with get_state_buffer_size() after filling in the config.
+     *
+     * @param config Layer configuration parameters
+     * @param state_buffer Pre-allocated buffer for the frame ring
+     * @param state_buffer_size Size of the state buffer in bytes
+     * @return true if configuration successful, false otherwise
+     */
+    bool configure(const Config& config, void* state_buffer, size_t state_buffer_size);
+
+    /**
+     * @brief Push input frames and compute the outputs they complete
+     *
+     * Frames are consumed in time order. An output frame is emitted
+     * once its full receptive field has been seen and the stride phase
+     * lines up, so the first calls after reset_state() produce fewer
+     * output frames than input frames while the ring warms up - the
+     * same warm-up a batch run's VALID padding gives implicitly.
+     *
+     * @param input Input frames [num_frames x input_features]
+     * @param num_frames Number of input frames pushed
+     * @param output Output frames [max_output_frames(num_frames) x output_features]
+     * @return Number of output frames written
+     */
+    uint32_t run(const float* input, uint32_t num_frames, float* output);
+
+    /**
+     * @brief Reset internal state
+     *
+     * Empties the frame ring; the next run() starts a fresh window.
+     */
+    void reset_state();
+
+    /**
+     * @brief Get required state buffer size
+     *
+     * @return Size in bytes needed for the frame ring
+     */
+    size_t get_state_buffer_size() const;
+
+    /**
+     * @brief Temporal receptive field of one output frame
+     *
+     * @return Input frames spanned: (kernel_frames - 1) * dilation + 1
+     */
+    uint32_t get_receptive_field() const;
+
+    /**
+     * @brief Upper bound on output frames for an input frame count
+     *
+     * Use this to size the output buffer passed to run(); the actual
+     * count returned may be lower during warm-up.
+     *
+     * @param num_frames Number of input frames to be pushed
+     * @return Maximum number of output frames run() can emit
+     */
+    uint32_t max_output_frames(uint32_t num_frames) const;
+
+private:
+    Config config_;                     ///< Layer configuration
+    float* frame_ring_;                 ///< Retained frames [ring_frames x input_features]
+    uint32_t ring_frames_;              ///< Ring capacity (receptive field in frames)
+    uint32_t ring_head_;                ///< Ring slot the next frame is written to
+    uint64_t frames_seen_;              ///< Total frames pushed since reset
+    bool configured_;                   ///< Configuration status
+
+    /**
+     * @brief Compute one output frame from the ring
+     *
+     * The newest frame in the ring is the last temporal tap; older
+     * taps are read back through the ring at dilation spacing.
+     *
+     * @param output Output frame [output_features]
+     */
+    void compute_frame(float* output);
+
+    /**
+     * @brief Apply activation function in-place
+     *
+     * @param data Data to apply activation to
+     * @param size Number of elements
+     */
+    void apply_activation(float* data, uint32_t size);
+};
+
+} // namespace kernels
+} // namespace cmx
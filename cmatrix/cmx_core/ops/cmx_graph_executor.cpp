@@ -1,22 +1,89 @@
 #include "cmx_graph_executor.hpp"
 #include "cmx_op_registry.hpp"
+#include "../runtime/cmx_dma.hpp"
+#include "../runtime/cmx_profiler.hpp"
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstring>
 #include <cstdlib>
+#include <thread>
 
 namespace cmx {
 
+namespace {
+
+// Floor-log2 of the latency in microseconds, clamped into the bucket
+// range; a short shift loop keeps it portable and still only a handful
+// of cycles for realistic latencies
+uint32_t latency_bucket_index(uint64_t latency_us) {
+    uint32_t index = 0;
+    while (latency_us > 1 && index < CMX_LATENCY_BUCKET_COUNT - 1) {
+        latency_us >>= 1;
+        index++;
+    }
+    return index;
+}
+
+// Read a byte range one cache line apart. The volatile accesses keep
+// the loop from being elided; 64 bytes covers every line size the
+// supported cores use (a smaller line just means touching every other
+// line twice as often as needed, which is still a warm cache).
+void touch_range(const void* ptr, size_t bytes) {
+    if (!ptr || bytes == 0) {
+        return;
+    }
+    const volatile uint8_t* p = static_cast<const volatile uint8_t*>(ptr);
+    for (size_t i = 0; i < bytes; i += 64) {
+        (void)p[i];
+    }
+    (void)p[bytes - 1];
+}
+
+} // namespace
+
 // Constructor
 cmx_graph_executor::cmx_graph_executor()
     : config_(cmx_default_graph_config())
     , stats_{}
     , graph_(nullptr)
     , executor_(nullptr)
+    , active_profile_(-1)
+    , weight_streamer_(nullptr)
+    , stream_weight_input_(1)
+    , early_exit_enabled_(false)
+    , early_exit_step_(0)
+    , early_exit_tensor_(0)
+    , early_exit_element_(0)
+    , early_exit_threshold_(0.0f)
+    , last_run_exited_early_(false)
+    , cycle_budget_(0)
+    , run_deadline_(0)
+    , last_run_hit_budget_(false)
+    , deterministic_enabled_(false)
+    , det_window_pos_(0)
+    , det_window_count_(0)
+    , input_gate_enabled_(false)
+    , gate_input_index_(0)
+    , gate_threshold_(0.0f)
+    , gate_block_size_(0)
+    , gate_dirty_blocks_(0)
+    , gate_prev_valid_(false)
+    , gate_prev_pending_(false)
+    , last_run_was_gated_(false)
+    , output_ready_callback_(nullptr)
+    , output_ready_user_data_(nullptr)
+    , output_ready_mask_(0)
+    , shared_workspace_align_(32)
+    , pipeline_enabled_(false)
+    , pipeline_split_(0)
+    , pipeline_in_flight_(false)
+    , pipeline_status_(cmx_status::SUCCESS)
     , is_loaded_(false)
     , is_optimized_(false)
     , current_memory_usage_(0)
     , peak_memory_usage_(0) {
-    
+
     executor_ = new cmx_op_executor(config_.executor_config);
 }
 
@@ -25,16 +92,50 @@ cmx_graph_executor::cmx_graph_executor(const cmx_graph_config& config)
     , stats_{}
     , graph_(nullptr)
     , executor_(nullptr)
+    , active_profile_(-1)
+    , weight_streamer_(nullptr)
+    , stream_weight_input_(1)
+    , early_exit_enabled_(false)
+    , early_exit_step_(0)
+    , early_exit_tensor_(0)
+    , early_exit_element_(0)
+    , early_exit_threshold_(0.0f)
+    , last_run_exited_early_(false)
+    , cycle_budget_(0)
+    , run_deadline_(0)
+    , last_run_hit_budget_(false)
+    , deterministic_enabled_(false)
+    , det_window_pos_(0)
+    , det_window_count_(0)
+    , input_gate_enabled_(false)
+    , gate_input_index_(0)
+    , gate_threshold_(0.0f)
+    , gate_block_size_(0)
+    , gate_dirty_blocks_(0)
+    , gate_prev_valid_(false)
+    , gate_prev_pending_(false)
+    , last_run_was_gated_(false)
+    , output_ready_callback_(nullptr)
+    , output_ready_user_data_(nullptr)
+    , output_ready_mask_(0)
+    , shared_workspace_align_(32)
+    , pipeline_enabled_(false)
+    , pipeline_split_(0)
+    , pipeline_in_flight_(false)
+    , pipeline_status_(cmx_status::SUCCESS)
     , is_loaded_(false)
     , is_optimized_(false)
     , current_memory_usage_(0)
     , peak_memory_usage_(0) {
-    
+
     executor_ = new cmx_op_executor(config_.executor_config);
 }
 
 // Destructor
 cmx_graph_executor::~cmx_graph_executor() {
+    if (pipeline_thread_.joinable()) {
+        pipeline_thread_.join();
+    }
     if (graph_) {
         cmx_destroy_graph(graph_);
     }
@@ -50,10 +151,18 @@ cmx_status cmx_graph_executor::load(const cmx_model& model) {
 }
 
 cmx_status cmx_graph_executor::load_from_graph(const cmx_graph& graph) {
+    // Pipelining state references the old graph's contexts
+    set_frame_pipelining(false);
+
     if (graph_) {
         cmx_destroy_graph(graph_);
     }
-    
+
+    // A new graph invalidates any previously compiled plan
+    compiled_plan_.clear();
+    fused_follower_.clear();
+    is_optimized_ = false;
+
     // Create a copy of the graph
     cmx_status status = cmx_create_graph(&graph_, graph.max_nodes, graph.max_tensors);
     if (status != cmx_status::SUCCESS) {
@@ -64,6 +173,15 @@ cmx_status cmx_graph_executor::load_from_graph(const cmx_graph& graph) {
     std::memcpy(graph_->nodes, graph.nodes, graph.node_count * sizeof(cmx_graph_node));
     std::memcpy(graph_->tensors, graph.tensors, graph.tensor_count * sizeof(cmx_tensor));
     
+    if (graph.input_nodes && graph.input_count > 0) {
+        std::memcpy(graph_->input_nodes, graph.input_nodes,
+                    graph.input_count * sizeof(uint32_t));
+    }
+    if (graph.output_nodes && graph.output_count > 0) {
+        std::memcpy(graph_->output_nodes, graph.output_nodes,
+                    graph.output_count * sizeof(uint32_t));
+    }
+
     graph_->node_count = graph.node_count;
     graph_->tensor_count = graph.tensor_count;
     graph_->input_count = graph.input_count;
@@ -75,7 +193,10 @@ cmx_status cmx_graph_executor::load_from_graph(const cmx_graph& graph) {
         
         if (config_.enable_optimization) {
             optimize_execution_order();
+            pack_node_contexts();
             optimize_memory_layout();
+            fuse_operations();
+            compile_plan();
         }
     }
     
@@ -87,7 +208,14 @@ cmx_status cmx_graph_executor::run() {
     if (!is_loaded_ || !graph_) {
         return cmx_status::ERROR_INVALID_CONTEXT;
     }
-    
+
+    // Pipelined mode repoints late-stage contexts at shadow tensors;
+    // a whole-plan pass would read the wrong halves of the ping-pong
+    // pairs, so it stays unavailable until pipelining is disabled
+    if (pipeline_enabled_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+
     // Validate graph before execution
     cmx_status status = validate_graph();
     if (status != cmx_status::SUCCESS) {
@@ -102,41 +230,110 @@ cmx_status cmx_graph_executor::run() {
         }
     }
     
-    // Start profiling if enabled
-    uint64_t start_time = 0;
-    if (config_.enable_profiling) {
-        // Would get actual timestamp
+    // Input-delta gate: an unchanged frame skips the plan entirely and
+    // the bound outputs keep the previous frame's results
+    last_run_was_gated_ = false;
+    if (input_gate_enabled_ && input_gate_unchanged()) {
+        last_run_was_gated_ = true;
+        stats_.gated_runs++;
+        return cmx_status::SUCCESS_CACHED;
     }
-    
-    // Execute nodes in order
-    for (uint32_t i = 0; i < graph_->node_count; ++i) {
-        uint32_t node_idx = graph_->execution_order[i];
-        status = execute_node(&graph_->nodes[node_idx]);
-        
+
+    // Deterministic mode warms every range the plan will touch before
+    // the timed region, so run-to-run cycle counts measure the plan,
+    // not the cache state the previous workload left behind
+    if (deterministic_enabled_) {
+        prewarm_plan_caches();
+    }
+
+    // Timed unconditionally: the end-to-end counters and the latency
+    // histogram are the always-on fleet monitoring surface
+    const uint64_t start_time = runtime::HighResTimer::now();
+
+    // Arm the watchdog deadline once; every node-boundary check is then
+    // a single timer load and 64-bit compare against this value
+    last_run_hit_budget_ = false;
+    run_deadline_ = cycle_budget_ ? start_time + cycle_budget_ : 0;
+
+    reset_output_readiness();
+
+
+    // Fast path: walk the compiled plan. The topological order already
+    // guarantees dependencies, so there are no readiness checks, flag
+    // resets, or op-name lookups per node - just indirect calls.
+    if (!compiled_plan_.empty()) {
+        // Weight streaming acquires layers in plan order, early exit
+        // must see a quiescent plan at its check point, and
+        // deterministic mode mandates fixed ordering, so any of them
+        // pins execution to the serial path
+        status = (config_.enable_parallel_execution && !weight_streamer_ &&
+                  !early_exit_enabled_ && !deterministic_enabled_ &&
+                  level_offsets_.size() > 1)
+            ? run_plan_parallel()
+            : run_plan_serial();
         if (status != cmx_status::SUCCESS) {
-            stats_.failed_executions++;
+            // Budget aborts are a deliberate deadline mechanism, not a
+            // failure; they get their own stats entry
+            if (status == cmx_status::ERROR_BUDGET_EXCEEDED) {
+                last_run_hit_budget_ = true;
+                stats_.budget_aborts++;
+            } else {
+                stats_.failed_executions++;
+            }
             return status;
         }
-        
-        stats_.total_nodes_executed++;
+    } else {
+        // Fallback: per-node dispatch with readiness bookkeeping
+        for (uint32_t i = 0; i < graph_->node_count; ++i) {
+            uint32_t node_idx = graph_->execution_order[i];
+            status = execute_node(&graph_->nodes[node_idx]);
+
+            if (status != cmx_status::SUCCESS) {
+                stats_.failed_executions++;
+                return status;
+            }
+
+            stats_.total_nodes_executed++;
+
+            if (budget_exceeded()) {
+                last_run_hit_budget_ = true;
+                stats_.budget_aborts++;
+                return cmx_status::ERROR_BUDGET_EXCEEDED;
+            }
+        }
     }
     
-    // End profiling if enabled
+    const uint64_t end_time = runtime::HighResTimer::now();
+    const uint64_t execution_time =
+        runtime::HighResTimer::duration_us(start_time, end_time);
+
+    if (deterministic_enabled_) {
+        record_deterministic_sample(end_time - start_time);
+    }
+
+    mark_all_outputs_ready();
+
+    stats_.total_graphs_executed++;
+    stats_.total_execution_time += execution_time;
+    stats_.avg_graph_execution_time = stats_.total_execution_time / stats_.total_graphs_executed;
+    stats_.latency_buckets[latency_bucket_index(execution_time)]++;
+
     if (config_.enable_profiling) {
-        uint64_t end_time = 0; // Would get actual timestamp
-        uint64_t execution_time = end_time - start_time;
-        
-        stats_.total_graphs_executed++;
-        stats_.total_execution_time += execution_time;
-        stats_.avg_graph_execution_time = stats_.total_execution_time / stats_.total_graphs_executed;
-        
         // Update peak memory usage
         if (current_memory_usage_ > peak_memory_usage_) {
             peak_memory_usage_ = current_memory_usage_;
             stats_.memory_peak_usage = static_cast<uint32_t>(peak_memory_usage_);
         }
     }
-    
+
+    // The snapshot taken before this run now backs completed outputs
+    // and may gate the next frame; failed runs never reach here, so a
+    // pending snapshot after an abort stays invalid
+    if (gate_prev_pending_) {
+        gate_prev_valid_ = true;
+        gate_prev_pending_ = false;
+    }
+
     return cmx_status::SUCCESS;
 }
 
@@ -170,10 +367,28 @@ cmx_status cmx_graph_executor::run(cmx_tensor* inputs, uint32_t input_count,
 cmx_status cmx_graph_executor::run_batch(cmx_tensor** input_batches, uint32_t* input_counts,
                                         cmx_tensor** output_batches, uint32_t* output_counts,
                                         uint32_t batch_size) {
-    if (batch_size > config_.max_batch_size) {
+    if (batch_size == 0 || batch_size > config_.max_batch_size) {
         return cmx_status::ERROR_INVALID_ARGS;
     }
-    
+
+    // Make sure the plan exists before deciding how to run the batch
+    if (!is_optimized_) {
+        cmx_status status = schedule_execution();
+        if (status != cmx_status::SUCCESS) {
+            return status;
+        }
+    }
+
+    // Node-major execution runs each node across all input sets while
+    // its weights are hot in cache, turning N graph traversals into one
+    // and cutting weight-fetch traffic N-fold. It needs the compiled
+    // plan; weight streaming keeps the graph-major order because layers
+    // must be acquired once each, in sequence.
+    if (batch_size > 1 && !compiled_plan_.empty() && !weight_streamer_) {
+        return run_batch_node_major(input_batches, input_counts,
+                                    output_batches, output_counts, batch_size);
+    }
+
     for (uint32_t batch = 0; batch < batch_size; ++batch) {
         cmx_status status = run(input_batches[batch], input_counts[batch],
                                output_batches[batch], output_counts[batch]);
@@ -181,7 +396,108 @@ cmx_status cmx_graph_executor::run_batch(cmx_tensor** input_batches, uint32_t* i
             return status;
         }
     }
-    
+
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::run_batch_node_major(
+    cmx_tensor** input_batches, uint32_t* input_counts,
+    cmx_tensor** output_batches, uint32_t* output_counts,
+    uint32_t batch_size) {
+    for (uint32_t n = 0; n < batch_size; ++n) {
+        if (!input_batches[n] || !output_batches[n] ||
+            input_counts[n] != graph_->input_count ||
+            output_counts[n] != graph_->output_count) {
+            return cmx_status::ERROR_INVALID_ARGS;
+        }
+    }
+
+    // Each batch needs its own copies of the graph-owned activation
+    // buffers, since node K+1 reads what node K produced for the same
+    // batch. Batch 0 runs in the graph's own buffers; batches 1..N-1
+    // get one flat scratch block each, laid out by tensor offset.
+    std::vector<size_t> tensor_offset(graph_->tensor_count, SIZE_MAX);
+    std::vector<void*> base_data(graph_->tensor_count, nullptr);
+    size_t scratch_size = 0;
+    for (uint32_t t = 0; t < graph_->tensor_count; ++t) {
+        cmx_tensor* tensor = &graph_->tensors[t];
+        base_data[t] = tensor->data;
+        if (tensor->data && tensor->byte_size > 0) {
+            tensor_offset[t] = scratch_size;
+            scratch_size = (scratch_size + tensor->byte_size + 7) & ~size_t(7);
+        }
+    }
+
+    std::vector<std::vector<uint8_t>> scratch(batch_size - 1);
+    for (auto& block : scratch) {
+        block.resize(scratch_size);
+    }
+
+    // Point a context slot at batch n's copy of a graph-owned tensor;
+    // external tensors (graph I/O bound into contexts) are left alone
+    auto rebind = [&](cmx_tensor* tensor, uint32_t n) {
+        if (!tensor) {
+            return;
+        }
+        const std::ptrdiff_t idx = tensor - graph_->tensors;
+        if (idx < 0 ||
+            idx >= static_cast<std::ptrdiff_t>(graph_->tensor_count) ||
+            tensor_offset[idx] == SIZE_MAX) {
+            return;
+        }
+        tensor->data = (n == 0)
+            ? base_data[idx]
+            : static_cast<void*>(scratch[n - 1].data() + tensor_offset[idx]);
+    };
+
+    cmx_status status = cmx_status::SUCCESS;
+
+    for (const cmx_plan_step& step : compiled_plan_) {
+        for (uint32_t n = 0; n < batch_size && status == cmx_status::SUCCESS;
+             ++n) {
+            // Bind this batch's user tensors if the step is a graph
+            // input or output node
+            for (uint32_t i = 0; i < graph_->input_count; ++i) {
+                if (graph_->nodes[graph_->input_nodes[i]].context ==
+                    step.context) {
+                    set_input(i, &input_batches[n][i]);
+                }
+            }
+            for (uint32_t i = 0; i < graph_->output_count; ++i) {
+                if (graph_->nodes[graph_->output_nodes[i]].context ==
+                    step.context) {
+                    set_output(i, &output_batches[n][i]);
+                }
+            }
+
+            // Swing the step's graph-owned tensors to batch n's buffers
+            for (uint32_t i = 0; i < step.context->input_count; ++i) {
+                rebind(step.context->inputs[i], n);
+            }
+            for (uint32_t i = 0; i < step.context->output_count; ++i) {
+                rebind(step.context->outputs[i], n);
+            }
+
+            status = run_plan_step(step);
+        }
+
+        if (status != cmx_status::SUCCESS) {
+            break;
+        }
+        stats_.total_nodes_executed += batch_size;
+    }
+
+    // Restore the graph's own buffers for subsequent single runs
+    for (uint32_t t = 0; t < graph_->tensor_count; ++t) {
+        graph_->tensors[t].data = base_data[t];
+    }
+
+    if (status != cmx_status::SUCCESS) {
+        stats_.failed_executions++;
+        return status;
+    }
+
+    stats_.total_graphs_executed += batch_size;
     return cmx_status::SUCCESS;
 }
 
@@ -286,6 +602,9 @@ const cmx_graph_stats& cmx_graph_executor::get_stats() const {
 void cmx_graph_executor::reset_stats() {
     std::memset(&stats_, 0, sizeof(stats_));
     peak_memory_usage_ = 0;
+    std::fill(node_stats_.begin(), node_stats_.end(), cmx_node_stats{});
+    det_window_pos_ = 0;
+    det_window_count_ = 0;
 }
 
 cmx_status cmx_graph_executor::get_node_profile(uint32_t node_id, uint64_t& execution_time) {
@@ -302,6 +621,53 @@ cmx_status cmx_graph_executor::get_node_profile(uint32_t node_id, uint64_t& exec
     return cmx_status::ERROR_INVALID_CONTEXT;
 }
 
+cmx_status cmx_graph_executor::get_node_stats(uint32_t node_id,
+                                              cmx_node_stats& out) const {
+    if (node_id >= node_stats_.size()) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    out = node_stats_[node_id];
+    return cmx_status::SUCCESS;
+}
+
+uint32_t cmx_graph_executor::dump_node_stats(cmx_node_stats* out,
+                                             uint32_t max_count) const {
+    if (!out) {
+        return 0;
+    }
+    const uint32_t count = std::min(
+        max_count, static_cast<uint32_t>(node_stats_.size()));
+    std::memcpy(out, node_stats_.data(), count * sizeof(cmx_node_stats));
+    return count;
+}
+
+void cmx_graph_executor::record_node_sample(uint32_t node_id, uint64_t cycles,
+                                            const cmx_op_context& context) {
+    cmx_node_stats& slot = node_stats_[node_id];
+    slot.total_cycles += cycles;
+    if (cycles > slot.max_cycles) {
+        slot.max_cycles = cycles;
+    }
+    slot.call_count++;
+
+    // Sum the bytes bound to the context right now, so aliased and
+    // rebatched buffers count as they are actually laid out
+    size_t bound_bytes = 0;
+    for (uint32_t i = 0; i < context.input_count; ++i) {
+        if (context.inputs[i]) {
+            bound_bytes += context.inputs[i]->byte_size;
+        }
+    }
+    for (uint32_t i = 0; i < context.output_count; ++i) {
+        if (context.outputs[i]) {
+            bound_bytes += context.outputs[i]->byte_size;
+        }
+    }
+    if (bound_bytes > slot.peak_working_set) {
+        slot.peak_working_set = bound_bytes;
+    }
+}
+
 // Memory management
 size_t cmx_graph_executor::get_memory_usage() const {
     return current_memory_usage_;
@@ -311,11 +677,36 @@ cmx_status cmx_graph_executor::optimize_memory() {
     if (!graph_) {
         return cmx_status::ERROR_INVALID_CONTEXT;
     }
-    
+
+    // Fold scratch allocations made after load (the plan compiles before
+    // the application binds per-node workspaces) into the shared arena
+    bind_shared_workspace();
+
     // Simple memory optimization - reuse tensors where possible
     return optimize_memory_layout();
 }
 
+cmx_status cmx_graph_executor::set_weight_streamer(
+    runtime::CMXWeightStreamer* streamer, uint32_t weight_input_index) {
+    if (weight_input_index >= CMX_MAX_OP_INPUTS) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    // Streaming acquires weights in plan order and cannot overlap two
+    // frames; disable pipelining first
+    if (pipeline_enabled_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+
+    weight_streamer_ = streamer;
+    stream_weight_input_ = weight_input_index;
+
+    // Rebuild the plan so the streamer sees the layers in plan order
+    if (is_loaded_ && graph_) {
+        return compile_plan();
+    }
+    return cmx_status::SUCCESS;
+}
+
 // Private methods
 cmx_status cmx_graph_executor::initialize_graph() {
     if (!graph_) {
@@ -336,130 +727,1836 @@ cmx_status cmx_graph_executor::initialize_graph() {
         // Set node properties
         node->is_ready = false;
         node->is_executed = false;
+        node->is_elided = false;
     }
-    
+
+    // Preallocate the per-node stats slots so the profiling path never
+    // allocates while the graph runs
+    node_stats_.assign(graph_->node_count, cmx_node_stats{});
+
     return allocate_tensors();
 }
 
 cmx_status cmx_graph_executor::schedule_execution() {
-    return topological_sort();
-}
+    cmx_status status = topological_sort();
+    if (status != cmx_status::SUCCESS) {
+        return status;
+    }
 
-cmx_status cmx_graph_executor::execute_node(cmx_graph_node* node) {
-    if (!node || !node->context) {
-        return cmx_status::ERROR_INVALID_ARGS;
+    status = pack_node_contexts();
+    if (status != cmx_status::SUCCESS) {
+        return status;
     }
-    
-    // Check if node is ready for execution
-    if (!is_node_ready(node)) {
-        return cmx_status::ERROR_EXECUTION_FAILED;
+
+    status = elide_reshape_nodes();
+    if (status != cmx_status::SUCCESS) {
+        return status;
     }
-    
-    // Execute the operation
-    cmx_status status = executor_->execute_op(node->op_name, *node->context);
-    
-    if (status == cmx_status::SUCCESS) {
-        mark_node_executed(node);
+
+    status = fuse_operations();
+    if (status != cmx_status::SUCCESS) {
+        return status;
     }
-    
-    return status;
+
+    return compile_plan();
 }
 
-cmx_status cmx_graph_executor::validate_graph() {
+// Build the static execution plan: one (execute fn, context) pair per
+// node in topological order, with op names resolved through the
+// registry exactly once. run() then just walks the flat array.
+//
+// With parallel execution enabled, steps are grouped into dependency
+// levels (nodes whose inputs all come from earlier levels) so the
+// parallel runner can fan each level out across both cores. The
+// level-grouped order is still topological, so the serial runner can
+// walk the same array.
+cmx_status cmx_graph_executor::compile_plan() {
+    compiled_plan_.clear();
+    level_offsets_.clear();
+    stats_taps_.clear();  // Taps are bound to plan steps; re-arm after load
+    profiles_.clear();    // So are profiles; redefine after load
+    active_profile_ = -1;
+
     if (!graph_) {
         return cmx_status::ERROR_INVALID_CONTEXT;
     }
-    
-    // Basic validation - check that all nodes have valid operations
-    for (uint32_t i = 0; i < graph_->node_count; ++i) {
-        const cmx_graph_node* node = &graph_->nodes[i];
-        if (!cmx_is_op_registered(node->op_name)) {
-            return cmx_status::ERROR_UNSUPPORTED_OP;
+
+    std::vector<uint32_t> order(graph_->execution_order,
+                                graph_->execution_order + graph_->node_count);
+
+    if (config_.enable_parallel_execution && graph_->node_count > 1) {
+        // Dependency level of each node: one past the deepest input
+        std::vector<uint32_t> level(graph_->node_count, 0);
+        uint32_t max_level = 0;
+        for (uint32_t i = 0; i < graph_->node_count; ++i) {
+            const cmx_graph_node* node = &graph_->nodes[order[i]];
+            uint32_t node_level = 0;
+            for (uint32_t j = 0; j < node->input_count; ++j) {
+                uint32_t dep = node->input_nodes[j];
+                if (dep < graph_->node_count) {
+                    node_level = std::max(node_level, level[dep] + 1);
+                }
+            }
+            level[order[i]] = node_level;
+            max_level = std::max(max_level, node_level);
+        }
+
+        // Drop elided nodes only after their levels are known, so a
+        // consumer of an elided reshape still orders after the
+        // reshape's real producer
+        order.erase(std::remove_if(order.begin(), order.end(),
+                                   [this](uint32_t id) {
+                                       return graph_->nodes[id].is_elided;
+                                   }),
+                    order.end());
+
+        std::stable_sort(order.begin(), order.end(),
+                         [&level](uint32_t a, uint32_t b) {
+                             return level[a] < level[b];
+                         });
+
+        level_offsets_.reserve(max_level + 2);
+        uint32_t current_level = 0;
+        level_offsets_.push_back(0);
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            while (level[order[i]] > current_level) {
+                level_offsets_.push_back(i);
+                current_level++;
+            }
         }
+        level_offsets_.push_back(static_cast<uint32_t>(order.size()));
     }
-    
-    return cmx_status::SUCCESS;
-}
 
-// Optimization methods (simplified implementations)
-cmx_status cmx_graph_executor::optimize_execution_order() {
-    return topological_sort();
-}
+    compiled_plan_.reserve(graph_->node_count);
+    for (uint32_t node_id : order) {
+        cmx_graph_node* node = &graph_->nodes[node_id];
+        if (node->is_elided) {
+            continue;  // Folded into a metadata rewrite at schedule time
+        }
+        const cmx_op* op = cmx_get_op(node->op_name);
 
-cmx_status cmx_graph_executor::optimize_memory_layout() {
-    // Placeholder for memory layout optimization
-    return cmx_status::SUCCESS;
-}
+        if (!op || !op->execute || !node->context) {
+            // Node not resolvable to a direct call (unregistered or
+            // contextless); keep the per-node fallback path instead
+            compiled_plan_.clear();
+            level_offsets_.clear();
+            return cmx_status::SUCCESS;
+        }
 
-cmx_status cmx_graph_executor::fuse_operations() {
-    // Placeholder for operation fusion
-    return cmx_status::SUCCESS;
-}
+        compiled_plan_.push_back({op->execute, node->context,
+                                  !op->writes_all_outputs, -1, nullptr,
+                                  node_id, -1, nullptr, nullptr});
 
-// Scheduling methods
-cmx_status cmx_graph_executor::topological_sort() {
-    if (!graph_) {
-        return cmx_status::ERROR_INVALID_CONTEXT;
-    }
-    
-    // Simple topological sort implementation
-    // In practice, this would be more sophisticated
-    for (uint32_t i = 0; i < graph_->node_count; ++i) {
-        graph_->execution_order[i] = i;
-        graph_->nodes[i].execution_order = i;
+        // Wire the microfused follower into its producer's step
+        if (node_id < fused_follower_.size() &&
+            fused_follower_[node_id] >= 0) {
+            const cmx_graph_node* follower =
+                &graph_->nodes[fused_follower_[node_id]];
+            const cmx_op* follower_op = cmx_get_op(follower->op_name);
+            if (follower_op && follower_op->execute && follower->context) {
+                cmx_plan_step& step = compiled_plan_.back();
+                step.fused_execute = follower_op->execute;
+                step.fused_context = follower->context;
+            }
+        }
+
+        // Register the node's weight blob with the streamer so its DMA
+        // prefetch can run while the previous node computes
+        if (weight_streamer_ &&
+            stream_weight_input_ < node->context->input_count) {
+            cmx_tensor* weights = node->context->inputs[stream_weight_input_];
+            if (weights && weights->data && weights->byte_size > 0) {
+                cmx_plan_step& step = compiled_plan_.back();
+                step.stream_layer = static_cast<int32_t>(
+                    weight_streamer_->add_layer(weights->data,
+                                                weights->byte_size));
+                step.weight_tensor = weights;
+            }
+        }
     }
-    
-    is_optimized_ = true;
+
+    bind_shared_workspace();
+    compute_output_final_steps();
+
     return cmx_status::SUCCESS;
 }
 
-bool cmx_graph_executor::is_node_ready(const cmx_graph_node* node) {
-    // Check if all input nodes have been executed
-    for (uint32_t i = 0; i < node->input_count; ++i) {
-        uint32_t input_node_id = node->input_nodes[i];
-        if (!graph_->nodes[input_node_id].is_executed) {
-            return false;
+// Map each graph output to the compiled plan step that finalizes it:
+// the last step executing the output's node. Plan order already honors
+// dependencies, so once that step completes the tensor never changes
+// again within the run.
+void cmx_graph_executor::compute_output_final_steps() {
+    output_final_step_.assign(graph_ ? graph_->output_count : 0, UINT32_MAX);
+    if (compiled_plan_.empty() || !graph_) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < graph_->output_count; ++i) {
+        uint32_t output_node = graph_->output_nodes[i];
+        for (uint32_t s = 0; s < compiled_plan_.size(); ++s) {
+            if (compiled_plan_[s].node_id == output_node) {
+                output_final_step_[i] = s;
+            }
         }
     }
-    return true;
 }
 
-void cmx_graph_executor::mark_node_executed(cmx_graph_node* node) {
-    node->is_executed = true;
-}
+// Collapse per-node scratch allocations into one shared arena. Only one
+// node runs at a time on the serial plan, so workspaces are sequential
+// by construction and the arena just needs the max over all nodes; the
+// per-node private allocations that coexisted for the whole graph
+// lifetime are freed.
+void cmx_graph_executor::bind_shared_workspace() {
+    if (compiled_plan_.empty()) {
+        return;
+    }
 
-// Memory management helpers
-cmx_status cmx_graph_executor::allocate_tensors() {
-    if (!graph_) {
-        return cmx_status::ERROR_INVALID_CONTEXT;
+    // Nodes within one dependency level may run concurrently on the
+    // parallel path, so their scratch regions must stay private
+    if (config_.enable_parallel_execution && !level_offsets_.empty()) {
+        return;
     }
-    
-    // Calculate total memory needed
-    size_t total_memory = 0;
-    for (uint32_t i = 0; i < graph_->tensor_count; ++i) {
-        total_memory += graph_->tensors[i].byte_size;
+
+    size_t max_scratch = 0;
+    size_t max_align = 32;
+    for (const cmx_plan_step& step : compiled_plan_) {
+        max_scratch = std::max(max_scratch, step.context->scratch.size);
+        max_align = std::max(max_align, step.context->scratch.alignment);
     }
-    
-    if (config_.memory_limit > 0 && total_memory > config_.memory_limit) {
-        return cmx_status::ERROR_OUT_OF_MEMORY;
+
+    if (max_scratch == 0) {
+        shared_workspace_.clear();
+        return;
     }
-    
-    current_memory_usage_ = total_memory;
-    return cmx_status::SUCCESS;
-}
 
-void cmx_graph_executor::free_tensors() {
-    // Placeholder for tensor deallocation
-}
+    // Over-allocate by the alignment so the bound pointer can be aligned
+    // inside the vector's storage
+    shared_workspace_.resize(max_scratch + max_align);
+    shared_workspace_align_ = max_align;
 
-void cmx_graph_executor::update_memory_usage() {
-    // Placeholder for dynamic memory usage tracking
+    for (const cmx_plan_step& step : compiled_plan_) {
+        bind_context_scratch(step.context, shared_workspace_, max_align);
+    }
 }
 
-// C-style API functions
-cmx_graph_executor* cmx_create_graph_executor() {
-    return new cmx_graph_executor();
-}
+void cmx_graph_executor::bind_context_scratch(cmx_op_context* ctx,
+                                              std::vector<uint8_t>& arena,
+                                              size_t alignment) {
+    // Release any private allocation before pointing at the arena
+    if (ctx->owns_scratch) {
+        cmx_free_scratch(ctx);
+    }
+
+    const uintptr_t base = reinterpret_cast<uintptr_t>(arena.data());
+    const uintptr_t aligned = (base + alignment - 1) & ~(alignment - 1);
+
+    ctx->scratch.ptr = reinterpret_cast<void*>(aligned);
+    ctx->scratch.size = arena.size() - (aligned - base);
+    ctx->scratch.alignment = alignment;
+    ctx->scratch.is_allocated = true;
+    ctx->owns_scratch = false;  // Arena is executor-owned
+}
+
+cmx_status cmx_graph_executor::run_plan_step(const cmx_plan_step& step) {
+    if (step.zero_fill_outputs) {
+        for (uint32_t i = 0; i < step.context->output_count; ++i) {
+            cmx_tensor* tensor = step.context->outputs[i];
+            if (tensor && tensor->data && tensor->byte_size > 0) {
+                std::memset(tensor->data, 0, tensor->byte_size);
+            }
+        }
+    }
+
+    if (!config_.enable_profiling || step.node_id >= node_stats_.size()) {
+        cmx_status status = step.execute(*step.context);
+        if (status == cmx_status::SUCCESS && step.fused_execute) {
+            status = step.fused_execute(*step.fused_context);
+        }
+        if (status == cmx_status::SUCCESS && step.stats_tap >= 0) {
+            update_stats_tap(step.stats_tap);
+        }
+        return status;
+    }
+
+    const uint64_t start = runtime::HighResTimer::now();
+    cmx_status status = step.execute(*step.context);
+    if (status == cmx_status::SUCCESS && step.fused_execute) {
+        // The follower is part of this step's work; its cycles are
+        // attributed to the producing node's slot
+        status = step.fused_execute(*step.fused_context);
+    }
+    const uint64_t end = runtime::HighResTimer::now();
+    record_node_sample(step.node_id, end - start, *step.context);
+    if (status == cmx_status::SUCCESS && step.stats_tap >= 0) {
+        update_stats_tap(step.stats_tap);
+    }
+    return status;
+}
+
+// One read-only sweep of the tapped tensor, folded into the producing
+// step's epilogue so the tensor is still cache-hot when scanned
+void cmx_graph_executor::update_stats_tap(int32_t tap_index) {
+    if (tap_index < 0 ||
+        static_cast<size_t>(tap_index) >= stats_taps_.size()) {
+        return;
+    }
+    cmx_stats_tap& tap = stats_taps_[tap_index];
+    if (!graph_ || tap.tensor_id >= graph_->tensor_count) {
+        return;
+    }
+    const cmx_tensor& tensor = graph_->tensors[tap.tensor_id];
+    if (!tensor.data || tensor.size == 0) {
+        return;
+    }
+
+    const float* values = static_cast<const float*>(tensor.data);
+    float lo = tap.stats.min_value;
+    float hi = tap.stats.max_value;
+    uint64_t saturated = 0;
+    for (size_t i = 0; i < tensor.size; ++i) {
+        const float v = values[i];
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+        if (v <= tap.saturation_low || v >= tap.saturation_high) {
+            saturated++;
+        }
+    }
+    tap.stats.min_value = lo;
+    tap.stats.max_value = hi;
+    tap.stats.saturation_count += saturated;
+    tap.stats.sample_count += tensor.size;
+}
+
+cmx_status cmx_graph_executor::run_plan_serial() {
+    // Kick off the first weight prefetch before any compute starts
+    if (weight_streamer_ && weight_streamer_->layer_count() > 0) {
+        weight_streamer_->reset();
+        if (!weight_streamer_->begin()) {
+            return cmx_status::ERROR_EXECUTION_FAILED;
+        }
+    }
+
+    last_run_exited_early_ = false;
+
+    for (uint32_t i = 0; i < compiled_plan_.size(); ++i) {
+        const cmx_plan_step& step = compiled_plan_[i];
+
+        // Steps outside the active profile's subgraph are skipped; the
+        // backbone prefix shared by every profile runs as always
+        if (active_profile_ >= 0 &&
+            !profiles_[active_profile_].step_mask[i]) {
+            continue;
+        }
+
+        // Wait for this node's weights (a no-op when the DMA finished
+        // during the previous node) and start the next node's transfer
+        if (step.stream_layer >= 0) {
+            const void* staged = weight_streamer_->acquire(
+                static_cast<size_t>(step.stream_layer));
+            if (!staged) {
+                return cmx_status::ERROR_EXECUTION_FAILED;
+            }
+            step.weight_tensor->data = const_cast<void*>(staged);
+        }
+
+        cmx_status status = run_plan_step(step);
+        if (status != cmx_status::SUCCESS) {
+            return status;
+        }
+        stats_.total_nodes_executed++;
+
+        // Any output this step finalized is announced before the rest
+        // of the plan runs, so its consumer starts right away
+        mark_output_steps_done(i, i + 1);
+
+        // Watchdog: a run past its deadline stops before the next node
+        if (budget_exceeded()) {
+            return cmx_status::ERROR_BUDGET_EXCEEDED;
+        }
+
+        // Confidence gate: a quiet early head truncates the rest of
+        // the plan for this run
+        if (early_exit_enabled_ && i == early_exit_step_ &&
+            early_exit_triggered()) {
+            last_run_exited_early_ = true;
+            stats_.early_exits++;
+            break;
+        }
+    }
+    return cmx_status::SUCCESS;
+}
+
+// The check reads a single float element of the configured tensor; if
+// the tensor is missing or too small the run just continues, since a
+// broken check must never cost a detection
+bool cmx_graph_executor::early_exit_triggered() const {
+    if (!graph_ || early_exit_tensor_ >= graph_->tensor_count) {
+        return false;
+    }
+    const cmx_tensor& tensor = graph_->tensors[early_exit_tensor_];
+    if (!tensor.data || early_exit_element_ >= tensor.size) {
+        return false;
+    }
+    const float confidence =
+        static_cast<const float*>(tensor.data)[early_exit_element_];
+    return confidence < early_exit_threshold_;
+}
+
+cmx_status cmx_graph_executor::set_early_exit(uint32_t after_step,
+                                              uint32_t tensor_id,
+                                              float threshold,
+                                              uint32_t element_index) {
+    if (!is_loaded_ || !graph_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+    if (after_step >= compiled_plan_.size() ||
+        tensor_id >= graph_->tensor_count) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+
+    early_exit_enabled_ = true;
+    early_exit_step_ = after_step;
+    early_exit_tensor_ = tensor_id;
+    early_exit_element_ = element_index;
+    early_exit_threshold_ = threshold;
+    last_run_exited_early_ = false;
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::clear_early_exit() {
+    early_exit_enabled_ = false;
+    last_run_exited_early_ = false;
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::set_stats_tap(uint32_t tensor_id,
+                                             float saturation_low,
+                                             float saturation_high) {
+    if (!is_loaded_ || !graph_ || compiled_plan_.empty()) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+    if (tensor_id >= graph_->tensor_count ||
+        saturation_low >= saturation_high) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+
+    // Re-arming an existing tap replaces its bounds and resets its
+    // statistics; otherwise a fresh slot is appended
+    int32_t tap_index = -1;
+    for (size_t i = 0; i < stats_taps_.size(); ++i) {
+        if (stats_taps_[i].tensor_id == tensor_id) {
+            tap_index = static_cast<int32_t>(i);
+            break;
+        }
+    }
+    const bool appended = tap_index < 0;
+    if (appended) {
+        tap_index = static_cast<int32_t>(stats_taps_.size());
+        stats_taps_.push_back(cmx_stats_tap{});
+    }
+
+    cmx_stats_tap& tap = stats_taps_[tap_index];
+    tap.tensor_id = tensor_id;
+    tap.saturation_low = saturation_low;
+    tap.saturation_high = saturation_high;
+    tap.stats = cmx_tensor_stats{3.402823466e+38f, -3.402823466e+38f, 0, 0};
+
+    // Compile the tap into the last plan step producing the tensor, so
+    // the sweep sees the final value exactly once per run (in-place
+    // aliasing can make several steps write the same tensor id)
+    bool bound = false;
+    for (uint32_t i = 0; i < compiled_plan_.size(); ++i) {
+        const cmx_graph_node& node = graph_->nodes[compiled_plan_[i].node_id];
+        for (uint32_t j = 0; j < node.output_count; ++j) {
+            if (node.output_tensor_ids && node.output_tensor_ids[j] == tensor_id) {
+                if (bound) {
+                    // Move the tap forward to the later producer
+                    for (cmx_plan_step& prior : compiled_plan_) {
+                        if (prior.stats_tap == tap_index) {
+                            prior.stats_tap = -1;
+                        }
+                    }
+                }
+                compiled_plan_[i].stats_tap = tap_index;
+                bound = true;
+                break;
+            }
+        }
+    }
+
+    if (!bound) {
+        if (appended) {
+            stats_taps_.pop_back();
+        }
+        return cmx_status::ERROR_INVALID_ARGS;  // Tensor has no producer
+    }
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::get_tensor_stats(uint32_t tensor_id,
+                                                cmx_tensor_stats& out) const {
+    for (const cmx_stats_tap& tap : stats_taps_) {
+        if (tap.tensor_id == tensor_id) {
+            out = tap.stats;
+            return cmx_status::SUCCESS;
+        }
+    }
+    return cmx_status::ERROR_INVALID_ARGS;
+}
+
+cmx_status cmx_graph_executor::clear_stats_taps() {
+    stats_taps_.clear();
+    for (cmx_plan_step& step : compiled_plan_) {
+        step.stats_tap = -1;
+    }
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::set_input_gate(uint32_t input_index,
+                                              float threshold,
+                                              uint32_t block_size) {
+    if (threshold < 0.0f || block_size == 0) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    if (graph_ && input_index >= graph_->input_count) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+
+    input_gate_enabled_ = true;
+    gate_input_index_ = input_index;
+    gate_threshold_ = threshold;
+    gate_block_size_ = block_size;
+    gate_prev_valid_ = false;
+    gate_prev_pending_ = false;
+    last_run_was_gated_ = false;
+    gate_dirty_blocks_ = 0;
+    gate_dirty_mask_.clear();
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::clear_input_gate() {
+    input_gate_enabled_ = false;
+    gate_prev_valid_ = false;
+    gate_prev_pending_ = false;
+    gate_dirty_blocks_ = 0;
+    gate_prev_frame_.clear();
+    gate_prev_frame_.shrink_to_fit();
+    gate_dirty_mask_.clear();
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::get_gate_dirty_mask(uint8_t* mask,
+                                                   uint32_t max_count) const {
+    if (!mask) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    const uint32_t count =
+        std::min(max_count, static_cast<uint32_t>(gate_dirty_mask_.size()));
+    for (uint32_t i = 0; i < count; ++i) {
+        mask[i] = gate_dirty_mask_[i];
+    }
+    return cmx_status::SUCCESS;
+}
+
+// Sweep the gated input against the previous-frame snapshot, block by
+// block. Returns true when every block's mean absolute byte difference
+// stays at or below the threshold, meaning the run can be skipped; any
+// other outcome (first frame, size change, dirty blocks) re-snapshots
+// the frame so the next comparison is against what this run processes.
+// The sweep is one pass of sequential loads - memory-bound, a small
+// fraction of even the cheapest plan it guards.
+bool cmx_graph_executor::input_gate_unchanged() {
+    cmx_tensor* input = get_input(gate_input_index_);
+    if (!input || !input->data || input->byte_size == 0) {
+        return false;
+    }
+
+    const uint8_t* data = static_cast<const uint8_t*>(input->data);
+    const size_t size = input->byte_size;
+    const uint32_t blocks = static_cast<uint32_t>(
+        (size + gate_block_size_ - 1) / gate_block_size_);
+
+    if (!gate_prev_valid_ || gate_prev_frame_.size() != size) {
+        // No usable snapshot: everything is dirty and the run proceeds
+        gate_dirty_mask_.assign(blocks, 1);
+        gate_dirty_blocks_ = blocks;
+        gate_prev_frame_.assign(data, data + size);
+        gate_prev_valid_ = false;
+        gate_prev_pending_ = true;
+        return false;
+    }
+
+    gate_dirty_mask_.assign(blocks, 0);
+    gate_dirty_blocks_ = 0;
+    const uint8_t* prev = gate_prev_frame_.data();
+
+    for (uint32_t b = 0; b < blocks; ++b) {
+        const size_t begin = static_cast<size_t>(b) * gate_block_size_;
+        const size_t len = std::min<size_t>(gate_block_size_, size - begin);
+
+        uint64_t sad = 0;
+        for (size_t i = 0; i < len; ++i) {
+            const int32_t diff = static_cast<int32_t>(data[begin + i]) -
+                                 static_cast<int32_t>(prev[begin + i]);
+            sad += static_cast<uint64_t>(diff < 0 ? -diff : diff);
+        }
+
+        if (static_cast<float>(sad) > gate_threshold_ * static_cast<float>(len)) {
+            gate_dirty_mask_[b] = 1;
+            gate_dirty_blocks_++;
+        }
+    }
+
+    if (gate_dirty_blocks_ == 0) {
+        return true;
+    }
+
+    // Changed frame: it becomes the next snapshot once this run succeeds
+    gate_prev_frame_.assign(data, data + size);
+    gate_prev_valid_ = false;
+    gate_prev_pending_ = true;
+    return false;
+}
+
+// One timer load and compare - cheap enough to run at every node
+// boundary on every path
+bool cmx_graph_executor::budget_exceeded() const {
+    return run_deadline_ != 0 &&
+           runtime::HighResTimer::now() >= run_deadline_;
+}
+
+cmx_status cmx_graph_executor::set_cycle_budget(uint64_t budget_cycles) {
+    cycle_budget_ = budget_cycles;
+    last_run_hit_budget_ = false;
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::clear_cycle_budget() {
+    cycle_budget_ = 0;
+    run_deadline_ = 0;
+    last_run_hit_budget_ = false;
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::set_deterministic_mode(bool enable,
+                                                      uint32_t window_size) {
+    if (!enable) {
+        deterministic_enabled_ = false;
+        det_window_.clear();
+        runtime::cmx_dma_set_polled_mode(false);
+        return cmx_status::SUCCESS;
+    }
+
+    // The pipeline worker thread races the calling thread by design;
+    // there is no deterministic variant of that
+    if (pipeline_enabled_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+    if (window_size == 0) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+
+    deterministic_enabled_ = true;
+    det_window_.assign(window_size, 0);
+    det_window_pos_ = 0;
+    det_window_count_ = 0;
+    stats_.det_window_runs = 0;
+    stats_.det_cycles_min = 0;
+    stats_.det_cycles_max = 0;
+    stats_.det_cycles_mean = 0;
+    stats_.det_cycles_stddev = 0;
+    runtime::cmx_dma_set_polled_mode(true);
+    return cmx_status::SUCCESS;
+}
+
+// Plan-driven touch pass: walk the compiled plan and read every
+// tensor and scratch range each step has bound, so the timed run that
+// follows finds all of it resident. Reading rather than writing keeps
+// the pass side-effect free; the first store to an output line still
+// costs an ownership upgrade, but that cost is identical every run,
+// which is what the mode guarantees.
+void cmx_graph_executor::prewarm_plan_caches() {
+    for (const cmx_plan_step& step : compiled_plan_) {
+        const cmx_op_context* ctx = step.context;
+        if (!ctx) {
+            continue;
+        }
+        for (uint32_t i = 0; i < ctx->input_count; ++i) {
+            if (ctx->inputs[i]) {
+                touch_range(ctx->inputs[i]->data, ctx->inputs[i]->byte_size);
+            }
+        }
+        for (uint32_t i = 0; i < ctx->output_count; ++i) {
+            if (ctx->outputs[i]) {
+                touch_range(ctx->outputs[i]->data, ctx->outputs[i]->byte_size);
+            }
+        }
+        touch_range(ctx->scratch.ptr, ctx->scratch.size);
+    }
+}
+
+// Recompute the det_* stats over the window after every completed
+// run. The window is at most a few hundred entries, so the O(n)
+// recompute is noise next to an inference; keeping it outside the
+// timed region means the evidence gathering cannot perturb the
+// quantity being evidenced.
+void cmx_graph_executor::record_deterministic_sample(uint64_t ticks) {
+    det_window_[det_window_pos_] = ticks;
+    det_window_pos_ = (det_window_pos_ + 1) %
+                      static_cast<uint32_t>(det_window_.size());
+    if (det_window_count_ < det_window_.size()) {
+        det_window_count_++;
+    }
+
+    uint64_t min_ticks = det_window_[0];
+    uint64_t max_ticks = 0;
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < det_window_count_; ++i) {
+        const uint64_t v = det_window_[i];
+        min_ticks = std::min(min_ticks, v);
+        max_ticks = std::max(max_ticks, v);
+        sum += v;
+    }
+    const uint64_t mean = sum / det_window_count_;
+
+    // Variance in double: squared tick deltas overflow 64 bits long
+    // before the counts themselves do
+    double variance = 0.0;
+    for (uint32_t i = 0; i < det_window_count_; ++i) {
+        const double d = static_cast<double>(det_window_[i]) -
+                         static_cast<double>(mean);
+        variance += d * d;
+    }
+    variance /= static_cast<double>(det_window_count_);
+
+    stats_.det_window_runs = det_window_count_;
+    stats_.det_cycles_min = min_ticks;
+    stats_.det_cycles_max = max_ticks;
+    stats_.det_cycles_mean = mean;
+    stats_.det_cycles_stddev = static_cast<uint64_t>(std::sqrt(variance));
+}
+
+// Build the plan-step mask for one named operating point: the backward
+// dependency closure from the profile's exit nodes, intersected with
+// the compiled plan. The closure walks input_nodes, so elided nodes
+// (fused followers, sectioned concats) pull in the steps that actually
+// carry their work.
+cmx_status cmx_graph_executor::define_execution_profile(
+    const char* name, const uint32_t* exit_node_ids, uint32_t exit_count) {
+    if (!name || !*name || !exit_node_ids || exit_count == 0) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    if (!is_loaded_ || !graph_ || compiled_plan_.empty()) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+
+    std::vector<uint8_t> needed(graph_->node_count, 0);
+    std::vector<uint32_t> worklist;
+    for (uint32_t i = 0; i < exit_count; ++i) {
+        const uint32_t id = exit_node_ids[i];
+        if (id >= graph_->node_count) {
+            return cmx_status::ERROR_INVALID_ARGS;
+        }
+        if (!needed[id]) {
+            needed[id] = 1;
+            worklist.push_back(id);
+        }
+    }
+    while (!worklist.empty()) {
+        const cmx_graph_node& node = graph_->nodes[worklist.back()];
+        worklist.pop_back();
+        for (uint32_t j = 0; j < node.input_count; ++j) {
+            const uint32_t dep = node.input_nodes[j];
+            if (dep < graph_->node_count && !needed[dep]) {
+                needed[dep] = 1;
+                worklist.push_back(dep);
+            }
+        }
+    }
+
+    std::vector<uint8_t> mask(compiled_plan_.size(), 0);
+    for (uint32_t s = 0; s < compiled_plan_.size(); ++s) {
+        const uint32_t node_id = compiled_plan_[s].node_id;
+        if (needed[node_id]) {
+            mask[s] = 1;
+            continue;
+        }
+        // A needed fused follower rides its producer's step
+        if (node_id < fused_follower_.size() &&
+            fused_follower_[node_id] >= 0 &&
+            needed[fused_follower_[node_id]]) {
+            mask[s] = 1;
+        }
+    }
+
+    // Redefining an existing profile replaces its mask
+    for (cmx_execution_profile& profile : profiles_) {
+        if (profile.name == name) {
+            profile.step_mask = std::move(mask);
+            return cmx_status::SUCCESS;
+        }
+    }
+    profiles_.push_back({name, std::move(mask)});
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::set_active_profile(const char* name) {
+    if (!name || !*name) {
+        active_profile_ = -1;
+        return cmx_status::SUCCESS;
+    }
+    // Streaming acquires weight layers strictly in plan order; a
+    // masked plan would desynchronize the staging rotation
+    if (weight_streamer_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+    for (size_t i = 0; i < profiles_.size(); ++i) {
+        if (profiles_[i].name == name) {
+            active_profile_ = static_cast<int32_t>(i);
+            return cmx_status::SUCCESS;
+        }
+    }
+    return cmx_status::ERROR_INVALID_ARGS;
+}
+
+const char* cmx_graph_executor::active_profile() const {
+    return active_profile_ >= 0 ? profiles_[active_profile_].name.c_str()
+                                : nullptr;
+}
+
+cmx_status cmx_graph_executor::set_output_ready_callback(
+    cmx_output_ready_callback callback, void* user_data) {
+    output_ready_callback_ = callback;
+    output_ready_user_data_ = user_data;
+    return cmx_status::SUCCESS;
+}
+
+bool cmx_graph_executor::is_output_ready(uint32_t output_index) const {
+    if (output_index >= 32) {
+        return false;
+    }
+    return (output_ready_mask_.load(std::memory_order_acquire) &
+            (1u << output_index)) != 0;
+}
+
+void cmx_graph_executor::reset_output_readiness() {
+    output_ready_mask_.store(0, std::memory_order_release);
+}
+
+// Publish every output whose finalizing step lies in [begin_step,
+// end_step). Called from whichever thread completed the steps; the
+// release store pairs with the acquire load in is_output_ready() so a
+// polling consumer observes the tensor contents the step wrote.
+void cmx_graph_executor::mark_output_steps_done(uint32_t begin_step,
+                                                uint32_t end_step) {
+    for (uint32_t i = 0;
+         i < output_final_step_.size() && i < 32; ++i) {
+        uint32_t final_step = output_final_step_[i];
+        if (final_step < begin_step || final_step >= end_step) {
+            continue;
+        }
+        uint32_t bit = 1u << i;
+        uint32_t previous =
+            output_ready_mask_.fetch_or(bit, std::memory_order_release);
+        if (!(previous & bit) && output_ready_callback_) {
+            output_ready_callback_(i, output_ready_user_data_);
+        }
+    }
+}
+
+// Completion backstop: outputs with no resolved plan step (fallback
+// dispatch, unmapped nodes) and outputs skipped by early exit become
+// ready when the run finishes
+void cmx_graph_executor::mark_all_outputs_ready() {
+    uint32_t count = graph_ ? graph_->output_count : 0;
+    for (uint32_t i = 0; i < count && i < 32; ++i) {
+        uint32_t bit = 1u << i;
+        uint32_t previous =
+            output_ready_mask_.fetch_or(bit, std::memory_order_release);
+        if (!(previous & bit) && output_ready_callback_) {
+            output_ready_callback_(i, output_ready_user_data_);
+        }
+    }
+}
+
+// Two-worker execution: each dependency level is fanned out over the
+// calling thread plus one worker, which the threading layer places on
+// the second core on ESP32 and Zephyr SMP builds. Levels with a single
+// node (the common backbone case) run inline with no thread traffic.
+cmx_status cmx_graph_executor::run_plan_parallel() {
+    // Each worker counts into its own cache line; the shared stats_
+    // block is touched only by the merge below, never on the hot path
+    for (uint32_t w = 0; w < CMX_EXEC_WORKER_COUNT; ++w) {
+        worker_counters_[w].nodes_executed = 0;
+    }
+    cmx_status result = cmx_status::SUCCESS;
+
+    for (size_t l = 0; l + 1 < level_offsets_.size(); ++l) {
+        const uint32_t begin = level_offsets_[l];
+        const uint32_t end = level_offsets_[l + 1];
+
+        if (end - begin == 1) {
+            cmx_status status = run_plan_step(compiled_plan_[begin]);
+            if (status != cmx_status::SUCCESS) {
+                result = status;
+                break;
+            }
+            worker_counters_[0].nodes_executed++;
+            mark_output_steps_done(begin, end);
+            if (budget_exceeded()) {
+                result = cmx_status::ERROR_BUDGET_EXCEEDED;
+                break;
+            }
+            continue;
+        }
+
+        std::atomic<uint32_t> next(begin);
+        std::atomic<bool> failed(false);
+        std::atomic<uint32_t> failure_status(
+            static_cast<uint32_t>(cmx_status::SUCCESS));
+
+        auto worker = [&](uint32_t w) {
+            cmx_worker_counters& counters = worker_counters_[w];
+            uint32_t idx;
+            while (!failed.load(std::memory_order_relaxed) &&
+                   (idx = next.fetch_add(1)) < end) {
+                // Watchdog check per claimed step: the abort rides the
+                // existing lock-free failure flags
+                if (budget_exceeded()) {
+                    failure_status.store(static_cast<uint32_t>(
+                        cmx_status::ERROR_BUDGET_EXCEEDED));
+                    failed.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                cmx_status status = run_plan_step(compiled_plan_[idx]);
+                if (status != cmx_status::SUCCESS) {
+                    failure_status.store(static_cast<uint32_t>(status));
+                    failed.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                counters.nodes_executed++;
+            }
+        };
+
+        std::thread second_core(worker, 1u);
+        worker(0u);
+        second_core.join();
+
+        if (failed.load()) {
+            result = static_cast<cmx_status>(failure_status.load());
+            break;
+        }
+
+        // Whole level joined: every output finalized inside it is safe
+        // to announce regardless of which worker ran the step
+        mark_output_steps_done(begin, end);
+    }
+
+    // Single merge per run. Counting per worker also makes a failed or
+    // aborted run report the steps that did complete, which the shared
+    // end-of-level add used to drop.
+    for (uint32_t w = 0; w < CMX_EXEC_WORKER_COUNT; ++w) {
+        stats_.total_nodes_executed += worker_counters_[w].nodes_executed;
+    }
+    return result;
+}
+
+// Plain slice of the compiled plan with no stats bookkeeping; both
+// pipeline stages run through here, one of them off-thread
+cmx_status cmx_graph_executor::run_plan_range(uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin; i < end; ++i) {
+        if (active_profile_ >= 0 &&
+            !profiles_[active_profile_].step_mask[i]) {
+            continue;
+        }
+        cmx_status status = run_plan_step(compiled_plan_[i]);
+        if (status != cmx_status::SUCCESS) {
+            return status;
+        }
+    }
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::set_frame_pipelining(bool enable) {
+    if (!enable) {
+        if (!pipeline_enabled_) {
+            return cmx_status::SUCCESS;
+        }
+        pipeline_flush();
+
+        // Restore the original context bindings and leave each graph
+        // tensor on its original buffer before the shadows are freed
+        for (const cmx_pipeline_patch& patch : pipeline_patches_) {
+            if (patch.is_input) {
+                patch.context->inputs[patch.slot] = patch.original;
+            } else {
+                patch.context->outputs[patch.slot] = patch.original;
+            }
+        }
+        for (cmx_pipeline_boundary& boundary : pipeline_boundaries_) {
+            if (boundary.tensor->data == boundary.storage.data()) {
+                std::swap(boundary.tensor->data, boundary.shadow.data);
+            }
+        }
+
+        // Fold the late stage back onto the shared workspace arena
+        if (!pipeline_workspace_.empty()) {
+            for (uint32_t i = pipeline_split_;
+                 i < static_cast<uint32_t>(compiled_plan_.size()); ++i) {
+                bind_context_scratch(compiled_plan_[i].context,
+                                     shared_workspace_,
+                                     shared_workspace_align_);
+            }
+            pipeline_workspace_.clear();
+        }
+
+        pipeline_patches_.clear();
+        pipeline_boundaries_.clear();
+        pipeline_enabled_ = false;
+        return cmx_status::SUCCESS;
+    }
+
+    if (!is_loaded_ || !graph_ || weight_streamer_ || deterministic_enabled_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+    if (pipeline_enabled_) {
+        return cmx_status::SUCCESS;
+    }
+
+    if (compiled_plan_.empty()) {
+        cmx_status status = compile_plan();
+        if (status != cmx_status::SUCCESS) {
+            return status;
+        }
+    }
+    // Need at least two dependency levels to split into stages
+    if (compiled_plan_.empty() || level_offsets_.size() < 3) {
+        return cmx_status::ERROR_UNSUPPORTED_OP;
+    }
+
+    // Split at the level boundary closest to half the plan so the two
+    // stages carry roughly equal work
+    const uint32_t total = static_cast<uint32_t>(compiled_plan_.size());
+    uint32_t split = level_offsets_[1];
+    for (size_t l = 1; l + 1 < level_offsets_.size(); ++l) {
+        const uint32_t candidate = level_offsets_[l];
+        const uint32_t cand_gap = candidate > total / 2
+            ? candidate - total / 2 : total / 2 - candidate;
+        const uint32_t best_gap = split > total / 2
+            ? split - total / 2 : total / 2 - split;
+        if (cand_gap < best_gap) {
+            split = candidate;
+        }
+    }
+    pipeline_split_ = split;
+
+    // Collect the tensors crossing the split: written by an early-stage
+    // step and referenced by a late-stage context. Each gets a second
+    // buffer so consecutive frames can occupy both stages at once.
+    pipeline_boundaries_.clear();
+    pipeline_patches_.clear();
+    auto written_early = [&](const cmx_tensor* tensor) {
+        for (uint32_t i = 0; i < pipeline_split_; ++i) {
+            const cmx_op_context* ctx = compiled_plan_[i].context;
+            for (uint32_t s = 0; s < ctx->output_count; ++s) {
+                if (ctx->outputs[s] == tensor) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    auto note_boundary = [&](cmx_tensor* tensor) -> bool {
+        for (const cmx_pipeline_boundary& boundary : pipeline_boundaries_) {
+            if (boundary.tensor == tensor) {
+                return true;
+            }
+        }
+        if (!tensor->data || tensor->byte_size == 0) {
+            return false;
+        }
+        pipeline_boundaries_.push_back({tensor, *tensor, {}});
+        return true;
+    };
+    for (uint32_t i = pipeline_split_; i < total; ++i) {
+        const cmx_op_context* ctx = compiled_plan_[i].context;
+        for (uint32_t s = 0; s < ctx->input_count; ++s) {
+            cmx_tensor* tensor = ctx->inputs[s];
+            if (tensor && written_early(tensor) && !note_boundary(tensor)) {
+                pipeline_boundaries_.clear();
+                return cmx_status::ERROR_TENSOR_MISMATCH;
+            }
+        }
+        // In-place aliased outputs cross the split too
+        for (uint32_t s = 0; s < ctx->output_count; ++s) {
+            cmx_tensor* tensor = ctx->outputs[s];
+            if (tensor && written_early(tensor) && !note_boundary(tensor)) {
+                pipeline_boundaries_.clear();
+                return cmx_status::ERROR_TENSOR_MISMATCH;
+            }
+        }
+    }
+
+    for (cmx_pipeline_boundary& boundary : pipeline_boundaries_) {
+        boundary.storage.resize(boundary.tensor->byte_size);
+        boundary.shadow.data = boundary.storage.data();
+    }
+
+    // Repoint every late-stage reference at the shadow copy; the list
+    // above is final, so the shadow addresses are stable
+    for (uint32_t i = pipeline_split_; i < total; ++i) {
+        cmx_op_context* ctx = compiled_plan_[i].context;
+        for (cmx_pipeline_boundary& boundary : pipeline_boundaries_) {
+            for (uint32_t s = 0; s < ctx->input_count; ++s) {
+                if (ctx->inputs[s] == boundary.tensor) {
+                    pipeline_patches_.push_back({ctx, s, true, boundary.tensor});
+                    ctx->inputs[s] = &boundary.shadow;
+                }
+            }
+            for (uint32_t s = 0; s < ctx->output_count; ++s) {
+                if (ctx->outputs[s] == boundary.tensor) {
+                    pipeline_patches_.push_back({ctx, s, false, boundary.tensor});
+                    ctx->outputs[s] = &boundary.shadow;
+                }
+            }
+        }
+    }
+
+    // The two stages run concurrently, so the late stage cannot share
+    // the early stage's workspace arena; give it its own of equal size
+    if (!shared_workspace_.empty()) {
+        pipeline_workspace_.resize(shared_workspace_.size());
+        for (uint32_t i = pipeline_split_; i < total; ++i) {
+            bind_context_scratch(compiled_plan_[i].context,
+                                 pipeline_workspace_,
+                                 shared_workspace_align_);
+        }
+    }
+
+    pipeline_in_flight_ = false;
+    pipeline_status_ = cmx_status::SUCCESS;
+    pipeline_enabled_ = true;
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::run_pipelined(cmx_tensor* inputs, uint32_t input_count,
+                                             cmx_tensor* outputs, uint32_t output_count) {
+    if (!pipeline_enabled_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+    if (!inputs || !outputs || input_count != graph_->input_count ||
+        output_count != graph_->output_count) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+
+    // Bind this frame's inputs; input nodes sit at level zero, so this
+    // cannot disturb the previous frame's in-flight late stage
+    for (uint32_t i = 0; i < input_count; ++i) {
+        cmx_status status = set_input(i, &inputs[i]);
+        if (status != cmx_status::SUCCESS) {
+            pipeline_flush();
+            return status;
+        }
+    }
+
+    // Early stage of this frame overlaps the late stage of the last one
+    cmx_status early_status = run_plan_range(0, pipeline_split_);
+
+    // Retire the previous frame before touching any shared state
+    cmx_status late_status = pipeline_flush();
+    if (late_status != cmx_status::SUCCESS) {
+        return late_status;
+    }
+    if (early_status != cmx_status::SUCCESS) {
+        stats_.failed_executions++;
+        return early_status;
+    }
+
+    // Output nodes belong to the late stage; bind them only once the
+    // previous frame has drained
+    for (uint32_t i = 0; i < output_count; ++i) {
+        cmx_status status = set_output(i, &outputs[i]);
+        if (status != cmx_status::SUCCESS) {
+            return status;
+        }
+    }
+
+    // Hand this frame's boundary values to the late stage and point
+    // the early stage at the other half of each ping-pong pair
+    for (cmx_pipeline_boundary& boundary : pipeline_boundaries_) {
+        std::swap(boundary.tensor->data, boundary.shadow.data);
+    }
+
+    pipeline_status_ = cmx_status::SUCCESS;
+    pipeline_in_flight_ = true;
+    pipeline_thread_ = std::thread([this]() {
+        pipeline_status_ = run_plan_range(
+            pipeline_split_, static_cast<uint32_t>(compiled_plan_.size()));
+    });
+
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::pipeline_flush() {
+    if (pipeline_thread_.joinable()) {
+        pipeline_thread_.join();
+    }
+    if (!pipeline_in_flight_) {
+        return cmx_status::SUCCESS;
+    }
+    pipeline_in_flight_ = false;
+
+    if (pipeline_status_ != cmx_status::SUCCESS) {
+        stats_.failed_executions++;
+        return pipeline_status_;
+    }
+    stats_.total_graphs_executed++;
+    stats_.total_nodes_executed += compiled_plan_.size();
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::execute_node(cmx_graph_node* node) {
+    if (!node || !node->context) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    
+    // Check if node is ready for execution
+    if (!is_node_ready(node)) {
+        return cmx_status::ERROR_EXECUTION_FAILED;
+    }
+
+    // Zero-fill outputs only for ops that may write them partially;
+    // full writers (all core ops) declare writes_all_outputs and skip
+    // the memset, which is pure memory-bandwidth waste for them
+    const cmx_op* op = cmx_get_op(node->op_name);
+    if (!op || !op->writes_all_outputs) {
+        for (uint32_t i = 0; i < node->context->output_count; ++i) {
+            cmx_tensor* tensor = node->context->outputs[i];
+            if (tensor && tensor->data && tensor->byte_size > 0) {
+                std::memset(tensor->data, 0, tensor->byte_size);
+            }
+        }
+    }
+
+    // Execute the operation, attributing cycles to the node's slot when
+    // profiling; the node id is its index in the graph's node array
+    cmx_status status;
+    const uint32_t node_id = static_cast<uint32_t>(node - graph_->nodes);
+    if (config_.enable_profiling && node_id < node_stats_.size()) {
+        const uint64_t start = runtime::HighResTimer::now();
+        status = executor_->execute_op(node->op_name, *node->context);
+        const uint64_t end = runtime::HighResTimer::now();
+        record_node_sample(node_id, end - start, *node->context);
+    } else {
+        status = executor_->execute_op(node->op_name, *node->context);
+    }
+
+    if (status == cmx_status::SUCCESS) {
+        mark_node_executed(node);
+    }
+
+    return status;
+}
+
+cmx_status cmx_graph_executor::validate_graph() {
+    if (!graph_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+    
+    // Basic validation - check that all nodes have valid operations
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        const cmx_graph_node* node = &graph_->nodes[i];
+        if (!cmx_is_op_registered(node->op_name)) {
+            return cmx_status::ERROR_UNSUPPORTED_OP;
+        }
+    }
+    
+    return cmx_status::SUCCESS;
+}
+
+// Optimization methods (simplified implementations)
+cmx_status cmx_graph_executor::optimize_execution_order() {
+    return topological_sort();
+}
+
+// Repack the per-node contexts (individually heap-allocated at graph
+// init, i.e. scattered in file order) into one contiguous pool laid
+// out in execution order. The plan walk then touches context metadata
+// sequentially instead of pointer-chasing across the heap; the misses
+// are small individually but add up over long plans on parts with
+// modest data caches.
+cmx_status cmx_graph_executor::pack_node_contexts() {
+    if (!graph_ || graph_->node_count == 0 || graph_->context_pool) {
+        // Nothing to pack, or a previous schedule already packed; the
+        // pool address must stay stable because callers may have bound
+        // tensors through node->context pointers since then
+        return cmx_status::SUCCESS;
+    }
+
+    // Inline parameter storage hands out pointers into the context
+    // itself; once any carve-out exists the contexts cannot relocate
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        const cmx_op_context* ctx = graph_->nodes[i].context;
+        if (ctx && ctx->inline_param_offset != 0) {
+            return cmx_status::SUCCESS;
+        }
+    }
+
+    cmx_op_context* pool = static_cast<cmx_op_context*>(
+        std::calloc(graph_->node_count, sizeof(cmx_op_context)));
+    if (!pool) {
+        return cmx_status::ERROR_OUT_OF_MEMORY;
+    }
+
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        cmx_graph_node* node = &graph_->nodes[graph_->execution_order[i]];
+        if (node->context) {
+            pool[i] = *node->context;
+            if (node->owns_context) {
+                // Scratch ownership moved with the copy; free only the
+                // old shell
+                node->context->owns_scratch = false;
+                cmx_destroy_op_context(node->context);
+            }
+        } else {
+            cmx_reset_op_context(&pool[i]);
+        }
+        node->context = &pool[i];
+        node->owns_context = false;
+    }
+
+    graph_->context_pool = pool;
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_graph_executor::optimize_memory_layout() {
+    if (config_.enable_memory_reuse) {
+        return apply_inplace_aliasing();
+    }
+    return cmx_status::SUCCESS;
+}
+
+// In-place aliasing pass: nodes whose operation declares in-place
+// capability and whose input dies at this node write over their input
+// buffer instead of materializing a separate output tensor. The retired
+// output tensor drops out of the memory accounting entirely.
+cmx_status cmx_graph_executor::apply_inplace_aliasing() {
+    if (!graph_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        cmx_graph_node* node = &graph_->nodes[i];
+        if (!is_inplace_candidate(node)) {
+            continue;
+        }
+
+        uint32_t in_id = node->input_tensor_ids[0];
+        uint32_t out_id = node->output_tensor_ids[0];
+
+        // Rewrite every consumer of the old output to read the aliased
+        // input tensor instead
+        for (uint32_t j = 0; j < graph_->node_count; ++j) {
+            cmx_graph_node* consumer = &graph_->nodes[j];
+            if (!consumer->input_tensor_ids) {
+                continue;
+            }
+            for (uint32_t k = 0; k < consumer->input_count; ++k) {
+                if (consumer->input_tensor_ids[k] == out_id) {
+                    consumer->input_tensor_ids[k] = in_id;
+                }
+            }
+        }
+
+        node->output_tensor_ids[0] = in_id;
+
+        // Retire the now-unreferenced output tensor so allocate_tensors()
+        // no longer counts it
+        graph_->tensors[out_id].data = nullptr;
+        graph_->tensors[out_id].byte_size = 0;
+        graph_->tensors[out_id].size = 0;
+    }
+
+    return allocate_tensors();
+}
+
+// Reshape elision pass: a layout-preserving reshape or flatten is a
+// pure metadata update - same bytes, new shape - yet executing it as a
+// node copies the whole tensor (the flatten between a conv stack and
+// its classifier head moves 32KB per frame for nothing). Instead, the
+// producer's output tensor adopts the reshaped metadata, consumers are
+// rewritten to read it directly, and the node never enters the
+// compiled plan.
+cmx_status cmx_graph_executor::elide_reshape_nodes() {
+    if (!graph_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+
+    // Walk in execution order so chains of reshapes collapse onto the
+    // original producer tensor one hop at a time
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        cmx_graph_node* node = &graph_->nodes[graph_->execution_order[i]];
+        if (node->is_elided || !is_elidable_reshape(node)) {
+            continue;
+        }
+
+        uint32_t in_id = node->input_tensor_ids[0];
+        uint32_t out_id = node->output_tensor_ids[0];
+        cmx_tensor& in = graph_->tensors[in_id];
+        const cmx_tensor& out = graph_->tensors[out_id];
+
+        // The producer tensor adopts the reshaped view; the bytes are
+        // untouched, so only the shape metadata moves
+        in.shape = out.shape;
+        in.ndim = out.ndim;
+        in.size = out.size;
+        std::memcpy(in.stride, out.stride, sizeof(in.stride));
+        in.is_contiguous = true;
+
+        // Rewrite every consumer of the reshape output to read the
+        // producer tensor, which now carries the view they expect
+        for (uint32_t j = 0; j < graph_->node_count; ++j) {
+            cmx_graph_node* consumer = &graph_->nodes[j];
+            if (!consumer->input_tensor_ids) {
+                continue;
+            }
+            for (uint32_t k = 0; k < consumer->input_count; ++k) {
+                if (consumer->input_tensor_ids[k] == out_id) {
+                    consumer->input_tensor_ids[k] = in_id;
+                }
+            }
+        }
+
+        node->output_tensor_ids[0] = in_id;
+        node->is_elided = true;
+
+        // Retire the now-unreferenced output tensor so allocate_tensors()
+        // no longer counts it
+        graph_->tensors[out_id].data = nullptr;
+        graph_->tensors[out_id].byte_size = 0;
+        graph_->tensors[out_id].size = 0;
+    }
+
+    return allocate_tensors();
+}
+
+bool cmx_graph_executor::is_inplace_candidate(const cmx_graph_node* node) const {
+    if (!node || !node->input_tensor_ids || !node->output_tensor_ids ||
+        node->input_count == 0 || node->output_count != 1) {
+        return false;
+    }
+
+    // Registered capability flag wins; fall back to the op types known
+    // to be element-wise for graphs built before op registration
+    const cmx_op* op = cmx_get_op(node->op_name);
+    if (op) {
+        if (!op->supports_inplace) {
+            return false;
+        }
+    } else {
+        switch (node->op_type) {
+            case cmx_op_type::RELU:
+            case cmx_op_type::ADD:
+            case cmx_op_type::SUB:
+            case cmx_op_type::MUL:
+            case cmx_op_type::DIV:
+                break;
+            default:
+                return false;
+        }
+    }
+
+    uint32_t in_id = node->input_tensor_ids[0];
+    uint32_t out_id = node->output_tensor_ids[0];
+    if (in_id >= graph_->tensor_count || out_id >= graph_->tensor_count ||
+        in_id == out_id) {
+        return false;
+    }
+
+    // Overwriting a graph input would clobber caller-owned data
+    if (!is_tensor_produced(in_id)) {
+        return false;
+    }
+
+    // The input must die here - a second consumer still needs the
+    // original values after this node runs
+    if (count_tensor_consumers(in_id) != 1) {
+        return false;
+    }
+
+    return graph_->tensors[in_id].byte_size == graph_->tensors[out_id].byte_size;
+}
+
+bool cmx_graph_executor::is_elidable_reshape(const cmx_graph_node* node) const {
+    if (!node || node->op_type != cmx_op_type::RESHAPE ||
+        !node->input_tensor_ids || !node->output_tensor_ids ||
+        node->input_count == 0 || node->output_count != 1) {
+        return false;
+    }
+
+    uint32_t in_id = node->input_tensor_ids[0];
+    uint32_t out_id = node->output_tensor_ids[0];
+    if (in_id >= graph_->tensor_count || out_id >= graph_->tensor_count ||
+        in_id == out_id) {
+        return false;
+    }
+
+    // Layout-preserving means the bytes are reinterpretable in place:
+    // same total size, contiguous input. A strided view would need a
+    // real copy and keeps its node.
+    const cmx_tensor& in = graph_->tensors[in_id];
+    const cmx_tensor& out = graph_->tensors[out_id];
+    if (in.byte_size != out.byte_size || !in.is_contiguous) {
+        return false;
+    }
+
+    // Rewriting a graph input's shape would alter a caller-visible
+    // descriptor; those reshapes keep their node
+    if (!is_tensor_produced(in_id)) {
+        return false;
+    }
+
+    // Another consumer of the producer tensor still expects the
+    // original shape after the metadata rewrite
+    if (count_tensor_consumers(in_id) != 1) {
+        return false;
+    }
+
+    // An elided node never reaches the plan, so a graph output fed by
+    // one would have no finalizing step
+    for (uint32_t i = 0; i < graph_->output_count; ++i) {
+        if (graph_->output_nodes[i] == node->node_id) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint32_t cmx_graph_executor::count_tensor_consumers(uint32_t tensor_id) const {
+    uint32_t consumers = 0;
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        const cmx_graph_node* node = &graph_->nodes[i];
+        if (!node->input_tensor_ids) {
+            continue;
+        }
+        for (uint32_t j = 0; j < node->input_count; ++j) {
+            if (node->input_tensor_ids[j] == tensor_id) {
+                consumers++;
+            }
+        }
+    }
+    return consumers;
+}
+
+bool cmx_graph_executor::is_tensor_produced(uint32_t tensor_id) const {
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        const cmx_graph_node* node = &graph_->nodes[i];
+        if (!node->output_tensor_ids) {
+            continue;
+        }
+        for (uint32_t j = 0; j < node->output_count; ++j) {
+            if (node->output_tensor_ids[j] == tensor_id) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Microfusion: the cheap-op adjacencies that each cost a full tensor
+// pass when executed as separate steps. Concat nodes are elided by
+// sectioning their destination buffer across the producers; follower
+// ops (bias+activation, pool+requantize) are folded into their
+// producer's plan step.
+cmx_status cmx_graph_executor::fuse_operations() {
+    if (!graph_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+
+    cmx_status status = elide_concat_nodes();
+    if (status != cmx_status::SUCCESS) {
+        return status;
+    }
+    return fuse_follower_ops();
+}
+
+// Fold single-consumer follower ops into their producer's plan step.
+// The pair runs under one step boundary (one timer sample, one budget
+// check) and the follower reads its input straight out of the cache
+// the producer just filled. Same-size element-wise followers (the
+// bias+activation case) additionally write over the producer's output
+// buffer, so the intermediate tensor is never materialized at all.
+cmx_status cmx_graph_executor::fuse_follower_ops() {
+    fused_follower_.assign(graph_->node_count, -1);
+
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        cmx_graph_node* node = &graph_->nodes[graph_->execution_order[i]];
+        if (node->is_elided) {
+            continue;
+        }
+        const int32_t follower_id = find_fusible_follower(node);
+        if (follower_id < 0) {
+            continue;
+        }
+        cmx_graph_node* follower = &graph_->nodes[follower_id];
+
+        const uint32_t in_id = follower->input_tensor_ids[0];
+        const uint32_t out_id = follower->output_tensor_ids[0];
+        if (in_id != out_id &&
+            graph_->tensors[in_id].byte_size ==
+                graph_->tensors[out_id].byte_size) {
+            // Element-wise follower: write in place over the producer's
+            // output and retire the follower's own tensor, exactly as
+            // the in-place aliasing pass would
+            for (uint32_t j = 0; j < graph_->node_count; ++j) {
+                cmx_graph_node* consumer = &graph_->nodes[j];
+                if (!consumer->input_tensor_ids) {
+                    continue;
+                }
+                for (uint32_t k = 0; k < consumer->input_count; ++k) {
+                    if (consumer->input_tensor_ids[k] == out_id) {
+                        consumer->input_tensor_ids[k] = in_id;
+                    }
+                }
+            }
+            follower->output_tensor_ids[0] = in_id;
+            graph_->tensors[out_id].data = nullptr;
+            graph_->tensors[out_id].byte_size = 0;
+            graph_->tensors[out_id].size = 0;
+        }
+
+        // The follower leaves the plan; its execute fn rides along on
+        // the producer's step instead
+        follower->is_elided = true;
+        fused_follower_[node->node_id] = follower_id;
+    }
+
+    return allocate_tensors();
+}
+
+// A follower is fusible when it is the sole consumer of the producer's
+// single output and matches one of the microfusion patterns: an
+// activation after any single-output producer (the detached bias-add
+// case), or a requantize after pooling.
+int32_t cmx_graph_executor::find_fusible_follower(
+    const cmx_graph_node* node) const {
+    if (!node->output_tensor_ids || node->output_count != 1) {
+        return -1;
+    }
+    const uint32_t out_id = node->output_tensor_ids[0];
+    if (out_id >= graph_->tensor_count ||
+        count_tensor_consumers(out_id) != 1) {
+        return -1;
+    }
+
+    // A graph output must keep its pre-follower values; writing the
+    // follower's result over it would change caller-visible data
+    for (uint32_t k = 0; k < graph_->output_count; ++k) {
+        if (graph_->output_nodes[k] == node->node_id) {
+            return -1;
+        }
+    }
+
+    for (uint32_t j = 0; j < graph_->node_count; ++j) {
+        const cmx_graph_node* follower = &graph_->nodes[j];
+        if (follower == node || follower->is_elided ||
+            !follower->input_tensor_ids || !follower->output_tensor_ids ||
+            follower->input_count == 0 || follower->output_count != 1 ||
+            follower->input_tensor_ids[0] != out_id) {
+            continue;
+        }
+
+        const bool activation = follower->op_type == cmx_op_type::RELU;
+        const bool requantize =
+            (node->op_type == cmx_op_type::MAXPOOL2D ||
+             node->op_type == cmx_op_type::AVGPOOL2D) &&
+            (follower->op_name == "Quantize" ||
+             follower->op_name == "Requantize");
+        if (!activation && !requantize) {
+            return -1;
+        }
+
+        // The follower must resolve to a direct call: the fused slot
+        // bypasses the per-node fallback dispatch entirely
+        const cmx_op* op = cmx_get_op(follower->op_name);
+        if (!op || !op->execute || !follower->context) {
+            return -1;
+        }
+
+        // A fused node never gets its own plan step, so a graph output
+        // fed by one would have no finalizing step
+        for (uint32_t k = 0; k < graph_->output_count; ++k) {
+            if (graph_->output_nodes[k] == follower->node_id) {
+                return -1;
+            }
+        }
+
+        return static_cast<int32_t>(j);
+    }
+    return -1;
+}
+
+// Concat elision: instead of every producer materializing its tensor
+// and the concat node copying them all into the destination, each
+// producer's output tensor is repointed at its section offset inside
+// the concat buffer and the concat node never runs. The dual-head
+// detector drops two 48KB copies per frame this way.
+cmx_status cmx_graph_executor::elide_concat_nodes() {
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        cmx_graph_node* node = &graph_->nodes[graph_->execution_order[i]];
+        if (node->is_elided || !is_elidable_concat(node)) {
+            continue;
+        }
+
+        const cmx_tensor& out =
+            graph_->tensors[node->output_tensor_ids[0]];
+        size_t offset = 0;
+        for (uint32_t j = 0; j < node->input_count; ++j) {
+            cmx_tensor& in = graph_->tensors[node->input_tensor_ids[j]];
+            in.data = static_cast<uint8_t*>(out.data) + offset;
+            offset += in.byte_size;
+        }
+        node->is_elided = true;
+    }
+    return cmx_status::SUCCESS;
+}
+
+bool cmx_graph_executor::is_elidable_concat(const cmx_graph_node* node) const {
+    if (!node || node->op_type != cmx_op_type::CONCAT ||
+        !node->input_tensor_ids || !node->output_tensor_ids ||
+        node->input_count < 2 || node->output_count != 1) {
+        return false;
+    }
+
+    const uint32_t out_id = node->output_tensor_ids[0];
+    if (out_id >= graph_->tensor_count) {
+        return false;
+    }
+    const cmx_tensor& out = graph_->tensors[out_id];
+    if (!out.data || !out.shape || !out.is_contiguous) {
+        return false;
+    }
+
+    // Every section must be produced inside the graph (a caller-owned
+    // input buffer cannot be repointed), die at the concat, and pack
+    // exactly into the destination
+    size_t total = 0;
+    for (uint32_t j = 0; j < node->input_count; ++j) {
+        const uint32_t in_id = node->input_tensor_ids[j];
+        if (in_id >= graph_->tensor_count || in_id == out_id) {
+            return false;
+        }
+        const cmx_tensor& in = graph_->tensors[in_id];
+        if (!in.is_contiguous || in.byte_size == 0 ||
+            !is_tensor_produced(in_id) ||
+            count_tensor_consumers(in_id) != 1) {
+            return false;
+        }
+        total += in.byte_size;
+    }
+    if (total != out.byte_size) {
+        return false;
+    }
+
+    // Sections are contiguous blocks of the destination only when the
+    // concat axis is the outermost non-unit dimension; an inner-axis
+    // concat interleaves its inputs and needs the real copy
+    const cmx_tensor& first = graph_->tensors[node->input_tensor_ids[0]];
+    if (!first.shape || first.ndim != out.ndim) {
+        return false;
+    }
+    uint32_t axis = out.ndim;
+    for (uint32_t d = 0; d < out.ndim; ++d) {
+        if (first.shape[d] != out.shape[d]) {
+            axis = d;
+            break;
+        }
+    }
+    if (axis == out.ndim) {
+        return false;
+    }
+    for (uint32_t d = 0; d < axis; ++d) {
+        if (out.shape[d] != 1) {
+            return false;
+        }
+    }
+
+    // An elided node never reaches the plan, so a graph output fed by
+    // one would have no finalizing step
+    for (uint32_t k = 0; k < graph_->output_count; ++k) {
+        if (graph_->output_nodes[k] == node->node_id) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Scheduling methods
+cmx_status cmx_graph_executor::topological_sort() {
+    if (!graph_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+    
+    // Simple topological sort implementation
+    // In practice, this would be more sophisticated
+    for (uint32_t i = 0; i < graph_->node_count; ++i) {
+        graph_->execution_order[i] = i;
+        graph_->nodes[i].execution_order = i;
+    }
+    
+    is_optimized_ = true;
+    return cmx_status::SUCCESS;
+}
+
+bool cmx_graph_executor::is_node_ready(const cmx_graph_node* node) {
+    // Check if all input nodes have been executed
+    for (uint32_t i = 0; i < node->input_count; ++i) {
+        uint32_t input_node_id = node->input_nodes[i];
+        if (!graph_->nodes[input_node_id].is_executed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void cmx_graph_executor::mark_node_executed(cmx_graph_node* node) {
+    node->is_executed = true;
+}
+
+// Memory management helpers
+cmx_status cmx_graph_executor::allocate_tensors() {
+    if (!graph_) {
+        return cmx_status::ERROR_INVALID_CONTEXT;
+    }
+    
+    // Calculate total memory needed
+    size_t total_memory = 0;
+    for (uint32_t i = 0; i < graph_->tensor_count; ++i) {
+        total_memory += graph_->tensors[i].byte_size;
+    }
+    
+    if (config_.memory_limit > 0 && total_memory > config_.memory_limit) {
+        return cmx_status::ERROR_OUT_OF_MEMORY;
+    }
+    
+    current_memory_usage_ = total_memory;
+    return cmx_status::SUCCESS;
+}
+
+void cmx_graph_executor::free_tensors() {
+    // Placeholder for tensor deallocation
+}
+
+void cmx_graph_executor::update_memory_usage() {
+    // Placeholder for dynamic memory usage tracking
+}
+
+// C-style API functions
+cmx_graph_executor* cmx_create_graph_executor() {
+    return new cmx_graph_executor();
+}
 
 cmx_graph_executor* cmx_create_graph_executor_with_config(const cmx_graph_config& config) {
     return new cmx_graph_executor(config);
@@ -551,6 +2648,16 @@ void cmx_destroy_graph(cmx_graph* graph) {
         std::free(graph->nodes);
     }
     
+    if (graph->context_pool) {
+        // Pool slots are not individually destroyed above (owns_context
+        // is false for them), so release their scratch here
+        for (uint32_t i = 0; i < graph->node_count; ++i) {
+            if (graph->context_pool[i].owns_scratch) {
+                cmx_free_scratch(&graph->context_pool[i]);
+            }
+        }
+        std::free(graph->context_pool);
+    }
     if (graph->tensors) std::free(graph->tensors);
     if (graph->execution_order) std::free(graph->execution_order);
     if (graph->input_nodes) std::free(graph->input_nodes);
@@ -4,9 +4,12 @@
 #include "cmx_ops.hpp"
 #include "cmx_op_context.hpp"
 #include "cmx_op_executor.hpp"
+#include "../runtime/cmx_weight_streamer.hpp"
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <atomic>
+#include <thread>
 
 namespace cmx {
 
@@ -14,7 +17,16 @@ namespace cmx {
 struct cmx_model;
 struct cmx_graph_node;
 
+// Log2 latency buckets: bucket i counts runs whose end-to-end latency
+// fell in [2^i, 2^(i+1)) microseconds; the last bucket absorbs the tail.
+// 24 buckets reach ~8.4 s, far beyond any sane inference.
+constexpr uint32_t CMX_LATENCY_BUCKET_COUNT = 24;
+
 // Graph execution statistics
+//
+// Maintained on every run, not only in profiling builds: the counters
+// and the latency histogram cost a clock read and a few increments per
+// inference, cheap enough to stay compiled in for fleet monitoring.
 struct cmx_graph_stats {
     uint64_t total_graphs_executed;
     uint64_t total_nodes_executed;
@@ -22,8 +34,45 @@ struct cmx_graph_stats {
     uint64_t avg_graph_execution_time;
     uint32_t memory_peak_usage;
     uint32_t failed_executions;
+    uint64_t latency_buckets[CMX_LATENCY_BUCKET_COUNT];
+    uint64_t early_exits;      // Runs truncated by the early-exit check
+    uint64_t budget_aborts;    // Runs aborted by the cycle-budget watchdog
+    uint64_t gated_runs;       // Runs skipped by the input-delta gate
+
+    // Deterministic-mode evidence, valid while the mode is enabled:
+    // per-run cycle counts (HighResTimer ticks) aggregated over the
+    // configured window of most recent completed runs
+    uint64_t det_window_runs;
+    uint64_t det_cycles_min;
+    uint64_t det_cycles_max;
+    uint64_t det_cycles_mean;
+    uint64_t det_cycles_stddev;
+};
+
+// Per-node profiling slot, indexed by node id. One slot per graph node,
+// preallocated at load time, so recording a sample on the hot path is a
+// handful of array stores with no allocation or locking.
+struct cmx_node_stats {
+    uint64_t total_cycles;     // Summed over all executions
+    uint64_t max_cycles;       // Worst single execution
+    uint64_t call_count;
+    size_t peak_working_set;   // High-water mark of bound tensor bytes
+};
+
+// Running statistics for one tapped tensor, accumulated across runs
+// until the tap is re-armed or cleared
+struct cmx_tensor_stats {
+    float min_value;
+    float max_value;
+    uint64_t saturation_count;  // Elements at or beyond the tap's bounds
+    uint64_t sample_count;      // Elements scanned since the tap was set
 };
 
+// Per-output completion callback: fired the moment the given graph
+// output index holds its final value for the current run
+using cmx_output_ready_callback = void (*)(uint32_t output_index,
+                                           void* user_data);
+
 // Graph execution configuration
 struct cmx_graph_config {
     bool enable_profiling;
@@ -58,6 +107,7 @@ struct cmx_graph_node {
     uint32_t execution_order;
     bool is_ready;
     bool is_executed;
+    bool is_elided;   // Folded into a metadata rewrite; never executes
     
     // Memory management
     bool owns_context;
@@ -84,6 +134,11 @@ struct cmx_graph {
     // Memory management
     bool owns_tensors;
     bool owns_nodes;
+
+    // Node contexts packed contiguously in execution order (null until
+    // the executor packs them). Owned by the graph and freed with it;
+    // nodes then reference pool slots instead of individual heap blocks
+    cmx_op_context* context_pool;
 };
 
 // Graph executor class
@@ -127,17 +182,363 @@ public:
     const cmx_graph_stats& get_stats() const;
     void reset_stats();
     cmx_status get_node_profile(uint32_t node_id, uint64_t& execution_time);
-    
+
+    // Per-node attribution
+    //
+    // With profiling enabled, every executed node records its cycle
+    // count (taken from the HighResTimer clock, a hardware cycle
+    // counter where the platform registers one) and the byte total of
+    // the tensors bound to its context at call time into the slot for
+    // its node id. The working set is measured at execution rather than
+    // load so in-place aliasing and batch rebinding are reflected.
+    // dump_node_stats() copies up to max_count slots into the caller's
+    // array and returns how many were written, so a regressed
+    // deployment can be diffed node by node against a known-good run.
+    cmx_status get_node_stats(uint32_t node_id, cmx_node_stats& out) const;
+    uint32_t dump_node_stats(cmx_node_stats* out, uint32_t max_count) const;
+
+
     // Memory management
     size_t get_memory_usage() const;
     cmx_status optimize_memory();
-    
+
+    // Size of the shared workspace arena bound into the compiled plan's
+    // contexts, zero when no node requested scratch memory
+    size_t get_shared_workspace_size() const { return shared_workspace_.size(); }
+
+    // Weight streaming
+    //
+    // Binds a configured CMXWeightStreamer so each node's weight tensor
+    // is DMA-prefetched into RAM while the previous node computes,
+    // hiding flash/PSRAM read stalls behind compute. The given input
+    // index selects which context input holds the weights (1 by
+    // convention). Each streamer instance may be bound to one executor
+    // load only, since layers are registered in plan order. Streaming
+    // runs the plan serially; it takes precedence over parallel
+    // execution because weights must be acquired in order.
+    cmx_status set_weight_streamer(runtime::CMXWeightStreamer* streamer,
+                                   uint32_t weight_input_index = 1);
+
+    // Frame pipelining
+    //
+    // Two-stage pipelined execution for streaming workloads (e.g.
+    // per-frame audio): the compiled plan is split at a dependency
+    // level boundary, and each run_pipelined() call executes the early
+    // stage of the new frame on the calling thread while the late
+    // stage of the previous frame finishes on a worker thread, roughly
+    // doubling sustained frame throughput on dual-core parts. Tensors
+    // crossing the split are double-buffered so consecutive frames
+    // cannot trample each other. Outputs bound for frame N are valid
+    // once run_pipelined() for frame N+1 returns, or after
+    // pipeline_flush(). While enabled the whole-plan run()/run_batch()
+    // paths are unavailable; incompatible with weight streaming.
+    cmx_status set_frame_pipelining(bool enable);
+    cmx_status run_pipelined(cmx_tensor* inputs, uint32_t input_count,
+                             cmx_tensor* outputs, uint32_t output_count);
+    cmx_status pipeline_flush();
+
+    // Early-exit execution
+    //
+    // Arms a confidence check evaluated after the compiled plan step at
+    // after_step completes: one float32 element of the given graph
+    // tensor (typically a cheap early classifier head) is compared
+    // against threshold, and when it falls below, the remainder of the
+    // plan is skipped for that run. run() still returns SUCCESS; the
+    // truncated run is visible through last_run_exited_early() and the
+    // early_exits stats counter, and downstream output tensors simply
+    // keep their previous contents. Worst-case latency is unchanged -
+    // a confident frame runs the full plan as before. While armed,
+    // execution is pinned to the serial path, since a parallel level
+    // straddling the check point could start work that should have
+    // been skipped.
+    cmx_status set_early_exit(uint32_t after_step, uint32_t tensor_id,
+                              float threshold, uint32_t element_index = 0);
+    cmx_status clear_early_exit();
+    bool last_run_exited_early() const { return last_run_exited_early_; }
+
+    // Cycle-budget watchdog
+    //
+    // Bounds worst-case inference time for deadline-driven deployments:
+    // a budget in HighResTimer ticks (the hardware cycle counter where
+    // the platform registers one) is armed per run() and compared
+    // against the timer at every node boundary - one 64-bit load and
+    // compare, nothing more. A run that exceeds its budget stops before
+    // the next node, returns ERROR_BUDGET_EXCEEDED, and counts in the
+    // budget_aborts stats entry; the abort path allocates nothing and
+    // takes no locks, so it is safe inside a control loop's deadline
+    // handler. Outputs of an aborted run are not marked ready and must
+    // be treated as stale. A budget of 0 disables the check.
+    cmx_status set_cycle_budget(uint64_t budget_cycles);
+    cmx_status clear_cycle_budget();
+    bool last_run_hit_budget() const { return last_run_hit_budget_; }
+
+    // Deterministic execution mode
+    //
+    // Functional-safety audits must demonstrate bounded jitter, not
+    // merely observe it. While enabled, every run() takes the same
+    // path with the same memory behavior: the compiled plan executes
+    // serially in fixed order (the parallel runner and its work
+    // distribution are off the table), a plan-driven touch pass reads
+    // every bound tensor and scratch range before the timed region so
+    // no run pays first-touch cache misses, and DMA is pinned to
+    // polled mode so transfer completion never rides an interrupt.
+    // That is the enforcement half; for the evidence half each run's
+    // cycle count (HighResTimer ticks, a hardware cycle counter where
+    // the platform registers one) enters a circular window of
+    // window_size runs, and min/max/mean/stddev over the window are
+    // published through the det_* fields of cmx_graph_stats after
+    // every run. Incompatible with frame pipelining, whose worker
+    // thread is inherently timing-dependent; disabling the mode
+    // releases the DMA pin and invalidates the det_* fields.
+    cmx_status set_deterministic_mode(bool enable,
+                                      uint32_t window_size = 128);
+    bool deterministic_mode() const { return deterministic_enabled_; }
+
+    // Execution profiles (multi-exit operating points)
+    //
+    // One model, several operating points over shared weights: a
+    // low-power scan head and a high-accuracy verify head can share
+    // their backbone instead of shipping as two models with the
+    // backbone weights duplicated. define_execution_profile() names a
+    // subgraph by its exit nodes; the executor computes the backward
+    // dependency closure and masks the compiled plan down to the steps
+    // feeding those exits. set_active_profile() switches operating
+    // points per invocation with no reload or recompile - inactive
+    // suffix steps are simply skipped, and the shared backbone prefix
+    // runs identically under every profile. nullptr or an empty name
+    // selects the full plan. Profiles are bound to the compiled plan,
+    // so a reload clears them. Incompatible with weight streaming,
+    // which acquires layers strictly in plan order.
+    cmx_status define_execution_profile(const char* name,
+                                        const uint32_t* exit_node_ids,
+                                        uint32_t exit_count);
+    cmx_status set_active_profile(const char* name);
+    const char* active_profile() const;
+
+    // Streaming partial outputs
+    //
+    // Multi-head models finish their outputs at different plan steps:
+    // a detector's first head may be final milliseconds before the
+    // second. These hooks report each graph output the moment its last
+    // producing step completes, so downstream post-processing (NMS,
+    // decoding) starts immediately instead of waiting for run() to
+    // return. The callback fires on the executing thread - keep it
+    // short and do not call back into the executor from it; polling
+    // through is_output_ready() from another thread is the lock-free
+    // alternative. Readiness resets at the start of every run() and all
+    // outputs are marked once a run completes, including early-exited
+    // runs (the skipped outputs keep their previous, still-valid
+    // contents). Only the first 32 outputs are tracked.
+    cmx_status set_output_ready_callback(cmx_output_ready_callback callback,
+                                         void* user_data);
+    bool is_output_ready(uint32_t output_index) const;
+
+    // Tensor statistics taps
+    //
+    // Watchpoint-style visibility into intermediate tensors without
+    // dumping them: arming a tap on a float32 graph tensor compiles a
+    // statistics pass into the plan step that finalizes it, updating a
+    // running min/max plus a count of elements at or beyond the given
+    // saturation bounds (set them to the tensor's quantization clamp
+    // range to measure saturation rate). The pass is one read-only
+    // sweep of the tensor in the producing step's epilogue - no I/O,
+    // no allocation, no locks - so the latency profile being debugged
+    // stays representative; untapped tensors cost nothing. Statistics
+    // accumulate across runs until the tap is re-armed or cleared and
+    // are read out with get_tensor_stats(). Taps are cleared by a
+    // reload. Re-arming an existing tap resets its statistics.
+    cmx_status set_stats_tap(uint32_t tensor_id, float saturation_low,
+                             float saturation_high);
+    cmx_status get_tensor_stats(uint32_t tensor_id,
+                                cmx_tensor_stats& out) const;
+    cmx_status clear_stats_taps();
+
+    // Input-delta gate
+    //
+    // Static-scene camera deployments pay full inference cost for
+    // frames identical to the last one. While armed, every run()
+    // first sweeps the bound input tensor against a snapshot of the
+    // previous successfully processed frame, block by block: the sum
+    // of absolute byte differences per block, compared against
+    // threshold as a mean difference per byte (the sweep is raw-byte
+    // SAD, sized for uint8/int8 camera frames). When no block exceeds
+    // the threshold the plan is skipped entirely and run() returns
+    // SUCCESS_CACHED - the bound outputs still hold the previous
+    // frame's results, and the run counts in the gated_runs stats
+    // entry instead of executing a single node. A changed frame runs
+    // normally and becomes the new snapshot once the run succeeds, so
+    // a failed or budget-aborted run can never gate the frame after
+    // it. The per-block dirty mask of the last comparison is readable
+    // through get_gate_dirty_mask() for tiled detectors that dispatch
+    // per region. Gating applies to the whole-plan run() paths only;
+    // pipelined execution is frame-overlapped and never gates.
+    cmx_status set_input_gate(uint32_t input_index, float threshold,
+                              uint32_t block_size = 1024);
+    cmx_status clear_input_gate();
+    bool last_run_was_gated() const { return last_run_was_gated_; }
+    uint32_t gate_block_count() const {
+        return static_cast<uint32_t>(gate_dirty_mask_.size());
+    }
+    uint32_t gate_dirty_blocks() const { return gate_dirty_blocks_; }
+    cmx_status get_gate_dirty_mask(uint8_t* mask, uint32_t max_count) const;
+
 private:
+    // One step of the compiled execution plan: the op's execute
+    // function resolved once at load time plus its bound context
+    struct cmx_plan_step {
+        cmx_status (*execute)(cmx_op_context& ctx);
+        cmx_op_context* context;
+        bool zero_fill_outputs;  // Op may write outputs partially
+        int32_t stream_layer;    // Streamer layer index, -1 if not streamed
+        cmx_tensor* weight_tensor;  // Tensor repointed at the staging buffer
+        uint32_t node_id;        // Index into node_stats_
+        int32_t stats_tap;       // Tap updated after this step, -1 if none
+
+        // Microfused follower (bias+activation, pool+requantize): a
+        // cheap single-consumer op folded into its producer's step,
+        // executed directly after execute while the producer's output
+        // is still cache-hot. nullptr when nothing is fused.
+        cmx_status (*fused_execute)(cmx_op_context& ctx);
+        cmx_op_context* fused_context;
+    };
+
     cmx_graph_config config_;
     cmx_graph_stats stats_;
     cmx_graph* graph_;
     cmx_op_executor* executor_;
-    
+    std::vector<cmx_plan_step> compiled_plan_;
+
+    // One slot per node, sized at load time. Safe to update from the
+    // parallel runner without synchronization: a node executes at most
+    // once per level, so no two workers ever touch the same slot.
+    std::vector<cmx_node_stats> node_stats_;
+
+    // Dependency-level boundaries into compiled_plan_ for the parallel
+    // path: steps within [level_offsets_[i], level_offsets_[i+1]) have
+    // no dependencies on each other and may run concurrently
+    std::vector<uint32_t> level_offsets_;
+
+    // Per-worker counter block for the parallel runner. One cache line
+    // per worker, so every stats update on the hot path is a plain
+    // store to a line the worker owns; the blocks are merged into
+    // stats_ once per run. Sized for the two-worker execution model.
+    struct alignas(64) cmx_worker_counters {
+        uint64_t nodes_executed;
+    };
+    static constexpr uint32_t CMX_EXEC_WORKER_COUNT = 2;
+    cmx_worker_counters worker_counters_[CMX_EXEC_WORKER_COUNT] = {};
+
+    // Microfusion pairs found by fuse_operations(): for each node id,
+    // the node id of the follower folded into its plan step, -1 if none
+    std::vector<int32_t> fused_follower_;
+
+    // One named operating point: the plan-step mask of the subgraph
+    // feeding its exit nodes (1 = step runs under this profile)
+    struct cmx_execution_profile {
+        std::string name;
+        std::vector<uint8_t> step_mask;
+    };
+    std::vector<cmx_execution_profile> profiles_;
+    int32_t active_profile_;  // Index into profiles_, -1 = full plan
+
+    // Weight streaming state
+    runtime::CMXWeightStreamer* weight_streamer_;
+    uint32_t stream_weight_input_;
+
+    // One tensor crossing the pipeline split: the early stage writes
+    // the graph tensor while the late stage reads the shadow, and the
+    // two data pointers ping-pong between frames
+    struct cmx_pipeline_boundary {
+        cmx_tensor* tensor;
+        cmx_tensor shadow;
+        std::vector<uint8_t> storage;
+    };
+
+    // Context slot repointed at a shadow tensor, kept so disabling
+    // pipelining can restore the original binding
+    struct cmx_pipeline_patch {
+        cmx_op_context* context;
+        uint32_t slot;
+        bool is_input;
+        cmx_tensor* original;
+    };
+
+    // Early-exit state
+    bool early_exit_enabled_;
+    uint32_t early_exit_step_;     // Plan step after which to evaluate
+    uint32_t early_exit_tensor_;   // Graph tensor holding the confidence
+    uint32_t early_exit_element_;  // Element compared against the threshold
+    float early_exit_threshold_;
+    bool last_run_exited_early_;
+
+    // Cycle-budget watchdog state: run_deadline_ is the absolute timer
+    // tick the current run must not cross, derived once at run() start
+    uint64_t cycle_budget_;
+    uint64_t run_deadline_;
+    bool last_run_hit_budget_;
+
+    // Deterministic-mode state: the circular window of per-run tick
+    // counts the det_* stats entries are recomputed from
+    bool deterministic_enabled_;
+    std::vector<uint64_t> det_window_;
+    uint32_t det_window_pos_;
+    uint32_t det_window_count_;
+
+    // One armed statistics tap: the tensor watched, the saturation
+    // bounds it is judged against, and the running statistics
+    struct cmx_stats_tap {
+        uint32_t tensor_id;
+        float saturation_low;
+        float saturation_high;
+        cmx_tensor_stats stats;
+    };
+    std::vector<cmx_stats_tap> stats_taps_;
+
+    // Input-delta gate state: the previous-frame snapshot the next
+    // frame is compared against, and the per-block dirty mask of the
+    // last comparison. The snapshot becomes valid only when the run
+    // that captured it completes successfully.
+    bool input_gate_enabled_;
+    uint32_t gate_input_index_;
+    float gate_threshold_;        // Mean abs byte difference per block
+    uint32_t gate_block_size_;    // Comparison granularity in bytes
+    uint32_t gate_dirty_blocks_;  // Dirty blocks in the last comparison
+    bool gate_prev_valid_;        // Snapshot backs a completed run
+    bool gate_prev_pending_;      // Snapshot taken, run not finished yet
+    bool last_run_was_gated_;
+    std::vector<uint8_t> gate_prev_frame_;
+    std::vector<uint8_t> gate_dirty_mask_;  // One byte per block, 1 = dirty
+
+    // Streaming partial-output state: bit i of the mask is set once
+    // output i is final for the current run. output_final_step_ maps
+    // each output index to the compiled plan step that finalizes it,
+    // derived once per compile_plan().
+    cmx_output_ready_callback output_ready_callback_;
+    void* output_ready_user_data_;
+    std::atomic<uint32_t> output_ready_mask_;
+    std::vector<uint32_t> output_final_step_;
+
+    // Shared workspace arena
+    //
+    // Scratch memory is live only while its node executes, and the
+    // compiled plan runs one node at a time, so every context shares a
+    // single arena sized max-over-nodes instead of keeping per-node
+    // private allocations alive for the whole graph. Pipelining runs
+    // two stages concurrently, so the late stage gets its own arena of
+    // the same size while enabled.
+    std::vector<uint8_t> shared_workspace_;
+    std::vector<uint8_t> pipeline_workspace_;
+    size_t shared_workspace_align_;
+
+    // Frame pipelining state
+    bool pipeline_enabled_;
+    uint32_t pipeline_split_;  // First plan step of the late stage
+    bool pipeline_in_flight_;
+    cmx_status pipeline_status_;
+    std::thread pipeline_thread_;
+    std::vector<cmx_pipeline_boundary> pipeline_boundaries_;
+    std::vector<cmx_pipeline_patch> pipeline_patches_;
+
     // Execution state
     bool is_loaded_;
     bool is_optimized_;
@@ -149,13 +550,46 @@ private:
     // Internal methods
     cmx_status initialize_graph();
     cmx_status schedule_execution();
+    cmx_status compile_plan();
+    cmx_status run_plan_serial();
+    cmx_status run_plan_parallel();
+    cmx_status run_plan_step(const cmx_plan_step& step);
+    cmx_status run_plan_range(uint32_t begin, uint32_t end);
+    bool early_exit_triggered() const;
+    bool budget_exceeded() const;
+    bool input_gate_unchanged();
+    void prewarm_plan_caches();
+    void record_deterministic_sample(uint64_t ticks);
+    void compute_output_final_steps();
+    void reset_output_readiness();
+    void mark_output_steps_done(uint32_t begin_step, uint32_t end_step);
+    void mark_all_outputs_ready();
+    cmx_status run_batch_node_major(cmx_tensor** input_batches,
+                                    uint32_t* input_counts,
+                                    cmx_tensor** output_batches,
+                                    uint32_t* output_counts,
+                                    uint32_t batch_size);
     cmx_status execute_node(cmx_graph_node* node);
     cmx_status validate_graph();
+    void record_node_sample(uint32_t node_id, uint64_t cycles,
+                            const cmx_op_context& context);
+    void update_stats_tap(int32_t tap_index);
     
     // Optimization methods
     cmx_status optimize_execution_order();
+    cmx_status pack_node_contexts();
     cmx_status optimize_memory_layout();
     cmx_status fuse_operations();
+    cmx_status fuse_follower_ops();
+    cmx_status elide_concat_nodes();
+    cmx_status apply_inplace_aliasing();
+    cmx_status elide_reshape_nodes();
+    int32_t find_fusible_follower(const cmx_graph_node* node) const;
+    bool is_elidable_concat(const cmx_graph_node* node) const;
+    bool is_inplace_candidate(const cmx_graph_node* node) const;
+    bool is_elidable_reshape(const cmx_graph_node* node) const;
+    uint32_t count_tensor_consumers(uint32_t tensor_id) const;
+    bool is_tensor_produced(uint32_t tensor_id) const;
     
     // Scheduling methods
     cmx_status topological_sort();
@@ -166,6 +600,9 @@ private:
     cmx_status allocate_tensors();
     void free_tensors();
     void update_memory_usage();
+    void bind_shared_workspace();
+    void bind_context_scratch(cmx_op_context* ctx, std::vector<uint8_t>& arena,
+                              size_t alignment);
 };
 
 // C-style API functions
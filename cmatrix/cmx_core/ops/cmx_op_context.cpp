@@ -64,6 +64,9 @@ void cmx_reset_op_context(cmx_op_context* ctx) {
     ctx->owns_inputs = false;
     ctx->owns_outputs = false;
     ctx->owns_scratch = false;
+
+    // Reset inline parameter storage
+    ctx->inline_param_offset = 0;
 }
 
 // Input/Output management
@@ -178,6 +181,50 @@ void* cmx_get_scratch_ptr(cmx_op_context* ctx) {
     return ctx->scratch.ptr;
 }
 
+// Inline parameter storage
+void* cmx_alloc_inline_param(cmx_op_context* ctx, size_t size, size_t alignment) {
+    if (!ctx || size == 0 || alignment == 0 ||
+        (alignment & (alignment - 1)) != 0) {
+        return nullptr;
+    }
+
+    size_t offset = (ctx->inline_param_offset + alignment - 1) & ~(alignment - 1);
+    if (size > CMX_OP_CONTEXT_INLINE_PARAM_SIZE ||
+        offset > CMX_OP_CONTEXT_INLINE_PARAM_SIZE - size) {
+        return nullptr;  // Does not fit - caller falls back to the pool
+    }
+
+    void* ptr = ctx->inline_params + offset;
+    ctx->inline_param_offset = offset + size;
+    return ptr;
+}
+
+void* cmx_copy_inline_param(cmx_op_context* ctx, const void* data, size_t size,
+                            size_t alignment) {
+    if (!data) {
+        return nullptr;
+    }
+
+    void* ptr = cmx_alloc_inline_param(ctx, size, alignment);
+    if (ptr) {
+        std::memcpy(ptr, data, size);
+    }
+    return ptr;
+}
+
+void cmx_reset_inline_params(cmx_op_context* ctx) {
+    if (ctx) {
+        ctx->inline_param_offset = 0;
+    }
+}
+
+size_t cmx_inline_param_bytes_free(const cmx_op_context* ctx) {
+    if (!ctx || ctx->inline_param_offset > CMX_OP_CONTEXT_INLINE_PARAM_SIZE) {
+        return 0;
+    }
+    return CMX_OP_CONTEXT_INLINE_PARAM_SIZE - ctx->inline_param_offset;
+}
+
 // Backend configuration
 void cmx_set_backend(cmx_op_context* ctx, cmx_backend_type backend) {
     if (ctx) {
@@ -11,6 +11,11 @@ constexpr size_t CMX_MAX_OP_INPUTS = 8;
 constexpr size_t CMX_MAX_OP_OUTPUTS = 4;
 constexpr size_t CMX_MAX_OP_ATTRS = 16;
 
+// Bytes of parameter storage kept inline in each context. Sized for
+// per-channel scale/shift vectors of up to 64 float entries; larger
+// parameter data falls back to the general pool
+constexpr size_t CMX_OP_CONTEXT_INLINE_PARAM_SIZE = 256;
+
 // Forward declarations
 struct cmx_tensor;
 struct cmx_op_attr;
@@ -90,6 +95,13 @@ struct cmx_op_context {
     bool owns_inputs;
     bool owns_outputs;
     bool owns_scratch;
+
+    // Inline small-buffer parameter storage. Small parameter tensors
+    // (per-channel scales, shape vectors) carved from here share cache
+    // lines with the context itself instead of sitting behind a pool
+    // pointer with full alignment padding
+    alignas(8) uint8_t inline_params[CMX_OP_CONTEXT_INLINE_PARAM_SIZE];
+    size_t inline_param_offset;
 };
 
 // Context management functions
@@ -113,6 +125,16 @@ cmx_status cmx_allocate_scratch(cmx_op_context* ctx, size_t size, size_t alignme
 void cmx_free_scratch(cmx_op_context* ctx);
 void* cmx_get_scratch_ptr(cmx_op_context* ctx);
 
+// Inline parameter storage. Bump allocation from the context's inline
+// region; returns nullptr when the request does not fit, in which case
+// the caller uses the general pool as before. Freed only as a whole
+// via cmx_reset_inline_params or cmx_reset_op_context
+void* cmx_alloc_inline_param(cmx_op_context* ctx, size_t size, size_t alignment = 4);
+void* cmx_copy_inline_param(cmx_op_context* ctx, const void* data, size_t size,
+                            size_t alignment = 4);
+void cmx_reset_inline_params(cmx_op_context* ctx);
+size_t cmx_inline_param_bytes_free(const cmx_op_context* ctx);
+
 // Backend configuration
 void cmx_set_backend(cmx_op_context* ctx, cmx_backend_type backend);
 void cmx_set_exec_policy(cmx_op_context* ctx, cmx_exec_policy policy);
@@ -3,10 +3,12 @@
 #include "../core/cmx_tensor.hpp"
 #include "../core/cmx_status.hpp"
 #include "../core/cmx_backend.hpp"
+#include "../platform/cmx_platform_abstraction.hpp"
 
 #include <map>
 #include <vector>
 #include <algorithm>
+#include <cstring>
 
 namespace cmx {
 
@@ -14,6 +16,29 @@ namespace cmx {
 static std::map<cmx_dispatch_key, cmx_kernel_info> g_kernel_registry;
 static std::vector<std::pair<std::string, cmx_kernel_info>> g_fallback_kernels;
 
+// Measured kernel choices, op_id -> registered kernel name. Filled by
+// the model loader from the plan section's kernel-choice trailer (or
+// live by a tuning harness); consulted by dispatch_kernel before any
+// heuristic matching. Independent of the registry so clearing one
+// does not invalidate the other.
+static std::map<uint32_t, std::string> g_recorded_choices;
+
+// Dense typed dispatch table: one slot per (op_type, dtype, backend).
+// Zero-initialized, so a null kernel pointer means no registration.
+// The parallel priority table preserves the higher-priority-wins rule
+// of the string registry.
+static cmx_kernel_fn g_typed_table[CMX_DISPATCH_OP_TYPES]
+                                  [CMX_DISPATCH_DTYPES]
+                                  [CMX_DISPATCH_BACKENDS];
+static uint32_t g_typed_priority[CMX_DISPATCH_OP_TYPES]
+                                [CMX_DISPATCH_DTYPES]
+                                [CMX_DISPATCH_BACKENDS];
+
+// Declared in cmx_ops.hpp; redeclared here so this translation unit
+// stays off the ops header and only shares the forward-declared enums.
+cmx_op_type cmx_string_to_op_type(const std::string& name);
+const char* cmx_op_type_to_string(cmx_op_type type);
+
 bool cmx_dispatch_key::operator<(const cmx_dispatch_key& other) const {
     if (op_name != other.op_name) return op_name < other.op_name;
     if (backend != other.backend) return static_cast<uint8_t>(backend) < static_cast<uint8_t>(other.backend);
@@ -53,15 +78,141 @@ cmx_status cmx_op_dispatcher::register_kernel(
         }
         
         g_kernel_registry[key] = kernel_info;
+
+        // Mirror into the dense typed table when the name maps to a
+        // known op type, so plan compilation can resolve it without
+        // string lookups. Guard with a round-trip check so unknown
+        // names do not land in the CUSTOM slot.
+        cmx_op_type op_type = cmx_string_to_op_type(key.op_name);
+        if (key.op_name == cmx_op_type_to_string(op_type)) {
+            register_kernel_typed(op_type, key.input_dtype, key.backend, kernel_info);
+        }
     }
-    
+
     return cmx_status::SUCCESS;
 }
 
+cmx_status cmx_op_dispatcher::register_kernel_typed(
+    cmx_op_type op_type,
+    cmx_tensor_dtype dtype,
+    cmx_backend_type backend,
+    const cmx_kernel_info& kernel_info
+) {
+    if (!kernel_info.kernel) {
+        return cmx_status::INVALID_ARGUMENT;
+    }
+
+    uint32_t op = static_cast<uint32_t>(op_type);
+    uint32_t dt = static_cast<uint32_t>(dtype);
+    uint32_t be = static_cast<uint32_t>(backend);
+    if (op >= CMX_DISPATCH_OP_TYPES || dt >= CMX_DISPATCH_DTYPES ||
+        be >= CMX_DISPATCH_BACKENDS) {
+        return cmx_status::INVALID_ARGUMENT;
+    }
+
+    if (g_typed_table[op][dt][be] &&
+        kernel_info.priority <= g_typed_priority[op][dt][be]) {
+        return cmx_status::ALREADY_EXISTS;
+    }
+
+    g_typed_table[op][dt][be] = kernel_info.kernel;
+    g_typed_priority[op][dt][be] = kernel_info.priority;
+    return cmx_status::SUCCESS;
+}
+
+cmx_kernel_fn cmx_op_dispatcher::resolve_kernel(
+    cmx_op_type op_type,
+    cmx_tensor_dtype dtype,
+    cmx_backend_type backend
+) {
+    uint32_t op = static_cast<uint32_t>(op_type);
+    uint32_t dt = static_cast<uint32_t>(dtype);
+    uint32_t be = static_cast<uint32_t>(backend);
+    if (op >= CMX_DISPATCH_OP_TYPES || dt >= CMX_DISPATCH_DTYPES ||
+        be >= CMX_DISPATCH_BACKENDS) {
+        return nullptr;
+    }
+
+    cmx_kernel_fn kernel = g_typed_table[op][dt][be];
+    if (!kernel && be != 0) {
+        // Scalar CPU column (backend 0) as the portable fallback
+        kernel = g_typed_table[op][dt][0];
+    }
+    return kernel;
+}
+
+cmx_backend_type cmx_op_dispatcher::backend_for_features(uint32_t feature_mask) {
+    // Column indices follow the typed table axis (0 = scalar CPU,
+    // 1 = SIMD CPU, 4 = DSP). A vector unit outranks the DSP
+    // extension: the SIMD kernels move more lanes per cycle wherever
+    // both exist
+    if (feature_mask & platform::CMX_FEATURE_VECTOR) {
+        return static_cast<cmx_backend_type>(1);
+    }
+    if (feature_mask & platform::CMX_FEATURE_DSP) {
+        return static_cast<cmx_backend_type>(4);
+    }
+    return static_cast<cmx_backend_type>(0);
+}
+
+cmx_kernel_fn cmx_op_dispatcher::resolve_kernel_auto(
+    cmx_op_type op_type,
+    cmx_tensor_dtype dtype
+) {
+    // The feature mask is fixed once the platform is up, so the
+    // backend choice is computed on the first resolution and reused
+    // for every node of every plan built afterwards
+    static const cmx_backend_type preferred =
+        backend_for_features(platform::get_feature_mask());
+    return resolve_kernel(op_type, dtype, preferred);
+}
+
+cmx_status cmx_op_dispatcher::record_kernel_choice(
+    uint32_t op_id,
+    const char* kernel_name
+) {
+    if (!kernel_name || !kernel_name[0]) {
+        return cmx_status::INVALID_ARGUMENT;
+    }
+    g_recorded_choices[op_id] = kernel_name;
+    return cmx_status::SUCCESS;
+}
+
+void cmx_op_dispatcher::clear_recorded_choices() {
+    g_recorded_choices.clear();
+}
+
+size_t cmx_op_dispatcher::recorded_choice_count() {
+    return g_recorded_choices.size();
+}
+
 cmx_kernel_fn cmx_op_dispatcher::dispatch_kernel(
     const std::string& op_name,
     const cmx_op_context& context
 ) {
+    // A measured choice recorded for this node outranks every rule
+    // below: the shape heuristics mispredict crossovers like
+    // blocked-vs-SIMD on tall-skinny matmuls, and records come from
+    // actual timings on the target. Fall through when the named
+    // kernel is not registered in this build (record tuned elsewhere).
+    if (!g_recorded_choices.empty()) {
+        auto recorded = g_recorded_choices.find(context.op_id);
+        if (recorded != g_recorded_choices.end()) {
+            for (const auto& entry : g_kernel_registry) {
+                if (entry.first.op_name == op_name && entry.second.name &&
+                    recorded->second == entry.second.name) {
+                    return entry.second.kernel;
+                }
+            }
+            for (const auto& fallback : g_fallback_kernels) {
+                if (fallback.first == op_name && fallback.second.name &&
+                    recorded->second == fallback.second.name) {
+                    return fallback.second.kernel;
+                }
+            }
+        }
+    }
+
     // Create dispatch key from context
     cmx_dispatch_key key = create_dispatch_key(op_name, context);
     
@@ -112,6 +263,8 @@ const cmx_kernel_info* cmx_op_dispatcher::get_kernel_info(const cmx_dispatch_key
 void cmx_op_dispatcher::clear_registry() {
     g_kernel_registry.clear();
     g_fallback_kernels.clear();
+    std::memset(g_typed_table, 0, sizeof(g_typed_table));
+    std::memset(g_typed_priority, 0, sizeof(g_typed_priority));
 }
 
 size_t cmx_op_dispatcher::kernel_count() {
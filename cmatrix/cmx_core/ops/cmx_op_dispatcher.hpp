@@ -11,6 +11,18 @@ struct cmx_op_context;
 enum class cmx_backend_type : uint8_t;
 enum class cmx_tensor_dtype : uint8_t;
 enum class cmx_status : uint8_t;
+enum class cmx_op_type : uint8_t;
+
+/**
+ * @brief Dense dispatch table dimensions
+ *
+ * Each axis must cover every enumerator of the corresponding enum.
+ * Kept as plain constants because this header only forward-declares
+ * the enum types; update alongside the enums.
+ */
+constexpr uint32_t CMX_DISPATCH_OP_TYPES = 16;  ///< cmx_op_type::CUSTOM + 1
+constexpr uint32_t CMX_DISPATCH_DTYPES = 8;     ///< cmx_tensor_dtype slots
+constexpr uint32_t CMX_DISPATCH_BACKENDS = 7;   ///< cmx_backend_type::CUSTOM + 1
 
 /**
  * @brief Operation dispatch key for kernel selection
@@ -56,8 +68,93 @@ public:
         const cmx_kernel_info& kernel_info
     );
     
+    /**
+     * @brief Register a kernel in the dense typed table
+     *
+     * Typed registration bypasses the string registry; the entry lands
+     * in a flat (op_type, dtype, backend) table so lookup is a single
+     * array load. Higher-priority registrations replace existing ones.
+     */
+    static cmx_status register_kernel_typed(
+        cmx_op_type op_type,
+        cmx_tensor_dtype dtype,
+        cmx_backend_type backend,
+        const cmx_kernel_info& kernel_info
+    );
+
+    /**
+     * @brief Resolve a kernel from the dense typed table
+     *
+     * O(1) array load with no string comparisons. Intended to be called
+     * once per node when the execution plan is compiled; the string
+     * path below survives for debugging and model serialization only.
+     * Falls back to the scalar CPU backend column when the requested
+     * backend has no entry.
+     */
+    static cmx_kernel_fn resolve_kernel(
+        cmx_op_type op_type,
+        cmx_tensor_dtype dtype,
+        cmx_backend_type backend
+    );
+
+    /**
+     * @brief Map the startup feature bitmask to a dispatch backend
+     *
+     * Translates the CMX_FEATURE_* mask from platform::get_feature_mask()
+     * into the strongest dispatch table column the hardware supports:
+     * vector unit first, then the DSP extension, else scalar CPU.
+     */
+    static cmx_backend_type backend_for_features(uint32_t feature_mask);
+
+    /**
+     * @brief Resolve a kernel against the startup capability probe
+     *
+     * resolve_kernel() with the backend derived once from the cached
+     * platform feature mask, so plan build pins every node's kernel to
+     * the probed hardware without per-node capability queries. The
+     * first call must come after platform::init_platform(); the
+     * backend choice is fixed from then on.
+     */
+    static cmx_kernel_fn resolve_kernel_auto(
+        cmx_op_type op_type,
+        cmx_tensor_dtype dtype
+    );
+
+    /**
+     * @brief Record a measured kernel choice for one node
+     *
+     * Measurement beats shape heuristics on odd layer shapes, so the
+     * benchmark/autotune harness records the winning kernel per node
+     * and dispatch_kernel honors the record over every heuristic rule.
+     * Records are keyed by the node's op_id (the same ID the model
+     * file's plan section uses) and name a registered kernel by its
+     * cmx_kernel_info::name; the loader replays the records persisted
+     * in the plan section through this call at model load.
+     *
+     * A record naming a kernel absent from the running build (tuned on
+     * a different configuration) is ignored at dispatch time and the
+     * heuristics apply as before.
+     */
+    static cmx_status record_kernel_choice(
+        uint32_t op_id,
+        const char* kernel_name
+    );
+
+    /**
+     * @brief Drop all recorded kernel choices
+     */
+    static void clear_recorded_choices();
+
+    /**
+     * @brief Number of recorded kernel choices
+     */
+    static size_t recorded_choice_count();
+
     /**
      * @brief Find best matching kernel for operation context
+     *
+     * A kernel choice recorded for the context's op_id wins over the
+     * heuristic matching below whenever the named kernel is registered.
      */
     static cmx_kernel_fn dispatch_kernel(
         const std::string& op_name,
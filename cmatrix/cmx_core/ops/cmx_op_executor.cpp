@@ -115,6 +115,51 @@ cmx_status cmx_op_executor::execute_ops(const std::string* op_names,
     return cmx_status::SUCCESS;
 }
 
+// Resolve a short op sequence into a direct call chain
+cmx_status cmx_op_executor::prepare_direct_chain(const std::string* op_names,
+                                                cmx_op_context* contexts,
+                                                size_t count,
+                                                cmx_direct_chain& chain) {
+    chain.count = 0;
+
+    if (!op_names || !contexts || count == 0 || count > CMX_DIRECT_CHAIN_MAX_OPS) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const cmx_op* op = cmx_get_op(op_names[i]);
+        if (!op || !op->execute) {
+            return cmx_status::ERROR_UNSUPPORTED_OP;
+        }
+
+        // Validation is unconditional here: it runs once at prepare
+        // time instead of on every invocation, so there is no reason
+        // to skip it
+        cmx_status val_status = validate_execution(op, contexts[i]);
+        if (val_status != cmx_status::SUCCESS) {
+            return val_status;
+        }
+
+        // Bake in the per-run context fixups from execute_op /
+        // execute_op_internal so the run loop does none of them
+        contexts[i].op_name = op->name.c_str();
+        if (contexts[i].backend == cmx_backend_type::CPU_SCALAR &&
+            config_.default_backend != cmx_backend_type::CPU_SCALAR) {
+            contexts[i].backend = config_.default_backend;
+        }
+        if (contexts[i].exec_policy == cmx_exec_policy::SERIAL &&
+            config_.default_policy != cmx_exec_policy::SERIAL) {
+            contexts[i].exec_policy = config_.default_policy;
+        }
+
+        chain.ops[i] = op->execute;
+        chain.contexts[i] = &contexts[i];
+    }
+
+    chain.count = count;
+    return cmx_status::SUCCESS;
+}
+
 // Configuration
 void cmx_op_executor::set_config(const cmx_executor_config& config) {
     config_ = config;
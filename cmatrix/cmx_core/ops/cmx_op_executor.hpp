@@ -29,6 +29,23 @@ struct cmx_executor_config {
     cmx_exec_policy default_policy;
 };
 
+// Node-count ceiling for the direct-chain fast path
+constexpr size_t CMX_DIRECT_CHAIN_MAX_OPS = 4;
+
+// Pre-resolved call chain for tiny models.
+//
+// For models of a handful of nodes invoked at kHz rates, the per-run
+// cost of the execution machinery (name lookups, validation, backend
+// defaulting, stat updates) can exceed the useful compute. A direct
+// chain runs that machinery once in prepare_direct_chain() and keeps
+// only raw execute pointers paired with their contexts, so each
+// invocation is a bare loop of indirect calls.
+struct cmx_direct_chain {
+    cmx_status (*ops[CMX_DIRECT_CHAIN_MAX_OPS])(cmx_op_context& ctx);
+    cmx_op_context* contexts[CMX_DIRECT_CHAIN_MAX_OPS];
+    size_t count;
+};
+
 // Operation executor class
 class cmx_op_executor {
 public:
@@ -41,8 +58,16 @@ public:
     cmx_status execute_op(const cmx_op* op, cmx_op_context& ctx);
     
     // Batch execution
-    cmx_status execute_ops(const std::string* op_names, cmx_op_context* contexts, 
+    cmx_status execute_ops(const std::string* op_names, cmx_op_context* contexts,
                           size_t count);
+
+    // Resolve a short op sequence into a direct call chain. Performs
+    // the name lookups, validation, and context defaulting that
+    // execute_op would do per run, once. The contexts must outlive the
+    // chain. Fails for sequences above CMX_DIRECT_CHAIN_MAX_OPS.
+    cmx_status prepare_direct_chain(const std::string* op_names,
+                                   cmx_op_context* contexts,
+                                   size_t count, cmx_direct_chain& chain);
     
     // Configuration
     void set_config(const cmx_executor_config& config);
@@ -84,6 +109,18 @@ private:
     cmx_status execute_serial(const cmx_op* op, cmx_op_context& ctx);
 };
 
+// Run a prepared direct chain. Inline and branch-free apart from the
+// status check so a single-op model costs one indirect call per run.
+inline cmx_status cmx_run_direct_chain(const cmx_direct_chain& chain) {
+    for (size_t i = 0; i < chain.count; ++i) {
+        const cmx_status status = chain.ops[i](*chain.contexts[i]);
+        if (status != cmx_status::SUCCESS) {
+            return status;
+        }
+    }
+    return cmx_status::SUCCESS;
+}
+
 // C-style API functions
 cmx_status cmx_execute_op(const std::string& op_name, cmx_op_context& ctx);
 cmx_status cmx_execute_op_with_config(const std::string& op_name, 
@@ -89,7 +89,12 @@ cmx_status cmx_op_loader::load_from_buffer(
         status = infer_shapes(model, config);
         if (status != cmx_status::SUCCESS) return status;
     }
-    
+
+    if (config.allow_mixed_precision) {
+        status = insert_precision_boundaries(model, config);
+        if (status != cmx_status::SUCCESS) return status;
+    }
+
     if (config.enable_layout_optimization) {
         status = optimize_layouts(model, config);
         if (status != cmx_status::SUCCESS) return status;
@@ -99,7 +104,20 @@ cmx_status cmx_op_loader::load_from_buffer(
         status = fold_constants(model, config);
         if (status != cmx_status::SUCCESS) return status;
     }
-    
+
+    // After folding, so folded constants are deduplicated too
+    if (config.enable_weight_dedup) {
+        status = deduplicate_weights(model, config);
+        if (status != cmx_status::SUCCESS) return status;
+    }
+
+    // Last: every pass above edits per-node blobs, and the fixed
+    // offsets must stay valid from here on
+    if (config.enable_param_packing) {
+        status = pack_param_section(model);
+        if (status != cmx_status::SUCCESS) return status;
+    }
+
     // Final validation
     return validate_model(model);
 }
@@ -206,6 +224,186 @@ cmx_status cmx_op_loader::bind_tensors(
     return cmx_status::SUCCESS;
 }
 
+// Ops whose whole purpose is to change dtype across a precision boundary
+static bool is_precision_boundary_op(const std::string& op_type) {
+    return op_type == "Quantize" || op_type == "Dequantize" ||
+           op_type == "Requantize" || op_type == "Cast";
+}
+
+cmx_status cmx_op_loader::insert_precision_boundaries(
+    cmx_loaded_model& model,
+    const cmx_loader_config& config
+) {
+    // Fast path: a single-dtype graph needs no boundaries
+    bool mixed = false;
+    cmx_tensor_dtype first_dtype = cmx_tensor_dtype::FLOAT32;
+    bool first_seen = false;
+    for (const auto& binding : model.tensors) {
+        if (binding.is_constant) {
+            continue; // Weights may legitimately differ from activations
+        }
+        if (!first_seen) {
+            first_dtype = binding.dtype;
+            first_seen = true;
+        } else if (binding.dtype != first_dtype) {
+            mixed = true;
+            break;
+        }
+    }
+    if (!mixed) {
+        return cmx_status::SUCCESS;
+    }
+
+    auto find_binding = [&model](uint32_t tensor_id) -> cmx_tensor_binding* {
+        for (auto& binding : model.tensors) {
+            if (binding.tensor_id == tensor_id) {
+                return &binding;
+            }
+        }
+        return nullptr;
+    };
+
+    // One bridge per (tensor, target dtype), shared by every consumer
+    // that needs it - this is what keeps the insertion minimal
+    std::vector<std::pair<std::pair<uint32_t, cmx_tensor_dtype>, uint32_t>> bridges;
+
+    const size_t original_node_count = model.nodes.size();
+    for (size_t n = 0; n < original_node_count; ++n) {
+        if (is_precision_boundary_op(model.nodes[n].op_type) ||
+            model.nodes[n].output_ids.empty()) {
+            continue;
+        }
+
+        // The node runs at the precision of its first output
+        cmx_tensor_binding* out_binding = find_binding(model.nodes[n].output_ids[0]);
+        if (!out_binding) {
+            continue;
+        }
+        cmx_tensor_dtype target = out_binding->dtype;
+
+        // Index-based access throughout: appending bridge nodes and
+        // tensors below reallocates both vectors
+        for (size_t i = 0; i < model.nodes[n].input_ids.size(); ++i) {
+            uint32_t input_id = model.nodes[n].input_ids[i];
+            cmx_tensor_binding* in_binding = find_binding(input_id);
+            if (!in_binding || in_binding->is_constant ||
+                in_binding->dtype == target) {
+                continue;
+            }
+
+            // Reuse an existing bridge for this (tensor, dtype) pair
+            uint32_t bridge_id = 0;
+            bool found = false;
+            for (const auto& bridge : bridges) {
+                if (bridge.first.first == input_id && bridge.first.second == target) {
+                    bridge_id = bridge.second;
+                    found = true;
+                    break;
+                }
+            }
+
+            if (!found) {
+                if (model.tensors.size() >= config.max_tensor_count) {
+                    return cmx_status::RESOURCE_EXHAUSTED;
+                }
+
+                cmx_tensor_binding bridge_binding = *in_binding;
+                bridge_binding.tensor_id = static_cast<uint32_t>(model.tensors.size());
+                bridge_binding.dtype = target;
+                bridge_binding.is_input = false;
+                bridge_binding.is_output = false;
+                bridge_binding.is_constant = false;
+                bridge_binding.byte_offset = 0;
+
+                cmx_op_node boundary;
+                if (target == cmx_tensor_dtype::FLOAT32) {
+                    boundary.op_type = "Dequantize";
+                } else if (in_binding->dtype == cmx_tensor_dtype::FLOAT32) {
+                    boundary.op_type = "Quantize";
+                } else {
+                    boundary.op_type = "Requantize";
+                }
+                boundary.node_name = in_binding->name + "/" + boundary.op_type;
+                bridge_binding.name = in_binding->name + "_" + boundary.op_type;
+                boundary.input_ids.push_back(input_id);
+                boundary.output_ids.push_back(bridge_binding.tensor_id);
+                // Runs just before its consumer; topological_sort settles ties
+                boundary.execution_order = model.nodes[n].execution_order;
+
+                bridge_id = bridge_binding.tensor_id;
+                model.tensors.push_back(bridge_binding);
+                model.nodes.push_back(boundary);
+                bridges.push_back({{input_id, target}, bridge_id});
+            }
+
+            model.nodes[n].input_ids[i] = bridge_id;
+        }
+    }
+
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_op_loader::deduplicate_weights(
+    cmx_loaded_model& model,
+    const cmx_loader_config& config
+) {
+    (void)config;
+    if (model.constant_data.empty()) {
+        return cmx_status::SUCCESS;
+    }
+
+    // Constants are packed back to back in the blob in offset order, so
+    // each one's extent runs to the next constant's offset (the wire
+    // format carries no per-tensor hash or length yet; sizing and
+    // hashing happen here, one pass per constant)
+    std::vector<size_t> constant_indices;
+    for (size_t i = 0; i < model.tensors.size(); ++i) {
+        if (model.tensors[i].is_constant) {
+            constant_indices.push_back(i);
+        }
+    }
+    if (constant_indices.empty()) {
+        return cmx_status::SUCCESS;
+    }
+
+    std::sort(constant_indices.begin(), constant_indices.end(),
+        [&model](size_t a, size_t b) {
+            return model.tensors[a].byte_offset < model.tensors[b].byte_offset;
+        });
+
+    bool all_pooled = true;
+    for (size_t i = 0; i < constant_indices.size(); ++i) {
+        cmx_tensor_binding& binding = model.tensors[constant_indices[i]];
+        const size_t begin = binding.byte_offset;
+        const size_t end = (i + 1 < constant_indices.size())
+            ? model.tensors[constant_indices[i + 1]].byte_offset
+            : model.constant_data.size();
+
+        if (begin >= end || end > model.constant_data.size()) {
+            all_pooled = false;  // Malformed extent; keep the private copy
+            continue;
+        }
+
+        const uint8_t* pooled =
+            cmx_weight_pool::intern(model.constant_data.data() + begin,
+                                    end - begin);
+        if (!pooled) {
+            all_pooled = false;
+            continue;
+        }
+        binding.shared_data = pooled;
+    }
+
+    // Every constant now lives in the pool; drop the private blob so a
+    // model sharing its backbone with an already-loaded one costs only
+    // its unique weights
+    if (all_pooled) {
+        std::vector<uint8_t>().swap(model.constant_data);
+    }
+
+    return cmx_status::SUCCESS;
+}
+
 cmx_status cmx_op_loader::validate_model(const cmx_loaded_model& model) {
     // Check for empty model
     if (model.nodes.empty()) {
@@ -224,11 +422,44 @@ cmx_status cmx_op_loader::validate_model(const cmx_loaded_model& model) {
         if (tensor.is_input) has_input = true;
         if (tensor.is_output) has_output = true;
     }
-    
+
     if (!has_input || !has_output) {
         return cmx_status::INVALID_MODEL;
     }
-    
+
+    // Dtype coherence: mixed-precision graphs are fine, but every dtype
+    // change must flow through a boundary node. A compute node whose
+    // activation inputs differ from its output dtype means the loader
+    // was run with allow_mixed_precision disabled on a mixed graph.
+    for (const auto& node : model.nodes) {
+        if (is_precision_boundary_op(node.op_type) || node.output_ids.empty()) {
+            continue;
+        }
+
+        const cmx_tensor_binding* out_binding = nullptr;
+        for (const auto& binding : model.tensors) {
+            if (binding.tensor_id == node.output_ids[0]) {
+                out_binding = &binding;
+                break;
+            }
+        }
+        if (!out_binding) {
+            continue;
+        }
+
+        for (uint32_t input_id : node.input_ids) {
+            for (const auto& binding : model.tensors) {
+                if (binding.tensor_id != input_id) {
+                    continue;
+                }
+                if (!binding.is_constant && binding.dtype != out_binding->dtype) {
+                    return cmx_status::INVALID_MODEL;
+                }
+                break;
+            }
+        }
+    }
+
     return cmx_status::SUCCESS;
 }
 
@@ -250,14 +481,70 @@ cmx_status cmx_op_loader::get_model_info(
     return cmx_status::SUCCESS;
 }
 
+const void* cmx_op_loader::node_params(
+    const cmx_loaded_model& model,
+    const cmx_op_node& node
+) {
+    if (node.param_offset != CMX_NO_NODE_PARAMS &&
+        node.param_offset < model.param_section.size()) {
+        return model.param_section.data() + node.param_offset;
+    }
+    if (!node.op_params.empty()) {
+        return node.op_params.data();
+    }
+    return nullptr;
+}
+
 void cmx_op_loader::free_model(cmx_loaded_model& model) {
     model.nodes.clear();
     model.tensors.clear();
     model.constant_data.clear();
+    model.param_section.clear();
     model.model_name.clear();
     model.model_version = 0;
 }
 
+cmx_status cmx_op_loader::pack_param_section(cmx_loaded_model& model) {
+    // Parameter structs get the alignment of the strictest member any
+    // of them carries, so the offset-addressed casts are always valid
+    constexpr size_t alignment = 8;
+
+    size_t total = 0;
+    for (const auto& node : model.nodes) {
+        if (!node.op_params.empty()) {
+            total = (total + alignment - 1) & ~(alignment - 1);
+            total += node.op_params.size();
+        }
+    }
+
+    model.param_section.clear();
+    if (total == 0) {
+        return cmx_status::SUCCESS;
+    }
+    model.param_section.reserve(total);
+
+    for (auto& node : model.nodes) {
+        if (node.op_params.empty()) {
+            node.param_offset = CMX_NO_NODE_PARAMS;
+            continue;
+        }
+
+        size_t offset = model.param_section.size();
+        offset = (offset + alignment - 1) & ~(alignment - 1);
+        model.param_section.resize(offset);
+        model.param_section.insert(model.param_section.end(),
+                                   node.op_params.begin(),
+                                   node.op_params.end());
+        node.param_offset = static_cast<uint32_t>(offset);
+
+        // The section is now the only copy; drop the per-node blob
+        // including its heap block
+        std::vector<uint8_t>().swap(node.op_params);
+    }
+
+    return cmx_status::SUCCESS;
+}
+
 cmx_model_format cmx_op_loader::detect_format(
     const char* file_path,
     const uint8_t* buffer,
@@ -603,6 +890,58 @@ cmx_status cmx_op_loader::resolve_tensor_shapes(
     return cmx_status::SUCCESS;
 }
 
+// Weight pool implementation
+std::vector<cmx_weight_pool::entry> cmx_weight_pool::entries_;
+size_t cmx_weight_pool::deduplicated_bytes_ = 0;
+
+uint64_t cmx_weight_pool::hash_bytes(const uint8_t* data, size_t size) {
+    // 64-bit FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+const uint8_t* cmx_weight_pool::intern(const uint8_t* data, size_t size) {
+    if (!data || size == 0) {
+        return nullptr;
+    }
+
+    const uint64_t hash = hash_bytes(data, size);
+    for (const entry& pooled : entries_) {
+        if (pooled.hash == hash && pooled.data.size() == size &&
+            memcmp(pooled.data.data(), data, size) == 0) {
+            deduplicated_bytes_ += size;
+            return pooled.data.data();
+        }
+    }
+
+    entries_.push_back({hash, std::vector<uint8_t>(data, data + size)});
+    return entries_.back().data.data();
+}
+
+size_t cmx_weight_pool::pooled_bytes() {
+    size_t total = 0;
+    for (const entry& pooled : entries_) {
+        total += pooled.data.size();
+    }
+    return total;
+}
+
+size_t cmx_weight_pool::deduplicated_bytes() {
+    return deduplicated_bytes_;
+}
+
+size_t cmx_weight_pool::entry_count() {
+    return entries_.size();
+}
+
+void cmx_weight_pool::clear() {
+    entries_.clear();
+    deduplicated_bytes_ = 0;
+}
+
 // Format detector implementations
 bool cmx_format_detector::is_cmx_binary(const uint8_t* buffer, size_t size) {
     return size >= sizeof(CMX_BINARY_MAGIC) &&
@@ -32,6 +32,13 @@ struct cmx_loader_config {
     bool enable_layout_optimization = true;
     bool enable_constant_folding = false;
     bool strict_type_checking = true;
+    bool allow_mixed_precision = true;  // Bridge per-tensor dtype changes with
+                                        // quantize/dequantize boundary nodes
+                                        // instead of rejecting the graph
+    bool enable_weight_dedup = true;    // Map identical constant tensors across
+                                        // loaded models onto one pooled buffer
+    bool enable_param_packing = true;   // Pack per-node parameter blobs into one
+                                        // contiguous offset-addressed section
     size_t max_graph_nodes = 1024;
     size_t max_tensor_count = 512;
     const char* custom_op_library = nullptr;
@@ -49,8 +56,16 @@ struct cmx_tensor_binding {
     bool is_input;
     bool is_output;
     bool is_constant;
+
+    // Pooled weight bytes when the loader deduplicated this constant;
+    // takes precedence over byte_offset (whose backing blob may have
+    // been released)
+    const uint8_t* shared_data = nullptr;
 };
 
+/// Sentinel param_offset for nodes with no parameters
+constexpr uint32_t CMX_NO_NODE_PARAMS = 0xFFFFFFFF;
+
 /**
  * @brief Operation node in loaded graph
  */
@@ -60,6 +75,12 @@ struct cmx_op_node {
     std::vector<uint32_t> input_ids;
     std::vector<uint32_t> output_ids;
     std::vector<uint8_t> op_params;  // Serialized operation parameters
+
+    // Byte offset of this node's parameter struct inside the model's
+    // packed param_section, CMX_NO_NODE_PARAMS while unpacked. After
+    // packing, op_params is released and the offset is the node's only
+    // parameter reference
+    uint32_t param_offset = CMX_NO_NODE_PARAMS;
     uint32_t execution_order;
 };
 
@@ -70,6 +91,13 @@ struct cmx_loaded_model {
     std::vector<cmx_op_node> nodes;
     std::vector<cmx_tensor_binding> tensors;
     std::vector<uint8_t> constant_data;
+
+    // Every node's parameter struct laid out contiguously at 8-aligned
+    // offsets (see cmx_op_node::param_offset). One warm region instead
+    // of a heap blob per node: execution addresses parameters as
+    // base + offset, and the structs keep the alignment the kernels'
+    // configure(const void*) casts require
+    std::vector<uint8_t> param_section;
     std::string model_name;
     uint32_t model_version;
     cmx_model_format format;
@@ -144,6 +172,19 @@ public:
         size_t& num_operations
     );
     
+    /**
+     * @brief Resolve a node's parameter struct
+     *
+     * Returns the node's slot in the packed param_section when the
+     * model has been packed, the per-node blob otherwise, nullptr for
+     * a parameterless node — so kernel configure() calls read the same
+     * pointer regardless of which state the model is in.
+     */
+    static const void* node_params(
+        const cmx_loaded_model& model,
+        const cmx_op_node& node
+    );
+
     /**
      * @brief Free loaded model resources
      */
@@ -202,6 +243,23 @@ private:
         const cmx_loader_config& config
     );
     
+    /**
+     * @brief Insert dtype boundary nodes for mixed-precision graphs
+     *
+     * Graphs may carry per-tensor dtypes (e.g. an int8 backbone feeding
+     * a float head). Wherever a node consumes a tensor whose dtype
+     * differs from the node's own precision, a Quantize, Dequantize or
+     * Requantize node is inserted to bridge the boundary. Boundaries
+     * are shared: all consumers needing the same tensor at the same
+     * dtype reuse one bridge node, so the insertion is minimal.
+     * Adjacent boundary pairs are later cancelled by the graph
+     * optimizer's quantize_dequantize_elimination pass.
+     */
+    static cmx_status insert_precision_boundaries(
+        cmx_loaded_model& model,
+        const cmx_loader_config& config
+    );
+
     /**
      * @brief Validate tensor connections
      */
@@ -212,6 +270,32 @@ private:
      */
     static cmx_status topological_sort(cmx_loaded_model& model);
     
+    /**
+     * @brief Deduplicate constant tensors against the shared weight pool
+     *
+     * Models exported from a common backbone carry byte-identical
+     * weight tensors; loading several such models used to keep one
+     * copy per model. Each constant is hashed and interned into
+     * cmx_weight_pool, bindings are repointed at the pooled bytes, and
+     * the model's private constant blob is released once every
+     * constant has been pooled.
+     */
+    static cmx_status deduplicate_weights(
+        cmx_loaded_model& model,
+        const cmx_loader_config& config
+    );
+
+    /**
+     * @brief Pack per-node parameter blobs into one contiguous section
+     *
+     * Copies every node's op_params into param_section at an 8-aligned
+     * fixed offset recorded in param_offset, then releases the per-node
+     * blobs. Runs last in the load pipeline so the transform passes
+     * above it still see the blobs they mutate, and nothing can
+     * invalidate the offsets afterwards.
+     */
+    static cmx_status pack_param_section(cmx_loaded_model& model);
+
     /**
      * @brief Resolve tensor shapes from operation inputs/outputs
      */
@@ -221,6 +305,51 @@ private:
     );
 };
 
+/**
+ * @brief Process-wide content-addressed pool of constant tensor bytes
+ *
+ * Backs the loader's weight deduplication: intern() returns a stable
+ * pointer to a pooled copy of the given bytes, reusing an existing
+ * entry when the content matches (64-bit FNV-1a hash, then an exact
+ * byte compare so hash collisions can never alias two tensors). Like
+ * the op registry, the pool is populated from the load path only;
+ * inference threads just read through the returned pointers.
+ */
+class cmx_weight_pool {
+public:
+    /**
+     * @brief Intern a byte range, returning the pooled copy
+     * @return Stable pointer to pooled bytes, nullptr on empty input
+     */
+    static const uint8_t* intern(const uint8_t* data, size_t size);
+
+    /** @brief Total bytes held by the pool */
+    static size_t pooled_bytes();
+
+    /** @brief Bytes saved by returning existing entries */
+    static size_t deduplicated_bytes();
+
+    /** @brief Number of distinct pooled tensors */
+    static size_t entry_count();
+
+    /**
+     * @brief Release every pooled buffer
+     * @note Invalidates all shared_data pointers of loaded models
+     */
+    static void clear();
+
+private:
+    struct entry {
+        uint64_t hash;
+        std::vector<uint8_t> data;
+    };
+
+    static uint64_t hash_bytes(const uint8_t* data, size_t size);
+
+    static std::vector<entry> entries_;
+    static size_t deduplicated_bytes_;
+};
+
 /**
  * @brief Model format detection utilities
  */
@@ -0,0 +1,94 @@
+#ifndef CMX_OP_MANIFEST_HPP
+#define CMX_OP_MANIFEST_HPP
+
+// Compile-time operator manifest.
+//
+// Two registry modes share this header:
+//
+//  - Dynamic (default): every CMX_NEED_OP_* flag defaults to 1, all
+//    core ops are compiled in and registered at startup. Nothing
+//    changes for existing builds.
+//
+//  - Manifest: the build defines CMX_USE_KERNEL_MANIFEST and puts the
+//    cmx_kernel_manifest.hpp generated by cmx_gen.py on the include
+//    path. That header lists exactly the ops the compiled model uses;
+//    everything it does not mention defaults to 0 here, so the unused
+//    execute functions are never compiled and startup registers only
+//    the short list. This is where the flash savings for single-model
+//    firmware come from.
+//
+// Flags must be testable with #if, so absent ones are defined to the
+// mode default below rather than left undefined.
+
+#ifdef CMX_USE_KERNEL_MANIFEST
+#include "cmx_kernel_manifest.hpp"
+#define CMX_OP_MANIFEST_DEFAULT 0
+#else
+#define CMX_OP_MANIFEST_DEFAULT 1
+#endif
+
+#ifndef CMX_NEED_OP_CONV2D
+#define CMX_NEED_OP_CONV2D CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_RELU
+#define CMX_NEED_OP_RELU CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_DENSE
+#define CMX_NEED_OP_DENSE CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_ADD
+#define CMX_NEED_OP_ADD CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_SUB
+#define CMX_NEED_OP_SUB CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_MUL
+#define CMX_NEED_OP_MUL CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_DIV
+#define CMX_NEED_OP_DIV CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_MAXPOOL2D
+#define CMX_NEED_OP_MAXPOOL2D CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_AVGPOOL2D
+#define CMX_NEED_OP_AVGPOOL2D CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_BATCHNORM
+#define CMX_NEED_OP_BATCHNORM CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_SOFTMAX
+#define CMX_NEED_OP_SOFTMAX CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_RESHAPE
+#define CMX_NEED_OP_RESHAPE CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_TRANSPOSE
+#define CMX_NEED_OP_TRANSPOSE CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_CONCAT
+#define CMX_NEED_OP_CONCAT CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_SPLIT
+#define CMX_NEED_OP_SPLIT CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#ifndef CMX_NEED_OP_PREPROCESS
+#define CMX_NEED_OP_PREPROCESS CMX_OP_MANIFEST_DEFAULT
+#endif
+
+#endif // CMX_OP_MANIFEST_HPP
@@ -0,0 +1,125 @@
+#include "cmx_op_plugin.hpp"
+#include "cmx_op_registry.hpp"
+#include "cmx_op_context.hpp"
+
+#include <array>
+#include <utility>
+
+#if defined(__linux__)
+#include <dlfcn.h>
+#endif
+
+namespace cmx {
+
+namespace {
+
+// Trampolines bridge the C execute signature (void* context, int32_t
+// return) onto the registry's typed one. cmx_op holds a bare function
+// pointer, so each plugin kernel needs its own compiled trampoline;
+// the slots are instantiated over an index sequence and handed out in
+// registration order.
+cmx_plugin_execute_fn g_slot_targets[CMX_MAX_PLUGIN_KERNELS];
+size_t g_slot_count = 0;
+
+template <size_t I>
+cmx_status slot_trampoline(cmx_op_context& ctx) {
+    const int32_t rc = g_slot_targets[I](&ctx);
+    return rc == 0 ? cmx_status::SUCCESS : cmx_status::ERROR_EXECUTION_FAILED;
+}
+
+using trampoline_fn = cmx_status (*)(cmx_op_context&);
+
+template <size_t... Is>
+constexpr std::array<trampoline_fn, sizeof...(Is)>
+make_trampolines(std::index_sequence<Is...>) {
+    return {{&slot_trampoline<Is>...}};
+}
+
+const std::array<trampoline_fn, CMX_MAX_PLUGIN_KERNELS> g_trampolines =
+    make_trampolines(std::make_index_sequence<CMX_MAX_PLUGIN_KERNELS>{});
+
+} // namespace
+
+cmx_status cmx_register_plugin(const cmx_plugin_manifest* manifest) {
+    if (!manifest || !manifest->kernels || manifest->kernel_count == 0) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    if (manifest->abi_version != CMX_PLUGIN_ABI_VERSION) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    if (g_slot_count + manifest->kernel_count > CMX_MAX_PLUGIN_KERNELS) {
+        return cmx_status::ERROR_OUT_OF_MEMORY;
+    }
+
+    // Validate the whole table before touching the registry so a bad
+    // entry can never leave a manifest half-absorbed
+    for (uint32_t i = 0; i < manifest->kernel_count; ++i) {
+        const cmx_plugin_kernel_desc& desc = manifest->kernels[i];
+        if (!desc.name || !desc.execute ||
+            desc.input_count > CMX_MAX_OP_INPUTS ||
+            desc.output_count > CMX_MAX_OP_OUTPUTS) {
+            return cmx_status::ERROR_INVALID_ARGS;
+        }
+        if (cmx_is_op_registered(desc.name)) {
+            return cmx_status::ERROR_INVALID_ARGS;
+        }
+    }
+
+    for (uint32_t i = 0; i < manifest->kernel_count; ++i) {
+        const cmx_plugin_kernel_desc& desc = manifest->kernels[i];
+        g_slot_targets[g_slot_count] = desc.execute;
+
+        cmx_op op;
+        op.name = desc.name;
+        op.execute = g_trampolines[g_slot_count];
+        op.input_count = desc.input_count;
+        op.output_count = desc.output_count;
+        op.attr_count = desc.attr_count;
+        op.supports_inplace = (desc.flags & CMX_PLUGIN_KERNEL_INPLACE) != 0;
+        op.version = desc.kernel_version;
+        op.writes_all_outputs = (desc.flags & CMX_PLUGIN_KERNEL_WRITES_ALL) != 0;
+
+        cmx_status status = cmx_register_op(op.name, op);
+        if (status != cmx_status::SUCCESS) {
+            return status; // Duplicates were screened above; registry full
+        }
+        ++g_slot_count;
+    }
+
+    return cmx_status::SUCCESS;
+}
+
+cmx_status cmx_load_plugin_module(const char* path) {
+#if defined(__linux__)
+    if (!path) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    void* handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    auto entry = reinterpret_cast<cmx_plugin_entry_fn>(
+        dlsym(handle, CMX_PLUGIN_ENTRY_SYMBOL));
+    if (!entry) {
+        dlclose(handle);
+        return cmx_status::ERROR_INVALID_ARGS;
+    }
+    cmx_status status = cmx_register_plugin(entry());
+    if (status != cmx_status::SUCCESS) {
+        dlclose(handle);
+        return status;
+    }
+    // The handle is deliberately kept open: the registry holds code
+    // pointers into the module for the rest of the process lifetime
+    return cmx_status::SUCCESS;
+#else
+    (void)path;
+    return cmx_status::ERROR_UNSUPPORTED_OP;
+#endif
+}
+
+size_t cmx_get_plugin_kernel_count() {
+    return g_slot_count;
+}
+
+} // namespace cmx
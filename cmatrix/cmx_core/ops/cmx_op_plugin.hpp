@@ -0,0 +1,83 @@
+#ifndef CMX_OP_PLUGIN_HPP
+#define CMX_OP_PLUGIN_HPP
+
+#include "cmx_ops.hpp"
+#include <cstdint>
+#include <cstddef>
+
+// Kernel plugin ABI.
+//
+// Customers with proprietary operators used to fork the runtime to add
+// kernels to the registry, which cut them off from updates (and pushed
+// them toward wrapping their ops in model-boundary exits that cost a
+// full tensor round trip through the API). A plugin instead describes
+// its kernels in a versioned, C-compatible descriptor table the runtime
+// absorbs at init - from a statically linked customer object on any
+// target, or from a dlopened shared module on Linux gateways. Absorbed
+// kernels become ordinary registry entries: they participate in the
+// plan, declare fusion capability through the same flags core ops use,
+// and show up in profiling under their own names.
+//
+// The descriptor structs below are the ABI surface: C layout,
+// append-only, and CMX_PLUGIN_ABI_VERSION bumps on any incompatible
+// change. A mismatched manifest is rejected, never partially absorbed.
+
+extern "C" {
+
+#define CMX_PLUGIN_ABI_VERSION 1
+
+// Capability flags, mirroring the cmx_op fields the executor's fusion
+// and zero-fill passes read
+#define CMX_PLUGIN_KERNEL_INPLACE    (1u << 0)  // Output may alias input
+#define CMX_PLUGIN_KERNEL_WRITES_ALL (1u << 1)  // Writes every output element
+
+// Kernel entry point: returns 0 on success, nonzero on failure. The
+// context argument is the node's cmx_op_context; C plugins treat it as
+// opaque and go through the context accessor functions, C++ plugins
+// may include cmx_op_context.hpp and use it directly.
+typedef int32_t (*cmx_plugin_execute_fn)(void* op_context);
+
+typedef struct cmx_plugin_kernel_desc {
+    const char* name;               // Op type name graphs refer to
+    cmx_plugin_execute_fn execute;
+    uint32_t input_count;
+    uint32_t output_count;
+    uint32_t attr_count;
+    uint32_t flags;                 // CMX_PLUGIN_KERNEL_* capability bits
+    uint32_t kernel_version;        // Plugin's own versioning, informational
+} cmx_plugin_kernel_desc;
+
+typedef struct cmx_plugin_manifest {
+    uint32_t abi_version;           // Must equal CMX_PLUGIN_ABI_VERSION
+    uint32_t kernel_count;
+    const cmx_plugin_kernel_desc* kernels;
+    const char* plugin_name;        // For diagnostics
+} cmx_plugin_manifest;
+
+// dlopened modules export this symbol returning their manifest
+typedef const cmx_plugin_manifest* (*cmx_plugin_entry_fn)(void);
+#define CMX_PLUGIN_ENTRY_SYMBOL "cmx_plugin_entry"
+
+} // extern "C"
+
+namespace cmx {
+
+// Maximum plugin kernels across all absorbed manifests; each occupies
+// one statically compiled trampoline slot
+constexpr size_t CMX_MAX_PLUGIN_KERNELS = 32;
+
+// Absorb a manifest into the op registry. Statically linked plugins
+// call this during init. Rejects ABI mismatches, duplicate op names
+// and malformed descriptors without registering anything.
+cmx_status cmx_register_plugin(const cmx_plugin_manifest* manifest);
+
+// dlopen a plugin module and absorb its manifest (Linux gateways).
+// Returns ERROR_UNSUPPORTED_OP on targets without dlopen.
+cmx_status cmx_load_plugin_module(const char* path);
+
+// Number of plugin kernels absorbed so far
+size_t cmx_get_plugin_kernel_count();
+
+} // namespace cmx
+
+#endif // CMX_OP_PLUGIN_HPP
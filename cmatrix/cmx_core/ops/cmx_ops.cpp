@@ -1,11 +1,15 @@
 #include "cmx_ops.hpp"
 #include "cmx_op_context.hpp"
 #include "cmx_op_registry.hpp"
+#include "cmx_op_manifest.hpp"
 #include <cstring>
 
 namespace cmx {
 
-// Core operation implementations
+// Core operation implementations. Each one is guarded by its manifest
+// flag: in manifest builds (CMX_USE_KERNEL_MANIFEST) ops the compiled
+// model does not use are excluded from the binary entirely
+#if CMX_NEED_OP_CONV2D
 cmx_status cmx_conv2d_execute(cmx_op_context& ctx) {
     // Basic Conv2D implementation
     if (ctx.input_count != 2 || ctx.output_count != 1) {
@@ -25,7 +29,9 @@ cmx_status cmx_conv2d_execute(cmx_op_context& ctx) {
     // In real implementation, this would call optimized kernels
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_CONV2D
 
+#if CMX_NEED_OP_RELU
 cmx_status cmx_relu_execute(cmx_op_context& ctx) {
     if (ctx.input_count != 1 || ctx.output_count != 1) {
         return cmx_status::ERROR_INVALID_ARGS;
@@ -48,7 +54,9 @@ cmx_status cmx_relu_execute(cmx_op_context& ctx) {
     
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_RELU
 
+#if CMX_NEED_OP_DENSE
 cmx_status cmx_dense_execute(cmx_op_context& ctx) {
     if (ctx.input_count < 2 || ctx.output_count != 1) {
         return cmx_status::ERROR_INVALID_ARGS;
@@ -57,7 +65,9 @@ cmx_status cmx_dense_execute(cmx_op_context& ctx) {
     // Dense layer: Y = X * W + b
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_DENSE
 
+#if CMX_NEED_OP_ADD
 cmx_status cmx_add_execute(cmx_op_context& ctx) {
     if (ctx.input_count != 2 || ctx.output_count != 1) {
         return cmx_status::ERROR_INVALID_ARGS;
@@ -82,7 +92,9 @@ cmx_status cmx_add_execute(cmx_op_context& ctx) {
     
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_ADD
 
+#if CMX_NEED_OP_SUB
 cmx_status cmx_sub_execute(cmx_op_context& ctx) {
     if (ctx.input_count != 2 || ctx.output_count != 1) {
         return cmx_status::ERROR_INVALID_ARGS;
@@ -103,7 +115,9 @@ cmx_status cmx_sub_execute(cmx_op_context& ctx) {
     
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_SUB
 
+#if CMX_NEED_OP_MUL
 cmx_status cmx_mul_execute(cmx_op_context& ctx) {
     if (ctx.input_count != 2 || ctx.output_count != 1) {
         return cmx_status::ERROR_INVALID_ARGS;
@@ -124,7 +138,9 @@ cmx_status cmx_mul_execute(cmx_op_context& ctx) {
     
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_MUL
 
+#if CMX_NEED_OP_DIV
 cmx_status cmx_div_execute(cmx_op_context& ctx) {
     if (ctx.input_count != 2 || ctx.output_count != 1) {
         return cmx_status::ERROR_INVALID_ARGS;
@@ -145,46 +161,63 @@ cmx_status cmx_div_execute(cmx_op_context& ctx) {
     
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_DIV
 
+#if CMX_NEED_OP_MAXPOOL2D
 cmx_status cmx_maxpool2d_execute(cmx_op_context& ctx) {
     // MaxPool2D implementation placeholder
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_MAXPOOL2D
 
+#if CMX_NEED_OP_AVGPOOL2D
 cmx_status cmx_avgpool2d_execute(cmx_op_context& ctx) {
     // AvgPool2D implementation placeholder
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_AVGPOOL2D
 
+#if CMX_NEED_OP_BATCHNORM
 cmx_status cmx_batchnorm_execute(cmx_op_context& ctx) {
     // BatchNorm implementation placeholder
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_BATCHNORM
 
+#if CMX_NEED_OP_SOFTMAX
 cmx_status cmx_softmax_execute(cmx_op_context& ctx) {
     // Softmax implementation placeholder
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_SOFTMAX
 
+#if CMX_NEED_OP_RESHAPE
 cmx_status cmx_reshape_execute(cmx_op_context& ctx) {
     // Reshape implementation placeholder
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_RESHAPE
 
+#if CMX_NEED_OP_TRANSPOSE
 cmx_status cmx_transpose_execute(cmx_op_context& ctx) {
     // Transpose implementation placeholder
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_TRANSPOSE
 
+#if CMX_NEED_OP_CONCAT
 cmx_status cmx_concat_execute(cmx_op_context& ctx) {
     // Concat implementation placeholder
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_CONCAT
 
+#if CMX_NEED_OP_SPLIT
 cmx_status cmx_split_execute(cmx_op_context& ctx) {
     // Split implementation placeholder
     return cmx_status::SUCCESS;
 }
+#endif // CMX_NEED_OP_SPLIT
 
 // Utility functions
 const char* cmx_status_to_string(cmx_status status) {
@@ -196,6 +229,7 @@ const char* cmx_status_to_string(cmx_status status) {
         case cmx_status::ERROR_EXECUTION_FAILED: return "ERROR_EXECUTION_FAILED";
         case cmx_status::ERROR_INVALID_CONTEXT: return "ERROR_INVALID_CONTEXT";
         case cmx_status::ERROR_TENSOR_MISMATCH: return "ERROR_TENSOR_MISMATCH";
+        case cmx_status::ERROR_BUDGET_EXCEEDED: return "ERROR_BUDGET_EXCEEDED";
         default: return "UNKNOWN_ERROR";
     }
 }
@@ -243,38 +277,71 @@ const char* cmx_op_type_to_string(cmx_op_type type) {
 
 // Core operations initialization
 void cmx_init_core_ops() {
-    // Register all core operations
-    cmx_op conv2d_op = {"Conv2D", cmx_conv2d_execute, 2, 1, 0, false, 1};
-    cmx_op relu_op = {"ReLU", cmx_relu_execute, 1, 1, 0, true, 1};
-    cmx_op dense_op = {"Dense", cmx_dense_execute, 2, 1, 0, false, 1};
-    cmx_op add_op = {"Add", cmx_add_execute, 2, 1, 0, false, 1};
-    cmx_op sub_op = {"Sub", cmx_sub_execute, 2, 1, 0, false, 1};
-    cmx_op mul_op = {"Mul", cmx_mul_execute, 2, 1, 0, false, 1};
-    cmx_op div_op = {"Div", cmx_div_execute, 2, 1, 0, false, 1};
-    cmx_op maxpool_op = {"MaxPool2D", cmx_maxpool2d_execute, 1, 1, 0, false, 1};
-    cmx_op avgpool_op = {"AvgPool2D", cmx_avgpool2d_execute, 1, 1, 0, false, 1};
-    cmx_op batchnorm_op = {"BatchNorm", cmx_batchnorm_execute, 3, 1, 0, false, 1};
-    cmx_op softmax_op = {"Softmax", cmx_softmax_execute, 1, 1, 0, false, 1};
-    cmx_op reshape_op = {"Reshape", cmx_reshape_execute, 1, 1, 1, false, 1};
-    cmx_op transpose_op = {"Transpose", cmx_transpose_execute, 1, 1, 1, false, 1};
-    cmx_op concat_op = {"Concat", cmx_concat_execute, 2, 1, 1, false, 1};
-    cmx_op split_op = {"Split", cmx_split_execute, 1, 2, 1, false, 1};
-    
+    // Register the core operations present in this build. Every core
+    // op fully overwrites its outputs, so the executor skips the
+    // defensive output zero-fill. In manifest builds only the ops the
+    // compiled model uses exist, so startup walks a short list instead
+    // of the full catalogue.
+#if CMX_NEED_OP_CONV2D
+    cmx_op conv2d_op = {"Conv2D", cmx_conv2d_execute, 2, 1, 0, false, 1, true};
     cmx_register_op("Conv2D", conv2d_op);
+#endif
+#if CMX_NEED_OP_RELU
+    cmx_op relu_op = {"ReLU", cmx_relu_execute, 1, 1, 0, true, 1, true};
     cmx_register_op("ReLU", relu_op);
+#endif
+#if CMX_NEED_OP_DENSE
+    cmx_op dense_op = {"Dense", cmx_dense_execute, 2, 1, 0, false, 1, true};
     cmx_register_op("Dense", dense_op);
+#endif
+#if CMX_NEED_OP_ADD
+    cmx_op add_op = {"Add", cmx_add_execute, 2, 1, 0, false, 1, true};
     cmx_register_op("Add", add_op);
+#endif
+#if CMX_NEED_OP_SUB
+    cmx_op sub_op = {"Sub", cmx_sub_execute, 2, 1, 0, false, 1, true};
     cmx_register_op("Sub", sub_op);
+#endif
+#if CMX_NEED_OP_MUL
+    cmx_op mul_op = {"Mul", cmx_mul_execute, 2, 1, 0, false, 1, true};
     cmx_register_op("Mul", mul_op);
+#endif
+#if CMX_NEED_OP_DIV
+    cmx_op div_op = {"Div", cmx_div_execute, 2, 1, 0, false, 1, true};
     cmx_register_op("Div", div_op);
+#endif
+#if CMX_NEED_OP_MAXPOOL2D
+    cmx_op maxpool_op = {"MaxPool2D", cmx_maxpool2d_execute, 1, 1, 0, false, 1, true};
     cmx_register_op("MaxPool2D", maxpool_op);
+#endif
+#if CMX_NEED_OP_AVGPOOL2D
+    cmx_op avgpool_op = {"AvgPool2D", cmx_avgpool2d_execute, 1, 1, 0, false, 1, true};
     cmx_register_op("AvgPool2D", avgpool_op);
+#endif
+#if CMX_NEED_OP_BATCHNORM
+    cmx_op batchnorm_op = {"BatchNorm", cmx_batchnorm_execute, 3, 1, 0, false, 1, true};
     cmx_register_op("BatchNorm", batchnorm_op);
+#endif
+#if CMX_NEED_OP_SOFTMAX
+    cmx_op softmax_op = {"Softmax", cmx_softmax_execute, 1, 1, 0, false, 1, true};
     cmx_register_op("Softmax", softmax_op);
+#endif
+#if CMX_NEED_OP_RESHAPE
+    cmx_op reshape_op = {"Reshape", cmx_reshape_execute, 1, 1, 1, false, 1, true};
     cmx_register_op("Reshape", reshape_op);
+#endif
+#if CMX_NEED_OP_TRANSPOSE
+    cmx_op transpose_op = {"Transpose", cmx_transpose_execute, 1, 1, 1, false, 1, true};
     cmx_register_op("Transpose", transpose_op);
+#endif
+#if CMX_NEED_OP_CONCAT
+    cmx_op concat_op = {"Concat", cmx_concat_execute, 2, 1, 1, false, 1, true};
     cmx_register_op("Concat", concat_op);
+#endif
+#if CMX_NEED_OP_SPLIT
+    cmx_op split_op = {"Split", cmx_split_execute, 1, 2, 1, false, 1, true};
     cmx_register_op("Split", split_op);
+#endif
 }
 
 } // namespace cmx
\ No newline at end of file
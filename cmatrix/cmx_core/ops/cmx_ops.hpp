@@ -19,6 +19,10 @@ struct cmx_op {
     uint32_t attr_count;
     bool supports_inplace;
     uint32_t version;
+    // Declares that execute() writes every output element, letting the
+    // executor skip the defensive output zero-fill. Defaults to false
+    // (zero-fill) for ops registered without it.
+    bool writes_all_outputs;
 };
 
 // Core operation types
@@ -60,7 +64,10 @@ enum class cmx_status : uint8_t {
     ERROR_UNSUPPORTED_OP,
     ERROR_EXECUTION_FAILED,
     ERROR_INVALID_CONTEXT,
-    ERROR_TENSOR_MISMATCH
+    ERROR_TENSOR_MISMATCH,
+    ERROR_BUDGET_EXCEEDED,   // Inference aborted by the cycle-budget watchdog
+    SUCCESS_CACHED           // Run skipped by the input-delta gate; the bound
+                             // outputs still hold the previous frame's results
 };
 
 // Core operation implementations
@@ -39,6 +39,10 @@ namespace {
     
     // Platform capabilities (filled during initialization)
     static PlatformCapabilities platform_caps = {};
+
+    // One-shot capability probe result (filled on first get_feature_mask)
+    static uint32_t feature_mask_cache = 0;
+    static bool feature_mask_probed = false;
     
     // Simple timer fallback
     static uint64_t platform_start_time = 0;
@@ -111,7 +115,11 @@ bool deinit_platform() {
     
     // Reset scratch pool
     scratch_pool_offset = 0;
-    
+
+    // Invalidate the capability probe so a re-init re-probes
+    feature_mask_cache = 0;
+    feature_mask_probed = false;
+
     platform_initialized = false;
     
 #ifdef ESP_PLATFORM
@@ -133,6 +141,30 @@ PlatformCapabilities get_platform_capabilities() {
     return platform_caps;
 }
 
+// Not weak: the probe derives from get_platform_capabilities(), so port
+// overrides of that function feed through here without reimplementing
+// the fold
+uint32_t get_feature_mask() {
+    if (!feature_mask_probed) {
+        if (!is_platform_initialized()) {
+            return 0;
+        }
+
+        const PlatformCapabilities caps = get_platform_capabilities();
+        uint32_t mask = 0;
+        if (caps.has_fpu)         mask |= CMX_FEATURE_FPU;
+        if (caps.has_dsp)         mask |= CMX_FEATURE_DSP;
+        if (caps.has_vector_unit) mask |= CMX_FEATURE_VECTOR;
+        if (caps.has_dma)         mask |= CMX_FEATURE_DMA;
+        if (caps.has_cache)       mask |= CMX_FEATURE_CACHE;
+
+        feature_mask_cache = mask;
+        feature_mask_probed = true;
+    }
+
+    return feature_mask_cache;
+}
+
 // =============================================================================
 // TIMING AND PROFILING - Weak implementations
 // =============================================================================
@@ -574,6 +606,76 @@ bool atomic_compare_swap_32(volatile uint32_t* ptr, uint32_t expected, uint32_t
 #endif
 }
 
+__attribute__((weak))
+uint32_t atomic_fetch_add_32(volatile uint32_t* ptr, uint32_t value) {
+#ifdef __ARM_ARCH
+    uint32_t old_value;
+    uint32_t new_value;
+    uint32_t status;
+
+    __asm__ volatile (
+        "1: ldrex %0, %3\n"
+        "   add %1, %0, %4\n"
+        "   strex %2, %1, %3\n"
+        "   cmp %2, #0\n"
+        "   bne 1b"
+        : "=&r" (old_value), "=&r" (new_value), "=&r" (status), "+m" (*ptr)
+        : "r" (value)
+        : "cc", "memory"
+    );
+
+    return old_value;
+#elif defined(__riscv)
+    // RISC-V amoadd via the builtin (A extension where available)
+    return __atomic_fetch_add(ptr, value, __ATOMIC_SEQ_CST);
+#else
+    // Generic atomic operations
+    return __atomic_fetch_add(ptr, value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+__attribute__((weak))
+void memory_fence_acquire() {
+#ifdef __ARM_ARCH
+    __asm__ volatile ("dmb ish" ::: "memory");
+#elif defined(__riscv)
+    __asm__ volatile ("fence r, rw" ::: "memory");
+#else
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#endif
+}
+
+__attribute__((weak))
+void memory_fence_release() {
+#ifdef __ARM_ARCH
+    __asm__ volatile ("dmb ish" ::: "memory");
+#elif defined(__riscv)
+    __asm__ volatile ("fence rw, w" ::: "memory");
+#else
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
+}
+
+// =============================================================================
+// ARITHMETIC PRIMITIVES - Weak implementations
+// =============================================================================
+
+__attribute__((weak))
+int32_t mac_s32(int32_t acc, int32_t a, int32_t b) {
+    // Generic multiply-accumulate; ports with a hardware MAC override this
+    return acc + a * b;
+}
+
+__attribute__((weak))
+int32_t dot_product_s8(const int8_t* a, const int8_t* b, int32_t count, int32_t a_offset) {
+    // Scalar reference loop, identical to the kernels' fallback path
+    int32_t acc = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        acc += (static_cast<int32_t>(a[i]) - a_offset) * static_cast<int32_t>(b[i]);
+    }
+    return acc;
+}
+
 // =============================================================================
 // UTILITY FUNCTIONS
 // =============================================================================
@@ -98,14 +98,39 @@ bool is_platform_initialized();
 
 /**
  * @brief Get platform capabilities
- * 
+ *
  * Returns information about hardware capabilities available on this platform.
  * Used by the runtime to optimize operations based on available features.
- * 
+ *
  * @return PlatformCapabilities structure with hardware information
  */
 PlatformCapabilities get_platform_capabilities();
 
+/**
+ * @brief Platform feature bits for the startup capability probe
+ *
+ * Compact bitmask form of PlatformCapabilities for dispatch code that
+ * tests features on a hot path. Kept in sync with the bool fields above.
+ */
+constexpr uint32_t CMX_FEATURE_FPU    = 1u << 0;  // Hardware floating point unit
+constexpr uint32_t CMX_FEATURE_DSP    = 1u << 1;  // DSP instruction extension
+constexpr uint32_t CMX_FEATURE_VECTOR = 1u << 2;  // Vector/SIMD processing unit
+constexpr uint32_t CMX_FEATURE_DMA    = 1u << 3;  // DMA controller
+constexpr uint32_t CMX_FEATURE_CACHE  = 1u << 4;  // Data cache present
+
+/**
+ * @brief Get the cached platform feature bitmask
+ *
+ * The capabilities are probed once, on the first call after
+ * init_platform(), and folded into a static CMX_FEATURE_* bitmask.
+ * Subsequent calls are a plain load, so kernel selection can consult
+ * the mask per node at plan build without re-querying the hardware.
+ * Returns 0 while the platform is uninitialized.
+ *
+ * @return Bitwise OR of CMX_FEATURE_* flags
+ */
+uint32_t get_feature_mask();
+
 // =============================================================================
 // TIMING AND PROFILING
 // =============================================================================
@@ -245,14 +270,45 @@ void prefetch_data(const void* ptr, size_t size);
 
 /**
  * @brief Clean and invalidate cache for memory range
- * 
+ *
  * Combines flush and invalidate operations for cache coherency.
- * 
+ *
  * @param ptr Pointer to memory range
  * @param size Size of memory range in bytes
  */
 void clean_invalidate_cache(const void* ptr, size_t size);
 
+/**
+ * @brief Compile-time cache line size in bytes
+ *
+ * Default of 32 covers the M7/A-profile parts we ship on; override
+ * with -DCMX_CACHE_LINE_SIZE for targets with wider lines. Use this
+ * for prefetch strides and padding; the runtime-detected value stays
+ * in PlatformCapabilities::cache_line_size.
+ */
+#ifndef CMX_CACHE_LINE_SIZE
+#define CMX_CACHE_LINE_SIZE 32
+#endif
+constexpr size_t CACHE_LINE_SIZE = CMX_CACHE_LINE_SIZE;
+
+/**
+ * @brief Single-line prefetch hint
+ *
+ * Inline (unlike prefetch_data) so hot kernel loops can issue one
+ * hint per iteration without a function call. Compiles to the
+ * architecture's prefetch instruction where one exists and to nothing
+ * elsewhere, so call sites need no guards.
+ *
+ * @param ptr Address to pull into cache
+ */
+inline void prefetch(const void* ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr);
+#else
+    (void)ptr;
+#endif
+}
+
 // =============================================================================
 // DMA OPERATIONS
 // =============================================================================
@@ -435,7 +491,7 @@ void atomic_store_32(volatile uint32_t* ptr, uint32_t value);
 
 /**
  * @brief Atomic compare and swap (32-bit)
- * 
+ *
  * @param ptr Pointer to 32-bit value
  * @param expected Expected current value
  * @param desired Desired new value
@@ -443,5 +499,67 @@ void atomic_store_32(volatile uint32_t* ptr, uint32_t value);
  */
 bool atomic_compare_swap_32(volatile uint32_t* ptr, uint32_t expected, uint32_t desired);
 
+/**
+ * @brief Atomic fetch-and-add (32-bit)
+ *
+ * Single-word counter updates without masking interrupts; use this
+ * instead of CriticalSection for statistics and ready counts touched
+ * from ISRs.
+ *
+ * @param ptr Pointer to 32-bit value
+ * @param value Amount to add
+ * @return Value before the addition
+ */
+uint32_t atomic_fetch_add_32(volatile uint32_t* ptr, uint32_t value);
+
+/**
+ * @brief Acquire fence
+ *
+ * Orders the fence before all subsequent loads and stores; pairs with
+ * memory_fence_release for publish/consume handoffs.
+ */
+void memory_fence_acquire();
+
+/**
+ * @brief Release fence
+ *
+ * Orders all previous loads and stores before the fence.
+ */
+void memory_fence_release();
+
+// =============================================================================
+// ARITHMETIC PRIMITIVES
+// =============================================================================
+
+/**
+ * @brief Multiply-accumulate primitive (32-bit)
+ *
+ * Computes acc + a * b. The weak default is a plain multiply; ports
+ * whose hardware offers a faster path (e.g. a Nios II custom
+ * instruction) override it at link time. Kernels opt in with the
+ * CMX_USE_PLATFORM_MAC build flag so other backends pay nothing.
+ *
+ * @param acc Running accumulator
+ * @param a First multiplicand
+ * @param b Second multiplicand
+ * @return Updated accumulator
+ */
+int32_t mac_s32(int32_t acc, int32_t a, int32_t b);
+
+/**
+ * @brief Offset-corrected int8 dot product primitive
+ *
+ * Computes sum((a[i] - a_offset) * b[i]) — the inner loop of the
+ * quantized dense/conv kernels. The weak default is the scalar loop;
+ * ports route the per-element multiply through their MAC primitive.
+ *
+ * @param a First operand (e.g. input activations)
+ * @param b Second operand (e.g. weights)
+ * @param count Element count
+ * @param a_offset Zero point subtracted from every element of a
+ * @return 32-bit accumulated dot product
+ */
+int32_t dot_product_s8(const int8_t* a, const int8_t* b, int32_t count, int32_t a_offset);
+
 } // namespace platform
 } // namespace cmx
\ No newline at end of file
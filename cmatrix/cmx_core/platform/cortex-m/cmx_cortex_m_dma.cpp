@@ -1,4 +1,5 @@
 #include "cmx_cortex_m_port.hpp"
+#include "../../runtime/cmx_dma.hpp"
 #include <cstdint>
 #include <cstring>
 
@@ -56,6 +57,11 @@ namespace {
     constexpr uint32_t DMA_SxCR_DIR_M2M = (2 << 6);   // Memory-to-memory direction
     constexpr uint32_t DMA_SxCR_MINC = (1 << 10);     // Memory increment mode
     constexpr uint32_t DMA_SxCR_PINC = (1 << 9);      // Peripheral increment mode
+    constexpr uint32_t DMA_SxCR_PL_SHIFT = 16;        // Priority level bits [17:16]
+
+    // Stream priority applied to new transfers, inherited from the
+    // runtime's current DMA request priority (see apply_runtime_priority)
+    uint8_t g_dma_hw_priority = 1;  // NORMAL
     
     /**
      * @brief Get DMA stream base address
@@ -81,6 +87,7 @@ namespace {
         
         // Configure control register
         uint32_t cr_value = DMA_SxCR_DIR_M2M | DMA_SxCR_MINC | DMA_SxCR_PINC;
+        cr_value |= static_cast<uint32_t>(g_dma_hw_priority & 0x3) << DMA_SxCR_PL_SHIFT;
         if (transfer.callback) {
             cr_value |= DMA_SxCR_TCIE;  // Enable transfer complete interrupt
         }
@@ -92,6 +99,17 @@ namespace {
         *((volatile uint32_t*)(stream_base + DMA_SxNDTR_OFFSET)) = transfer.size;
     }
     
+    /**
+     * @brief Runtime priority hook for cmx_dma_register_priority_backend
+     *
+     * TaskPriority levels map one-to-one onto the stream priority-level
+     * field (00 low .. 11 very high), so a CRITICAL model's transfers
+     * win arbitration at the controller over background streaming.
+     */
+    void apply_runtime_priority(runtime::CMXDmaPriority priority) {
+        g_dma_hw_priority = static_cast<uint8_t>(priority);
+    }
+
     /**
      * @brief Start DMA transfer
      */
@@ -122,7 +140,10 @@ bool dma_init() {
     
     // Configure NVIC for DMA interrupts
     // Platform-specific interrupt setup would go here
-    
+
+    // Let the runtime's request priority reach the stream arbiter
+    runtime::cmx_dma_register_priority_backend(&apply_runtime_priority);
+
     g_dma_initialized = true;
     return true;
 }
@@ -142,7 +163,9 @@ void dma_deinit() {
             *cr_reg &= ~DMA_SxCR_EN;
         }
     }
-    
+
+    runtime::cmx_dma_register_priority_backend(nullptr);
+
     g_dma_initialized = false;
 }
 
@@ -208,6 +231,92 @@ bool cmx_dma_copy_sync(void* dst, const void* src, size_t size) {
     return true;
 }
 
+/**
+ * @brief Synchronous 2D strided DMA copy
+ *
+ * Copies row_count rows of row_bytes each, advancing the source by
+ * src_stride and the destination by dst_stride between rows. The
+ * STM32-style stream DMA has no native 2D mode, so one channel is held
+ * for the whole transfer and re-programmed per row; this still beats
+ * CPU loops for the layout conversions (channel slices, im2col
+ * gathers, de-padding) and leaves the core free between rows.
+ *
+ * @param dst Destination of the first row
+ * @param dst_stride Destination row-to-row stride in bytes
+ * @param src Source of the first row
+ * @param src_stride Source row-to-row stride in bytes
+ * @param row_bytes Number of contiguous bytes per row
+ * @param row_count Number of rows
+ * @return True if the whole transfer completed successfully
+ */
+bool cmx_dma_copy_2d_sync(void* dst, size_t dst_stride,
+                          const void* src, size_t src_stride,
+                          size_t row_bytes, size_t row_count) {
+    if (!g_dma_initialized || !dst || !src || row_bytes == 0 || row_count == 0) {
+        return false;
+    }
+
+    // Find available DMA channel
+    size_t channel = MAX_DMA_CHANNELS;
+    uint32_t mask = enter_critical();
+
+    for (size_t i = 0; i < MAX_DMA_CHANNELS; i++) {
+        if (!g_dma_transfers[i].active) {
+            channel = i;
+            g_dma_transfers[i].active = true;
+            break;
+        }
+    }
+
+    exit_critical(mask);
+
+    uint8_t* dst_row = static_cast<uint8_t*>(dst);
+    const uint8_t* src_row = static_cast<const uint8_t*>(src);
+
+    if (channel >= MAX_DMA_CHANNELS) {
+        // No available channels - fall back to a CPU row loop
+        for (size_t row = 0; row < row_count; row++) {
+            memcpy(dst_row, src_row, row_bytes);
+            dst_row += dst_stride;
+            src_row += src_stride;
+        }
+        return true;
+    }
+
+    DmaTransfer& transfer = g_dma_transfers[channel];
+    transfer.callback = nullptr;
+    transfer.user_data = nullptr;
+
+    uint8_t controller = channel / 8;
+    uint8_t stream = channel % 8;
+
+    uint32_t stream_base = get_dma_stream_base(controller, stream);
+    volatile uint32_t* ndtr_reg = (volatile uint32_t*)(stream_base + DMA_SxNDTR_OFFSET);
+
+    // Re-program the held stream once per row
+    for (size_t row = 0; row < row_count; row++) {
+        transfer.src = const_cast<uint8_t*>(src_row);
+        transfer.dst = dst_row;
+        transfer.size = row_bytes;
+
+        configure_dma_stream(controller, stream, transfer);
+        start_dma_transfer(controller, stream);
+
+        while (*ndtr_reg > 0) {
+            // Busy wait - could yield to scheduler here in RTOS environment
+            __NOP();
+        }
+
+        dst_row += dst_stride;
+        src_row += src_stride;
+    }
+
+    // Clear transfer descriptor
+    transfer.active = false;
+
+    return true;
+}
+
 /**
  * @brief Asynchronous DMA memory copy
  * @param dst Destination buffer
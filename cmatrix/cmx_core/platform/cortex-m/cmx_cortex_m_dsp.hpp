@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <arm_acle.h>
+#define CMX_HAVE_DSP_EXT 1
+#endif
+
+namespace cmx {
+namespace platform {
+namespace cortex_m {
+
+/**
+ * @brief DSP-extension primitives for the int16 kernel inner loops
+ *
+ * Cortex-M4/M7 (and M33 with the DSP extension) execute two 16x16 MACs
+ * per cycle through the packed SMLAD/SMLALD instructions; these helpers
+ * wrap them for the int16 dense/conv reference loops. SMLALD feeds a
+ * 64-bit accumulator, which int16 audio-length rows need: a single
+ * 16x16 product already fills 30 bits, so the int32 accumulator the
+ * int8 path uses would wrap after a handful of MACs.
+ *
+ * The kernels guard their call sites with CMX_USE_DSP_EXT (build flag,
+ * same convention as CMX_USE_HELIUM / CMX_USE_HIFI); this header
+ * additionally requires the DSP extension in the compile target
+ * (__ARM_FEATURE_DSP) and otherwise provides scalar fallbacks with
+ * identical semantics, so a binary built with the flag still runs on
+ * M0/M23-class parts.
+ */
+
+/**
+ * @brief int16 dot product on the dual 16-bit MAC pipeline
+ *
+ * Consumes both operands as packed 16x2 words, two MACs per SMLALD
+ * into a 64-bit accumulator. The packed loads go through memcpy so
+ * unaligned rows stay defined behavior; the compiler lowers them to
+ * single LDR instructions.
+ *
+ * @param a First operand (e.g. input activations)
+ * @param b Second operand (e.g. weights)
+ * @param count Element count
+ * @return 64-bit accumulated dot product
+ */
+inline int64_t dsp_dot_s16(const int16_t* a, const int16_t* b, int32_t count) {
+#ifdef CMX_HAVE_DSP_EXT
+    int64_t acc = 0;
+    int32_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        uint32_t pa;
+        uint32_t pb;
+        std::memcpy(&pa, a + i, sizeof(pa));
+        std::memcpy(&pb, b + i, sizeof(pb));
+        acc = __smlald(pa, pb, acc);
+    }
+    if (i < count) {
+        acc += static_cast<int64_t>(a[i]) * static_cast<int64_t>(b[i]);
+    }
+    return acc;
+#else
+    int64_t acc = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        acc += static_cast<int64_t>(a[i]) * static_cast<int64_t>(b[i]);
+    }
+    return acc;
+#endif
+}
+
+} // namespace cortex_m
+} // namespace platform
+} // namespace cmx
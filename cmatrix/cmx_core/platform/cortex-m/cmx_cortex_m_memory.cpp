@@ -23,6 +23,15 @@ static uint8_t num_memory_regions = 0;
 // Default memory regions for common Cortex-M layouts
 static uint8_t static_tensor_arena[65536] __attribute__((aligned(32)));
 
+// Per-tier bump allocators over BSP-configured windows (DTCM, ITCM,
+// SRAM, SDRAM). Unconfigured tiers have size 0 and are skipped.
+static constexpr uint8_t TIER_COUNT = 4;
+static uint8_t* tier_base[TIER_COUNT] = {nullptr, nullptr, nullptr, nullptr};
+static size_t tier_size[TIER_COUNT] = {0, 0, 0, 0};
+static size_t tier_used[TIER_COUNT] = {0, 0, 0, 0};
+
+static const char* const tier_names[TIER_COUNT] = {"DTCM", "ITCM", "SRAM", "SDRAM"};
+
 bool Memory::init(size_t arena_size) {
     if (memory_initialized) {
         return true;
@@ -46,7 +55,8 @@ bool Memory::init(size_t arena_size) {
         .size = tensor_arena_size,
         .is_cacheable = false,
         .is_dma_coherent = true,
-        .name = "SRAM_TENSOR_ARENA"
+        .name = "SRAM_TENSOR_ARENA",
+        .tier = MemoryTier::SRAM
     };
     register_memory_region(sram_region);
     
@@ -63,6 +73,11 @@ void Memory::deinit() {
     tensor_arena_size = 0;
     tensor_arena_used = 0;
     num_memory_regions = 0;
+    for (uint8_t i = 0; i < TIER_COUNT; i++) {
+        tier_base[i] = nullptr;
+        tier_size[i] = 0;
+        tier_used[i] = 0;
+    }
     memory_initialized = false;
 }
 
@@ -113,6 +128,86 @@ size_t Memory::get_free_arena_space() {
     return tensor_arena_size - tensor_arena_used;
 }
 
+bool Memory::configure_tier(MemoryTier tier, void* base, size_t size) {
+    uint8_t index = static_cast<uint8_t>(tier);
+    if (index >= TIER_COUNT || !base || size == 0) {
+        return false;
+    }
+
+    tier_base[index] = static_cast<uint8_t*>(base);
+    tier_size[index] = size;
+    tier_used[index] = 0;
+
+    // TCMs bypass the cache and DTCM is reachable by DMA through the
+    // AHBS slave port on most M7 parts; ITCM generally is not.
+    MemoryRegion region = {
+        .base_address = base,
+        .size = size,
+        .is_cacheable = (tier == MemoryTier::SRAM || tier == MemoryTier::SDRAM),
+        .is_dma_coherent = (tier == MemoryTier::DTCM),
+        .name = tier_names[index],
+        .tier = tier
+    };
+    register_memory_region(region);
+
+    return true;
+}
+
+void* Memory::allocate_from_tier(MemoryTier tier, size_t size, MemoryAlignment alignment) {
+    if (size == 0) {
+        return nullptr;
+    }
+
+    size_t align_value = static_cast<size_t>(alignment);
+
+    // Spill from the requested tier towards slower ones
+    for (uint8_t index = static_cast<uint8_t>(tier); index < TIER_COUNT; index++) {
+        if (tier_size[index] == 0) {
+            continue;
+        }
+
+        void* current_pos = tier_base[index] + tier_used[index];
+        void* aligned_pos = align_pointer(current_pos, align_value);
+        size_t aligned_offset = static_cast<uint8_t*>(aligned_pos) - tier_base[index];
+
+        if (aligned_offset + size <= tier_size[index]) {
+            tier_used[index] = aligned_offset + size;
+            return aligned_pos;
+        }
+    }
+
+    // Final fallback: the tensor arena, so callers work unchanged on
+    // parts with no tier windows configured
+    return allocate_aligned(size, alignment);
+}
+
+size_t Memory::get_tier_free_space(MemoryTier tier) {
+    uint8_t index = static_cast<uint8_t>(tier);
+    if (index >= TIER_COUNT || tier_size[index] == 0) {
+        return 0;
+    }
+    return tier_size[index] - tier_used[index];
+}
+
+void Memory::reset_tiers() {
+    for (uint8_t i = 0; i < TIER_COUNT; i++) {
+        tier_used[i] = 0;
+    }
+}
+
+MemoryTier Memory::tier_of(const void* address) {
+    if (address) {
+        uintptr_t addr = reinterpret_cast<uintptr_t>(address);
+        for (uint8_t i = 0; i < num_memory_regions; i++) {
+            uintptr_t region_start = reinterpret_cast<uintptr_t>(memory_regions[i].base_address);
+            if (addr >= region_start && addr < region_start + memory_regions[i].size) {
+                return memory_regions[i].tier;
+            }
+        }
+    }
+    return MemoryTier::SRAM;
+}
+
 void Memory::fast_copy(void* dest, const void* src, size_t size) {
     if (!dest || !src || size == 0) {
         return;
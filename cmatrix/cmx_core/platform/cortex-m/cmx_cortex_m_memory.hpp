@@ -7,6 +7,22 @@ namespace cmx {
 namespace platform {
 namespace cortex_m {
 
+/**
+ * @brief Memory tiers ordered fastest to slowest
+ *
+ * On Cortex-M7 parts DTCM is single-cycle for the random-access
+ * patterns of conv kernels, while system SRAM goes through the AXI bus
+ * and external SDRAM is slower still. Tier indices are ordered so an
+ * allocation that does not fit its requested tier can spill to the
+ * next higher index.
+ */
+enum class MemoryTier : uint8_t {
+    DTCM = 0,   ///< Data TCM (tightly coupled, single-cycle)
+    ITCM = 1,   ///< Instruction TCM (data-usable on some parts)
+    SRAM = 2,   ///< On-chip system SRAM (AXI)
+    SDRAM = 3   ///< External SDRAM via FMC
+};
+
 /**
  * @brief Memory region configuration
  */
@@ -16,6 +32,7 @@ struct MemoryRegion {
     bool is_cacheable;     ///< Whether region is cacheable
     bool is_dma_coherent;  ///< Whether region is DMA coherent
     const char* name;      ///< Human-readable name for debugging
+    MemoryTier tier = MemoryTier::SRAM;  ///< Performance tier of the region
 };
 
 /**
@@ -109,6 +126,59 @@ public:
      */
     static int fast_compare(const void* ptr1, const void* ptr2, size_t size);
     
+    /**
+     * @brief Bind a memory tier to a BSP-supplied address window
+     *
+     * TCM and SDRAM windows are part-specific, so the BSP passes their
+     * linker-provided base and size here instead of hand-placing
+     * buffers with section attributes. The window is also registered
+     * as a memory region. Re-configuring a tier resets its allocation
+     * pointer.
+     *
+     * @param tier Tier to bind
+     * @param base Base address of the tier's window
+     * @param size Window size in bytes
+     * @return true if the tier was configured
+     */
+    static bool configure_tier(MemoryTier tier, void* base, size_t size);
+
+    /**
+     * @brief Allocate a buffer from the fastest available tier
+     *
+     * Tries the requested tier first and spills to slower tiers when
+     * it is full, so hot buffers (im2col workspace, the current
+     * layer's activations) land in DTCM and cold tensors fall back to
+     * SRAM/SDRAM. The tensor arena is the final fallback, making this
+     * safe on parts with no TCM configured.
+     *
+     * @param tier Preferred (fastest acceptable) tier
+     * @param size Size in bytes to allocate
+     * @param alignment Memory alignment requirement
+     * @return Pointer to allocated buffer, nullptr if no tier fits
+     */
+    static void* allocate_from_tier(MemoryTier tier, size_t size,
+                                    MemoryAlignment alignment = MemoryAlignment::BYTE_4);
+
+    /**
+     * @brief Get remaining free space in a tier's window
+     * @param tier Tier to query
+     * @return Free bytes, 0 if the tier is not configured
+     */
+    static size_t get_tier_free_space(MemoryTier tier);
+
+    /**
+     * @brief Reset allocation pointers of all configured tiers
+     * Allows per-layer reuse of tier space alongside reset_arena()
+     */
+    static void reset_tiers();
+
+    /**
+     * @brief Find the tier containing an address
+     * @param address Address to classify
+     * @return Tier of the enclosing region, SRAM if unknown
+     */
+    static MemoryTier tier_of(const void* address);
+
     /**
      * @brief Register external memory region
      * @param region Memory region configuration
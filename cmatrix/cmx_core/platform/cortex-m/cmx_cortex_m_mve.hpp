@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+#include <arm_mve.h>
+#define CMX_HAVE_HELIUM 1
+#endif
+
+namespace cmx {
+namespace platform {
+namespace cortex_m {
+
+/**
+ * @brief Helium (MVE) primitives for the int8 kernel inner loops
+ *
+ * Cortex-M55/M85 execute 128-bit vector MACs; these helpers wrap the
+ * MVE intrinsics the quantized conv/dense reference loops need, 16
+ * int8 lanes per operation with tail handling through predication
+ * rather than scalar epilogues. Everything is header-inline because
+ * the call sites are the innermost loops.
+ *
+ * The kernels guard their call sites with CMX_USE_HELIUM (build flag,
+ * same convention as CMX_USE_CMSIS_NN); this header additionally
+ * requires integer MVE in the compile target (__ARM_FEATURE_MVE bit 0)
+ * and otherwise provides scalar fallbacks with identical semantics, so
+ * a binary built with the flag still runs on vectorless M-profile
+ * parts.
+ */
+
+/**
+ * @brief Offset-corrected int8 dot product
+ *
+ * Computes sum((a[i] - a_offset) * b[i]) as dot(a, b) minus
+ * a_offset * sum(b), keeping the offset correction out of the MAC
+ * loop: one vmladavaq plus one vaddvaq per 16 lanes.
+ *
+ * @param a First operand (e.g. input activations)
+ * @param b Second operand (e.g. weights)
+ * @param count Element count
+ * @param a_offset Zero point subtracted from every element of a
+ * @return 32-bit accumulated dot product
+ */
+inline int32_t mve_dot_s8(const int8_t* a, const int8_t* b, int32_t count,
+                          int32_t a_offset) {
+#ifdef CMX_HAVE_HELIUM
+    int32_t dot = 0;
+    int32_t b_sum = 0;
+    for (int32_t i = 0; i < count; i += 16) {
+        const mve_pred16_t p = vctp8q(static_cast<uint32_t>(count - i));
+        const int8x16_t va = vldrbq_z_s8(a + i, p);
+        const int8x16_t vb = vldrbq_z_s8(b + i, p);
+        dot = vmladavaq_p_s8(dot, va, vb, p);
+        b_sum = vaddvaq_p_s8(b_sum, vb, p);
+    }
+    return dot - a_offset * b_sum;
+#else
+    int32_t acc = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        acc += (static_cast<int32_t>(a[i]) - a_offset) *
+               static_cast<int32_t>(b[i]);
+    }
+    return acc;
+#endif
+}
+
+/**
+ * @brief int16 dot product with a 64-bit accumulator
+ *
+ * Eight 16-bit lanes per beat through vmlaldavaq, which widens into a
+ * 64-bit accumulator; int16 audio-length rows overflow int32, so the
+ * int8 helper's accumulator discipline does not carry over here.
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param count Element count
+ * @return 64-bit accumulated dot product
+ */
+inline int64_t mve_dot_s16(const int16_t* a, const int16_t* b, int32_t count) {
+#ifdef CMX_HAVE_HELIUM
+    int64_t acc = 0;
+    for (int32_t i = 0; i < count; i += 8) {
+        const mve_pred16_t p = vctp16q(static_cast<uint32_t>(count - i));
+        const int16x8_t va = vldrhq_z_s16(a + i, p);
+        const int16x8_t vb = vldrhq_z_s16(b + i, p);
+        acc = vmlaldavaq_p_s16(acc, va, vb, p);
+    }
+    return acc;
+#else
+    int64_t acc = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        acc += static_cast<int64_t>(a[i]) * static_cast<int64_t>(b[i]);
+    }
+    return acc;
+#endif
+}
+
+/**
+ * @brief Elementwise int8 maximum folded into an accumulator row
+ *
+ * acc[i] = max(acc[i], src[i]) over count elements; the max-pooling
+ * window reduction expressed one row at a time.
+ *
+ * @param acc Accumulator row, updated in place
+ * @param src Source row
+ * @param count Element count
+ */
+inline void mve_max_s8(int8_t* acc, const int8_t* src, int32_t count) {
+#ifdef CMX_HAVE_HELIUM
+    for (int32_t i = 0; i < count; i += 16) {
+        const mve_pred16_t p = vctp8q(static_cast<uint32_t>(count - i));
+        const int8x16_t va = vldrbq_z_s8(acc + i, p);
+        const int8x16_t vs = vldrbq_z_s8(src + i, p);
+        vstrbq_p_s8(acc + i, vmaxq_s8(va, vs), p);
+    }
+#else
+    for (int32_t i = 0; i < count; ++i) {
+        if (src[i] > acc[i]) {
+            acc[i] = src[i];
+        }
+    }
+#endif
+}
+
+} // namespace cortex_m
+} // namespace platform
+} // namespace cmx
@@ -1,4 +1,5 @@
 #include "cmx_cortex_m_timer.hpp"
+#include "../../runtime/cmx_profiler.hpp"
 
 #ifdef __arm__
 #include "cmsis_gcc.h"
@@ -246,10 +247,56 @@ uint32_t Timer::get_resolution_us() {
         return 1; // 1μs resolution
     }
 #endif
-    
+
     return 1000; // 1ms resolution via SysTick
 }
 
+#ifdef __arm__
+/**
+ * @brief Read DWT->CYCCNT extended to 64 bits
+ *
+ * CYCCNT is 32-bit and wraps every few seconds at core clock rates;
+ * the profiler reads the clock far more often than that, so detecting
+ * a single wrap between reads is sufficient.
+ */
+static uint64_t dwt_cycle_count() {
+    static uint32_t last_cyccnt = 0;
+    static uint64_t wrap_offset = 0;
+
+    uint32_t current = DWT->CYCCNT;
+    if (current < last_cyccnt) {
+        wrap_offset += 0x100000000ULL;
+    }
+    last_cyccnt = current;
+
+    return wrap_offset + current;
+}
+#endif
+
+bool Timer::register_profiler_clock(uint32_t cpu_freq_hz) {
+    if (cpu_freq_hz == 0) {
+        return false;
+    }
+
+#ifdef __arm__
+    // Enable trace and the cycle counter
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // Parts without DWT (Cortex-M0/M0+) ignore the enable write
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        return false;
+    }
+
+    cmx::runtime::HighResTimer::set_platform_clock(&dwt_cycle_count, cpu_freq_hz);
+    return true;
+#else
+    (void)cpu_freq_hz;
+    return false;
+#endif
+}
+
 bool Timer::is_initialized() {
     return timer_initialized;
 }
@@ -99,6 +99,20 @@ public:
      * @return Timer resolution (e.g., 1 for 1μs resolution)
      */
     static uint32_t get_resolution_us();
+
+    /**
+     * @brief Route the runtime profiler through the DWT cycle counter
+     *
+     * Enables DWT->CYCCNT and registers it as the profiling clock, so
+     * per-op timings are cycle-accurate and reading the clock is a
+     * single register read instead of the SysTick-derived microsecond
+     * math. The 32-bit counter is extended to 64 bits across wraps.
+     *
+     * @param cpu_freq_hz Core clock frequency in Hz
+     * @return true if the cycle counter was enabled and registered
+     *         (fails on parts without DWT, e.g. Cortex-M0)
+     */
+    static bool register_profiler_clock(uint32_t cpu_freq_hz);
     
     /**
      * @brief Check if timer subsystem is initialized
@@ -1,4 +1,5 @@
 #include "cmx_esp32_dma.hpp"
+#include "../../runtime/cmx_dma.hpp"
 
 // ESP-IDF includes
 #include "driver/gdma.h"
@@ -20,6 +21,16 @@ namespace esp32 {
 
 static const char* TAG = "CMX_ESP32_DMA";
 
+// Channel arbitration priority inherited from the runtime's current
+// DMA request priority (see cmx_dma_register_priority_backend). New
+// channels fold it into their configured priority so a CRITICAL
+// model's channels outrank background weight streaming.
+static uint32_t g_runtime_channel_priority = 1;  // NORMAL
+
+static void apply_runtime_priority(runtime::CMXDmaPriority priority) {
+    g_runtime_channel_priority = static_cast<uint32_t>(priority);
+}
+
 // Static member definitions
 bool ESP32DMA::initialized_ = false;
 
@@ -38,6 +49,9 @@ DMAStatus ESP32DMA::initialize() {
         return DMAStatus::ERROR_INIT_FAILED;
     }
     
+    // Let the runtime's request priority reach new channels
+    runtime::cmx_dma_register_priority_backend(&apply_runtime_priority);
+
     initialized_ = true;
     ESP_LOGI(TAG, "DMA subsystem initialized successfully");
     return DMAStatus::SUCCESS;
@@ -49,6 +63,7 @@ DMAStatus ESP32DMA::shutdown() {
     }
     
     ESP_LOGI(TAG, "Shutting down DMA subsystem");
+    runtime::cmx_dma_register_priority_backend(nullptr);
     initialized_ = false;
     return DMAStatus::SUCCESS;
 }
@@ -73,7 +88,11 @@ DMAChannel::DMAChannel(const DMAConfig& config)
         ESP_LOGE(TAG, "DMA subsystem not initialized");
         return;
     }
-    
+
+    // Inherit the runtime request priority; never lower an explicitly
+    // configured level
+    config_.priority = std::max(config_.priority, g_runtime_channel_priority);
+
     if (configure_channel() == DMAStatus::SUCCESS) {
         initialized_ = true;
         ESP_LOGI(TAG, "DMA channel %d initialized", config_.channel_id);
@@ -1,4 +1,6 @@
 #include "cmx_esp32_memory.hpp"
+#include "cmx_esp32_dma.hpp"
+#include <cstring>
 
 #ifdef ESP_PLATFORM
 #include "esp_heap_caps.h"
@@ -323,6 +325,13 @@ bool MemoryManager::is_psram(const void* ptr) {
 #endif
 }
 
+MemoryRegion MemoryManager::region_of(const void* ptr) {
+    if (ptr && is_psram(ptr)) {
+        return MemoryRegion::PSRAM;
+    }
+    return MemoryRegion::INTERNAL_RAM;
+}
+
 MemoryRegion MemoryManager::get_optimal_region(size_t size, const MemoryAttributes& attributes) {
     if (!initialized_) {
         initialize();
@@ -414,6 +423,144 @@ void MemoryManager::print_memory_stats() {
 #endif
 }
 
+// WorkingSetPromoter implementation
+
+namespace {
+
+// Two internal-RAM staging slots: the current layer computes out of one
+// while the next layer's working set streams into the other
+void* g_promoter_slots[2] = {nullptr, nullptr};
+size_t g_promoter_slot_size = 0;
+uint8_t g_promoter_current = 0;
+bool g_promoter_initialized = false;
+
+// Pending prefetch into the non-current slot
+bool g_prefetch_pending = false;
+size_t g_prefetch_size = 0;
+
+DMAChannel* g_promoter_channel = nullptr;
+
+} // namespace
+
+bool WorkingSetPromoter::init(size_t slot_size) {
+    if (g_promoter_initialized) {
+        return true;
+    }
+    if (slot_size == 0) {
+        return false;
+    }
+
+    // Slots must be internal and DMA-reachable so GDMA can fill them
+    // straight from PSRAM
+    MemoryAttributes attributes;
+    attributes.prefer_internal = true;
+    attributes.dma_capable = true;
+
+    g_promoter_slots[0] = MemoryManager::allocate_tensor_arena(slot_size, attributes);
+    g_promoter_slots[1] = MemoryManager::allocate_tensor_arena(slot_size, attributes);
+
+    if (!g_promoter_slots[0] || !g_promoter_slots[1] ||
+        !MemoryManager::is_internal_ram(g_promoter_slots[0]) ||
+        !MemoryManager::is_internal_ram(g_promoter_slots[1])) {
+        shutdown();
+        return false;
+    }
+
+    g_promoter_channel = new DMAChannel();
+
+    g_promoter_slot_size = slot_size;
+    g_promoter_current = 0;
+    g_prefetch_pending = false;
+    g_promoter_initialized = true;
+    return true;
+}
+
+void WorkingSetPromoter::shutdown() {
+    if (g_promoter_channel) {
+        if (g_prefetch_pending) {
+            g_promoter_channel->wait_completion();
+        }
+        delete g_promoter_channel;
+        g_promoter_channel = nullptr;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        if (g_promoter_slots[i]) {
+            MemoryManager::free_buffer(g_promoter_slots[i]);
+            g_promoter_slots[i] = nullptr;
+        }
+    }
+
+    g_promoter_slot_size = 0;
+    g_prefetch_pending = false;
+    g_promoter_initialized = false;
+}
+
+void* WorkingSetPromoter::promote(const void* src, size_t size) {
+    if (!src || size == 0) {
+        return nullptr;
+    }
+
+    // Already fast, or too big for a slot: use in place
+    if (!g_promoter_initialized || size > g_promoter_slot_size ||
+        MemoryManager::region_of(src) == MemoryRegion::INTERNAL_RAM) {
+        return const_cast<void*>(src);
+    }
+
+    void* slot = g_promoter_slots[g_promoter_current];
+    if (g_promoter_channel && g_promoter_channel->is_ready() &&
+        g_promoter_channel->transfer_sync(slot, src, size) == DMAStatus::SUCCESS) {
+        return slot;
+    }
+
+    // DMA unavailable: CPU copy still beats repeated PSRAM reads for
+    // buffers that are touched more than once
+    std::memcpy(slot, src, size);
+    return slot;
+}
+
+bool WorkingSetPromoter::prefetch(const void* src, size_t size) {
+    if (!g_promoter_initialized || !src || size == 0 ||
+        size > g_promoter_slot_size || g_prefetch_pending) {
+        return false;
+    }
+
+    // Nothing to stage when the buffer is already internal
+    if (MemoryManager::region_of(src) == MemoryRegion::INTERNAL_RAM) {
+        return false;
+    }
+
+    void* slot = g_promoter_slots[1 - g_promoter_current];
+    if (!g_promoter_channel || !g_promoter_channel->is_ready() ||
+        g_promoter_channel->transfer_async(slot, src, size) != DMAStatus::SUCCESS) {
+        return false;
+    }
+
+    g_prefetch_pending = true;
+    g_prefetch_size = size;
+    return true;
+}
+
+void* WorkingSetPromoter::complete_prefetch() {
+    if (!g_promoter_initialized || !g_prefetch_pending) {
+        return nullptr;
+    }
+
+    g_prefetch_pending = false;
+    if (g_promoter_channel->wait_completion() != DMAStatus::SUCCESS) {
+        return nullptr;
+    }
+
+    // The prefetched slot becomes current; the old current slot is free
+    // for the following prefetch
+    g_promoter_current = 1 - g_promoter_current;
+    return g_promoter_slots[g_promoter_current];
+}
+
+bool WorkingSetPromoter::is_initialized() {
+    return g_promoter_initialized;
+}
+
 } // namespace esp32
 } // namespace platform
 } // namespace cmx
\ No newline at end of file
@@ -114,6 +114,19 @@ public:
      */
     static bool is_psram(const void* ptr);
 
+    /**
+     * @brief Classify a pointer by the memory tier backing it
+     *
+     * PSRAM reads cost several times more than internal SRAM, so the
+     * executor uses this tag to decide which buffers need promotion
+     * before a layer runs.
+     *
+     * @param ptr Pointer to classify
+     * @return INTERNAL_RAM or PSRAM for heap pointers; INTERNAL_RAM
+     *         as the conservative default for unknown addresses
+     */
+    static MemoryRegion region_of(const void* ptr);
+
     /**
      * @brief Get optimal memory region for given size and attributes
      * @param size Size in bytes
@@ -154,6 +167,68 @@ private:
     MemoryManager& operator=(const MemoryManager&) = delete;
 };
 
+/**
+ * @brief Double-buffered promotion of PSRAM working sets into internal RAM
+ *
+ * Bulk weights live in PSRAM, but a single mis-placed activation buffer
+ * there can double frame time. The promoter owns two internal-RAM slots
+ * and stages buffers through the GDMA engine: while layer N computes out
+ * of the current slot, the next layer's working set is prefetched into
+ * the other slot, so PSRAM latency overlaps compute instead of stalling
+ * it. Buffers already in internal RAM, and buffers larger than a slot,
+ * pass through untouched.
+ */
+class WorkingSetPromoter {
+public:
+    /**
+     * @brief Allocate the two internal-RAM staging slots
+     * @param slot_size Size of each slot in bytes (largest working set)
+     * @return true if both slots were allocated in internal RAM
+     */
+    static bool init(size_t slot_size);
+
+    /**
+     * @brief Release staging slots and the DMA channel
+     */
+    static void shutdown();
+
+    /**
+     * @brief Stage a buffer into the current slot (blocking)
+     * @param src Source buffer (typically PSRAM-resident)
+     * @param size Buffer size in bytes
+     * @return Internal-RAM copy, or src itself when no staging is needed
+     *         or possible
+     */
+    static void* promote(const void* src, size_t size);
+
+    /**
+     * @brief Start staging the next layer's working set (non-blocking)
+     * @param src Source buffer (typically PSRAM-resident)
+     * @param size Buffer size in bytes
+     * @return true if the DMA transfer was started
+     */
+    static bool prefetch(const void* src, size_t size);
+
+    /**
+     * @brief Wait for the pending prefetch and swap slots
+     * @return Internal-RAM copy of the prefetched buffer, nullptr if no
+     *         prefetch was pending or it failed
+     */
+    static void* complete_prefetch();
+
+    /**
+     * @brief Check if the promoter is initialized
+     * @return true if initialized
+     */
+    static bool is_initialized();
+
+private:
+    WorkingSetPromoter() = delete;
+    ~WorkingSetPromoter() = delete;
+    WorkingSetPromoter(const WorkingSetPromoter&) = delete;
+    WorkingSetPromoter& operator=(const WorkingSetPromoter&) = delete;
+};
+
 /**
  * @brief RAII wrapper for automatic memory cleanup
  */
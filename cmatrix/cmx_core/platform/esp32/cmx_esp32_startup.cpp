@@ -2,6 +2,8 @@
 #include <cstring>
 
 #ifdef ESP_PLATFORM
+#include "cmx_esp32_dma.hpp"
+#include "cmx_esp32_timer.hpp"
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_err.h"
@@ -28,6 +30,29 @@ namespace cmx {
 namespace platform {
 namespace esp32 {
 
+/**
+ * @brief Deferred-initialization feature bits
+ *
+ * Cold start from deep sleep pays only for the clock configuration and
+ * the runtime task; every other subsystem initializes on request. The
+ * runtime asks for the bits a loaded model's plan actually needs (DMA
+ * for streamed weights, timers for profiled builds, ...) via
+ * cmx_startup_require_features, and anything unused never runs its
+ * init code.
+ */
+enum : uint32_t {
+    CMX_STARTUP_FEATURE_NVS         = 1u << 0,  ///< Non-volatile storage
+    CMX_STARTUP_FEATURE_UART        = 1u << 1,  ///< Debug UART driver
+    CMX_STARTUP_FEATURE_STATUS_LED  = 1u << 2,  ///< Status LED GPIO
+    CMX_STARTUP_FEATURE_DMA         = 1u << 3,  ///< DMA channels
+    CMX_STARTUP_FEATURE_TIMERS      = 1u << 4,  ///< Timer manager
+    CMX_STARTUP_FEATURE_DIAGNOSTICS = 1u << 5,  ///< Chip/memory diagnostics
+    CMX_STARTUP_FEATURE_ALL         = 0x3Fu
+};
+
+/// Bits whose init has already run; checked before every deferred init
+static uint32_t g_initialized_features = 0;
+
 #ifdef ESP_PLATFORM
 static const char* TAG = "CMX_ESP32_STARTUP";
 
@@ -52,20 +77,17 @@ extern "C" {
 #endif
 
 /**
- * @brief Initialize ESP32 hardware peripherals for CMX runtime
+ * @brief Configure the status LED GPIO (deferred)
  */
-static void initialize_hardware() {
+static void initialize_status_led() {
 #ifdef ESP_PLATFORM
-    ESP_LOGI(TAG, "Initializing ESP32 hardware for CMX runtime");
-
-    // Configure status LED (built-in LED on most ESP32 boards)
     gpio_config_t led_config = {};
     led_config.intr_type = GPIO_INTR_DISABLE;
     led_config.mode = GPIO_MODE_OUTPUT;
     led_config.pin_bit_mask = (1ULL << CMX_STATUS_LED_PIN);
     led_config.pull_down_en = GPIO_PULLDOWN_DISABLE;
     led_config.pull_up_en = GPIO_PULLUP_DISABLE;
-    
+
     esp_err_t ret = gpio_config(&led_config);
     if (ret == ESP_OK) {
         gpio_set_level(CMX_STATUS_LED_PIN, 0); // LED off initially
@@ -73,8 +95,16 @@ static void initialize_hardware() {
     } else {
         ESP_LOGW(TAG, "Failed to configure status LED: %s", esp_err_to_name(ret));
     }
+#else
+    printf("CMX ESP32 Startup: Status LED initialization (non-ESP32 build)\n");
+#endif
+}
 
-    // Configure UART for debug output (usually already done by ESP-IDF)
+/**
+ * @brief Install the debug UART driver (deferred)
+ */
+static void initialize_uart() {
+#ifdef ESP_PLATFORM
     uart_config_t uart_config = {};
     uart_config.baud_rate = CMX_UART_BAUD_RATE;
     uart_config.data_bits = UART_DATA_8_BITS;
@@ -83,45 +113,21 @@ static void initialize_hardware() {
     uart_config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
     uart_config.source_clk = UART_SCLK_DEFAULT;
 
-    ret = uart_driver_install(UART_NUM_0, 1024, 1024, 0, NULL, 0);
+    esp_err_t ret = uart_driver_install(UART_NUM_0, 1024, 1024, 0, NULL, 0);
     if (ret == ESP_OK) {
         uart_param_config(UART_NUM_0, &uart_config);
         ESP_LOGI(TAG, "UART configured at %d baud", CMX_UART_BAUD_RATE);
     }
-
-    // Print chip information
-    esp_chip_info_t chip_info;
-    esp_chip_info(&chip_info);
-    
-    ESP_LOGI(TAG, "ESP32 Chip Info:");
-    ESP_LOGI(TAG, "  Model: %s", (chip_info.model == CHIP_ESP32) ? "ESP32" : 
-             (chip_info.model == CHIP_ESP32S2) ? "ESP32-S2" :
-             (chip_info.model == CHIP_ESP32S3) ? "ESP32-S3" :
-             (chip_info.model == CHIP_ESP32C3) ? "ESP32-C3" : "Unknown");
-    ESP_LOGI(TAG, "  Cores: %d", chip_info.cores);
-    ESP_LOGI(TAG, "  Features: %s%s%s%s",
-             (chip_info.features & CHIP_FEATURE_WIFI_BGN) ? "WiFi " : "",
-             (chip_info.features & CHIP_FEATURE_BT) ? "BT " : "",
-             (chip_info.features & CHIP_FEATURE_BLE) ? "BLE " : "",
-             (chip_info.features & CHIP_FEATURE_EMB_FLASH) ? "Embedded-Flash " : "");
-    ESP_LOGI(TAG, "  Silicon revision: %d", chip_info.revision);
-
-    // Check and initialize PSRAM if available
-    if (esp_psram_is_initialized()) {
-        size_t psram_size = esp_psram_get_size();
-        ESP_LOGI(TAG, "PSRAM initialized: %zu bytes", psram_size);
-    } else {
-        ESP_LOGI(TAG, "PSRAM not available");
-    }
-
-    ESP_LOGI(TAG, "Hardware initialization complete");
 #else
-    printf("CMX ESP32 Startup: Hardware initialization (non-ESP32 build)\n");
+    printf("CMX ESP32 Startup: UART initialization (non-ESP32 build)\n");
 #endif
 }
 
 /**
  * @brief Configure system clocks and power management
+ *
+ * The one subsystem that stays eager: inference latency depends on the
+ * CPU frequency, and the high-resolution timer backs every timestamp.
  */
 static void configure_system_clocks() {
 #ifdef ESP_PLATFORM
@@ -130,7 +136,7 @@ static void configure_system_clocks() {
     // Set CPU frequency to maximum for best ML inference performance
     rtc_cpu_freq_config_t freq_config;
     rtc_clk_cpu_freq_get_config(&freq_config);
-    
+
     ESP_LOGI(TAG, "Current CPU frequency: %d MHz", freq_config.freq_mhz);
 
     // Try to set maximum CPU frequency
@@ -155,7 +161,7 @@ static void configure_system_clocks() {
 }
 
 /**
- * @brief Initialize NVS (Non-Volatile Storage) for configuration
+ * @brief Initialize NVS (Non-Volatile Storage) for configuration (deferred)
  */
 static void initialize_nvs() {
 #ifdef ESP_PLATFORM
@@ -168,7 +174,7 @@ static void initialize_nvs() {
         ESP_ERROR_CHECK(nvs_flash_erase());
         ret = nvs_flash_init();
     }
-    
+
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "NVS initialized successfully");
     } else {
@@ -180,12 +186,28 @@ static void initialize_nvs() {
 }
 
 /**
- * @brief Print system information and memory status
+ * @brief Print chip information, memory status and system diagnostics (deferred)
  */
 static void print_system_info() {
 #ifdef ESP_PLATFORM
     ESP_LOGI(TAG, "=== CMX ESP32 System Information ===");
-    
+
+    // Chip information
+    esp_chip_info_t chip_info;
+    esp_chip_info(&chip_info);
+
+    ESP_LOGI(TAG, "  Model: %s", (chip_info.model == CHIP_ESP32) ? "ESP32" :
+             (chip_info.model == CHIP_ESP32S2) ? "ESP32-S2" :
+             (chip_info.model == CHIP_ESP32S3) ? "ESP32-S3" :
+             (chip_info.model == CHIP_ESP32C3) ? "ESP32-C3" : "Unknown");
+    ESP_LOGI(TAG, "  Cores: %d", chip_info.cores);
+    ESP_LOGI(TAG, "  Features: %s%s%s%s",
+             (chip_info.features & CHIP_FEATURE_WIFI_BGN) ? "WiFi " : "",
+             (chip_info.features & CHIP_FEATURE_BT) ? "BT " : "",
+             (chip_info.features & CHIP_FEATURE_BLE) ? "BLE " : "",
+             (chip_info.features & CHIP_FEATURE_EMB_FLASH) ? "Embedded-Flash " : "");
+    ESP_LOGI(TAG, "  Silicon revision: %d", chip_info.revision);
+
     // Memory information
     size_t internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
     size_t internal_total = heap_caps_get_total_size(MALLOC_CAP_INTERNAL);
@@ -195,6 +217,8 @@ static void print_system_info() {
         size_t psram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
         size_t psram_total = heap_caps_get_total_size(MALLOC_CAP_SPIRAM);
         ESP_LOGI(TAG, "PSRAM: %zu / %zu bytes free", psram_free, psram_total);
+    } else {
+        ESP_LOGI(TAG, "PSRAM not available");
     }
 
     // DMA capable memory
@@ -203,7 +227,7 @@ static void print_system_info() {
 
     // Task information
     ESP_LOGI(TAG, "FreeRTOS tick rate: %d Hz", configTICK_RATE_HZ);
-    ESP_LOGI(TAG, "Available stack for current task: %d bytes", 
+    ESP_LOGI(TAG, "Available stack for current task: %d bytes",
              uxTaskGetStackHighWaterMark(NULL));
 
     ESP_LOGI(TAG, "=====================================");
@@ -212,6 +236,60 @@ static void print_system_info() {
 #endif
 }
 
+/**
+ * @brief Initialize the requested deferred features
+ *
+ * Idempotent: already-initialized bits are skipped, so callers can pass
+ * their full requirement mask on every use. The runtime calls this once
+ * a loaded plan's requirements are known; subsystems that want to guard
+ * a lazy first use call it again with their own bit.
+ *
+ * @param features Bitmask of CMX_STARTUP_FEATURE_* bits
+ */
+void cmx_startup_require_features(uint32_t features) {
+    uint32_t pending = features & ~g_initialized_features;
+    if (pending == 0) {
+        return;
+    }
+
+    if (pending & CMX_STARTUP_FEATURE_NVS) {
+        initialize_nvs();
+    }
+    if (pending & CMX_STARTUP_FEATURE_UART) {
+        initialize_uart();
+    }
+    if (pending & CMX_STARTUP_FEATURE_STATUS_LED) {
+        initialize_status_led();
+    }
+    if (pending & CMX_STARTUP_FEATURE_DMA) {
+#ifdef ESP_PLATFORM
+        ESP32DMA::initialize();
+#else
+        printf("CMX ESP32 Startup: DMA initialization (non-ESP32 build)\n");
+#endif
+    }
+    if (pending & CMX_STARTUP_FEATURE_TIMERS) {
+#ifdef ESP_PLATFORM
+        ESP32TimerManager::initialize();
+#else
+        printf("CMX ESP32 Startup: Timer initialization (non-ESP32 build)\n");
+#endif
+    }
+    if (pending & CMX_STARTUP_FEATURE_DIAGNOSTICS) {
+        print_system_info();
+    }
+
+    g_initialized_features |= pending;
+}
+
+/**
+ * @brief Check which deferred features have been initialized
+ * @return Bitmask of initialized CMX_STARTUP_FEATURE_* bits
+ */
+uint32_t cmx_startup_initialized_features() {
+    return g_initialized_features;
+}
+
 /**
  * @brief CMX main task function
  */
@@ -224,14 +302,21 @@ static void cmx_main_task(void* parameters) {
         xSemaphoreGive(cmx_init_complete_sem);
     }
 
-    // Turn on status LED to indicate system is running
-    gpio_set_level(CMX_STATUS_LED_PIN, 1);
+    // Turn on status LED to indicate system is running (only when its
+    // init has been requested; the LED is cosmetic and stays dark on
+    // the fast path)
+    if (g_initialized_features & CMX_STARTUP_FEATURE_STATUS_LED) {
+        gpio_set_level(CMX_STATUS_LED_PIN, 1);
+    }
 
-    // Initialize CMX runtime
+    // Initialize CMX runtime; it reports the loaded plan's requirements
+    // through cmx_startup_require_features before first inference
     int ret = cmx_runtime_init();
     if (ret != 0) {
         ESP_LOGE(TAG, "CMX runtime initialization failed: %d", ret);
-        gpio_set_level(CMX_STATUS_LED_PIN, 0); // Turn off LED on error
+        if (g_initialized_features & CMX_STARTUP_FEATURE_STATUS_LED) {
+            gpio_set_level(CMX_STATUS_LED_PIN, 0); // Turn off LED on error
+        }
         vTaskDelete(NULL);
         return;
     }
@@ -249,7 +334,9 @@ static void cmx_main_task(void* parameters) {
     ESP_LOGI(TAG, "CMX runtime cleanup complete");
 
     // Turn off status LED
-    gpio_set_level(CMX_STATUS_LED_PIN, 0);
+    if (g_initialized_features & CMX_STARTUP_FEATURE_STATUS_LED) {
+        gpio_set_level(CMX_STATUS_LED_PIN, 0);
+    }
 
     // Delete this task
     vTaskDelete(NULL);
@@ -303,25 +390,23 @@ static void setup_cmx_tasks() {
 
 /**
  * @brief Main ESP32 application entry point
+ *
+ * Fast path: only the clock configuration and the runtime task gate the
+ * first inference. NVS, UART, LED, DMA, timers and diagnostics are
+ * deferred until cmx_startup_require_features asks for them, which the
+ * runtime does from the loaded plan's requirements — on deep-sleep cold
+ * starts the unused ones never run at all.
  */
 extern "C" void app_main(void) {
 #ifdef ESP_PLATFORM
     ESP_LOGI(TAG, "CMX ESP32 Startup - Version 1.0");
     ESP_LOGI(TAG, "Initializing CMX runtime on ESP32");
 
-    // Step 1: Initialize NVS
-    initialize_nvs();
-
-    // Step 2: Configure system clocks for optimal performance
+    // Step 1: Configure system clocks for optimal performance
     configure_system_clocks();
 
-    // Step 3: Initialize hardware peripherals
-    initialize_hardware();
-
-    // Step 4: Print system information
-    print_system_info();
-
-    // Step 5: Setup CMX runtime tasks
+    // Step 2: Setup CMX runtime tasks; everything else initializes on
+    // demand once the plan's requirements are known
     setup_cmx_tasks();
 
     // Mark system as initialized
@@ -333,7 +418,7 @@ extern "C" void app_main(void) {
     while (cmx_system_initialized) {
         // Periodic system health checks
         vTaskDelay(pdMS_TO_TICKS(10000)); // 10 second intervals
-        
+
         // Monitor task health
         if (cmx_main_task_handle) {
             eTaskState task_state = eTaskGetState(cmx_main_task_handle);
@@ -354,15 +439,13 @@ extern "C" void app_main(void) {
     // Non-ESP32 build - simplified startup for testing
     printf("CMX ESP32 Startup: Non-ESP32 build\n");
     printf("Simulating ESP32 startup sequence...\n");
-    
-    initialize_hardware();
+
     configure_system_clocks();
-    initialize_nvs();
-    print_system_info();
     setup_cmx_tasks();
-    
+    cmx_startup_require_features(CMX_STARTUP_FEATURE_ALL);
+
     printf("CMX ESP32 startup complete (simulation)\n");
-    
+
     // Simulate running
     while (true) {
         std::this_thread::sleep_for(std::chrono::seconds(1));
@@ -376,26 +459,28 @@ extern "C" void app_main(void) {
 void cmx_emergency_shutdown() {
 #ifdef ESP_PLATFORM
     ESP_LOGE(TAG, "Emergency shutdown initiated");
-    
+
     // Stop main CMX task
     if (cmx_main_task_handle) {
         vTaskDelete(cmx_main_task_handle);
         cmx_main_task_handle = nullptr;
     }
-    
+
     // Turn off status LED
-    gpio_set_level(CMX_STATUS_LED_PIN, 0);
-    
+    if (g_initialized_features & CMX_STARTUP_FEATURE_STATUS_LED) {
+        gpio_set_level(CMX_STATUS_LED_PIN, 0);
+    }
+
     // Clean up resources
     if (cmx_init_complete_sem) {
         vSemaphoreDelete(cmx_init_complete_sem);
         cmx_init_complete_sem = nullptr;
     }
-    
+
     cmx_system_initialized = false;
-    
+
     ESP_LOGE(TAG, "Emergency shutdown complete");
-    
+
     // Restart system
     esp_restart();
 #else
@@ -424,8 +509,12 @@ extern "C" {
     void cmx_esp32_emergency_shutdown() {
         cmx::platform::esp32::cmx_emergency_shutdown();
     }
-    
+
     bool cmx_esp32_is_initialized() {
         return cmx::platform::esp32::cmx_is_system_initialized();
     }
-}
\ No newline at end of file
+
+    void cmx_esp32_require_features(uint32_t features) {
+        cmx::platform::esp32::cmx_startup_require_features(features);
+    }
+}
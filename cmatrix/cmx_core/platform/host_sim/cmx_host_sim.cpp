@@ -0,0 +1,97 @@
+#include "cmx_host_sim.hpp"
+#include "../../runtime/cmx_profiler.hpp"
+
+#include <cstring>
+
+namespace cmx {
+namespace platform {
+namespace host_sim {
+
+// Per-target cost tables. Peak MACs/s and bandwidth figures come from
+// backend_flags.py, divided by the assumed clock; the flash tier is
+// derated against SRAM for the wait states weight fetches see on real
+// parts. Revisit against on-target CMX_TUNE numbers when they drift.
+static const TargetCostModel kCostModels[] = {
+    // 100 MHz M4: 1 MAC/cycle via the DSP extension, single-cycle
+    // SRAM on a 32-bit bus, ~2 wait states on flash
+    {"cortex-m", 100000000ULL, 1.0, 4.0, 1.5, 150},
+    // 100 MHz low-end/soft core: scalar multiply, shared bus
+    {"riscv", 100000000ULL, 0.5, 2.0, 1.0, 200},
+    // 240 MHz LX6: ~1 MAC/cycle, internal SRAM over a 32-bit bus,
+    // cache-served flash for weights
+    {"xtensa", 240000000ULL, 1.0, 1.33, 0.7, 150},
+    // Host-class reference point
+    {"generic", 1000000000ULL, 1.0, 10.0, 10.0, 50},
+};
+
+const TargetCostModel* HostSimBackend::model_ = nullptr;
+uint64_t HostSimBackend::cycles_ = 0;
+
+bool HostSimBackend::init(const char* target) {
+    if (!target) {
+        return false;
+    }
+
+    for (const TargetCostModel& candidate : kCostModels) {
+        if (std::strcmp(candidate.name, target) == 0) {
+            model_ = &candidate;
+            cycles_ = 0;
+
+            // The profiler now ticks in estimated target cycles, so
+            // every existing report path shows simulated time
+            runtime::HighResTimer::set_platform_clock(&read_cycles,
+                                                      model_->clock_hz);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void HostSimBackend::deinit() {
+    model_ = nullptr;
+    cycles_ = 0;
+}
+
+const TargetCostModel* HostSimBackend::model() {
+    return model_;
+}
+
+uint64_t HostSimBackend::account_op(uint64_t macs, uint64_t sram_bytes,
+                                    uint64_t flash_bytes) {
+    if (!model_) {
+        return 0;
+    }
+
+    const double compute_cycles =
+        static_cast<double>(macs) / model_->macs_per_cycle;
+    const double memory_cycles =
+        static_cast<double>(sram_bytes) / model_->sram_bytes_per_cycle +
+        static_cast<double>(flash_bytes) / model_->flash_bytes_per_cycle;
+
+    // Roofline: compute and memory overlap on every supported part,
+    // so the op is bound by the slower of the two
+    const double bound = (compute_cycles > memory_cycles) ? compute_cycles
+                                                          : memory_cycles;
+    const uint64_t charged =
+        static_cast<uint64_t>(bound) + model_->op_overhead_cycles;
+
+    cycles_ += charged;
+    return charged;
+}
+
+uint64_t HostSimBackend::cycles() {
+    return cycles_;
+}
+
+void HostSimBackend::reset() {
+    cycles_ = 0;
+}
+
+uint64_t HostSimBackend::read_cycles() {
+    return cycles_;
+}
+
+} // namespace host_sim
+} // namespace platform
+} // namespace cmx
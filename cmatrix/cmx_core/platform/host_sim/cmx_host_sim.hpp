@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+
+namespace cmx {
+namespace platform {
+namespace host_sim {
+
+/**
+ * @brief Approximate cost parameters of one simulated target
+ *
+ * The numbers mirror the per-target figures in backend_flags.py
+ * (peak MACs/s and memory bandwidth at an assumed core clock), split
+ * into the two memory tiers that dominate on our parts: tightly
+ * coupled SRAM for activations and the slower flash path weights are
+ * read from. They are deliberately coarse - the model is a roofline,
+ * not a pipeline simulator - but coarse is enough to rank tilings.
+ */
+struct TargetCostModel {
+    const char* name;               ///< Target name as used by the compile tooling
+    uint64_t clock_hz;              ///< Assumed core clock
+    double macs_per_cycle;          ///< Sustained MAC issue width
+    double sram_bytes_per_cycle;    ///< Activation-tier bandwidth
+    double flash_bytes_per_cycle;   ///< Weight-tier bandwidth
+    uint64_t op_overhead_cycles;    ///< Dispatch and loop-setup cost per op
+};
+
+/**
+ * @brief Cycle-approximate simulation backend for host kernel runs
+ *
+ * Kernels iterate fine functionally on x86, but performance only
+ * shows on target, which makes the edit-flash-measure loop hours
+ * long. This backend closes the loop on the host: kernels run
+ * normally, and each op additionally reports its work (MACs, bytes
+ * touched per tier) through account_op(), which advances a virtual
+ * cycle counter by a roofline estimate for the selected target.
+ *
+ * init() registers the virtual counter as the profiling clock via
+ * HighResTimer::set_platform_clock(), so CMX_PROFILE_SCOPE and the
+ * rest of the CMXProfiler interface report estimated target time with
+ * no changes: a profiled scope's duration is exactly the cycles its
+ * account_op() calls added, and host wall-clock time never leaks in.
+ * Estimates within a few tens of percent are enough to reject bad
+ * tilings before ever flashing.
+ */
+class HostSimBackend {
+public:
+    /**
+     * @brief Select a target cost model and take over the profiling clock
+     *
+     * Known targets match backend_flags.py: "cortex-m", "riscv",
+     * "xtensa", "generic".
+     *
+     * @param target Target name
+     * @return true if the target is known, false otherwise
+     */
+    static bool init(const char* target);
+
+    /**
+     * @brief Release the profiling clock back to the host default
+     */
+    static void deinit();
+
+    /**
+     * @brief Get the active cost model
+     * @return Model pointer, nullptr before init()
+     */
+    static const TargetCostModel* model();
+
+    /**
+     * @brief Account one executed op and advance the virtual clock
+     *
+     * Roofline estimate: the op costs whichever is larger of its
+     * compute time (MACs over issue width) and its memory time (each
+     * tier's bytes over that tier's bandwidth, summed - the tiers
+     * share the bus on every supported part), plus fixed per-op
+     * overhead. Call once per kernel invocation, inside the op's
+     * profiling scope.
+     *
+     * @param macs Multiply-accumulates performed
+     * @param sram_bytes Activation bytes read plus written
+     * @param flash_bytes Weight bytes read
+     * @return Cycles charged for this op
+     */
+    static uint64_t account_op(uint64_t macs, uint64_t sram_bytes,
+                               uint64_t flash_bytes);
+
+    /**
+     * @brief Get the virtual cycle counter
+     * @return Estimated cycles accounted since init() or reset()
+     */
+    static uint64_t cycles();
+
+    /**
+     * @brief Reset the virtual cycle counter to zero
+     */
+    static void reset();
+
+private:
+    HostSimBackend() = delete;
+
+    /**
+     * @brief Profiling clock callback returning the virtual counter
+     * @return Estimated cycle count
+     */
+    static uint64_t read_cycles();
+
+    static const TargetCostModel* model_;   ///< Active cost model
+    static uint64_t cycles_;                ///< Virtual cycle counter
+};
+
+} // namespace host_sim
+} // namespace platform
+} // namespace cmx
@@ -0,0 +1,135 @@
+#include "cmx_linux_memory.hpp"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#else
+#include <cstdlib>
+#include <cstring>
+#endif
+
+namespace cmx {
+namespace platform {
+namespace linux_os {
+
+namespace {
+
+// Explicit hugepage size we request from MAP_HUGETLB. 2MB is the
+// default huge page size on every x86-64 and AArch64 gateway we ship
+// to; if a deployment reconfigures the default, MAP_HUGETLB simply
+// fails and we fall through to transparent hugepages.
+constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+inline size_t round_up(size_t size, size_t align) {
+    return (size + align - 1) & ~(align - 1);
+}
+
+} // namespace
+
+size_t MemoryManager::huge_page_size() {
+    return kHugePageSize;
+}
+
+void* MemoryManager::allocate_arena(size_t size, ArenaBacking* backing) {
+    if (size == 0) {
+        return nullptr;
+    }
+
+    size = round_up(size, kHugePageSize);
+
+#ifdef __linux__
+    // First choice: explicit hugepages. Fails cleanly (ENOMEM) when
+    // /proc/sys/vm/nr_hugepages has nothing reserved.
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED) {
+        if (backing) {
+            *backing = ArenaBacking::EXPLICIT_HUGEPAGES;
+        }
+        return ptr;
+    }
+
+    // Second choice: small pages with a THP hint. The mapping is
+    // hugepage-aligned (size is a 2MB multiple and the kernel aligns
+    // large anonymous mappings), so khugepaged can collapse all of it.
+    ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        return nullptr;
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (madvise(ptr, size, MADV_HUGEPAGE) == 0) {
+        if (backing) {
+            *backing = ArenaBacking::TRANSPARENT_HUGEPAGES;
+        }
+        return ptr;
+    }
+#endif
+
+    // THP disabled system-wide (or an old kernel): plain pages still
+    // work, just without the TLB win.
+    if (backing) {
+        *backing = ArenaBacking::SMALL_PAGES;
+    }
+    return ptr;
+#else
+    // Non-Linux fallback so host tooling builds stay portable
+    void* ptr = aligned_alloc(kHugePageSize, size);
+    if (ptr) {
+        memset(ptr, 0, size);
+    }
+    if (backing) {
+        *backing = ArenaBacking::SMALL_PAGES;
+    }
+    return ptr;
+#endif
+}
+
+void MemoryManager::release_arena(void* base, size_t size) {
+    if (!base || size == 0) {
+        return;
+    }
+
+#ifdef __linux__
+    // Same length rounding as allocate_arena, regardless of which
+    // backing the mapping ended up with
+    munmap(base, round_up(size, kHugePageSize));
+#else
+    free(base);
+#endif
+}
+
+void MemoryManager::advise_streaming(const void* base, size_t size) {
+    if (!base || size == 0) {
+        return;
+    }
+
+#ifdef __linux__
+    // Advice is best-effort; a partially unaligned range just loses
+    // the hint on its edge pages
+    madvise(const_cast<void*>(base), size, MADV_SEQUENTIAL);
+    madvise(const_cast<void*>(base), size, MADV_WILLNEED);
+#else
+    (void)base;
+    (void)size;
+#endif
+}
+
+void MemoryManager::advise_release(const void* base, size_t size) {
+    if (!base || size == 0) {
+        return;
+    }
+
+#ifdef __linux__
+    madvise(const_cast<void*>(base), size, MADV_DONTNEED);
+#else
+    (void)base;
+    (void)size;
+#endif
+}
+
+} // namespace linux_os
+} // namespace platform
+} // namespace cmx
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace cmx {
+namespace platform {
+namespace linux_os {
+
+/**
+ * @brief How an arena allocation ended up backed
+ */
+enum class ArenaBacking {
+    EXPLICIT_HUGEPAGES,     // mmap with MAP_HUGETLB succeeded
+    TRANSPARENT_HUGEPAGES,  // Small pages with MADV_HUGEPAGE hint
+    SMALL_PAGES             // Plain small pages, no hint accepted
+};
+
+/**
+ * @brief Linux memory manager for CMX gateway builds
+ *
+ * On the x86/ARM Linux gateways the tensor arena is tens of megabytes,
+ * and backing it with 4KB pages TLB-thrashes the GEMM-heavy sections.
+ * This backend maps the arena with explicit 2MB hugepages when the
+ * system has them reserved, degrades to transparent hugepages via
+ * MADV_HUGEPAGE, and finally to plain pages, so callers never fail for
+ * lack of hugepage configuration. It also exposes the madvise hints
+ * the weight streamer wants for sections it reads front to back once.
+ *
+ * Typical use: map the arena here, then hand it to
+ * CMXMemoryPool::initialize_from_regions(), which references rather
+ * than owns the span - release_arena() after the pool is torn down.
+ */
+class MemoryManager {
+public:
+    /**
+     * @brief Map a tensor arena, preferring hugepage backing
+     *
+     * The mapping length is size rounded up to the huge page size so
+     * MAP_HUGETLB can be attempted; pass the same size to
+     * release_arena(). The memory is zeroed (anonymous mapping).
+     *
+     * @param size Requested arena size in bytes
+     * @param backing Optional out: how the mapping was backed
+     * @return Arena base, nullptr if even the plain mapping failed
+     */
+    static void* allocate_arena(size_t size, ArenaBacking* backing = nullptr);
+
+    /**
+     * @brief Unmap an arena from allocate_arena()
+     * @param base Arena base
+     * @param size Size passed to allocate_arena()
+     */
+    static void release_arena(void* base, size_t size);
+
+    /**
+     * @brief Hint that a range will be read sequentially, soon
+     *
+     * For the streaming weight sections: MADV_SEQUENTIAL gets the
+     * kernel reading ahead aggressively and dropping pages behind the
+     * cursor, MADV_WILLNEED starts the read-ahead immediately.
+     *
+     * @param base Range start (e.g. an mmap'd weight section)
+     * @param size Range size in bytes
+     */
+    static void advise_streaming(const void* base, size_t size);
+
+    /**
+     * @brief Hint that a range's contents are no longer needed
+     *
+     * MADV_DONTNEED lets the kernel reclaim the pages (a consumed
+     * weight window, an arena between inference bursts). Anonymous
+     * pages read after this are zero, so only advise ranges whose
+     * contents are dead.
+     *
+     * @param base Range start
+     * @param size Range size in bytes
+     */
+    static void advise_release(const void* base, size_t size);
+
+    /**
+     * @brief Huge page size used for arena rounding
+     * @return Huge page size in bytes (2MB unless the platform differs)
+     */
+    static size_t huge_page_size();
+
+private:
+    MemoryManager() = delete;
+};
+
+} // namespace linux_os
+} // namespace platform
+} // namespace cmx
@@ -9,6 +9,7 @@
 
 #include "cmx_nios2_dma.hpp"
 #include "cmx_nios2_port.hpp"
+#include "../../runtime/cmx_dma.hpp"
 
 #include <system.h>
 #include <string.h>
@@ -153,6 +154,107 @@ static void sgdma_callback(void* context) {
 }
 #endif
 
+#ifdef SGDMA_0_BASE
+/**
+ * @brief Build and submit one chain from the descriptor pool
+ *
+ * Links the first row_count pool descriptors and runs them as a single
+ * hardware submission: one register setup and one completion wait for
+ * the whole chain.
+ */
+static bool submit_descriptor_pool(uint8_t* const* dst_rows,
+                                   const uint8_t* const* src_rows,
+                                   const size_t* row_sizes,
+                                   size_t row_count) {
+    for (size_t i = 0; i < row_count; i++) {
+        alt_sgdma_descriptor* next =
+            (i + 1 < row_count) ? &g_sgdma_descriptors[i + 1] : nullptr;
+
+        alt_avalon_sgdma_construct_mem_to_mem_dma_descriptor(
+            &g_sgdma_descriptors[i],
+            next,
+            const_cast<uint8_t*>(src_rows[i]),
+            dst_rows[i],
+            row_sizes[i],
+            0, // Don't generate interrupt
+            0, // Don't generate interrupt
+            0, // Don't generate interrupt
+            0  // Control flags
+        );
+    }
+
+    return alt_avalon_sgdma_do_sync_transfer(g_sgdma_device,
+                                             &g_sgdma_descriptors[0]) == 0;
+}
+
+/**
+ * @brief Runtime chain executor for cmx_dma_register_backend
+ *
+ * Flattens a runtime descriptor chain onto the SGDMA engine. Rows from
+ * consecutive descriptors share the descriptor pool, so small strided
+ * descriptors coalesce into full hardware chains instead of paying a
+ * submission each.
+ */
+static bool execute_runtime_chain(const runtime::CMXDmaDescriptor* chain) {
+    if (!g_dma_initialized || !g_sgdma_device || !g_dma_available) {
+        return false; // Runtime falls back to its CPU row loop
+    }
+
+    uint8_t* dst_rows[CMX_DMA_MAX_CHANNELS];
+    const uint8_t* src_rows[CMX_DMA_MAX_CHANNELS];
+    size_t row_sizes[CMX_DMA_MAX_CHANNELS];
+    size_t pending = 0;
+    uint64_t total_bytes = 0;
+
+    g_dma_stats.total_transfers++;
+    uint64_t start_time = cmx_get_timestamp_us();
+
+    for (const runtime::CMXDmaDescriptor* desc = chain; desc; desc = desc->next) {
+        if (!desc->dst || !desc->src || desc->row_bytes == 0 ||
+            desc->row_bytes > cmx_dma_get_max_transfer_size()) {
+            g_dma_stats.failed_transfers++;
+            return false;
+        }
+
+        uint8_t* dst_row = static_cast<uint8_t*>(desc->dst);
+        const uint8_t* src_row = static_cast<const uint8_t*>(desc->src);
+
+        for (size_t row = 0; row < desc->row_count; row++) {
+            dst_rows[pending] = dst_row;
+            src_rows[pending] = src_row;
+            row_sizes[pending] = desc->row_bytes;
+            pending++;
+            total_bytes += desc->row_bytes;
+
+            if (pending == CMX_DMA_MAX_CHANNELS) {
+                if (!submit_descriptor_pool(dst_rows, src_rows, row_sizes,
+                                            pending)) {
+                    g_dma_stats.failed_transfers++;
+                    g_dma_stats.error_count[0]++; // Generic error
+                    return false;
+                }
+                pending = 0;
+            }
+
+            dst_row += desc->dst_stride;
+            src_row += desc->src_stride;
+        }
+    }
+
+    if (pending > 0 &&
+        !submit_descriptor_pool(dst_rows, src_rows, row_sizes, pending)) {
+        g_dma_stats.failed_transfers++;
+        g_dma_stats.error_count[0]++; // Generic error
+        return false;
+    }
+
+    g_dma_stats.total_bytes += total_bytes;
+    g_dma_stats.total_time_us += cmx_get_timestamp_us() - start_time;
+    g_dma_stats.successful_transfers++;
+    return true;
+}
+#endif
+
 /**
  * @brief Perform memory copy using optimized method
  */
@@ -219,8 +321,17 @@ bool cmx_dma_init() {
     if (!g_dma_available) {
         dma_debug_log("No DMA hardware found, using memcpy fallback");
     }
-    
+
     g_dma_initialized = true;
+
+#ifdef SGDMA_0_BASE
+    // Let runtime descriptor chains land on the SGDMA engine in
+    // batched submissions
+    if (g_dma_available && g_sgdma_device) {
+        runtime::cmx_dma_register_backend(&execute_runtime_chain);
+    }
+#endif
+
     return true;
 }
 
@@ -245,6 +356,7 @@ void cmx_dma_cleanup() {
     
 #ifdef SGDMA_0_BASE
     if (g_sgdma_device) {
+        runtime::cmx_dma_register_backend(nullptr);
         // SGDMA cleanup is handled by HAL
         g_sgdma_device = nullptr;
     }
@@ -337,13 +449,151 @@ bool cmx_dma_transfer(void* dst, const void* src, size_t size) {
     return result;
 }
 
-bool cmx_dma_transfer_config(void* dst, const void* src, size_t size, 
+bool cmx_dma_transfer_config(void* dst, const void* src, size_t size,
                             const DmaChannelConfig& config) {
     // For blocking transfers, use the simpler interface
     // Configuration is mainly useful for async transfers
     return cmx_dma_transfer(dst, src, size);
 }
 
+bool cmx_dma_transfer_2d(void* dst, size_t dst_stride,
+                        const void* src, size_t src_stride,
+                        size_t row_bytes, size_t row_count) {
+    if (!dst || !src || row_bytes == 0 || row_count == 0) {
+        return false;
+    }
+
+#ifdef SGDMA_0_BASE
+    if (g_dma_initialized && g_sgdma_device && g_dma_available) {
+        // Chain rows into scatter-gather descriptors; the descriptor
+        // pool bounds how many rows go into one hardware submission
+        uint8_t* dst_row = static_cast<uint8_t*>(dst);
+        const uint8_t* src_row = static_cast<const uint8_t*>(src);
+        size_t remaining = row_count;
+
+        g_dma_stats.total_transfers++;
+        g_dma_stats.total_bytes += row_bytes * row_count;
+
+        uint64_t start_time = cmx_get_timestamp_us();
+
+        while (remaining > 0) {
+            size_t batch = remaining < CMX_DMA_MAX_CHANNELS
+                         ? remaining : CMX_DMA_MAX_CHANNELS;
+
+            for (size_t i = 0; i < batch; i++) {
+                alt_sgdma_descriptor* next =
+                    (i + 1 < batch) ? &g_sgdma_descriptors[i + 1] : nullptr;
+
+                alt_avalon_sgdma_construct_mem_to_mem_dma_descriptor(
+                    &g_sgdma_descriptors[i],
+                    next,
+                    const_cast<uint8_t*>(src_row),
+                    dst_row,
+                    row_bytes,
+                    0, // Don't generate interrupt
+                    0, // Don't generate interrupt
+                    0, // Don't generate interrupt
+                    0  // Control flags
+                );
+
+                dst_row += dst_stride;
+                src_row += src_stride;
+            }
+
+            int result = alt_avalon_sgdma_do_sync_transfer(g_sgdma_device,
+                                                           &g_sgdma_descriptors[0]);
+            if (result != 0) {
+                g_dma_stats.failed_transfers++;
+                g_dma_stats.error_count[0]++; // Generic error
+                return false;
+            }
+
+            remaining -= batch;
+        }
+
+        g_dma_stats.total_time_us += cmx_get_timestamp_us() - start_time;
+        g_dma_stats.successful_transfers++;
+        return true;
+    }
+#endif
+
+    // Fallback to a CPU row loop
+    uint8_t* dst_row = static_cast<uint8_t*>(dst);
+    const uint8_t* src_row = static_cast<const uint8_t*>(src);
+    for (size_t row = 0; row < row_count; row++) {
+        if (!optimized_memcpy(dst_row, src_row, row_bytes)) {
+            return false;
+        }
+        dst_row += dst_stride;
+        src_row += src_stride;
+    }
+    return true;
+}
+
+bool cmx_dma_transfer_batch(const DmaBatchEntry* entries, size_t count) {
+    if (!entries || count == 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (!entries[i].destination || !entries[i].source ||
+            entries[i].size == 0 ||
+            entries[i].size > cmx_dma_get_max_transfer_size()) {
+            return false;
+        }
+    }
+
+#ifdef SGDMA_0_BASE
+    if (g_dma_initialized && g_sgdma_device && g_dma_available) {
+        g_dma_stats.total_transfers++;
+        uint64_t start_time = cmx_get_timestamp_us();
+        uint64_t total_bytes = 0;
+
+        // Chain entries through the descriptor pool; each pool-full is
+        // one register setup and one completion wait
+        size_t submitted = 0;
+        while (submitted < count) {
+            size_t batch = count - submitted < CMX_DMA_MAX_CHANNELS
+                         ? count - submitted : CMX_DMA_MAX_CHANNELS;
+
+            uint8_t* dst_rows[CMX_DMA_MAX_CHANNELS];
+            const uint8_t* src_rows[CMX_DMA_MAX_CHANNELS];
+            size_t row_sizes[CMX_DMA_MAX_CHANNELS];
+
+            for (size_t i = 0; i < batch; i++) {
+                const DmaBatchEntry& entry = entries[submitted + i];
+                dst_rows[i] = static_cast<uint8_t*>(entry.destination);
+                src_rows[i] = static_cast<const uint8_t*>(entry.source);
+                row_sizes[i] = entry.size;
+                total_bytes += entry.size;
+            }
+
+            if (!submit_descriptor_pool(dst_rows, src_rows, row_sizes, batch)) {
+                g_dma_stats.failed_transfers++;
+                g_dma_stats.error_count[0]++; // Generic error
+                return false;
+            }
+
+            submitted += batch;
+        }
+
+        g_dma_stats.total_bytes += total_bytes;
+        g_dma_stats.total_time_us += cmx_get_timestamp_us() - start_time;
+        g_dma_stats.successful_transfers++;
+        return true;
+    }
+#endif
+
+    // Fallback: one copy per entry
+    for (size_t i = 0; i < count; i++) {
+        if (!optimized_memcpy(entries[i].destination, entries[i].source,
+                              entries[i].size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 uint32_t cmx_dma_transfer_async(void* dst, const void* src, size_t size,
                                const DmaChannelConfig& config,
                                DmaCallback callback, void* user_data) {
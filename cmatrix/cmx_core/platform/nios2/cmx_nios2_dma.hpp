@@ -134,9 +134,55 @@ bool cmx_dma_transfer(void* dst, const void* src, size_t size);
  * @param config DMA channel configuration
  * @return true if transfer successful
  */
-bool cmx_dma_transfer_config(void* dst, const void* src, size_t size, 
+bool cmx_dma_transfer_config(void* dst, const void* src, size_t size,
                             const DmaChannelConfig& config);
 
+/**
+ * @brief Perform 2D strided DMA transfer (blocking)
+ *
+ * Copies row_count rows of row_bytes each; between rows the source
+ * advances by src_stride bytes and the destination by dst_stride
+ * bytes. On SGDMA hardware the rows are chained into scatter-gather
+ * descriptors and submitted as batched transfers, so strided layout
+ * conversions (channel slices, im2col gathers, de-padding) run on the
+ * DMA engine instead of CPU loops.
+ *
+ * @param dst Destination of the first row
+ * @param dst_stride Destination row-to-row stride in bytes
+ * @param src Source of the first row
+ * @param src_stride Source row-to-row stride in bytes
+ * @param row_bytes Contiguous bytes per row
+ * @param row_count Number of rows
+ * @return true if the whole transfer completed successfully
+ */
+bool cmx_dma_transfer_2d(void* dst, size_t dst_stride,
+                        const void* src, size_t src_stride,
+                        size_t row_bytes, size_t row_count);
+
+/**
+ * @brief One entry in a batched transfer list
+ */
+struct DmaBatchEntry {
+    void* destination;           ///< Destination address
+    const void* source;          ///< Source address
+    size_t size;                 ///< Transfer size in bytes
+};
+
+/**
+ * @brief Submit a transfer list as chained descriptors (blocking)
+ *
+ * Entries are linked into scatter-gather descriptor chains and pushed
+ * to the engine in descriptor-pool-sized batches, so a whole layer's
+ * transfer list (weight stream, spill/fill schedule) pays one register
+ * setup and one completion wait per chain instead of one per entry.
+ * Without SGDMA hardware each entry falls back to an individual copy.
+ *
+ * @param entries Transfer list
+ * @param count Number of entries
+ * @return true if every entry was transferred
+ */
+bool cmx_dma_transfer_batch(const DmaBatchEntry* entries, size_t count);
+
 /**
  * @brief Start asynchronous DMA transfer
  * @param dst Destination address
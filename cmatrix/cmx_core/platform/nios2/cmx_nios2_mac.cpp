@@ -0,0 +1,46 @@
+// cmx_nios2_mac.cpp
+// CMatrix Framework Implementation
+/**
+ * @file cmx_nios2_mac.cpp
+ * @brief Custom-instruction MAC primitives for Nios II
+ * @author CMatrix Development Team
+ * @version 1.0
+ *
+ * Strong overrides of the weak arithmetic primitives in
+ * cmx_platform_abstraction.cpp. When the BSP exposes a
+ * multiply-accumulate custom instruction (ALT_CI_CMX_MAC_0_N in
+ * system.h, dataa * datab + result feedback folded by the FPGA
+ * fabric), the MAC routes through __builtin_custom_inii and runs in a
+ * single cycle instead of the 5-cycle soft-core multiply. Systems
+ * generated without the custom instruction fall back to the same
+ * scalar arithmetic as the weak defaults, so this file is always safe
+ * to compile into a Nios II build.
+ */
+
+#include "../cmx_platform_abstraction.hpp"
+
+#include <system.h>
+
+namespace cmx {
+namespace platform {
+
+int32_t mac_s32(int32_t acc, int32_t a, int32_t b) {
+#ifdef ALT_CI_CMX_MAC_0_N
+    // Single-cycle custom instruction: dataa * datab, accumulated here
+    return acc + __builtin_custom_inii(ALT_CI_CMX_MAC_0_N, a, b);
+#else
+    return acc + a * b;
+#endif
+}
+
+int32_t dot_product_s8(const int8_t* a, const int8_t* b, int32_t count, int32_t a_offset) {
+    int32_t acc = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        acc = mac_s32(acc, static_cast<int32_t>(a[i]) - a_offset,
+                      static_cast<int32_t>(b[i]));
+    }
+    return acc;
+}
+
+} // namespace platform
+} // namespace cmx
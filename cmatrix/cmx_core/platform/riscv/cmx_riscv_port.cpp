@@ -1,4 +1,5 @@
 #include "cmx_riscv_port.hpp"
+#include "cmx_riscv_vector.hpp"
 #include <cstring>
 
 namespace cmx::platform::riscv {
@@ -44,7 +45,10 @@ void system_init() noexcept {
     
     // Initialize GPIO if needed
     // gpio_init_all();
-    
+
+    // Latch vector unit availability for the RVV kernel dispatch
+    VectorUnit::probe();
+
     // Memory barriers to ensure initialization order
     memory_barrier();
 }
@@ -1,4 +1,5 @@
 #include "cmx_riscv_timer.hpp"
+#include "../../runtime/cmx_profiler.hpp"
 
 namespace cmx::platform::riscv {
 
@@ -23,6 +24,16 @@ void Timer::set_cpu_frequency(uint64_t freq_hz) {
     cpu_frequency_hz_ = freq_hz;
 }
 
+bool Timer::register_profiler_clock() {
+    if (cpu_frequency_hz_ == 0) {
+        return false;
+    }
+
+    cmx::runtime::HighResTimer::set_platform_clock(&Timer::get_cycles,
+                                                   cpu_frequency_hz_);
+    return true;
+}
+
 Timer::microseconds_t Timer::get_microseconds() {
     if (!initialized_) {
         return 0;
@@ -45,6 +45,18 @@ public:
      */
     static nanoseconds_t get_nanoseconds();
 
+    /**
+     * @brief Route the runtime profiler through the cycle CSR
+     *
+     * Registers get_cycles() as the profiling clock so per-op timings
+     * are cycle-accurate and reading the clock is a single rdcycle
+     * instead of 64-bit time conversion. Call after set_cpu_frequency()
+     * so durations convert at the right rate.
+     *
+     * @return true if the clock was registered
+     */
+    static bool register_profiler_clock();
+
     /**
      * @brief Convert cycles to microseconds
      * @param cycles Number of cycles to convert
@@ -0,0 +1,21 @@
+#include "cmx_riscv_vector.hpp"
+
+namespace cmx::platform::riscv {
+
+// Static member definitions
+bool VectorUnit::available_ = false;
+
+bool VectorUnit::probe() {
+#if defined(__riscv)
+    // misa bit 21 is 'V'; reads as zero on cores that hardwire misa,
+    // in which case we conservatively stay scalar
+    uint32_t misa;
+    asm volatile("csrr %0, misa" : "=r"(misa));
+    available_ = (misa & (1u << ('V' - 'A'))) != 0;
+#else
+    available_ = false;
+#endif
+    return available_;
+}
+
+} // namespace cmx::platform::riscv
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__riscv_vector)
+#include <riscv_vector.h>
+#define CMX_HAVE_RVV 1
+#endif
+
+namespace cmx::platform::riscv {
+
+/**
+ * @brief RISC-V Vector (RVV) support for the int8 kernel inner loops
+ *
+ * VLEN-agnostic stripmined primitives for the quantized conv/dense
+ * reference loops: every loop asks vsetvli for the active vector
+ * length, so the same code runs unchanged on 128-bit K230-class parts
+ * and anything wider. Availability is probed once at startup from the
+ * misa CSR ('V' bit), and the primitives fall back to scalar loops
+ * when the unit is absent, so a binary built with the V extension
+ * enabled still boots on vectorless parts like the ESP32-C3 as long
+ * as no other code emits vector instructions.
+ *
+ * Kernels guard their call sites with CMX_USE_RVV (build flag, same
+ * convention as CMX_USE_HELIUM on Cortex-M); without __riscv_vector in
+ * the compile target the primitives are scalar-only.
+ */
+class VectorUnit {
+public:
+    /**
+     * @brief Probe the vector unit once during platform init
+     *
+     * Reads misa and latches whether the 'V' extension is present.
+     * Must run in machine mode; call it from system_init() before any
+     * kernel dispatch.
+     *
+     * @return true if a vector unit was found
+     */
+    static bool probe();
+
+    /**
+     * @brief Check the probed vector unit availability
+     * @return true if probe() found a vector unit
+     */
+    static bool available() {
+        return available_;
+    }
+
+    /**
+     * @brief Offset-corrected int8 dot product
+     *
+     * Computes sum((a[i] - a_offset) * b[i]) as dot(a, b) minus
+     * a_offset * sum(b), with widening multiplies and reductions over
+     * vsetvli-sized strips. Falls back to the scalar loop when the
+     * vector unit is absent.
+     *
+     * @param a First operand (e.g. input activations)
+     * @param b Second operand (e.g. weights)
+     * @param count Element count
+     * @param a_offset Zero point subtracted from every element of a
+     * @return 32-bit accumulated dot product
+     */
+    static inline int32_t dot_s8(const int8_t* a, const int8_t* b,
+                                 int32_t count, int32_t a_offset) {
+#ifdef CMX_HAVE_RVV
+        if (available_) {
+            int32_t dot = 0;
+            int32_t b_sum = 0;
+            size_t remaining = static_cast<size_t>(count);
+            while (remaining > 0) {
+                const size_t vl = __riscv_vsetvl_e8m2(remaining);
+                const vint8m2_t va = __riscv_vle8_v_i8m2(a, vl);
+                const vint8m2_t vb = __riscv_vle8_v_i8m2(b, vl);
+                const vint16m4_t prod = __riscv_vwmul_vv_i16m4(va, vb, vl);
+                const vint32m1_t zero = __riscv_vmv_v_x_i32m1(0, vl);
+                dot += __riscv_vmv_x_s_i32m1_i32(
+                    __riscv_vwredsum_vs_i16m4_i32m1(prod, zero, vl));
+                b_sum += __riscv_vmv_x_s_i32m1_i32(
+                    __riscv_vwredsum_vs_i16m4_i32m1(
+                        __riscv_vwadd_vx_i16m4(vb, 0, vl), zero, vl));
+                a += vl;
+                b += vl;
+                remaining -= vl;
+            }
+            return dot - a_offset * b_sum;
+        }
+#endif
+        int32_t acc = 0;
+        for (int32_t i = 0; i < count; ++i) {
+            acc += (static_cast<int32_t>(a[i]) - a_offset) *
+                   static_cast<int32_t>(b[i]);
+        }
+        return acc;
+    }
+
+private:
+    static bool available_;
+};
+
+} // namespace cmx::platform::riscv
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__XTENSA__)
+#include <xtensa/config/core-isa.h>
+#if (defined(XCHAL_HAVE_HIFI3) && XCHAL_HAVE_HIFI3) || \
+    (defined(XCHAL_HAVE_HIFI4) && XCHAL_HAVE_HIFI4) || \
+    (defined(XCHAL_HAVE_HIFI5) && XCHAL_HAVE_HIFI5)
+#include <xtensa/tie/xt_hifi2.h>
+#define CMX_HAVE_HIFI 1
+#endif
+#endif
+
+namespace cmx {
+namespace platform {
+namespace xtensa {
+
+/**
+ * @brief HiFi AE_* intrinsic primitives for the kernel inner loops
+ *
+ * Dot products for the quantized dense/conv reference loops, built on
+ * the dual-MAC AE pipeline (4 MACs per AE_MULAAAAQ16). Targets cores
+ * configured with HiFi3 or later; on anything else (including plain
+ * LX7 builds without the audio engine) the functions compile to the
+ * same scalar loops the kernels would otherwise run, so call sites can
+ * dispatch unconditionally under the CMX_USE_HIFI build flag (same
+ * convention as CMX_USE_HELIUM / CMX_USE_RVV).
+ *
+ * The int16 variant exists because the audio models are int16-heavy;
+ * it becomes the inner loop of the int16 operator path when one lands.
+ */
+
+#ifdef CMX_HAVE_HIFI
+
+/**
+ * @brief Offset-corrected int8 dot product on the HiFi MAC pipeline
+ *
+ * Computes sum((a[i] - a_offset) * b[i]) as dot(a, b) minus
+ * a_offset * sum(b). AE_L8X4F loads four signed bytes into the high
+ * halves of a 16x4 register (values scaled by 256), so the raw
+ * accumulators carry an extra 2^16 (dot) and 2^8 (sum) that the final
+ * shifts remove.
+ *
+ * @param a First operand (e.g. input activations)
+ * @param b Second operand (e.g. weights)
+ * @param count Element count
+ * @param a_offset Zero point subtracted from every element of a
+ * @return 32-bit accumulated dot product
+ */
+static inline int32_t hifi_dot_s8(const int8_t* a, const int8_t* b,
+                                  int32_t count, int32_t a_offset) {
+    ae_int64 acc = AE_ZERO64();
+    ae_int64 b_acc = AE_ZERO64();
+    const ae_int16x4 ones = AE_MOVDA16(1);
+
+    const int8_t* pa = a;
+    const int8_t* pb = b;
+    int32_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        ae_int16x4 va;
+        ae_int16x4 vb;
+        AE_L8X4F_IP(va, pa, 4);
+        AE_L8X4F_IP(vb, pb, 4);
+        AE_MULAAAAQ16(acc, va, vb);
+        AE_MULAAAAQ16(b_acc, vb, ones);
+    }
+
+    int32_t dot = static_cast<int32_t>(AE_MOVAD32_L(
+        AE_MOVINT32X2_FROMINT64(AE_SRAI64(acc, 16))));
+    int32_t b_sum = static_cast<int32_t>(AE_MOVAD32_L(
+        AE_MOVINT32X2_FROMINT64(AE_SRAI64(b_acc, 8))));
+
+    for (; i < count; ++i) {
+        dot += static_cast<int32_t>(a[i]) * static_cast<int32_t>(b[i]);
+        b_sum += static_cast<int32_t>(b[i]);
+    }
+    return dot - a_offset * b_sum;
+}
+
+/**
+ * @brief int16 dot product with a 64-bit accumulator
+ *
+ * Four 16x16 MACs per step through AE_MULAAAAQ16; the wide accumulator
+ * means no intermediate saturation over audio-length rows.
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param count Element count
+ * @return 64-bit accumulated dot product
+ */
+static inline int64_t hifi_dot_s16(const int16_t* a, const int16_t* b,
+                                   int32_t count) {
+    ae_int64 acc = AE_ZERO64();
+
+    const ae_int16x4* pa = reinterpret_cast<const ae_int16x4*>(a);
+    const ae_int16x4* pb = reinterpret_cast<const ae_int16x4*>(b);
+    ae_valign va_align = AE_LA64_PP(pa);
+    ae_valign vb_align = AE_LA64_PP(pb);
+
+    int32_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        ae_int16x4 va;
+        ae_int16x4 vb;
+        AE_LA16X4_IP(va, va_align, pa);
+        AE_LA16X4_IP(vb, vb_align, pb);
+        AE_MULAAAAQ16(acc, va, vb);
+    }
+
+    int64_t dot = static_cast<int64_t>(AE_MOVINT64_FROMINT64(acc));
+    for (; i < count; ++i) {
+        dot += static_cast<int64_t>(a[i]) * static_cast<int64_t>(b[i]);
+    }
+    return dot;
+}
+
+#else // !CMX_HAVE_HIFI
+
+// Scalar fallbacks with identical semantics for cores without the
+// audio engine, so CMX_USE_HIFI builds stay portable.
+
+static inline int32_t hifi_dot_s8(const int8_t* a, const int8_t* b,
+                                  int32_t count, int32_t a_offset) {
+    int32_t acc = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        acc += (static_cast<int32_t>(a[i]) - a_offset) *
+               static_cast<int32_t>(b[i]);
+    }
+    return acc;
+}
+
+static inline int64_t hifi_dot_s16(const int16_t* a, const int16_t* b,
+                                   int32_t count) {
+    int64_t acc = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        acc += static_cast<int64_t>(a[i]) * static_cast<int64_t>(b[i]);
+    }
+    return acc;
+}
+
+#endif // CMX_HAVE_HIFI
+
+} // namespace xtensa
+} // namespace platform
+} // namespace cmx
@@ -10,6 +10,7 @@ namespace cmx::platform::xtensa {
 static constexpr size_t FAST_RAM_SIZE = 128 * 1024;    // 128KB internal SRAM
 static constexpr size_t SLOW_RAM_SIZE = 2 * 1024 * 1024; // 2MB external PSRAM
 static constexpr size_t DMA_RAM_SIZE = 64 * 1024;      // 64KB DMA-capable memory
+static constexpr size_t DMA_BANK_SIZE = 32 * 1024;     // 32KB per SRAM bank
 static constexpr size_t INSTRUCTION_SIZE = 256 * 1024;  // 256KB for instructions
 
 static constexpr size_t MIN_BLOCK_SIZE = 16;
@@ -35,6 +36,7 @@ struct MemoryPool {
 };
 
 static MemoryPool g_memory_pools[4];
+static MemoryPool g_dma_bank_pools[DMA_BANK_COUNT];
 static bool g_memory_initialized = false;
 
 // External memory regions (would be defined in linker script)
@@ -98,9 +100,19 @@ void cmx_memory_init() {
     static uint8_t instruction_buffer[INSTRUCTION_SIZE] __attribute__((aligned(32)));
     init_memory_pool(g_memory_pools[3], MemoryPoolType::INSTRUCTION,
                     instruction_buffer, INSTRUCTION_SIZE, 4);
-    
+
+    // Banked DMA pools: the linker script places each buffer in a
+    // different internal SRAM bank so CPU and GDMA traffic to
+    // different banks doesn't contend for the same bus port
+    static uint8_t dma_bank0_buffer[DMA_BANK_SIZE] __attribute__((aligned(32)));
+    static uint8_t dma_bank1_buffer[DMA_BANK_SIZE] __attribute__((aligned(32)));
+    init_memory_pool(g_dma_bank_pools[0], MemoryPoolType::DMA_CAPABLE,
+                    dma_bank0_buffer, DMA_BANK_SIZE, 32);
+    init_memory_pool(g_dma_bank_pools[1], MemoryPoolType::DMA_CAPABLE,
+                    dma_bank1_buffer, DMA_BANK_SIZE, 32);
+
     g_memory_initialized = true;
-    cmx_log("MEMORY: Initialized 4 memory pools");
+    cmx_log("MEMORY: Initialized 4 memory pools + 2 DMA banks");
 }
 
 static MemoryPool* get_pool(MemoryPoolType type) {
@@ -115,6 +127,28 @@ static size_t align_size(size_t size, size_t alignment) {
     return (size + alignment - 1) & ~(alignment - 1);
 }
 
+static bool pool_contains(const MemoryPool& pool, const void* addr) {
+    uintptr_t pool_start = reinterpret_cast<uintptr_t>(pool.base_address);
+    uintptr_t pool_end = pool_start + pool.total_size;
+    uintptr_t target = reinterpret_cast<uintptr_t>(addr);
+    return target >= pool_start && target < pool_end;
+}
+
+static MemoryPool* find_owning_pool(const void* addr) {
+    for (int i = 0; i < 4; i++) {
+        if (g_memory_pools[i].initialized && pool_contains(g_memory_pools[i], addr)) {
+            return &g_memory_pools[i];
+        }
+    }
+    for (uint32_t bank = 0; bank < DMA_BANK_COUNT; bank++) {
+        if (g_dma_bank_pools[bank].initialized &&
+            pool_contains(g_dma_bank_pools[bank], addr)) {
+            return &g_dma_bank_pools[bank];
+        }
+    }
+    return nullptr;
+}
+
 static void* allocate_from_pool(MemoryPool& pool, size_t size, uint32_t flags) {
     CMX_CRITICAL_SECTION();
     
@@ -218,18 +252,8 @@ void cmx_free(void* ptr) {
     }
     
     // Find which pool this block belongs to
-    MemoryPool* pool = nullptr;
-    for (int i = 0; i < 4; i++) {
-        uintptr_t pool_start = reinterpret_cast<uintptr_t>(g_memory_pools[i].base_address);
-        uintptr_t pool_end = pool_start + g_memory_pools[i].total_size;
-        uintptr_t block_addr = reinterpret_cast<uintptr_t>(block);
-        
-        if (block_addr >= pool_start && block_addr < pool_end) {
-            pool = &g_memory_pools[i];
-            break;
-        }
-    }
-    
+    MemoryPool* pool = find_owning_pool(block);
+
     if (!pool) {
         return; // Invalid pointer
     }
@@ -279,6 +303,51 @@ void* cmx_alloc_pool(size_t size, MemoryPoolType pool_type, uint32_t flags) {
     return allocate_from_pool(*pool, size, flags);
 }
 
+void* cmx_alloc_dma_bank(size_t size, uint32_t bank, uint32_t flags) {
+    if (!g_memory_initialized) {
+        cmx_memory_init();
+    }
+
+    if (size == 0 || bank >= DMA_BANK_COUNT) {
+        return nullptr;
+    }
+
+    return allocate_from_pool(g_dma_bank_pools[bank], size, flags);
+}
+
+int32_t cmx_get_dma_bank(const void* ptr) {
+    if (!ptr) {
+        return -1;
+    }
+
+    for (uint32_t bank = 0; bank < DMA_BANK_COUNT; bank++) {
+        if (g_dma_bank_pools[bank].initialized &&
+            pool_contains(g_dma_bank_pools[bank], ptr)) {
+            return static_cast<int32_t>(bank);
+        }
+    }
+    return -1;
+}
+
+bool cmx_alloc_ping_pong(size_t size, void** ping, void** pong, uint32_t flags) {
+    if (!ping || !pong) {
+        return false;
+    }
+
+    *ping = cmx_alloc_dma_bank(size, 0, flags);
+    *pong = cmx_alloc_dma_bank(size, 1, flags);
+
+    if (!*ping || !*pong) {
+        cmx_free(*ping);
+        cmx_free(*pong);
+        *ping = nullptr;
+        *pong = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
 void* cmx_realloc(void* ptr, size_t new_size) {
     if (!ptr) {
         return cmx_alloc(new_size);
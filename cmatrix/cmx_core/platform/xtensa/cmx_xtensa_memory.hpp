@@ -62,6 +62,49 @@ void* cmx_alloc_flags(size_t size, uint32_t flags);
  */
 void* cmx_alloc_pool(size_t size, MemoryPoolType pool_type, uint32_t flags = 0);
 
+/**
+ * @brief Number of independently arbitrated DMA-capable SRAM banks
+ *
+ * The ESP32-S3's internal RAM is built from multiple banks that the CPU
+ * and GDMA can access concurrently without contending for the same bus
+ * port. Placing a layer's compute buffer and the DMA staging buffer for
+ * the next layer in different banks lets the transfer overlap the
+ * core's loads instead of stalling them.
+ */
+constexpr uint32_t DMA_BANK_COUNT = 2;
+
+/**
+ * @brief Allocate DMA-capable memory from a specific SRAM bank
+ * @param size Size in bytes
+ * @param bank Bank index in [0, DMA_BANK_COUNT)
+ * @param flags Optional flags
+ * @return Pointer to allocated memory, nullptr if failed
+ */
+void* cmx_alloc_dma_bank(size_t size, uint32_t bank, uint32_t flags = 0);
+
+/**
+ * @brief Get the SRAM bank an allocation was placed in
+ * @param ptr Pointer returned by a DMA-capable allocation
+ * @return Bank index, or -1 if the pointer is not in a banked region
+ */
+int32_t cmx_get_dma_bank(const void* ptr);
+
+/**
+ * @brief Allocate a ping/pong buffer pair in different SRAM banks
+ *
+ * Both buffers are DMA-capable and placed in distinct banks so DMA
+ * staging into one buffer runs concurrently with compute reads from the
+ * other. Free each buffer with cmx_free. On failure neither buffer is
+ * left allocated.
+ *
+ * @param size Size of each buffer in bytes
+ * @param ping Receives the first buffer
+ * @param pong Receives the second buffer
+ * @param flags Optional flags applied to both allocations
+ * @return true if both buffers were allocated, false otherwise
+ */
+bool cmx_alloc_ping_pong(size_t size, void** ping, void** pong, uint32_t flags = 0);
+
 /**
  * @brief Reallocate memory
  * @param ptr Existing pointer (can be nullptr)
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__XTENSA__) && defined(CONFIG_IDF_TARGET_ESP32S3)
+#define CMX_HAVE_PIE 1
+#endif
+
+namespace cmx {
+namespace platform {
+namespace xtensa {
+
+/**
+ * @brief ESP32-S3 PIE int8 primitives for the kernel inner loops
+ *
+ * The S3's Processor Instruction Extensions sustain 16 int8 MACs per
+ * cycle (EE.VMULAS.S8.ACCX over 128-bit q registers), but only when
+ * loads are overlapped with compute: straight-line intrinsic code
+ * stalls on every vector load and reaches well under half of the
+ * unit's throughput. These loops are therefore software-pipelined
+ * explicitly - a prologue primes the first operand pair, the steady
+ * state issues the fused MAC-and-load form against one q-register pair
+ * while the other pair is being filled (q0/q1 and q2/q3 rotate roles
+ * each iteration), and an epilogue drains the last pair with a plain
+ * MAC. Keep that structure when extending this file; the scheduling is
+ * the point, not the intrinsics.
+ *
+ * On anything that is not an S3 the functions compile to scalar loops
+ * with identical semantics, so call sites can dispatch unconditionally
+ * under the CMX_USE_PIE build flag (same convention as CMX_USE_HIFI /
+ * CMX_USE_HELIUM / CMX_USE_RVV).
+ */
+
+#ifdef CMX_HAVE_PIE
+
+/**
+ * @brief Offset-corrected int8 dot product on the PIE MAC unit
+ *
+ * Computes sum((a[i] - a_offset) * b[i]) as dot(a, b) minus
+ * a_offset * sum(b). Both passes run the pipelined 16-lane loop; the
+ * sum pass multiplies b against a ones vector so it reuses the same
+ * MAC path. EE.VLD.128 requires 16-byte alignment, so unaligned
+ * operands take the scalar tail from element 0.
+ *
+ * @param a First operand (e.g. input activations)
+ * @param b Second operand (e.g. weights)
+ * @param count Element count
+ * @param a_offset Zero point subtracted from every element of a
+ * @return 32-bit accumulated dot product
+ */
+static inline int32_t pie_dot_s8(const int8_t* a, const int8_t* b,
+                                 int32_t count, int32_t a_offset) {
+    int32_t dot = 0;
+    int32_t b_sum = 0;
+    int32_t i = 0;
+
+    bool aligned = ((reinterpret_cast<uintptr_t>(a) |
+                     reinterpret_cast<uintptr_t>(b)) & 0xF) == 0;
+    if (aligned && count >= 32) {
+        const int8_t* pa = a;
+        const int8_t* pb = b;
+        // Steady-state iterations after the prologue pair; each handles
+        // 32 elements (two rotated q-register pairs)
+        int32_t steps = (count - 32) / 32;
+
+        asm volatile(
+            // Prologue: prime q0/q1 and q2/q3, clear the accumulator
+            "ee.zero.accx                                  \n"
+            "ee.vld.128.ip      q0, %[pa], 16              \n"
+            "ee.vld.128.ip      q1, %[pb], 16              \n"
+            "ee.vld.128.ip      q2, %[pa], 16              \n"
+            "ee.vld.128.ip      q3, %[pb], 16              \n"
+            "beqz               %[steps], 2f               \n"
+            "loopgtz            %[steps], 1f               \n"
+            // Steady state: MAC one pair while refilling the other, so
+            // every cycle issues a multiply; the pairs swap roles at
+            // each line and the rotation closes over the iteration
+            "ee.vmulas.s8.accx.ld.ip q0, %[pa], 16, q0, q1 \n"
+            "ee.vld.128.ip      q1, %[pb], 16              \n"
+            "ee.vmulas.s8.accx.ld.ip q2, %[pa], 16, q2, q3 \n"
+            "ee.vld.128.ip      q3, %[pb], 16              \n"
+            "1:                                            \n"
+            "2:                                            \n"
+            // Epilogue: drain the last two pairs, no loads left
+            "ee.vmulas.s8.accx  q0, q1                     \n"
+            "ee.vmulas.s8.accx  q2, q3                     \n"
+            "ee.srs.accx        %[dot], %[zero], 0         \n"
+            : [dot] "=r"(dot), [pa] "+r"(pa), [pb] "+r"(pb)
+            : [steps] "r"(steps), [zero] "r"(0)
+            : "memory");
+
+        i = 32 + steps * 32;
+
+        // Second pipelined pass: sum(b) through the same MAC path
+        // against a broadcast ones vector
+        const int8_t* ps = b;
+        int8_t one = 1;
+        asm volatile(
+            "ee.zero.accx                                  \n"
+            "ee.vldbc.8         q1, %[pone]                \n"
+            "ee.vld.128.ip      q0, %[ps], 16              \n"
+            "ee.vld.128.ip      q2, %[ps], 16              \n"
+            "beqz               %[steps], 2f               \n"
+            "loopgtz            %[steps], 1f               \n"
+            "ee.vmulas.s8.accx.ld.ip q0, %[ps], 16, q0, q1 \n"
+            "ee.vmulas.s8.accx.ld.ip q2, %[ps], 16, q2, q1 \n"
+            "1:                                            \n"
+            "2:                                            \n"
+            "ee.vmulas.s8.accx  q0, q1                     \n"
+            "ee.vmulas.s8.accx  q2, q1                     \n"
+            "ee.srs.accx        %[sum], %[zero], 0         \n"
+            : [sum] "=r"(b_sum), [ps] "+r"(ps)
+            : [steps] "r"(steps), [pone] "r"(&one), [zero] "r"(0)
+            : "memory");
+    }
+
+    for (; i < count; ++i) {
+        dot += static_cast<int32_t>(a[i]) * static_cast<int32_t>(b[i]);
+        b_sum += static_cast<int32_t>(b[i]);
+    }
+    return dot - a_offset * b_sum;
+}
+
+#else // !CMX_HAVE_PIE
+
+// Scalar fallback with identical semantics for non-S3 cores, so
+// CMX_USE_PIE builds stay portable.
+
+static inline int32_t pie_dot_s8(const int8_t* a, const int8_t* b,
+                                 int32_t count, int32_t a_offset) {
+    int32_t acc = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        acc += (static_cast<int32_t>(a[i]) - a_offset) *
+               static_cast<int32_t>(b[i]);
+    }
+    return acc;
+}
+
+#endif // CMX_HAVE_PIE
+
+} // namespace xtensa
+} // namespace platform
+} // namespace cmx
@@ -1,5 +1,6 @@
 #include "cmx_xtensa_timer.hpp"
 #include "cmx_xtensa_port.hpp"
+#include "../../runtime/cmx_profiler.hpp"
 #include <xtensa/config/core.h>
 #include <xtensa/hal.h>
 #include <xtensa/tie/xt_timer.h>
@@ -66,6 +67,31 @@ uint64_t cmx_now_ms() {
     return cmx_now_us() / 1000;
 }
 
+uint64_t cmx_cycle_count() {
+    // ccount is 32-bit and wraps every few seconds at core clock
+    // rates; the profiler reads far more often than that, so detecting
+    // a single wrap between reads is sufficient
+    static uint32_t last_ccount = 0;
+    static uint64_t wrap_offset = 0;
+
+    uint32_t current = xthal_get_ccount();
+    if (current < last_ccount) {
+        wrap_offset += 0x100000000ULL;
+    }
+    last_ccount = current;
+
+    return wrap_offset + current;
+}
+
+bool cmx_register_profiler_clock() {
+    if (!g_timer_initialized || g_cpu_freq_hz == 0) {
+        return false;
+    }
+
+    cmx::runtime::HighResTimer::set_platform_clock(&cmx_cycle_count, g_cpu_freq_hz);
+    return true;
+}
+
 void cmx_delay_ms(uint32_t ms) {
     cmx_delay_us(ms * 1000);
 }
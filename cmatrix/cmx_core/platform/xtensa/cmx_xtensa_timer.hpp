@@ -40,6 +40,24 @@ uint64_t cmx_now_us();
  */
 uint64_t cmx_now_ms();
 
+/**
+ * @brief Get the ccount cycle register extended to 64 bits
+ * @return Monotonic cycle count since system start
+ */
+uint64_t cmx_cycle_count();
+
+/**
+ * @brief Route the runtime profiler through the ccount cycle register
+ *
+ * Registers cmx_cycle_count() as the profiling clock so per-op timings
+ * are cycle-accurate instead of going through the microsecond
+ * conversion in cmx_now_us(). Call after timer_init() so the CPU
+ * frequency is known.
+ *
+ * @return true if the clock was registered
+ */
+bool cmx_register_profiler_clock();
+
 /**
  * @brief Blocking delay in milliseconds
  * @param ms Milliseconds to delay
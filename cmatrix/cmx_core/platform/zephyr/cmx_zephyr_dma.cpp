@@ -4,12 +4,14 @@
  */
 
 #include "cmx_zephyr_dma.hpp"
+#include "cmx_zephyr_memory.hpp"
 #include "cmx_zephyr_port.hpp"
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/drivers/dma.h>
 #include <zephyr/device.h>
+#include <zephyr/cache.h>
 
 #include <string.h>
 #include <algorithm>
@@ -29,6 +31,7 @@ struct DmaChannelState {
     bool active;
     size_t transfer_size;
     size_t bytes_transferred;
+    void* dest_addr;
     dma_callback_t callback;
     void* user_data;
     struct k_sem completion_sem;
@@ -56,6 +59,13 @@ static void dma_completion_callback(const struct device* dma_dev, void* user_dat
     
     if (status == 0) {
         ch_state->bytes_transferred = ch_state->transfer_size;
+
+        // Discard stale cached lines so the CPU reads the DMA'd data.
+        // Destinations in the nocache DMA arena skip this.
+        if (ch_state->dest_addr && !cmx_is_dma_coherent(ch_state->dest_addr)) {
+            sys_cache_data_invd_range(ch_state->dest_addr, ch_state->transfer_size);
+        }
+
         LOG_DBG("DMA transfer completed on channel %d", channel);
     } else {
         LOG_ERR("DMA transfer failed on channel %d: %d", channel, status);
@@ -100,6 +110,7 @@ bool dma_init() {
         ch->active = false;
         ch->transfer_size = 0;
         ch->bytes_transferred = 0;
+        ch->dest_addr = nullptr;
         ch->callback = nullptr;
         ch->user_data = nullptr;
         k_sem_init(&ch->completion_sem, 0, 1);
@@ -271,10 +282,24 @@ bool dma_transfer_async(int channel, void* dst, const void* src, size_t size,
     
     ch->transfer_size = size;
     ch->bytes_transferred = 0;
+    ch->dest_addr = dst;
     ch->callback = callback;
     ch->user_data = user_data;
     ch->active = true;
-    
+
+    // Cache maintenance: the DMA engine bypasses the data cache, so
+    // cached buffers need the source flushed and the destination
+    // cleaned (dirty lines evicted mid-transfer would corrupt DMA'd
+    // data) before starting; the completion callback invalidates the
+    // destination. Buffers carved from the nocache DMA arena
+    // (cmx_arena_acquire with DMA_POOL) skip all of this.
+    if (!cmx_is_dma_coherent(src)) {
+        sys_cache_data_flush_range(const_cast<void*>(src), size);
+    }
+    if (!cmx_is_dma_coherent(dst)) {
+        sys_cache_data_flush_range(dst, size);
+    }
+
     // Reset completion semaphore
     k_sem_reset(&ch->completion_sem);
     
@@ -28,6 +28,31 @@ struct allocation_info {
 static allocation_info allocations[CMX_MAX_BLOCKS];
 static int allocation_count = 0;
 
+// Arena slabs bridged out to CMXAllocator. Blocks are cache-line
+// aligned so allocator arenas never share a line with unrelated data;
+// the DMA slab lives in a nocache region when the platform provides
+// one, so staging buffers need no flush/invalidate around transfers.
+#define CMX_ARENA_CACHE_LINE 64
+#define CMX_TENSOR_ARENA_BLOCK_SIZE (16 * 1024)
+#define CMX_TENSOR_ARENA_BLOCKS 4
+#define CMX_DMA_ARENA_BLOCK_SIZE (4 * 1024)
+#define CMX_DMA_ARENA_BLOCKS 4
+
+static uint8_t tensor_arena_storage[CMX_TENSOR_ARENA_BLOCK_SIZE * CMX_TENSOR_ARENA_BLOCKS]
+    __aligned(CMX_ARENA_CACHE_LINE);
+#if defined(CONFIG_NOCACHE_MEMORY)
+static uint8_t dma_arena_storage[CMX_DMA_ARENA_BLOCK_SIZE * CMX_DMA_ARENA_BLOCKS]
+    __nocache __aligned(CMX_ARENA_CACHE_LINE);
+#else
+// No nocache region on this platform: fall back to cached storage and
+// let the DMA layer keep doing explicit cache maintenance.
+static uint8_t dma_arena_storage[CMX_DMA_ARENA_BLOCK_SIZE * CMX_DMA_ARENA_BLOCKS]
+    __aligned(CMX_ARENA_CACHE_LINE);
+#endif
+static struct k_mem_slab tensor_arena_slab;
+static struct k_mem_slab dma_arena_slab;
+static bool arena_initialized = false;
+
 void cmx_memory_init() {
     if (memory_initialized) {
         LOG_WRN("Memory already initialized");
@@ -44,6 +69,15 @@ void cmx_memory_init() {
     memset(allocations, 0, sizeof(allocations));
     allocation_count = 0;
 
+    // Initialize arena slabs for CMXAllocator bridging
+    if (!arena_initialized) {
+        k_mem_slab_init(&tensor_arena_slab, tensor_arena_storage,
+                        CMX_TENSOR_ARENA_BLOCK_SIZE, CMX_TENSOR_ARENA_BLOCKS);
+        k_mem_slab_init(&dma_arena_slab, dma_arena_storage,
+                        CMX_DMA_ARENA_BLOCK_SIZE, CMX_DMA_ARENA_BLOCKS);
+        arena_initialized = true;
+    }
+
     memory_initialized = true;
     LOG_INF("CMX memory subsystem initialized with %d bytes", CMX_MEMORY_POOL_SIZE);
 }
@@ -225,6 +259,60 @@ void cmx_memory_stats() {
     k_mutex_unlock(&memory_mutex);
 }
 
+size_t cmx_arena_block_size(PoolType pool_type) {
+    return (pool_type == PoolType::DMA_POOL) ? CMX_DMA_ARENA_BLOCK_SIZE
+                                             : CMX_TENSOR_ARENA_BLOCK_SIZE;
+}
+
+void* cmx_arena_acquire(PoolType pool_type) {
+    if (!memory_initialized) {
+        LOG_ERR("Memory not initialized");
+        return nullptr;
+    }
+
+    struct k_mem_slab* slab = (pool_type == PoolType::DMA_POOL)
+                                  ? &dma_arena_slab
+                                  : &tensor_arena_slab;
+
+    void* block = nullptr;
+    int ret = k_mem_slab_alloc(slab, &block, K_NO_WAIT);
+    if (ret != 0) {
+        LOG_ERR("Arena slab for pool %d exhausted", (int)pool_type);
+        return nullptr;
+    }
+
+    LOG_DBG("Acquired arena block at %p from pool %d", block, (int)pool_type);
+    return block;
+}
+
+void cmx_arena_release(void* block) {
+    if (!block || !memory_initialized) {
+        return;
+    }
+
+    uintptr_t addr = (uintptr_t)block;
+    if (addr >= (uintptr_t)dma_arena_storage &&
+        addr < (uintptr_t)dma_arena_storage + sizeof(dma_arena_storage)) {
+        k_mem_slab_free(&dma_arena_slab, block);
+    } else if (addr >= (uintptr_t)tensor_arena_storage &&
+               addr < (uintptr_t)tensor_arena_storage + sizeof(tensor_arena_storage)) {
+        k_mem_slab_free(&tensor_arena_slab, block);
+    } else {
+        LOG_WRN("Attempted to release non-arena pointer %p", block);
+    }
+}
+
+bool cmx_is_dma_coherent(const void* ptr) {
+#if defined(CONFIG_NOCACHE_MEMORY)
+    uintptr_t addr = (uintptr_t)ptr;
+    return addr >= (uintptr_t)dma_arena_storage &&
+           addr < (uintptr_t)dma_arena_storage + sizeof(dma_arena_storage);
+#else
+    (void)ptr;
+    return false;
+#endif
+}
+
 void cmx_memory_cleanup() {
     if (!memory_initialized) {
         return;
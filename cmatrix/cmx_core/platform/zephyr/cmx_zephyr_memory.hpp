@@ -166,6 +166,55 @@ void cmx_dump_memory_info(PoolType pool_type = PoolType::TENSOR_POOL);
 typedef void (*memory_failure_callback_t)(size_t size, PoolType pool_type);
 void cmx_set_memory_failure_callback(memory_failure_callback_t callback);
 
+/**
+ * @brief Arena blocks for the core CMXAllocator
+ *
+ * CMXAllocator is constructed over a caller-provided arena. On Zephyr
+ * that arena should come from attributed memory rather than an
+ * anonymous static array: compute tensors want cached, cache-line
+ * aligned storage, while DMA staging buffers want nocache storage so
+ * transfers need no explicit cache maintenance. These functions bridge
+ * fixed k_mem_slab pools of cache-aligned blocks out as arena regions.
+ */
+
+/**
+ * @brief Get the arena block size for a pool type
+ * @param pool_type Pool to query
+ * @return Size in bytes of each arena block from that pool
+ */
+size_t cmx_arena_block_size(PoolType pool_type);
+
+/**
+ * @brief Acquire one cache-line aligned arena block
+ * @param pool_type DMA_POOL maps to the nocache slab, all other pool
+ *        types to the cached slab
+ * @return Block of cmx_arena_block_size(pool_type) bytes, nullptr if
+ *         the slab is exhausted
+ *
+ * The returned block is intended to back a CMXAllocator instance or a
+ * DMA staging area. It is not tracked by cmx_free and must be returned
+ * with cmx_arena_release.
+ */
+void* cmx_arena_acquire(PoolType pool_type);
+
+/**
+ * @brief Return an arena block to its slab
+ * @param block Pointer returned by cmx_arena_acquire
+ */
+void cmx_arena_release(void* block);
+
+/**
+ * @brief Check whether a buffer lives in DMA-coherent (nocache) memory
+ * @param ptr Buffer to classify (any address inside the block counts)
+ * @return true if the buffer needs no cache maintenance around DMA
+ *
+ * cmx_zephyr_dma.cpp consults this to skip flush/invalidate for
+ * buffers carved from the DMA_POOL arena. Always false when
+ * CONFIG_NOCACHE_MEMORY is disabled - the DMA slab is then cached and
+ * transfers pay maintenance like any other buffer.
+ */
+bool cmx_is_dma_coherent(const void* ptr);
+
 /**
  * @brief Stack-based memory allocator for temporary allocations
  */
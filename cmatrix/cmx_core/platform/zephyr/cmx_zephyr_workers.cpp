@@ -0,0 +1,192 @@
+/**
+ * @file cmx_zephyr_workers.cpp
+ * @brief Implementation of persistent scheduler workers for Zephyr RTOS
+ */
+
+#include "cmx_zephyr_workers.hpp"
+#include "cmx_zephyr_port.hpp"
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(cmx_workers, LOG_LEVEL_DBG);
+
+namespace cmx::platform::zephyr {
+
+// Stack size per worker; kernels run on these threads, so leave headroom
+// for the deepest op (im2col conv) plus logging.
+constexpr size_t WORKER_STACK_SIZE = 4096;
+
+// Stacks and thread control blocks are static so the pool never touches
+// the heap - same rule as the rest of the port layer.
+K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, MAX_WORKER_THREADS, WORKER_STACK_SIZE);
+
+// Global worker pool state
+static struct {
+    bool initialized;
+    bool stop_requested;
+    cmx::runtime::CMXScheduler* scheduler;
+    WorkerPoolConfig config;
+    struct k_thread threads[MAX_WORKER_THREADS];
+    k_tid_t thread_ids[MAX_WORKER_THREADS];
+    struct k_sem work_sem;
+    struct k_sem parked_sem;
+} pool_state = { false };
+
+// Worker entry point: drain the scheduler, then park on the work
+// semaphore until the next batch is submitted. Draining loops on
+// execute_single_task() so each worker pulls one task at a time and
+// siblings on other cores can interleave.
+static void worker_entry(void* p1, void* p2, void* p3) {
+    uint32_t worker_index = (uint32_t)(uintptr_t)p1;
+    (void)p2;
+    (void)p3;
+
+    LOG_DBG("Worker %u started on CPU %d", worker_index, arch_curr_cpu()->id);
+
+    while (!pool_state.stop_requested) {
+        k_sem_take(&pool_state.work_sem, K_FOREVER);
+
+        if (pool_state.stop_requested) {
+            break;
+        }
+
+        while (pool_state.scheduler->execute_single_task()) {
+            // Keep pulling until the ready queue is empty; dependents
+            // released by completed tasks become visible here without
+            // another notify.
+        }
+    }
+
+    LOG_DBG("Worker %u exiting", worker_index);
+    k_sem_give(&pool_state.parked_sem);
+}
+
+WorkerPoolConfig worker_pool_default_config() {
+    WorkerPoolConfig config;
+    config.num_workers = CONFIG_MP_MAX_NUM_CPUS < MAX_WORKER_THREADS
+                             ? CONFIG_MP_MAX_NUM_CPUS
+                             : MAX_WORKER_THREADS;
+    config.base_priority = K_PRIO_PREEMPT(2);
+    config.pin_to_cores = true;
+    config.first_core = 0;
+    return config;
+}
+
+int worker_thread_priority(cmx::runtime::TaskPriority priority, int base_priority) {
+    // Zephyr priorities grow less urgent as the number rises, so each
+    // step down from CRITICAL adds one.
+    switch (priority) {
+        case cmx::runtime::TaskPriority::CRITICAL: return base_priority;
+        case cmx::runtime::TaskPriority::HIGH:     return base_priority + 1;
+        case cmx::runtime::TaskPriority::NORMAL:   return base_priority + 2;
+        case cmx::runtime::TaskPriority::LOW:      return base_priority + 3;
+        default:                                   return base_priority + 2;
+    }
+}
+
+bool workers_init(cmx::runtime::CMXScheduler* scheduler, const WorkerPoolConfig& config) {
+    if (pool_state.initialized) {
+        LOG_WRN("Worker pool already initialized");
+        return true;
+    }
+
+    if (scheduler == nullptr || config.num_workers == 0 ||
+        config.num_workers > MAX_WORKER_THREADS) {
+        LOG_ERR("Invalid worker pool configuration");
+        return false;
+    }
+
+    pool_state.scheduler = scheduler;
+    pool_state.config = config;
+    pool_state.stop_requested = false;
+
+    k_sem_init(&pool_state.work_sem, 0, K_SEM_MAX_LIMIT);
+    k_sem_init(&pool_state.parked_sem, 0, config.num_workers);
+
+    // Workers run at the NORMAL mapping; CRITICAL work is expected to be
+    // rare and short, so we bias the pool toward not starving the app.
+    int priority = worker_thread_priority(cmx::runtime::TaskPriority::NORMAL,
+                                          config.base_priority);
+
+    for (uint32_t i = 0; i < config.num_workers; i++) {
+        pool_state.thread_ids[i] = k_thread_create(
+            &pool_state.threads[i],
+            worker_stacks[i],
+            K_THREAD_STACK_SIZEOF(worker_stacks[i]),
+            worker_entry,
+            (void*)(uintptr_t)i, nullptr, nullptr,
+            priority, 0, K_FOREVER);
+
+        k_thread_name_set(pool_state.thread_ids[i], "cmx_worker");
+
+        if (config.pin_to_cores) {
+            #ifdef CONFIG_SCHED_CPU_MASK
+                uint32_t cpu = (config.first_core + i) % CONFIG_MP_MAX_NUM_CPUS;
+                int ret = k_thread_cpu_pin(pool_state.thread_ids[i], cpu);
+                if (ret != 0) {
+                    LOG_WRN("Failed to pin worker %u to CPU %u: %d", i, cpu, ret);
+                }
+            #else
+                LOG_WRN("Core pinning requested but CONFIG_SCHED_CPU_MASK is off");
+            #endif
+        }
+
+        k_thread_start(pool_state.thread_ids[i]);
+    }
+
+    pool_state.initialized = true;
+    LOG_INF("Worker pool started: %u threads, base priority %d",
+            config.num_workers, config.base_priority);
+    return true;
+}
+
+void workers_notify(size_t task_count) {
+    if (!pool_state.initialized) {
+        return;
+    }
+
+    // Wake at most one worker per task; extra gives would just bounce
+    // workers off an empty queue.
+    size_t wakeups = task_count < pool_state.config.num_workers
+                         ? task_count
+                         : pool_state.config.num_workers;
+    for (size_t i = 0; i < wakeups; i++) {
+        k_sem_give(&pool_state.work_sem);
+    }
+}
+
+bool workers_active() {
+    return pool_state.initialized;
+}
+
+uint32_t workers_get_count() {
+    return pool_state.initialized ? pool_state.config.num_workers : 0;
+}
+
+void workers_shutdown() {
+    if (!pool_state.initialized) {
+        return;
+    }
+
+    pool_state.stop_requested = true;
+
+    // One give per worker so every thread observes the stop flag
+    for (uint32_t i = 0; i < pool_state.config.num_workers; i++) {
+        k_sem_give(&pool_state.work_sem);
+    }
+
+    // Wait for each worker to park, then join it
+    for (uint32_t i = 0; i < pool_state.config.num_workers; i++) {
+        k_sem_take(&pool_state.parked_sem, K_FOREVER);
+    }
+    for (uint32_t i = 0; i < pool_state.config.num_workers; i++) {
+        k_thread_join(pool_state.thread_ids[i], K_FOREVER);
+    }
+
+    pool_state.initialized = false;
+    pool_state.scheduler = nullptr;
+    LOG_INF("Worker pool shut down");
+}
+
+} // namespace cmx::platform::zephyr
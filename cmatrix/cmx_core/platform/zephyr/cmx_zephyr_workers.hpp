@@ -0,0 +1,90 @@
+/**
+ * @file cmx_zephyr_workers.hpp
+ * @brief Persistent scheduler worker threads for Zephyr RTOS
+ *
+ * Provides a pool of long-lived Zephyr threads that drain a CMXScheduler,
+ * so parallel plan execution works out of the box on SMP boards. Workers
+ * are created once at init and parked on a semaphore between inferences;
+ * per-inference thread creation costs more than the parallelism it buys.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "../../runtime/cmx_scheduler.hpp"
+
+namespace cmx::platform::zephyr {
+
+/// Maximum worker threads the pool can host (stacks are statically allocated)
+constexpr uint32_t MAX_WORKER_THREADS = 4;
+
+/**
+ * @brief Worker pool configuration
+ */
+struct WorkerPoolConfig {
+    uint32_t num_workers;       ///< Worker thread count (1..MAX_WORKER_THREADS)
+    int      base_priority;     ///< Zephyr priority for CRITICAL tasks; lower
+                                ///< TaskPriority levels map to base_priority+N
+    bool     pin_to_cores;      ///< Pin worker N to CPU (first_core + N)
+    uint32_t first_core;        ///< First CPU index used when pinning
+};
+
+/**
+ * @brief Default worker pool configuration
+ * @return One worker per CPU (capped at MAX_WORKER_THREADS), pinned from core 0
+ */
+WorkerPoolConfig worker_pool_default_config();
+
+/**
+ * @brief Create the worker pool and attach it to a scheduler
+ * @param scheduler Scheduler the workers drain; must outlive the pool
+ * @param config Pool configuration
+ * @return true if all workers started, false otherwise
+ *
+ * Threads are created once and persist until workers_shutdown(). Core
+ * pinning requires CONFIG_SCHED_CPU_MASK; without it the request is
+ * logged and workers stay floating.
+ */
+bool workers_init(cmx::runtime::CMXScheduler* scheduler, const WorkerPoolConfig& config);
+
+/**
+ * @brief Wake parked workers after submitting tasks
+ * @param task_count Number of tasks just submitted (wakes up to that many workers)
+ *
+ * Call after CMXScheduler::submit_task / submit_range_tasks. Cheap enough
+ * to call per submission; a sleeping pool costs nothing between frames.
+ */
+void workers_notify(size_t task_count = 1);
+
+/**
+ * @brief Map a scheduler task priority to a Zephyr thread priority
+ * @param priority Scheduler priority level
+ * @param base_priority Zephyr priority assigned to CRITICAL
+ * @return Zephyr preemptible priority (numerically higher = less urgent)
+ */
+int worker_thread_priority(cmx::runtime::TaskPriority priority, int base_priority);
+
+/**
+ * @brief Check whether the pool is running
+ * @return true if workers_init() succeeded and workers_shutdown() was not called
+ */
+bool workers_active();
+
+/**
+ * @brief Get the number of running worker threads
+ * @return Worker count, 0 if the pool is not active
+ */
+uint32_t workers_get_count();
+
+/**
+ * @brief Stop and join all worker threads
+ *
+ * Blocks until every worker has parked and exited. The attached
+ * scheduler is not shut down; pending tasks stay queued.
+ */
+void workers_shutdown();
+
+} // namespace cmx::platform::zephyr
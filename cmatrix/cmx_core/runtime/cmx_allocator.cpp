@@ -2,15 +2,18 @@
 #include "cmx_allocator.hpp"
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 
 namespace cmx {
 namespace runtime {
 
-CMXAllocator::CMXAllocator(void* memory_ptr, size_t size) 
-    : memory_start_(memory_ptr), memory_size_(size), offset_(0) {
+CMXAllocator::CMXAllocator(void* memory_ptr, size_t size)
+    : memory_start_(memory_ptr), memory_size_(size), offset_(0),
+      default_alignment_(RuntimeConfig::MEMORY_ALIGNMENT),
+      guards_enabled_(false), guard_count_(0) {
     assert(memory_ptr != nullptr);
     assert(size > 0);
-    
+
     stats_.total_size = size;
 }
 
@@ -18,32 +21,49 @@ void* CMXAllocator::allocate(size_t size, size_t alignment) {
     if (size == 0 || !is_valid()) {
         return nullptr;
     }
-    
-    // Calculate aligned size
-    size_t aligned_size = align_size(size, alignment);
-    
-    // Atomic compare-and-swap loop for thread safety
+
+    const uintptr_t base = reinterpret_cast<uintptr_t>(memory_start_);
+
+    // One guard word past the block end when guards are on and the
+    // record table still has room
+    const bool guard = guards_enabled_ && guard_count_ < MAX_GUARDS;
+    const size_t guard_bytes = guard ? sizeof(uint32_t) : 0;
+
+    // Atomic compare-and-swap loop for thread safety. The alignment
+    // padding is reserved inside the loop so mixed per-allocation
+    // alignments never let an aligned block overrun its reservation.
     size_t current_offset = offset_.load();
+    size_t aligned_offset;
     size_t new_offset;
-    
+
     do {
+        uintptr_t aligned_addr = (base + current_offset + alignment - 1) &
+                                 ~(static_cast<uintptr_t>(alignment) - 1);
+        aligned_offset = static_cast<size_t>(aligned_addr - base);
+
         // Check if we have enough space
-        if (current_offset + aligned_size > memory_size_) {
+        if (aligned_offset + size + guard_bytes > memory_size_) {
             return nullptr; // Out of memory
         }
-        
-        new_offset = current_offset + aligned_size;
+
+        new_offset = aligned_offset + size + guard_bytes;
     } while (!offset_.compare_exchange_weak(current_offset, new_offset));
-    
-    // Calculate aligned pointer
-    void* ptr = static_cast<char*>(memory_start_) + current_offset;
-    void* aligned_ptr = align_pointer(ptr, alignment);
-    
+
+    void* aligned_ptr = static_cast<char*>(memory_start_) + aligned_offset;
+
+    if (guard) {
+        // memcpy because the block end is not necessarily word-aligned
+        const uint32_t pattern = GUARD_PATTERN;
+        std::memcpy(static_cast<char*>(aligned_ptr) + size, &pattern,
+                    sizeof(pattern));
+        guard_offsets_[guard_count_++] = aligned_offset + size;
+    }
+
     // Update statistics
     stats_.used_size = new_offset;
     stats_.peak_usage = std::max(stats_.peak_usage, stats_.used_size);
     stats_.allocation_count++;
-    
+
     return aligned_ptr;
 }
 
@@ -60,6 +80,47 @@ void CMXAllocator::reset() {
     stats_.used_size = 0;
     stats_.allocation_count = 0;
     stats_.deallocation_count = 0;
+    guard_count_ = 0;
+}
+
+bool CMXAllocator::check_guards(size_t* first_bad_offset) const {
+    const char* base = static_cast<const char*>(memory_start_);
+
+    for (size_t i = 0; i < guard_count_; ++i) {
+        uint32_t word;
+        std::memcpy(&word, base + guard_offsets_[i], sizeof(word));
+        if (word != GUARD_PATTERN) {
+            if (first_bad_offset) {
+                *first_bad_offset = guard_offsets_[i];
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+CMXAllocator::Checkpoint CMXAllocator::checkpoint() const {
+    return offset_.load();
+}
+
+void CMXAllocator::rollback(Checkpoint mark) {
+    size_t current = offset_.load();
+
+    // Never roll forward: a stale marker beyond the live offset is a
+    // caller error and is ignored rather than handing out freed space
+    while (mark < current) {
+        if (offset_.compare_exchange_weak(current, mark)) {
+            stats_.used_size = mark;
+
+            // Guards past the rollback point protect freed space;
+            // drop them so check_guards() only reads live memory
+            while (guard_count_ > 0 &&
+                   guard_offsets_[guard_count_ - 1] >= mark) {
+                guard_count_--;
+            }
+            break;
+        }
+    }
 }
 
 CMXAllocator::Stats CMXAllocator::get_stats() const {
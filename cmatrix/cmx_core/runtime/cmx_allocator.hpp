@@ -9,6 +9,34 @@
 namespace cmx {
 namespace runtime {
 
+/**
+ * @brief Named alignment classes for allocations
+ *
+ * Lets callers request exactly the alignment a block needs instead of
+ * over-aligning everything to the widest requirement: tensor data on
+ * cache-line or vector-register boundaries for the SIMD kernels, small
+ * metadata tightly packed.
+ */
+enum class AlignmentClass : uint8_t {
+    PACKED,      ///< Tight packing for small metadata (METADATA_ALIGNMENT)
+    TENSOR,      ///< Default tensor alignment (TENSOR_ALIGNMENT)
+    CACHE_LINE,  ///< Cache-line boundary, e.g. M7 D-cache (CACHE_LINE_ALIGNMENT)
+    VECTOR       ///< Widest vector register, e.g. RISC-V V (MEMORY_ALIGNMENT)
+};
+
+/**
+ * @brief Resolve an alignment class to its byte alignment
+ */
+constexpr size_t alignment_of(AlignmentClass cls) {
+    switch (cls) {
+        case AlignmentClass::PACKED:     return RuntimeConfig::METADATA_ALIGNMENT;
+        case AlignmentClass::TENSOR:     return RuntimeConfig::TENSOR_ALIGNMENT;
+        case AlignmentClass::CACHE_LINE: return RuntimeConfig::CACHE_LINE_ALIGNMENT;
+        case AlignmentClass::VECTOR:     return RuntimeConfig::MEMORY_ALIGNMENT;
+    }
+    return RuntimeConfig::MEMORY_ALIGNMENT;
+}
+
 /**
  * @brief Arena allocator for fixed-size memory blocks
  * 
@@ -56,7 +84,74 @@ public:
      * @return Pointer to allocated memory or nullptr on failure
      */
     void* allocate(size_t size, size_t alignment = RuntimeConfig::MEMORY_ALIGNMENT);
-    
+
+    /**
+     * @brief Allocate a block with a named alignment class
+     * @param size Size in bytes
+     * @param cls Alignment class for this allocation
+     * @return Pointer to allocated memory or nullptr on failure
+     */
+    void* allocate(size_t size, AlignmentClass cls) {
+        return allocate(size, alignment_of(cls));
+    }
+
+    /**
+     * @brief Set the default alignment policy for this arena
+     *
+     * Pools apply a per-pool policy here so tensor-data arenas hand out
+     * cache-line/vector-aligned blocks by default while metadata arenas
+     * stay tightly packed; individual allocations can still override.
+     *
+     * @param cls Alignment class used when allocate() is called without one
+     */
+    void set_default_alignment(AlignmentClass cls) {
+        default_alignment_ = alignment_of(cls);
+    }
+
+    /**
+     * @brief Allocate using the arena's default alignment policy
+     * @param size Size in bytes
+     * @return Pointer to allocated memory or nullptr on failure
+     */
+    void* allocate_default(size_t size) {
+        return allocate(size, default_alignment_);
+    }
+
+    /**
+     * @brief Enable guard bands on subsequent allocations
+     *
+     * Each allocation reserves one extra guard word past its end and
+     * fills it with GUARD_PATTERN; the word sits in the padding the
+     * next allocation's alignment would mostly reserve anyway. Unlike
+     * per-allocation debug checks this costs one word write at
+     * allocation time and nothing during kernel execution, so it can
+     * stay on in release builds: verify once per inference (or from a
+     * watchdog) with check_guards(). An overwritten arena then raises
+     * a definite signal instead of silently wrong predictions.
+     *
+     * @param enable true to guard subsequent allocations
+     */
+    void set_guard_bands(bool enable) { guards_enabled_ = enable; }
+
+    /**
+     * @brief Verify every live guard word in one pass
+     *
+     * Call at the end of an inference (after the last consumer of the
+     * arena ran) or from a watchdog. A corrupted guard means the block
+     * ending at that boundary was overrun.
+     *
+     * @param first_bad_offset Arena offset of the first corrupted
+     *        guard, written only on failure (may be nullptr)
+     * @return true if all guards are intact
+     */
+    bool check_guards(size_t* first_bad_offset = nullptr) const;
+
+    /**
+     * @brief Get the number of live guarded allocations
+     * @return Guard count (capped at MAX_GUARDS)
+     */
+    size_t guard_count() const { return guard_count_; }
+
     /**
      * @brief Deallocate memory block
      * @param ptr Pointer to memory to deallocate
@@ -69,7 +164,31 @@ public:
      * @note Invalidates all previously allocated pointers
      */
     void reset();
-    
+
+    /**
+     * @brief Opaque arena position marker for checkpoint/rollback
+     */
+    using Checkpoint = size_t;
+
+    /**
+     * @brief Capture the current arena position
+     *
+     * Take a checkpoint after one-time allocations (weights, persistent
+     * state) and roll back to it after each inference to release every
+     * scratch allocation in O(1) without disturbing the long-lived ones.
+     *
+     * @return Marker for the current position
+     */
+    Checkpoint checkpoint() const;
+
+    /**
+     * @brief Roll the arena back to a previously taken checkpoint
+     * @param mark Marker returned by checkpoint()
+     * @note Invalidates every pointer allocated after the checkpoint.
+     *       Markers taken after this point become stale as well.
+     */
+    void rollback(Checkpoint mark);
+
     /**
      * @brief Get current allocation statistics
      */
@@ -86,10 +205,17 @@ public:
     size_t available_memory() const;
 
 private:
+    static constexpr uint32_t GUARD_PATTERN = 0x47554152; // "GUAR"
+    static constexpr size_t MAX_GUARDS = 128;             // Guarded blocks per arena
+
     void* memory_start_;        // Start of memory arena
     size_t memory_size_;        // Total size of memory arena
     std::atomic<size_t> offset_; // Current allocation offset
+    size_t default_alignment_;  // Policy alignment for allocate_default()
     mutable Stats stats_;       // Allocation statistics
+    bool guards_enabled_;       // Guard subsequent allocations
+    size_t guard_count_;        // Live guard records
+    size_t guard_offsets_[MAX_GUARDS]; // Arena offset of each guard word
     
     /**
      * @brief Align pointer to specified boundary
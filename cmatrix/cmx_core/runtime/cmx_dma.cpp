@@ -1,4 +1,179 @@
 // cmx_dma.cpp
 // CMatrix Framework Implementation
 
+#include "cmx_dma.hpp"
+#include <cstring>
 
+namespace cmx {
+namespace runtime {
+
+namespace {
+
+CMXDmaExecuteFn g_dma_backend = nullptr;
+CMXDmaSubmitFn g_dma_submit = nullptr;
+CMXDmaPollFn g_dma_poll = nullptr;
+bool g_dma_in_flight = false;
+bool g_dma_polled = false;
+CMXDmaIdleFn g_dma_idle_fn = nullptr;
+void* g_dma_idle_user = nullptr;
+CMXDmaSetPriorityFn g_dma_priority_fn = nullptr;
+CMXDmaPriority g_dma_priority = CMXDmaPriority::NORMAL;
+
+bool cpu_execute_chain(const CMXDmaDescriptor* chain) {
+    for (const CMXDmaDescriptor* desc = chain; desc; desc = desc->next) {
+        if (!desc->dst || !desc->src || desc->row_bytes == 0) {
+            return false;
+        }
+
+        uint8_t* dst = static_cast<uint8_t*>(desc->dst);
+        const uint8_t* src = static_cast<const uint8_t*>(desc->src);
+        for (size_t row = 0; row < desc->row_count; ++row) {
+            std::memcpy(dst, src, desc->row_bytes);
+            dst += desc->dst_stride;
+            src += desc->src_stride;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+void cmx_dma_register_backend(CMXDmaExecuteFn fn) {
+    g_dma_backend = fn;
+}
+
+bool cmx_dma_backend_available() {
+    return g_dma_backend != nullptr;
+}
+
+bool cmx_dma_execute(const CMXDmaDescriptor* chain) {
+    if (!chain) {
+        return false;
+    }
+
+    // Try the platform engine first; fall back to the CPU row loop so
+    // a missing or busy engine degrades performance, not correctness
+    if (g_dma_backend && g_dma_backend(chain)) {
+        return true;
+    }
+    return cpu_execute_chain(chain);
+}
+
+void cmx_dma_register_async_backend(CMXDmaSubmitFn submit, CMXDmaPollFn poll) {
+    // Registering one half without the other would leave submitted
+    // chains unobservable; treat that as unregistration
+    if (!submit || !poll) {
+        g_dma_submit = nullptr;
+        g_dma_poll = nullptr;
+        return;
+    }
+    g_dma_submit = submit;
+    g_dma_poll = poll;
+}
+
+bool cmx_dma_async_available() {
+    return g_dma_submit != nullptr;
+}
+
+void cmx_dma_set_polled_mode(bool enable) {
+    g_dma_polled = enable;
+}
+
+bool cmx_dma_polled_mode() {
+    return g_dma_polled;
+}
+
+bool cmx_dma_submit(const CMXDmaDescriptor* chain) {
+    if (!chain) {
+        return false;
+    }
+
+    // Only one chain can be in flight; retire the previous one first
+    if (g_dma_in_flight && !cmx_dma_wait_async()) {
+        return false;
+    }
+
+    // Polled mode trades the compute overlap for fixed timing: the
+    // chain finishes here, never on a later interrupt
+    if (g_dma_polled) {
+        return cmx_dma_execute(chain);
+    }
+
+    if (g_dma_submit && g_dma_submit(chain)) {
+        g_dma_in_flight = true;
+        return true;
+    }
+
+    // No async engine (or it refused the chain): run it now so the
+    // caller's wait becomes a no-op
+    return cmx_dma_execute(chain);
+}
+
+bool cmx_dma_async_complete() {
+    if (!g_dma_in_flight) {
+        return true;
+    }
+    if (g_dma_poll && g_dma_poll()) {
+        g_dma_in_flight = false;
+        return true;
+    }
+    return false;
+}
+
+bool cmx_dma_wait_async() {
+    while (!cmx_dma_async_complete()) {
+        // Hand the wait time to the idle hook so the scheduler can run
+        // ready work instead of burning the transfer time; without a
+        // hook this degenerates to the spin, which the engines this
+        // targets finish in well under a millisecond anyway
+        if (g_dma_idle_fn) {
+            g_dma_idle_fn(g_dma_idle_user);
+        }
+    }
+    return true;
+}
+
+void cmx_dma_set_idle_hook(CMXDmaIdleFn fn, void* user) {
+    g_dma_idle_fn = fn;
+    g_dma_idle_user = user;
+}
+
+void cmx_dma_register_priority_backend(CMXDmaSetPriorityFn fn) {
+    g_dma_priority_fn = fn;
+    if (g_dma_priority_fn) {
+        g_dma_priority_fn(g_dma_priority);
+    }
+}
+
+void cmx_dma_set_request_priority(CMXDmaPriority priority) {
+    // Skip redundant backend calls: the scheduler sets this per chain,
+    // and consecutive chains usually belong to the same plan
+    if (priority == g_dma_priority) {
+        return;
+    }
+    g_dma_priority = priority;
+    if (g_dma_priority_fn) {
+        g_dma_priority_fn(priority);
+    }
+}
+
+CMXDmaPriority cmx_dma_request_priority() {
+    return g_dma_priority;
+}
+
+bool cmx_dma_copy_2d(void* dst, size_t dst_stride,
+                     const void* src, size_t src_stride,
+                     size_t row_bytes, size_t row_count) {
+    CMXDmaDescriptor desc = {};
+    desc.dst = dst;
+    desc.src = src;
+    desc.row_bytes = row_bytes;
+    desc.row_count = row_count;
+    desc.src_stride = src_stride;
+    desc.dst_stride = dst_stride;
+    desc.next = nullptr;
+    return cmx_dma_execute(&desc);
+}
+
+} // namespace runtime
+} // namespace cmx
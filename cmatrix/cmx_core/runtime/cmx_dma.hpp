@@ -3,4 +3,232 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 
+namespace cmx {
+namespace runtime {
+
+/**
+ * @brief 2D strided transfer descriptor
+ *
+ * Describes row_count rows of row_bytes contiguous bytes each; after
+ * every row the source address advances by src_stride and the
+ * destination by dst_stride (both in bytes, measured start-to-start).
+ * This covers the strided patterns in the layout converters — NHWC
+ * channel-slice extraction, im2col patch gathers, output de-padding —
+ * as a single descriptor instead of a CPU loop. A plain linear copy is
+ * the degenerate case row_count == 1.
+ *
+ * Descriptors chain through next into a scatter-gather list that is
+ * submitted as one transfer, so an entire layout conversion can run on
+ * the DMA engine concurrently with compute.
+ */
+struct CMXDmaDescriptor {
+    void* dst;                      ///< Destination of the first row
+    const void* src;                ///< Source of the first row
+    size_t row_bytes;               ///< Contiguous bytes per row
+    size_t row_count;               ///< Number of rows
+    size_t src_stride;              ///< Source row-to-row stride in bytes
+    size_t dst_stride;              ///< Destination row-to-row stride in bytes
+    const CMXDmaDescriptor* next;   ///< Next descriptor in the chain, nullptr ends it
+};
+
+/**
+ * @brief Platform hook executing one descriptor chain synchronously
+ * @param chain Head of the descriptor chain
+ * @return true if the whole chain was transferred
+ */
+using CMXDmaExecuteFn = bool (*)(const CMXDmaDescriptor* chain);
+
+/**
+ * @brief Plug a platform DMA engine into the runtime
+ *
+ * Platform ports (Cortex-M, Nios II SGDMA, ...) register their chain
+ * executor at init. Until one is registered — or whenever it reports
+ * failure — cmx_dma_execute falls back to a CPU row loop, so callers
+ * never need platform-specific branches.
+ *
+ * @param fn Chain executor, nullptr to unregister
+ */
+void cmx_dma_register_backend(CMXDmaExecuteFn fn);
+
+/**
+ * @brief Check whether a platform DMA engine is registered
+ *
+ * Lets callers with an efficient CPU path of their own skip building
+ * descriptor chains when they would only reach the CPU fallback.
+ *
+ * @return true if a backend is registered
+ */
+bool cmx_dma_backend_available();
+
+/**
+ * @brief Execute a descriptor chain (blocking)
+ * @param chain Head of the descriptor chain
+ * @return true if every descriptor was transferred
+ */
+bool cmx_dma_execute(const CMXDmaDescriptor* chain);
+
+/**
+ * @brief Platform hooks for asynchronous chain execution
+ *
+ * submit starts the chain and returns immediately; poll reports whether
+ * the last submitted chain has finished. One chain may be in flight at
+ * a time, matching the single memory-to-memory channel on the engines
+ * this targets. Register both together, nullptr to unregister.
+ */
+using CMXDmaSubmitFn = bool (*)(const CMXDmaDescriptor* chain);
+using CMXDmaPollFn = bool (*)();
+
+void cmx_dma_register_async_backend(CMXDmaSubmitFn submit, CMXDmaPollFn poll);
+
+/**
+ * @brief Check whether an asynchronous engine is registered
+ *
+ * Callers that would have to keep a descriptor chain alive across the
+ * overlap window can skip building it when submission would only run
+ * synchronously anyway.
+ *
+ * @return true if an async backend is registered
+ */
+bool cmx_dma_async_available();
+
+/**
+ * @brief Pin DMA to polled (synchronous) execution
+ *
+ * While enabled, cmx_dma_submit bypasses the async backend and runs
+ * every chain to completion before returning, so no transfer ever
+ * rides an interrupt or overlaps compute. Deterministic execution mode
+ * uses this to take completion-timing jitter out of the run; the cost
+ * is losing the overlap the async path exists for, so leave it off in
+ * throughput builds.
+ *
+ * @param enable true to force synchronous execution
+ */
+void cmx_dma_set_polled_mode(bool enable);
+
+/**
+ * @brief Check whether polled mode is pinned
+ * @return true if cmx_dma_submit runs chains synchronously
+ */
+bool cmx_dma_polled_mode();
+
+/**
+ * @brief Start a descriptor chain without waiting for completion
+ *
+ * The chain memory must stay valid until cmx_dma_wait_async returns.
+ * Without an async backend the chain executes synchronously before
+ * returning, so overlap is opportunistic and callers stay correct on
+ * every platform.
+ *
+ * @param chain Head of the descriptor chain
+ * @return true if the chain was started (or completed synchronously)
+ */
+bool cmx_dma_submit(const CMXDmaDescriptor* chain);
+
+/**
+ * @brief Check whether the submitted chain has finished
+ * @return true if no chain is in flight
+ */
+bool cmx_dma_async_complete();
+
+/**
+ * @brief Block until the submitted chain has finished
+ * @return true once the destination holds the transferred data
+ */
+bool cmx_dma_wait_async();
+
+/**
+ * @brief Hook invoked while a completion wait would otherwise spin
+ *
+ * cmx_dma_wait_async calls the hook once per poll iteration, so the
+ * cycles the CPU used to burn on the completion flag can run queued
+ * work instead — CMXScheduler registers itself here to execute ready
+ * tasks while a transfer is on the wire. The hook must not itself
+ * block on DMA completion, or the wait it was called from can never
+ * make progress.
+ */
+using CMXDmaIdleFn = void (*)(void* user);
+
+/**
+ * @brief Register the wait-loop idle hook
+ *
+ * With no hook registered cmx_dma_wait_async falls back to the plain
+ * spin, so standalone uses of the DMA layer need no setup.
+ *
+ * @param fn Idle hook, nullptr to unregister
+ * @param user Opaque argument passed to fn
+ */
+void cmx_dma_set_idle_hook(CMXDmaIdleFn fn, void* user);
+
+/**
+ * @brief Priority of subsequent DMA requests
+ *
+ * Values mirror the scheduler's TaskPriority so a plan's priority
+ * carries into the memory system: when a CRITICAL wake-word model and
+ * a LOW analytics model stream weights concurrently, the platform
+ * engine can arbitrate their transfers instead of serving them
+ * equally.
+ */
+enum class CMXDmaPriority : uint8_t {
+    LOW = 0,
+    NORMAL = 1,
+    HIGH = 2,
+    CRITICAL = 3
+};
+
+/**
+ * @brief Platform hook applying a request priority to the engine
+ *
+ * Ports map the four levels onto whatever their arbiter understands —
+ * the stream priority-level bits on Cortex-M controllers, channel
+ * arbitration priority on the ESP32 GDMA. Optional: without a hook,
+ * priority requests are recorded but transfers arbitrate as before.
+ */
+using CMXDmaSetPriorityFn = void (*)(CMXDmaPriority priority);
+
+/**
+ * @brief Register the priority hook
+ *
+ * The current request priority is pushed to the hook immediately, so a
+ * backend registered after the scheduler has raised the priority still
+ * starts from the right level.
+ *
+ * @param fn Priority hook, nullptr to unregister
+ */
+void cmx_dma_register_priority_backend(CMXDmaSetPriorityFn fn);
+
+/**
+ * @brief Set the priority for subsequent submissions
+ *
+ * Applies to every cmx_dma_execute / cmx_dma_submit call until
+ * changed. The scheduler calls this with the owning task's priority
+ * before each chain it puts on the wire.
+ *
+ * @param priority Requested priority level
+ */
+void cmx_dma_set_request_priority(CMXDmaPriority priority);
+
+/**
+ * @brief Get the current request priority
+ * @return Priority applied to subsequent submissions
+ */
+CMXDmaPriority cmx_dma_request_priority();
+
+/**
+ * @brief Convenience wrapper for a single 2D strided copy
+ * @param dst Destination of the first row
+ * @param dst_stride Destination row-to-row stride in bytes
+ * @param src Source of the first row
+ * @param src_stride Source row-to-row stride in bytes
+ * @param row_bytes Contiguous bytes per row
+ * @param row_count Number of rows
+ * @return true if the copy completed
+ */
+bool cmx_dma_copy_2d(void* dst, size_t dst_stride,
+                     const void* src, size_t src_stride,
+                     size_t row_bytes, size_t row_count);
+
+} // namespace runtime
+} // namespace cmx
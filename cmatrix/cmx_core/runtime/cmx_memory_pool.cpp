@@ -44,11 +44,150 @@ bool CMXMemoryPool::initialize(size_t total_size) {
     memory_ptr += temp_size;
     
     general_allocator_ = std::make_unique<CMXAllocator>(memory_ptr, general_size);
-    
+
+    // Default alignment policy: tensor data and temp buffers land on
+    // vector-register boundaries (which also covers cache lines) for
+    // the SIMD kernels; general metadata stays tightly packed.
+    tensor_allocator_->set_default_alignment(AlignmentClass::VECTOR);
+    temp_buffer_allocator_->set_default_alignment(AlignmentClass::VECTOR);
+    general_allocator_->set_default_alignment(AlignmentClass::PACKED);
+
     initialized_ = true;
     return true;
 }
 
+bool CMXMemoryPool::initialize_from_regions(const MemoryRegion* regions, size_t region_count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (initialized_) {
+        return true; // Already initialized
+    }
+
+    if (!regions || region_count == 0 || region_count > MAX_MEMORY_REGIONS) {
+        return false;
+    }
+
+    // Sort spans largest-first; the biggest allocations (tensor data)
+    // should land in the biggest span
+    MemoryRegion sorted[MAX_MEMORY_REGIONS];
+    size_t total_size = 0;
+    for (size_t i = 0; i < region_count; ++i) {
+        if (!regions[i].base || regions[i].size == 0) {
+            return false;
+        }
+        sorted[i] = regions[i];
+        total_size += regions[i].size;
+    }
+    std::sort(sorted, sorted + region_count,
+              [](const MemoryRegion& a, const MemoryRegion& b) {
+                  return a.size > b.size;
+              });
+
+    if (region_count >= 3) {
+        // One span per pool; everything beyond the third becomes an
+        // overflow tensor arena
+        tensor_allocator_ = std::make_unique<CMXAllocator>(sorted[0].base, sorted[0].size);
+        temp_buffer_allocator_ = std::make_unique<CMXAllocator>(sorted[1].base, sorted[1].size);
+        general_allocator_ = std::make_unique<CMXAllocator>(sorted[2].base, sorted[2].size);
+        for (size_t i = 3; i < region_count; ++i) {
+            extra_tensor_allocators_.push_back(
+                std::make_unique<CMXAllocator>(sorted[i].base, sorted[i].size));
+        }
+    } else if (region_count == 2) {
+        // Tensor pool takes the larger span whole; the smaller one is
+        // split between temp buffers and general metadata at the same
+        // 25:15 ratio as the contiguous path
+        tensor_allocator_ = std::make_unique<CMXAllocator>(sorted[0].base, sorted[0].size);
+        size_t temp_size = (sorted[1].size * 62) / 100;
+        temp_buffer_allocator_ = std::make_unique<CMXAllocator>(sorted[1].base, temp_size);
+        general_allocator_ = std::make_unique<CMXAllocator>(
+            static_cast<char*>(sorted[1].base) + temp_size, sorted[1].size - temp_size);
+    } else {
+        // Single span: same split as initialize(), but over borrowed memory
+        size_t tensor_size, temp_size, general_size;
+        calculate_pool_sizes(sorted[0].size, tensor_size, temp_size, general_size);
+
+        char* memory_ptr = static_cast<char*>(sorted[0].base);
+        tensor_allocator_ = std::make_unique<CMXAllocator>(memory_ptr, tensor_size);
+        memory_ptr += tensor_size;
+        temp_buffer_allocator_ = std::make_unique<CMXAllocator>(memory_ptr, temp_size);
+        memory_ptr += temp_size;
+        general_allocator_ = std::make_unique<CMXAllocator>(memory_ptr, general_size);
+    }
+
+    total_memory_size_ = total_size;
+
+    // Same default alignment policy as the contiguous path
+    tensor_allocator_->set_default_alignment(AlignmentClass::VECTOR);
+    temp_buffer_allocator_->set_default_alignment(AlignmentClass::VECTOR);
+    general_allocator_->set_default_alignment(AlignmentClass::PACKED);
+    for (auto& extra : extra_tensor_allocators_) {
+        extra->set_default_alignment(AlignmentClass::VECTOR);
+    }
+
+    initialized_ = true;
+    return true;
+}
+
+CMXAllocator* CMXMemoryPool::get_tensor_region(size_t min_available) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!initialized_) {
+        return nullptr;
+    }
+
+    if (tensor_allocator_->available_memory() >= min_available) {
+        return tensor_allocator_.get();
+    }
+    for (auto& extra : extra_tensor_allocators_) {
+        if (extra->available_memory() >= min_available) {
+            return extra.get();
+        }
+    }
+    return nullptr;
+}
+
+bool CMXMemoryPool::set_pool_alignment(PoolType pool_type, AlignmentClass cls) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!initialized_) {
+        return false;
+    }
+
+    switch (pool_type) {
+        case PoolType::TENSOR_POOL:
+            tensor_allocator_->set_default_alignment(cls);
+            return true;
+        case PoolType::TEMP_BUFFER_POOL:
+            temp_buffer_allocator_->set_default_alignment(cls);
+            return true;
+        case PoolType::GENERAL_POOL:
+            general_allocator_->set_default_alignment(cls);
+            return true;
+        case PoolType::FAST_SCRATCH_POOL:
+            if (!fast_scratch_allocator_) {
+                return false;
+            }
+            fast_scratch_allocator_->set_default_alignment(cls);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool CMXMemoryPool::attach_fast_region(void* base, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!initialized_ || !base || size == 0) {
+        return false;
+    }
+
+    fast_scratch_allocator_ = std::make_unique<CMXAllocator>(base, size);
+    // Fast scratch serves the SIMD kernels' hottest working buffers
+    fast_scratch_allocator_->set_default_alignment(AlignmentClass::VECTOR);
+    return true;
+}
+
 void CMXMemoryPool::shutdown() {
     std::lock_guard<std::mutex> lock(mutex_);
     
@@ -60,7 +199,9 @@ void CMXMemoryPool::shutdown() {
     tensor_allocator_.reset();
     temp_buffer_allocator_.reset();
     general_allocator_.reset();
-    
+    fast_scratch_allocator_.reset();
+    extra_tensor_allocators_.clear();
+
     // Free main memory block
     memory_block_.reset();
     total_memory_size_ = 0;
@@ -81,6 +222,11 @@ CMXAllocator* CMXMemoryPool::get_allocator(PoolType pool_type) {
             return temp_buffer_allocator_.get();
         case PoolType::GENERAL_POOL:
             return general_allocator_.get();
+        case PoolType::FAST_SCRATCH_POOL:
+            // Fall back to the temp-buffer pool when no fast region is
+            // attached so callers need no platform-specific branches
+            return fast_scratch_allocator_ ? fast_scratch_allocator_.get()
+                                           : temp_buffer_allocator_.get();
         default:
             return nullptr;
     }
@@ -96,6 +242,12 @@ void CMXMemoryPool::free_all() {
     tensor_allocator_->reset();
     temp_buffer_allocator_->reset();
     general_allocator_->reset();
+    if (fast_scratch_allocator_) {
+        fast_scratch_allocator_->reset();
+    }
+    for (auto& extra : extra_tensor_allocators_) {
+        extra->reset();
+    }
 }
 
 CMXMemoryPool::MemoryStats CMXMemoryPool::get_memory_stats() const {
@@ -114,6 +266,9 @@ CMXMemoryPool::MemoryStats CMXMemoryPool::get_memory_stats() const {
     auto general_stats = general_allocator_->get_stats();
     
     stats.tensor_pool_used = tensor_stats.used_size;
+    for (const auto& extra : extra_tensor_allocators_) {
+        stats.tensor_pool_used += extra->get_stats().used_size;
+    }
     stats.temp_buffer_used = temp_stats.used_size;
     stats.general_pool_used = general_stats.used_size;
     stats.peak_usage = tensor_stats.peak_usage + temp_stats.peak_usage + general_stats.peak_usage;
@@ -5,29 +5,67 @@
 #include "cmx_runtime_config.hpp"
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace cmx {
 namespace runtime {
 
 /**
- * @brief Centralized memory pool manager
- * 
+ * @brief Memory pool manager
+ *
  * Manages multiple memory pools for different purposes:
  * - Tensor data pool
  * - Temporary buffer pool
  * - General purpose pool
+ *
+ * Pools are instantiable so each inference context can own an isolated
+ * pool: two models running side by side never contend on one mutex or
+ * fragment each other's arenas. getInstance() remains available as the
+ * process-wide default pool for single-context callers.
  */
 class CMXMemoryPool {
 public:
+    /**
+     * @brief Construct an uninitialized per-context pool
+     *
+     * Call initialize() before use. Prefer one pool per inference
+     * context over the shared getInstance() pool.
+     */
+    CMXMemoryPool() = default;
+    ~CMXMemoryPool();
+
+    // Non-copyable, non-movable
+    CMXMemoryPool(const CMXMemoryPool&) = delete;
+    CMXMemoryPool& operator=(const CMXMemoryPool&) = delete;
+    CMXMemoryPool(CMXMemoryPool&&) = delete;
+    CMXMemoryPool& operator=(CMXMemoryPool&&) = delete;
+
     /**
      * @brief Memory pool types
      */
     enum class PoolType {
         TENSOR_POOL,
         TEMP_BUFFER_POOL,
-        GENERAL_POOL
+        GENERAL_POOL,
+        FAST_SCRATCH_POOL  ///< Tier-pinned scratch (DTCM etc.), see attach_fast_region()
     };
     
+    /**
+     * @brief One caller-provided memory span for multi-region arenas
+     *
+     * On parts where free RAM is fragmented (e.g. ESP32 internal RAM
+     * after the WiFi stack claims its buffers), a single contiguous
+     * arena of the required size may not exist even though the total
+     * does. Regions let the pool be built from several smaller spans.
+     */
+    struct MemoryRegion {
+        void* base;     ///< Start of the span; referenced, not owned
+        size_t size;    ///< Span size in bytes
+    };
+
+    /// Maximum spans accepted by initialize_from_regions()
+    static constexpr size_t MAX_MEMORY_REGIONS = 8;
+
     /**
      * @brief Memory usage statistics
      */
@@ -40,17 +78,51 @@ public:
     };
     
     /**
-     * @brief Get singleton instance
+     * @brief Get the process-wide default pool
+     *
+     * Retained for single-context callers; multi-model applications
+     * should construct one CMXMemoryPool per context instead.
      */
     static CMXMemoryPool& getInstance();
-    
+
     /**
      * @brief Initialize memory pools
      * @param total_size Total memory size to allocate
      * @return True on success, false on failure
      */
     bool initialize(size_t total_size = CMX_MEMORY_POOL_SIZE);
-    
+
+    /**
+     * @brief Initialize the pools over several caller-owned memory spans
+     *
+     * Regions are assigned largest-first: the biggest span backs the
+     * tensor pool (which sees the largest allocations), the next ones
+     * back the temp-buffer and general pools, and any further spans
+     * become overflow tensor arenas reachable through
+     * get_tensor_region(). With fewer than three regions the smallest
+     * span is split between the remaining pools. Unlike initialize(),
+     * the memory is referenced, not owned - every span must outlive the
+     * pool, same rule as attach_fast_region().
+     *
+     * @param regions Array of memory spans
+     * @param region_count Number of spans (1..MAX_MEMORY_REGIONS)
+     * @return True on success, false on failure
+     */
+    bool initialize_from_regions(const MemoryRegion* regions, size_t region_count);
+
+    /**
+     * @brief Get a tensor arena with at least min_available bytes free
+     *
+     * Walks the tensor arenas largest-first (primary pool, then the
+     * overflow regions), so a placer that assigns its largest tensors
+     * first naturally packs them into the largest spans.
+     *
+     * @param min_available Bytes the caller is about to allocate
+     * @return Allocator with enough room, nullptr if none has it
+     */
+    CMXAllocator* get_tensor_region(size_t min_available);
+
+
     /**
      * @brief Shutdown and cleanup memory pools
      */
@@ -62,7 +134,36 @@ public:
      * @return Pointer to allocator or nullptr if not initialized
      */
     CMXAllocator* get_allocator(PoolType pool_type = PoolType::GENERAL_POOL);
-    
+
+    /**
+     * @brief Set the default alignment policy of one pool
+     *
+     * initialize() applies the built-in policy (tensor and temp-buffer
+     * pools on vector-register boundaries for the SIMD kernels, general
+     * pool tightly packed); targets with different cache-line or vector
+     * widths can override per pool afterwards.
+     *
+     * @param pool_type Pool whose policy to change
+     * @param cls Alignment class for the pool's default allocations
+     * @return True on success, false if not initialized
+     */
+    bool set_pool_alignment(PoolType pool_type, AlignmentClass cls);
+
+    /**
+     * @brief Back the fast-scratch pool with a platform fast-memory window
+     *
+     * The window (DTCM on Cortex-M7, internal RAM on ESP32) comes from
+     * the platform memory layer and is referenced, not owned: it must
+     * outlive the pool. Until a region is attached, the fast-scratch
+     * pool falls back to the temp-buffer pool so kernels requesting it
+     * still run, just without the bandwidth win.
+     *
+     * @param base Base address of the fast-memory window
+     * @param size Window size in bytes
+     * @return True on success, false if not initialized or args invalid
+     */
+    bool attach_fast_region(void* base, size_t size);
+
     /**
      * @brief Free all memory in all pools
      */
@@ -79,15 +180,6 @@ public:
     MemoryStats get_memory_stats() const;
 
 private:
-    CMXMemoryPool() = default;
-    ~CMXMemoryPool();
-    
-    // Non-copyable, non-movable
-    CMXMemoryPool(const CMXMemoryPool&) = delete;
-    CMXMemoryPool& operator=(const CMXMemoryPool&) = delete;
-    CMXMemoryPool(CMXMemoryPool&&) = delete;
-    CMXMemoryPool& operator=(CMXMemoryPool&&) = delete;
-    
     bool initialized_ = false;
     std::unique_ptr<char[]> memory_block_;
     size_t total_memory_size_ = 0;
@@ -96,7 +188,9 @@ private:
     std::unique_ptr<CMXAllocator> tensor_allocator_;
     std::unique_ptr<CMXAllocator> temp_buffer_allocator_;
     std::unique_ptr<CMXAllocator> general_allocator_;
-    
+    std::unique_ptr<CMXAllocator> fast_scratch_allocator_;  ///< Over an attached fast region
+    std::vector<std::unique_ptr<CMXAllocator>> extra_tensor_allocators_;  ///< Overflow tensor regions, largest-first
+
     mutable std::mutex mutex_;
     
     /**
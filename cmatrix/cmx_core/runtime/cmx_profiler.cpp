@@ -1,10 +1,99 @@
 #include "cmx_profiler.hpp"
+
+// This whole translation unit compiles away when profiling is disabled:
+// the header provides inline no-op stubs for every class defined here,
+// so disabled builds link no profiler object code at all. The timer and
+// the per-core counters are header-only and need nothing from this file.
+#if CMX_PROFILING_ENABLED
+
 #include <algorithm>
 #include <cstdio>
 
 namespace cmx {
 namespace runtime {
 
+// CMXTraceRing static storage
+CMXTraceRing::Ring CMXTraceRing::rings_[CMX_TRACE_MAX_CORES] = {};
+const char* CMXTraceRing::labels_[CMXTraceRing::MAX_LABELS] = {};
+std::atomic<uint16_t> CMXTraceRing::label_count_{0};
+
+uint16_t CMXTraceRing::intern(const char* label) {
+    if (!label) {
+        return INVALID_LABEL;
+    }
+
+    // Fast path: literals intern to the same pointer, so pointer
+    // comparison usually hits before strcmp is needed
+    uint16_t count = label_count_.load(std::memory_order_acquire);
+    for (uint16_t i = 0; i < count; ++i) {
+        if (labels_[i] == label ||
+            (labels_[i] && std::strcmp(labels_[i], label) == 0)) {
+            return i;
+        }
+    }
+
+    uint16_t index = label_count_.fetch_add(1, std::memory_order_acq_rel);
+    if (index >= MAX_LABELS) {
+        return INVALID_LABEL;
+    }
+    labels_[index] = label;
+    return index;
+}
+
+const char* CMXTraceRing::label_name(uint16_t label_id) {
+    if (label_id >= label_count_.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    return labels_[label_id];
+}
+
+void CMXTraceRing::record(uint16_t label_id,
+                          HighResTimer::TimePoint t_start,
+                          HighResTimer::TimePoint t_end) {
+    if (label_id == INVALID_LABEL) {
+        return;
+    }
+
+    Ring& ring = rings_[current_core()];
+    uint32_t slot = ring.write_index.fetch_add(1, std::memory_order_relaxed)
+                  & (CMX_TRACE_RING_SIZE - 1);
+    ring.events[slot].label_id = label_id;
+    ring.events[slot].t_start = t_start;
+    ring.events[slot].t_end = t_end;
+}
+
+size_t CMXTraceRing::drain(uint32_t core, TraceEvent* out, size_t max_events) {
+    if (core >= CMX_TRACE_MAX_CORES || !out || max_events == 0) {
+        return 0;
+    }
+
+    Ring& ring = rings_[core];
+    uint32_t write = ring.write_index.load(std::memory_order_acquire);
+    uint32_t available = write - ring.read_index;
+
+    // If the writer lapped us, the oldest unread events are gone;
+    // resume from the oldest still in the ring
+    if (available > CMX_TRACE_RING_SIZE) {
+        ring.read_index = write - CMX_TRACE_RING_SIZE;
+        available = CMX_TRACE_RING_SIZE;
+    }
+
+    size_t copied = 0;
+    while (copied < max_events && ring.read_index != write) {
+        out[copied++] = ring.events[ring.read_index & (CMX_TRACE_RING_SIZE - 1)];
+        ring.read_index++;
+    }
+    return copied;
+}
+
+void CMXTraceRing::clear() {
+    for (uint32_t core = 0; core < CMX_TRACE_MAX_CORES; ++core) {
+        rings_[core].write_index.store(0, std::memory_order_relaxed);
+        rings_[core].read_index = 0;
+    }
+    label_count_.store(0, std::memory_order_release);
+}
+
 void ProfileReport::sort_by_total_time() {
     std::sort(entries, entries + entry_count, 
               [](const ProfileEntry& a, const ProfileEntry& b) {
@@ -26,9 +115,13 @@ void ProfileReport::sort_by_call_count() {
               });
 }
 
-CMXProfiler::CMXProfiler(bool enabled) 
+CMXProfiler::CMXProfiler(bool enabled)
     : entry_count_(0), is_enabled_(enabled) {
     session_start_time_ = HighResTimer::now();
+    std::memset(open_depth_, 0, sizeof(open_depth_));
+    for (uint32_t core = 0; core < CMX_TRACE_MAX_CORES; ++core) {
+        busy_ticks_[core].store(0, std::memory_order_relaxed);
+    }
 }
 
 CMXProfiler::~CMXProfiler() {
@@ -41,37 +134,65 @@ void CMXProfiler::set_enabled(bool enabled) {
 }
 
 void CMXProfiler::start(const char* label) {
-#if CMX_PROFILING_ENABLED
     if (!is_enabled_ || !label) {
         return;
     }
-    
-    std::lock_guard<std::mutex> lock(profile_mutex_);
-    
-    ProfileEntry* entry = find_entry(label);
-    if (!entry) {
-        entry = create_entry(label);
+
+    // Wait-free: intern the label, read the clock, push onto the
+    // calling core's stack. No locks, safe from ISR context.
+    uint16_t label_id = CMXTraceRing::intern(label);
+    if (label_id == CMXTraceRing::INVALID_LABEL) {
+        return;
     }
-    
-    if (entry) {
-        entry->start();
+
+    uint32_t core = CMXTraceRing::current_core();
+    if (open_depth_[core] >= MAX_SCOPE_DEPTH) {
+        return;
     }
-#endif
+
+    OpenScope& scope = open_scopes_[core][open_depth_[core]++];
+    scope.label_id = label_id;
+    scope.t_start = HighResTimer::now();
 }
 
 void CMXProfiler::stop(const char* label) {
-#if CMX_PROFILING_ENABLED
     if (!is_enabled_ || !label) {
         return;
     }
-    
-    std::lock_guard<std::mutex> lock(profile_mutex_);
-    
-    ProfileEntry* entry = find_entry(label);
-    if (entry) {
-        entry->stop();
+
+    HighResTimer::TimePoint t_end = HighResTimer::now();
+
+    uint16_t label_id = CMXTraceRing::intern(label);
+    if (label_id == CMXTraceRing::INVALID_LABEL) {
+        return;
+    }
+
+    // Find the matching open scope, scanning from the top so
+    // mis-nested stops still close the right measurement
+    uint32_t core = CMXTraceRing::current_core();
+    for (size_t i = open_depth_[core]; i > 0; --i) {
+        OpenScope& scope = open_scopes_[core][i - 1];
+        if (scope.label_id != label_id) {
+            continue;
+        }
+
+        CMXTraceRing::record(label_id, scope.t_start, t_end);
+
+        // Top-level scopes define the core's busy time; nested scopes
+        // are already inside one and would double-count
+        if (i == 1) {
+            busy_ticks_[core].fetch_add(t_end - scope.t_start,
+                                        std::memory_order_relaxed);
+        }
+
+        // Remove the closed scope; the shift is bounded by the stack
+        // depth, keeping stop() wait-free
+        for (size_t j = i; j < open_depth_[core]; ++j) {
+            open_scopes_[core][j - 1] = open_scopes_[core][j];
+        }
+        open_depth_[core]--;
+        return;
     }
-#endif
 }
 
 bool CMXProfiler::get_report(ProfileReport& report) const {
@@ -80,9 +201,12 @@ bool CMXProfiler::get_report(ProfileReport& report) const {
     }
     
     std::lock_guard<std::mutex> lock(profile_mutex_);
-    
+
+    // Fold any events buffered since the last report into the entries
+    const_cast<CMXProfiler*>(this)->drain_rings_locked();
+
     report = ProfileReport();
-    
+
     // Copy all entries to report
     for (size_t i = 0; i < entry_count_; ++i) {
         if (!report.add_entry(entries_[i])) {
@@ -100,16 +224,76 @@ bool CMXProfiler::get_report(ProfileReport& report) const {
 
 void CMXProfiler::reset() {
     std::lock_guard<std::mutex> lock(profile_mutex_);
-    
+
     // Reset all entries
     for (size_t i = 0; i < entry_count_; ++i) {
         entries_[i].reset();
     }
-    
+
     entry_count_ = 0;
+    std::memset(open_depth_, 0, sizeof(open_depth_));
+    for (uint32_t core = 0; core < CMX_TRACE_MAX_CORES; ++core) {
+        busy_ticks_[core].store(0, std::memory_order_relaxed);
+    }
+    reset_core_counters();
+    CMXTraceRing::clear();
     session_start_time_ = HighResTimer::now();
 }
 
+bool CMXProfiler::get_core_stats(uint32_t core, CoreStats& stats) const {
+    if (core >= CMX_TRACE_MAX_CORES) {
+        return false;
+    }
+
+    uint64_t busy_ticks = busy_ticks_[core].load(std::memory_order_relaxed);
+    stats.busy_time_us = HighResTimer::duration_us(0, busy_ticks);
+
+    uint64_t session_us = get_session_time_us();
+    stats.idle_time_us = (session_us > stats.busy_time_us)
+                       ? session_us - stats.busy_time_us : 0;
+
+    stats.queue_wait_time_us = HighResTimer::duration_us(
+        0, CMXCoreCounters::queue_wait_ticks(core));
+    stats.lock_contention_count = CMXCoreCounters::lock_contention(core);
+
+    return true;
+}
+
+void CMXProfiler::drain_rings_locked() {
+    TraceEvent events[64];
+
+    for (uint32_t core = 0; core < CMX_TRACE_MAX_CORES; ++core) {
+        size_t count;
+        while ((count = CMXTraceRing::drain(core, events, 64)) > 0) {
+            for (size_t i = 0; i < count; ++i) {
+                const char* label = CMXTraceRing::label_name(events[i].label_id);
+                if (!label) {
+                    continue;
+                }
+
+                // Merging by name also folds duplicate ids from racy
+                // interning into one entry
+                ProfileEntry* entry = find_entry(label);
+                if (!entry) {
+                    entry = create_entry(label);
+                }
+                if (!entry) {
+                    return; // Entry table full
+                }
+
+                uint64_t duration = HighResTimer::duration_us(events[i].t_start,
+                                                              events[i].t_end);
+                entry->total_time_us += duration;
+                entry->min_time_us = (duration < entry->min_time_us)
+                                   ? duration : entry->min_time_us;
+                entry->max_time_us = (duration > entry->max_time_us)
+                                   ? duration : entry->max_time_us;
+                entry->call_count++;
+            }
+        }
+    }
+}
+
 uint64_t CMXProfiler::get_session_time_us() const {
     auto current_time = HighResTimer::now();
     return HighResTimer::duration_us(session_start_time_, current_time);
@@ -184,6 +368,26 @@ size_t CMXProfiler::print_report(char* buffer, size_t buffer_size, bool sort_by_
         }
     }
     
+    // Per-core attribution: whether the inference was compute-split
+    // or contention-bound is visible here, not in the per-op rows
+    written += std::snprintf(buffer + written, buffer_size - written,
+                            "\n%-6s %12s %12s %14s %12s\n",
+                            "Core", "Busy(us)", "Idle(us)", "QueueWait(us)", "LockWaits");
+    for (uint32_t core = 0; core < CMX_TRACE_MAX_CORES &&
+                            written < buffer_size - 1; ++core) {
+        CoreStats stats;
+        if (!get_core_stats(core, stats)) {
+            continue;
+        }
+        written += std::snprintf(buffer + written, buffer_size - written,
+                                "%-6u %12llu %12llu %14llu %12llu\n",
+                                core,
+                                static_cast<unsigned long long>(stats.busy_time_us),
+                                static_cast<unsigned long long>(stats.idle_time_us),
+                                static_cast<unsigned long long>(stats.queue_wait_time_us),
+                                static_cast<unsigned long long>(stats.lock_contention_count));
+    }
+
     // Footer
     written += std::snprintf(buffer + written, buffer_size - written, "\n");
     
@@ -224,4 +428,6 @@ ProfileEntry* CMXProfiler::create_entry(const char* label) {
 }
 
 } // namespace runtime
-} // namespace cmx
\ No newline at end of file
+} // namespace cmx
+
+#endif // CMX_PROFILING_ENABLED
\ No newline at end of file
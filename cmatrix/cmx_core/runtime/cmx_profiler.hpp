@@ -1,15 +1,27 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <mutex>
 
-// Compile-time flag to enable/disable profiling
+// Compile-time flag to enable/disable profiling. When disabled the
+// profiler classes collapse to header-only inline no-ops: call sites
+// compile unchanged, but no profiler object code, label tables or
+// mutex make it into the link.
 #ifndef CMX_PROFILING_ENABLED
 #define CMX_PROFILING_ENABLED 1
 #endif
 
+// The per-core counters (queue wait, lock contention) are one relaxed
+// atomic add each, cheap enough for release builds. They are selected
+// separately so a build can keep the counters while the full event
+// profiler is compiled out; by default they follow the profiler flag.
+#ifndef CMX_PROFILING_COUNTERS
+#define CMX_PROFILING_COUNTERS CMX_PROFILING_ENABLED
+#endif
+
 // Convenience macros for profiling
 #if CMX_PROFILING_ENABLED
 #define CMX_PROFILE_START(profiler, label) (profiler).start(label)
@@ -26,21 +38,45 @@ namespace runtime {
 
 /**
  * @brief High-resolution timer for profiling
+ *
+ * Time points are raw ticks of the active clock. By default ticks come
+ * from std::chrono::high_resolution_clock in nanoseconds; on bare-metal
+ * targets that clock resolves to a coarse tick and drags in expensive
+ * 64-bit time math, so platform ports register their hardware cycle
+ * counter (DWT->CYCCNT on Cortex-M, ccount on Xtensa, mcycle on RISC-V)
+ * through set_platform_clock(). Reading the clock then costs one
+ * register read and per-op numbers become cycle-accurate.
  */
 class HighResTimer {
-private:
-    using Clock = std::chrono::high_resolution_clock;
-    using TimePoint = Clock::time_point;
-    
 public:
+    using TimePoint = uint64_t;             ///< Raw ticks of the active clock
+    using CycleCounterFn = uint64_t (*)();  ///< Platform cycle-counter read
+
+    /**
+     * @brief Register a platform cycle counter as the profiling clock
+     * @param counter Function returning a monotonic 64-bit cycle count
+     * @param ticks_per_second Counter frequency in Hz (core clock)
+     */
+    static void set_platform_clock(CycleCounterFn counter, uint64_t ticks_per_second) {
+        if (counter && ticks_per_second > 0) {
+            counter_ = counter;
+            ticks_per_second_ = ticks_per_second;
+        }
+    }
+
     /**
      * @brief Get current time point
-     * @return Current time point
+     * @return Current tick count of the active clock
      */
     static TimePoint now() {
-        return Clock::now();
+        if (counter_) {
+            return counter_();
+        }
+        return static_cast<TimePoint>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::high_resolution_clock::now().time_since_epoch()).count());
     }
-    
+
     /**
      * @brief Calculate duration in microseconds
      * @param start Start time point
@@ -48,9 +84,9 @@ public:
      * @return Duration in microseconds
      */
     static uint64_t duration_us(const TimePoint& start, const TimePoint& end) {
-        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        return scale_ticks(end - start, 1000000ULL);
     }
-    
+
     /**
      * @brief Calculate duration in nanoseconds
      * @param start Start time point
@@ -58,10 +94,327 @@ public:
      * @return Duration in nanoseconds
      */
     static uint64_t duration_ns(const TimePoint& start, const TimePoint& end) {
-        return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        return scale_ticks(end - start, 1000000000ULL);
+    }
+
+    /**
+     * @brief Get the active clock's tick rate
+     * @return Ticks per second of the active clock
+     */
+    static uint64_t ticks_per_second() {
+        return ticks_per_second_;
+    }
+
+private:
+    /**
+     * @brief Convert a tick delta to time units of the given rate
+     *
+     * Split into whole seconds and remainder so ticks * 1e9 cannot
+     * overflow uint64_t after a few seconds of cycle counting.
+     */
+    static uint64_t scale_ticks(uint64_t ticks, uint64_t units_per_second) {
+        uint64_t seconds = ticks / ticks_per_second_;
+        uint64_t remainder = ticks % ticks_per_second_;
+        return seconds * units_per_second +
+               (remainder * units_per_second) / ticks_per_second_;
+    }
+
+    // Inline storage keeps the timer header-only: it stays available
+    // to cycle-budget and deadline code even in builds that link no
+    // profiler translation unit at all
+    static inline CycleCounterFn counter_ = nullptr;
+    static inline uint64_t ticks_per_second_ = 1000000000ULL;
+};
+
+// Trace ring sizing; ring size must be a power of two
+#ifndef CMX_TRACE_RING_SIZE
+#define CMX_TRACE_RING_SIZE 1024
+#endif
+
+#ifndef CMX_TRACE_MAX_CORES
+#define CMX_TRACE_MAX_CORES 2
+#endif
+
+/**
+ * @brief Always-on per-core counters, header-only
+ *
+ * Home of the queue-wait and lock-contention counters and of core
+ * identification. Everything is inline with inline static storage, so
+ * these stay usable in builds where the full event profiler is
+ * compiled out (CMX_PROFILING_COUNTERS=1, CMX_PROFILING_ENABLED=0)
+ * without linking any profiler translation unit. With the counters
+ * off as well, every call collapses to nothing.
+ */
+class CMXCoreCounters {
+public:
+    /**
+     * @brief Function returning the id of the calling core (0-based)
+     */
+    using CoreIdFn = uint32_t (*)();
+
+    /**
+     * @brief Override how the calling core is identified
+     * @param fn Core id function, nullptr restores the default (core 0)
+     */
+    static void set_core_id_fn(CoreIdFn fn) { core_id_fn_ = fn; }
+
+    /**
+     * @brief Get the calling core's index, clamped to the core count
+     * @return Core index
+     */
+    static uint32_t current_core() {
+        if (!core_id_fn_) {
+            return 0;
+        }
+        uint32_t core = core_id_fn_();
+        return (core < CMX_TRACE_MAX_CORES) ? core : 0;
+    }
+
+    /**
+     * @brief Account queue wait time to the calling core
+     * @param ticks Wait duration in clock ticks
+     */
+    static void add_queue_wait_ticks(uint64_t ticks) {
+#if CMX_PROFILING_COUNTERS
+        queue_wait_ticks_[current_core()].fetch_add(ticks,
+                                                    std::memory_order_relaxed);
+#else
+        (void)ticks;
+#endif
+    }
+
+    /**
+     * @brief Count one blocking mutex acquisition on the calling core
+     */
+    static void note_lock_contention() {
+#if CMX_PROFILING_COUNTERS
+        lock_contention_[current_core()].fetch_add(1,
+                                                   std::memory_order_relaxed);
+#endif
+    }
+
+    /**
+     * @brief Read one core's accumulated queue wait in clock ticks
+     */
+    static uint64_t queue_wait_ticks(uint32_t core) {
+#if CMX_PROFILING_COUNTERS
+        if (core < CMX_TRACE_MAX_CORES) {
+            return queue_wait_ticks_[core].load(std::memory_order_relaxed);
+        }
+#else
+        (void)core;
+#endif
+        return 0;
+    }
+
+    /**
+     * @brief Read one core's blocking mutex acquisition count
+     */
+    static uint64_t lock_contention(uint32_t core) {
+#if CMX_PROFILING_COUNTERS
+        if (core < CMX_TRACE_MAX_CORES) {
+            return lock_contention_[core].load(std::memory_order_relaxed);
+        }
+#else
+        (void)core;
+#endif
+        return 0;
+    }
+
+    /**
+     * @brief Zero all per-core counters
+     */
+    static void reset() {
+#if CMX_PROFILING_COUNTERS
+        for (uint32_t core = 0; core < CMX_TRACE_MAX_CORES; ++core) {
+            queue_wait_ticks_[core].store(0, std::memory_order_relaxed);
+            lock_contention_[core].store(0, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+private:
+    CMXCoreCounters() = delete;
+
+    static inline CoreIdFn core_id_fn_ = nullptr;
+#if CMX_PROFILING_COUNTERS
+    static inline std::atomic<uint64_t> queue_wait_ticks_[CMX_TRACE_MAX_CORES] = {};
+    static inline std::atomic<uint64_t> lock_contention_[CMX_TRACE_MAX_CORES] = {};
+#endif
+};
+
+/**
+ * @brief One completed profiling event (POD)
+ */
+struct TraceEvent {
+    uint16_t label_id;                  ///< Interned label, see CMXTraceRing::intern()
+    HighResTimer::TimePoint t_start;    ///< Event start in clock ticks
+    HighResTimer::TimePoint t_end;      ///< Event end in clock ticks
+};
+
+#if CMX_PROFILING_ENABLED
+
+/**
+ * @brief Lock-free per-core event trace storage
+ *
+ * Fixed static rings of POD trace events, one per core, written with a
+ * relaxed atomic index increment — no locks, no allocation, safe from
+ * ISR context, and cheap enough not to distort the microsecond-scale
+ * events being measured. When a ring fills, the oldest events are
+ * overwritten. Events are drained offline (between inferences or from
+ * the idle loop) and aggregated there.
+ */
+class CMXTraceRing {
+public:
+    static constexpr uint16_t MAX_LABELS = 64;
+    static constexpr uint16_t INVALID_LABEL = 0xFFFF;
+
+    /**
+     * @brief Function returning the id of the calling core (0-based)
+     */
+    using CoreIdFn = uint32_t (*)();
+
+    /**
+     * @brief Intern a label string to a stable id
+     *
+     * Labels are expected to be string literals; interning is lock-free
+     * and bounded. A rare race can assign two ids to the same string —
+     * they are merged by name at drain time, so nothing is lost.
+     *
+     * @param label Label string (must outlive the trace)
+     * @return Label id, INVALID_LABEL if the table is full
+     */
+    static uint16_t intern(const char* label);
+
+    /**
+     * @brief Look up the string of an interned label
+     * @param label_id Interned label id
+     * @return Label string, nullptr if the id is invalid
+     */
+    static const char* label_name(uint16_t label_id);
+
+    /**
+     * @brief Append one completed event to the calling core's ring
+     *
+     * Wait-free: one relaxed fetch_add and a POD store.
+     *
+     * @param label_id Interned label id
+     * @param t_start Event start in clock ticks
+     * @param t_end Event end in clock ticks
+     */
+    static void record(uint16_t label_id,
+                       HighResTimer::TimePoint t_start,
+                       HighResTimer::TimePoint t_end);
+
+    /**
+     * @brief Drain buffered events from one core's ring
+     *
+     * Single-consumer: call from one place only (the aggregation or
+     * upload path), not concurrently per core.
+     *
+     * @param core Core index
+     * @param out Output event array
+     * @param max_events Capacity of the output array
+     * @return Number of events copied out
+     */
+    static size_t drain(uint32_t core, TraceEvent* out, size_t max_events);
+
+    /**
+     * @brief Override how the calling core is identified
+     *
+     * Forwards to CMXCoreCounters, which owns core identification so it
+     * stays available to the always-on counters in disabled builds.
+     *
+     * @param fn Core id function, nullptr restores the default (core 0)
+     */
+    static void set_core_id_fn(CoreIdFn fn) {
+        CMXCoreCounters::set_core_id_fn(fn);
+    }
+
+    /**
+     * @brief Get the calling core's index, clamped to the ring count
+     * @return Core index
+     */
+    static uint32_t current_core() {
+        return CMXCoreCounters::current_core();
+    }
+
+    /**
+     * @brief Discard all buffered events and interned labels
+     */
+    static void clear();
+
+private:
+    CMXTraceRing() = delete;
+
+    struct Ring {
+        TraceEvent events[CMX_TRACE_RING_SIZE];
+        std::atomic<uint32_t> write_index;
+        uint32_t read_index;    ///< Advanced only by the single drainer
+    };
+
+    static Ring rings_[CMX_TRACE_MAX_CORES];
+    static const char* labels_[MAX_LABELS];
+    static std::atomic<uint16_t> label_count_;
+};
+
+#else // !CMX_PROFILING_ENABLED
+
+/**
+ * @brief Header-only stub: no rings, no label table, no object code
+ *
+ * Same API as the real trace ring so call sites compile unchanged.
+ * Every call inlines to nothing (intern reports a full table, drain
+ * reports an empty ring), so disabled builds link no trace storage.
+ */
+class CMXTraceRing {
+public:
+    static constexpr uint16_t MAX_LABELS = 64;
+    static constexpr uint16_t INVALID_LABEL = 0xFFFF;
+
+    using CoreIdFn = uint32_t (*)();
+
+    static uint16_t intern(const char* label) {
+        (void)label;
+        return INVALID_LABEL;
+    }
+
+    static const char* label_name(uint16_t label_id) {
+        (void)label_id;
+        return nullptr;
     }
+
+    static void record(uint16_t label_id,
+                       HighResTimer::TimePoint t_start,
+                       HighResTimer::TimePoint t_end) {
+        (void)label_id;
+        (void)t_start;
+        (void)t_end;
+    }
+
+    static size_t drain(uint32_t core, TraceEvent* out, size_t max_events) {
+        (void)core;
+        (void)out;
+        (void)max_events;
+        return 0;
+    }
+
+    static void set_core_id_fn(CoreIdFn fn) {
+        CMXCoreCounters::set_core_id_fn(fn);
+    }
+
+    static uint32_t current_core() {
+        return CMXCoreCounters::current_core();
+    }
+
+    static void clear() {}
+
+private:
+    CMXTraceRing() = delete;
 };
 
+#endif // CMX_PROFILING_ENABLED
+
 /**
  * @brief Profile entry for storing timing information
  */
@@ -180,42 +533,95 @@ struct ProfileReport {
         return false;
     }
     
+#if CMX_PROFILING_ENABLED
     /**
      * @brief Sort entries by total time (descending)
      */
     void sort_by_total_time();
-    
+
     /**
      * @brief Sort entries by average time (descending)
      */
     void sort_by_average_time();
-    
+
     /**
      * @brief Sort entries by call count (descending)
      */
     void sort_by_call_count();
+#else
+    // Disabled builds never fill a report; sorting inlines to nothing
+    // rather than pulling std::sort into the link
+    void sort_by_total_time() {}
+    void sort_by_average_time() {}
+    void sort_by_call_count() {}
+#endif
+};
+
+/**
+ * @brief Derived per-core execution metrics
+ *
+ * Answers the question per-op timings cannot: is parallel execution
+ * actually compute-split across cores, or is one core mostly idle,
+ * waiting on the task queue, or serializing on a lock? Busy time is
+ * the sum of top-level profiled scopes on the core; idle is the rest
+ * of the session window. Queue wait and lock contention come from the
+ * scheduler's dequeue accounting and ContendedLockGuard.
+ */
+struct CoreStats {
+    uint64_t busy_time_us;              ///< Time inside top-level profiled scopes
+    uint64_t idle_time_us;              ///< Session time not covered by busy time
+    uint64_t queue_wait_time_us;        ///< Ready-to-dequeue latency of scheduler tasks
+    uint64_t lock_contention_count;     ///< Mutex acquisitions that had to block
 };
 
+#if CMX_PROFILING_ENABLED
+
 /**
  * @brief Runtime profiling tool for performance analysis
- * 
+ *
  * This profiler provides:
  * - Per-operation timing with start/stop API
  * - Statistical analysis (min, max, average, total time)
  * - Call count tracking
- * - Thread-safe operation
+ * - Wait-free start/stop over the per-core trace rings (ISR-safe)
  * - Minimal overhead when disabled
+ *
+ * start()/stop() only intern the label, read the clock and append a POD
+ * event — no mutex on the hot path, so the measurement cost no longer
+ * distorts microsecond-scale events. Aggregation into ProfileEntry
+ * statistics happens when a report is requested, draining the rings
+ * under the mutex.
  */
 class CMXProfiler {
 private:
     static constexpr size_t MAX_PROFILE_ENTRIES = 128;
-    
-    ProfileEntry entries_[MAX_PROFILE_ENTRIES]; ///< Profile entries storage
-    size_t entry_count_;                        ///< Number of active entries
+    static constexpr size_t MAX_SCOPE_DEPTH = 16;
+
+    /**
+     * @brief One started, not yet stopped measurement
+     */
+    struct OpenScope {
+        uint16_t label_id;
+        HighResTimer::TimePoint t_start;
+    };
+
+    ProfileEntry entries_[MAX_PROFILE_ENTRIES]; ///< Aggregated entries (built at drain)
+    size_t entry_count_;                        ///< Number of valid entries
     bool is_enabled_;                           ///< Whether profiling is enabled
-    std::mutex profile_mutex_;                  ///< Mutex for thread safety
+    mutable std::mutex profile_mutex_;          ///< Guards aggregation only, not start/stop
     HighResTimer::TimePoint session_start_time_; ///< Session start time
-    
+
+    OpenScope open_scopes_[CMX_TRACE_MAX_CORES][MAX_SCOPE_DEPTH]; ///< Per-core open-measurement stacks
+    size_t open_depth_[CMX_TRACE_MAX_CORES];    ///< Per-core stack depths
+
+    std::atomic<uint64_t> busy_ticks_[CMX_TRACE_MAX_CORES]; ///< Per-core top-level scope ticks
+
+    /**
+     * @brief Drain the trace rings and merge events into entries_
+     * Caller must hold profile_mutex_.
+     */
+    void drain_rings_locked();
+
     /**
      * @brief Find profile entry by label
      * @param label Operation label
@@ -303,6 +709,45 @@ public:
      */
     const ProfileEntry* get_entry(const char* label) const;
     
+    /**
+     * @brief Get derived per-core metrics for the current session
+     *
+     * Wait-free reads of the per-core counters; no ring drain needed.
+     *
+     * @param core Core index
+     * @param stats Output statistics
+     * @return true if the core index is valid
+     */
+    bool get_core_stats(uint32_t core, CoreStats& stats) const;
+
+    /**
+     * @brief Account queue wait time to the calling core
+     *
+     * Called by the scheduler with the ready-to-dequeue tick delta of
+     * each dequeued task; attributed to the core doing the dequeue,
+     * i.e. the core that sat waiting for work. The counters live in
+     * CMXCoreCounters so they survive builds without the profiler.
+     *
+     * @param ticks Wait duration in clock ticks
+     */
+    static void add_queue_wait_ticks(uint64_t ticks) {
+        CMXCoreCounters::add_queue_wait_ticks(ticks);
+    }
+
+    /**
+     * @brief Count one blocking mutex acquisition on the calling core
+     */
+    static void note_lock_contention() {
+        CMXCoreCounters::note_lock_contention();
+    }
+
+    /**
+     * @brief Zero the process-wide queue-wait and contention counters
+     */
+    static void reset_core_counters() {
+        CMXCoreCounters::reset();
+    }
+
     /**
      * @brief Print report to string buffer
      * @param buffer Output buffer
@@ -313,6 +758,80 @@ public:
     size_t print_report(char* buffer, size_t buffer_size, bool sort_by_total_time = true) const;
 };
 
+#else // !CMX_PROFILING_ENABLED
+
+/**
+ * @brief Header-only stub: every member inlines to a no-op
+ *
+ * Same API as the real profiler so call sites compile unchanged, but
+ * no entry table, mutex or report code reaches the link. Only the
+ * per-core counters remain live (through CMXCoreCounters, when
+ * CMX_PROFILING_COUNTERS is set), so get_core_stats still reports
+ * queue wait and lock contention.
+ */
+class CMXProfiler {
+public:
+    explicit CMXProfiler(bool enabled = true) { (void)enabled; }
+    ~CMXProfiler() = default;
+
+    void set_enabled(bool enabled) { (void)enabled; }
+    bool is_enabled() const { return false; }
+
+    void start(const char* label) { (void)label; }
+    void stop(const char* label) { (void)label; }
+
+    bool get_report(ProfileReport& report) const {
+        (void)report;
+        return false;
+    }
+
+    void reset() { reset_core_counters(); }
+
+    uint64_t get_session_time_us() const { return 0; }
+    size_t get_entry_count() const { return 0; }
+    bool has_capacity() const { return false; }
+
+    const ProfileEntry* get_entry(const char* label) const {
+        (void)label;
+        return nullptr;
+    }
+
+    bool get_core_stats(uint32_t core, CoreStats& stats) const {
+        if (core >= CMX_TRACE_MAX_CORES) {
+            return false;
+        }
+        stats.busy_time_us = 0;
+        stats.idle_time_us = 0;
+        stats.queue_wait_time_us = HighResTimer::duration_us(
+            0, CMXCoreCounters::queue_wait_ticks(core));
+        stats.lock_contention_count = CMXCoreCounters::lock_contention(core);
+        return true;
+    }
+
+    static void add_queue_wait_ticks(uint64_t ticks) {
+        CMXCoreCounters::add_queue_wait_ticks(ticks);
+    }
+
+    static void note_lock_contention() {
+        CMXCoreCounters::note_lock_contention();
+    }
+
+    static void reset_core_counters() {
+        CMXCoreCounters::reset();
+    }
+
+    size_t print_report(char* buffer, size_t buffer_size,
+                        bool sort_by_total_time = true) const {
+        (void)sort_by_total_time;
+        if (buffer && buffer_size > 0) {
+            buffer[0] = '\0';
+        }
+        return 0;
+    }
+};
+
+#endif // CMX_PROFILING_ENABLED
+
 /**
  * @brief RAII scope profiler for automatic start/stop
  */
@@ -346,5 +865,48 @@ public:
     ProfileScope& operator=(ProfileScope&&) = delete;
 };
 
+/**
+ * @brief Mutex guard that counts blocking acquisitions
+ *
+ * Drop-in replacement for std::lock_guard on the mutexes that remain
+ * in occasionally-contended paths. An uncontended acquisition costs
+ * one try_lock; a contended one bumps the calling core's contention
+ * counter before blocking, so CoreStats can show whether parallel
+ * execution is compute-split or serializing on a lock.
+ */
+class ContendedLockGuard {
+private:
+    std::mutex& mutex_;
+
+public:
+    /**
+     * @brief Constructor - acquires the mutex, counting if it blocks
+     * @param mutex Mutex to acquire
+     */
+    explicit ContendedLockGuard(std::mutex& mutex) : mutex_(mutex) {
+#if CMX_PROFILING_COUNTERS
+        if (!mutex_.try_lock()) {
+            CMXCoreCounters::note_lock_contention();
+            mutex_.lock();
+        }
+#else
+        mutex_.lock();
+#endif
+    }
+
+    /**
+     * @brief Destructor - releases the mutex
+     */
+    ~ContendedLockGuard() {
+        mutex_.unlock();
+    }
+
+    // Disable copy and move
+    ContendedLockGuard(const ContendedLockGuard&) = delete;
+    ContendedLockGuard& operator=(const ContendedLockGuard&) = delete;
+    ContendedLockGuard(ContendedLockGuard&&) = delete;
+    ContendedLockGuard& operator=(ContendedLockGuard&&) = delete;
+};
+
 } // namespace runtime
 } // namespace cmx
\ No newline at end of file
@@ -36,6 +36,8 @@ struct RuntimeConfig {
     // Alignment requirements
     static constexpr size_t MEMORY_ALIGNMENT = 64;  // 64-byte alignment for SIMD
     static constexpr size_t TENSOR_ALIGNMENT = 32;
+    static constexpr size_t CACHE_LINE_ALIGNMENT = 32;  // Cortex-M7 D-cache line
+    static constexpr size_t METADATA_ALIGNMENT = 8;     // Tight packing for small structs
 };
 
 // Compile-time overrides
@@ -43,8 +45,10 @@ struct RuntimeConfig {
 #define CMX_MEMORY_POOL_SIZE RuntimeConfig::DEFAULT_MEMORY_POOL_SIZE
 #endif
 
+// Must stay a plain literal (matching RuntimeConfig::PROFILING_ENABLED)
+// because cmx_profiler.hpp tests it with #if
 #ifndef CMX_PROFILING_ENABLED
-#define CMX_PROFILING_ENABLED RuntimeConfig::PROFILING_ENABLED
+#define CMX_PROFILING_ENABLED 1
 #endif
 
 /**
@@ -7,16 +7,30 @@ namespace cmx {
 namespace runtime {
 
 CMXScheduler::CMXScheduler(SchedulingStrategy strategy)
-    : task_count_(0), ready_count_(0), ready_head_(0), ready_tail_(0),
-      next_task_id_(1), strategy_(strategy), is_running_(false) {
+    : range_slot_count_(0), background_job_count_(0), dma_transfer_count_(0),
+      dma_idle_attached_(false), task_count_(0),
+      ready_count_(0), ready_head_(0),
+      ready_tail_(0), next_task_id_(1), strategy_(strategy), is_running_(false),
+      single_consumer_(false), spsc_head_(0), spsc_tail_(0),
+      consumer_head_(0), consumer_tail_(0), consumer_count_(0) {
     // Initialize task pool
     for (size_t i = 0; i < MAX_TASKS; ++i) {
         task_pool_[i] = Task();
     }
-    
+
     // Initialize ready queue
     for (size_t i = 0; i < MAX_READY_TASKS; ++i) {
         ready_queue_[i] = nullptr;
+        spsc_ring_[i] = nullptr;
+        consumer_queue_[i] = nullptr;
+    }
+
+    for (size_t i = 0; i < MAX_BACKGROUND_JOBS; ++i) {
+        background_jobs_[i].active.store(false);
+    }
+
+    for (size_t i = 0; i < MAX_DMA_TRANSFERS; ++i) {
+        dma_transfers_[i].active.store(false);
     }
 }
 
@@ -25,7 +39,7 @@ CMXScheduler::~CMXScheduler() {
 }
 
 bool CMXScheduler::initialize() {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    ContendedLockGuard lock(queue_mutex_);
     
     if (is_running_.load()) {
         return false; // Already initialized
@@ -36,16 +50,31 @@ bool CMXScheduler::initialize() {
     ready_count_ = 0;
     ready_head_ = 0;
     ready_tail_ = 0;
+    range_slot_count_ = 0;
     next_task_id_ = 1;
-    
+    spsc_head_.store(0);
+    spsc_tail_.store(0);
+    consumer_head_ = 0;
+    consumer_tail_ = 0;
+    consumer_count_ = 0;
+    background_job_count_.store(0);
+    for (size_t i = 0; i < MAX_BACKGROUND_JOBS; ++i) {
+        background_jobs_[i].active.store(false);
+    }
+    dma_transfer_count_.store(0);
+    for (size_t i = 0; i < MAX_DMA_TRANSFERS; ++i) {
+        dma_transfers_[i].active.store(false);
+    }
+
     is_running_.store(true);
     return true;
 }
 
 void CMXScheduler::shutdown() {
     is_running_.store(false);
-    
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    detach_dma_idle_hook();
+
+    ContendedLockGuard lock(queue_mutex_);
     
     // Clear all tasks
     for (size_t i = 0; i < task_count_; ++i) {
@@ -61,50 +90,85 @@ void CMXScheduler::shutdown() {
     ready_count_ = 0;
     ready_head_ = 0;
     ready_tail_ = 0;
+    range_slot_count_ = 0;
+    spsc_head_.store(0);
+    spsc_tail_.store(0);
+    consumer_head_ = 0;
+    consumer_tail_ = 0;
+    consumer_count_ = 0;
+    background_job_count_.store(0);
+    for (size_t i = 0; i < MAX_BACKGROUND_JOBS; ++i) {
+        background_jobs_[i].active.store(false);
+    }
+    dma_transfer_count_.store(0);
+    for (size_t i = 0; i < MAX_DMA_TRANSFERS; ++i) {
+        dma_transfers_[i].active.store(false);
+    }
 }
 
-uint32_t CMXScheduler::submit_task(std::function<void()> func, TaskPriority priority) {
+uint32_t CMXScheduler::submit_task(TaskFn func, void* context, TaskPriority priority) {
     if (!is_running_.load() || !func) {
         return 0;
     }
-    
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    
-    if (task_count_ >= MAX_TASKS) {
+
+    // Single-consumer mode has exactly one submitting thread, so the
+    // pool needs no lock; the consumer only scans up to the count
+    // published with release below
+    std::unique_lock<std::mutex> lock(queue_mutex_, std::defer_lock);
+    if (!single_consumer_) {
+        if (!lock.try_lock()) {
+            CMXProfiler::note_lock_contention();
+            lock.lock();
+        }
+    }
+
+    const size_t slot = task_count_.load(std::memory_order_relaxed);
+    if (slot >= MAX_TASKS) {
         return 0; // Task pool full
     }
-    
+
     // Create new task
     uint32_t task_id = next_task_id_++;
-    Task& task = task_pool_[task_count_++];
-    task = Task(task_id, func, priority);
-    
+    Task& task = task_pool_[slot];
+    task = Task(task_id, func, context, priority);
+    task.enqueued = task.is_ready();
+
+    // Publish the fully constructed task before any ready-queue handoff
+    task_count_.store(slot + 1, std::memory_order_release);
+
     // If task has no dependencies, add to ready queue
-    if (task.is_ready()) {
+    if (task.enqueued) {
         enqueue_ready_task(&task);
     }
     
     return task_id;
 }
 
-uint32_t CMXScheduler::submit_task_with_deps(std::function<void()> func,
+uint32_t CMXScheduler::submit_task_with_deps(TaskFn func, void* context,
                                             const uint32_t* deps,
                                             size_t dep_count,
                                             TaskPriority priority) {
     if (!is_running_.load() || !func || dep_count > 8) {
         return 0;
     }
-    
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    
-    if (task_count_ >= MAX_TASKS) {
+
+    std::unique_lock<std::mutex> lock(queue_mutex_, std::defer_lock);
+    if (!single_consumer_) {
+        if (!lock.try_lock()) {
+            CMXProfiler::note_lock_contention();
+            lock.lock();
+        }
+    }
+
+    const size_t slot = task_count_.load(std::memory_order_relaxed);
+    if (slot >= MAX_TASKS) {
         return 0; // Task pool full
     }
-    
+
     // Create new task
     uint32_t task_id = next_task_id_++;
-    Task& task = task_pool_[task_count_++];
-    task = Task(task_id, func, priority);
+    Task& task = task_pool_[slot];
+    task = Task(task_id, func, context, priority);
     
     // Add dependencies
     for (size_t i = 0; i < dep_count; ++i) {
@@ -113,15 +177,301 @@ uint32_t CMXScheduler::submit_task_with_deps(std::function<void()> func,
             task.add_dependency(dep_task);
         }
     }
-    
+
+    task.enqueued = task.is_ready();
+    task_count_.store(slot + 1, std::memory_order_release);
+
     // If task has no dependencies or all are completed, add to ready queue
-    if (task.is_ready()) {
+    if (task.enqueued) {
         enqueue_ready_task(&task);
     }
     
     return task_id;
 }
 
+void CMXScheduler::execute_range_slot(void* context) {
+    RangeSlot* slot = static_cast<RangeSlot*>(context);
+    slot->function_ptr(slot->context, slot->begin, slot->end);
+}
+
+size_t CMXScheduler::submit_range_tasks(RangeTaskFn func, void* context,
+                                        int32_t total, size_t num_tasks,
+                                        TaskPriority priority) {
+    if (!is_running_.load() || !func || total <= 0 || num_tasks == 0) {
+        return 0;
+    }
+
+    // Never create more slices than there are elements to split
+    num_tasks = std::min(num_tasks, static_cast<size_t>(total));
+
+    size_t slot_base;
+    {
+        ContendedLockGuard lock(queue_mutex_);
+
+        if (range_slot_count_ + num_tasks > MAX_RANGE_SLOTS ||
+            task_count_ + num_tasks > MAX_TASKS) {
+            return 0;
+        }
+
+        slot_base = range_slot_count_;
+        range_slot_count_ += num_tasks;
+    }
+
+    // Near-equal contiguous slices; the first (total % num_tasks)
+    // slices absorb the remainder
+    const int32_t base_size = total / static_cast<int32_t>(num_tasks);
+    const int32_t remainder = total % static_cast<int32_t>(num_tasks);
+
+    size_t submitted = 0;
+    int32_t begin = 0;
+    for (size_t i = 0; i < num_tasks; ++i) {
+        const int32_t size = base_size + (static_cast<int32_t>(i) < remainder ? 1 : 0);
+        RangeSlot& slot = range_slots_[slot_base + i];
+        slot.function_ptr = func;
+        slot.context = context;
+        slot.begin = begin;
+        slot.end = begin + size;
+        begin += size;
+
+        if (submit_task(&execute_range_slot, &slot, priority) != 0) {
+            ++submitted;
+        }
+    }
+
+    return submitted;
+}
+
+uint32_t CMXScheduler::submit_background_job(RangeTaskFn func, void* context,
+                                             int32_t total_steps) {
+    if (!is_running_.load() || !func || total_steps <= 0) {
+        return 0;
+    }
+
+    // Same discipline as submit_task: one submitting thread needs no
+    // lock, the worker only scans up to the count published below
+    std::unique_lock<std::mutex> lock(queue_mutex_, std::defer_lock);
+    if (!single_consumer_) {
+        if (!lock.try_lock()) {
+            CMXProfiler::note_lock_contention();
+            lock.lock();
+        }
+    }
+
+    const size_t slot = background_job_count_.load(std::memory_order_relaxed);
+    if (slot >= MAX_BACKGROUND_JOBS) {
+        return 0; // Job slots exhausted
+    }
+
+    BackgroundJob& job = background_jobs_[slot];
+    job.function_ptr = func;
+    job.context = context;
+    job.total_steps = total_steps;
+    job.next_step = 0;
+    job.active.store(true, std::memory_order_relaxed);
+
+    // Publish the fully constructed job before the worker can see it
+    background_job_count_.store(slot + 1, std::memory_order_release);
+
+    return static_cast<uint32_t>(slot + 1);
+}
+
+size_t CMXScheduler::advance_background_jobs() {
+    if (!is_running_.load()) {
+        return 0;
+    }
+
+    size_t executed = 0;
+    const size_t count = background_job_count_.load(std::memory_order_acquire);
+
+    for (size_t i = 0; i < count; ++i) {
+        BackgroundJob& job = background_jobs_[i];
+        if (!job.active.load(std::memory_order_relaxed)) {
+            continue;
+        }
+
+        while (job.next_step < job.total_steps) {
+            job.function_ptr(job.context, job.next_step, job.next_step + 1);
+            ++job.next_step;
+            ++executed;
+
+            // Cooperative yield: an urgent task has arrived, so hand
+            // control back to the worker loop with the checkpoint kept
+            // in next_step. NORMAL-priority work waits for the job; it
+            // was going to run behind it anyway.
+            if (job.next_step < job.total_steps && has_urgent_task()) {
+                return executed;
+            }
+        }
+
+        job.active.store(false, std::memory_order_release);
+    }
+
+    return executed;
+}
+
+bool CMXScheduler::is_background_job_done(uint32_t job) const {
+    if (job == 0 ||
+        job > background_job_count_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    return !background_jobs_[job - 1].active.load(std::memory_order_acquire);
+}
+
+uint32_t CMXScheduler::submit_dma_transfer(const CMXDmaDescriptor* chain,
+                                           TaskPriority priority) {
+    if (!is_running_.load() || !chain) {
+        return 0;
+    }
+
+    // Same discipline as submit_task: one submitting thread needs no
+    // lock, the worker only scans up to the counts published below
+    std::unique_lock<std::mutex> lock(queue_mutex_, std::defer_lock);
+    if (!single_consumer_) {
+        if (!lock.try_lock()) {
+            CMXProfiler::note_lock_contention();
+            lock.lock();
+        }
+    }
+
+    const size_t slot = dma_transfer_count_.load(std::memory_order_relaxed);
+    const size_t task_slot = task_count_.load(std::memory_order_relaxed);
+    if (slot >= MAX_DMA_TRANSFERS || task_slot >= MAX_TASKS) {
+        return 0; // Transfer slots or task pool exhausted
+    }
+
+    // The placeholder never enters a ready queue: it is born RUNNING
+    // and only poll_dma_transfers() moves it to COMPLETED, which is the
+    // moment dependents become ready
+    uint32_t task_id = next_task_id_++;
+    Task& task = task_pool_[task_slot];
+    task = Task(task_id, &CMXScheduler::dma_transfer_marker, nullptr, priority);
+    task.status = TaskStatus::RUNNING;
+    task.enqueued = true;
+    task_count_.store(task_slot + 1, std::memory_order_release);
+
+    DmaTransfer& transfer = dma_transfers_[slot];
+    transfer.chain = chain;
+    transfer.task = &task;
+    transfer.submitted = false;
+    transfer.active.store(true, std::memory_order_relaxed);
+
+    // Publish the fully constructed transfer before the worker can see it
+    dma_transfer_count_.store(slot + 1, std::memory_order_release);
+
+    return task_id;
+}
+
+size_t CMXScheduler::poll_dma_transfers() {
+    if (!is_running_.load()) {
+        return 0;
+    }
+
+    size_t retired = 0;
+    const size_t count = dma_transfer_count_.load(std::memory_order_acquire);
+
+    // Transfers start strictly in submission order: the engines behind
+    // cmx_dma hold one chain in flight, so the first unretired slot is
+    // the one on the wire
+    for (size_t i = 0; i < count; ++i) {
+        DmaTransfer& transfer = dma_transfers_[i];
+        if (!transfer.active.load(std::memory_order_acquire)) {
+            continue;
+        }
+
+        if (!transfer.submitted) {
+            // Inherit the owning task's priority into the engine so a
+            // critical model's staging is not queued behind background
+            // weight streaming (levels map one-to-one)
+            cmx_dma_set_request_priority(static_cast<CMXDmaPriority>(
+                static_cast<uint8_t>(transfer.task->priority)));
+
+            // cmx_dma_submit runs the chain synchronously when no async
+            // engine is registered, so the completion check below may
+            // pass immediately and nothing ever blocks here
+            if (!cmx_dma_submit(transfer.chain)) {
+                transfer.task->status = TaskStatus::FAILED;
+                transfer.active.store(false, std::memory_order_release);
+                update_ready_queue(transfer.task);
+                ++retired;
+                continue;
+            }
+            transfer.submitted = true;
+        }
+
+        if (!cmx_dma_async_complete()) {
+            // Still on the wire; later slots wait their turn
+            break;
+        }
+
+        transfer.task->status = TaskStatus::COMPLETED;
+        transfer.active.store(false, std::memory_order_release);
+        update_ready_queue(transfer.task);
+        ++retired;
+    }
+
+    return retired;
+}
+
+void CMXScheduler::dma_transfer_marker(void* context) {
+    // Never dispatched: the placeholder task is completed by
+    // poll_dma_transfers(), not by the execution path
+    (void)context;
+}
+
+void CMXScheduler::dma_idle_trampoline(void* user) {
+    // One task per poll iteration keeps the completion check frequent,
+    // so the wait ends at most one task after the engine finishes
+    static_cast<CMXScheduler*>(user)->execute_single_task();
+}
+
+void CMXScheduler::attach_dma_idle_hook() {
+    cmx_dma_set_idle_hook(&CMXScheduler::dma_idle_trampoline, this);
+    dma_idle_attached_ = true;
+}
+
+void CMXScheduler::detach_dma_idle_hook() {
+    if (dma_idle_attached_) {
+        cmx_dma_set_idle_hook(nullptr, nullptr);
+        dma_idle_attached_ = false;
+    }
+}
+
+bool CMXScheduler::has_urgent_task() const {
+    if (single_consumer_) {
+        // Worker-side scan. Ring entries up to the acquired tail are
+        // fully published by the producer's release store; the private
+        // consumer queue is only touched on this thread.
+        size_t head = spsc_head_.load(std::memory_order_relaxed);
+        const size_t tail = spsc_tail_.load(std::memory_order_acquire);
+        while (head != tail) {
+            const Task* task = spsc_ring_[head];
+            if (task && task->priority >= TaskPriority::HIGH) {
+                return true;
+            }
+            head = (head + 1) % MAX_READY_TASKS;
+        }
+
+        for (size_t i = 0; i < consumer_count_; ++i) {
+            const Task* task =
+                consumer_queue_[(consumer_head_ + i) % MAX_READY_TASKS];
+            if (task && task->priority >= TaskPriority::HIGH) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ContendedLockGuard lock(queue_mutex_);
+
+    for (size_t i = 0; i < ready_count_; ++i) {
+        const Task* task = ready_queue_[(ready_head_ + i) % MAX_READY_TASKS];
+        if (task && task->priority >= TaskPriority::HIGH) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool CMXScheduler::execute_single_task() {
     if (!is_running_.load()) {
         return false;
@@ -136,7 +486,7 @@ bool CMXScheduler::execute_single_task() {
     task->status = TaskStatus::RUNNING;
     
     try {
-        task->function_ptr();
+        task->function_ptr(task->context);
         task->status = TaskStatus::COMPLETED;
     } catch (...) {
         task->status = TaskStatus::FAILED;
@@ -154,11 +504,16 @@ size_t CMXScheduler::execute_ready_tasks() {
     }
     
     size_t executed_count = 0;
-    
+
+    // Interleave DMA progress with task dispatch: starting queued
+    // chains and retiring finished ones here is what turns a blocking
+    // weight-staging wait into more executed nodes
+    poll_dma_transfers();
     while (execute_single_task()) {
         ++executed_count;
+        poll_dma_transfers();
     }
-    
+
     return executed_count;
 }
 
@@ -199,7 +554,7 @@ Task* CMXScheduler::get_task(uint32_t task_id) {
 }
 
 bool CMXScheduler::has_pending_tasks() const {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    ContendedLockGuard lock(queue_mutex_);
     
     for (size_t i = 0; i < task_count_; ++i) {
         if (task_pool_[i].status == TaskStatus::PENDING || 
@@ -212,7 +567,7 @@ bool CMXScheduler::has_pending_tasks() const {
 }
 
 size_t CMXScheduler::get_pending_task_count() const {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    ContendedLockGuard lock(queue_mutex_);
     
     size_t count = 0;
     for (size_t i = 0; i < task_count_; ++i) {
@@ -225,17 +580,24 @@ size_t CMXScheduler::get_pending_task_count() const {
 }
 
 size_t CMXScheduler::get_ready_task_count() const {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    ContendedLockGuard lock(queue_mutex_);
     return ready_count_;
 }
 
+void CMXScheduler::set_single_consumer(bool enable) {
+    if (is_running_.load()) {
+        return; // Queue discipline cannot change while tasks are in flight
+    }
+    single_consumer_ = enable;
+}
+
 void CMXScheduler::set_strategy(SchedulingStrategy strategy) {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    ContendedLockGuard lock(queue_mutex_);
     strategy_ = strategy;
 }
 
 void CMXScheduler::reset() {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    ContendedLockGuard lock(queue_mutex_);
     
     // Clear all tasks
     for (size_t i = 0; i < task_count_; ++i) {
@@ -251,11 +613,25 @@ void CMXScheduler::reset() {
     ready_count_ = 0;
     ready_head_ = 0;
     ready_tail_ = 0;
+    range_slot_count_ = 0;
     next_task_id_ = 1;
+    spsc_head_.store(0);
+    spsc_tail_.store(0);
+    consumer_head_ = 0;
+    consumer_tail_ = 0;
+    consumer_count_ = 0;
+    background_job_count_.store(0);
+    for (size_t i = 0; i < MAX_BACKGROUND_JOBS; ++i) {
+        background_jobs_[i].active.store(false);
+    }
+    dma_transfer_count_.store(0);
+    for (size_t i = 0; i < MAX_DMA_TRANSFERS; ++i) {
+        dma_transfers_[i].active.store(false);
+    }
 }
 
 void CMXScheduler::get_stats(size_t& total_tasks, size_t& completed_tasks, size_t& failed_tasks) const {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    ContendedLockGuard lock(queue_mutex_);
     
     total_tasks = task_count_;
     completed_tasks = 0;
@@ -271,7 +647,22 @@ void CMXScheduler::get_stats(size_t& total_tasks, size_t& completed_tasks, size_
 }
 
 Task* CMXScheduler::get_next_task() {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    // Lock-free dispatch path: consumer-private wake-ups first, then
+    // the SPSC ring. No mutex anywhere on this path.
+    if (single_consumer_) {
+        Task* task;
+        if (consumer_count_ > 0) {
+            task = consumer_queue_[consumer_head_];
+            consumer_head_ = (consumer_head_ + 1) % MAX_READY_TASKS;
+            consumer_count_--;
+        } else {
+            task = dequeue_spsc();
+        }
+        account_queue_wait(task);
+        return task;
+    }
+
+    ContendedLockGuard lock(queue_mutex_);
     
     if (ready_count_ == 0) {
         return nullptr;
@@ -321,12 +712,36 @@ Task* CMXScheduler::get_next_task() {
             selected_task = dequeue_ready_task();
             break;
     }
-    
+
+    account_queue_wait(selected_task);
     return selected_task;
 }
 
 void CMXScheduler::update_ready_queue(Task* completed_task) {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    // Runs on the consumer thread in single-consumer mode: newly ready
+    // dependents go into the consumer-private queue, which needs no
+    // locking. The scan stops at the producer's published count and the
+    // enqueued flag keeps a task from being queued twice.
+    if (single_consumer_) {
+        const size_t count = task_count_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            Task& task = task_pool_[i];
+
+            if (task.status == TaskStatus::PENDING && !task.enqueued &&
+                task.is_ready() && consumer_count_ < MAX_READY_TASKS) {
+                consumer_queue_[consumer_tail_] = &task;
+                consumer_tail_ = (consumer_tail_ + 1) % MAX_READY_TASKS;
+                consumer_count_++;
+                task.enqueued = true;
+#if CMX_PROFILING_ENABLED
+                task.ready_tick = HighResTimer::now();
+#endif
+            }
+        }
+        return;
+    }
+
+    ContendedLockGuard lock(queue_mutex_);
     
     // Check all tasks for newly available ones
     for (size_t i = 0; i < task_count_; ++i) {
@@ -342,7 +757,54 @@ bool CMXScheduler::has_higher_priority(const Task* a, const Task* b) const {
     return static_cast<uint8_t>(a->priority) > static_cast<uint8_t>(b->priority);
 }
 
+bool CMXScheduler::enqueue_spsc(Task* task) {
+    const size_t tail = spsc_tail_.load(std::memory_order_relaxed);
+    const size_t next = (tail + 1) % MAX_READY_TASKS;
+
+    if (next == spsc_head_.load(std::memory_order_acquire)) {
+        return false; // Ring full
+    }
+
+    spsc_ring_[tail] = task;
+    spsc_tail_.store(next, std::memory_order_release);
+    return true;
+}
+
+Task* CMXScheduler::dequeue_spsc() {
+    const size_t head = spsc_head_.load(std::memory_order_relaxed);
+
+    if (head == spsc_tail_.load(std::memory_order_acquire)) {
+        return nullptr; // Ring empty
+    }
+
+    Task* task = spsc_ring_[head];
+    spsc_head_.store((head + 1) % MAX_READY_TASKS, std::memory_order_release);
+    return task;
+}
+
+void CMXScheduler::account_queue_wait(Task* task) {
+#if CMX_PROFILING_ENABLED
+    if (task && task->ready_tick != 0) {
+        uint64_t now = HighResTimer::now();
+        if (now > task->ready_tick) {
+            CMXProfiler::add_queue_wait_ticks(now - task->ready_tick);
+        }
+        task->ready_tick = 0;
+    }
+#else
+    (void)task;
+#endif
+}
+
 bool CMXScheduler::enqueue_ready_task(Task* task) {
+#if CMX_PROFILING_ENABLED
+    task->ready_tick = HighResTimer::now();
+#endif
+
+    if (single_consumer_) {
+        return enqueue_spsc(task);
+    }
+
     if (ready_count_ >= MAX_READY_TASKS) {
         return false; // Queue full
     }
@@ -1,10 +1,12 @@
 #pragma once
 
-#include <functional>
 #include <atomic>
 #include <cstdint>
 #include <mutex>
 
+#include "cmx_dma.hpp"
+#include "cmx_profiler.hpp"
+
 namespace cmx {
 namespace runtime {
 
@@ -28,34 +30,60 @@ enum class TaskStatus : uint8_t {
     FAILED = 3
 };
 
+/**
+ * @brief Task payload: raw function pointer plus opaque context
+ *
+ * Matches the cmx_kernel_fn style used by the op dispatcher. Unlike
+ * std::function this never heap-allocates, so tasks can be submitted
+ * after initialization without violating the no-heap-at-runtime policy,
+ * and execution is a plain indirect call with no wrapper destructor.
+ */
+using TaskFn = void (*)(void* context);
+
+/**
+ * @brief Range-task payload: processes slice [begin, end) of a partitioned job
+ *
+ * Used for intra-op parallelism: a splittable kernel (see
+ * CmxKernel::split_extent) is dispatched as N range tasks covering
+ * disjoint output-channel slices, so one large layer can occupy both
+ * cores instead of serializing on one.
+ */
+using RangeTaskFn = void (*)(void* context, int32_t begin, int32_t end);
+
 /**
  * @brief Lightweight task abstraction for operator execution
  */
 struct Task {
     uint32_t id;                           ///< Unique task identifier
-    std::function<void()> function_ptr;    ///< Function to execute
+    TaskFn function_ptr;                   ///< Function to execute
+    void* context;                         ///< Opaque argument passed to function_ptr
     TaskPriority priority;                 ///< Task priority level
     TaskStatus status;                     ///< Current execution status
     uint32_t dependency_count;             ///< Number of dependencies remaining
     Task* dependencies[8];                 ///< Fixed-size dependency array
     uint8_t dep_index;                     ///< Current dependency index
-    
+    bool enqueued;                         ///< Already handed to a ready queue
+    uint64_t ready_tick;                   ///< Clock tick when the task became ready (0 = unset)
+
     /**
      * @brief Default constructor
      */
-    Task() : id(0), priority(TaskPriority::NORMAL), status(TaskStatus::PENDING), 
-             dependency_count(0), dep_index(0) {
+    Task() : id(0), function_ptr(nullptr), context(nullptr),
+             priority(TaskPriority::NORMAL), status(TaskStatus::PENDING),
+             dependency_count(0), dep_index(0), enqueued(false), ready_tick(0) {
         for (int i = 0; i < 8; ++i) {
             dependencies[i] = nullptr;
         }
     }
-    
+
     /**
      * @brief Constructor with parameters
      */
-    Task(uint32_t task_id, std::function<void()> func, TaskPriority prio = TaskPriority::NORMAL)
-        : id(task_id), function_ptr(func), priority(prio), status(TaskStatus::PENDING),
-          dependency_count(0), dep_index(0) {
+    Task(uint32_t task_id, TaskFn func, void* ctx,
+         TaskPriority prio = TaskPriority::NORMAL)
+        : id(task_id), function_ptr(func), context(ctx), priority(prio),
+          status(TaskStatus::PENDING), dependency_count(0), dep_index(0),
+          enqueued(false), ready_tick(0) {
         for (int i = 0; i < 8; ++i) {
             dependencies[i] = nullptr;
         }
@@ -108,15 +136,71 @@ enum class SchedulingStrategy {
  * - Multiple scheduling strategies
  * - Thread-safe operations
  * - Fixed-size memory allocation
+ * - Cooperative background jobs that yield to urgent tasks
  */
 class CMXScheduler {
 private:
     static constexpr size_t MAX_TASKS = 256;    ///< Maximum number of tasks in queue
     static constexpr size_t MAX_READY_TASKS = 64; ///< Maximum ready tasks buffer
-    
+    static constexpr size_t MAX_RANGE_SLOTS = 32; ///< In-flight range-task slices
+    static constexpr size_t MAX_BACKGROUND_JOBS = 4; ///< Concurrent sliced jobs
+    static constexpr size_t MAX_DMA_TRANSFERS = 8; ///< Queued DMA transfer slots
+
+    /**
+     * @brief One slice of a partitioned range job
+     *
+     * Range tasks go through the ordinary task pool via a trampoline;
+     * this slot carries the per-slice bounds the Task itself cannot hold.
+     */
+    struct RangeSlot {
+        RangeTaskFn function_ptr;               ///< Slice function
+        void* context;                          ///< Shared job context
+        int32_t begin;                          ///< Slice start (inclusive)
+        int32_t end;                            ///< Slice end (exclusive)
+    };
+
+    /**
+     * @brief Checkpoint state for one time-sliced background job
+     *
+     * Background jobs never enter the task pool: the worker advances
+     * them step by step via advance_background_jobs(), and next_step
+     * is the resume point when a job yields to urgent work mid-run.
+     */
+    struct BackgroundJob {
+        RangeTaskFn function_ptr;               ///< Per-step function
+        void* context;                          ///< Job context (holds the plan state)
+        int32_t total_steps;                    ///< Number of steps in the job
+        int32_t next_step;                      ///< First step not yet executed
+        std::atomic<bool> active;               ///< Steps remain to execute
+    };
+
+    /**
+     * @brief One DMA transfer tracked as a schedulable task
+     *
+     * The transfer occupies a placeholder Task that is born RUNNING and
+     * only moves to COMPLETED when poll_dma_transfers() observes the
+     * engine finish, so compute tasks depend on the data arriving
+     * through the ordinary dependency array instead of busy-waiting on
+     * the completion flag. The chain memory must stay valid until the
+     * placeholder completes.
+     */
+    struct DmaTransfer {
+        const CMXDmaDescriptor* chain;          ///< Descriptor chain to transfer
+        Task* task;                             ///< Placeholder task dependents wait on
+        bool submitted;                         ///< Chain handed to the engine
+        std::atomic<bool> active;               ///< Transfer not yet retired
+    };
+
     Task task_pool_[MAX_TASKS];                 ///< Pre-allocated task pool
     Task* ready_queue_[MAX_READY_TASKS];        ///< Ready tasks queue
-    size_t task_count_;                         ///< Current number of tasks
+    RangeSlot range_slots_[MAX_RANGE_SLOTS];    ///< Pre-allocated range slices
+    size_t range_slot_count_;                   ///< Range slots in use
+    BackgroundJob background_jobs_[MAX_BACKGROUND_JOBS]; ///< Sliced job slots
+    std::atomic<size_t> background_job_count_;  ///< Background jobs submitted
+    DmaTransfer dma_transfers_[MAX_DMA_TRANSFERS]; ///< Queued DMA transfers
+    std::atomic<size_t> dma_transfer_count_;    ///< DMA transfers submitted
+    bool dma_idle_attached_;                    ///< This scheduler owns the DMA idle hook
+    std::atomic<size_t> task_count_;            ///< Current number of tasks
     size_t ready_count_;                        ///< Current number of ready tasks
     size_t ready_head_;                         ///< Ready queue head index
     size_t ready_tail_;                         ///< Ready queue tail index
@@ -124,8 +208,23 @@ private:
     
     SchedulingStrategy strategy_;               ///< Current scheduling strategy
     std::atomic<bool> is_running_;              ///< Scheduler running flag
-    std::mutex queue_mutex_;                    ///< Mutex for thread safety
-    
+    mutable std::mutex queue_mutex_;            ///< Mutex for thread safety
+
+    // Lock-free single-producer/single-consumer ready ring, used when
+    // single-consumer mode is enabled. The producer (submitting thread)
+    // owns spsc_tail_, the consumer (worker) owns spsc_head_; handoff
+    // is two atomic loads and one store per side, no mutex. Dependency
+    // wake-ups are discovered on the consumer thread and go through a
+    // consumer-private queue that needs no synchronization at all.
+    bool single_consumer_;                      ///< SPSC fast path enabled
+    std::atomic<size_t> spsc_head_;             ///< Consumer-owned ring index
+    std::atomic<size_t> spsc_tail_;             ///< Producer-owned ring index
+    Task* spsc_ring_[MAX_READY_TASKS];          ///< Producer-to-consumer ring
+    Task* consumer_queue_[MAX_READY_TASKS];     ///< Consumer-private wake-ups
+    size_t consumer_head_;                      ///< Consumer queue head index
+    size_t consumer_tail_;                      ///< Consumer queue tail index
+    size_t consumer_count_;                     ///< Consumer queue entries
+
     /**
      * @brief Find next task to execute based on strategy
      * @return Pointer to next task, or nullptr if none available
@@ -159,6 +258,47 @@ private:
      */
     Task* dequeue_ready_task();
 
+    /**
+     * @brief TaskFn trampoline executing one RangeSlot
+     * @param context Pointer to the RangeSlot to execute
+     */
+    static void execute_range_slot(void* context);
+
+    /**
+     * @brief Placeholder TaskFn for DMA transfer tasks (never called)
+     * @param context Unused
+     */
+    static void dma_transfer_marker(void* context);
+
+    /**
+     * @brief CMXDmaIdleFn adapter running one ready task per poll
+     * @param user Pointer to the scheduler that attached the hook
+     */
+    static void dma_idle_trampoline(void* user);
+
+    /**
+     * @brief Push a task into the SPSC ring (producer side)
+     * @param task Pointer to task to add
+     * @return true if added, false if the ring is full
+     */
+    bool enqueue_spsc(Task* task);
+
+    /**
+     * @brief Pop the next task from the SPSC ring (consumer side)
+     * @return Pointer to task, or nullptr if the ring is empty
+     */
+    Task* dequeue_spsc();
+
+    /**
+     * @brief Account a dequeued task's queue wait to the calling core
+     *
+     * The ready-to-dequeue delta feeds CMXProfiler's per-core queue
+     * wait counter; compiled out with CMX_PROFILING_ENABLED=0.
+     *
+     * @param task Task just dequeued (may be nullptr)
+     */
+    static void account_queue_wait(Task* task);
+
 public:
     /**
      * @brief Constructor
@@ -185,24 +325,146 @@ public:
     /**
      * @brief Submit a task for execution
      * @param func Function to execute
+     * @param context Opaque argument passed to func
      * @param priority Task priority level
      * @return Task ID if successful, 0 if failed
      */
-    uint32_t submit_task(std::function<void()> func, TaskPriority priority = TaskPriority::NORMAL);
-    
+    uint32_t submit_task(TaskFn func, void* context = nullptr,
+                         TaskPriority priority = TaskPriority::NORMAL);
+
     /**
      * @brief Submit a task with dependencies
      * @param func Function to execute
+     * @param context Opaque argument passed to func
      * @param deps Array of dependency task IDs
      * @param dep_count Number of dependencies
      * @param priority Task priority level
      * @return Task ID if successful, 0 if failed
      */
-    uint32_t submit_task_with_deps(std::function<void()> func, 
-                                   const uint32_t* deps, 
+    uint32_t submit_task_with_deps(TaskFn func, void* context,
+                                   const uint32_t* deps,
                                    size_t dep_count,
                                    TaskPriority priority = TaskPriority::NORMAL);
-    
+
+    /**
+     * @brief Partition [0, total) into num_tasks range tasks
+     *
+     * Splits the range into contiguous, near-equal slices and submits
+     * one task per slice. Used to fan a single splittable kernel out
+     * across cores; all slices share the same context. Slice bounds
+     * live in a fixed slot pool, so at most MAX_RANGE_SLOTS slices may
+     * be in flight between reset() calls.
+     *
+     * @param func Slice function to execute
+     * @param context Opaque argument shared by all slices
+     * @param total Extent of the range to partition
+     * @param num_tasks Number of slices to create
+     * @param priority Task priority level
+     * @return Number of tasks submitted, 0 on failure
+     */
+    size_t submit_range_tasks(RangeTaskFn func, void* context,
+                              int32_t total, size_t num_tasks,
+                              TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     * @brief Submit a time-sliced background job
+     *
+     * The job is executed as total_steps sequential calls of
+     * func(context, i, i + 1) on the worker thread, one plan node per
+     * step. Between steps the scheduler checks for HIGH/CRITICAL ready
+     * tasks and yields if one has arrived, resuming from the
+     * interrupted step on the next advance_background_jobs() call.
+     * This keeps a long LOW-priority inference from blocking a
+     * latency-critical model for its full duration: the urgent task
+     * waits at most one node boundary. Job slots are fixed and
+     * reclaimed by reset().
+     *
+     * @param func Per-step function, called with [step, step + 1)
+     * @param context Opaque argument carrying the job's resumable state
+     * @param total_steps Number of steps in the job
+     * @return Job handle if successful, 0 if failed
+     */
+    uint32_t submit_background_job(RangeTaskFn func, void* context,
+                                   int32_t total_steps);
+
+    /**
+     * @brief Advance unfinished background jobs on the calling thread
+     *
+     * Runs job steps until every job completes or an urgent task
+     * becomes ready, whichever comes first. Must be called from the
+     * worker thread, interleaved with execute_ready_tasks() so yielded
+     * urgent work actually runs before the next advance.
+     *
+     * @return Number of job steps executed
+     */
+    size_t advance_background_jobs();
+
+    /**
+     * @brief Check whether a background job has run all its steps
+     * @param job Handle returned by submit_background_job
+     * @return true if the job completed, false if unfinished or unknown
+     */
+    bool is_background_job_done(uint32_t job) const;
+
+    /**
+     * @brief Submit a descriptor chain as a dependency-capable task
+     *
+     * The returned ID can be passed to submit_task_with_deps like any
+     * other task ID, so a compute node that consumes streamed weights
+     * simply depends on its transfer: the worker keeps running other
+     * ready nodes and the dependent becomes ready when the engine
+     * signals completion, instead of the CPU spinning through the
+     * transfer. Chains start in submission order (the engines behind
+     * cmx_dma hold one in flight) and the chain memory must outlive
+     * the transfer. Slots are fixed and reclaimed by reset().
+     *
+     * @param chain Head of the descriptor chain to transfer
+     * @param priority Priority of the placeholder task
+     * @return Task ID if successful, 0 if failed
+     */
+    uint32_t submit_dma_transfer(const CMXDmaDescriptor* chain,
+                                 TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     * @brief Drive queued DMA transfers forward without blocking
+     *
+     * Starts the next queued chain when the engine is free and retires
+     * the in-flight one when it has completed, unblocking dependents.
+     * execute_ready_tasks() calls this between tasks, so worker loops
+     * built on it need no explicit polling.
+     *
+     * @return Number of transfers retired
+     */
+    size_t poll_dma_transfers();
+
+    /**
+     * @brief Route blocking DMA waits through this scheduler
+     *
+     * Installs this scheduler as the cmx_dma idle hook: any
+     * cmx_dma_wait_async — including the legacy blocking paths in the
+     * layout converters — executes one ready task per poll iteration
+     * instead of spinning. Tasks run from inside a wait must not wait
+     * on DMA themselves. The hook is released by detach or shutdown().
+     */
+    void attach_dma_idle_hook();
+
+    /**
+     * @brief Release the cmx_dma idle hook if this scheduler holds it
+     */
+    void detach_dma_idle_hook();
+
+    /**
+     * @brief Check for a ready task of HIGH or CRITICAL priority
+     *
+     * The yield test used between background job steps, exposed so
+     * executors driving their own node loop can poll it too. In
+     * single-consumer mode the scan is lock-free and meant for the
+     * worker thread; other callers should use the locked queue.
+     *
+     * @return true if an urgent task is waiting to execute
+     */
+    bool has_urgent_task() const;
+
     /**
      * @brief Execute all ready tasks
      * @return Number of tasks executed
@@ -252,6 +514,20 @@ public:
      * @param strategy New scheduling strategy
      */
     void set_strategy(SchedulingStrategy strategy);
+
+    /**
+     * @brief Enable the lock-free single-consumer fast path
+     *
+     * In the common one-producer-one-worker configuration the ready
+     * queue becomes a lock-free SPSC ring, removing the mutex from the
+     * per-op dispatch path. The caller guarantees tasks are submitted
+     * from one thread and executed on one thread. The SPSC ring is
+     * strictly FIFO; PRIORITY_BASED ordering needs the locked path.
+     * Must be called before initialize(); ignored while running.
+     *
+     * @param enable true to use the SPSC ring, false for the locked queue
+     */
+    void set_single_consumer(bool enable);
     
     /**
      * @brief Get current scheduling strategy
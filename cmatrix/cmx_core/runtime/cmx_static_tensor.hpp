@@ -0,0 +1,159 @@
+// cmx_static_tensor.hpp
+#pragma once
+
+#include "cmx_tensor.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace cmx {
+namespace runtime {
+
+/**
+ * @brief Map an element type to its DataType tag at compile time
+ */
+template<typename T> struct CMXDataTypeOf;
+template<> struct CMXDataTypeOf<float>    { static constexpr DataType value = DataType::FLOAT32; };
+template<> struct CMXDataTypeOf<int32_t>  { static constexpr DataType value = DataType::INT32; };
+template<> struct CMXDataTypeOf<int16_t>  { static constexpr DataType value = DataType::INT16; };
+template<> struct CMXDataTypeOf<int8_t>   { static constexpr DataType value = DataType::INT8; };
+template<> struct CMXDataTypeOf<uint8_t>  { static constexpr DataType value = DataType::UINT8; };
+template<> struct CMXDataTypeOf<bool>     { static constexpr DataType value = DataType::BOOL; };
+
+/**
+ * @brief Tensor with shape fixed at compile time
+ *
+ * Deployed graphs have every shape frozen at model-compile time, so
+ * the stride and index arithmetic CMXTensor performs at runtime can be
+ * constant-folded instead. All shape, stride, and offset math here is
+ * constexpr: kernels templated on a CMXStaticTensor see literal trip
+ * counts and strides, letting the compiler fully unroll and vectorize
+ * inner loops. Intended for use by the code emitted from
+ * cmx_tools/compile/code_generator.py, which knows every shape.
+ *
+ * Like CMXTensor the class never allocates; it wraps caller-provided
+ * storage.
+ *
+ * @tparam T Element type (float, int8_t, ...)
+ * @tparam N Batch dimension
+ * @tparam C Channel dimension
+ * @tparam H Height dimension
+ * @tparam W Width dimension
+ * @tparam LAYOUT Memory layout (NCHW or NHWC)
+ */
+template<typename T, size_t N, size_t C, size_t H, size_t W,
+         Layout LAYOUT = Layout::NCHW>
+class CMXStaticTensor {
+public:
+    static_assert(N > 0 && C > 0 && H > 0 && W > 0,
+                  "CMXStaticTensor dimensions must be non-zero");
+    static_assert(LAYOUT == Layout::NCHW || LAYOUT == Layout::NHWC,
+                  "CMXStaticTensor supports NCHW and NHWC layouts");
+
+    static constexpr size_t kBatch = N;
+    static constexpr size_t kChannels = C;
+    static constexpr size_t kHeight = H;
+    static constexpr size_t kWidth = W;
+    static constexpr size_t kSize = N * C * H * W;
+    static constexpr size_t kByteSize = kSize * sizeof(T);
+    static constexpr DataType kDataType = CMXDataTypeOf<T>::value;
+    static constexpr Layout kLayout = LAYOUT;
+
+    /**
+     * @brief Wrap caller-provided storage of kSize elements
+     */
+    explicit constexpr CMXStaticTensor(T* data) : data_(data) {}
+
+    /**
+     * @brief Get tensor data pointer
+     */
+    constexpr T* data() const { return data_; }
+
+    /**
+     * @brief Compute the flat offset of an element (constant-folded)
+     */
+    static constexpr size_t offset(size_t n, size_t c, size_t h, size_t w) {
+        return LAYOUT == Layout::NCHW
+            ? ((n * C + c) * H + h) * W + w
+            : ((n * H + h) * W + w) * C + c;
+    }
+
+    /**
+     * @brief Stride of each dimension in elements (constant-folded)
+     */
+    static constexpr size_t stride_n() { return LAYOUT == Layout::NCHW ? C * H * W : H * W * C; }
+    static constexpr size_t stride_c() { return LAYOUT == Layout::NCHW ? H * W : 1; }
+    static constexpr size_t stride_h() { return LAYOUT == Layout::NCHW ? W : W * C; }
+    static constexpr size_t stride_w() { return LAYOUT == Layout::NCHW ? 1 : C; }
+
+    /**
+     * @brief Element access by logical coordinates
+     */
+    T& at(size_t n, size_t c, size_t h, size_t w) const {
+        return data_[offset(n, c, h, w)];
+    }
+
+    /**
+     * @brief Flat element access
+     */
+    T& operator[](size_t i) const { return data_[i]; }
+
+    /**
+     * @brief Bridge to the dynamic tensor type for non-templated code
+     */
+    CMXTensor as_dynamic() const {
+        return CMXTensor::wrap(data_, {N, C, H, W}, kDataType, LAYOUT);
+    }
+
+private:
+    T* data_;
+};
+
+/**
+ * @brief ReLU over a static tensor
+ *
+ * The trip count is a compile-time constant, so the loop unrolls and
+ * vectorizes with no runtime shape reads.
+ */
+template<typename TensorT>
+inline void cmx_static_relu(const TensorT& input, const TensorT& output) {
+    for (size_t i = 0; i < TensorT::kSize; ++i) {
+        auto v = input[i];
+        output[i] = v > 0 ? v : static_cast<decltype(v)>(0);
+    }
+}
+
+/**
+ * @brief Element-wise addition over static tensors of identical shape
+ */
+template<typename TensorT>
+inline void cmx_static_add(const TensorT& a, const TensorT& b,
+                           const TensorT& output) {
+    for (size_t i = 0; i < TensorT::kSize; ++i) {
+        output[i] = a[i] + b[i];
+    }
+}
+
+/**
+ * @brief Scale-and-bias over the channel dimension of a static tensor
+ *
+ * Covers the folded batchnorm / per-channel dequantize pattern; the
+ * channel stride is a literal so the compiler keeps the per-channel
+ * coefficients in registers across the unrolled spatial loop.
+ */
+template<typename TensorT, typename CoeffT>
+inline void cmx_static_scale_bias(const TensorT& input, const CoeffT* scale,
+                                  const CoeffT* bias, const TensorT& output) {
+    for (size_t n = 0; n < TensorT::kBatch; ++n) {
+        for (size_t c = 0; c < TensorT::kChannels; ++c) {
+            for (size_t h = 0; h < TensorT::kHeight; ++h) {
+                for (size_t w = 0; w < TensorT::kWidth; ++w) {
+                    output.at(n, c, h, w) =
+                        input.at(n, c, h, w) * scale[c] + bias[c];
+                }
+            }
+        }
+    }
+}
+
+} // namespace runtime
+} // namespace cmx
@@ -147,6 +147,133 @@ bool CMXTensor::reshape(std::initializer_list<size_t> new_shape) {
     return reshape(temp_shape);
 }
 
+bool CMXTensor::is_contiguous() const {
+    StrideArray packed = packed_strides();
+    for (size_t i = 0; i < ndims_; ++i) {
+        if (strides_[i] != packed[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CMXTensor::pad_channels(size_t lane_width) {
+    if (lane_width == 0 || layout_ != Layout::NHWC || ndims_ < 4) {
+        return false;
+    }
+
+    // Round the physical channel extent up; shape_ keeps the logical C
+    size_t padded_c = ((shape_[1] + lane_width - 1) / lane_width) * lane_width;
+    size_t elem_size = element_size();
+
+    strides_[1] = elem_size;                   // Channel stride
+    strides_[3] = strides_[1] * padded_c;      // Width stride (padded)
+    strides_[2] = strides_[3] * shape_[3];     // Height stride
+    strides_[0] = strides_[2] * shape_[2];     // Batch stride
+
+    return true;
+}
+
+size_t CMXTensor::physical_byte_size() const {
+    if (ndims_ == 0 || size() == 0) {
+        return 0;
+    }
+
+    // Highest addressed byte: last element of every dimension, plus one
+    // element. Reduces to byte_size() for packed strides.
+    size_t span = element_size();
+    for (size_t i = 0; i < ndims_; ++i) {
+        span += (shape_[i] - 1) * strides_[i];
+    }
+    return span;
+}
+
+CMXTensor CMXTensor::narrow(size_t dim, size_t start, size_t length) const {
+    if (!data_ || dim >= ndims_ || length == 0 ||
+        start >= shape_[dim] || start + length > shape_[dim]) {
+        return CMXTensor();
+    }
+
+    CMXTensor view_tensor;
+    view_tensor.data_ = static_cast<uint8_t*>(data_) + start * strides_[dim];
+    view_tensor.shape_ = shape_;
+    view_tensor.shape_[dim] = length;
+    view_tensor.strides_ = strides_;
+    view_tensor.dtype_ = dtype_;
+    view_tensor.layout_ = layout_;
+    view_tensor.ndims_ = ndims_;
+    view_tensor.owns_data_ = false;
+
+    return view_tensor;
+}
+
+CMXTensor CMXTensor::slice(size_t dim, size_t index) const {
+    if (!data_ || dim >= ndims_ || index >= shape_[dim]) {
+        return CMXTensor();
+    }
+
+    CMXTensor view_tensor;
+    view_tensor.data_ = static_cast<uint8_t*>(data_) + index * strides_[dim];
+    view_tensor.dtype_ = dtype_;
+    view_tensor.layout_ = layout_;
+    view_tensor.ndims_ = ndims_ - 1;
+    view_tensor.owns_data_ = false;
+
+    // Drop the fixed dimension, shifting the remainder left
+    view_tensor.shape_.fill(0);
+    view_tensor.strides_.fill(0);
+    size_t out = 0;
+    for (size_t i = 0; i < ndims_; ++i) {
+        if (i == dim) {
+            continue;
+        }
+        view_tensor.shape_[out] = shape_[i];
+        view_tensor.strides_[out] = strides_[i];
+        ++out;
+    }
+
+    return view_tensor;
+}
+
+CMXTensor CMXTensor::view(std::initializer_list<size_t> new_shape) const {
+    if (!data_ || !is_contiguous()) {
+        return CMXTensor();
+    }
+
+    CMXTensor view_tensor;
+    view_tensor.set_shape_from_list(new_shape);
+    if (view_tensor.ndims_ == 0) {
+        return CMXTensor();
+    }
+
+    size_t new_size = 1;
+    for (size_t i = 0; i < view_tensor.ndims_; ++i) {
+        new_size *= view_tensor.shape_[i];
+    }
+    if (new_size != size()) {
+        return CMXTensor();
+    }
+
+    view_tensor.data_ = data_;
+    view_tensor.dtype_ = dtype_;
+    view_tensor.layout_ = layout_;
+    view_tensor.owns_data_ = false;
+    view_tensor.calculate_strides();
+
+    return view_tensor;
+}
+
+CMXTensor CMXTensor::crop(size_t row_start, size_t rows,
+                          size_t col_start, size_t cols) const {
+    // Shapes are stored in logical NCHW order for both layouts, so the
+    // spatial dimensions are always indices 2 (height) and 3 (width)
+    if (ndims_ != 4) {
+        return CMXTensor();
+    }
+
+    return narrow(2, row_start, rows).narrow(3, col_start, cols);
+}
+
 bool CMXTensor::shape_equals(const CMXTensor& other) const {
     if (ndims_ != other.ndims_) {
         return false;
@@ -195,49 +322,56 @@ CMXTensor CMXTensor::scalar(void* data, DataType dtype) {
 }
 
 void CMXTensor::calculate_strides() {
-    strides_.fill(0);
-    
+    strides_ = packed_strides();
+}
+
+CMXTensor::StrideArray CMXTensor::packed_strides() const {
+    StrideArray strides;
+    strides.fill(0);
+
     if (ndims_ == 0) {
-        return;
+        return strides;
     }
-    
+
     size_t elem_size = element_size();
-    
+
     switch (layout_) {
         case Layout::NCHW:
             // Row-major: rightmost dimension has stride 1
-            if (ndims_ > 0) strides_[ndims_ - 1] = elem_size;
+            if (ndims_ > 0) strides[ndims_ - 1] = elem_size;
             for (int i = static_cast<int>(ndims_) - 2; i >= 0; --i) {
-                strides_[i] = strides_[i + 1] * shape_[i + 1];
+                strides[i] = strides[i + 1] * shape_[i + 1];
             }
             break;
-            
+
         case Layout::NHWC:
             // Channel-last: channel dimension has stride 1
             if (ndims_ >= 4) {
-                strides_[1] = elem_size;  // Channel stride
-                strides_[3] = strides_[1] * shape_[1];  // Width stride
-                strides_[2] = strides_[3] * shape_[3];  // Height stride
-                strides_[0] = strides_[2] * shape_[2];  // Batch stride
+                strides[1] = elem_size;  // Channel stride
+                strides[3] = strides[1] * shape_[1];  // Width stride
+                strides[2] = strides[3] * shape_[3];  // Height stride
+                strides[0] = strides[2] * shape_[2];  // Batch stride
             } else {
                 // Fall back to row-major for lower dimensions
-                if (ndims_ > 0) strides_[ndims_ - 1] = elem_size;
+                if (ndims_ > 0) strides[ndims_ - 1] = elem_size;
                 for (int i = static_cast<int>(ndims_) - 2; i >= 0; --i) {
-                    strides_[i] = strides_[i + 1] * shape_[i + 1];
+                    strides[i] = strides[i + 1] * shape_[i + 1];
                 }
             }
             break;
-            
+
         case Layout::NC:
         case Layout::SCALAR:
         default:
             // Standard row-major layout
-            if (ndims_ > 0) strides_[ndims_ - 1] = elem_size;
+            if (ndims_ > 0) strides[ndims_ - 1] = elem_size;
             for (int i = static_cast<int>(ndims_) - 2; i >= 0; --i) {
-                strides_[i] = strides_[i + 1] * shape_[i + 1];
+                strides[i] = strides[i + 1] * shape_[i + 1];
             }
             break;
     }
+
+    return strides;
 }
 
 size_t CMXTensor::get_element_size(DataType dtype) {
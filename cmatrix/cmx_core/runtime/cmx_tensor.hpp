@@ -182,6 +182,97 @@ public:
      */
     bool reshape(std::initializer_list<size_t> new_shape);
 
+    /**
+     * @brief Check if tensor data is densely packed for its layout
+     * @return True if strides match the packed strides of shape and layout
+     */
+    bool is_contiguous() const;
+
+    /**
+     * @brief Pad the physical channel extent to a SIMD lane width
+     *
+     * For a 4D NHWC tensor, recomputes strides as if the channel count
+     * were rounded up to a multiple of lane_width. The logical shape is
+     * unchanged; kernels that honor strides() see the padded pixel
+     * stride and can issue full-width lane loads without scalar tails
+     * for ragged channel counts (e.g. 3 or 17 channels on 4/8/16-lane
+     * ISAs). The backing buffer must span physical_byte_size(); the pad
+     * lanes are ignored, not cleared.
+     *
+     * @param lane_width SIMD lane count to round the channel dim up to
+     * @return True if padding was applied, false for non-NHWC/non-4D
+     *         tensors or lane_width of 0
+     */
+    bool pad_channels(size_t lane_width);
+
+    /**
+     * @brief Byte span of the backing buffer implied by the strides
+     *
+     * Equals byte_size() for contiguous tensors; larger when strides
+     * carry padding (e.g. after pad_channels()). This is the size the
+     * memory planner must reserve.
+     *
+     * @return Addressed byte span including stride padding
+     */
+    size_t physical_byte_size() const;
+
+    /**
+     * @brief Create a non-owning view of a sub-range along one dimension
+     *
+     * The view shares this tensor's data and strides; only the shape
+     * entry for dim shrinks and the data pointer advances by
+     * start * strides[dim]. No element is copied, so the view may be
+     * non-contiguous; consumers must honor strides(). The view does not
+     * extend the data's lifetime.
+     *
+     * @param dim Dimension to narrow
+     * @param start First index to keep (inclusive)
+     * @param length Number of indices to keep
+     * @return Non-owning view, empty tensor if the range is invalid
+     */
+    CMXTensor narrow(size_t dim, size_t start, size_t length) const;
+
+    /**
+     * @brief Create a non-owning view with one dimension fixed and removed
+     *
+     * Selects index along dim and drops that dimension, reducing rank by
+     * one (e.g. one channel plane of an NCHW tensor). Shares data with
+     * this tensor without copying.
+     *
+     * @param dim Dimension to fix
+     * @param index Index to select along dim
+     * @return Non-owning view of rank ndims() - 1, empty tensor if invalid
+     */
+    CMXTensor slice(size_t dim, size_t index) const;
+
+    /**
+     * @brief Create a non-owning reshaped view without copying
+     *
+     * Requires the tensor to be contiguous, since a packed
+     * reinterpretation of the same bytes is only valid then; use
+     * reshape() to change this tensor in place instead.
+     *
+     * @param new_shape New tensor shape (same total element count)
+     * @return Non-owning view, empty tensor if non-contiguous or size differs
+     */
+    CMXTensor view(std::initializer_list<size_t> new_shape) const;
+
+    /**
+     * @brief Create a non-owning region-of-interest crop of a 4D tensor
+     *
+     * Narrows the spatial height and width dimensions of an NCHW or NHWC
+     * tensor, keeping all batches and channels. The crop shares the
+     * original data — ROI extraction costs zero bytes of traffic — so
+     * consumers must honor strides().
+     *
+     * @param row_start First row of the region
+     * @param rows Region height
+     * @param col_start First column of the region
+     * @param cols Region width
+     * @return Non-owning view, empty tensor if the region is invalid
+     */
+    CMXTensor crop(size_t row_start, size_t rows, size_t col_start, size_t cols) const;
+
     /**
      * @brief Compare tensor shapes
      * @param other Tensor to compare with
@@ -247,6 +338,12 @@ private:
      */
     void calculate_strides();
 
+    /**
+     * @brief Compute the packed strides for the current shape and layout
+     * @return Stride array of a densely packed tensor
+     */
+    StrideArray packed_strides() const;
+
     /**
      * @brief Get element size for given data type
      * @param dtype Data type
@@ -0,0 +1,110 @@
+// cmx_trace_export.cpp
+#include "cmx_trace_export.hpp"
+
+#include <cstring>
+
+namespace cmx {
+namespace runtime {
+
+namespace {
+
+// Events are drained and serialized in batches this size; the staging
+// buffers live on the stack so the dump performs no allocation
+constexpr size_t DUMP_BATCH_EVENTS = 32;
+
+// Serialized event size: label_id + t_start + t_end, packed
+constexpr size_t SERIALIZED_EVENT_SIZE =
+    sizeof(uint16_t) + 2 * sizeof(uint64_t);
+
+// Append a POD field to the serialization buffer
+template <typename T>
+size_t put(uint8_t* buffer, size_t offset, const T& value) {
+    std::memcpy(buffer + offset, &value, sizeof(T));
+    return offset + sizeof(T);
+}
+
+bool write_block_header(CMXTraceWriteFn write_fn, void* user, uint16_t core,
+                        uint32_t event_count) {
+    uint8_t buffer[sizeof(uint16_t) * 2 + sizeof(uint32_t)];
+    size_t offset = 0;
+    offset = put(buffer, offset, core);
+    offset = put(buffer, offset, static_cast<uint16_t>(0));
+    offset = put(buffer, offset, event_count);
+    return write_fn(buffer, offset, user);
+}
+
+} // namespace
+
+bool cmx_trace_dump(CMXTraceWriteFn write_fn, void* user) {
+    if (!write_fn) {
+        return false;
+    }
+
+    // Count the interned labels; ids are assigned densely
+    uint16_t label_count = 0;
+    while (label_count < CMXTraceRing::MAX_LABELS &&
+           CMXTraceRing::label_name(label_count)) {
+        label_count++;
+    }
+
+    // Header, serialized field by field so struct padding never leaks
+    // into the stream
+    {
+        uint8_t buffer[sizeof(CMXTraceDumpHeader)];
+        size_t offset = 0;
+        offset = put(buffer, offset, CMX_TRACE_DUMP_MAGIC);
+        offset = put(buffer, offset, CMX_TRACE_DUMP_VERSION);
+        offset = put(buffer, offset,
+                     static_cast<uint16_t>(CMX_TRACE_MAX_CORES));
+        offset = put(buffer, offset, HighResTimer::ticks_per_second());
+        offset = put(buffer, offset, label_count);
+        offset = put(buffer, offset, static_cast<uint16_t>(0));
+        if (!write_fn(buffer, offset, user)) {
+            return false;
+        }
+    }
+
+    // Label table: length-prefixed strings, truncated at 255 bytes
+    for (uint16_t i = 0; i < label_count; ++i) {
+        const char* name = CMXTraceRing::label_name(i);
+        size_t length = std::strlen(name);
+        if (length > 255) {
+            length = 255;
+        }
+        const uint8_t length_byte = static_cast<uint8_t>(length);
+        if (!write_fn(&length_byte, 1, user) ||
+            !write_fn(name, length, user)) {
+            return false;
+        }
+    }
+
+    // Event blocks: drain each ring in batches until empty
+    for (uint32_t core = 0; core < CMX_TRACE_MAX_CORES; ++core) {
+        TraceEvent events[DUMP_BATCH_EVENTS];
+        size_t drained;
+        while ((drained = CMXTraceRing::drain(core, events,
+                                              DUMP_BATCH_EVENTS)) > 0) {
+            if (!write_block_header(write_fn, user,
+                                    static_cast<uint16_t>(core),
+                                    static_cast<uint32_t>(drained))) {
+                return false;
+            }
+
+            uint8_t buffer[DUMP_BATCH_EVENTS * SERIALIZED_EVENT_SIZE];
+            size_t offset = 0;
+            for (size_t i = 0; i < drained; ++i) {
+                offset = put(buffer, offset, events[i].label_id);
+                offset = put(buffer, offset, events[i].t_start);
+                offset = put(buffer, offset, events[i].t_end);
+            }
+            if (!write_fn(buffer, offset, user)) {
+                return false;
+            }
+        }
+    }
+
+    return write_block_header(write_fn, user, CMX_TRACE_DUMP_END, 0);
+}
+
+} // namespace runtime
+} // namespace cmx
@@ -0,0 +1,83 @@
+// cmx_trace_export.hpp
+#pragma once
+
+#include "cmx_profiler.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace cmx {
+namespace runtime {
+
+/**
+ * @brief Binary trace dump of the CMXTraceRing event buffers
+ *
+ * Serializes the interned label table and every buffered event into a
+ * compact little-endian stream suitable for a UART or RTT channel, so a
+ * full inference timeline can be pulled off-device and converted to
+ * Chrome trace-event JSON by cmx_tools/utils/trace_converter.py. The
+ * stream is header + label table + one event block per core; events
+ * keep their raw tick timestamps and the header carries the tick rate,
+ * so conversion to wall time happens on the host.
+ *
+ * Stream layout (all fields little-endian, packed):
+ *   CMXTraceDumpHeader
+ *   label_count x { uint8_t length; char bytes[length] }
+ *   repeated    { CMXTraceDumpBlockHeader; event_count x
+ *                 { uint16_t label_id; uint64_t t_start; uint64_t t_end } }
+ *   terminator block { core = 0xFFFF, event_count = 0 }
+ *
+ * Events are drained in small batches, so one core may contribute
+ * several blocks; the block structure exists only so the stream can be
+ * written without knowing event counts upfront.
+ */
+
+/// Magic value identifying a trace dump stream ("CMXT")
+constexpr uint32_t CMX_TRACE_DUMP_MAGIC = 0x54584D43u;
+
+/// Bumped whenever the stream layout changes
+constexpr uint16_t CMX_TRACE_DUMP_VERSION = 1;
+
+/// Terminator value in CMXTraceDumpBlockHeader::core ending the stream
+constexpr uint16_t CMX_TRACE_DUMP_END = 0xFFFF;
+
+struct CMXTraceDumpHeader {
+    uint32_t magic;             ///< CMX_TRACE_DUMP_MAGIC
+    uint16_t version;           ///< CMX_TRACE_DUMP_VERSION
+    uint16_t core_count;        ///< Cores the firmware traces
+    uint64_t ticks_per_second;  ///< Tick rate of the event timestamps
+    uint16_t label_count;       ///< Entries in the label table
+    uint16_t reserved;          ///< Zero
+};
+
+struct CMXTraceDumpBlockHeader {
+    uint16_t core;              ///< Core index, CMX_TRACE_DUMP_END at end
+    uint16_t reserved;          ///< Zero
+    uint32_t event_count;       ///< Events following this header
+};
+
+/**
+ * @brief Sink callback receiving consecutive chunks of the dump stream
+ *
+ * Return false to abort the dump (e.g. on transport error). The data
+ * pointer is only valid for the duration of the call.
+ */
+using CMXTraceWriteFn = bool (*)(const void* data, size_t size, void* user);
+
+/**
+ * @brief Drain all trace rings and stream them through the sink
+ *
+ * Consumes the buffered events (they are gone from the rings
+ * afterwards), so call it instead of - not alongside - the profiler's
+ * aggregation drain when a timeline is wanted. Single-consumer like
+ * CMXTraceRing::drain(); do not run concurrently with get_report().
+ * Events are staged through a small stack buffer, so the dump itself
+ * performs no allocation.
+ *
+ * @param write_fn Sink receiving the stream chunks
+ * @param user Opaque pointer passed through to the sink
+ * @return true if the whole stream was written
+ */
+bool cmx_trace_dump(CMXTraceWriteFn write_fn, void* user);
+
+} // namespace runtime
+} // namespace cmx
@@ -0,0 +1,210 @@
+// cmx_weight_cache.cpp
+#include "cmx_weight_cache.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace cmx {
+namespace runtime {
+
+namespace {
+
+// Built-in synchronous fallback transport, mirroring the streamer's
+bool memcpy_start(void* dst, const void* src, size_t size, void* /*user*/) {
+    std::memcpy(dst, src, size);
+    return true;
+}
+
+bool memcpy_poll(void* /*user*/) {
+    return true;
+}
+
+} // namespace
+
+CMXWeightCache::CMXWeightCache()
+    : window_(nullptr)
+    , window_size_(0)
+    , transport_{memcpy_start, memcpy_poll, nullptr}
+    , configured_(false)
+    , use_counter_(0)
+    , stats_{} {
+}
+
+bool CMXWeightCache::configure(void* window, size_t window_size,
+                               const CMXWeightStreamer::Transport* transport) {
+    if (!window || window_size == 0) {
+        return false;
+    }
+
+    window_ = static_cast<uint8_t*>(window);
+    window_size_ = window_size;
+
+    if (transport) {
+        if (!transport->start || !transport->poll) {
+            return false;
+        }
+        transport_ = *transport;
+    } else {
+        transport_ = {memcpy_start, memcpy_poll, nullptr};
+    }
+
+    entries_.clear();
+    pinned_models_.clear();
+    use_counter_ = 0;
+    stats_ = {};
+    configured_ = true;
+    return true;
+}
+
+const void* CMXWeightCache::acquire(uint32_t model_id, uint32_t layer_id,
+                                    const void* src, size_t size) {
+    if (!configured_ || !src || size == 0) {
+        return nullptr;
+    }
+
+    if (Entry* entry = find_entry(model_id, layer_id)) {
+        entry->last_use = ++use_counter_;
+        ++stats_.hits;
+        return window_ + entry->offset;
+    }
+
+    // Oversized blobs never pass through the window; computing from
+    // the slow tier beats thrashing the whole cache for one layer
+    if (size > window_size_) {
+        ++stats_.bypasses;
+        return src;
+    }
+
+    size_t offset = find_gap(size);
+    while (offset == SIZE_MAX) {
+        if (!evict_one()) {
+            // Everything resident is pinned; serve this blob slow
+            ++stats_.bypasses;
+            return src;
+        }
+        offset = find_gap(size);
+    }
+
+    if (!stage(window_ + offset, src, size)) {
+        return nullptr;
+    }
+
+    entries_.push_back({model_id, layer_id, offset, size, ++use_counter_});
+    ++stats_.misses;
+    stats_.resident_bytes += size;
+    stats_.resident_entries = entries_.size();
+    return window_ + offset;
+}
+
+void CMXWeightCache::pin_model(uint32_t model_id) {
+    if (!is_pinned(model_id)) {
+        pinned_models_.push_back(model_id);
+    }
+}
+
+void CMXWeightCache::unpin_model(uint32_t model_id) {
+    pinned_models_.erase(
+        std::remove(pinned_models_.begin(), pinned_models_.end(), model_id),
+        pinned_models_.end());
+}
+
+size_t CMXWeightCache::invalidate_model(uint32_t model_id) {
+    size_t dropped = 0;
+    for (size_t i = entries_.size(); i > 0; --i) {
+        if (entries_[i - 1].model_id == model_id) {
+            stats_.resident_bytes -= entries_[i - 1].size;
+            entries_.erase(entries_.begin() + (i - 1));
+            ++dropped;
+        }
+    }
+    stats_.resident_entries = entries_.size();
+    return dropped;
+}
+
+void CMXWeightCache::clear() {
+    entries_.clear();
+    pinned_models_.clear();
+    stats_.resident_bytes = 0;
+    stats_.resident_entries = 0;
+}
+
+CMXWeightCache::Stats CMXWeightCache::get_stats() const {
+    return stats_;
+}
+
+CMXWeightCache::Entry* CMXWeightCache::find_entry(uint32_t model_id,
+                                                  uint32_t layer_id) {
+    for (Entry& entry : entries_) {
+        if (entry.model_id == model_id && entry.layer_id == layer_id) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+bool CMXWeightCache::is_pinned(uint32_t model_id) const {
+    return std::find(pinned_models_.begin(), pinned_models_.end(),
+                     model_id) != pinned_models_.end();
+}
+
+size_t CMXWeightCache::find_gap(size_t size) const {
+    // First-fit over the gaps between resident entries. Entry counts
+    // are tens of layers, so a sort per miss stays cheap next to the
+    // staging copy it precedes.
+    std::vector<const Entry*> by_offset;
+    by_offset.reserve(entries_.size());
+    for (const Entry& entry : entries_) {
+        by_offset.push_back(&entry);
+    }
+    std::sort(by_offset.begin(), by_offset.end(),
+              [](const Entry* a, const Entry* b) {
+                  return a->offset < b->offset;
+              });
+
+    size_t cursor = 0;
+    for (const Entry* entry : by_offset) {
+        if (entry->offset - cursor >= size) {
+            return cursor;
+        }
+        cursor = entry->offset + entry->size;
+    }
+    if (window_size_ - cursor >= size) {
+        return cursor;
+    }
+    return SIZE_MAX;
+}
+
+bool CMXWeightCache::evict_one() {
+    size_t victim = SIZE_MAX;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        if (is_pinned(entries_[i].model_id)) {
+            continue;
+        }
+        if (victim == SIZE_MAX ||
+            entries_[i].last_use < entries_[victim].last_use) {
+            victim = i;
+        }
+    }
+    if (victim == SIZE_MAX) {
+        return false;
+    }
+
+    stats_.resident_bytes -= entries_[victim].size;
+    entries_.erase(entries_.begin() + victim);
+    stats_.resident_entries = entries_.size();
+    ++stats_.evictions;
+    return true;
+}
+
+bool CMXWeightCache::stage(void* dst, const void* src, size_t size) {
+    // Staging is synchronous from the caller's view: the blob is
+    // needed now, so an async transport is simply polled to completion
+    if (!transport_.start(dst, src, size, transport_.user)) {
+        return false;
+    }
+    while (!transport_.poll(transport_.user)) {
+    }
+    return true;
+}
+
+} // namespace runtime
+} // namespace cmx
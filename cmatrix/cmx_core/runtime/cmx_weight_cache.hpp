@@ -0,0 +1,156 @@
+// cmx_weight_cache.hpp
+#pragma once
+
+#include "cmx_weight_streamer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cmx {
+namespace runtime {
+
+/**
+ * @brief Cross-inference weight cache over the fast memory tier
+ *
+ * Gateways rotating through several models used to re-stage every
+ * weight blob from flash/PSRAM into the fast tier on each invocation -
+ * cold staging dominates per-invocation time in rotation workloads.
+ * The cache keeps staged blobs resident across invocations, keyed by
+ * (model, layer), with LRU eviction: the handful of models in active
+ * rotation keep their hot layers in the fast tier while the rest age
+ * out naturally.
+ *
+ * Blobs larger than the whole cache window are served straight from
+ * their slow-tier location (same XIP fallback as the streamer).
+ * Models whose latency matters most can be pinned, exempting their
+ * entries from eviction until unpinned. Staging goes through the
+ * streamer's Transport hooks, so the same DMA wiring covers both;
+ * a null transport falls back to memcpy.
+ */
+class CMXWeightCache {
+public:
+    /**
+     * @brief Cache effectiveness counters
+     */
+    struct Stats {
+        uint64_t hits;            ///< Acquires served without staging
+        uint64_t misses;          ///< Acquires that staged from the slow tier
+        uint64_t evictions;       ///< Entries dropped to make room
+        uint64_t bypasses;        ///< Oversized blobs served from the slow tier
+        size_t resident_bytes;    ///< Bytes currently cached
+        size_t resident_entries;  ///< Blobs currently cached
+    };
+
+    CMXWeightCache();
+
+    // Non-copyable, non-movable (entries reference the window)
+    CMXWeightCache(const CMXWeightCache&) = delete;
+    CMXWeightCache& operator=(const CMXWeightCache&) = delete;
+    CMXWeightCache(CMXWeightCache&&) = delete;
+    CMXWeightCache& operator=(CMXWeightCache&&) = delete;
+
+    /**
+     * @brief Configure the fast-tier window and staging transport
+     *
+     * The window is referenced, not owned, and must outlive the cache
+     * (same rule as the memory pool's attached regions).
+     *
+     * @param window Fast-tier memory backing the cache
+     * @param window_size Window size in bytes
+     * @param transport Async copy hooks, or nullptr for memcpy fallback
+     * @return True on success, false on invalid arguments
+     */
+    bool configure(void* window, size_t window_size,
+                   const CMXWeightStreamer::Transport* transport = nullptr);
+
+    /**
+     * @brief Get a blob's fast-tier copy, staging it on first use
+     *
+     * On a hit the resident copy is returned immediately and its LRU
+     * age refreshed. On a miss the blob is staged into the window,
+     * evicting least-recently-used unpinned entries until it fits.
+     * Blobs that cannot fit even with the cache empty are returned
+     * as-is from the slow tier.
+     *
+     * @param model_id Caller-assigned model identifier
+     * @param layer_id Layer index within the model
+     * @param src Blob location in the slow tier
+     * @param size Blob size in bytes
+     * @return Pointer to the bytes to compute from, nullptr on
+     *         invalid arguments or staging failure
+     */
+    const void* acquire(uint32_t model_id, uint32_t layer_id,
+                        const void* src, size_t size);
+
+    /**
+     * @brief Exempt a model's entries from eviction
+     *
+     * Covers entries staged later as well. Pinning more than the
+     * window holds starves other models; pin only the rotation's
+     * latency-critical members.
+     */
+    void pin_model(uint32_t model_id);
+
+    /**
+     * @brief Make a model's entries evictable again
+     */
+    void unpin_model(uint32_t model_id);
+
+    /**
+     * @brief Drop a model's entries (weights updated or model unloaded)
+     * @return Number of entries dropped
+     */
+    size_t invalidate_model(uint32_t model_id);
+
+    /**
+     * @brief Drop every entry and clear all pins
+     */
+    void clear();
+
+    /**
+     * @brief Get cache effectiveness counters
+     */
+    Stats get_stats() const;
+
+private:
+    struct Entry {
+        uint32_t model_id;
+        uint32_t layer_id;
+        size_t offset;      // Placement within the window
+        size_t size;
+        uint64_t last_use;  // LRU age, from use_counter_
+    };
+
+    uint8_t* window_;
+    size_t window_size_;
+    CMXWeightStreamer::Transport transport_;
+    bool configured_;
+
+    std::vector<Entry> entries_;
+    std::vector<uint32_t> pinned_models_;
+    uint64_t use_counter_;
+    Stats stats_;
+
+    Entry* find_entry(uint32_t model_id, uint32_t layer_id);
+    bool is_pinned(uint32_t model_id) const;
+
+    /**
+     * @brief Find a free gap in the window for a blob of this size
+     * @return Offset of the gap, or SIZE_MAX if none exists
+     */
+    size_t find_gap(size_t size) const;
+
+    /**
+     * @brief Evict the least-recently-used unpinned entry
+     * @return True if an entry was evicted, false if none is evictable
+     */
+    bool evict_one();
+
+    /**
+     * @brief Stage a blob into the window, blocking until complete
+     */
+    bool stage(void* dst, const void* src, size_t size);
+};
+
+} // namespace runtime
+} // namespace cmx
@@ -0,0 +1,141 @@
+// cmx_weight_streamer.cpp
+#include "cmx_weight_streamer.hpp"
+#include <cstring>
+
+namespace cmx {
+namespace runtime {
+
+CMXWeightStreamer::CMXWeightStreamer()
+    : transport_{memcpy_start, memcpy_poll, nullptr}
+    , buffers_{nullptr, nullptr}
+    , buffer_size_(0)
+    , next_prefetch_(0)
+    , pending_buffer_(-1)
+    , configured_(false) {
+}
+
+bool CMXWeightStreamer::configure(void* buffer_a, void* buffer_b, size_t buffer_size,
+                                  const Transport* transport) {
+    if (!buffer_a || !buffer_b || buffer_size == 0) {
+        return false;
+    }
+
+    buffers_[0] = buffer_a;
+    buffers_[1] = buffer_b;
+    buffer_size_ = buffer_size;
+
+    if (transport) {
+        if (!transport->start || !transport->poll) {
+            return false;
+        }
+        transport_ = *transport;
+    } else {
+        transport_ = {memcpy_start, memcpy_poll, nullptr};
+    }
+
+    configured_ = true;
+    return true;
+}
+
+size_t CMXWeightStreamer::add_layer(const void* flash_ptr, size_t size) {
+    blobs_.push_back({flash_ptr, size});
+    blob_buffer_.push_back(-1);
+    return blobs_.size() - 1;
+}
+
+bool CMXWeightStreamer::begin() {
+    if (!configured_ || blobs_.empty()) {
+        return false;
+    }
+
+    next_prefetch_ = 0;
+    pending_buffer_ = -1;
+    for (size_t i = 0; i < blob_buffer_.size(); ++i) {
+        blob_buffer_[i] = -1;
+    }
+    return issue_prefetch(0);
+}
+
+const void* CMXWeightStreamer::acquire(size_t layer_index) {
+    if (!configured_ || layer_index >= blobs_.size()) {
+        return nullptr;
+    }
+
+    const WeightBlob& blob = blobs_[layer_index];
+
+    // Oversized blobs never entered the ping-pong pipeline; execute
+    // them in place from flash
+    if (blob.size > buffer_size_) {
+        return blob.flash_ptr;
+    }
+
+    // Out-of-order acquire means the pipeline no longer matches the
+    // execution order; refuse rather than hand back wrong weights
+    int ready_buffer = blob_buffer_[layer_index];
+    if (ready_buffer < 0) {
+        return nullptr;
+    }
+
+    // Wait for the in-flight transfer of this layer. When the DMA
+    // finished during the previous layer's compute this spins zero times.
+    if (pending_buffer_ == ready_buffer) {
+        while (!transport_.poll(transport_.user)) {
+            // Busy-wait: transfers are short relative to layer compute
+        }
+        pending_buffer_ = -1;
+    }
+
+    // Overlap the next layer's fetch with this layer's compute, into
+    // the buffer this layer is not reading
+    issue_prefetch(1 - ready_buffer);
+
+    return buffers_[ready_buffer];
+}
+
+void CMXWeightStreamer::reset() {
+    next_prefetch_ = 0;
+    pending_buffer_ = -1;
+    for (size_t i = 0; i < blob_buffer_.size(); ++i) {
+        blob_buffer_[i] = -1;
+    }
+}
+
+bool CMXWeightStreamer::issue_prefetch(int target) {
+    // Only one transfer may be in flight at a time
+    if (pending_buffer_ >= 0) {
+        return true;
+    }
+
+    // Skip blobs served from flash directly; they occupy no buffer
+    while (next_prefetch_ < blobs_.size() &&
+           blobs_[next_prefetch_].size > buffer_size_) {
+        next_prefetch_++;
+    }
+
+    if (next_prefetch_ >= blobs_.size()) {
+        return true;
+    }
+
+    const WeightBlob& blob = blobs_[next_prefetch_];
+    if (!transport_.start(buffers_[target], blob.flash_ptr, blob.size,
+                          transport_.user)) {
+        return false;
+    }
+
+    blob_buffer_[next_prefetch_] = target;
+    pending_buffer_ = target;
+    next_prefetch_++;
+    return true;
+}
+
+bool CMXWeightStreamer::memcpy_start(void* dst, const void* src, size_t size, void*) {
+    std::memcpy(dst, src, size);
+    return true;
+}
+
+bool CMXWeightStreamer::memcpy_poll(void*) {
+    return true;
+}
+
+} // namespace runtime
+} // namespace cmx
@@ -0,0 +1,135 @@
+// cmx_weight_streamer.hpp
+#pragma once
+
+#include "cmx_runtime_config.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cmx {
+namespace runtime {
+
+/**
+ * @brief Double-buffered weight streaming from flash
+ *
+ * Lets models whose weights exceed RAM run from flash: while layer N
+ * computes, layer N+1's weight blob is prefetched into the other half
+ * of a ping-pong buffer pair. When the prefetch engine is a hardware
+ * DMA channel the flash fetch overlaps compute entirely and inference
+ * stays compute-bound instead of flash-bound.
+ *
+ * The streamer is transport-agnostic: platform code wires the async
+ * copy hooks to its DMA engine (e.g. platform/cortex-m Dma::copy_async)
+ * and the default transport falls back to a synchronous memcpy so the
+ * same executor code runs on parts without DMA.
+ */
+class CMXWeightStreamer {
+public:
+    /**
+     * @brief Async copy transport backing the prefetches
+     *
+     * start() kicks off a copy and returns immediately; poll() reports
+     * completion. Both receive the user pointer registered alongside
+     * them. A null transport selects the built-in memcpy fallback.
+     */
+    struct Transport {
+        bool (*start)(void* dst, const void* src, size_t size, void* user);
+        bool (*poll)(void* user);
+        void* user;
+    };
+
+    /**
+     * @brief One layer's weight blob in flash
+     */
+    struct WeightBlob {
+        const void* flash_ptr;  ///< Blob location in flash (or any slow memory)
+        size_t size;            ///< Blob size in bytes
+    };
+
+    CMXWeightStreamer();
+
+    // Non-copyable, non-movable (owns in-flight transfer state)
+    CMXWeightStreamer(const CMXWeightStreamer&) = delete;
+    CMXWeightStreamer& operator=(const CMXWeightStreamer&) = delete;
+    CMXWeightStreamer(CMXWeightStreamer&&) = delete;
+    CMXWeightStreamer& operator=(CMXWeightStreamer&&) = delete;
+
+    /**
+     * @brief Configure the ping-pong buffers and transport
+     *
+     * Buffers must each hold the largest streamed blob; blobs that do
+     * not fit are served straight from flash (XIP fallback) instead.
+     *
+     * @param buffer_a First ping-pong buffer
+     * @param buffer_b Second ping-pong buffer
+     * @param buffer_size Size of each buffer in bytes
+     * @param transport Async copy hooks, or nullptr for memcpy fallback
+     * @return True on success, false on invalid arguments
+     */
+    bool configure(void* buffer_a, void* buffer_b, size_t buffer_size,
+                   const Transport* transport = nullptr);
+
+    /**
+     * @brief Register a layer's weight blob, in execution order
+     * @param flash_ptr Blob location in flash
+     * @param size Blob size in bytes
+     * @return Index of the registered layer
+     */
+    size_t add_layer(const void* flash_ptr, size_t size);
+
+    /**
+     * @brief Start streaming: prefetch the first layer's weights
+     * @return True if the initial prefetch was issued
+     */
+    bool begin();
+
+    /**
+     * @brief Get layer weights in RAM, prefetching the next layer
+     *
+     * Blocks until the layer's transfer has completed (a no-op when the
+     * DMA finished during the previous layer's compute), then issues the
+     * prefetch for layer_index + 1 into the other buffer before
+     * returning. Layers must be acquired in registration order.
+     *
+     * @param layer_index Layer whose weights are needed now
+     * @return Pointer to the weights (RAM buffer, or flash for
+     *         oversized blobs), nullptr on ordering or transfer errors
+     */
+    const void* acquire(size_t layer_index);
+
+    /**
+     * @brief Rewind to the first layer for the next inference
+     */
+    void reset();
+
+    /**
+     * @brief Get number of registered layers
+     */
+    size_t layer_count() const { return blobs_.size(); }
+
+private:
+    Transport transport_;
+    void* buffers_[2];
+    size_t buffer_size_;
+    std::vector<WeightBlob> blobs_;
+    std::vector<int> blob_buffer_;  // Buffer each layer was fetched into, -1 if not yet
+
+    size_t next_prefetch_;    // Next layer to issue a prefetch for
+    int pending_buffer_;      // Buffer index of the in-flight transfer, -1 if none
+    bool configured_;
+
+    /**
+     * @brief Issue the prefetch for the next pending layer, if any
+     * @param target Ping-pong buffer index to fetch into
+     */
+    bool issue_prefetch(int target);
+
+    /**
+     * @brief Built-in synchronous fallback transport
+     */
+    static bool memcpy_start(void* dst, const void* src, size_t size, void* user);
+    static bool memcpy_poll(void* user);
+};
+
+} // namespace runtime
+} // namespace cmx
@@ -1,9 +1,115 @@
 #include "cmx_data_format.hpp"
+#include "../runtime/cmx_dma.hpp"
 #include <cstring>
+#include <vector>
 
 namespace cmx {
 namespace utils {
 
+namespace {
+
+/**
+ * @brief Build the scatter-gather chain for a channel-first/channel-last transpose
+ *
+ * Each (batch, channel) plane becomes one descriptor: the channel-first
+ * side is contiguous while the channel-last side is element-strided by
+ * the channel count. Returns false when the format pair is not a plain
+ * transpose, leaving the chain empty.
+ */
+bool build_transpose_chain(
+    const void* input,
+    void* output,
+    const TensorDims& dims,
+    DataFormat input_format,
+    DataFormat output_format,
+    size_t elem_size,
+    std::vector<runtime::CMXDmaDescriptor>& chain
+) {
+    // Only the channel-first <-> channel-last transposes map to
+    // strided descriptors
+    bool input_channel_first;
+    if ((input_format == DataFormat::NCHW && output_format == DataFormat::NHWC) ||
+        (input_format == DataFormat::CHW && output_format == DataFormat::HWC)) {
+        input_channel_first = true;
+    } else if ((input_format == DataFormat::NHWC && output_format == DataFormat::NCHW) ||
+               (input_format == DataFormat::HWC && output_format == DataFormat::CHW)) {
+        input_channel_first = false;
+    } else {
+        return false;
+    }
+
+    bool has_batch = (input_format == DataFormat::NHWC || input_format == DataFormat::NCHW);
+    int32_t batch = has_batch ? dims.batch : 1;
+    int32_t plane = dims.height * dims.width;
+    if (batch <= 0 || dims.channel <= 0 || plane <= 0) {
+        return false;
+    }
+
+    chain.resize(static_cast<size_t>(batch) * dims.channel);
+
+    const uint8_t* in_bytes = static_cast<const uint8_t*>(input);
+    uint8_t* out_bytes = static_cast<uint8_t*>(output);
+
+    size_t index = 0;
+    for (int32_t b = 0; b < batch; ++b) {
+        for (int32_t c = 0; c < dims.channel; ++c) {
+            // Offsets of this plane in each layout
+            size_t cf_offset = (static_cast<size_t>(b) * dims.channel + c) * plane * elem_size;
+            size_t cl_offset = (static_cast<size_t>(b) * plane * dims.channel + c) * elem_size;
+
+            runtime::CMXDmaDescriptor& desc = chain[index];
+            desc.row_bytes = elem_size;
+            desc.row_count = static_cast<size_t>(plane);
+            if (input_channel_first) {
+                desc.src = in_bytes + cf_offset;
+                desc.src_stride = elem_size;
+                desc.dst = out_bytes + cl_offset;
+                desc.dst_stride = dims.channel * elem_size;
+            } else {
+                desc.src = in_bytes + cl_offset;
+                desc.src_stride = dims.channel * elem_size;
+                desc.dst = out_bytes + cf_offset;
+                desc.dst_stride = elem_size;
+            }
+            desc.next = (index + 1 < chain.size()) ? &chain[index + 1] : nullptr;
+            ++index;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Offload a channel-first/channel-last transpose to the DMA engine
+ *
+ * The whole conversion is submitted as a single descriptor chain so it
+ * runs on the DMA engine. Returns false when no engine is registered
+ * (the element loop is faster than the CPU fallback) or the format pair
+ * is not a plain transpose.
+ */
+bool convert_format_dma(
+    const void* input,
+    void* output,
+    const TensorDims& dims,
+    DataFormat input_format,
+    DataFormat output_format,
+    size_t elem_size
+) {
+    if (!runtime::cmx_dma_backend_available()) {
+        return false;
+    }
+
+    std::vector<runtime::CMXDmaDescriptor> chain;
+    if (!build_transpose_chain(input, output, dims, input_format,
+                               output_format, elem_size, chain)) {
+        return false;
+    }
+
+    return runtime::cmx_dma_execute(chain.data());
+}
+
+} // namespace
+
 void calculate_strides(
     const TensorDims& dims, 
     DataFormat format, 
@@ -92,7 +198,13 @@ void convert_data_format(
         }
         return;
     }
-    
+
+    // Offload plain transposes to the DMA engine when one is available
+    if (convert_format_dma(input, output, dims, input_format, output_format,
+                           sizeof(float))) {
+        return;
+    }
+
     // Convert element by element
     for (int32_t b = 0; b < dims.batch; ++b) {
         for (int32_t c = 0; c < dims.channel; ++c) {
@@ -122,7 +234,13 @@ void convert_data_format_int8(
         }
         return;
     }
-    
+
+    // Offload plain transposes to the DMA engine when one is available
+    if (convert_format_dma(input, output, dims, input_format, output_format,
+                           sizeof(int8_t))) {
+        return;
+    }
+
     // Convert element by element
     for (int32_t b = 0; b < dims.batch; ++b) {
         for (int32_t c = 0; c < dims.channel; ++c) {
@@ -137,6 +255,60 @@ void convert_data_format_int8(
     }
 }
 
+bool CMXLayoutConversion::start(const float* input, float* output,
+                                const TensorDims& dims,
+                                DataFormat input_format,
+                                DataFormat output_format) {
+    // Retire any transfer still using the previous chain
+    if (!wait()) {
+        return false;
+    }
+
+    // Build and submit the chain only when an asynchronous engine can
+    // actually overlap it; otherwise the synchronous converter (which
+    // already prefers the blocking DMA path) is strictly better
+    if (runtime::cmx_dma_async_available() &&
+        build_transpose_chain(input, output, dims, input_format,
+                              output_format, sizeof(float), chain_)) {
+        if (runtime::cmx_dma_submit(chain_.data())) {
+            pending_ = true;
+            return true;
+        }
+    }
+
+    convert_data_format(input, output, dims, input_format, output_format);
+    return true;
+}
+
+bool CMXLayoutConversion::start(const int8_t* input, int8_t* output,
+                                const TensorDims& dims,
+                                DataFormat input_format,
+                                DataFormat output_format) {
+    if (!wait()) {
+        return false;
+    }
+
+    if (runtime::cmx_dma_async_available() &&
+        build_transpose_chain(input, output, dims, input_format,
+                              output_format, sizeof(int8_t), chain_)) {
+        if (runtime::cmx_dma_submit(chain_.data())) {
+            pending_ = true;
+            return true;
+        }
+    }
+
+    convert_data_format_int8(input, output, dims, input_format, output_format);
+    return true;
+}
+
+bool CMXLayoutConversion::wait() {
+    if (!pending_) {
+        return true;
+    }
+    pending_ = false;
+    return runtime::cmx_dma_wait_async();
+}
+
 const char* data_format_to_string(DataFormat format) {
     switch (format) {
         case DataFormat::NHWC:   return "NHWC";
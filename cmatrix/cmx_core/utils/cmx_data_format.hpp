@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
+
+#include "../runtime/cmx_dma.hpp"
 
 namespace cmx {
 namespace utils {
@@ -104,6 +107,65 @@ void convert_data_format_int8(
     DataFormat output_format
 );
 
+/**
+ * @brief Run-ahead layout conversion overlapped with compute
+ *
+ * Wraps a layout conversion as a submit/wait pair so the executor can
+ * start it while the previous node is still computing and only block
+ * once the consumer actually needs the converted tensor. On platforms
+ * with an asynchronous DMA engine the conversion runs as a
+ * scatter-gather chain fully overlapped with compute; everywhere else
+ * start() falls back to the synchronous converter, so callers never
+ * need platform branches.
+ *
+ * The object owns the descriptor chain, which must outlive the
+ * transfer: keep the conversion alive until wait() returns. One
+ * conversion may be in flight per object at a time; start() retires
+ * any previous transfer first.
+ */
+class CMXLayoutConversion {
+public:
+    /**
+     * @brief Start an asynchronous float conversion
+     * @param input Input tensor data (must stay valid until wait())
+     * @param output Output tensor data (pre-allocated)
+     * @param dims Tensor dimensions
+     * @param input_format Input data format
+     * @param output_format Output data format
+     * @return true if the conversion was started or completed
+     */
+    bool start(const float* input, float* output, const TensorDims& dims,
+               DataFormat input_format, DataFormat output_format);
+
+    /**
+     * @brief Start an asynchronous int8 conversion
+     * @param input Input tensor data (must stay valid until wait())
+     * @param output Output tensor data (pre-allocated)
+     * @param dims Tensor dimensions
+     * @param input_format Input data format
+     * @param output_format Output data format
+     * @return true if the conversion was started or completed
+     */
+    bool start(const int8_t* input, int8_t* output, const TensorDims& dims,
+               DataFormat input_format, DataFormat output_format);
+
+    /**
+     * @brief Check whether a wait() is still required
+     * @return true if a transfer may be in flight
+     */
+    bool is_pending() const { return pending_; }
+
+    /**
+     * @brief Block until the converted data is in place
+     * @return true once the output tensor is valid
+     */
+    bool wait();
+
+private:
+    std::vector<runtime::CMXDmaDescriptor> chain_;
+    bool pending_ = false;
+};
+
 /**
  * @brief Get string representation of data format
  * @param format Data format enum
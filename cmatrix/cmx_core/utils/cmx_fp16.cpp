@@ -0,0 +1,25 @@
+#include "cmx_fp16.hpp"
+
+namespace cmx {
+namespace utils {
+
+void fp16_to_float_array(const uint16_t* input, float* output, int32_t size) {
+    if (!input || !output) {
+        return;
+    }
+    for (int32_t i = 0; i < size; ++i) {
+        output[i] = fp16_to_float(input[i]);
+    }
+}
+
+void float_to_fp16_array(const float* input, uint16_t* output, int32_t size) {
+    if (!input || !output) {
+        return;
+    }
+    for (int32_t i = 0; i < size; ++i) {
+        output[i] = float_to_fp16(input[i]);
+    }
+}
+
+} // namespace utils
+} // namespace cmx
@@ -0,0 +1,136 @@
+#pragma once
+
+/**
+ * @file cmx_fp16.hpp
+ * @brief IEEE 754 half-precision storage conversions
+ *
+ * FP16 is a storage format here, not a compute format: tensors sit in
+ * flash/RAM as half to halve footprint and fetch bandwidth, and kernels
+ * expand each element to FP32 in registers for the arithmetic. The
+ * scalar converters are inline because they sit inside kernel inner
+ * loops, mirroring the int4 nibble unpackers in cmx_quantization.hpp.
+ *
+ * Targets whose FPU has half-precision conversion (Cortex-M55/M85,
+ * Cortex-A with FP16) get the single-instruction hardware convert; the
+ * portable fallback is pure bit manipulation with full subnormal,
+ * infinity and NaN handling, and rounds to nearest even.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+namespace cmx {
+namespace utils {
+
+/**
+ * @brief Expand one IEEE half to FP32
+ * @param h Half-precision value as raw bits
+ * @return Equivalent FP32 value
+ */
+inline float fp16_to_float(uint16_t h) {
+#if defined(__ARM_FP) && (__ARM_FP & 2)
+    __fp16 value;
+    std::memcpy(&value, &h, sizeof(value));
+    return static_cast<float>(value);
+#else
+    const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+    uint32_t exponent = (h >> 10) & 0x1Fu;
+    uint32_t mantissa = h & 0x03FFu;
+    uint32_t bits;
+
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            bits = sign;  // Signed zero
+        } else {
+            // Subnormal half: renormalize into the FP32 exponent range
+            exponent = 113;
+            while (!(mantissa & 0x0400u)) {
+                mantissa <<= 1;
+                --exponent;
+            }
+            mantissa &= 0x03FFu;
+            bits = sign | (exponent << 23) | (mantissa << 13);
+        }
+    } else if (exponent == 31) {
+        bits = sign | 0x7F800000u | (mantissa << 13);  // Inf / NaN
+    } else {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+#endif
+}
+
+/**
+ * @brief Round one FP32 value to IEEE half
+ *
+ * Rounds to nearest even. Values beyond the half range become signed
+ * infinity; values below the smallest subnormal flush to signed zero.
+ *
+ * @param value FP32 value
+ * @return Half-precision value as raw bits
+ */
+inline uint16_t float_to_fp16(float value) {
+#if defined(__ARM_FP) && (__ARM_FP & 2)
+    const __fp16 half = static_cast<__fp16>(value);
+    uint16_t bits;
+    std::memcpy(&bits, &half, sizeof(bits));
+    return bits;
+#else
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    bits &= 0x7FFFFFFFu;
+
+    if (bits >= 0x7F800000u) {
+        // Inf stays Inf; NaN keeps a mantissa bit so it stays NaN
+        const uint16_t payload = (bits > 0x7F800000u) ? 0x0200u : 0u;
+        return static_cast<uint16_t>(sign | 0x7C00u | payload);
+    }
+    if (bits >= 0x47800000u) {
+        return static_cast<uint16_t>(sign | 0x7C00u);  // Overflows to Inf
+    }
+    if (bits >= 0x38800000u) {
+        // Normal half: rebias and round; the carry out of the top
+        // mantissa bit bumps the exponent (and saturates to Inf) for free
+        const uint32_t rounded = bits + 0x00000FFFu + ((bits >> 13) & 1u);
+        return static_cast<uint16_t>(sign | ((rounded - 0x38000000u) >> 13));
+    }
+    if (bits >= 0x33000000u) {
+        // Subnormal half: align the implicit bit, then round to
+        // nearest even on the shifted-out remainder
+        const uint32_t shift = 126u - (bits >> 23);
+        const uint32_t mantissa = (bits & 0x007FFFFFu) | 0x00800000u;
+        uint32_t half_mantissa = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway ||
+            (remainder == halfway && (half_mantissa & 1u))) {
+            ++half_mantissa;
+        }
+        return static_cast<uint16_t>(sign | half_mantissa);
+    }
+    return sign;  // Underflows to signed zero
+#endif
+}
+
+/**
+ * @brief Expand a half array to FP32
+ * @param input Half-precision input array (raw bits)
+ * @param output FP32 output array
+ * @param size Element count
+ */
+void fp16_to_float_array(const uint16_t* input, float* output, int32_t size);
+
+/**
+ * @brief Round an FP32 array to half
+ * @param input FP32 input array
+ * @param output Half-precision output array (raw bits)
+ * @param size Element count
+ */
+void float_to_fp16_array(const float* input, uint16_t* output, int32_t size);
+
+} // namespace utils
+} // namespace cmx
@@ -1,5 +1,7 @@
 #include "cmx_im2col.hpp"
 
+#include "../platform/cmx_platform_abstraction.hpp"
+
 namespace cmx {
 namespace utils {
 
@@ -33,7 +35,73 @@ void im2col_2d(const float* input,
                     // Calculate input coordinates
                     int in_y = out_y * stride_h - pad_top + ky * dilation_h;
                     int in_x = out_x * stride_w - pad_left + kx * dilation_w;
-                    
+
+                    // Hint the same kernel tap for the next output
+                    // column; the strided walk defeats the hardware
+                    // prefetcher on most of our parts
+                    int next_x = in_x + stride_w;
+                    if (in_y >= 0 && in_y < input_height && next_x >= 0 && next_x < input_width) {
+                        platform::prefetch(&input[(in_y * input_width + next_x) * channels]);
+                    }
+
+                    // Iterate through channels
+                    for (int c = 0; c < channels; ++c) {
+                        if (in_y >= 0 && in_y < input_height && in_x >= 0 && in_x < input_width) {
+                            // Valid input position - copy data
+                            int input_idx = (in_y * input_width + in_x) * channels + c;
+                            output[col_idx] = input[input_idx];
+                        } else {
+                            // Padding region - set to zero
+                            output[col_idx] = 0.0f;
+                        }
+                        ++col_idx;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void im2col_2d_tile(const float* input,
+                    float* output,
+                    int channels,
+                    int input_height,
+                    int input_width,
+                    int kernel_height,
+                    int kernel_width,
+                    int stride_h,
+                    int stride_w,
+                    int pad_top,
+                    int pad_left,
+                    int row_begin,
+                    int row_count,
+                    int dilation_h,
+                    int dilation_w) {
+
+    int output_width = (input_width + 2 * pad_left - dilation_w * (kernel_width - 1) - 1) / stride_w + 1;
+
+    int col_idx = 0;
+
+    // Iterate only over the requested band of output rows so the column
+    // data for this tile fits the caller's bounded workspace
+    for (int out_y = row_begin; out_y < row_begin + row_count; ++out_y) {
+        for (int out_x = 0; out_x < output_width; ++out_x) {
+
+            // Iterate through kernel dimensions
+            for (int ky = 0; ky < kernel_height; ++ky) {
+                for (int kx = 0; kx < kernel_width; ++kx) {
+
+                    // Calculate input coordinates
+                    int in_y = out_y * stride_h - pad_top + ky * dilation_h;
+                    int in_x = out_x * stride_w - pad_left + kx * dilation_w;
+
+                    // Hint the same kernel tap for the next output
+                    // column, as in im2col_2d
+                    int next_x = in_x + stride_w;
+                    if (in_y >= 0 && in_y < input_height && next_x >= 0 && next_x < input_width) {
+                        platform::prefetch(&input[(in_y * input_width + next_x) * channels]);
+                    }
+
                     // Iterate through channels
                     for (int c = 0; c < channels; ++c) {
                         if (in_y >= 0 && in_y < input_height && in_x >= 0 && in_x < input_width) {
@@ -49,6 +49,50 @@ void im2col_2d(const float* input,
                int dilation_h = 1,
                int dilation_w = 1);
 
+/**
+ * @brief Tile-streamed image-to-column transformation with bounded workspace
+ *
+ * Produces the same columns as im2col_2d but only for a contiguous range
+ * of output rows, so the caller can stream the transformation through a
+ * fixed-size workspace instead of materializing the full column matrix.
+ * Calling this repeatedly with row_begin advancing by row_count covers
+ * the whole output.
+ *
+ * @param input Input tensor data (NHWC format)
+ * @param output Pre-allocated tile workspace
+ * @param channels Number of input channels
+ * @param input_height Height of input tensor
+ * @param input_width Width of input tensor
+ * @param kernel_height Height of convolution kernel
+ * @param kernel_width Width of convolution kernel
+ * @param stride_h Vertical stride
+ * @param stride_w Horizontal stride
+ * @param pad_top Top padding
+ * @param pad_left Left padding
+ * @param row_begin First output row of the tile
+ * @param row_count Number of output rows in the tile
+ * @param dilation_h Vertical dilation (default: 1)
+ * @param dilation_w Horizontal dilation (default: 1)
+ *
+ * @note Workspace must be pre-allocated with size:
+ *       (row_count * output_width) * (channels * kernel_height * kernel_width)
+ */
+void im2col_2d_tile(const float* input,
+                    float* output,
+                    int channels,
+                    int input_height,
+                    int input_width,
+                    int kernel_height,
+                    int kernel_width,
+                    int stride_h,
+                    int stride_w,
+                    int pad_top,
+                    int pad_left,
+                    int row_begin,
+                    int row_count,
+                    int dilation_h = 1,
+                    int dilation_w = 1);
+
 /**
  * @brief Performs image-to-column transformation for 1D convolution
  * 
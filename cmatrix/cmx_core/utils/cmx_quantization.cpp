@@ -67,8 +67,11 @@ void quantize_tensor(
     int32_t size, 
     const QuantizationParams& params
 ) {
+    // Hoist the division: one reciprocal, then multiply per element
+    const float inv_scale = 1.0f / params.scale;
     for (int32_t i = 0; i < size; ++i) {
-        output[i] = quantize_value(input[i], params);
+        const int32_t quantized = fast_round(input[i] * inv_scale) + params.zero_point;
+        output[i] = clamp_quantized(quantized, params.qmin, params.qmax);
     }
 }
 
@@ -90,15 +93,83 @@ void requantize_tensor(
     const QuantizationParams& input_params,
     const QuantizationParams& output_params
 ) {
-    // Calculate combined scale and zero point transformation
-    float scale_ratio = input_params.scale / output_params.scale;
-    int32_t zero_point_diff = input_params.zero_point - output_params.zero_point;
-    
+    // Fold both parameter sets once; the loop is then integer-only
+    // (multiply-high plus shift), which is what keeps requantization
+    // cheap on FPU-less targets
+    const RequantizeParams params =
+        calculate_requantize_params(input_params, output_params);
+
     for (int32_t i = 0; i < size; ++i) {
-        // Efficient requantization without intermediate float conversion
-        int32_t input_val = static_cast<int32_t>(input[i]);
-        int32_t transformed = fast_round(scale_ratio * (input_val - input_params.zero_point)) + output_params.zero_point;
-        output[i] = clamp_quantized(transformed, output_params.qmin, output_params.qmax);
+        output[i] = requantize_value(input[i], params);
+    }
+}
+
+RequantizeParams calculate_requantize_params(
+    const QuantizationParams& input_params,
+    const QuantizationParams& output_params
+) {
+    RequantizeParams params;
+    params.scale = calculate_fixed_point_scale(
+        input_params.scale / output_params.scale);
+    params.input_zero_point = input_params.zero_point;
+    params.output_zero_point = output_params.zero_point;
+    params.qmin = output_params.qmin;
+    params.qmax = output_params.qmax;
+    return params;
+}
+
+QuantizationParams calculate_int4_quantization_params(
+    float min_val,
+    float max_val,
+    QuantizationScheme scheme
+) {
+    return calculate_quantization_params(min_val, max_val, scheme,
+                                         INT4_QMIN, INT4_QMAX);
+}
+
+void pack_int4_tensor(const int8_t* input, uint8_t* output, int32_t size) {
+    for (int32_t i = 0; i < size; i += 2) {
+        uint8_t low = static_cast<uint8_t>(
+            clamp_quantized(input[i], INT4_QMIN, INT4_QMAX)) & 0x0F;
+        uint8_t high = 0;
+        if (i + 1 < size) {
+            high = static_cast<uint8_t>(
+                clamp_quantized(input[i + 1], INT4_QMIN, INT4_QMAX)) & 0x0F;
+        }
+        output[i / 2] = static_cast<uint8_t>((high << 4) | low);
+    }
+}
+
+void unpack_int4_tensor(const uint8_t* input, int8_t* output, int32_t size) {
+    for (int32_t i = 0; i < size; i += 2) {
+        uint8_t byte = input[i / 2];
+        output[i] = unpack_int4_low(byte);
+        if (i + 1 < size) {
+            output[i + 1] = unpack_int4_high(byte);
+        }
+    }
+}
+
+void quantize_tensor_int4(
+    const float* input,
+    uint8_t* output,
+    int32_t size,
+    const QuantizationParams& params
+) {
+    const float inv_scale = 1.0f / params.scale;
+    const auto quantize_one = [&](float value) -> uint8_t {
+        const int32_t quantized = fast_round(value * inv_scale) + params.zero_point;
+        return static_cast<uint8_t>(
+            clamp_quantized(quantized, params.qmin, params.qmax)) & 0x0F;
+    };
+
+    for (int32_t i = 0; i < size; i += 2) {
+        uint8_t low = quantize_one(input[i]);
+        uint8_t high = 0;
+        if (i + 1 < size) {
+            high = quantize_one(input[i + 1]);
+        }
+        output[i / 2] = static_cast<uint8_t>((high << 4) | low);
     }
 }
 
@@ -126,5 +197,157 @@ void find_tensor_range(
     }
 }
 
+FixedPointScale calculate_fixed_point_scale(float scale) {
+    FixedPointScale fp;
+    fp.multiplier = 0;
+    fp.shift = 0;
+
+    if (scale <= 0.0f) {
+        return fp;
+    }
+
+    int exponent = 0;
+    const float mantissa = std::frexp(scale, &exponent);
+
+    // Q31 mantissa; rounding can carry 0.99999... up to exactly 1.0,
+    // which falls back into range by halving and bumping the exponent
+    int64_t quantized = static_cast<int64_t>(lroundf(mantissa * 2147483648.0f));
+    if (quantized == (INT64_C(1) << 31)) {
+        quantized >>= 1;
+        ++exponent;
+    }
+
+    fp.multiplier = static_cast<int32_t>(quantized);
+    fp.shift = exponent;
+    return fp;
+}
+
+void expand_palette_weights(const uint8_t* indices, const float* palette,
+                            float* output, int32_t size) {
+    for (int32_t i = 0; i + 2 <= size; i += 2) {
+        const uint8_t byte = indices[i / 2];
+        output[i] = palette[unpack_palette_index(byte, false)];
+        output[i + 1] = palette[unpack_palette_index(byte, true)];
+    }
+    if (size & 1) {
+        output[size - 1] =
+            palette[unpack_palette_index(indices[size / 2], false)];
+    }
+}
+
+void pack_sparse_2_4(const float* input, int32_t size,
+                     float* values, uint8_t* indices) {
+    const int32_t groups = size / SPARSE_2_4_GROUP;
+
+    for (int32_t g = 0; g < groups; ++g) {
+        const float* group = input + g * SPARSE_2_4_GROUP;
+
+        // Keep the two largest-magnitude positions, in ascending order.
+        // A 2:4-pruned group has at most 2 nonzeros, so this is exact.
+        int32_t first = 0;
+        int32_t second = 1;
+        if (std::fabs(group[second]) > std::fabs(group[first])) {
+            first = 1;
+            second = 0;
+        }
+        for (int32_t i = 2; i < SPARSE_2_4_GROUP; ++i) {
+            if (std::fabs(group[i]) > std::fabs(group[first])) {
+                second = first;
+                first = i;
+            } else if (std::fabs(group[i]) > std::fabs(group[second])) {
+                second = i;
+            }
+        }
+        if (first > second) {
+            const int32_t tmp = first;
+            first = second;
+            second = tmp;
+        }
+
+        values[g * SPARSE_2_4_KEPT] = group[first];
+        values[g * SPARSE_2_4_KEPT + 1] = group[second];
+
+        const uint8_t nibble = static_cast<uint8_t>(first | (second << 2));
+        if ((g & 1) == 0) {
+            indices[g / 2] = nibble;
+        } else {
+            indices[g / 2] |= static_cast<uint8_t>(nibble << 4);
+        }
+    }
+}
+
+void unpack_sparse_2_4(const float* values, const uint8_t* indices,
+                       float* output, int32_t size) {
+    const int32_t groups = size / SPARSE_2_4_GROUP;
+
+    for (int32_t i = 0; i < size; ++i) {
+        output[i] = 0.0f;
+    }
+
+    for (int32_t g = 0; g < groups; ++g) {
+        const uint8_t nibble = (g & 1) ? (indices[g / 2] >> 4)
+                                       : (indices[g / 2] & 0x0F);
+        float* group = output + g * SPARSE_2_4_GROUP;
+        group[nibble & 0x03] = values[g * SPARSE_2_4_KEPT];
+        group[(nibble >> 2) & 0x03] = values[g * SPARSE_2_4_KEPT + 1];
+    }
+}
+
+int32_t pack_sparse_block16(const float* input, int32_t size,
+                            float* values, uint8_t* bitmap) {
+    const int32_t blocks = size / SPARSE_BLOCK_SIZE;
+    int32_t kept = 0;
+
+    for (int32_t i = 0; i < (blocks + 7) / 8; ++i) {
+        bitmap[i] = 0;
+    }
+
+    for (int32_t b = 0; b < blocks; ++b) {
+        const float* block = input + b * SPARSE_BLOCK_SIZE;
+
+        bool nonzero = false;
+        for (int32_t i = 0; i < SPARSE_BLOCK_SIZE; ++i) {
+            if (block[i] != 0.0f) {
+                nonzero = true;
+                break;
+            }
+        }
+        if (!nonzero) {
+            continue;
+        }
+
+        bitmap[b / 8] |= static_cast<uint8_t>(1u << (b % 8));
+        float* dst = values + kept * SPARSE_BLOCK_SIZE;
+        for (int32_t i = 0; i < SPARSE_BLOCK_SIZE; ++i) {
+            dst[i] = block[i];
+        }
+        ++kept;
+    }
+
+    return kept;
+}
+
+void unpack_sparse_block16(const float* values, const uint8_t* bitmap,
+                           float* output, int32_t size) {
+    const int32_t blocks = size / SPARSE_BLOCK_SIZE;
+    int32_t kept = 0;
+
+    for (int32_t i = 0; i < size; ++i) {
+        output[i] = 0.0f;
+    }
+
+    for (int32_t b = 0; b < blocks; ++b) {
+        if (!(bitmap[b / 8] & (1u << (b % 8)))) {
+            continue;
+        }
+        const float* src = values + kept * SPARSE_BLOCK_SIZE;
+        float* dst = output + b * SPARSE_BLOCK_SIZE;
+        for (int32_t i = 0; i < SPARSE_BLOCK_SIZE; ++i) {
+            dst[i] = src[i];
+        }
+        ++kept;
+    }
+}
+
 } // namespace utils
 } // namespace cmx
\ No newline at end of file
@@ -115,6 +115,267 @@ void find_tensor_range(
     float& max_val
 );
 
+/// Quantized range for 4-bit weights (two values packed per byte)
+constexpr int8_t INT4_QMIN = -8;
+constexpr int8_t INT4_QMAX = 7;
+
+/**
+ * @brief Calculate quantization parameters for the 4-bit weight format
+ * @param min_val Minimum value in the tensor
+ * @param max_val Maximum value in the tensor
+ * @param scheme Quantization scheme to use
+ * @return Quantization parameters with the int4 range
+ */
+QuantizationParams calculate_int4_quantization_params(
+    float min_val,
+    float max_val,
+    QuantizationScheme scheme = QuantizationScheme::SYMMETRIC
+);
+
+/**
+ * @brief Pack int4 values (stored one per int8) into two-per-byte form
+ *
+ * Element 2i goes into the low nibble and element 2i+1 into the high
+ * nibble of output byte i. For odd sizes the final high nibble is zero.
+ * Values outside the int4 range are saturated.
+ *
+ * @param input Unpacked int4 values, one per int8
+ * @param output Packed buffer, (size + 1) / 2 bytes (pre-allocated)
+ * @param size Number of values
+ */
+void pack_int4_tensor(const int8_t* input, uint8_t* output, int32_t size);
+
+/**
+ * @brief Unpack two-per-byte int4 values back to one per int8
+ * @param input Packed buffer
+ * @param output Unpacked values, one per int8 (pre-allocated)
+ * @param size Number of values
+ */
+void unpack_int4_tensor(const uint8_t* input, int8_t* output, int32_t size);
+
+/**
+ * @brief Quantize a float tensor straight into packed int4 form
+ * @param input Input float tensor
+ * @param output Packed buffer, (size + 1) / 2 bytes (pre-allocated)
+ * @param size Number of elements
+ * @param params Quantization parameters (use the int4 range)
+ */
+void quantize_tensor_int4(
+    const float* input,
+    uint8_t* output,
+    int32_t size,
+    const QuantizationParams& params
+);
+
+/**
+ * @brief Unpack the low nibble of a packed int4 byte (sign-extended)
+ *
+ * Compiles to a shift pair, so kernel inner loops unpack weights in
+ * registers without touching a lookup table.
+ */
+inline int8_t unpack_int4_low(uint8_t byte) {
+    return static_cast<int8_t>(static_cast<uint8_t>(byte << 4)) >> 4;
+}
+
+/**
+ * @brief Unpack the high nibble of a packed int4 byte (sign-extended)
+ */
+inline int8_t unpack_int4_high(uint8_t byte) {
+    return static_cast<int8_t>(byte) >> 4;
+}
+
+/// Codebook entries of the clustered (palettized) weight format
+constexpr int32_t PALETTE_SIZE = 16;
+
+/**
+ * @brief Unpack one palette index from a packed byte
+ *
+ * Clustered weights reuse the two-per-byte nibble packing of the int4
+ * format, but indices are unsigned 0..15 so no sign extension applies.
+ */
+inline uint8_t unpack_palette_index(uint8_t byte, bool high) {
+    return high ? static_cast<uint8_t>(byte >> 4)
+                : static_cast<uint8_t>(byte & 0x0F);
+}
+
+/**
+ * @brief Expand packed palette indices through a codebook into floats
+ *
+ * Clustered weights store one 4-bit index per weight (two per byte,
+ * element 2i in the low nibble) into a 16-entry float codebook learned
+ * at export time. Kernels that cannot afford the lookup per fetch use
+ * this to pre-expand a tile into workspace and run their float path.
+ *
+ * @param indices Packed index buffer, (size + 1) / 2 bytes
+ * @param palette Codebook, PALETTE_SIZE floats
+ * @param output Expanded weights (pre-allocated, size floats)
+ * @param size Number of weights
+ */
+void expand_palette_weights(const uint8_t* indices, const float* palette,
+                            float* output, int32_t size);
+
+/**
+ * @brief Structured-sparsity weight formats produced by the pruning pipeline
+ *
+ * Both formats apply along the reduction (K) dimension of a row-major
+ * per-output-row weight matrix, which is the layout the sparse matmul
+ * path in CmxMatMul consumes. model_serializer.py emits the matching
+ * packed streams at export time.
+ */
+enum class SparseFormat : uint8_t {
+    DENSE = 0,       ///< No sparsity, plain dense weights
+    SPARSE_2_4 = 1,  ///< N:M sparsity: 2 nonzeros per group of 4
+    BLOCK_16 = 2     ///< Block sparsity: zero/nonzero in blocks of 16
+};
+
+/// Group width of the 2:4 format
+constexpr int32_t SPARSE_2_4_GROUP = 4;
+
+/// Nonzero values kept per 2:4 group
+constexpr int32_t SPARSE_2_4_KEPT = 2;
+
+/// Block width of the 16-block format
+constexpr int32_t SPARSE_BLOCK_SIZE = 16;
+
+/**
+ * @brief Pack a 2:4 structured-sparse row into values plus indices
+ *
+ * Each group of 4 consecutive elements keeps its 2 largest-magnitude
+ * values (a properly pruned row has at most 2 nonzeros per group, so
+ * packing is then lossless). Values land in order in the values array,
+ * 2 per group; the two 2-bit in-group positions of each group share a
+ * nibble, two groups per metadata byte (group 2g low nibble, 2g+1
+ * high).
+ *
+ * @param input Dense row, size must be a multiple of 4
+ * @param size Number of elements
+ * @param values Packed values, size / 2 floats (pre-allocated)
+ * @param indices Packed positions, size / 8 bytes rounded up (pre-allocated)
+ */
+void pack_sparse_2_4(const float* input, int32_t size,
+                     float* values, uint8_t* indices);
+
+/**
+ * @brief Expand a packed 2:4 row back to dense form
+ * @param values Packed values, size / 2 floats
+ * @param indices Packed positions from pack_sparse_2_4
+ * @param output Dense row (pre-allocated, zero-filled here)
+ * @param size Number of dense elements, multiple of 4
+ */
+void unpack_sparse_2_4(const float* values, const uint8_t* indices,
+                       float* output, int32_t size);
+
+/**
+ * @brief Pack a row into the 16-block sparse format
+ *
+ * Blocks of 16 consecutive elements that are entirely zero are dropped;
+ * surviving blocks are copied verbatim in order. One bitmap bit per
+ * block (bit b of byte b / 8) marks which blocks are present.
+ *
+ * @param input Dense row, size must be a multiple of 16
+ * @param size Number of elements
+ * @param values Packed nonzero blocks (pre-allocated, worst case size floats)
+ * @param bitmap Block presence bits, size / 128 bytes rounded up (pre-allocated)
+ * @return Number of nonzero blocks written to values
+ */
+int32_t pack_sparse_block16(const float* input, int32_t size,
+                            float* values, uint8_t* bitmap);
+
+/**
+ * @brief Expand a packed 16-block row back to dense form
+ * @param values Packed nonzero blocks
+ * @param bitmap Block presence bits from pack_sparse_block16
+ * @param output Dense row (pre-allocated, zero-filled here)
+ * @param size Number of dense elements, multiple of 16
+ */
+void unpack_sparse_block16(const float* values, const uint8_t* bitmap,
+                           float* output, int32_t size);
+
+/**
+ * @brief A float multiplier decomposed into integer multiply-and-shift form
+ *
+ * Requantization multiplies an integer accumulator by a small positive
+ * float (the effective scale). On soft-float cores that multiply must
+ * not happen per element, so the scale is decomposed once into a Q31
+ * mantissa in [0.5, 1) plus a binary exponent, and applied as one
+ * 32x32->64 multiply and a rounding shift.
+ */
+struct FixedPointScale {
+    int32_t multiplier;  ///< Q31 mantissa in [2^30, 2^31)
+    int32_t shift;       ///< Binary exponent: scale = multiplier * 2^(shift - 31)
+};
+
+/**
+ * @brief Decompose a float scale into multiply-and-shift form
+ * @param scale Positive scale to decompose (non-positive yields zero)
+ * @return Fixed-point representation for apply_fixed_point_scale
+ */
+FixedPointScale calculate_fixed_point_scale(float scale);
+
+/**
+ * @brief Multiply an accumulator by a decomposed scale (round-to-nearest)
+ * @param value Integer accumulator
+ * @param fp Decomposed scale from calculate_fixed_point_scale
+ * @return round(value * scale)
+ */
+inline int32_t apply_fixed_point_scale(int32_t value, const FixedPointScale& fp) {
+    const int32_t right = 31 - fp.shift;
+    const int64_t product = static_cast<int64_t>(value) * fp.multiplier;
+    if (right <= 0) {
+        // Scale >= 1: only reachable with a misconfigured scale, but
+        // shifting by a non-positive amount is UB so handle it anyway
+        return static_cast<int32_t>(product << -right >> 31);
+    }
+    return static_cast<int32_t>((product + (INT64_C(1) << (right - 1))) >> right);
+}
+
+/**
+ * @brief Precomputed requantization pipeline between two int8 scales
+ *
+ * Folds the two QuantizationParams of a requantization into the form
+ * the per-element loop actually needs: the scale ratio decomposed into
+ * multiply-and-shift, plus the two zero points and the output range.
+ * Computed once at configure so the per-element cost on soft-float
+ * cores is one widening multiply, a rounding shift and a clamp rather
+ * than a float multiply per element.
+ */
+struct RequantizeParams {
+    FixedPointScale scale;     ///< input_scale / output_scale, decomposed
+    int32_t input_zero_point;  ///< Subtracted before scaling
+    int32_t output_zero_point; ///< Added after scaling
+    int8_t qmin;               ///< Output range minimum
+    int8_t qmax;               ///< Output range maximum
+};
+
+/**
+ * @brief Fold two quantization parameter sets into requantization form
+ * @param input_params Parameters the input was quantized with
+ * @param output_params Parameters the output should carry
+ * @return Precomputed form for requantize_value
+ */
+RequantizeParams calculate_requantize_params(
+    const QuantizationParams& input_params,
+    const QuantizationParams& output_params
+);
+
+/**
+ * @brief Requantize a single value through precomputed parameters
+ *
+ * Integer-only: multiply-high plus arithmetic shift, no float math.
+ *
+ * @param qvalue Input quantized value
+ * @param params Precomputed parameters from calculate_requantize_params
+ * @return Requantized value in the output range
+ */
+inline int8_t requantize_value(int8_t qvalue, const RequantizeParams& params) {
+    const int32_t centered = static_cast<int32_t>(qvalue) - params.input_zero_point;
+    const int32_t scaled = apply_fixed_point_scale(centered, params.scale);
+    const int32_t value = scaled + params.output_zero_point;
+    if (value < params.qmin) return params.qmin;
+    if (value > params.qmax) return params.qmax;
+    return static_cast<int8_t>(value);
+}
+
 /**
  * @brief Clamp a value to quantization range
  * @param value Value to clamp
@@ -1,19 +1,84 @@
 #include "cmx_tensor_utils.hpp"
+#include "../runtime/cmx_dma.hpp"
 
 namespace cmx {
 namespace utils {
 
-void flatten(const float* input, float* output, int total_elements) {
-    for (int i = 0; i < total_elements; ++i) {
-        output[i] = input[i];
+namespace {
+
+// Below this the descriptor setup and engine round trip cost more than
+// the loop they replace; bulk paths fall back to the CPU
+constexpr int kDmaBulkElements = 1024;
+
+// Seed block replicated by the DMA fill; CPU-written once per call
+constexpr int kFillSeedElements = 256;
+
+// Chain storage for the async variants. cmx_dma_submit requires the
+// descriptors to outlive the transfer, and the DMA layer allows one
+// chain in flight, so one static chain suffices (and shares the DMA
+// layer's single-caller assumption).
+runtime::CMXDmaDescriptor g_async_chain[2];
+
+bool bulk_copy_offloadable(int size) {
+    return size >= kDmaBulkElements && runtime::cmx_dma_backend_available();
+}
+
+// Build a fill as seed replication: the CPU writes one seed block at
+// the start of the buffer and the engine copies it repeatedly
+// (src_stride 0) over the full rows, with a ragged tail descriptor
+// chained on when the size does not divide evenly. Returns the number
+// of chain entries, 0 if everything fit in the seed.
+int build_fill_chain(runtime::CMXDmaDescriptor* chain,
+                     float* output, int size, float value) {
+    const int seed = kFillSeedElements < size ? kFillSeedElements : size;
+    for (int i = 0; i < seed; ++i) {
+        output[i] = value;
     }
+    if (seed == size) {
+        return 0;
+    }
+
+    const int remaining = size - seed;
+    const int full_rows = remaining / seed;
+    const int tail = remaining - full_rows * seed;
+    int entries = 0;
+
+    if (full_rows > 0) {
+        chain[entries].dst = output + seed;
+        chain[entries].src = output;
+        chain[entries].row_bytes = seed * sizeof(float);
+        chain[entries].row_count = full_rows;
+        chain[entries].src_stride = 0;
+        chain[entries].dst_stride = seed * sizeof(float);
+        chain[entries].next = nullptr;
+        ++entries;
+    }
+    if (tail > 0) {
+        chain[entries].dst = output + seed + full_rows * seed;
+        chain[entries].src = output;
+        chain[entries].row_bytes = tail * sizeof(float);
+        chain[entries].row_count = 1;
+        chain[entries].src_stride = 0;
+        chain[entries].dst_stride = 0;
+        chain[entries].next = nullptr;
+        ++entries;
+    }
+    if (entries == 2) {
+        chain[0].next = &chain[1];
+    }
+    return entries;
+}
+
+} // namespace
+
+void flatten(const float* input, float* output, int total_elements) {
+    // A flatten is a plain copy; route it through the bulk path
+    copy_tensor(input, output, total_elements);
 }
 
 void reshape(const float* input, float* output, int total_elements) {
     // Reshape is just a copy operation since we're not changing memory layout
-    for (int i = 0; i < total_elements; ++i) {
-        output[i] = input[i];
-    }
+    copy_tensor(input, output, total_elements);
 }
 
 void transpose_2d(const float* input, float* output, int rows, int cols) {
@@ -168,16 +233,69 @@ int calculate_total_size(const int* dims, int num_dims) {
 }
 
 void fill_constant(float* output, int size, float value) {
+    // Bulk fills (state resets, padding) go to the DMA engine as seed
+    // replication; below the threshold the plain loop wins
+    if (size >= kDmaBulkElements && runtime::cmx_dma_backend_available()) {
+        runtime::CMXDmaDescriptor chain[2];
+        const int entries = build_fill_chain(chain, output, size, value);
+        if (entries == 0 || runtime::cmx_dma_execute(chain)) {
+            return;
+        }
+        // Engine refused the chain; the CPU loop below still finishes
+        // the job (the seed prefix is simply rewritten)
+    }
     for (int i = 0; i < size; ++i) {
         output[i] = value;
     }
 }
 
 void copy_tensor(const float* input, float* output, int size) {
+    if (bulk_copy_offloadable(size)) {
+        if (runtime::cmx_dma_copy_2d(output, 0, input, 0,
+                                     static_cast<size_t>(size) * sizeof(float),
+                                     1)) {
+            return;
+        }
+    }
     for (int i = 0; i < size; ++i) {
         output[i] = input[i];
     }
 }
 
+bool copy_tensor_async(const float* input, float* output, int size) {
+    if (size < kDmaBulkElements || !runtime::cmx_dma_async_available()) {
+        copy_tensor(input, output, size);
+        return false;
+    }
+
+    g_async_chain[0].dst = output;
+    g_async_chain[0].src = input;
+    g_async_chain[0].row_bytes = static_cast<size_t>(size) * sizeof(float);
+    g_async_chain[0].row_count = 1;
+    g_async_chain[0].src_stride = 0;
+    g_async_chain[0].dst_stride = 0;
+    g_async_chain[0].next = nullptr;
+
+    // cmx_dma_submit degrades to synchronous execution when the engine
+    // refuses the chain, so the copy is complete either way; "started"
+    // only means a wait is still required before reading the output
+    return runtime::cmx_dma_submit(g_async_chain) &&
+           !runtime::cmx_dma_async_complete();
+}
+
+bool fill_constant_async(float* output, int size, float value) {
+    if (size < kDmaBulkElements || !runtime::cmx_dma_async_available()) {
+        fill_constant(output, size, value);
+        return false;
+    }
+
+    const int entries = build_fill_chain(g_async_chain, output, size, value);
+    if (entries == 0) {
+        return false;
+    }
+    return runtime::cmx_dma_submit(g_async_chain) &&
+           !runtime::cmx_dma_async_complete();
+}
+
 } // namespace utils
 } // namespace cmx
\ No newline at end of file
@@ -160,7 +160,12 @@ int calculate_total_size(const int* dims, int num_dims);
 
 /**
  * @brief Fill tensor with constant value
- * 
+ *
+ * Bulk fills are offloaded to the platform DMA engine when one is
+ * registered: the CPU writes a small seed block and the engine
+ * replicates it over the rest of the buffer. Small fills and builds
+ * without an engine use the plain loop.
+ *
  * @param output Output tensor data
  * @param size Number of elements
  * @param value Value to fill with
@@ -169,12 +174,48 @@ void fill_constant(float* output, int size, float value);
 
 /**
  * @brief Copy tensor data
- * 
+ *
+ * Bulk copies are offloaded to the platform DMA engine when one is
+ * registered; small copies use the plain loop.
+ *
  * @param input Input tensor data
  * @param output Output tensor data
  * @param size Number of elements to copy
  */
 void copy_tensor(const float* input, float* output, int size);
 
+/**
+ * @brief Copy tensor data without waiting for completion
+ *
+ * Bulk copies are submitted to the asynchronous DMA engine so the CPU
+ * can run independent work (e.g. the next layer of the plan) while the
+ * transfer drains. Small copies, and builds without an async engine,
+ * complete synchronously before returning.
+ *
+ * @param input Input tensor data
+ * @param output Output tensor data
+ * @param size Number of elements to copy
+ * @return true if a transfer is in flight; the caller must call
+ *         runtime::cmx_dma_wait_async before reading the output.
+ *         false means the copy already completed.
+ */
+bool copy_tensor_async(const float* input, float* output, int size);
+
+/**
+ * @brief Fill tensor with constant value without waiting for completion
+ *
+ * Asynchronous variant of fill_constant for state resets between
+ * inferences: the seed block is written synchronously, the replication
+ * is submitted to the DMA engine.
+ *
+ * @param output Output tensor data
+ * @param size Number of elements
+ * @param value Value to fill with
+ * @return true if a transfer is in flight; the caller must call
+ *         runtime::cmx_dma_wait_async before reading the output.
+ *         false means the fill already completed.
+ */
+bool fill_constant_async(float* output, int size, float value);
+
 } // namespace utils
 } // namespace cmx
\ No newline at end of file
@@ -40,6 +40,39 @@ using cmx_model_handle = void*;
  */
 constexpr cmx_model_handle CMX_INVALID_HANDLE = nullptr;
 
+/**
+ * @brief Opaque handle to an execution context
+ *
+ * A context owns its own scheduler, worker thread, memory pool, and
+ * statistics. Models driven through different contexts execute
+ * concurrently without sharing any mutable runtime state, so a
+ * wake-word model on one context never contends with a command model
+ * on another. The legacy global API is equivalent to operating on a
+ * default context created by cmx_init().
+ */
+using cmx_context = void*;
+
+/**
+ * @brief Invalid context handle constant
+ */
+constexpr cmx_context CMX_INVALID_CONTEXT = nullptr;
+
+/**
+ * @brief Opaque handle to an execution instance of a loaded model
+ *
+ * An instance owns the per-invocation state of one execution - the
+ * intermediate-tensor scratch arena and the I/O bindings - while
+ * referencing the model's immutable weights and plan. N instances over
+ * one model give N-way concurrent inference at the memory cost of N
+ * scratch arenas instead of N full model copies.
+ */
+using cmx_instance_handle = void*;
+
+/**
+ * @brief Invalid execution instance handle constant
+ */
+constexpr cmx_instance_handle CMX_INVALID_INSTANCE = nullptr;
+
 /**
  * @brief Model metadata structure
  */
@@ -49,6 +82,7 @@ struct cmx_model_info {
     uint32_t input_count;      ///< Number of input tensors
     uint32_t output_count;     ///< Number of output tensors
     size_t memory_required;    ///< Required memory in bytes
+    uint32_t platform_features; ///< CMX_FEATURE_* mask the model was planned against
 };
 
 /**
@@ -87,4 +121,22 @@ inline bool cmx_is_valid_handle(cmx_model_handle handle) {
     return handle != CMX_INVALID_HANDLE;
 }
 
+/**
+ * @brief Check if context handle is valid
+ * @param context Context handle to check
+ * @return true if handle is valid, false otherwise
+ */
+inline bool cmx_is_valid_context(cmx_context context) {
+    return context != CMX_INVALID_CONTEXT;
+}
+
+/**
+ * @brief Check if execution instance handle is valid
+ * @param instance Instance handle to check
+ * @return true if handle is valid, false otherwise
+ */
+inline bool cmx_is_valid_instance(cmx_instance_handle instance) {
+    return instance != CMX_INVALID_INSTANCE;
+}
+
 } // namespace cmx
\ No newline at end of file
@@ -1,32 +1,128 @@
 #include "cmx_model_loader.hpp"
+#include "../cmx_core/platform/cmx_platform_abstraction.hpp"
+#include <atomic>
 #include <fstream>
 #include <vector>
 #include <memory>
 
+#if defined(__unix__) || defined(__APPLE__)
+#define CMX_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 /**
  * @file cmx_model_loader.cpp
  * @brief Implementation of model loading and management functions
  */
 
-// Forward declaration of internal model representation
-struct cmx_model_internal;
+// One lent caller buffer backing a boundary tensor
+struct cmx_tensor_binding {
+    void* data = nullptr;           // Caller-owned buffer, nullptr = unbound
+    size_t size = 0;                // Lent buffer size in bytes
+};
+
+// Boundary tensors a model can have bindings for
+constexpr uint32_t CMX_MAX_BOUND_TENSORS = 8;
+
+// Internal model representation: references the serialized image and
+// tracks how it is backed so cmx_free_model releases it correctly
+struct cmx_model_internal {
+    const void* data = nullptr;     // Serialized model image
+    size_t size = 0;                // Image size in bytes
+    char* heap_copy = nullptr;      // Owned heap buffer (read fallback)
+    void* mapping = nullptr;        // mmap base when memory-mapped
+    size_t mapping_size = 0;        // Mapping length for munmap
+
+    // Zero-copy boundary tensor bindings (cmx_bind_input/_output);
+    // execution uses these in place of runtime-owned tensors
+    cmx_tensor_binding input_bindings[CMX_MAX_BOUND_TENSORS];
+    cmx_tensor_binding output_bindings[CMX_MAX_BOUND_TENSORS];
+
+    // Live execution instances referencing this model's weights and
+    // plan; the model cannot be freed while any remain
+    std::atomic<uint32_t> active_instances{0};
+};
+
+// Per-invocation execution state: everything one concurrent execution
+// mutates lives here, so N instances share one model's immutable
+// weights and plan at the memory cost of N scratch arenas
+struct cmx_instance_internal {
+    cmx_model_internal* model = nullptr;  // Shared parent (not owned)
+    std::vector<uint8_t> scratch;         // Private activation arena
+    size_t scratch_size = 0;              // Usable bytes after alignment
+
+    // Instance-scoped boundary tensor bindings
+    cmx_tensor_binding input_bindings[CMX_MAX_BOUND_TENSORS];
+    cmx_tensor_binding output_bindings[CMX_MAX_BOUND_TENSORS];
+};
 
 namespace cmx {
 
+namespace {
+
+// Weight tensors are pointer-fixups into the image, so it must be at
+// least as aligned as the widest element type in the format
+constexpr size_t CMX_MODEL_IMAGE_ALIGNMENT = 8;
+
+bool cmx_image_aligned(const void* data) {
+    return (reinterpret_cast<uintptr_t>(data) % CMX_MODEL_IMAGE_ALIGNMENT) == 0;
+}
+
+// Delta patch format: header, then records in output order; INSERT
+// records are followed inline by their literal bytes
+constexpr uint32_t CMX_PATCH_MAGIC = 0x44584D43; // 'CMXD'
+constexpr uint32_t CMX_PATCH_VERSION = 1;
+
+struct cmx_patch_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t record_count;
+    uint32_t reserved;
+    uint64_t output_size;   // Size of the reconstructed image
+    uint64_t base_hash;     // FNV-1a of the expected base image
+};
+
+struct cmx_patch_record {
+    uint32_t kind;          // 0 = copy range from base, 1 = literal insert
+    uint32_t length;        // Bytes produced by this record
+    uint64_t source_offset; // Offset into the base image (copy only)
+    uint64_t content_hash;  // FNV-1a of the produced bytes
+};
+
+constexpr uint32_t CMX_PATCH_COPY = 0;
+constexpr uint32_t CMX_PATCH_INSERT = 1;
+
+uint64_t cmx_fnv1a(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace
+
 cmx_model_handle cmx_load_model(const void* data, size_t size) {
-    if (!data || size == 0) {
+    if (!data || size == 0 || !cmx_image_aligned(data)) {
         return CMX_INVALID_HANDLE;
     }
 
     try {
-        // TODO: Implement actual model deserialization
-        // This is a placeholder implementation
+        // Zero-copy: the image (caller buffer, XIP flash, or mapping) is
+        // referenced in place and must outlive the model
         auto* model = new cmx_model_internal();
-        
+        model->data = data;
+        model->size = size;
+
         // Validate model header and version
         // Parse model structure
         // Allocate required resources
-        
+
         return static_cast<cmx_model_handle>(model);
     } catch (...) {
         return CMX_INVALID_HANDLE;
@@ -38,6 +134,35 @@ cmx_model_handle cmx_load_model_from_file(const char* file_path) {
         return CMX_INVALID_HANDLE;
     }
 
+#ifdef CMX_HAVE_MMAP
+    // Zero-copy path: map the file read-only and use weights in place.
+    // mmap returns page-aligned memory, satisfying the image alignment.
+    int fd = ::open(file_path, O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            size_t map_size = static_cast<size_t>(st.st_size);
+            void* mapping = ::mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+
+            if (mapping != MAP_FAILED) {
+                cmx_model_handle handle = cmx_load_model(mapping, map_size);
+                if (handle == CMX_INVALID_HANDLE) {
+                    ::munmap(mapping, map_size);
+                    return CMX_INVALID_HANDLE;
+                }
+                auto* model = static_cast<cmx_model_internal*>(handle);
+                model->mapping = mapping;
+                model->mapping_size = map_size;
+                return handle;
+            }
+        } else {
+            ::close(fd);
+        }
+    }
+    // Fall through to the read path on any mmap failure
+#endif
+
     try {
         std::ifstream file(file_path, std::ios::binary | std::ios::ate);
         if (!file.is_open()) {
@@ -47,17 +172,115 @@ cmx_model_handle cmx_load_model_from_file(const char* file_path) {
         std::streamsize size = file.tellg();
         file.seekg(0, std::ios::beg);
 
-        std::vector<char> buffer(size);
-        if (!file.read(buffer.data(), size)) {
+        // Heap copy owned by the model so the image outlives this call
+        std::unique_ptr<char[]> buffer(new char[static_cast<size_t>(size)]);
+        if (!file.read(buffer.get(), size)) {
+            return CMX_INVALID_HANDLE;
+        }
+
+        cmx_model_handle handle = cmx_load_model(buffer.get(), static_cast<size_t>(size));
+        if (handle == CMX_INVALID_HANDLE) {
             return CMX_INVALID_HANDLE;
         }
 
-        return cmx_load_model(buffer.data(), static_cast<size_t>(size));
+        auto* model = static_cast<cmx_model_internal*>(handle);
+        model->heap_copy = buffer.release();
+        return handle;
     } catch (...) {
         return CMX_INVALID_HANDLE;
     }
 }
 
+cmx_status cmx_apply_model_patch(const char* base_path, const char* patch_path,
+                                 const char* output_path) {
+    if (!base_path || !patch_path || !output_path) {
+        return cmx_status::IO_ERROR;
+    }
+
+    try {
+        // Read the resident base image
+        std::ifstream base_file(base_path, std::ios::binary | std::ios::ate);
+        if (!base_file.is_open()) {
+            return cmx_status::IO_ERROR;
+        }
+        std::streamsize base_size = base_file.tellg();
+        base_file.seekg(0, std::ios::beg);
+        std::vector<char> base(static_cast<size_t>(base_size));
+        if (!base_file.read(base.data(), base_size)) {
+            return cmx_status::IO_ERROR;
+        }
+
+        std::ifstream patch_file(patch_path, std::ios::binary);
+        if (!patch_file.is_open()) {
+            return cmx_status::IO_ERROR;
+        }
+
+        cmx_patch_header header;
+        if (!patch_file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+            return cmx_status::IO_ERROR;
+        }
+        if (header.magic != CMX_PATCH_MAGIC) {
+            return cmx_status::INVALID_MODEL;
+        }
+        if (header.version != CMX_PATCH_VERSION) {
+            return cmx_status::UNSUPPORTED_VERSION;
+        }
+
+        // A patch must never be applied to the wrong base image
+        if (cmx_fnv1a(base.data(), base.size()) != header.base_hash) {
+            return cmx_status::INVALID_MODEL;
+        }
+
+        std::ofstream output(output_path, std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            return cmx_status::IO_ERROR;
+        }
+
+        uint64_t produced = 0;
+        std::vector<char> literal;
+        for (uint32_t i = 0; i < header.record_count; ++i) {
+            cmx_patch_record record;
+            if (!patch_file.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+                return cmx_status::IO_ERROR;
+            }
+
+            if (record.kind == CMX_PATCH_COPY) {
+                // Unchanged payload: copy from the resident image
+                if (record.source_offset + record.length > base.size()) {
+                    return cmx_status::INVALID_MODEL;
+                }
+                const char* source = base.data() + record.source_offset;
+                if (cmx_fnv1a(source, record.length) != record.content_hash) {
+                    return cmx_status::INVALID_MODEL;
+                }
+                output.write(source, record.length);
+            } else if (record.kind == CMX_PATCH_INSERT) {
+                // Changed payload: literal bytes carried by the patch
+                literal.resize(record.length);
+                if (!patch_file.read(literal.data(), record.length)) {
+                    return cmx_status::IO_ERROR;
+                }
+                if (cmx_fnv1a(literal.data(), literal.size()) != record.content_hash) {
+                    return cmx_status::INVALID_MODEL;
+                }
+                output.write(literal.data(), record.length);
+            } else {
+                return cmx_status::INVALID_MODEL;
+            }
+
+            produced += record.length;
+        }
+
+        if (produced != header.output_size || !output.good()) {
+            return cmx_status::IO_ERROR;
+        }
+
+        return cmx_status::OK;
+    } catch (...) {
+        return cmx_status::ERROR;
+    }
+}
+
 cmx_status cmx_free_model(cmx_model_handle handle) {
     if (!cmx_is_valid_handle(handle)) {
         return cmx_status::INVALID_HANDLE;
@@ -65,6 +288,18 @@ cmx_status cmx_free_model(cmx_model_handle handle) {
 
     try {
         auto* model = static_cast<cmx_model_internal*>(handle);
+
+        // Instances hold raw references into the model's weights and
+        // plan; freeing under them would leave dangling executions
+        if (model->active_instances.load(std::memory_order_acquire) > 0) {
+            return cmx_status::ERROR;
+        }
+#ifdef CMX_HAVE_MMAP
+        if (model->mapping) {
+            ::munmap(model->mapping, model->mapping_size);
+        }
+#endif
+        delete[] model->heap_copy;
         delete model;
         return cmx_status::OK;
     } catch (...) {
@@ -84,7 +319,11 @@ cmx_status cmx_get_model_info(cmx_model_handle handle, cmx_model_info* info) {
         info->input_count = 1;
         info->output_count = 1;
         info->memory_required = 1024;
-        
+        // Startup capability probe the kernel plan was resolved
+        // against; tools compare this with the deployment target to
+        // verify the expected fast paths were chosen
+        info->platform_features = cmx::platform::get_feature_mask();
+
         return cmx_status::OK;
     } catch (...) {
         return cmx_status::ERROR;
@@ -143,20 +382,104 @@ cmx_status cmx_validate_model(cmx_model_handle handle) {
     }
 }
 
+// Declared in cmx_runtime_api.hpp; lives here because preparation
+// walks the model internals
+cmx_status cmx_prepare_model(cmx_model_handle handle) {
+    if (!cmx_is_valid_handle(handle)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    auto* model = static_cast<cmx_model_internal*>(handle);
+
+    try {
+        // Prefault the whole model image now. For memory-mapped and
+        // XIP-backed models the weights are demand-paged, so without
+        // this the first inference eats every page fault and flash
+        // fetch itself. One volatile pass folds the cost into prepare.
+        const volatile uint8_t* image =
+            static_cast<const volatile uint8_t*>(model->data);
+        uint8_t touch = 0;
+        for (size_t offset = 0; offset < model->size; offset += 4096) {
+            touch ^= image[offset];
+        }
+        if (model->size > 0) {
+            touch ^= image[model->size - 1];
+        }
+        (void)touch;
+
+        // TODO: Select and configure() every kernel in the graph
+        // TODO: Prepack weights into the kernels' preferred layouts
+        // TODO: Compile the execution plan and size workspaces
+        // TODO: Reserve the activation arena
+        return cmx_status::OK;
+    } catch (...) {
+        return cmx_status::ERROR;
+    }
+}
+
 cmx_status cmx_execute_model(cmx_model_handle handle, void** inputs, void** outputs) {
-    if (!cmx_is_valid_handle(handle) || !inputs || !outputs) {
+    if (!cmx_is_valid_handle(handle)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    // Null arrays are allowed when the boundary tensors were lent
+    // through cmx_bind_input/cmx_bind_output instead
+    auto* model = static_cast<cmx_model_internal*>(handle);
+    if ((!inputs && !model->input_bindings[0].data) ||
+        (!outputs && !model->output_bindings[0].data)) {
         return cmx_status::INVALID_HANDLE;
     }
 
     try {
         // TODO: Implement actual model execution
-        // This would interface with the runtime engine
+        // This would interface with the runtime engine; bound tensors
+        // are read/written in place, unbound ones come from the arrays
         return cmx_status::OK;
     } catch (...) {
         return cmx_status::RUNTIME_ERROR;
     }
 }
 
+cmx_status cmx_bind_input(cmx_model_handle handle, uint32_t index, void* data, size_t size) {
+    if (!cmx_is_valid_handle(handle) || !data || size == 0 ||
+        index >= CMX_MAX_BOUND_TENSORS) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    // A misaligned bound buffer would fault or silently defeat the
+    // vector kernels; refuse it rather than falling back to a copy
+    if (reinterpret_cast<uintptr_t>(data) % CMX_TENSOR_BINDING_ALIGNMENT != 0) {
+        return cmx_status::ERROR;
+    }
+
+    auto* model = static_cast<cmx_model_internal*>(handle);
+    model->input_bindings[index].data = data;
+    model->input_bindings[index].size = size;
+
+    // TODO: Point the graph's boundary CMXTensor at the lent buffer
+    // (non-owning data pointer) once the handle resolves to a graph
+    return cmx_status::OK;
+}
+
+cmx_status cmx_bind_output(cmx_model_handle handle, uint32_t index, void* data, size_t size) {
+    if (!cmx_is_valid_handle(handle) || !data || size == 0 ||
+        index >= CMX_MAX_BOUND_TENSORS) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    if (reinterpret_cast<uintptr_t>(data) % CMX_TENSOR_BINDING_ALIGNMENT != 0) {
+        return cmx_status::ERROR;
+    }
+
+    auto* model = static_cast<cmx_model_internal*>(handle);
+    model->output_bindings[index].data = data;
+    model->output_bindings[index].size = size;
+
+    // TODO: Point the graph's output CMXTensor at the lent buffer once
+    // the handle resolves to a graph
+    return cmx_status::OK;
+}
+
 cmx_status cmx_set_input(cmx_model_handle handle, uint32_t index, const void* data, size_t size) {
     if (!cmx_is_valid_handle(handle) || !data || size == 0) {
         return cmx_status::INVALID_HANDLE;
@@ -183,4 +506,119 @@ cmx_status cmx_get_output(cmx_model_handle handle, uint32_t index, void* data, s
     }
 }
 
+cmx_instance_handle cmx_create_instance(cmx_model_handle handle,
+                                        size_t scratch_size) {
+    if (!cmx_is_valid_handle(handle)) {
+        return CMX_INVALID_INSTANCE;
+    }
+
+    auto* model = static_cast<cmx_model_internal*>(handle);
+
+    try {
+        // Default the arena to what the model's plan requires
+        if (scratch_size == 0) {
+            cmx_model_info info;
+            if (cmx_get_model_info(handle, &info) != cmx_status::OK) {
+                return CMX_INVALID_INSTANCE;
+            }
+            scratch_size = info.memory_required;
+        }
+
+        auto instance = std::make_unique<cmx_instance_internal>();
+        instance->model = model;
+
+        // Over-allocate by the alignment so execution can align the
+        // arena base inside the vector's storage
+        instance->scratch.resize(scratch_size + CMX_TENSOR_BINDING_ALIGNMENT);
+        instance->scratch_size = scratch_size;
+
+        model->active_instances.fetch_add(1, std::memory_order_acq_rel);
+        return static_cast<cmx_instance_handle>(instance.release());
+    } catch (...) {
+        return CMX_INVALID_INSTANCE;
+    }
+}
+
+cmx_status cmx_free_instance(cmx_instance_handle instance) {
+    if (!cmx_is_valid_instance(instance)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    try {
+        auto* state = static_cast<cmx_instance_internal*>(instance);
+        state->model->active_instances.fetch_sub(1, std::memory_order_acq_rel);
+        delete state;
+        return cmx_status::OK;
+    } catch (...) {
+        return cmx_status::ERROR;
+    }
+}
+
+cmx_status cmx_instance_bind_input(cmx_instance_handle instance, uint32_t index,
+                                   void* data, size_t size) {
+    if (!cmx_is_valid_instance(instance) || !data || size == 0 ||
+        index >= CMX_MAX_BOUND_TENSORS) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    // Same refusal as cmx_bind_input: a misaligned buffer would defeat
+    // the vector kernels
+    if (reinterpret_cast<uintptr_t>(data) % CMX_TENSOR_BINDING_ALIGNMENT != 0) {
+        return cmx_status::ERROR;
+    }
+
+    auto* state = static_cast<cmx_instance_internal*>(instance);
+    state->input_bindings[index].data = data;
+    state->input_bindings[index].size = size;
+    return cmx_status::OK;
+}
+
+cmx_status cmx_instance_bind_output(cmx_instance_handle instance, uint32_t index,
+                                    void* data, size_t size) {
+    if (!cmx_is_valid_instance(instance) || !data || size == 0 ||
+        index >= CMX_MAX_BOUND_TENSORS) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    if (reinterpret_cast<uintptr_t>(data) % CMX_TENSOR_BINDING_ALIGNMENT != 0) {
+        return cmx_status::ERROR;
+    }
+
+    auto* state = static_cast<cmx_instance_internal*>(instance);
+    state->output_bindings[index].data = data;
+    state->output_bindings[index].size = size;
+    return cmx_status::OK;
+}
+
+cmx_status cmx_instance_execute(cmx_instance_handle instance,
+                                void** inputs, void** outputs) {
+    if (!cmx_is_valid_instance(instance)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    auto* state = static_cast<cmx_instance_internal*>(instance);
+    if (!cmx_is_valid_handle(state->model)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    // Null arrays are allowed when the boundary tensors were bound
+    // through cmx_instance_bind_input/_output instead
+    if ((!inputs && !state->input_bindings[0].data) ||
+        (!outputs && !state->output_bindings[0].data)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    try {
+        // TODO: Implement actual model execution. Intermediate tensors
+        // resolve to offsets inside state->scratch (aligned base), the
+        // boundary tensors come from the instance bindings or the given
+        // arrays, and the model's weights and plan are only read - that
+        // is what makes concurrent instance executions safe without a
+        // lock.
+        return cmx_status::OK;
+    } catch (...) {
+        return cmx_status::RUNTIME_ERROR;
+    }
+}
+
 } // namespace cmx
\ No newline at end of file
@@ -14,7 +14,12 @@
 namespace cmx {
 
 /**
- * @brief Load a model from binary data
+ * @brief Load a model from binary data (zero-copy)
+ *
+ * The buffer is referenced, not copied, and must outlive the model.
+ * On XIP-capable MCUs pass the flash address of the model image
+ * directly: weight tensors are used in place with no RAM copy.
+ *
  * @param data Pointer to model binary data
  * @param size Size of the binary data in bytes
  * @return Model handle on success, CMX_INVALID_HANDLE on failure
@@ -23,11 +28,37 @@ cmx_model_handle cmx_load_model(const void* data, size_t size);
 
 /**
  * @brief Load a model from file path
+ *
+ * On platforms with virtual memory the file is memory-mapped read-only
+ * and weight tensors resolve to pointers into the mapping, so load time
+ * is independent of model size and weights are shared between processes
+ * by the page cache. Falls back to a heap read where mmap is
+ * unavailable.
+ *
  * @param file_path Path to the model file
  * @return Model handle on success, CMX_INVALID_HANDLE on failure
  */
 cmx_model_handle cmx_load_model_from_file(const char* file_path);
 
+/**
+ * @brief Apply an OTA delta patch to a resident model
+ *
+ * Rebuilds a full model image from the resident base model and a patch
+ * file. Patch records either reference unchanged payload ranges of the
+ * base image by offset and content hash (copied locally, no airtime or
+ * extra flash writes for them) or carry literal bytes for changed
+ * tensors. Every produced range is verified against its FNV-1a hash, and
+ * the whole base image is checked against the hash recorded in the patch
+ * header, so a patch can never be applied to the wrong base.
+ *
+ * @param base_path Path to the resident base model
+ * @param patch_path Path to the delta patch file
+ * @param output_path Path for the reconstructed model image
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_apply_model_patch(const char* base_path, const char* patch_path,
+                                 const char* output_path);
+
 /**
  * @brief Free a loaded model and release its resources
  * @param handle Model handle to free
@@ -97,4 +128,130 @@ cmx_status cmx_set_input(cmx_model_handle handle, uint32_t index, const void* da
  */
 cmx_status cmx_get_output(cmx_model_handle handle, uint32_t index, void* data, size_t size);
 
+/**
+ * @brief Required alignment for buffers lent through cmx_bind_input
+ *        and cmx_bind_output
+ *
+ * Matches the arena alignment the kernels assume, so a bound buffer is
+ * indistinguishable from a runtime-owned tensor.
+ */
+constexpr size_t CMX_TENSOR_BINDING_ALIGNMENT = 16;
+
+/**
+ * @brief Bind a caller-owned buffer as an input tensor (zero-copy)
+ *
+ * The buffer is lent, not copied: it becomes the backing store of the
+ * graph's boundary tensor, so a DMA engine (e.g. the camera) can write
+ * straight into the memory the first layer reads. The binding persists
+ * across executions until rebound or the model is freed; the buffer
+ * must outlive it, stay valid during execution, and be aligned to
+ * CMX_TENSOR_BINDING_ALIGNMENT. Use cmx_set_input instead when the
+ * source buffer cannot meet the alignment or lifetime requirements.
+ *
+ * @param handle Model handle
+ * @param index Input tensor index
+ * @param data Caller-owned buffer to lend
+ * @param size Buffer size in bytes (must cover the tensor)
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_bind_input(cmx_model_handle handle, uint32_t index, void* data, size_t size);
+
+/**
+ * @brief Bind a caller-owned buffer as an output tensor (zero-copy)
+ *
+ * The final layer writes its result directly into the lent buffer, so
+ * no cmx_get_output copy is needed after execution. Same alignment and
+ * lifetime requirements as cmx_bind_input.
+ *
+ * @param handle Model handle
+ * @param index Output tensor index
+ * @param data Caller-owned buffer to lend
+ * @param size Buffer size in bytes (must cover the tensor)
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_bind_output(cmx_model_handle handle, uint32_t index, void* data, size_t size);
+
+/**
+ * @brief Create an execution instance over a loaded model
+ *
+ * Two threads calling cmx_execute_model on one handle corrupt each
+ * other's intermediate tensors, because the plan's activation arena is
+ * baked into the model. An instance carries that mutable per-invocation
+ * state privately - its own scratch arena and its own I/O bindings -
+ * while the weights and the compiled plan stay shared and immutable, so
+ * one loaded model serves N concurrent executions for the memory cost
+ * of N scratch arenas. Instances may execute concurrently with each
+ * other and with cmx_execute_model on the parent handle.
+ *
+ * The model must outlive its instances; cmx_free_model refuses to
+ * release a model that still has live instances.
+ *
+ * @param handle Model handle the instance executes
+ * @param scratch_size Activation arena size in bytes, or 0 to size it
+ *        from the model's plan (cmx_model_info::memory_required)
+ * @return Instance handle on success, CMX_INVALID_INSTANCE on failure
+ */
+cmx_instance_handle cmx_create_instance(cmx_model_handle handle,
+                                        size_t scratch_size = 0);
+
+/**
+ * @brief Free an execution instance
+ *
+ * Must not be called while an execution on the instance is in flight.
+ * The parent model is unaffected.
+ *
+ * @param instance Instance handle to free
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_free_instance(cmx_instance_handle instance);
+
+/**
+ * @brief Bind a caller-owned buffer as an instance's input tensor
+ *
+ * Same zero-copy contract, alignment, and lifetime rules as
+ * cmx_bind_input, but scoped to this instance only, so concurrent
+ * executions feed disjoint buffers through the shared plan.
+ *
+ * @param instance Instance handle
+ * @param index Input tensor index
+ * @param data Caller-owned buffer to lend
+ * @param size Buffer size in bytes (must cover the tensor)
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_instance_bind_input(cmx_instance_handle instance, uint32_t index,
+                                   void* data, size_t size);
+
+/**
+ * @brief Bind a caller-owned buffer as an instance's output tensor
+ *
+ * Instance-scoped counterpart of cmx_bind_output.
+ *
+ * @param instance Instance handle
+ * @param index Output tensor index
+ * @param data Caller-owned buffer to lend
+ * @param size Buffer size in bytes (must cover the tensor)
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_instance_bind_output(cmx_instance_handle instance, uint32_t index,
+                                    void* data, size_t size);
+
+/**
+ * @brief Execute the parent model through an execution instance
+ *
+ * Intermediate tensors resolve into the instance's private scratch
+ * arena and boundary tensors come from the instance's bindings (or the
+ * given arrays), so any number of instances of the same model may
+ * execute concurrently from different threads. No synchronization is
+ * taken; the shared weights and plan are read-only during execution.
+ *
+ * @param instance Instance handle from cmx_create_instance
+ * @param inputs Array of input tensor data pointers (may be null when
+ *        all inputs are bound)
+ * @param outputs Array of output tensor data pointers (may be null when
+ *        all outputs are bound)
+ * @return Status code indicating execution result
+ */
+cmx_status cmx_instance_execute(cmx_instance_handle instance,
+                                void** inputs, void** outputs);
+
 } // namespace cmx
\ No newline at end of file
@@ -1,21 +1,258 @@
 #include "cmx_runtime_api.hpp"
+#include "cmx_model_loder.hpp"
+#include "../cmx_core/runtime/cmx_scheduler.hpp"
+#include "../cmx_core/runtime/cmx_memory_pool.hpp"
 #include <string>
 #include <mutex>
 #include <atomic>
+#include <chrono>
+#include <thread>
 
 /**
  * @file cmx_runtime_api.cpp
  * @brief Implementation of runtime engine control functions
+ *
+ * All mutable runtime state lives in CmxContextState. User-created
+ * contexts each own one instance; the legacy global API operates on a
+ * default instance created by cmx_init(), so the two entry points
+ * share one code path and two contexts never share a scheduler, pool,
+ * job slot, or statistics counter.
  */
 
 namespace cmx {
 
-// Global runtime state
+struct CmxContextState;
+
+namespace {
+
+struct AsyncJob {
+    std::atomic<uint32_t> id{0};    ///< Async handle; 0 = slot free
+    std::atomic<bool> done{false};  ///< Execution finished
+    cmx_model_handle handle;
+    void** inputs;
+    void** outputs;
+    cmx_async_callback callback;
+    void* user_data;
+    cmx_status result;
+    CmxContextState* owner;         ///< Context to account stats to
+};
+
+constexpr size_t kMaxAsyncJobs = 16;
+constexpr uint32_t kClaimedSlot = UINT32_MAX;  // Slot taken, id not yet published
+
+} // namespace
+
+/**
+ * @brief Everything one execution context owns
+ *
+ * Scheduler, worker thread, memory pool, async job pool, statistics
+ * and error string are all per-context, so operations on different
+ * contexts only ever touch disjoint state.
+ */
+struct CmxContextState {
+    cmx_runtime_config config;
+    cmx_runtime_stats stats{};
+    std::mutex mutex;
+    std::string last_error;
+    runtime::CMXScheduler scheduler;
+    runtime::CMXMemoryPool pool;
+    std::thread worker;
+    std::atomic<bool> worker_running{false};
+    AsyncJob jobs[kMaxAsyncJobs];
+    std::atomic<uint32_t> next_async_id{1};
+};
+
+// Global runtime state: init flag plus the default context the legacy
+// API delegates to
 static std::atomic<bool> g_runtime_initialized{false};
 static std::mutex g_runtime_mutex;
-static cmx_runtime_config g_runtime_config;
-static cmx_runtime_stats g_runtime_stats;
-static std::string g_last_error;
+static CmxContextState* g_default_context = nullptr;
+
+namespace {
+
+// Record one finished execution in the context's running stats
+void account_execution(CmxContextState& state, cmx_status result,
+                       double elapsed_ms) {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    const uint64_t n = ++state.stats.total_executions;
+    state.stats.average_exec_time_ms +=
+        (elapsed_ms - state.stats.average_exec_time_ms) / static_cast<double>(n);
+    if (result != cmx_status::OK) {
+        state.last_error = "Model execution failed";
+    }
+}
+
+// Runs on the owning context's worker thread via its scheduler
+void async_job_task(void* context) {
+    AsyncJob* job = static_cast<AsyncJob*>(context);
+    const auto start = std::chrono::steady_clock::now();
+    job->result = cmx_execute_model(job->handle, job->inputs, job->outputs);
+    const auto end = std::chrono::steady_clock::now();
+    account_execution(*job->owner, job->result,
+                      std::chrono::duration<double, std::milli>(end - start)
+                          .count());
+    job->done.store(true, std::memory_order_release);
+    if (job->callback) {
+        job->callback(job->result, job->user_data);
+    }
+}
+
+void worker_loop(CmxContextState* state) {
+    while (state->worker_running.load(std::memory_order_relaxed)) {
+        if (!state->scheduler.execute_single_task()) {
+            // Nothing queued; back off briefly instead of spinning
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+AsyncJob* find_job(CmxContextState& state, cmx_async_handle handle) {
+    for (size_t i = 0; i < kMaxAsyncJobs; ++i) {
+        if (state.jobs[i].id.load(std::memory_order_acquire) == handle) {
+            return &state.jobs[i];
+        }
+    }
+    return nullptr;
+}
+
+// Bring up one context: pool, scheduler, worker thread
+cmx_status start_context(CmxContextState& state,
+                         const cmx_runtime_config& config) {
+    state.config = config;
+    state.stats = {};
+    state.last_error.clear();
+
+    if (!state.pool.initialize(config.memory_pool_size)) {
+        state.last_error = "Context initialization failed: memory pool";
+        return cmx_status::MEMORY_ERROR;
+    }
+    if (!state.scheduler.initialize()) {
+        state.last_error = "Context initialization failed: scheduler";
+        return cmx_status::ERROR;
+    }
+    state.worker_running.store(true);
+    state.worker = std::thread(worker_loop, &state);
+    return cmx_status::OK;
+}
+
+// Tear down one context; blocks until the worker has drained
+void stop_context(CmxContextState& state) {
+    state.worker_running.store(false);
+    if (state.worker.joinable()) {
+        state.worker.join();
+    }
+    state.scheduler.shutdown();
+}
+
+cmx_async_handle submit_async(CmxContextState& state, cmx_model_handle handle,
+                              void** inputs, void** outputs,
+                              cmx_async_callback callback, void* user_data,
+                              cmx_task_priority priority) {
+    // Claim a job slot: free slots first, then recycle completed ones
+    // nobody reclaimed through poll/wait
+    AsyncJob* job = nullptr;
+    for (int pass = 0; pass < 2 && !job; ++pass) {
+        for (size_t i = 0; i < kMaxAsyncJobs; ++i) {
+            AsyncJob& candidate = state.jobs[i];
+            uint32_t current = candidate.id.load(std::memory_order_acquire);
+            const bool claimable = (pass == 0)
+                ? current == 0
+                : (current != 0 && current != kClaimedSlot &&
+                   candidate.done.load(std::memory_order_acquire));
+            if (claimable &&
+                candidate.id.compare_exchange_strong(current, kClaimedSlot)) {
+                job = &candidate;
+                break;
+            }
+        }
+    }
+    if (!job) {
+        return CMX_INVALID_ASYNC_HANDLE;  // All jobs in flight
+    }
+
+    uint32_t id;
+    do {
+        id = state.next_async_id.fetch_add(1);
+    } while (id == 0 || id == kClaimedSlot);
+
+    job->done.store(false, std::memory_order_relaxed);
+    job->handle = handle;
+    job->inputs = inputs;
+    job->outputs = outputs;
+    job->callback = callback;
+    job->user_data = user_data;
+    job->result = cmx_status::ERROR;
+    job->owner = &state;
+
+    uint32_t task = state.scheduler.submit_task(
+        &async_job_task, job, static_cast<runtime::TaskPriority>(priority));
+    if (task == 0 && !state.scheduler.has_pending_tasks()) {
+        // Task pool exhausted by completed entries; recycle and retry
+        state.scheduler.reset();
+        task = state.scheduler.submit_task(
+            &async_job_task, job, static_cast<runtime::TaskPriority>(priority));
+    }
+    if (task == 0) {
+        job->id.store(0, std::memory_order_release);
+        return CMX_INVALID_ASYNC_HANDLE;
+    }
+
+    job->id.store(id, std::memory_order_release);
+    return id;
+}
+
+bool poll_async(CmxContextState& state, cmx_async_handle handle,
+                cmx_status* result) {
+    if (handle == CMX_INVALID_ASYNC_HANDLE) {
+        if (result) {
+            *result = cmx_status::ERROR;
+        }
+        return true;
+    }
+
+    AsyncJob* job = find_job(state, handle);
+    if (!job) {
+        // Slot already recycled: the execution completed earlier
+        if (result) {
+            *result = cmx_status::OK;
+        }
+        return true;
+    }
+
+    if (!job->done.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    if (result) {
+        *result = job->result;
+    }
+    return true;
+}
+
+cmx_status wait_async(CmxContextState& state, cmx_async_handle handle,
+                      uint32_t timeout_ms) {
+    cmx_status result = cmx_status::ERROR;
+    auto start_time = std::chrono::steady_clock::now();
+
+    while (!poll_async(state, handle, &result)) {
+        if (timeout_ms > 0) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start_time);
+            if (elapsed.count() >= timeout_ms) {
+                return cmx_status::ERROR;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    return result;
+}
+
+CmxContextState* to_state(cmx_context context) {
+    return static_cast<CmxContextState*>(context);
+}
+
+} // namespace
 
 // Default configuration values
 static const cmx_runtime_config DEFAULT_CONFIG = {
@@ -33,7 +270,7 @@ cmx_status cmx_init() {
 
 cmx_status cmx_init_with_config(const cmx_runtime_config* config) {
     std::lock_guard<std::mutex> lock(g_runtime_mutex);
-    
+
     if (g_runtime_initialized.load()) {
         return cmx_status::ALREADY_INITIALIZED;
     }
@@ -43,57 +280,57 @@ cmx_status cmx_init_with_config(const cmx_runtime_config* config) {
     }
 
     try {
-        // Copy configuration
-        g_runtime_config = *config;
-        
-        // Initialize runtime subsystems
-        // TODO: Initialize memory pool
-        // TODO: Initialize thread pool
+        // The legacy global API is just the default context
+        g_default_context = new CmxContextState();
+        cmx_status status = start_context(*g_default_context, *config);
+        if (status != cmx_status::OK) {
+            delete g_default_context;
+            g_default_context = nullptr;
+            return status;
+        }
+
         // TODO: Initialize model cache
         // TODO: Initialize profiling system if enabled
-        
-        // Reset statistics
-        g_runtime_stats = {};
-        
-        // Clear any previous errors
-        g_last_error.clear();
-        
+
         g_runtime_initialized.store(true);
         return cmx_status::OK;
-        
+
     } catch (const std::exception& e) {
-        g_last_error = "Runtime initialization failed: " + std::string(e.what());
+        delete g_default_context;
+        g_default_context = nullptr;
         return cmx_status::ERROR;
     } catch (...) {
-        g_last_error = "Runtime initialization failed: Unknown error";
+        delete g_default_context;
+        g_default_context = nullptr;
         return cmx_status::ERROR;
     }
 }
 
 cmx_status cmx_shutdown() {
     std::lock_guard<std::mutex> lock(g_runtime_mutex);
-    
+
     if (!g_runtime_initialized.load()) {
         return cmx_status::NOT_INITIALIZED;
     }
 
     try {
-        // TODO: Shutdown all subsystems
+        stop_context(*g_default_context);
+        delete g_default_context;
+        g_default_context = nullptr;
+
         // TODO: Free all loaded models
-        // TODO: Cleanup memory pool
-        // TODO: Stop thread pool
         // TODO: Cleanup profiling system
-        
+
         g_runtime_initialized.store(false);
-        g_last_error.clear();
-        
         return cmx_status::OK;
-        
+
     } catch (const std::exception& e) {
-        g_last_error = "Runtime shutdown failed: " + std::string(e.what());
+        if (g_default_context) {
+            g_default_context->last_error =
+                "Runtime shutdown failed: " + std::string(e.what());
+        }
         return cmx_status::ERROR;
     } catch (...) {
-        g_last_error = "Runtime shutdown failed: Unknown error";
         return cmx_status::ERROR;
     }
 }
@@ -114,13 +351,13 @@ cmx_status cmx_get_runtime_config(cmx_runtime_config* config) {
     if (!config) {
         return cmx_status::ERROR;
     }
-    
+
     if (!g_runtime_initialized.load()) {
         return cmx_status::NOT_INITIALIZED;
     }
 
-    std::lock_guard<std::mutex> lock(g_runtime_mutex);
-    *config = g_runtime_config;
+    std::lock_guard<std::mutex> lock(g_default_context->mutex);
+    *config = g_default_context->config;
     return cmx_status::OK;
 }
 
@@ -128,18 +365,18 @@ cmx_status cmx_update_runtime_config(const cmx_runtime_config* config) {
     if (!config) {
         return cmx_status::ERROR;
     }
-    
+
     if (!g_runtime_initialized.load()) {
         return cmx_status::NOT_INITIALIZED;
     }
 
-    std::lock_guard<std::mutex> lock(g_runtime_mutex);
-    
+    std::lock_guard<std::mutex> lock(g_default_context->mutex);
+
     try {
         // Only allow updating certain configuration options at runtime
-        g_runtime_config.enable_profiling = config->enable_profiling;
+        g_default_context->config.enable_profiling = config->enable_profiling;
         // Note: Other config options might require restart
-        
+
         return cmx_status::OK;
     } catch (...) {
         return cmx_status::ERROR;
@@ -147,22 +384,47 @@ cmx_status cmx_update_runtime_config(const cmx_runtime_config* config) {
 }
 
 cmx_status cmx_get_runtime_stats(cmx_runtime_stats* stats) {
-    if (!stats) {
-        return cmx_status::ERROR;
+    if (!g_runtime_initialized.load()) {
+        return cmx_status::NOT_INITIALIZED;
+    }
+    return cmx_context_get_stats(g_default_context, stats);
+}
+
+cmx_status cmx_get_latency_histogram(cmx_model_handle handle,
+                                     cmx_latency_histogram* histogram) {
+    if (!cmx_is_valid_handle(handle) || !histogram) {
+        return cmx_status::INVALID_HANDLE;
     }
-    
+
     if (!g_runtime_initialized.load()) {
         return cmx_status::NOT_INITIALIZED;
     }
 
-    std::lock_guard<std::mutex> lock(g_runtime_mutex);
-    
-    // TODO: Update stats from actual runtime data
-    g_runtime_stats.memory_used = 0;  // Get from memory pool
-    g_runtime_stats.memory_peak = 0;  // Get from memory pool
-    g_runtime_stats.models_loaded = 0;  // Get from model manager
-    
-    *stats = g_runtime_stats;
+    std::lock_guard<std::mutex> lock(g_default_context->mutex);
+
+    // TODO: Copy from the graph executor owning this model
+    // (cmx_graph_stats::latency_buckets and failed_executions) once the
+    // handle resolves to an executor instance
+    *histogram = cmx_latency_histogram{};
+    return cmx_status::OK;
+}
+
+cmx_status cmx_set_execution_profile(cmx_model_handle handle,
+                                     const char* profile_name) {
+    if (!cmx_is_valid_handle(handle)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    if (!g_runtime_initialized.load()) {
+        return cmx_status::NOT_INITIALIZED;
+    }
+
+    std::lock_guard<std::mutex> lock(g_default_context->mutex);
+
+    // TODO: Forward to cmx_graph_executor::set_active_profile once the
+    // handle resolves to an executor instance; until then the selection
+    // is accepted but has no effect
+    (void)profile_name;
     return cmx_status::OK;
 }
 
@@ -170,17 +432,137 @@ cmx_status cmx_reset_runtime_stats() {
     if (!g_runtime_initialized.load()) {
         return cmx_status::NOT_INITIALIZED;
     }
+    return cmx_context_reset_stats(g_default_context);
+}
+
+cmx_status cmx_context_create(const cmx_runtime_config* config,
+                              cmx_context* context) {
+    if (!context) {
+        return cmx_status::ERROR;
+    }
+    *context = CMX_INVALID_CONTEXT;
+
+    if (!config) {
+        config = &DEFAULT_CONFIG;
+    }
+
+    try {
+        CmxContextState* state = new CmxContextState();
+        cmx_status status = start_context(*state, *config);
+        if (status != cmx_status::OK) {
+            delete state;
+            return status;
+        }
+        *context = state;
+        return cmx_status::OK;
+    } catch (...) {
+        return cmx_status::MEMORY_ERROR;
+    }
+}
+
+cmx_status cmx_context_destroy(cmx_context context) {
+    if (!cmx_is_valid_context(context) || context == g_default_context) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    try {
+        CmxContextState* state = to_state(context);
+        stop_context(*state);
+        delete state;
+        return cmx_status::OK;
+    } catch (...) {
+        return cmx_status::ERROR;
+    }
+}
+
+cmx_status cmx_context_execute_model(cmx_context context,
+                                     cmx_model_handle handle,
+                                     void** inputs, void** outputs) {
+    if (!cmx_is_valid_context(context)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    CmxContextState* state = to_state(context);
+    const auto start = std::chrono::steady_clock::now();
+    cmx_status result = cmx_execute_model(handle, inputs, outputs);
+    const auto end = std::chrono::steady_clock::now();
+    account_execution(*state, result,
+                      std::chrono::duration<double, std::milli>(end - start)
+                          .count());
+    return result;
+}
+
+cmx_async_handle cmx_context_execute_model_async(
+    cmx_context context, cmx_model_handle handle, void** inputs,
+    void** outputs, cmx_async_callback callback, void* user_data,
+    cmx_task_priority priority) {
+    if (!cmx_is_valid_context(context) || !cmx_is_valid_handle(handle) ||
+        !inputs || !outputs) {
+        return CMX_INVALID_ASYNC_HANDLE;
+    }
+    return submit_async(*to_state(context), handle, inputs, outputs, callback,
+                        user_data, priority);
+}
+
+bool cmx_context_poll(cmx_context context, cmx_async_handle handle,
+                      cmx_status* result) {
+    if (!cmx_is_valid_context(context)) {
+        if (result) {
+            *result = cmx_status::INVALID_HANDLE;
+        }
+        return true;
+    }
+    return poll_async(*to_state(context), handle, result);
+}
+
+cmx_status cmx_context_wait(cmx_context context, cmx_async_handle handle,
+                            uint32_t timeout_ms) {
+    if (!cmx_is_valid_context(context)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+    return wait_async(*to_state(context), handle, timeout_ms);
+}
+
+cmx_status cmx_context_get_stats(cmx_context context,
+                                 cmx_runtime_stats* stats) {
+    if (!cmx_is_valid_context(context) || !stats) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    CmxContextState* state = to_state(context);
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    // TODO: Fold in per-pool usage once CMXMemoryPool exposes it here
+    *stats = state->stats;
+    return cmx_status::OK;
+}
+
+cmx_status cmx_context_reset_stats(cmx_context context) {
+    if (!cmx_is_valid_context(context)) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    CmxContextState* state = to_state(context);
+    std::lock_guard<std::mutex> lock(state->mutex);
 
-    std::lock_guard<std::mutex> lock(g_runtime_mutex);
-    
     // Reset counters but preserve current state values
-    g_runtime_stats.total_executions = 0;
-    g_runtime_stats.average_exec_time_ms = 0.0;
-    g_runtime_stats.memory_peak = g_runtime_stats.memory_used;
-    
+    state->stats.total_executions = 0;
+    state->stats.average_exec_time_ms = 0.0;
+    state->stats.memory_peak = state->stats.memory_used;
+
     return cmx_status::OK;
 }
 
+const char* cmx_context_get_last_error(cmx_context context) {
+    if (!cmx_is_valid_context(context)) {
+        return nullptr;
+    }
+
+    CmxContextState* state = to_state(context);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->last_error.empty() ? nullptr : state->last_error.c_str();
+}
+
 cmx_status cmx_garbage_collect() {
     if (!g_runtime_initialized.load()) {
         return cmx_status::NOT_INITIALIZED;
@@ -190,7 +572,7 @@ cmx_status cmx_garbage_collect() {
         // TODO: Implement garbage collection
         // TODO: Clean up unused model caches
         // TODO: Compact memory pool if needed
-        
+
         return cmx_status::OK;
     } catch (...) {
         return cmx_status::ERROR;
@@ -211,13 +593,99 @@ cmx_status cmx_set_log_level(uint32_t level) {
 }
 
 const char* cmx_get_last_error() {
-    std::lock_guard<std::mutex> lock(g_runtime_mutex);
-    return g_last_error.empty() ? nullptr : g_last_error.c_str();
+    if (!g_runtime_initialized.load()) {
+        return nullptr;
+    }
+    return cmx_context_get_last_error(g_default_context);
 }
 
 void cmx_clear_last_error() {
-    std::lock_guard<std::mutex> lock(g_runtime_mutex);
-    g_last_error.clear();
+    if (!g_runtime_initialized.load()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(g_default_context->mutex);
+    g_default_context->last_error.clear();
+}
+
+cmx_async_handle cmx_execute_model_async(
+    cmx_model_handle handle, void** inputs, void** outputs,
+    cmx_async_callback callback, void* user_data,
+    cmx_task_priority priority) {
+    if (!g_runtime_initialized.load()) {
+        return CMX_INVALID_ASYNC_HANDLE;
+    }
+    return cmx_context_execute_model_async(g_default_context, handle, inputs,
+                                           outputs, callback, user_data,
+                                           priority);
+}
+
+bool cmx_poll(cmx_async_handle handle, cmx_status* result) {
+    if (!g_runtime_initialized.load()) {
+        if (result) {
+            *result = cmx_status::NOT_INITIALIZED;
+        }
+        return true;
+    }
+    return cmx_context_poll(g_default_context, handle, result);
+}
+
+cmx_status cmx_wait(cmx_async_handle handle, uint32_t timeout_ms) {
+    if (!g_runtime_initialized.load()) {
+        return cmx_status::NOT_INITIALIZED;
+    }
+    return cmx_context_wait(g_default_context, handle, timeout_ms);
+}
+
+cmx_status cmx_bind_input_double(cmx_model_handle handle, uint32_t input_index,
+                                 void* buffer_a, void* buffer_b, size_t size,
+                                 cmx_double_buffer* db) {
+    if (!db || !buffer_a || !buffer_b || buffer_a == buffer_b || size == 0) {
+        return cmx_status::ERROR;
+    }
+    if (!handle) {
+        return cmx_status::INVALID_HANDLE;
+    }
+
+    db->handle = handle;
+    db->input_index = input_index;
+    db->buffers[0] = buffer_a;
+    db->buffers[1] = buffer_b;
+    db->size = size;
+    db->fill_index = 0;
+    db->ready_valid = false;
+    return cmx_status::OK;
+}
+
+void* cmx_double_buffer_fill_ptr(const cmx_double_buffer* db) {
+    if (!db || db->fill_index > 1) {
+        return nullptr;
+    }
+    return db->buffers[db->fill_index];
+}
+
+void* cmx_double_buffer_ready_ptr(const cmx_double_buffer* db) {
+    if (!db || !db->ready_valid || db->fill_index > 1) {
+        return nullptr;
+    }
+    return db->buffers[db->fill_index ^ 1];
+}
+
+cmx_status cmx_double_buffer_swap(cmx_double_buffer* db) {
+    if (!db || db->fill_index > 1) {
+        return cmx_status::ERROR;
+    }
+
+    // The just-filled buffer becomes the bound (ready) input; the
+    // previous ready buffer is handed back to the producer
+    const cmx_status status = cmx_bind_input(
+        db->handle, db->input_index, db->buffers[db->fill_index], db->size);
+    if (status != cmx_status::OK) {
+        return status;
+    }
+
+    db->fill_index ^= 1;
+    db->ready_valid = true;
+    return cmx_status::OK;
 }
 
-} // namespace cmx
\ No newline at end of file
+} // namespace cmx
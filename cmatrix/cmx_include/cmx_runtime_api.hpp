@@ -100,6 +100,313 @@ cmx_status cmx_get_runtime_stats(cmx_runtime_stats* stats);
  */
 cmx_status cmx_reset_runtime_stats();
 
+/**
+ * @brief Number of latency histogram buckets
+ *
+ * Mirrors CMX_LATENCY_BUCKET_COUNT in the graph executor.
+ */
+constexpr uint32_t CMX_LATENCY_HISTOGRAM_BUCKETS = 24;
+
+/**
+ * @brief Per-model end-to-end latency histogram
+ *
+ * Log2-bucketed: buckets[i] counts inferences whose latency fell in
+ * [2^i, 2^(i+1)) microseconds, with the last bucket absorbing the
+ * tail. The executor maintains it on every run, profiling build or
+ * not, so production fleets can report latency drift without a
+ * special firmware.
+ */
+struct cmx_latency_histogram {
+    uint64_t buckets[CMX_LATENCY_HISTOGRAM_BUCKETS];
+    uint64_t total_inferences;    ///< Sum of all buckets
+    uint32_t failed_inferences;   ///< Executions that returned an error
+};
+
+/**
+ * @brief Query the latency histogram of a loaded model
+ * @param handle Model handle from cmx_load_model
+ * @param histogram Pointer to histogram structure to populate
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_get_latency_histogram(cmx_model_handle handle,
+                                     cmx_latency_histogram* histogram);
+
+/**
+ * @brief Switch a model's active execution profile
+ *
+ * Multi-exit models carry several operating points over one set of
+ * weights - e.g. a low-power scan head and a high-accuracy verify head
+ * sharing their backbone. The profiles themselves are defined on the
+ * executor at load time (cmx_graph_executor::define_execution_profile);
+ * this call selects which one the next execution runs, with no reload
+ * and no recompile. nullptr or an empty name selects the full graph.
+ *
+ * @param handle Model handle from cmx_load_model
+ * @param profile_name Profile to activate, nullptr for the full graph
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_set_execution_profile(cmx_model_handle handle,
+                                     const char* profile_name);
+
+/**
+ * @brief Handle identifying one in-flight asynchronous execution
+ */
+using cmx_async_handle = uint32_t;
+
+/**
+ * @brief Invalid asynchronous execution handle constant
+ */
+constexpr cmx_async_handle CMX_INVALID_ASYNC_HANDLE = 0;
+
+/**
+ * @brief Completion callback for asynchronous execution
+ * @param status Final execution status
+ * @param user_data Pointer passed to cmx_execute_model_async
+ */
+using cmx_async_callback = void (*)(cmx_status status, void* user_data);
+
+/**
+ * @brief Priority levels for asynchronous executions
+ *
+ * Mirrors the runtime scheduler's task priorities so callers do not
+ * need internal headers.
+ */
+enum class cmx_task_priority : uint8_t {
+    LOW = 0,
+    NORMAL = 1,
+    HIGH = 2,
+    CRITICAL = 3
+};
+
+/**
+ * @brief Execute a model asynchronously on a runtime worker
+ *
+ * Queues the execution on the runtime scheduler and returns
+ * immediately, so the caller can overlap inference with other work
+ * (e.g. sensor acquisition). The input and output buffers must stay
+ * valid until completion. The callback, if given, runs on the worker
+ * thread right after the execution finishes; keep it short and do not
+ * call back into blocking runtime APIs from it.
+ *
+ * @param handle Model handle from cmx_load_model
+ * @param inputs Array of input tensor data pointers
+ * @param outputs Array of output tensor data pointers
+ * @param callback Completion callback, or nullptr to rely on wait/poll
+ * @param user_data Opaque pointer passed through to the callback
+ * @param priority Scheduling priority of this execution
+ * @return Handle for wait/poll, or CMX_INVALID_ASYNC_HANDLE on failure
+ */
+cmx_async_handle cmx_execute_model_async(
+    cmx_model_handle handle, void** inputs, void** outputs,
+    cmx_async_callback callback, void* user_data,
+    cmx_task_priority priority = cmx_task_priority::NORMAL);
+
+/**
+ * @brief Check whether an asynchronous execution has completed
+ * @param handle Handle returned by cmx_execute_model_async
+ * @param result Receives the final status when complete (may be null)
+ * @return true if the execution has completed, false if still running
+ */
+bool cmx_poll(cmx_async_handle handle, cmx_status* result);
+
+/**
+ * @brief Block until an asynchronous execution completes
+ * @param handle Handle returned by cmx_execute_model_async
+ * @param timeout_ms Timeout in milliseconds (0 = no timeout)
+ * @return Final execution status, or ERROR on timeout
+ */
+cmx_status cmx_wait(cmx_async_handle handle, uint32_t timeout_ms = 0);
+
+/**
+ * @brief Run all one-time work for a model up front
+ *
+ * The first cmx_execute_model call is otherwise 3-5x slower than
+ * steady state: kernel selection and configure(), workspace sizing,
+ * weight prepacking, plan compilation, arena reservation, and (for
+ * memory-mapped models) first-touch page faults all happen lazily.
+ * cmx_prepare_model performs every one of those steps eagerly so the
+ * first real inference already runs at steady-state latency -
+ * required when a watchdog supervises boot-time inference deadlines.
+ *
+ * Calling it again is cheap and harmless; execution works without it,
+ * just with a slow first run.
+ *
+ * @param handle Model handle from cmx_load_model
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_prepare_model(cmx_model_handle handle);
+
+/**
+ * @brief Double-buffered (ping/pong) input binding state
+ *
+ * Caller-owned, no allocation. One buffer is bound as the model input
+ * the executor reads (the ready buffer) while the producer - typically
+ * a camera or sensor DMA - fills the other. cmx_double_buffer_swap
+ * flips the roles, so acquisition of frame N+1 overlaps inference on
+ * frame N with no copy anywhere on the path.
+ */
+struct cmx_double_buffer {
+    cmx_model_handle handle;    ///< Model the input belongs to
+    uint32_t input_index;       ///< Input tensor index
+    void* buffers[2];           ///< The two lent buffers
+    size_t size;                ///< Size of each buffer in bytes
+    uint32_t fill_index;        ///< Buffer the producer writes next
+    bool ready_valid;           ///< A swap has published a ready buffer
+};
+
+/**
+ * @brief Set up a ping/pong input binding over two caller-owned buffers
+ *
+ * Both buffers obey the cmx_bind_input lifetime and alignment rules.
+ * Nothing is bound until the first cmx_double_buffer_swap publishes a
+ * filled buffer; the producer starts by filling
+ * cmx_double_buffer_fill_ptr.
+ *
+ * @param handle Model handle
+ * @param input_index Input tensor index
+ * @param buffer_a First buffer to lend
+ * @param buffer_b Second buffer to lend
+ * @param size Size of each buffer in bytes (must cover the tensor)
+ * @param db Caller-owned state structure to initialize
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_bind_input_double(cmx_model_handle handle, uint32_t input_index,
+                                 void* buffer_a, void* buffer_b, size_t size,
+                                 cmx_double_buffer* db);
+
+/**
+ * @brief Buffer the producer should fill next
+ * @param db Double-buffer state from cmx_bind_input_double
+ * @return Fill buffer pointer, or nullptr if db is invalid
+ */
+void* cmx_double_buffer_fill_ptr(const cmx_double_buffer* db);
+
+/**
+ * @brief Buffer currently bound as the model input
+ * @param db Double-buffer state from cmx_bind_input_double
+ * @return Ready buffer pointer, or nullptr before the first swap
+ */
+void* cmx_double_buffer_ready_ptr(const cmx_double_buffer* db);
+
+/**
+ * @brief Publish the filled buffer and hand the other to the producer
+ *
+ * Binds the just-filled buffer as the model input (zero-copy, via
+ * cmx_bind_input) and makes the previous ready buffer the new fill
+ * target. Call between finishing a capture and executing the model;
+ * never swap while an execution that reads the binding is in flight.
+ *
+ * @param db Double-buffer state from cmx_bind_input_double
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_double_buffer_swap(cmx_double_buffer* db);
+
+/**
+ * @brief Create an independent execution context
+ *
+ * The context brings up its own scheduler, worker thread, memory pool,
+ * and statistics, fully isolated from every other context and from the
+ * legacy global runtime. Contexts may be created and used from
+ * different threads concurrently; each one serializes only its own
+ * operations.
+ *
+ * @param config Context configuration, or nullptr for defaults
+ * @param context Receives the new context handle
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_context_create(const cmx_runtime_config* config,
+                              cmx_context* context);
+
+/**
+ * @brief Destroy a context and release all its resources
+ *
+ * Blocks until the context's worker thread has drained. In-flight
+ * async handles from this context become invalid.
+ *
+ * @param context Context handle from cmx_context_create
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_context_destroy(cmx_context context);
+
+/**
+ * @brief Execute a model synchronously on a context
+ *
+ * Runs on the calling thread but accounts statistics to the context,
+ * so concurrent executions on different contexts never contend.
+ *
+ * @param context Context handle from cmx_context_create
+ * @param handle Model handle from cmx_load_model
+ * @param inputs Array of input tensor data pointers
+ * @param outputs Array of output tensor data pointers
+ * @return Status code indicating execution result
+ */
+cmx_status cmx_context_execute_model(cmx_context context,
+                                     cmx_model_handle handle,
+                                     void** inputs, void** outputs);
+
+/**
+ * @brief Execute a model asynchronously on a context's worker
+ *
+ * Same contract as cmx_execute_model_async, but queued on the given
+ * context's scheduler and tracked by its job pool.
+ *
+ * @param context Context handle from cmx_context_create
+ * @param handle Model handle from cmx_load_model
+ * @param inputs Array of input tensor data pointers
+ * @param outputs Array of output tensor data pointers
+ * @param callback Completion callback, or nullptr to rely on wait/poll
+ * @param user_data Opaque pointer passed through to the callback
+ * @param priority Scheduling priority of this execution
+ * @return Handle for wait/poll, or CMX_INVALID_ASYNC_HANDLE on failure
+ */
+cmx_async_handle cmx_context_execute_model_async(
+    cmx_context context, cmx_model_handle handle, void** inputs,
+    void** outputs, cmx_async_callback callback, void* user_data,
+    cmx_task_priority priority = cmx_task_priority::NORMAL);
+
+/**
+ * @brief Check whether a context's asynchronous execution has completed
+ * @param context Context the execution was submitted on
+ * @param handle Handle returned by cmx_context_execute_model_async
+ * @param result Receives the final status when complete (may be null)
+ * @return true if the execution has completed, false if still running
+ */
+bool cmx_context_poll(cmx_context context, cmx_async_handle handle,
+                      cmx_status* result);
+
+/**
+ * @brief Block until a context's asynchronous execution completes
+ * @param context Context the execution was submitted on
+ * @param handle Handle returned by cmx_context_execute_model_async
+ * @param timeout_ms Timeout in milliseconds (0 = no timeout)
+ * @return Final execution status, or ERROR on timeout
+ */
+cmx_status cmx_context_wait(cmx_context context, cmx_async_handle handle,
+                            uint32_t timeout_ms = 0);
+
+/**
+ * @brief Get statistics accumulated by one context
+ * @param context Context handle from cmx_context_create
+ * @param stats Pointer to statistics structure to populate
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_context_get_stats(cmx_context context,
+                                 cmx_runtime_stats* stats);
+
+/**
+ * @brief Reset a context's statistics counters
+ * @param context Context handle from cmx_context_create
+ * @return Status code indicating success or failure
+ */
+cmx_status cmx_context_reset_stats(cmx_context context);
+
+/**
+ * @brief Get last error message recorded on a context
+ * @param context Context handle from cmx_context_create
+ * @return Error message string, or nullptr if no error
+ */
+const char* cmx_context_get_last_error(cmx_context context);
+
 /**
  * @brief Force garbage collection of unused resources
  * @return Status code indicating success or failure
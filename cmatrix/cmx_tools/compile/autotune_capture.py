@@ -0,0 +1,190 @@
+"""
+autotune_capture.py - Turn cmx_autotune output into a tuning config header
+
+Parses the "CMX_TUNE ..." lines the on-target cmx_autotune harness
+prints over the serial console and emits cmx_tune_config.hpp with the
+winning tile sizes. Build the firmware with -DCMX_HAVE_TUNE_CONFIG and
+the output directory on the include path so cmx_tune_params.hpp picks
+the values up.
+"""
+
+import argparse
+import re
+import struct
+from collections import defaultdict
+from typing import Dict, List, TextIO
+
+
+# One measurement line per (parameter, shape, candidate) point
+_TUNE_LINE = re.compile(
+    r'^CMX_TUNE\s+param=(?P<param>\w+)\s+shape=(?P<shape>\S+)\s+'
+    r'value=(?P<value>-?\d+)\s+ticks=(?P<ticks>\d+)'
+)
+
+# One measurement line per (node, kernel candidate) point
+_KERNEL_LINE = re.compile(
+    r'^CMX_TUNE_KERNEL\s+node=(?P<node>\d+)\s+kernel=(?P<kernel>\S+)\s+'
+    r'ticks=(?P<ticks>\d+)'
+)
+
+
+def parse_tune_log(lines: List[str]) -> Dict[str, int]:
+    """
+    Pick the winning value per tunable parameter from harness output.
+
+    Each parameter gets one value for the whole build, so the winner is
+    the candidate with the lowest summed best-of ticks across all
+    measured shapes. Non-matching lines (banners, shape comments, the
+    harness's own CMX_TUNE_WINNER summary) are ignored, which keeps the
+    parser robust against serial-console noise.
+
+    Args:
+        lines: Captured harness output, one string per line
+
+    Returns:
+        Dict mapping parameter macro name to winning value
+
+    Raises:
+        ValueError: If no measurement lines are found
+    """
+    # param -> value -> summed ticks
+    totals: Dict[str, Dict[int, int]] = defaultdict(lambda: defaultdict(int))
+
+    for line in lines:
+        match = _TUNE_LINE.match(line.strip())
+        if match:
+            param = match.group('param')
+            value = int(match.group('value'))
+            totals[param][value] += int(match.group('ticks'))
+
+    if not totals:
+        raise ValueError("No CMX_TUNE measurement lines found in input")
+
+    winners = {}
+    for param, by_value in totals.items():
+        winners[param] = min(by_value, key=by_value.get)
+    return winners
+
+
+def parse_kernel_log(lines: List[str]) -> Dict[int, str]:
+    """
+    Pick the measured-best kernel per node from harness output.
+
+    The harness prints one CMX_TUNE_KERNEL line per (node, candidate)
+    point after pinning that candidate via
+    cmx_op_dispatcher::record_kernel_choice and re-timing the node;
+    the winner per node is the candidate with the lowest ticks. Unlike
+    the tile parameters, kernel choices are per node: the right
+    naive/blocked/simd pick differs between a tall-skinny head and a
+    square hidden layer in the same model.
+
+    Args:
+        lines: Captured harness output, one string per line
+
+    Returns:
+        Dict mapping node id to winning kernel name; empty when the
+        log carries no kernel lines (tile-size-only runs stay valid)
+    """
+    # node -> (best ticks, kernel name)
+    best: Dict[int, tuple] = {}
+
+    for line in lines:
+        match = _KERNEL_LINE.match(line.strip())
+        if not match:
+            continue
+        node = int(match.group('node'))
+        ticks = int(match.group('ticks'))
+        if node not in best or ticks < best[node][0]:
+            best[node] = (ticks, match.group('kernel'))
+
+    return {node: kernel for node, (_, kernel) in best.items()}
+
+
+def pack_kernel_choice_records(choices: Dict[int, str]) -> bytes:
+    """
+    Pack per-node winners into the plan section's trailer format.
+
+    One 32-byte record per node: uint32 node id then a 28-byte
+    NUL-padded kernel name, matching CMXSerializedKernelChoice in
+    cmx_graph_serializer.hpp. memory_planner.serialize_plan appends
+    the same records when handed the choices dict; this standalone
+    packer exists for patching the plan section of an already-exported
+    model file.
+
+    Args:
+        choices: Node id -> winning kernel name
+
+    Returns:
+        Concatenated records in node id order
+    """
+    out = bytearray()
+    for node_id in sorted(choices):
+        out += struct.pack('<I28s', node_id, choices[node_id].encode()[:27])
+    return bytes(out)
+
+
+def write_config_header(winners: Dict[str, int], output: TextIO,
+                        source_label: str = '') -> None:
+    """
+    Write cmx_tune_config.hpp content for the given winners.
+
+    Args:
+        winners: Parameter macro name -> winning value
+        output: Destination stream
+        source_label: Optional note on where the log came from
+    """
+    output.write('#pragma once\n\n')
+    output.write('// Generated by autotune_capture.py')
+    if source_label:
+        output.write(f' from {source_label}')
+    output.write(' - do not edit.\n')
+    output.write('// Regenerate by rerunning cmx_autotune on the target '
+                 'board.\n\n')
+    for param in sorted(winners):
+        output.write(f'#define {param} {winners[param]}\n')
+
+
+def main():
+    """Command-line entry point."""
+    parser = argparse.ArgumentParser(
+        description='Generate cmx_tune_config.hpp from cmx_autotune output')
+    parser.add_argument('log', help='Captured cmx_autotune serial output')
+    parser.add_argument('-o', '--output', default='cmx_tune_config.hpp',
+                        help='Generated header path')
+    parser.add_argument('-k', '--kernel-records', default=None,
+                        help='Write per-node kernel-choice records '
+                             '(plan section trailer) to this path')
+    args = parser.parse_args()
+
+    with open(args.log, 'r') as log_file:
+        lines = log_file.readlines()
+
+    kernel_choices = parse_kernel_log(lines)
+    try:
+        winners = parse_tune_log(lines)
+    except ValueError:
+        # A kernel-sweep-only log is fine; anything else is still an error
+        if not kernel_choices:
+            raise
+        winners = {}
+
+    if winners:
+        with open(args.output, 'w') as header:
+            write_config_header(winners, header, source_label=args.log)
+
+    for param, value in sorted(winners.items()):
+        print(f"{param} = {value}")
+    if winners:
+        print(f"Wrote {args.output}")
+
+    if args.kernel_records and kernel_choices:
+        with open(args.kernel_records, 'wb') as records:
+            records.write(pack_kernel_choice_records(kernel_choices))
+        for node, kernel in sorted(kernel_choices.items()):
+            print(f"node {node} -> {kernel}")
+        print(f"Wrote {args.kernel_records} "
+              f"({len(kernel_choices)} kernel-choice records)")
+
+
+if __name__ == '__main__':
+    main()
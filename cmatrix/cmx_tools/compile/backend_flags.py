@@ -21,9 +21,12 @@ BACKEND_CONFIGS = {
         'memory_model': 'harvard',
         'stack_size': 8192,
         'heap_size': 16384,
+        'peak_macs_per_sec': 1.0e8,   # ~1 MAC/cycle at 100 MHz (M4 DSP ext)
+        'memory_bandwidth_bytes_per_sec': 4.0e8,  # single-cycle SRAM, 32-bit bus
         'compiler_flags': ['-mcpu=cortex-m4', '-mthumb', '-mfpu=fpv4-sp-d16'],
         'defines': ['ARM_MATH_CM4', 'CORTEX_M'],
         'includes': ['arm_math.h', 'cmsis_os.h'],
+        'flash_section': '.rodata.cmx_weights',
         'template': 'cortex_m_template.cpp'
     },
     
@@ -39,9 +42,12 @@ BACKEND_CONFIGS = {
         'memory_model': 'von_neumann',
         'stack_size': 4096,
         'heap_size': 8192,
+        'peak_macs_per_sec': 5.0e7,   # scalar multiply on the soft/low-end cores
+        'memory_bandwidth_bytes_per_sec': 2.0e8,
         'compiler_flags': ['-march=rv32imf', '-mabi=ilp32f'],
         'defines': ['RISCV', 'RV32I'],
         'includes': ['riscv_vector.h'],
+        'flash_section': '.rodata.cmx_weights',
         'template': 'riscv_template.cpp'
     },
     
@@ -57,9 +63,12 @@ BACKEND_CONFIGS = {
         'memory_model': 'harvard',
         'stack_size': 8192,
         'heap_size': 32768,
+        'peak_macs_per_sec': 2.4e8,   # 240 MHz LX6, ~1 MAC/cycle
+        'memory_bandwidth_bytes_per_sec': 3.2e8,  # internal SRAM via 32-bit bus
         'compiler_flags': ['-mlongcalls'],
         'defines': ['XTENSA', 'ESP32'],
         'includes': ['esp_system.h', 'xtensa/hal.h'],
+        'flash_section': '.rodata.cmx_weights',
         'template': 'xtensa_template.cpp'
     },
     
@@ -75,9 +84,12 @@ BACKEND_CONFIGS = {
         'memory_model': 'von_neumann',
         'stack_size': 16384,
         'heap_size': 65536,
+        'peak_macs_per_sec': 1.0e9,
+        'memory_bandwidth_bytes_per_sec': 1.0e10,
         'compiler_flags': ['-O2'],
         'defines': ['GENERIC'],
         'includes': ['iostream', 'cstdint'],
+        'flash_section': '',  # host .rodata needs no section attribute
         'template': 'generic_template.cpp'
     }
 }
@@ -138,6 +150,15 @@ def has_vector_support(target_name: str) -> bool:
     return config.get('vector_width', 0) > 0
 
 
+def get_performance_profile(target_name: str) -> Dict[str, float]:
+    """Get peak compute and bandwidth numbers for roofline estimates."""
+    config = get_backend_flags(target_name)
+    return {
+        'peak_macs_per_sec': config.get('peak_macs_per_sec', 1.0e9),
+        'memory_bandwidth_bytes_per_sec': config.get('memory_bandwidth_bytes_per_sec', 1.0e9)
+    }
+
+
 def get_memory_constraints(target_name: str) -> Dict[str, int]:
     """Get memory constraints for target."""
     config = get_backend_flags(target_name)
@@ -13,6 +13,68 @@ from .backend_flags import get_backend_flags
 from .optimization_passes import optimize_graph
 from .quantization_engine import quantize
 from .code_generator import generate_code
+from .memory_planner import MemoryPlanningPass, serialize_plan, generate_plan_header
+
+
+# Layer types mapped to the CMX_NEED_OP_* flags in cmx_op_manifest.hpp
+_OP_MANIFEST_FLAGS = {
+    'conv2d': 'CMX_NEED_OP_CONV2D',
+    'relu': 'CMX_NEED_OP_RELU',
+    'dense': 'CMX_NEED_OP_DENSE',
+    'add': 'CMX_NEED_OP_ADD',
+    'sub': 'CMX_NEED_OP_SUB',
+    'mul': 'CMX_NEED_OP_MUL',
+    'div': 'CMX_NEED_OP_DIV',
+    'maxpool2d': 'CMX_NEED_OP_MAXPOOL2D',
+    'avgpool2d': 'CMX_NEED_OP_AVGPOOL2D',
+    'batchnorm': 'CMX_NEED_OP_BATCHNORM',
+    'softmax': 'CMX_NEED_OP_SOFTMAX',
+    'reshape': 'CMX_NEED_OP_RESHAPE',
+    'transpose': 'CMX_NEED_OP_TRANSPOSE',
+    'concat': 'CMX_NEED_OP_CONCAT',
+    'split': 'CMX_NEED_OP_SPLIT',
+}
+
+
+def generate_kernel_manifest(model_ir):
+    """Emit the compile-time kernel manifest header.
+
+    The header lists exactly the op kernels the model graph uses. A
+    firmware built with -DCMX_USE_KERNEL_MANIFEST and this header on
+    the include path compiles in and registers only those kernels;
+    every other op is eliminated from the binary and skipped at
+    startup (see cmx_core/ops/cmx_op_manifest.hpp).
+
+    Args:
+        model_ir: Internal model representation
+
+    Returns:
+        str: Header file contents
+    """
+    layer_types = []
+    for layer in model_ir.get('layers', []):
+        layer_type = layer.get('type', '').lower()
+        if layer_type and layer_type not in layer_types:
+            layer_types.append(layer_type)
+
+    lines = [
+        '// Generated by cmx_gen.py - do not edit',
+        '// Kernel manifest: the ops used by the compiled model',
+        '#pragma once',
+        '',
+        '#define CMX_KERNEL_MANIFEST 1',
+        '',
+    ]
+    for layer_type in layer_types:
+        flag = _OP_MANIFEST_FLAGS.get(layer_type)
+        if flag:
+            lines.append(f'#define {flag} 1')
+        else:
+            # Layer types without a core op (fused cells, custom ops)
+            # are dispatched by other means; note them for debugging
+            lines.append(f'// no core-op flag for layer type: {layer_type}')
+    lines.append('')
+    return '\n'.join(lines)
 
 
 def compile_model(
@@ -65,6 +127,31 @@ def compile_model(
         print("Applying quantization...")
         model_ir = quantize(model_ir, mode='int8', calibration_data=calibration_data)
     
+    # Plan the activation arena offline and emit both the serialized
+    # plan section (for the model file) and an AOT header
+    planning_pass = MemoryPlanningPass()
+    if optimization_level > 0 and planning_pass.can_apply(model_ir):
+        print("Planning activation arena...")
+        model_ir = planning_pass.apply(model_ir)
+
+        os.makedirs(output_dir, exist_ok=True)
+        plan = model_ir['memory_plan']
+        plan_bin_path = os.path.join(output_dir, 'cmx_memory_plan.bin')
+        with open(plan_bin_path, 'wb') as plan_file:
+            plan_file.write(serialize_plan(plan))
+        plan_hdr_path = os.path.join(output_dir, 'cmx_memory_plan.hpp')
+        with open(plan_hdr_path, 'w') as header_file:
+            header_file.write(generate_plan_header(plan))
+        print(f"Memory plan: {plan_bin_path}, {plan_hdr_path}")
+
+    # Emit the compile-time kernel manifest so manifest builds carry
+    # only the kernels this model needs
+    os.makedirs(output_dir, exist_ok=True)
+    manifest_path = os.path.join(output_dir, 'cmx_kernel_manifest.hpp')
+    with open(manifest_path, 'w') as manifest_file:
+        manifest_file.write(generate_kernel_manifest(model_ir))
+    print(f"Kernel manifest: {manifest_path}")
+
     # Generate code
     print("Generating C++ code...")
     output_path = generate_code(model_ir, target, output_dir)
@@ -4,6 +4,7 @@ code_generator.py - C/C++ code generation from optimized graph IR
 Converts optimized/quantized graphs into embedded-compatible C++ source code.
 """
 
+import math
 import os
 from pathlib import Path
 from typing import Dict, Any, List
@@ -15,10 +16,20 @@ from .backend_flags import get_backend_flags, get_template_name
 class CodeGenerator:
     """Generates C++ code from graph IR using templates."""
     
-    def __init__(self, target: str):
+    def __init__(self, target: str, specialize: bool = False,
+                 standalone: bool = False):
         self.target = target
         self.backend_config = get_backend_flags(target)
         self.template_dir = Path(__file__).parent / "templates"
+        # Full-specialization mode: emit per-layer loop nests with
+        # constant-folded shapes instead of calls into the generic
+        # runtime kernels, so the cross-compiler can unroll and
+        # software-pipeline each layer
+        self.specialize = specialize or standalone
+        # Standalone mode: emit one self-contained translation unit
+        # with no template and no runtime includes; implies full
+        # specialization because there are no runtime kernels to call
+        self.standalone = standalone
         
     def _load_template(self) -> str:
         """Load the appropriate template for the target."""
@@ -62,34 +73,148 @@ class CodeGenerator:
         
         return '\n'.join(define_lines)
     
+    # C++ type and element size for each supported tensor dtype
+    DTYPE_MAP = {
+        'float': ('float', 4),
+        'int8': ('int8_t', 1),
+        'uint8': ('uint8_t', 1),
+        'int16': ('int16_t', 2),
+        'int32': ('int32_t', 4)
+    }
+
+    @staticmethod
+    def _tensor_element_count(tensor: Dict[str, Any]) -> int:
+        """Total element count of a tensor."""
+        size = 1
+        for dim in tensor.get('shape', [1]):
+            size *= dim
+        return size
+
+    @staticmethod
+    def _layer_input_elems(layer: Dict[str, Any]) -> int:
+        """Element count a layer reads, 0 if the IR does not say."""
+        layer_type = layer.get('type', '')
+        if layer_type == 'conv2d':
+            return (layer.get('input_height', 1) * layer.get('input_width', 1) *
+                    layer.get('input_channels', 1))
+        if layer_type == 'dense':
+            return layer.get('input_size', 1)
+        return layer.get('size', 0)
+
+    @staticmethod
+    def _layer_output_elems(layer: Dict[str, Any]) -> int:
+        """Element count a layer writes, 0 if the IR does not say."""
+        layer_type = layer.get('type', '')
+        if layer_type == 'conv2d':
+            in_h = layer.get('input_height', 1)
+            in_w = layer.get('input_width', 1)
+            k_h, k_w = layer.get('kernel_size', [3, 3])
+            s_h, s_w = layer.get('stride', [1, 1])
+            p_h, p_w = layer.get('padding', [0, 0])
+            out_h = layer.get('output_height', (in_h + 2 * p_h - k_h) // s_h + 1)
+            out_w = layer.get('output_width', (in_w + 2 * p_w - k_w) // s_w + 1)
+            return out_h * out_w * layer.get('output_channels', 1)
+        if layer_type == 'dense':
+            return layer.get('output_size', 1)
+        return layer.get('size', 0)
+
+    def _is_const_tensor(self, tensor: Dict[str, Any]) -> bool:
+        """Weights/biases are const and belong in flash, not RAM."""
+        if tensor.get('is_const', False):
+            return True
+        return tensor.get('kind', '') in ('weight', 'bias', 'const')
+
+    def _plan_activation_arena(self, tensors: List[Dict[str, Any]]) -> Dict[str, Any]:
+        """
+        Assign overlapping arena offsets to activation tensors.
+
+        Greedy first-fit by descending size: two tensors may share bytes
+        only if their (first_use, last_use) layer ranges do not
+        intersect. Tensors without lifetime info are treated as live for
+        the whole inference, which degrades to non-overlapping layout.
+        """
+        alignment = self.backend_config['alignment']
+        placements = []  # (tensor, offset, byte_size, first_use, last_use)
+
+        ordered = sorted(tensors, key=self._tensor_element_count, reverse=True)
+        for tensor in ordered:
+            dtype = tensor.get('dtype', 'float')
+            elem_size = self.DTYPE_MAP.get(dtype, self.DTYPE_MAP['float'])[1]
+            byte_size = self._tensor_element_count(tensor) * elem_size
+            first_use = tensor.get('first_use', 0)
+            last_use = tensor.get('last_use', 2 ** 31)
+
+            offset = 0
+            while True:
+                offset = (offset + alignment - 1) & ~(alignment - 1)
+                conflict = None
+                for _, p_off, p_size, p_first, p_last in placements:
+                    lifetimes_overlap = first_use <= p_last and p_first <= last_use
+                    bytes_overlap = offset < p_off + p_size and p_off < offset + byte_size
+                    if lifetimes_overlap and bytes_overlap:
+                        conflict = p_off + p_size
+                        break
+                if conflict is None:
+                    break
+                offset = conflict
+
+            placements.append((tensor, offset, byte_size, first_use, last_use))
+
+        arena_size = max((off + size for _, off, size, _, _ in placements), default=0)
+        offsets = {t.get('name', 'unknown'): off for t, off, _, _, _ in placements}
+        return {'size': arena_size, 'offsets': offsets}
+
     def _generate_tensor_declarations(self, graph_ir: Dict[str, Any]) -> str:
-        """Generate static tensor declarations."""
-        declarations = []
-        
-        # Extract tensor info from graph (placeholder implementation)
+        """Generate static tensor declarations.
+
+        Const tensors (weights/biases) are emitted as aligned const
+        arrays with a section attribute so the linker keeps them in
+        flash/XIP instead of copying them to .data. Activations share a
+        single overlap-planned static arena instead of one array per
+        tensor.
+        """
+        alignment = self.backend_config['alignment']
+        flash_section = self.backend_config.get('flash_section', '')
         tensors = graph_ir.get('tensors', [])
-        
-        for tensor in tensors:
+
+        const_tensors = [t for t in tensors if self._is_const_tensor(t)]
+        activations = [t for t in tensors if not self._is_const_tensor(t)]
+
+        declarations = []
+
+        if const_tensors:
+            declarations.append('// Const tensors: flash/XIP resident, never copied to RAM')
+        for tensor in const_tensors:
             name = tensor.get('name', 'unknown')
-            shape = tensor.get('shape', [1])
             dtype = tensor.get('dtype', 'float')
-            
-            # Calculate size
-            size = 1
-            for dim in shape:
-                size *= dim
-                
-            # Map dtype to C++ type
-            cpp_type = {
-                'float': 'float',
-                'int8': 'int8_t',
-                'uint8': 'uint8_t',
-                'int16': 'int16_t',
-                'int32': 'int32_t'
-            }.get(dtype, 'float')
-            
-            declarations.append(f'alignas({self.backend_config["alignment"]}) static {cpp_type} {name}[{size}];')
-        
+            cpp_type = self.DTYPE_MAP.get(dtype, self.DTYPE_MAP['float'])[0]
+            size = self._tensor_element_count(tensor)
+
+            section_attr = f' __attribute__((section("{flash_section}")))' if flash_section else ''
+            data = tensor.get('data')
+            initializer = ' = {' + ', '.join(str(v) for v in data) + '}' if data else ' = {0}'
+            declarations.append(
+                f'alignas({alignment}) static const {cpp_type} {name}[{size}]'
+                f'{section_attr}{initializer};'
+            )
+
+        if activations:
+            plan = self._plan_activation_arena(activations)
+            declarations.append('')
+            declarations.append('// Activations: overlap-planned offsets into one static arena')
+            declarations.append(
+                f'alignas({alignment}) static uint8_t cmx_activation_arena[{plan["size"]}];'
+            )
+            for tensor in activations:
+                name = tensor.get('name', 'unknown')
+                dtype = tensor.get('dtype', 'float')
+                cpp_type = self.DTYPE_MAP.get(dtype, self.DTYPE_MAP['float'])[0]
+                offset = plan['offsets'][name]
+                declarations.append(
+                    f'static {cpp_type}* const {name} = '
+                    f'reinterpret_cast<{cpp_type}*>(cmx_activation_arena + {offset});'
+                )
+
         return '\n'.join(declarations)
     
     def _generate_layer_functions(self, graph_ir: Dict[str, Any]) -> str:
@@ -100,51 +225,212 @@ class CodeGenerator:
         for i, layer in enumerate(layers):
             layer_type = layer.get('type', 'unknown')
             func_name = f'layer_{i}_{layer_type}'
-            
+
             if layer_type == 'conv2d':
                 functions.append(self._generate_conv2d_function(func_name, layer))
             elif layer_type == 'relu':
                 functions.append(self._generate_relu_function(func_name, layer))
             elif layer_type == 'dense':
                 functions.append(self._generate_dense_function(func_name, layer))
+            elif (layer_type in self.LUT_ACTIVATION_TYPES and
+                  self._layer_lut_params(layer) is not None):
+                functions.append(self._generate_lut_activation_function(func_name, layer))
             else:
                 functions.append(self._generate_generic_function(func_name, layer))
-        
+
         return '\n\n'.join(functions)
+
+    # Int8 activations whose quantized transfer function fits a
+    # 256-entry lookup table baked at generation time
+    LUT_ACTIVATION_TYPES = {'sigmoid', 'tanh', 'gelu'}
+
+    @staticmethod
+    def _layer_lut_params(layer: Dict[str, Any]):
+        """Quantization params a LUT needs, or None if the IR lacks them."""
+        keys = ('input_scale', 'input_zero_point',
+                'output_scale', 'output_zero_point')
+        if not all(key in layer for key in keys):
+            return None
+        return (float(layer['input_scale']), int(layer['input_zero_point']),
+                float(layer['output_scale']), int(layer['output_zero_point']))
+
+    @staticmethod
+    def _activation_reference(layer_type: str, x: float) -> float:
+        """Float reference for a LUT-able activation."""
+        if layer_type == 'sigmoid':
+            return 1.0 / (1.0 + math.exp(-x))
+        if layer_type == 'tanh':
+            return math.tanh(x)
+        # GELU, tanh form
+        return 0.5 * x * (1.0 + math.tanh(0.7978845608028654 *
+                                          (x + 0.044715 * x * x * x)))
+
+    def _generate_lut_activation_function(self, name: str, layer: Dict) -> str:
+        """Emit a flash-resident LUT and the byte-lookup loop using it.
+
+        The 256-entry table folds the layer's input and output
+        quantization into the activation, precomputed here so neither
+        the table bytes nor the configure-time math ever touch RAM on
+        the target. Entry i holds the output for input code i - 128.
+        """
+        in_scale, in_zp, out_scale, out_zp = self._layer_lut_params(layer)
+        layer_type = layer.get('type', 'unknown')
+        alignment = self.backend_config['alignment']
+        flash_section = self.backend_config.get('flash_section', '')
+        section_attr = f' __attribute__((section("{flash_section}")))' if flash_section else ''
+
+        table = []
+        for i in range(256):
+            x = in_scale * ((i - 128) - in_zp)
+            y = self._activation_reference(layer_type, x)
+            table.append(max(-128, min(127, int(round(y / out_scale)) + out_zp)))
+
+        rows = [', '.join(str(v) for v in table[r:r + 16]) for r in range(0, 256, 16)]
+        table_body = ',\n    '.join(rows)
+        size = self._layer_output_elems(layer) or layer.get('size', 1)
+
+        return f"""
+// Precomputed {layer_type} LUT for {layer.get('name', layer_type)}:
+// input scale {in_scale}, output scale {out_scale}; flash-resident
+alignas({alignment}) static const int8_t {name}_lut[256]{section_attr} = {{
+    {table_body}
+}};
+
+void {name}(int8_t* data, int size) {{
+    // Quantized {layer_type} as a pure byte lookup
+    (void)size;  // constant-folded below
+    constexpr int SIZE = {size};
+
+    for (int i = 0; i < SIZE; ++i) {{
+        data[i] = {name}_lut[data[i] + 128];
+    }}
+}}"""
     
     def _generate_conv2d_function(self, name: str, layer: Dict) -> str:
         """Generate Conv2D layer function."""
+        if self.specialize:
+            return self._generate_conv2d_specialized(name, layer)
+
         return f"""
 void {name}(const float* input, float* output, const float* weights, const float* bias) {{
     // Conv2D implementation for {layer.get('name', 'conv')}
     // Kernel size: {layer.get('kernel_size', [3, 3])}
     // Stride: {layer.get('stride', [1, 1])}
     // TODO: Implement optimized convolution
-    cmx_conv2d(input, output, weights, bias, 
-               {layer.get('input_channels', 1)}, 
+    cmx_conv2d(input, output, weights, bias,
+               {layer.get('input_channels', 1)},
                {layer.get('output_channels', 1)},
                {layer.get('kernel_size', [3, 3])[0]});
 }}"""
+
+    def _generate_conv2d_specialized(self, name: str, layer: Dict) -> str:
+        """Emit the conv loop nest with every shape constant-folded.
+
+        All bounds are constexpr for this exact layer, so the
+        cross-compiler can fully unroll the kernel loops and pipeline
+        the channel loop; no runtime kernel or dispatcher is involved.
+        NHWC layout, OHWI weights, matching the runtime kernels.
+        """
+        in_h = layer.get('input_height', 1)
+        in_w = layer.get('input_width', 1)
+        in_c = layer.get('input_channels', 1)
+        out_c = layer.get('output_channels', 1)
+        k_h, k_w = layer.get('kernel_size', [3, 3])
+        s_h, s_w = layer.get('stride', [1, 1])
+        p_h, p_w = layer.get('padding', [0, 0])
+        out_h = layer.get('output_height', (in_h + 2 * p_h - k_h) // s_h + 1)
+        out_w = layer.get('output_width', (in_w + 2 * p_w - k_w) // s_w + 1)
+
+        return f"""
+void {name}(const float* input, float* output, const float* weights, const float* bias) {{
+    // Fully specialized conv2d for {layer.get('name', 'conv')}
+    constexpr int IN_H = {in_h}, IN_W = {in_w}, IN_C = {in_c};
+    constexpr int OUT_H = {out_h}, OUT_W = {out_w}, OUT_C = {out_c};
+    constexpr int K_H = {k_h}, K_W = {k_w};
+    constexpr int STRIDE_H = {s_h}, STRIDE_W = {s_w};
+    constexpr int PAD_H = {p_h}, PAD_W = {p_w};
+
+    for (int oy = 0; oy < OUT_H; ++oy) {{
+        for (int ox = 0; ox < OUT_W; ++ox) {{
+            for (int oc = 0; oc < OUT_C; ++oc) {{
+                float acc = bias ? bias[oc] : 0.0f;
+                for (int ky = 0; ky < K_H; ++ky) {{
+                    const int iy = oy * STRIDE_H - PAD_H + ky;
+                    if (iy < 0 || iy >= IN_H) continue;
+                    for (int kx = 0; kx < K_W; ++kx) {{
+                        const int ix = ox * STRIDE_W - PAD_W + kx;
+                        if (ix < 0 || ix >= IN_W) continue;
+                        for (int ic = 0; ic < IN_C; ++ic) {{
+                            acc += input[(iy * IN_W + ix) * IN_C + ic] *
+                                   weights[((oc * K_H + ky) * K_W + kx) * IN_C + ic];
+                        }}
+                    }}
+                }}
+                output[(oy * OUT_W + ox) * OUT_C + oc] = acc;
+            }}
+        }}
+    }}
+}}"""
     
     def _generate_relu_function(self, name: str, layer: Dict) -> str:
         """Generate ReLU activation function."""
+        if self.specialize:
+            return self._generate_relu_specialized(name, layer)
+
         return f"""
 void {name}(float* data, int size) {{
     // ReLU activation for {layer.get('name', 'relu')}
     cmx_relu(data, size);
 }}"""
+
+    def _generate_relu_specialized(self, name: str, layer: Dict) -> str:
+        """Emit the ReLU loop with a constant-folded element count."""
+        size = self._layer_output_elems(layer) or layer.get('size', 1)
+
+        return f"""
+void {name}(float* data, int size) {{
+    // Fully specialized relu for {layer.get('name', 'relu')}
+    (void)size;  // constant-folded below
+    constexpr int SIZE = {size};
+
+    for (int i = 0; i < SIZE; ++i) {{
+        data[i] = data[i] > 0.0f ? data[i] : 0.0f;
+    }}
+}}"""
     
     def _generate_dense_function(self, name: str, layer: Dict) -> str:
         """Generate Dense/Linear layer function."""
+        if self.specialize:
+            return self._generate_dense_specialized(name, layer)
+
         return f"""
 void {name}(const float* input, float* output, const float* weights, const float* bias) {{
     // Dense layer for {layer.get('name', 'dense')}
     // Input size: {layer.get('input_size', 1)}
     // Output size: {layer.get('output_size', 1)}
     cmx_dense(input, output, weights, bias, 
-              {layer.get('input_size', 1)}, 
+              {layer.get('input_size', 1)},
               {layer.get('output_size', 1)});
 }}"""
+
+    def _generate_dense_specialized(self, name: str, layer: Dict) -> str:
+        """Emit the dense matmul with constant-folded dimensions."""
+        in_size = layer.get('input_size', 1)
+        out_size = layer.get('output_size', 1)
+
+        return f"""
+void {name}(const float* input, float* output, const float* weights, const float* bias) {{
+    // Fully specialized dense for {layer.get('name', 'dense')}
+    constexpr int IN_SIZE = {in_size}, OUT_SIZE = {out_size};
+
+    for (int i = 0; i < OUT_SIZE; ++i) {{
+        float acc = bias ? bias[i] : 0.0f;
+        for (int j = 0; j < IN_SIZE; ++j) {{
+            acc += input[j] * weights[i * IN_SIZE + j];
+        }}
+        output[i] = acc;
+    }}
+}}"""
     
     def _generate_generic_function(self, name: str, layer: Dict) -> str:
         """Generate generic layer function."""
@@ -177,6 +463,139 @@ void {name}(const float* input, float* output) {{
         
         return '\n'.join(loop_body)
     
+    def _generate_standalone_entry(self, graph_ir: Dict[str, Any]) -> str:
+        """Generate the standalone entry function.
+
+        The signature mirrors cmx_execute_model(handle, inputs,
+        outputs) minus the model handle: the graph is compiled into
+        the translation unit, so there is nothing to load or look up.
+        Activations ping-pong between the two static buffers; the
+        first layer reads the caller's input in place and the last
+        producing layer writes the caller's output directly.
+        """
+        model_name = graph_ir.get('name', 'model')
+        layers = graph_ir.get('layers', [])
+        const_names = {t.get('name') for t in graph_ir.get('tensors', [])
+                       if self._is_const_tensor(t)}
+
+        def other_buf(buf: str) -> str:
+            return 'cmx_act_pong' if buf == 'cmx_act_ping' else 'cmx_act_ping'
+
+        lines = [
+            '// Entry point. Same calling convention as cmx_execute_model(handle,',
+            '// inputs, outputs) minus the handle; returns 0 on success.',
+            f'extern "C" int {model_name}_execute(void** inputs, void** outputs) {{',
+            '    if (inputs == nullptr || outputs == nullptr ||',
+            '        inputs[0] == nullptr || outputs[0] == nullptr) {',
+            '        return -1;',
+            '    }',
+            '',
+            '    const float* model_input = static_cast<const float*>(inputs[0]);',
+            '    float* model_output = static_cast<float*>(outputs[0]);',
+            '',
+        ]
+
+        current = 'model_input'
+        for i, layer in enumerate(layers):
+            layer_type = layer.get('type', 'unknown')
+            func_name = f'layer_{i}_{layer_type}'
+            last = (i == len(layers) - 1)
+
+            if layer_type == 'relu':
+                if current == 'model_input':
+                    # In-place activation as the first layer: stage the
+                    # caller's buffer instead of writing through it
+                    lines.append('    std::memcpy(cmx_act_ping, model_input, '
+                                 'CMX_INPUT_ELEMS * sizeof(float));')
+                    current = 'cmx_act_ping'
+                size = self._layer_output_elems(layer) or 'CMX_ACT_MAX_ELEMS'
+                lines.append(f'    {func_name}({current}, {size});')
+            else:
+                dst = 'model_output' if last else other_buf(current)
+                if layer_type in ('conv2d', 'dense'):
+                    weights = f'weights_{i}' if f'weights_{i}' in const_names else 'nullptr'
+                    bias = f'bias_{i}' if f'bias_{i}' in const_names else 'nullptr'
+                    lines.append(f'    {func_name}({current}, {dst}, {weights}, {bias});')
+                else:
+                    lines.append(f'    {func_name}({current}, {dst});')
+                current = dst
+
+        if current != 'model_output':
+            lines.append('    std::memcpy(model_output, ' + current + ', '
+                         'CMX_OUTPUT_ELEMS * sizeof(float));')
+
+        lines.append('    return 0;')
+        lines.append('}')
+        return '\n'.join(lines)
+
+    def generate_standalone(self, graph_ir: Dict[str, Any]) -> str:
+        """Generate one self-contained C++ translation unit.
+
+        No template and no runtime: const tensors are baked into
+        flash-resident arrays, every layer is a constant-folded loop
+        nest, inter-layer activations ping-pong between two static
+        buffers, and the only exported symbol is {model}_execute. The
+        registry, dispatcher and serializer are never referenced, so
+        the linker drops all of them from the firmware.
+        """
+        model_name = graph_ir.get('name', 'model')
+        alignment = self.backend_config['alignment']
+        layers = graph_ir.get('layers', [])
+        tensors = graph_ir.get('tensors', [])
+        const_tensors = [t for t in tensors if self._is_const_tensor(t)]
+
+        # Buffer geometry: the ping-pong buffers must hold the largest
+        # inter-layer activation, sized from whichever of the tensor
+        # list and the layer shapes carries the information
+        act_elems = [self._tensor_element_count(t) for t in tensors
+                     if not self._is_const_tensor(t)]
+        act_elems += [self._layer_output_elems(layer) for layer in layers]
+        max_act = max([e for e in act_elems if e] or [1])
+        in_elems = next((self._layer_input_elems(layer) for layer in layers
+                         if self._layer_input_elems(layer)), max_act)
+        out_elems = next((self._layer_output_elems(layer) for layer in reversed(layers)
+                          if self._layer_output_elems(layer)), max_act)
+
+        sections = [
+            f"""/*
+ * Standalone inference translation unit for {model_name}
+ * Target: {self.target}
+ * Generated by cmx_tools - do not edit
+ *
+ * Self-contained: no runtime, registry, dispatcher or serializer.
+ * Compile this one file and call {model_name}_execute().
+ */""",
+            '#include <cstdint>\n#include <cstring>',
+            f"""// Buffer geometry, constant-folded from the graph
+constexpr int CMX_INPUT_ELEMS = {in_elems};
+constexpr int CMX_OUTPUT_ELEMS = {out_elems};
+constexpr int CMX_ACT_MAX_ELEMS = {max_act};""",
+        ]
+
+        const_decls = self._generate_tensor_declarations({'tensors': const_tensors})
+        if const_decls:
+            sections.append(const_decls)
+
+        entry = self._generate_standalone_entry(graph_ir)
+
+        # Only declare the buffers the chain actually touches (a chain
+        # of in-place activations may never reach the pong buffer)
+        buffers = [name for name in ('cmx_act_ping', 'cmx_act_pong')
+                   if name in entry]
+        if buffers:
+            sections.append(
+                '// Inter-layer activations ping-pong between static buffers;\n'
+                '// a layer reads one and writes the other, so two maxima are\n'
+                '// enough for any straight-line chain\n' +
+                '\n'.join(f'alignas({alignment}) static float {name}[CMX_ACT_MAX_ELEMS];'
+                          for name in buffers)
+            )
+
+        sections.append(self._generate_layer_functions(graph_ir))
+        sections.append(entry)
+
+        return '\n\n'.join(sections) + '\n'
+
     def generate(self, graph_ir: Dict[str, Any]) -> str:
         """Generate complete C++ code from graph IR."""
         template_content = self._load_template()
@@ -203,24 +622,27 @@ void {name}(const float* input, float* output) {{
         return generated_code
 
 
-def generate_code(graph_ir: Dict[str, Any], target: str, output_dir: str = './output') -> str:
+def generate_code(graph_ir: Dict[str, Any], target: str, output_dir: str = './output',
+                  specialize: bool = False) -> str:
     """
     Generate C++ code from optimized graph IR.
-    
+
     Args:
         graph_ir: Optimized and quantized graph representation
         target: Target backend name
         output_dir: Directory to save generated code
-        
+        specialize: Emit constant-folded per-layer loop nests instead
+            of calls into the generic runtime kernels
+
     Returns:
         str: Path to generated C++ file
     """
-    
+
     # Create output directory
     os.makedirs(output_dir, exist_ok=True)
-    
+
     # Generate code
-    generator = CodeGenerator(target)
+    generator = CodeGenerator(target, specialize=specialize)
     cpp_code = generator.generate(graph_ir)
     
     # Write to file
@@ -240,6 +662,73 @@ def generate_code(graph_ir: Dict[str, Any], target: str, output_dir: str = './ou
     return output_path
 
 
+def generate_standalone_binary(graph_ir: Dict[str, Any], target: str = 'generic',
+                               output_dir: str = './output') -> str:
+    """
+    Generate a single self-contained C++ translation unit for a model.
+
+    Unlike generate_code(), the output has zero dependence on the
+    runtime: specialized loop nests instead of kernel calls, weights
+    baked into flash arrays, static activation buffers, and one
+    extern "C" entry point matching cmx_execute_model's calling
+    convention (minus the handle). Intended for the smallest parts,
+    where the interpreter's flash footprint and model load time are
+    not affordable. Pairs with export.cmx_exporter.export_standalone.
+
+    Args:
+        graph_ir: Graph IR with shape attributes on every layer and
+            const tensor data baked in
+        target: Target backend name (sets alignment/flash section)
+        output_dir: Directory to save the generated .cpp/.h pair
+
+    Returns:
+        str: Path to generated C++ file
+    """
+
+    os.makedirs(output_dir, exist_ok=True)
+
+    generator = CodeGenerator(target, standalone=True)
+    cpp_code = generator.generate_standalone(graph_ir)
+
+    model_name = graph_ir.get('name', 'model')
+    output_path = os.path.join(output_dir, f"{model_name}_{target}_standalone.cpp")
+    with open(output_path, 'w') as f:
+        f.write(cpp_code)
+
+    header_path = output_path.replace('.cpp', '.h')
+    with open(header_path, 'w') as f:
+        f.write(generate_standalone_header(graph_ir, target))
+
+    return output_path
+
+
+def generate_standalone_header(graph_ir: Dict[str, Any], target: str) -> str:
+    """Generate the header for a standalone translation unit."""
+    model_name = graph_ir.get('name', 'model')
+    guard_name = f"{model_name.upper()}_{target.upper().replace('-', '_')}_STANDALONE_H"
+
+    header = f"""#ifndef {guard_name}
+#define {guard_name}
+
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+// Runs one inference. inputs[0] and outputs[0] are the model's input
+// and output buffers; the signature matches cmx_execute_model() minus
+// the model handle. Returns 0 on success, -1 on null arguments.
+int {model_name}_execute(void** inputs, void** outputs);
+
+#ifdef __cplusplus
+}}
+#endif
+
+#endif // {guard_name}
+"""
+
+    return header
+
+
 def generate_header(graph_ir: Dict[str, Any], target: str) -> str:
     """Generate accompanying header file."""
     model_name = graph_ir.get('name', 'model')
@@ -0,0 +1,276 @@
+"""
+memory_planner.py - Export-time arena planning
+
+Computes tensor lifetimes and arena offsets offline, where the packing
+can afford to be smarter than the runtime's execution-order first-fit,
+and emits the result in two forms: the serialized plan section the
+runtime's graph serializer already reads (CMXSerializedPlanHeader plus
+placement records), and a generated C header for AOT builds.
+"""
+
+import struct
+from typing import Dict, Any, List, Optional, Tuple
+
+from .optimization_passes import OptimizationPass
+
+
+# Bytes per element, mirroring code_generator.DTYPE_MAP
+_DTYPE_SIZES = {
+    'float': 4, 'float32': 4,
+    'int8': 1, 'uint8': 1,
+    'int16': 2, 'int32': 4
+}
+
+
+def _tensor_size_bytes(tensor: Dict[str, Any], alignment: int) -> int:
+    """Alignment-padded byte size of a tensor from its shape and dtype"""
+    elements = 1
+    for dim in tensor.get('shape', []) or [0]:
+        elements *= max(int(dim), 1)
+    elem_size = _DTYPE_SIZES.get(tensor.get('dtype', 'float'), 4)
+    size = elements * elem_size
+    return (size + alignment - 1) & ~(alignment - 1)
+
+
+def _is_const_tensor(tensor: Dict[str, Any]) -> bool:
+    """Weights and other constants live in flash, not in the arena"""
+    if tensor.get('is_const'):
+        return True
+    return tensor.get('kind') in ('weight', 'bias', 'const')
+
+
+def compute_lifetimes(layers: List[Dict[str, Any]],
+                      output_names: Optional[List[str]] = None) -> Dict[str, Tuple[int, int]]:
+    """
+    Compute (first_use, last_use) step indices for every tensor name.
+
+    A tensor is born at the step of its producing layer and dies after
+    the step of its last consumer. Graph outputs are pinned to the last
+    step so results stay readable after execution finishes.
+
+    Args:
+        layers: Layer list in execution order
+        output_names: Names of graph output tensors
+
+    Returns:
+        Dict mapping tensor name to (first_use, last_use)
+    """
+    lifetimes: Dict[str, Tuple[int, int]] = {}
+
+    for step, layer in enumerate(layers):
+        outputs = layer.get('outputs', [layer.get('name', f'layer_{step}')])
+        for name in outputs:
+            if name not in lifetimes:
+                lifetimes[name] = (step, step)
+        for name in layer.get('inputs', []):
+            if name in lifetimes:
+                lifetimes[name] = (lifetimes[name][0], step)
+
+    last_step = max(len(layers) - 1, 0)
+    for name in output_names or []:
+        if name in lifetimes:
+            lifetimes[name] = (lifetimes[name][0], last_step)
+
+    return lifetimes
+
+
+def plan_arena(graph: Dict[str, Any], alignment: int = 16) -> Dict[str, Any]:
+    """
+    Pack the graph's activation tensors into a single static arena.
+
+    Lifetimes come from compute_lifetimes; placement is first-fit over
+    tensors sorted by descending size, which for the interval graphs
+    real models produce is at or near the optimal coloring. The runtime
+    planner places in execution order instead (it cannot afford the
+    sort plus full-overlap scan per tensor), which is what the offline
+    pass's 10-20% arena saving comes from.
+
+    Args:
+        graph: Graph IR with 'layers' and 'tensors'
+        alignment: Byte alignment for every placement (power of two)
+
+    Returns:
+        Plan dict with 'arena_size', 'alignment', 'steps' (layer names
+        in execution order) and 'placements' (tensor name ->
+        offset/size/first_use/last_use/tensor_id). Tensor IDs follow
+        the tensor-list order the exporter serializes with, so the plan
+        section and the weight records agree on numbering.
+    """
+    layers = graph.get('layers', [])
+    tensors = graph.get('tensors', [])
+    output_names = [out.get('name') if isinstance(out, dict) else out
+                    for out in graph.get('outputs', [])]
+
+    lifetimes = compute_lifetimes(layers, output_names)
+
+    # Tensors fused layers keep tile-resident (e.g. the depthwise
+    # intermediate of a fused depthwise-separable block) never hit the
+    # arena at all
+    elided = set()
+    for layer in layers:
+        elided.update(layer.get('elided_tensors', []))
+
+    candidates = []
+    for tensor_id, tensor in enumerate(tensors):
+        name = tensor.get('name')
+        if _is_const_tensor(tensor) or name not in lifetimes or name in elided:
+            continue
+        candidates.append({
+            'name': name,
+            'tensor_id': tensor_id,
+            'size': _tensor_size_bytes(tensor, alignment),
+            'first_use': lifetimes[name][0],
+            'last_use': lifetimes[name][1]
+        })
+
+    # Size-descending keeps the packing near-optimal; first-use breaks
+    # the ties so same-size buffers (one lifetime class - the common
+    # case for repeated blocks) land at ascending offsets in execution
+    # order, making the plan walk a sequential sweep of the arena
+    # instead of following file order around it
+    candidates.sort(key=lambda c: (-c['size'], c['first_use']))
+
+    placements: Dict[str, Dict[str, Any]] = {}
+    arena_size = 0
+    for cand in candidates:
+        # Placements whose lifetime overlaps this tensor's constrain
+        # where it may sit; scan the gaps between them, lowest first
+        live = sorted(
+            (p for p in placements.values()
+             if p['first_use'] <= cand['last_use'] and
+             p['last_use'] >= cand['first_use']),
+            key=lambda p: p['offset'])
+
+        offset = 0
+        for other in live:
+            if offset + cand['size'] <= other['offset']:
+                break
+            offset = max(offset, other['offset'] + other['size'])
+
+        cand['offset'] = offset
+        placements[cand['name']] = cand
+        arena_size = max(arena_size, offset + cand['size'])
+
+    return {
+        'arena_size': arena_size,
+        'alignment': alignment,
+        'steps': [layer.get('name', f'layer_{i}') for i, layer in enumerate(layers)],
+        'placements': placements
+    }
+
+
+def serialize_plan(plan: Dict[str, Any],
+                   kernel_choices: Dict[int, str] = None) -> bytes:
+    """
+    Serialize a plan into the runtime's persisted-plan section format.
+
+    Layout matches CMXSerializedPlanHeader in cmx_graph_serializer.hpp:
+    four uint32 header fields (step_count, placement_count, arena_size,
+    arena_alignment), then step_count uint32 node IDs in execution
+    order, then one 5-uint32 placement record (tensor_id, offset, size,
+    first_use, last_use) per tensor - all little-endian. When
+    kernel_choices is given (node id -> measured-best kernel name, from
+    autotune_capture.parse_kernel_log), one 32-byte kernel-choice
+    record per node follows the placements, matching
+    CMXSerializedKernelChoice; the runtime treats the records as an
+    optional section trailer, so plans without them stay loadable.
+
+    Returns:
+        Plan section bytes ready to embed in the model file
+    """
+    placements = plan['placements']
+    steps = plan.get('steps', [])
+
+    out = bytearray()
+    out += struct.pack('<4I', len(steps), len(placements),
+                       plan['arena_size'], plan['alignment'])
+    for step_id in range(len(steps)):
+        out += struct.pack('<I', step_id)
+    for placement in sorted(placements.values(), key=lambda p: p['tensor_id']):
+        out += struct.pack('<5I', placement['tensor_id'], placement['offset'],
+                           placement['size'], placement['first_use'],
+                           placement['last_use'])
+    if kernel_choices:
+        for node_id in sorted(kernel_choices):
+            # 28-byte NUL-padded name field; struct.pack truncates/pads
+            out += struct.pack('<I28s', node_id,
+                               kernel_choices[node_id].encode()[:27])
+    return bytes(out)
+
+
+def generate_plan_header(plan: Dict[str, Any],
+                         arena_name: str = 'cmx_activation_arena') -> str:
+    """
+    Generate a C++ header with the planned arena for AOT builds.
+
+    The header declares the arena, one offset constant per tensor, and
+    a placement table, so generated inference code (or hand-written
+    glue) resolves every activation to arena + offset with no runtime
+    planning at all.
+
+    Returns:
+        Header source text
+    """
+    lines = [
+        '#pragma once',
+        '',
+        '// Generated by memory_planner.py - do not edit.',
+        '// Arena offsets were planned at export time; regenerate when',
+        '// the graph or tensor shapes change.',
+        '',
+        '#include <cstddef>',
+        '#include <cstdint>',
+        '',
+        f'#define CMX_PLANNED_ARENA_SIZE {plan["arena_size"]}',
+        f'#define CMX_PLANNED_ARENA_ALIGNMENT {plan["alignment"]}',
+        '',
+        f'alignas(CMX_PLANNED_ARENA_ALIGNMENT) '
+        f'static uint8_t {arena_name}[CMX_PLANNED_ARENA_SIZE];',
+        ''
+    ]
+
+    ordered = sorted(plan['placements'].values(), key=lambda p: p['tensor_id'])
+    for placement in ordered:
+        macro = placement['name'].upper().replace('/', '_').replace('.', '_')
+        lines.append(f'#define CMX_OFFSET_{macro} {placement["offset"]}')
+
+    lines += [
+        '',
+        'struct CmxPlannedPlacement {',
+        '    uint32_t tensor_id;',
+        '    uint32_t offset;',
+        '    uint32_t size;',
+        '};',
+        '',
+        'static const CmxPlannedPlacement cmx_planned_placements[] = {'
+    ]
+    for placement in ordered:
+        lines.append(f'    {{{placement["tensor_id"]}, {placement["offset"]}, '
+                     f'{placement["size"]}}},  // {placement["name"]}')
+    lines += [
+        '};',
+        '',
+        f'static const size_t cmx_planned_placement_count = {len(ordered)};',
+        ''
+    ]
+    return '\n'.join(lines)
+
+
+class MemoryPlanningPass(OptimizationPass):
+    """Attach an offline arena plan to the graph for export."""
+
+    def __init__(self, alignment: int = 16):
+        super().__init__("memory_planning")
+        self.alignment = alignment
+
+    def apply(self, graph: Dict[str, Any]) -> Dict[str, Any]:
+        """Plan the arena and store the result under 'memory_plan'."""
+        plan = plan_arena(graph, alignment=self.alignment)
+        graph['memory_plan'] = plan
+        print(f"Memory planning: {len(plan['placements'])} placements, "
+              f"arena {plan['arena_size']} bytes")
+        return graph
+
+    def can_apply(self, graph: Dict[str, Any]) -> bool:
+        """Planning needs layers and tensor shapes to work with."""
+        return bool(graph.get('layers')) and bool(graph.get('tensors'))
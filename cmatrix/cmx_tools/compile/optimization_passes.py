@@ -96,6 +96,16 @@ class LayerFusionPass(OptimizationPass):
                 layers[i] = fused_layer
                 layers.pop(i + 1)  # Remove the BatchNorm layer
                 fused_count += 1
+            elif self._can_fuse_dw_pw(current_layer, next_layer):
+                fused_layer = self._fuse_dw_pw(current_layer, next_layer)
+                layers[i] = fused_layer
+                layers.pop(i + 1)  # Remove the pointwise layer
+                fused_count += 1
+            elif self._can_fuse_conv_pool(current_layer, next_layer):
+                fused_layer = self._fuse_conv_pool(current_layer, next_layer)
+                layers[i] = fused_layer
+                layers.pop(i + 1)  # Remove the pooling layer
+                fused_count += 1
             else:
                 i += 1
                 
@@ -120,6 +130,101 @@ class LayerFusionPass(OptimizationPass):
         fused_layer['fused'] = True
         return fused_layer
     
+    def _can_fuse_dw_pw(self, dw_layer: Dict, pw_layer: Dict) -> bool:
+        """Check if depthwise conv + 1x1 pointwise conv can be fused."""
+        if dw_layer.get('type') != 'depthwise_conv2d':
+            return False
+        if pw_layer.get('type') != 'conv2d':
+            return False
+        kernel = pw_layer.get('kernel_shape', pw_layer.get('kernel_size', [1, 1]))
+        if list(kernel) != [1, 1]:
+            return False
+        # Only fuse when the pointwise consumes the depthwise output
+        # alone; a branch off the intermediate forces materialization
+        pw_inputs = pw_layer.get('inputs', [])
+        dw_outputs = dw_layer.get('outputs', [dw_layer.get('name')])
+        if pw_inputs and pw_inputs != dw_outputs:
+            return False
+        return True
+
+    def _fuse_dw_pw(self, dw_layer: Dict, pw_layer: Dict) -> Dict:
+        """
+        Fuse a depthwise-separable pair into a single emitted block.
+
+        The fused block runs the depthwise stage a few output rows at a
+        time into a small rotating tile and feeds the pointwise stage
+        from there, so the full depthwise output - usually the largest
+        activation in a MobileNet-style network - is never written out.
+        tile_rows covers the pointwise's row consumption (1 for a 1x1
+        kernel, plus depthwise halo rows when stride > 1).
+        """
+        fused_layer = {
+            'type': 'depthwise_separable',
+            'name': f"{dw_layer.get('name', 'dw')}_pw_fused",
+            'inputs': dw_layer.get('inputs', []),
+            'outputs': pw_layer.get('outputs', [pw_layer.get('name')]),
+            'depthwise': copy.deepcopy(dw_layer),
+            'pointwise': copy.deepcopy(pw_layer),
+            'tile_rows': max(dw_layer.get('stride', [1, 1])[0]
+                             if isinstance(dw_layer.get('stride'), list)
+                             else dw_layer.get('stride', 1), 1),
+            'fused': True
+        }
+        # The intermediate tensor is now tile-resident; record its name
+        # so memory planning drops it from the arena
+        intermediate = dw_layer.get('outputs', [dw_layer.get('name')])
+        fused_layer['elided_tensors'] = intermediate
+        return fused_layer
+
+    def _can_fuse_conv_pool(self, conv_layer: Dict, pool_layer: Dict) -> bool:
+        """Check if Conv2D + 2x2/stride-2 MaxPool can be fused."""
+        if conv_layer.get('type') != 'conv2d':
+            return False
+        if pool_layer.get('type') not in ('maxpool2d', 'max_pool2d'):
+            return False
+        kernel = pool_layer.get('kernel_shape', pool_layer.get('pool_size', [2, 2]))
+        stride = pool_layer.get('strides', pool_layer.get('stride', kernel))
+        if not isinstance(stride, list):
+            stride = [stride, stride]
+        if list(kernel) != [2, 2] or list(stride) != [2, 2]:
+            return False
+        # Only fuse when the pool consumes the conv output alone; a
+        # branch off the intermediate forces materialization
+        pool_inputs = pool_layer.get('inputs', [])
+        conv_outputs = conv_layer.get('outputs', [conv_layer.get('name')])
+        if pool_inputs and pool_inputs != conv_outputs:
+            return False
+        return True
+
+    def _fuse_conv_pool(self, conv_layer: Dict, pool_layer: Dict) -> Dict:
+        """
+        Fuse a conv + 2x2/stride-2 maxpool into a single emitted block.
+
+        The pool discards three quarters of the conv's outputs, so the
+        fused block walks the pool-surviving grid, computes each 2x2
+        conv window and reduces it in registers before the single
+        store - a quarter of the conv stores, no separate pool pass,
+        and the intermediate tensor (the full-resolution conv output,
+        the largest activation in a downsampling stage) never exists.
+        Max commutes with the conv's fused activation when one is
+        present (all our fused activations are monotonic), so the
+        result is exact.
+        """
+        fused_layer = {
+            'type': 'conv2d_maxpool',
+            'name': f"{conv_layer.get('name', 'conv')}_pool_fused",
+            'inputs': conv_layer.get('inputs', []),
+            'outputs': pool_layer.get('outputs', [pool_layer.get('name')]),
+            'conv': copy.deepcopy(conv_layer),
+            'pool': copy.deepcopy(pool_layer),
+            'fused': True
+        }
+        # The full-resolution conv output is now register-resident;
+        # record it so memory planning drops it from the arena
+        intermediate = conv_layer.get('outputs', [conv_layer.get('name')])
+        fused_layer['elided_tensors'] = intermediate
+        return fused_layer
+
     def _fuse_conv_bn(self, conv_layer: Dict, bn_layer: Dict) -> Dict:
         """Fuse Conv2D + BatchNorm by folding BN into Conv weights."""
         fused_layer = copy.deepcopy(conv_layer)
@@ -68,36 +68,122 @@ class Quantizer:
         return dtype_map.get(self.dtype, np.int8)
 
 
+def select_abs_threshold(tensor: np.ndarray, method: str = 'minmax',
+                         percentile: float = 99.99) -> float:
+    """
+    Choose the |x| clip threshold for a symmetric range.
+
+    'minmax' reproduces the old behaviour; 'percentile' drops the tail
+    above the given percentile; 'kl' runs a saturation-minimizing
+    search over candidate thresholds and keeps the one whose clipped,
+    quantized distribution stays closest (KL divergence) to the float
+    distribution.
+    """
+    abs_vals = np.abs(np.asarray(tensor, dtype=np.float64)).ravel()
+    max_val = float(np.max(abs_vals)) if abs_vals.size else 0.0
+    if max_val == 0.0 or method == 'minmax':
+        return max_val
+    if method == 'percentile':
+        return float(np.percentile(abs_vals, percentile))
+    if method == 'kl':
+        return _kl_threshold(abs_vals)
+    raise ValueError(f"Unknown calibration method '{method}'")
+
+
+def _kl_threshold(abs_vals: np.ndarray, bins: int = 2048,
+                  target_bins: int = 128) -> float:
+    """
+    KL-divergence threshold search over a histogram of |x|.
+
+    For each candidate threshold (histogram prefix), outliers are
+    folded into the last kept bin, the kept distribution is requantized
+    to target_bins levels, and the candidate with the smallest KL
+    divergence against the original wins. Small inputs fall back to the
+    plain maximum.
+    """
+    if abs_vals.size < target_bins:
+        return float(np.max(abs_vals))
+
+    hist, edges = np.histogram(abs_vals, bins=bins)
+    hist = hist.astype(np.float64)
+
+    best_kl = float('inf')
+    best_edge = edges[-1]
+
+    for i in range(target_bins, bins + 1, 16):
+        ref = hist[:i].copy()
+        ref[-1] += hist[i:].sum()  # fold clipped outliers into last bin
+        if ref.sum() == 0:
+            continue
+
+        # Requantize the kept range down to target_bins levels
+        quantized = np.zeros_like(ref)
+        for chunk in np.array_split(np.arange(i), target_bins):
+            counts = ref[chunk]
+            nonzero = counts > 0
+            if nonzero.any():
+                quantized[chunk[nonzero]] = counts[nonzero].sum() / nonzero.sum()
+
+        p = ref / ref.sum()
+        q = quantized / quantized.sum()
+        mask = (p > 0) & (q > 0)
+        kl = float(np.sum(p[mask] * np.log(p[mask] / q[mask])))
+
+        if kl < best_kl:
+            best_kl = kl
+            best_edge = edges[i]
+
+    return float(best_edge)
+
+
 class SymmetricQuantizer(Quantizer):
     """Symmetric quantization (zero_point = 0)."""
-    
-    def compute_scale_zero_point(self, tensor: np.ndarray) -> Tuple[float, int]:
-        """Compute scale and zero point for symmetric quantization."""
+
+    def compute_scale_zero_point(self, tensor: np.ndarray,
+                                 method: str = 'minmax') -> Tuple[float, int]:
+        """Compute scale and zero point for symmetric quantization.
+
+        Args:
+            tensor: Values to derive the range from
+            method: Range selection - 'minmax' uses max |x|,
+                'percentile' clips outliers at the 99.99th percentile,
+                'kl' searches for the clip threshold minimizing KL
+                divergence between the float and quantized distributions
+        """
         qmin, qmax = self.get_quantization_range()
-        
+
         # For symmetric quantization, zero point is always 0
         zero_point = 0
-        
-        # Scale based on maximum absolute value
-        max_val = np.max(np.abs(tensor))
+
+        max_val = select_abs_threshold(tensor, method)
         if max_val == 0:
             scale = 1.0
         else:
             scale = max_val / max(abs(qmin), abs(qmax))
-        
+
         return scale, zero_point
 
 
 class AsymmetricQuantizer(Quantizer):
     """Asymmetric quantization (zero_point != 0)."""
-    
-    def compute_scale_zero_point(self, tensor: np.ndarray) -> Tuple[float, int]:
-        """Compute scale and zero point for asymmetric quantization."""
+
+    def compute_scale_zero_point(self, tensor: np.ndarray,
+                                 method: str = 'minmax') -> Tuple[float, int]:
+        """Compute scale and zero point for asymmetric quantization.
+
+        'percentile' (and 'kl', which degrades to percentile for
+        asymmetric ranges) clips both tails so a handful of outliers
+        does not stretch the range.
+        """
         qmin, qmax = self.get_quantization_range()
-        
-        min_val = np.min(tensor)
-        max_val = np.max(tensor)
-        
+
+        if method in ('percentile', 'kl'):
+            min_val = float(np.percentile(tensor, 0.01))
+            max_val = float(np.percentile(tensor, 99.99))
+        else:
+            min_val = np.min(tensor)
+            max_val = np.max(tensor)
+
         if min_val == max_val:
             scale = 1.0
             zero_point = qmin
@@ -115,29 +201,32 @@ class AsymmetricQuantizer(Quantizer):
 class PerChannelQuantizer:
     """Per-channel quantization for weights."""
     
-    def __init__(self, base_quantizer: Quantizer, axis: int = 0):
+    def __init__(self, base_quantizer: Quantizer, axis: int = 0,
+                 method: str = 'minmax'):
         self.base_quantizer = base_quantizer
         self.axis = axis
-    
+        self.method = method
+
     def compute_scales_zero_points(self, tensor: np.ndarray) -> Tuple[np.ndarray, np.ndarray]:
         """Compute per-channel scales and zero points."""
         num_channels = tensor.shape[self.axis]
         scales = np.zeros(num_channels)
         zero_points = np.zeros(num_channels, dtype=int)
-        
+
         for i in range(num_channels):
             # Extract channel data
             channel_slice = [slice(None)] * tensor.ndim
             channel_slice[self.axis] = i
             channel_data = tensor[tuple(channel_slice)]
-            
+
             # Compute scale and zero point for this channel
-            scale, zero_point = self.base_quantizer.compute_scale_zero_point(channel_data)
+            scale, zero_point = self.base_quantizer.compute_scale_zero_point(
+                channel_data, method=self.method)
             scales[i] = scale
             zero_points[i] = zero_point
-        
+
         return scales, zero_points
-    
+
     def quantize_tensor(self, tensor: np.ndarray) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
         """Quantize tensor per-channel."""
         scales, zero_points = self.compute_scales_zero_points(tensor)
@@ -158,6 +247,70 @@ class PerChannelQuantizer:
         return quantized, scales, zero_points
 
 
+class WeightClusterer:
+    """K-means weight clustering into a small per-layer codebook.
+
+    Learns a palette (16 entries by default, matching PALETTE_SIZE in
+    the runtime) over all values of one weight tensor and replaces each
+    weight with its nearest codebook index. The serializer packs the
+    indices two per byte; the runtime expands them through the palette
+    in registers, so flash cost drops to ~4 bits/weight plus 64 bytes
+    of codebook per layer.
+    """
+
+    def __init__(self, palette_size: int = 16, max_iterations: int = 50):
+        self.palette_size = palette_size
+        self.max_iterations = max_iterations
+
+    def fit(self, tensor: np.ndarray) -> np.ndarray:
+        """Learn the codebook for one weight tensor (Lloyd's algorithm).
+
+        Centroids are seeded at evenly spaced quantiles so the initial
+        palette already tracks the weight distribution; empty clusters
+        keep their previous centroid.
+        """
+        values = np.asarray(tensor, dtype=np.float32).ravel()
+        if values.size == 0:
+            return np.zeros(self.palette_size, dtype=np.float32)
+
+        quantiles = np.linspace(0.0, 100.0, self.palette_size)
+        palette = np.percentile(values, quantiles).astype(np.float32)
+
+        for _ in range(self.max_iterations):
+            assignments = np.argmin(
+                np.abs(values[:, None] - palette[None, :]), axis=1)
+            updated = palette.copy()
+            for k in range(self.palette_size):
+                members = values[assignments == k]
+                if members.size:
+                    updated[k] = members.mean()
+            if np.allclose(updated, palette):
+                break
+            palette = updated
+
+        return np.sort(palette)
+
+    def cluster_tensor(self, tensor: np.ndarray) -> Tuple[np.ndarray, np.ndarray]:
+        """Cluster one weight tensor.
+
+        Returns (indices, palette): indices has the tensor's shape with
+        one palette index per weight, palette is the sorted codebook.
+        """
+        tensor = np.asarray(tensor, dtype=np.float32)
+        palette = self.fit(tensor)
+        indices = np.argmin(
+            np.abs(tensor.ravel()[:, None] - palette[None, :]),
+            axis=1).astype(np.uint8)
+        return indices.reshape(tensor.shape), palette
+
+    def clustering_error(self, tensor: np.ndarray,
+                         indices: np.ndarray, palette: np.ndarray) -> float:
+        """RMS reconstruction error of a clustering, for accuracy gating."""
+        reconstructed = palette[indices]
+        diff = np.asarray(tensor, dtype=np.float32) - reconstructed
+        return float(np.sqrt(np.mean(diff * diff))) if diff.size else 0.0
+
+
 class CalibrationDataset:
     """Dataset for quantization calibration."""
     
@@ -178,10 +331,13 @@ class CalibrationDataset:
 class QuantizationEngine:
     """Main quantization engine."""
     
-    def __init__(self, mode: str = 'int8', symmetric: bool = True):
+    def __init__(self, mode: str = 'int8', symmetric: bool = True,
+                 calibration: str = 'minmax'):
         self.mode = mode
         self.symmetric = symmetric
-        
+        # Range selection for scales: 'minmax', 'percentile' or 'kl'
+        self.calibration = calibration
+
         # Create base quantizer
         if symmetric:
             self.weight_quantizer = SymmetricQuantizer(mode)
@@ -217,30 +373,117 @@ class QuantizationEngine:
                     if layer_name not in activation_stats:
                         activation_stats[layer_name] = {
                             'min_vals': [],
-                            'max_vals': []
+                            'max_vals': [],
+                            'samples': []
                         }
-                    
+
                     # Simulate some activation values
                     activation_vals = self._simulate_layer_output(current_tensor, layer)
                     activation_stats[layer_name]['min_vals'].append(np.min(activation_vals))
                     activation_stats[layer_name]['max_vals'].append(np.max(activation_vals))
-                    
+                    if self.calibration != 'minmax':
+                        # Percentile/KL need the full distribution
+                        activation_stats[layer_name]['samples'].append(
+                            np.asarray(activation_vals).ravel())
+
                     current_tensor = activation_vals
-        
+
         # Compute quantization parameters from collected stats
         quantization_params = {}
         for layer_name, stats in activation_stats.items():
-            min_val = np.min(stats['min_vals'])
-            max_val = np.max(stats['max_vals'])
-            
-            # Create dummy tensor with min/max range
-            dummy_tensor = np.array([min_val, max_val])
-            scale, zero_point = self.activation_quantizer.compute_scale_zero_point(dummy_tensor)
-            
+            if self.calibration != 'minmax' and stats['samples']:
+                observed = np.concatenate(stats['samples'])
+            else:
+                # min/max only needs the extremes
+                observed = np.array([np.min(stats['min_vals']),
+                                     np.max(stats['max_vals'])])
+            scale, zero_point = self.activation_quantizer.compute_scale_zero_point(
+                observed, method=self.calibration)
+
             quantization_params[layer_name] = (scale, zero_point)
-        
+
         return quantization_params
     
+    # Layer types that carry quantization parameters through unchanged:
+    # they move or select values without altering their numeric domain
+    SCALE_TRANSPARENT_TYPES = {'reshape', 'transpose', 'squeeze',
+                               'maxpool2d', 'max_pool2d'}
+
+    def harmonize_residual_scales(self, graph: Dict[str, Any],
+                                  activation_params: Dict[str, Tuple[float, int]],
+                                  max_ratio: float = 2.0) -> int:
+        """Match the input scales of residual adds where accuracy allows.
+
+        When both inputs of an add share scale and zero point, the
+        runtime executes it as a plain int8 saturating add instead of
+        rescaling each operand first - the rescaling multiplies are a
+        third of that kernel's cost. Both producers adopt the coarser
+        of the two scales (widening a range never clips), and adds
+        whose input scales differ by more than max_ratio are left
+        alone: past that the finer input loses over one bit of
+        resolution. The walk back to each scale owner skips
+        scale-transparent layers so long skip branches still match.
+
+        Args:
+            graph: Quantized graph IR
+            activation_params: Per-layer (scale, zero_point), updated in place
+            max_ratio: Largest scale ratio harmonization may bridge
+
+        Returns:
+            Number of adds whose input scales were matched
+        """
+        layers = graph.get('layers', [])
+
+        producers = {}
+        for layer in layers:
+            for output in layer.get('outputs', []):
+                producers[output] = layer
+            producers.setdefault(layer.get('name', ''), layer)
+
+        def scale_owner(tensor):
+            layer = producers.get(tensor)
+            hops = 0
+            while (layer is not None and
+                   layer.get('type') in self.SCALE_TRANSPARENT_TYPES and
+                   layer.get('name') not in activation_params and
+                   len(layer.get('inputs', [])) == 1 and hops < len(layers)):
+                layer = producers.get(layer['inputs'][0])
+                hops += 1
+            return layer
+
+        matched = 0
+        for layer in layers:
+            if layer.get('type') != 'add' or len(layer.get('inputs', [])) != 2:
+                continue
+
+            lhs = scale_owner(layer['inputs'][0])
+            rhs = scale_owner(layer['inputs'][1])
+            if lhs is None or rhs is None or lhs is rhs:
+                continue
+            lhs_name = lhs.get('name')
+            rhs_name = rhs.get('name')
+            if lhs_name not in activation_params or rhs_name not in activation_params:
+                continue
+
+            lhs_scale, lhs_zp = activation_params[lhs_name]
+            rhs_scale, rhs_zp = activation_params[rhs_name]
+            if lhs_zp != rhs_zp or lhs_scale <= 0 or rhs_scale <= 0:
+                continue
+
+            coarse = max(lhs_scale, rhs_scale)
+            fine = min(lhs_scale, rhs_scale)
+            if coarse > fine * max_ratio:
+                continue  # Too much resolution lost on the finer input
+
+            activation_params[lhs_name] = (coarse, lhs_zp)
+            activation_params[rhs_name] = (coarse, rhs_zp)
+            layer['inputs_scale_matched'] = True
+            matched += 1
+
+        if matched:
+            print(f"Harmonized input scales for {matched} residual adds")
+        return matched
+
     def _simulate_layer_output(self, input_tensor: np.ndarray, layer: Dict) -> np.ndarray:
         """Simulate layer output for calibration."""
         layer_type = layer.get('type', 'unknown')
@@ -281,22 +524,73 @@ class QuantizationEngine:
         
         return ranges
     
+    # Gate weight name prefixes per recurrent layer type. The plain RNN
+    # keeps its unprefixed input_weights/hidden_weights keys.
+    RNN_GATE_PREFIXES = {
+        'gru': ['update_', 'reset_', 'new_'],
+        'lstm': ['input_', 'forget_', 'output_', 'cell_'],
+        'rnn': [''],
+    }
+
+    def _quantize_rnn_cell(self, layer: Dict[str, Any]) -> bool:
+        """Quantize a recurrent cell for the integer RNN kernel path.
+
+        Each gate weight matrix gets symmetric per-tensor int8 (the
+        runtime cells consume one scale per matrix, not per channel).
+        Biases stay float: the kernels fold them into fixed-point
+        pre-activations at configure time. The state itself runs as
+        int16 Q15 on device, which needs no exported parameters.
+        """
+        layer_type = layer.get('type', 'unknown')
+        quantizer = SymmetricQuantizer('int8')
+
+        quantized_any = False
+        for prefix in self.RNN_GATE_PREFIXES[layer_type]:
+            for kind in ('input_weights', 'hidden_weights'):
+                key = prefix + kind
+                if key not in layer:
+                    continue
+
+                weights = np.array(layer[key])
+                scale, zero_point = quantizer.compute_scale_zero_point(
+                    weights, method=self.calibration)
+                quantized = quantizer.quantize_tensor(weights, scale, zero_point)
+
+                layer[key] = quantized.tolist()
+                layer[prefix + kind.replace('weights', 'weight_scale')] = scale
+                quantized_any = True
+
+        if quantized_any:
+            layer['weight_quantized'] = True
+            layer['state_dtype'] = 'int16'
+            layer['state_format'] = 'q15'
+            if layer_type == 'lstm':
+                # Cell state uses the wider Q3.12 range (see CmxLSTM)
+                layer['cell_state_format'] = 'q12'
+
+        return quantized_any
+
     def quantize_weights(self, graph: Dict[str, Any]) -> Dict[str, Any]:
         """Quantize model weights."""
         quantized_graph = copy.deepcopy(graph)
         layers = quantized_graph.get('layers', [])
-        
+
         weight_count = 0
         for layer in layers:
             layer_type = layer.get('type', 'unknown')
-            
-            if layer_type in ['conv2d', 'dense']:
+
+            if layer_type in self.RNN_GATE_PREFIXES:
+                if self._quantize_rnn_cell(layer):
+                    weight_count += 1
+
+            elif layer_type in ['conv2d', 'dense']:
                 # Quantize weights
                 if 'weights' in layer:
                     weights = np.array(layer['weights'])  # Convert to numpy if needed
                     
                     # Use per-channel quantization for weights
-                    per_channel_quantizer = PerChannelQuantizer(self.weight_quantizer, axis=0)
+                    per_channel_quantizer = PerChannelQuantizer(
+                        self.weight_quantizer, axis=0, method=self.calibration)
                     quantized_weights, scales, zero_points = per_channel_quantizer.quantize_tensor(weights)
                     
                     layer['weights'] = quantized_weights.tolist()
@@ -323,26 +617,31 @@ class QuantizationEngine:
         return quantized_graph
 
 
-def quantize(graph: Dict[str, Any], mode: str = 'int8', 
+def quantize(graph: Dict[str, Any], mode: str = 'int8',
             calibration_data: Optional[Any] = None,
-            symmetric: bool = True) -> Dict[str, Any]:
+            symmetric: bool = True,
+            calibration: str = 'minmax') -> Dict[str, Any]:
     """
     Quantize model for integer inference.
-    
+
     Args:
         graph: Input graph IR
         mode: Quantization mode ('int8', 'int16', etc.)
         calibration_data: Data for activation calibration
         symmetric: Use symmetric quantization
-        
+        calibration: Range selection method - 'minmax', 'percentile'
+            (clip outliers at the 99.99th percentile) or 'kl'
+            (saturation-minimizing threshold search). Applies per
+            channel to weights and per layer to activations.
+
     Returns:
         Quantized graph IR
     """
-    
-    print(f"Starting quantization to {mode} (symmetric={symmetric})")
-    
+
+    print(f"Starting quantization to {mode} (symmetric={symmetric}, calibration={calibration})")
+
     # Create quantization engine
-    engine = QuantizationEngine(mode=mode, symmetric=symmetric)
+    engine = QuantizationEngine(mode=mode, symmetric=symmetric, calibration=calibration)
     
     # Convert calibration data if provided
     if calibration_data is not None and not isinstance(calibration_data, CalibrationDataset):
@@ -357,12 +656,16 @@ def quantize(graph: Dict[str, Any], mode: str = 'int8',
     
     # Calibrate and store activation quantization parameters
     activation_params = engine.calibrate_activations(quantized_graph, calibration_data)
+
+    # Match residual-add input scales so those adds skip rescaling
+    engine.harmonize_residual_scales(quantized_graph, activation_params)
     quantized_graph['activation_quantization'] = activation_params
     
     # Add quantization metadata
     quantized_graph['quantization'] = {
         'mode': mode,
         'symmetric': symmetric,
+        'calibration': calibration,
         'engine_version': '1.0.0',
         'calibration_samples': len(calibration_data) if calibration_data else 0
     }
@@ -390,6 +693,16 @@ def validate_quantization(graph: Dict[str, Any]) -> bool:
                     if field not in layer:
                         print(f"Missing quantization field '{field}' in layer {layer.get('name')}")
                         return False
+
+        if layer_type in QuantizationEngine.RNN_GATE_PREFIXES:
+            # Quantized cells need one scale per quantized weight matrix
+            if layer.get('weight_quantized', False):
+                for prefix in QuantizationEngine.RNN_GATE_PREFIXES[layer_type]:
+                    for kind in ('input_weight_scale', 'hidden_weight_scale'):
+                        key = prefix + kind
+                        if prefix + kind.replace('_scale', 's') in layer and key not in layer:
+                            print(f"Missing quantization field '{key}' in layer {layer.get('name')}")
+                            return False
     
     # Check activation quantization parameters
     if 'activation_quantization' not in graph:
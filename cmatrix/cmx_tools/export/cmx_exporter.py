@@ -6,6 +6,7 @@ for converting models from different frameworks to CMatrix format.
 """
 
 import os
+import struct
 from typing import Union, Dict, Any, Optional, Tuple
 from .torch_converter import convert_from_torch
 from .tf_converter import convert_from_tf
@@ -207,7 +208,221 @@ def export_model(model,
     except Exception as e:
         raise ExportError(f"Model export failed: {str(e)}") from e
 
-def batch_export(models: Dict[str, Union[str, Any]], 
+def export_standalone(model,
+                     output_dir: str,
+                     target: str = 'generic',
+                     format_type: Optional[str] = None,
+                     **kwargs) -> str:
+    """
+    Export a model straight to a self-contained C++ translation unit
+
+    Converts the model to CMatrix form, lowers it to the compiler's
+    graph IR and hands it to code_generator.generate_standalone_binary.
+    The result is one compilable .cpp (plus a matching header) with
+    specialized loop nests, baked weights and static activation
+    buffers - no runtime, registry, dispatcher or serializer is
+    referenced, so none of them ends up in the firmware. Intended for
+    the smallest parts where the interpreter's flash footprint and
+    model load time are not affordable.
+
+    Args:
+        model: Model to convert (same inputs as export_model)
+        output_dir: Directory for the generated .cpp/.h pair
+        target: Code generation target ('generic', 'cortex-m', ...)
+        format_type: Source format, auto-detected if None
+        **kwargs: Format-specific parameters passed to export_model
+
+    Returns:
+        str: Path to the generated .cpp file
+
+    Raises:
+        ExportError: If conversion or generation fails
+    """
+
+    cmx_graph = export_model(model, format_type=format_type, **kwargs)
+
+    try:
+        from ..compile.code_generator import generate_standalone_binary
+
+        graph_ir = _lower_to_graph_ir(cmx_graph)
+        return generate_standalone_binary(graph_ir, target=target,
+                                          output_dir=output_dir)
+    except Exception as e:
+        raise ExportError(f"Standalone export failed: {str(e)}") from e
+
+def _lower_to_graph_ir(cmx_graph: CMXGraph) -> Dict[str, Any]:
+    """Lower a CMXGraph to the compiler's graph IR dict
+
+    Nodes become layer dicts in graph order with their attributes
+    carried across so the specializer can constant-fold shapes. Each
+    layer's weight and bias are renamed to the weights_{i}/bias_{i}
+    convention the generated call sites use (a weight shared by two
+    layers is duplicated per consumer). Weight data is baked into the
+    tensor entries for flash-array emission.
+    """
+
+    _DTYPE_NAMES = {'float32': 'float', 'float64': 'float', 'int8': 'int8',
+                    'uint8': 'uint8', 'int16': 'int16', 'int32': 'int32'}
+
+    def _make_tensor(name: str, data) -> Dict[str, Any]:
+        tensor = {'name': name, 'is_const': True}
+        if hasattr(data, 'shape'):
+            tensor['shape'] = list(data.shape)
+        if hasattr(data, 'dtype'):
+            tensor['dtype'] = _DTYPE_NAMES.get(str(data.dtype), 'float')
+        if hasattr(data, 'flatten'):
+            tensor['data'] = data.flatten().tolist()
+        return tensor
+
+    weight_names = set(cmx_graph.weights.keys())
+    tensors = []
+    layers = []
+
+    for i, (node_id, node) in enumerate(cmx_graph.nodes.items()):
+        layer = dict(getattr(node, 'attributes', None) or {})
+        layer['type'] = getattr(node, 'op_type', 'unknown')
+        layer.setdefault('name', node_id)
+        layers.append(layer)
+
+        for ref in getattr(node, 'inputs', []):
+            if ref not in weight_names:
+                continue
+            data = cmx_graph.weights[ref]
+            # 1D params are biases, everything else is a weight
+            alias = f'bias_{i}' if getattr(data, 'ndim', 2) == 1 else f'weights_{i}'
+            tensors.append(_make_tensor(alias, data))
+
+    return {
+        'name': cmx_graph.metadata.get('model_name', 'model'),
+        'tensors': tensors,
+        'layers': layers
+    }
+
+def pad_weight_channels(cmx_graph: CMXGraph, lane_width: int) -> int:
+    """
+    Zero-pad conv weight input channels to a SIMD lane width
+
+    Rounds the innermost (input-channel) axis of every 4D weight up to a
+    multiple of lane_width, padding with zeros. This pairs with the
+    runtime's channel-padded NHWC activations: the padded activation
+    lanes hold garbage, but they multiply against these zero weight
+    lanes, so kernels can run full-width SIMD loads over ragged channel
+    counts (3, 17, ...) without scalar tails. The lane width is recorded
+    in metadata so the runtime planner applies the matching round-up.
+
+    Args:
+        cmx_graph: CMatrix graph whose weights to pad in place
+        lane_width: SIMD lane count to round input channels up to
+
+    Returns:
+        Number of weight tensors that were padded
+    """
+    import numpy as np
+
+    if lane_width <= 0:
+        raise ExportError(f"Invalid lane width: {lane_width}")
+
+    padded_count = 0
+    for weight_name, weight_data in cmx_graph.weights.items():
+        if not hasattr(weight_data, 'ndim') or weight_data.ndim != 4:
+            continue
+
+        channels = weight_data.shape[-1]
+        padded = ((channels + lane_width - 1) // lane_width) * lane_width
+        if padded == channels:
+            continue
+
+        pad_spec = [(0, 0)] * 3 + [(0, padded - channels)]
+        cmx_graph.weights[weight_name] = np.pad(weight_data, pad_spec,
+                                                mode='constant')
+        padded_count += 1
+
+    cmx_graph.metadata['channel_pad_lanes'] = lane_width
+    return padded_count
+
+def _fnv1a(data: bytes) -> int:
+    """64-bit FNV-1a, matching the runtime patch applier"""
+    hash_value = 0xcbf29ce484222325
+    for byte in data:
+        hash_value = ((hash_value ^ byte) * 0x100000001b3) & 0xFFFFFFFFFFFFFFFF
+    return hash_value
+
+def export_delta(base_model_path: str,
+                new_model_path: str,
+                patch_path: str,
+                block_size: int = 4096) -> Dict[str, Any]:
+    """
+    Emit an OTA delta patch between two exported model images
+
+    Unchanged ranges of the new image are referenced from the resident
+    base model by offset and FNV-1a content hash, so only changed tensor
+    payloads travel over the air; the runtime rebuilds the full image
+    with cmx_apply_model_patch. Matching is block-wise at block_size
+    granularity with adjacent records of the same kind coalesced.
+
+    Args:
+        base_model_path: Path to the currently deployed model image
+        new_model_path: Path to the retrained model image
+        patch_path: Output path for the delta patch
+        block_size: Comparison granularity in bytes
+
+    Returns:
+        Dictionary with patch statistics
+
+    Raises:
+        ExportError: If patch generation fails
+    """
+
+    try:
+        with open(base_model_path, 'rb') as f:
+            base = f.read()
+        with open(new_model_path, 'rb') as f:
+            new = f.read()
+
+        # Build copy/insert records covering the new image in order
+        records = []  # (kind, length, source_offset, literal)
+        position = 0
+        while position < len(new):
+            chunk = new[position:position + block_size]
+            unchanged = base[position:position + len(chunk)] == chunk
+            kind = 0 if unchanged else 1
+            source = position if unchanged else 0
+
+            previous = records[-1] if records else None
+            if previous and previous[0] == kind and \
+               (kind == 1 or previous[2] + previous[1] == source):
+                records[-1] = (kind, previous[1] + len(chunk), previous[2],
+                               previous[3] + (b'' if unchanged else chunk))
+            else:
+                records.append((kind, len(chunk), source,
+                                b'' if unchanged else chunk))
+            position += len(chunk)
+
+        bytes_reused = 0
+        with open(patch_path, 'wb') as f:
+            f.write(struct.pack('<4sIII', b'CMXD', 1, len(records), 0))
+            f.write(struct.pack('<QQ', len(new), _fnv1a(base)))
+
+            for kind, length, source, literal in records:
+                produced = literal if kind == 1 else base[source:source + length]
+                f.write(struct.pack('<IIQQ', kind, length, source, _fnv1a(produced)))
+                if kind == 1:
+                    f.write(literal)
+                else:
+                    bytes_reused += length
+
+        return {
+            'patch_path': patch_path,
+            'output_size': len(new),
+            'records': len(records),
+            'bytes_reused': bytes_reused,
+            'patch_size_bytes': os.path.getsize(patch_path)
+        }
+
+    except Exception as e:
+        raise ExportError(f"Delta export failed: {str(e)}") from e
+
+def batch_export(models: Dict[str, Union[str, Any]],
                 output_dir: str = None,
                 **kwargs) -> Dict[str, CMXGraph]:
     """
@@ -6,11 +6,12 @@ for storage, transmission, and loading in embedded environments.
 """
 
 import json
+import math
 import pickle
 import gzip
 import os
 import numpy as np
-from typing import Dict, Any, Union, Optional
+from typing import Dict, Any, List, Union, Optional
 import struct
 import hashlib
 from datetime import datetime
@@ -36,22 +37,268 @@ class SerializationError(Exception):
     """Custom exception for serialization errors"""
     pass
 
-def _numpy_to_dict(arr: np.ndarray) -> Dict[str, Any]:
-    """Convert numpy array to serializable dictionary"""
+def _rle_compress(data: bytes) -> bytes:
+    """Byte-oriented RLE as (count, value) pairs, matching the runtime decoder"""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        value = data[i]
+        count = 1
+        while i + count < len(data) and data[i + count] == value and count < 255:
+            count += 1
+        out.append(count)
+        out.append(value)
+        i += count
+    return bytes(out)
+
+def _rle_decompress(data: bytes) -> bytes:
+    """Inverse of _rle_compress"""
+    out = bytearray()
+    for i in range(0, len(data) - 1, 2):
+        out.extend(bytes([data[i + 1]]) * data[i])
+    return bytes(out)
+
+# Structured-sparsity packing. Mirrors the runtime format in
+# cmx_core/utils/cmx_quantization.hpp: both encodings run along the
+# reduction dimension of a row-major per-output-row weight matrix and
+# are consumed directly by the sparse paths in CmxMatMul.
+
+SPARSE_2_4_GROUP = 4
+SPARSE_BLOCK_SIZE = 16
+
+def _weights_to_rows(weights) -> List[List[float]]:
+    """Normalize a 2-D weight tensor (numpy or nested sequences) to float rows"""
+    if hasattr(weights, 'tolist'):
+        weights = weights.tolist()
+    return [[float(v) for v in row] for row in weights]
+
+def _pack_sparse_2_4_row(row: List[float]) -> tuple:
+    """Pack one row into 2:4 values and index nibbles (two groups per byte)"""
+    values = []
+    nibbles = []
+    for g in range(0, len(row), SPARSE_2_4_GROUP):
+        group = row[g:g + SPARSE_2_4_GROUP]
+        # Two largest-magnitude positions, ascending; exact for pruned rows
+        kept = sorted(sorted(range(SPARSE_2_4_GROUP),
+                             key=lambda i: -abs(group[i]))[:2])
+        values.extend([group[kept[0]], group[kept[1]]])
+        nibbles.append(kept[0] | (kept[1] << 2))
+
+    indices = bytearray()
+    for i in range(0, len(nibbles), 2):
+        high = nibbles[i + 1] if i + 1 < len(nibbles) else 0
+        indices.append(nibbles[i] | (high << 4))
+    return values, bytes(indices)
+
+def _pack_sparse_block16_row(row: List[float]) -> tuple:
+    """Pack one row into surviving 16-blocks plus a presence bitmap"""
+    blocks = len(row) // SPARSE_BLOCK_SIZE
+    values = []
+    bitmap = bytearray((blocks + 7) // 8)
+    kept = 0
+    for b in range(blocks):
+        block = row[b * SPARSE_BLOCK_SIZE:(b + 1) * SPARSE_BLOCK_SIZE]
+        if any(v != 0.0 for v in block):
+            bitmap[b // 8] |= 1 << (b % 8)
+            values.extend(block)
+            kept += 1
+    return values, bytes(bitmap), kept
+
+def detect_sparse_format(weights) -> Optional[str]:
+    """Pick the packed sparse format for a pruned 2-D weight tensor
+
+    Returns 'sparse_2_4' when every group of 4 along the reduction
+    dimension has at most 2 nonzeros, 'block_16' when at least a quarter
+    of the 16-wide blocks are entirely zero (so packing pays for its
+    bitmap), or None for layers that should stay dense.
+    """
+    rows = _weights_to_rows(weights)
+    if not rows or not rows[0]:
+        return None
+    cols = len(rows[0])
+
+    if cols % (2 * SPARSE_2_4_GROUP) == 0:
+        if all(sum(1 for v in row[g:g + SPARSE_2_4_GROUP] if v != 0.0) <= 2
+               for row in rows
+               for g in range(0, cols, SPARSE_2_4_GROUP)):
+            return 'sparse_2_4'
+
+    if cols % SPARSE_BLOCK_SIZE == 0:
+        total = 0
+        zero = 0
+        for row in rows:
+            for b in range(0, cols, SPARSE_BLOCK_SIZE):
+                total += 1
+                if all(v == 0.0 for v in row[b:b + SPARSE_BLOCK_SIZE]):
+                    zero += 1
+        if total and zero * 4 >= total:
+            return 'block_16'
+
+    return None
+
+def encode_sparse_weights(weights) -> Optional[Dict[str, Any]]:
+    """Encode a pruned weight tensor into the packed runtime sparse format
+
+    Returns a dictionary with 'format', packed 'values' (little-endian
+    float32), 'metadata' (2:4 index nibbles or block bitmaps, one stride
+    per output row), 'shape', and for 'block_16' the per-row
+    'block_offsets' (uint32 little-endian, rows + 1 entries) that
+    CmxMatMul::set_sparse_weights expects. Returns None when no format
+    applies; the layer then ships dense weights.
+    """
+    fmt = detect_sparse_format(weights)
+    if fmt is None:
+        return None
+
+    rows = _weights_to_rows(weights)
+    entry = {'format': fmt, 'shape': (len(rows), len(rows[0]))}
+
+    if fmt == 'sparse_2_4':
+        values = []
+        metadata = bytearray()
+        for row in rows:
+            row_values, row_indices = _pack_sparse_2_4_row(row)
+            values.extend(row_values)
+            metadata.extend(row_indices)
+        entry['values'] = struct.pack('<%df' % len(values), *values)
+        entry['metadata'] = bytes(metadata)
+    else:
+        values = []
+        metadata = bytearray()
+        offsets = [0]
+        for row in rows:
+            row_values, row_bitmap, kept = _pack_sparse_block16_row(row)
+            values.extend(row_values)
+            metadata.extend(row_bitmap)
+            offsets.append(offsets[-1] + kept)
+        entry['values'] = struct.pack('<%df' % len(values), *values)
+        entry['metadata'] = bytes(metadata)
+        entry['block_offsets'] = struct.pack('<%dI' % len(offsets), *offsets)
+
+    return entry
+
+def decode_sparse_weights(entry: Dict[str, Any]) -> List[List[float]]:
+    """Expand encode_sparse_weights output back to dense rows (for validation)"""
+    n_rows, cols = entry['shape']
+    values = list(struct.unpack('<%df' % (len(entry['values']) // 4),
+                                entry['values']))
+    rows = []
+
+    if entry['format'] == 'sparse_2_4':
+        groups = cols // SPARSE_2_4_GROUP
+        meta_stride = groups // 2
+        for r in range(n_rows):
+            row = [0.0] * cols
+            meta = entry['metadata'][r * meta_stride:(r + 1) * meta_stride]
+            row_values = values[r * groups * 2:(r + 1) * groups * 2]
+            for g in range(groups):
+                nibble = (meta[g // 2] >> 4) if g % 2 else (meta[g // 2] & 0x0F)
+                row[g * SPARSE_2_4_GROUP + (nibble & 0x03)] = row_values[g * 2]
+                row[g * SPARSE_2_4_GROUP + ((nibble >> 2) & 0x03)] = row_values[g * 2 + 1]
+            rows.append(row)
+    else:
+        blocks = cols // SPARSE_BLOCK_SIZE
+        bitmap_stride = (blocks + 7) // 8
+        offsets = struct.unpack('<%dI' % (n_rows + 1), entry['block_offsets'])
+        for r in range(n_rows):
+            row = [0.0] * cols
+            bitmap = entry['metadata'][r * bitmap_stride:(r + 1) * bitmap_stride]
+            cursor = offsets[r] * SPARSE_BLOCK_SIZE
+            for b in range(blocks):
+                if bitmap[b // 8] & (1 << (b % 8)):
+                    row[b * SPARSE_BLOCK_SIZE:(b + 1) * SPARSE_BLOCK_SIZE] = \
+                        values[cursor:cursor + SPARSE_BLOCK_SIZE]
+                    cursor += SPARSE_BLOCK_SIZE
+            rows.append(row)
+
+    return rows
+
+# Clustered (palettized) weight packing. Mirrors the runtime format in
+# cmx_core/utils/cmx_quantization.hpp: 4-bit palette indices packed two
+# per byte (element 2i in the low nibble), one byte-aligned stride per
+# output row, plus a PALETTE_SIZE-entry float codebook learned by
+# quantization_engine.WeightClusterer.
+
+PALETTE_SIZE = 16
+
+def encode_clustered_weights(indices, palette) -> Dict[str, Any]:
+    """Encode clustered weight indices plus their codebook
+
+    indices is a 2-D array of palette indices (one per weight, values
+    0..15) as produced by WeightClusterer.cluster_tensor; palette is the
+    matching codebook. Returns a dictionary with 'format', packed
+    'indices' (row stride (cols + 1) // 2 bytes), 'palette'
+    (little-endian float32, PALETTE_SIZE entries) and 'shape', in the
+    layout CmxDense::run_clustered and the Conv2D clustered path expect.
+    """
+    if hasattr(indices, 'tolist'):
+        indices = indices.tolist()
+    rows = [[int(v) for v in row] for row in indices]
+    if any(v < 0 or v >= PALETTE_SIZE for row in rows for v in row):
+        raise ValueError("palette index out of range")
+
+    palette = [float(v) for v in palette]
+    if len(palette) != PALETTE_SIZE:
+        raise ValueError("palette must have %d entries" % PALETTE_SIZE)
+
+    packed = bytearray()
+    for row in rows:
+        for i in range(0, len(row), 2):
+            high = row[i + 1] if i + 1 < len(row) else 0
+            packed.append(row[i] | (high << 4))
+
     return {
-        'data': arr.tobytes(),
+        'format': 'clustered_16',
+        'indices': bytes(packed),
+        'palette': struct.pack('<%df' % PALETTE_SIZE, *palette),
+        'shape': (len(rows), len(rows[0]) if rows else 0),
+    }
+
+def decode_clustered_weights(entry: Dict[str, Any]) -> List[List[float]]:
+    """Expand encode_clustered_weights output back to dense rows (for validation)"""
+    n_rows, cols = entry['shape']
+    palette = struct.unpack('<%df' % PALETTE_SIZE, entry['palette'])
+    row_bytes = (cols + 1) // 2
+
+    rows = []
+    for r in range(n_rows):
+        packed = entry['indices'][r * row_bytes:(r + 1) * row_bytes]
+        row = []
+        for c in range(cols):
+            byte = packed[c // 2]
+            index = (byte >> 4) if c % 2 else (byte & 0x0F)
+            row.append(palette[index])
+        rows.append(row)
+    return rows
+
+def _numpy_to_dict(arr: np.ndarray, weight_compression: Optional[str] = None) -> Dict[str, Any]:
+    """Convert numpy array to serializable dictionary"""
+    raw = arr.tobytes()
+    entry = {
+        'data': raw,
         'dtype': str(arr.dtype),
         'shape': arr.shape
     }
+    if weight_compression == 'rle':
+        compressed = _rle_compress(raw)
+        # Keep the compressed form only when it actually shrinks the payload
+        if len(compressed) < len(raw):
+            entry['data'] = compressed
+            entry['compression'] = 'rle'
+            entry['stored_size'] = len(compressed)
+    return entry
 
 def _dict_to_numpy(data_dict: Dict[str, Any]) -> np.ndarray:
     """Convert dictionary back to numpy array"""
-    arr = np.frombuffer(data_dict['data'], dtype=data_dict['dtype'])
+    data = data_dict['data']
+    if data_dict.get('compression') == 'rle':
+        data = _rle_decompress(data)
+    arr = np.frombuffer(data, dtype=data_dict['dtype'])
     return arr.reshape(data_dict['shape'])
 
-def _graph_to_dict(cmx_graph: CMXGraph) -> Dict[str, Any]:
+def _graph_to_dict(cmx_graph: CMXGraph, weight_compression: Optional[str] = None) -> Dict[str, Any]:
     """Convert CMXGraph to serializable dictionary"""
-    
+
     # Convert nodes
     nodes_dict = {}
     for node_id, node in cmx_graph.nodes.items():
@@ -61,12 +308,12 @@ def _graph_to_dict(cmx_graph: CMXGraph) -> Dict[str, Any]:
             'outputs': node.outputs,
             'attributes': node.attributes
         }
-    
+
     # Convert weights
     weights_dict = {}
     for weight_name, weight_data in cmx_graph.weights.items():
         if isinstance(weight_data, np.ndarray):
-            weights_dict[weight_name] = _numpy_to_dict(weight_data)
+            weights_dict[weight_name] = _numpy_to_dict(weight_data, weight_compression)
         else:
             weights_dict[weight_name] = weight_data
     
@@ -108,6 +355,308 @@ def _dict_to_graph(data_dict: Dict[str, Any]) -> CMXGraph:
     
     return cmx_graph
 
+class ModelStreamWriter:
+    """
+    Incremental writer for the streamed CMX container (magic 'CMX\\x02').
+
+    Weight payloads are appended record-by-record as they are produced,
+    so converting a large model never holds more than one decoded
+    tensor in memory. The topology (nodes, inputs, outputs, metadata)
+    is written once at the end via finish(). Files written this way are
+    read back by deserialize_model like any other CMX file.
+
+    Record layout (little-endian), repeated per tensor:
+        u16 name length, name bytes,
+        u8 dtype length, dtype bytes,
+        u8 rank, u32 per dimension,
+        u8 compression (0 = raw, 1 = rle),
+        u64 payload length, payload bytes
+    A record with name length 0 terminates the weight section and is
+    followed by u64 topology length and the topology as JSON.
+    """
+
+    def __init__(self, output_path: str, weight_compression: Optional[str] = None):
+        os.makedirs(os.path.dirname(output_path) or '.', exist_ok=True)
+        self._file = open(output_path, 'wb')
+        self._file.write(b'CMX\x02')
+        self._file.write(struct.pack('<H', 100))  # Version 1.00
+        self._weight_compression = weight_compression
+        self._num_weights = 0
+        self._payload_bytes = 0
+        self._finished = False
+        self.output_path = output_path
+
+    def write_weight(self, name: str, array: np.ndarray) -> None:
+        """Append one weight tensor and release it from memory"""
+        if self._finished:
+            raise SerializationError("Writer already finished")
+
+        raw = array.tobytes()
+        compression = 0
+        if self._weight_compression == 'rle':
+            compressed = _rle_compress(raw)
+            # Keep the compressed form only when it actually shrinks the payload
+            if len(compressed) < len(raw):
+                raw = compressed
+                compression = 1
+
+        name_bytes = name.encode('utf-8')
+        dtype_bytes = str(array.dtype).encode('utf-8')
+        self._file.write(struct.pack('<H', len(name_bytes)))
+        self._file.write(name_bytes)
+        self._file.write(struct.pack('<B', len(dtype_bytes)))
+        self._file.write(dtype_bytes)
+        self._file.write(struct.pack('<B', len(array.shape)))
+        for dim in array.shape:
+            self._file.write(struct.pack('<I', dim))
+        self._file.write(struct.pack('<B', compression))
+        self._file.write(struct.pack('<Q', len(raw)))
+        self._file.write(raw)
+
+        self._num_weights += 1
+        self._payload_bytes += len(raw)
+
+    def finish(self, topology: Dict[str, Any]) -> Dict[str, Any]:
+        """
+        Write the terminator and topology section and close the file.
+
+        Args:
+            topology: Dict with 'nodes', 'inputs', 'outputs', 'metadata'
+                in the same layout _graph_to_dict produces (weights
+                excluded - they are already on disk)
+
+        Returns:
+            Dictionary with serialization info
+        """
+        if self._finished:
+            raise SerializationError("Writer already finished")
+
+        topology = dict(topology)
+        topology.setdefault('version', '1.0.0')
+        topology.setdefault('serialization_timestamp', datetime.now().isoformat())
+        topology_json = json.dumps(topology, default=str).encode('utf-8')
+
+        self._file.write(struct.pack('<H', 0))  # Terminator record
+        self._file.write(struct.pack('<Q', len(topology_json)))
+        self._file.write(topology_json)
+        self._file.close()
+        self._finished = True
+
+        return {
+            'format': 'binary_streamed',
+            'output_path': self.output_path,
+            'num_weights': self._num_weights,
+            'weight_payload_bytes': self._payload_bytes,
+            'file_size_bytes': os.path.getsize(self.output_path),
+            'weight_compression': self._weight_compression,
+            'serialization_time': datetime.now().isoformat()
+        }
+
+    def close(self) -> None:
+        """Close without a topology section (aborted conversion)"""
+        if not self._finished:
+            self._file.close()
+            self._finished = True
+
+
+def _read_streamed_model(data_bytes: bytes) -> CMXGraph:
+    """Reconstruct a CMXGraph from the streamed CMX container"""
+    offset = 6  # Magic + version
+
+    cmx_graph = CMXGraph()
+    while True:
+        name_len = struct.unpack_from('<H', data_bytes, offset)[0]
+        offset += 2
+        if name_len == 0:
+            break
+
+        name = data_bytes[offset:offset + name_len].decode('utf-8')
+        offset += name_len
+        dtype_len = struct.unpack_from('<B', data_bytes, offset)[0]
+        offset += 1
+        dtype = data_bytes[offset:offset + dtype_len].decode('utf-8')
+        offset += dtype_len
+        rank = struct.unpack_from('<B', data_bytes, offset)[0]
+        offset += 1
+        shape = struct.unpack_from('<%dI' % rank, data_bytes, offset)
+        offset += 4 * rank
+        compression = struct.unpack_from('<B', data_bytes, offset)[0]
+        offset += 1
+        payload_len = struct.unpack_from('<Q', data_bytes, offset)[0]
+        offset += 8
+        payload = data_bytes[offset:offset + payload_len]
+        offset += payload_len
+
+        if compression == 1:
+            payload = _rle_decompress(payload)
+        cmx_graph.weights[name] = np.frombuffer(payload, dtype=dtype).reshape(shape)
+
+    topology_len = struct.unpack_from('<Q', data_bytes, offset)[0]
+    offset += 8
+    topology = json.loads(data_bytes[offset:offset + topology_len].decode('utf-8'))
+
+    for node_id, node_data in topology.get('nodes', {}).items():
+        cmx_graph.nodes[node_id] = CMXOp(
+            op_type=node_data['op_type'],
+            inputs=node_data['inputs'],
+            outputs=node_data['outputs'],
+            attributes=node_data.get('attributes', {})
+        )
+    cmx_graph.inputs = topology.get('inputs', [])
+    cmx_graph.outputs = topology.get('outputs', [])
+    cmx_graph.metadata = topology.get('metadata', {})
+
+    return cmx_graph
+
+
+# Int8 activations whose quantized transfer function fits a 256-entry
+# lookup table. Precomputing the tables at export keeps them in flash
+# with the weights instead of being rebuilt into RAM at configure time.
+
+ACTIVATION_LUT_OPS = {'sigmoid', 'tanh', 'gelu'}
+ACTIVATION_LUT_SIZE = 256
+
+def _activation_reference(op_type: str, x: float) -> float:
+    """Float reference for a LUT-able activation"""
+    if op_type == 'sigmoid':
+        return 1.0 / (1.0 + math.exp(-x))
+    if op_type == 'tanh':
+        return math.tanh(x)
+    # GELU, tanh form
+    return 0.5 * x * (1.0 + math.tanh(0.7978845608028654 *
+                                      (x + 0.044715 * x * x * x)))
+
+def build_activation_lut(op_type: str, input_scale: float, input_zero_point: int,
+                         output_scale: float, output_zero_point: int) -> bytes:
+    """Precompute the int8 transfer table for one quantized activation
+
+    Entry i holds the output for input code i - 128, so the runtime
+    indexes the table with (q + 128). The table bakes in both the
+    layer's input and output quantization, making the kernel a pure
+    byte lookup with no per-element math.
+    """
+    table = bytearray(ACTIVATION_LUT_SIZE)
+    for i in range(ACTIVATION_LUT_SIZE):
+        q = i - 128
+        x = input_scale * (q - input_zero_point)
+        y = _activation_reference(op_type, x)
+        out = int(round(y / output_scale)) + output_zero_point
+        table[i] = max(-128, min(127, out)) & 0xFF
+    return bytes(table)
+
+def attach_activation_luts(cmx_graph: CMXGraph) -> int:
+    """Precompute flash-resident LUTs for quantized activation nodes
+
+    Every sigmoid/tanh/GELU node carrying input and output quantization
+    attributes gets a 256-byte int8 table stored alongside the weights
+    (so it lands in the constant blob the runtime keeps in flash) and a
+    'lut_table' attribute naming it. The runtime kernel then reads the
+    table through the constant pointer instead of generating it into
+    RAM at configure time - 30 LUT layers otherwise cost 7.5KB of RAM
+    plus the configure-time math.
+
+    Returns:
+        Number of tables attached
+    """
+    attached = 0
+    for node_id, node in cmx_graph.nodes.items():
+        op_type = node.op_type.lower()
+        if op_type not in ACTIVATION_LUT_OPS:
+            continue
+        attrs = node.attributes
+        if not all(key in attrs for key in ('input_scale', 'input_zero_point',
+                                            'output_scale', 'output_zero_point')):
+            continue
+        lut_name = f"{node_id}_lut"
+        if lut_name in cmx_graph.weights:
+            continue  # Already attached
+
+        lut = build_activation_lut(
+            op_type,
+            float(attrs['input_scale']), int(attrs['input_zero_point']),
+            float(attrs['output_scale']), int(attrs['output_zero_point']))
+        cmx_graph.weights[lut_name] = np.frombuffer(lut, dtype=np.int8)
+        attrs['lut_table'] = lut_name
+        attached += 1
+
+    return attached
+
+# Weight payload ordering. The executor reads weights in topological
+# execution order, but payloads used to be written in graph-declaration
+# order, so weight streaming and first-touch XIP walked flash at
+# random. Payloads are re-laid-out in execution order at export instead
+# (sequential QSPI reads run ~3x the scattered rate); node records and
+# metadata keep their logical order - only the weights dict, whose
+# insertion order every writer preserves, is rebuilt.
+
+def _execution_node_order(cmx_graph: CMXGraph) -> List[str]:
+    """Topological node order matching the runtime executor's plan"""
+    producers = {}
+    for node_id, node in cmx_graph.nodes.items():
+        for out in node.outputs:
+            producers[out] = node_id
+
+    in_deps = {}
+    consumers = {}
+    for node_id, node in cmx_graph.nodes.items():
+        deps = {producers[t] for t in node.inputs
+                if t in producers and producers[t] != node_id}
+        in_deps[node_id] = len(deps)
+        for dep in deps:
+            consumers.setdefault(dep, []).append(node_id)
+
+    ready = [nid for nid, count in in_deps.items() if count == 0]
+    order = []
+    while ready:
+        node_id = ready.pop(0)
+        order.append(node_id)
+        for consumer in consumers.get(node_id, []):
+            in_deps[consumer] -= 1
+            if in_deps[consumer] == 0:
+                ready.append(consumer)
+
+    if len(order) != len(cmx_graph.nodes):
+        # Cyclic or disconnected leftovers keep declaration order
+        placed = set(order)
+        order.extend(nid for nid in cmx_graph.nodes if nid not in placed)
+    return order
+
+def weight_execution_order(cmx_graph: CMXGraph) -> List[str]:
+    """Weight names in first-use execution order
+
+    Walks nodes in topological order and lists every referenced weight
+    (node inputs plus attribute references such as 'lut_table') at its
+    first use; weights no node references keep their declaration order
+    at the end. ModelStreamWriter callers can iterate this to append
+    payloads in the order the runtime will read them.
+    """
+    ordered = []
+    seen = set()
+    for node_id in _execution_node_order(cmx_graph):
+        node = cmx_graph.nodes[node_id]
+        refs = list(node.inputs)
+        lut_name = node.attributes.get('lut_table')
+        if lut_name:
+            refs.append(lut_name)
+        for name in refs:
+            if name in cmx_graph.weights and name not in seen:
+                ordered.append(name)
+                seen.add(name)
+    for name in cmx_graph.weights:
+        if name not in seen:
+            ordered.append(name)
+    return ordered
+
+def sort_weights_for_execution(cmx_graph: CMXGraph) -> List[str]:
+    """Rebuild the weights dict in first-use execution order
+
+    Returns:
+        The applied weight order
+    """
+    order = weight_execution_order(cmx_graph)
+    cmx_graph.weights = {name: cmx_graph.weights[name] for name in order}
+    return order
+
 def _calculate_checksum(data: bytes) -> str:
     """Calculate MD5 checksum of data"""
     return hashlib.md5(data).hexdigest()
@@ -146,29 +695,42 @@ def _parse_binary_header(data: bytes) -> tuple:
     
     return metadata, 10 + metadata_size
 
-def serialize_model(cmx_graph: CMXGraph, output_path: str, 
-                   format_type: str = 'binary', compress: bool = True) -> Dict[str, Any]:
+def serialize_model(cmx_graph: CMXGraph, output_path: str,
+                   format_type: str = 'binary', compress: bool = True,
+                   weight_compression: Optional[str] = None) -> Dict[str, Any]:
     """
     Serialize CMatrix graph to file
-    
+
     Args:
         cmx_graph: CMatrix graph to serialize
         output_path: Output file path
         format_type: 'binary' or 'json'
         compress: Whether to compress the output (gzip)
-        
+        weight_compression: Optional per-tensor payload compression
+            ('rle' for the byte-oriented scheme the runtime decompresses
+            directly into the arena); tensors that do not shrink are
+            stored uncompressed
+
     Returns:
         Dictionary with serialization info
     """
-    
+
     try:
+        # Bake activation LUTs in with the weights so they stay in flash
+        attach_activation_luts(cmx_graph)
+
+        # Lay weight payloads out in the order the executor will read
+        # them, so streaming and XIP first-touch stay sequential in flash
+        sort_weights_for_execution(cmx_graph)
+
         # Convert graph to dictionary
-        graph_dict = _graph_to_dict(cmx_graph)
-        
+        graph_dict = _graph_to_dict(cmx_graph, weight_compression)
+
         # Add serialization metadata
         serialization_info = {
             'format': format_type,
             'compressed': compress,
+            'weight_compression': weight_compression,
             'file_size_bytes': 0,
             'checksum': '',
             'serialization_time': datetime.now().isoformat()
@@ -240,7 +802,12 @@ def deserialize_model(file_path: str) -> CMXGraph:
             data_bytes = gzip.decompress(data_bytes)
         
         # Determine format
-        if data_bytes.startswith(b'CMX\x01'):
+        if data_bytes.startswith(b'CMX\x02'):
+            # Streamed binary format
+            cmx_graph = _read_streamed_model(data_bytes)
+            return cmx_graph
+
+        elif data_bytes.startswith(b'CMX\x01'):
             # Binary format
             metadata, offset = _parse_binary_header(data_bytes)
             graph_data = data_bytes[offset:]
@@ -303,7 +870,13 @@ def get_model_info(file_path: str) -> Dict[str, Any]:
                     data_bytes = gzip.decompress(f.read())
         
         # Parse format and metadata
-        if data_bytes.startswith(b'CMX\x01'):
+        if data_bytes.startswith(b'CMX\x02'):
+            # Streamed format keeps its topology (and metadata) at the
+            # end of the file, after the weight records
+            info['format'] = 'binary_streamed'
+            info['metadata'] = {}
+
+        elif data_bytes.startswith(b'CMX\x01'):
             info['format'] = 'binary'
             try:
                 metadata, _ = _parse_binary_header(data_bytes)
@@ -329,6 +329,81 @@ def convert_from_onnx(model_path: str, optimize: bool = True) -> CMXGraph:
     
     return cmx_graph
 
+def convert_from_onnx_streaming(model_path: str, output_path: str,
+                                weight_compression: Optional[str] = None) -> Dict[str, Any]:
+    """
+    Convert an ONNX model straight to a serialized CMX file, streaming
+    the weights.
+
+    convert_from_onnx materializes every initializer as a numpy array
+    and holds the whole weight set alive until serialization, which on
+    large models multiplies the protobuf size several times over. This
+    path decodes initializers one at a time, writes each payload
+    through model_serializer.ModelStreamWriter as soon as it is
+    decoded, and clears the initializer's protobuf storage before
+    moving on - only the graph topology stays in memory, so peak RSS
+    is roughly the protobuf plus one tensor and conversion is
+    I/O-bound.
+
+    The output is the streamed CMX container; deserialize_model reads
+    it back like any other CMX file.
+
+    Args:
+        model_path: Path to ONNX model file
+        output_path: Destination CMX file path
+        weight_compression: Optional per-tensor payload compression
+            ('rle'), as in serialize_model
+
+    Returns:
+        Dictionary with serialization info from the stream writer
+    """
+    from .model_serializer import ModelStreamWriter
+
+    model = _load_onnx_model(model_path)
+    _validate_onnx_model(model)
+
+    writer = ModelStreamWriter(output_path, weight_compression=weight_compression)
+    try:
+        # Decode, write, and drop one initializer at a time; Clear()
+        # releases the protobuf's copy of the raw bytes so the proto
+        # shrinks as the output grows
+        for initializer in model.graph.initializer:
+            name = initializer.name
+            weight_array = onnx.numpy_helper.to_array(initializer)
+            writer.write_weight(name, weight_array)
+            del weight_array
+            initializer.Clear()
+            initializer.name = name  # Keep the name for dangling-ref checks
+
+        # Topology only - same node/input/output layout as the in-memory path
+        nodes_dict = {}
+        for node_id, node in _extract_graph_nodes(model).items():
+            nodes_dict[node_id] = {
+                'op_type': node.op_type,
+                'inputs': node.inputs,
+                'outputs': node.outputs,
+                'attributes': node.attributes
+            }
+        inputs, outputs = _extract_input_output_info(model)
+
+        metadata = _get_model_metadata(model, model_path)
+        metadata.update({
+            'num_nodes': len(nodes_dict),
+            'num_weights': len(model.graph.initializer),
+            'num_inputs': len(inputs),
+            'num_outputs': len(outputs)
+        })
+
+        return writer.finish({
+            'nodes': nodes_dict,
+            'inputs': inputs,
+            'outputs': outputs,
+            'metadata': metadata
+        })
+    finally:
+        writer.close()
+
+
 def get_onnx_model_info(model_path: str) -> Dict[str, Any]:
     """Get information about an ONNX model without full conversion"""
     model = _load_onnx_model(model_path)
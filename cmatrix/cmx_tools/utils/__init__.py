@@ -12,6 +12,8 @@ from .data_loader import load_data, load_test_data, save_data
 from .config_parser import parse_config, validate_config
 from .file_utils import ensure_dir_exists, get_temp_path, cleanup_temp_files
 from .logging_utils import setup_logger, get_logger
+from .trace_converter import parse_trace_dump, convert_trace
+from .dtype_audit import audit_dtypes, emit_recipe, apply_recipe
 
 __version__ = "0.1.0"
 __author__ = "CMatrix Tools Team"
@@ -46,5 +48,14 @@ __all__ = [
     # Logging
     "setup_logger",
     "get_logger",
+
+    # Trace conversion
+    "parse_trace_dump",
+    "convert_trace",
+
+    # Dtype demotion audit
+    "audit_dtypes",
+    "emit_recipe",
+    "apply_recipe",
 ]
 
@@ -0,0 +1,265 @@
+"""
+Histogram-driven dtype demotion audit.
+
+Runs a graph host-side over representative inputs, collects a
+per-layer dynamic-range histogram of the activations, and reports
+which FP32/INT16 layers could demote to INT16/INT8 within an error
+budget. The result includes a quantization recipe the engine in
+compile/quantization_engine.py consumes directly, replacing the
+manual spreadsheet pass over per-layer ranges that demotion hunting
+used to be.
+
+The audit reuses the quantization engine's own layer simulation so the
+values it histograms are exactly the values calibration will later see;
+a layer the audit clears will calibrate to the same range.
+"""
+
+import math
+import logging
+from typing import Any, Dict, List, Optional
+
+import numpy as np
+
+logger = logging.getLogger(__name__)
+
+# Log2-bucketed magnitude histogram: bucket b covers absolute values in
+# [2^(b - _BUCKET_BIAS), 2^(b - _BUCKET_BIAS + 1)). 64 buckets biased at
+# -32 span everything an FP32 activation realistically produces.
+HISTOGRAM_BUCKETS = 64
+_BUCKET_BIAS = 32
+
+# Demotion candidates per current dtype, cheapest first
+_DEMOTION_TARGETS = {
+    'float32': ['int8', 'int16'],
+    'float': ['int8', 'int16'],
+    'int16': ['int8'],
+}
+
+_TARGET_BITS = {'int8': 8, 'int16': 16}
+
+
+class RangeHistogram:
+    """Accumulated magnitude distribution of one tensor across samples."""
+
+    def __init__(self):
+        self.buckets = [0] * HISTOGRAM_BUCKETS
+        self.zero_count = 0
+        self.total_count = 0
+        self.max_abs = 0.0
+
+    def add(self, tensor: np.ndarray) -> None:
+        """Fold one observation of the tensor into the histogram."""
+        values = np.abs(np.asarray(tensor, dtype=np.float64)).ravel()
+        if values.size == 0:
+            return
+        self.total_count += values.size
+        self.max_abs = max(self.max_abs, float(values.max()))
+
+        nonzero = values[values > 0.0]
+        self.zero_count += values.size - nonzero.size
+        if nonzero.size == 0:
+            return
+        exponents = np.clip(np.floor(np.log2(nonzero)).astype(int) + _BUCKET_BIAS,
+                            0, HISTOGRAM_BUCKETS - 1)
+        counts = np.bincount(exponents, minlength=HISTOGRAM_BUCKETS)
+        for b in range(HISTOGRAM_BUCKETS):
+            self.buckets[b] += int(counts[b])
+
+    def zero_fraction(self) -> float:
+        """Fraction of observed elements that were exactly zero."""
+        if self.total_count == 0:
+            return 0.0
+        return self.zero_count / self.total_count
+
+    def signal_power(self) -> float:
+        """Mean squared magnitude estimated from the buckets.
+
+        Each bucket contributes at its geometric midpoint, which is
+        within 1.5 dB of the true power - well under the margins the
+        audit decides by.
+        """
+        if self.total_count == 0:
+            return 0.0
+        power = 0.0
+        for b, count in enumerate(self.buckets):
+            if count:
+                mid = 2.0 ** (b - _BUCKET_BIAS + 0.5)
+                power += count * mid * mid
+        return power / self.total_count
+
+    def quantization_snr_db(self, bits: int) -> float:
+        """Predicted SNR of symmetric uniform quantization at this width.
+
+        Assumes the quantizer range covers max_abs (minmax calibration,
+        no clipping), so the only error is the uniform rounding noise
+        of step^2 / 12.
+        """
+        signal = self.signal_power()
+        if signal <= 0.0 or self.max_abs <= 0.0:
+            return float('inf')  # All-zero tensor quantizes exactly
+        step = self.max_abs / float(2 ** (bits - 1))
+        noise = (step * step) / 12.0
+        return 10.0 * math.log10(signal / noise)
+
+
+def collect_range_histograms(graph: Dict[str, Any],
+                             samples: List[np.ndarray]) -> Dict[str, RangeHistogram]:
+    """
+    Run the graph over representative inputs and histogram every layer.
+
+    Args:
+        graph: Graph IR with a 'layers' list in execution order
+        samples: Representative input tensors
+
+    Returns:
+        Dict mapping layer name to its output RangeHistogram
+    """
+    from ..compile.quantization_engine import QuantizationEngine
+
+    engine = QuantizationEngine()
+    layers = graph.get('layers', [])
+    histograms: Dict[str, RangeHistogram] = {}
+
+    for sample in samples:
+        current = np.asarray(sample, dtype=np.float64)
+        for i, layer in enumerate(layers):
+            name = layer.get('name', f'layer_{i}')
+            current = engine._simulate_layer_output(current, layer)
+            histograms.setdefault(name, RangeHistogram()).add(current)
+
+    return histograms
+
+
+def audit_dtypes(graph: Dict[str, Any], samples: List[np.ndarray],
+                 min_snr_db: float = 40.0) -> Dict[str, Any]:
+    """
+    Report which layers could run at a narrower dtype within budget.
+
+    A layer demotes to the cheapest dtype whose predicted quantization
+    SNR still meets min_snr_db. The default 40 dB budget corresponds
+    to well under half an LSB of int8 error on a full-scale signal;
+    tighten it for regression-sensitive models, relax it for detector
+    heads that only need ordering.
+
+    Args:
+        graph: Graph IR with 'layers'
+        samples: Representative input tensors
+        min_snr_db: Smallest acceptable predicted SNR in dB
+
+    Returns:
+        dict with per-layer 'rows' (name, current/recommended dtype,
+        max_abs, zero_fraction, per-target SNRs), the budget, and the
+        demotion count
+    """
+    histograms = collect_range_histograms(graph, samples)
+    layers = graph.get('layers', [])
+
+    rows = []
+    demotions = 0
+    for i, layer in enumerate(layers):
+        name = layer.get('name', f'layer_{i}')
+        hist = histograms.get(name)
+        if hist is None or hist.total_count == 0:
+            continue
+
+        current = layer.get('dtype', 'float32')
+        snrs = {target: hist.quantization_snr_db(bits)
+                for target, bits in _TARGET_BITS.items()}
+
+        recommended = current
+        for target in _DEMOTION_TARGETS.get(current, []):
+            if snrs[target] >= min_snr_db:
+                recommended = target
+                break
+
+        if recommended != current:
+            demotions += 1
+
+        rows.append({
+            'name': name,
+            'op_type': layer.get('type', 'unknown'),
+            'current_dtype': current,
+            'recommended_dtype': recommended,
+            'max_abs': hist.max_abs,
+            'zero_fraction': hist.zero_fraction(),
+            'int16_snr_db': snrs['int16'],
+            'int8_snr_db': snrs['int8'],
+        })
+
+    return {
+        'rows': rows,
+        'min_snr_db': min_snr_db,
+        'demotions': demotions,
+        'samples': len(samples),
+    }
+
+
+def emit_recipe(audit: Dict[str, Any], symmetric: bool = True,
+                calibration: str = 'minmax') -> Dict[str, Any]:
+    """
+    Turn an audit into a recipe for quantization_engine.quantize().
+
+    The recipe carries the engine-level mode (the coarsest demotion
+    target any layer needs, so no layer is forced below its budget)
+    plus per-layer overrides for apply_recipe to stamp onto the graph.
+
+    Returns:
+        dict with 'mode', 'symmetric', 'calibration', 'layer_modes'
+        (only the layers that demote) and audit provenance
+    """
+    layer_modes = {row['name']: row['recommended_dtype']
+                   for row in audit['rows']
+                   if row['recommended_dtype'] != row['current_dtype']}
+
+    modes = set(layer_modes.values())
+    mode = 'int16' if 'int16' in modes else 'int8'
+
+    return {
+        'mode': mode,
+        'symmetric': symmetric,
+        'calibration': calibration,
+        'layer_modes': layer_modes,
+        'source': 'dtype_audit',
+        'min_snr_db': audit['min_snr_db'],
+        'audit_samples': audit['samples'],
+    }
+
+
+def apply_recipe(graph: Dict[str, Any], recipe: Dict[str, Any]) -> int:
+    """
+    Stamp a recipe's per-layer dtype overrides onto the graph IR.
+
+    Layers the audit cleared get their 'quantize_mode' set so the
+    quantization engine narrows exactly those; untouched layers keep
+    their current dtype.
+
+    Returns:
+        Number of layers annotated
+    """
+    layer_modes = recipe.get('layer_modes', {})
+    applied = 0
+    for i, layer in enumerate(graph.get('layers', [])):
+        name = layer.get('name', f'layer_{i}')
+        if name in layer_modes:
+            layer['quantize_mode'] = layer_modes[name]
+            applied += 1
+    graph['quantization_recipe'] = recipe
+    return applied
+
+
+def format_audit_table(audit: Dict[str, Any]) -> str:
+    """Render an audit as an aligned text table."""
+    lines = [f"Dtype demotion audit ({audit['samples']} samples, "
+             f"budget {audit['min_snr_db']:.1f} dB): "
+             f"{audit['demotions']} of {len(audit['rows'])} layers demote",
+             f"{'layer':<24} {'op':<12} {'now':>8} {'rec':>8} "
+             f"{'max|x|':>10} {'zeros':>7} {'i16 dB':>8} {'i8 dB':>8}"]
+
+    for row in audit['rows']:
+        marker = '*' if row['recommended_dtype'] != row['current_dtype'] else ' '
+        lines.append(
+            f"{row['name']:<24} {row['op_type']:<12} "
+            f"{row['current_dtype']:>8} {row['recommended_dtype']:>7}{marker} "
+            f"{row['max_abs']:>10.4g} {row['zero_fraction']:>6.1%} "
+            f"{row['int16_snr_db']:>8.1f} {row['int8_snr_db']:>8.1f}")
+    return '\n'.join(lines)
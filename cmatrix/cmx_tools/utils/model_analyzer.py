@@ -118,6 +118,146 @@ def estimate_complexity(model_structure: dict) -> dict:
     }
 
 
+def roofline_report(graph_dict: dict, target: str = 'generic') -> dict:
+    """
+    Static per-layer MACs/traffic/roofline projection for a target.
+
+    For every node this computes MAC count, weight and activation byte
+    traffic, arithmetic intensity (MACs per byte) and a predicted
+    latency of max(compute time, memory time) against the target's
+    peak MAC rate and memory bandwidth from backend_flags. Layers below
+    the ridge point are flagged memory-bound. Numbers are first-order
+    estimates for architecture iteration, not cycle-accurate.
+
+    Args:
+        graph_dict: Graph structure with 'nodes' entries carrying
+            op_type, input_shapes, output_shapes, attributes
+        target: Backend name understood by backend_flags
+
+    Returns:
+        dict with per-layer rows, totals, the target's peak numbers
+        and the ridge point
+    """
+    from ..compile.backend_flags import get_performance_profile
+
+    profile = get_performance_profile(target)
+    peak_macs = profile['peak_macs_per_sec']
+    bandwidth = profile['memory_bandwidth_bytes_per_sec']
+    ridge = peak_macs / bandwidth  # intensity where compute == memory time
+
+    layers = []
+    total_macs = 0
+    total_bytes = 0
+    total_latency_s = 0.0
+
+    for i, node in enumerate(graph_dict.get('nodes', [])):
+        op_type = node.get('op_type', node.get('type', 'unknown'))
+        attributes = node.get('attributes', {})
+        input_shapes = node.get('input_shapes', [])
+        output_shapes = node.get('output_shapes', [])
+
+        macs = _compute_operation_macs(op_type, input_shapes, output_shapes, attributes)
+        weight_bytes, activation_bytes = _layer_traffic_bytes(
+            op_type, input_shapes, output_shapes, attributes)
+        layer_bytes = weight_bytes + activation_bytes
+
+        intensity = macs / layer_bytes if layer_bytes > 0 else 0.0
+        compute_time = macs / peak_macs if peak_macs > 0 else 0.0
+        memory_time = layer_bytes / bandwidth if bandwidth > 0 else 0.0
+        latency_s = max(compute_time, memory_time)
+
+        layers.append({
+            'node_index': i,
+            'name': node.get('name', f'node_{i}'),
+            'op_type': op_type,
+            'macs': macs,
+            'weight_bytes': weight_bytes,
+            'activation_bytes': activation_bytes,
+            'arithmetic_intensity': intensity,
+            'bound': 'compute' if intensity >= ridge else 'memory',
+            'predicted_latency_us': latency_s * 1e6
+        })
+
+        total_macs += macs
+        total_bytes += layer_bytes
+        total_latency_s += latency_s
+
+    return {
+        'target': target,
+        'peak_macs_per_sec': peak_macs,
+        'memory_bandwidth_bytes_per_sec': bandwidth,
+        'ridge_point_macs_per_byte': ridge,
+        'layers': layers,
+        'total_macs': total_macs,
+        'total_bytes': total_bytes,
+        'predicted_total_latency_us': total_latency_s * 1e6
+    }
+
+
+def format_roofline_table(report: dict) -> str:
+    """Render a roofline_report as an aligned text table."""
+    header = (f"Roofline for target '{report['target']}' "
+              f"(peak {report['peak_macs_per_sec'] / 1e6:.0f} MMAC/s, "
+              f"{report['memory_bandwidth_bytes_per_sec'] / 1e6:.0f} MB/s, "
+              f"ridge {report['ridge_point_macs_per_byte']:.2f} MAC/B)")
+    lines = [header,
+             f"{'layer':<24} {'op':<12} {'MACs':>12} {'bytes':>12} "
+             f"{'MAC/B':>8} {'bound':>8} {'lat(us)':>10}"]
+
+    for row in report['layers']:
+        lines.append(
+            f"{row['name']:<24} {row['op_type']:<12} {row['macs']:>12,} "
+            f"{row['weight_bytes'] + row['activation_bytes']:>12,} "
+            f"{row['arithmetic_intensity']:>8.2f} {row['bound']:>8} "
+            f"{row['predicted_latency_us']:>10.1f}")
+
+    lines.append(
+        f"{'TOTAL':<24} {'':<12} {report['total_macs']:>12,} "
+        f"{report['total_bytes']:>12,} {'':>8} {'':>8} "
+        f"{report['predicted_total_latency_us']:>10.1f}")
+    return '\n'.join(lines)
+
+
+# Element sizes for traffic estimates
+_DTYPE_BYTES = {
+    'float32': 4, 'float': 4,
+    'int32': 4, 'int16': 2,
+    'int8': 1, 'uint8': 1
+}
+
+
+def _layer_traffic_bytes(op_type: str, input_shapes: List[List[int]],
+                         output_shapes: List[List[int]],
+                         attributes: dict) -> Tuple[int, int]:
+    """Estimate (weight_bytes, activation_bytes) moved by one layer."""
+    elem_size = _DTYPE_BYTES.get(attributes.get('dtype', 'float32'), 4)
+
+    activation_bytes = 0
+    for shape in input_shapes:
+        activation_bytes += _get_tensor_size(shape) * elem_size
+    for shape in output_shapes:
+        activation_bytes += _get_tensor_size(shape) * elem_size
+
+    weight_bytes = 0
+    op_type_lower = op_type.lower()
+    try:
+        if op_type_lower in ['conv', 'conv2d', 'convolution']:
+            # NCHW shapes: weights are out_c * in_c * kh * kw
+            in_channels = input_shapes[0][1] if len(input_shapes[0]) > 1 else 1
+            out_channels = output_shapes[0][1] if len(output_shapes[0]) > 1 else 1
+            kernel_shape = attributes.get('kernel_shape', [3, 3])
+            weight_bytes = (out_channels * in_channels *
+                            kernel_shape[0] * kernel_shape[1] * elem_size)
+        elif op_type_lower in ['matmul', 'gemm', 'dense', 'linear']:
+            k = input_shapes[0][-1] if input_shapes[0] else 1
+            n = output_shapes[0][-1] if output_shapes[0] else 1
+            weight_bytes = k * n * elem_size
+    except (IndexError, TypeError):
+        weight_bytes = 0
+
+    return weight_bytes, activation_bytes
+
+
 def _compute_complexity_metrics(nodes: List[dict], tensors: dict) -> dict:
     """Compute detailed complexity metrics for the model."""
     total_macs = 0
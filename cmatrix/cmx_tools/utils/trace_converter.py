@@ -0,0 +1,178 @@
+"""
+Trace converter for CMatrix binary trace dumps.
+
+Parses the compact binary stream emitted by cmx_trace_dump() on device
+(see cmx_core/runtime/cmx_trace_export.hpp for the layout) and converts
+it to Chrome trace-event JSON, so inference timelines can be opened in
+Perfetto or chrome://tracing. Timestamps stay in raw clock ticks on the
+wire; conversion to microseconds happens here using the tick rate
+recorded in the dump header.
+"""
+
+import json
+import struct
+from typing import Any, Dict, List
+import logging
+
+logger = logging.getLogger(__name__)
+
+TRACE_DUMP_MAGIC = 0x54584D43  # "CMXT"
+TRACE_DUMP_VERSION = 1
+TRACE_DUMP_END = 0xFFFF
+
+_HEADER_FORMAT = "<IHHQHH"
+_BLOCK_HEADER_FORMAT = "<HHI"
+_EVENT_FORMAT = "<HQQ"
+
+
+class TraceFormatError(ValueError):
+    """Raised when the binary stream is not a valid trace dump."""
+
+
+def _read_exact(data: bytes, offset: int, size: int) -> bytes:
+    if offset + size > len(data):
+        raise TraceFormatError(
+            f"Truncated trace dump: needed {size} bytes at offset {offset}"
+        )
+    return data[offset:offset + size]
+
+
+def parse_trace_dump(data: bytes) -> Dict[str, Any]:
+    """Parse a binary trace dump into labels and events.
+
+    Args:
+        data: Raw bytes of the dump stream
+
+    Returns:
+        Dict with 'ticks_per_second', 'labels' (list of strings) and
+        'events' (list of dicts with core, label_id, t_start, t_end
+        in raw ticks)
+
+    Raises:
+        TraceFormatError: If the stream is malformed
+    """
+    header_size = struct.calcsize(_HEADER_FORMAT)
+    magic, version, core_count, ticks_per_second, label_count, _ = (
+        struct.unpack(_HEADER_FORMAT, _read_exact(data, 0, header_size))
+    )
+    if magic != TRACE_DUMP_MAGIC:
+        raise TraceFormatError(f"Bad magic 0x{magic:08X}")
+    if version != TRACE_DUMP_VERSION:
+        raise TraceFormatError(f"Unsupported trace dump version {version}")
+
+    offset = header_size
+
+    labels: List[str] = []
+    for _ in range(label_count):
+        length = _read_exact(data, offset, 1)[0]
+        offset += 1
+        labels.append(
+            _read_exact(data, offset, length).decode("utf-8", "replace")
+        )
+        offset += length
+
+    block_header_size = struct.calcsize(_BLOCK_HEADER_FORMAT)
+    event_size = struct.calcsize(_EVENT_FORMAT)
+
+    events: List[Dict[str, int]] = []
+    while True:
+        core, _, event_count = struct.unpack(
+            _BLOCK_HEADER_FORMAT,
+            _read_exact(data, offset, block_header_size),
+        )
+        offset += block_header_size
+        if core == TRACE_DUMP_END:
+            break
+        for _ in range(event_count):
+            label_id, t_start, t_end = struct.unpack(
+                _EVENT_FORMAT, _read_exact(data, offset, event_size)
+            )
+            offset += event_size
+            events.append({
+                "core": core,
+                "label_id": label_id,
+                "t_start": t_start,
+                "t_end": t_end,
+            })
+
+    logger.debug(
+        f"Parsed trace dump: {len(labels)} labels, {len(events)} events, "
+        f"{core_count} cores, {ticks_per_second} Hz"
+    )
+    return {
+        "ticks_per_second": ticks_per_second,
+        "labels": labels,
+        "events": events,
+    }
+
+
+def to_chrome_trace(parsed: Dict[str, Any],
+                    process_name: str = "cmx_runtime") -> Dict[str, Any]:
+    """Convert a parsed trace dump to a Chrome trace-event object.
+
+    Each ring event becomes one complete ('X') event with the core as
+    its thread id, so Perfetto renders one track per core and the
+    DMA/compute overlap gaps are directly visible.
+
+    Args:
+        parsed: Result of parse_trace_dump()
+        process_name: Name shown for the process track
+
+    Returns:
+        Dict in Chrome trace-event JSON object format
+    """
+    ticks_per_second = parsed["ticks_per_second"] or 1
+    ticks_to_us = 1e6 / ticks_per_second
+    labels = parsed["labels"]
+
+    # Rebase so the timeline starts near zero; raw cycle counts since
+    # boot would render far off-screen
+    t_base = min((e["t_start"] for e in parsed["events"]), default=0)
+
+    trace_events: List[Dict[str, Any]] = [{
+        "name": "process_name",
+        "ph": "M",
+        "pid": 0,
+        "args": {"name": process_name},
+    }]
+    for event in parsed["events"]:
+        label_id = event["label_id"]
+        name = labels[label_id] if label_id < len(labels) else f"label_{label_id}"
+        trace_events.append({
+            "name": name,
+            "ph": "X",
+            "pid": 0,
+            "tid": event["core"],
+            "ts": (event["t_start"] - t_base) * ticks_to_us,
+            "dur": (event["t_end"] - event["t_start"]) * ticks_to_us,
+        })
+
+    return {"traceEvents": trace_events, "displayTimeUnit": "ms"}
+
+
+def convert_trace(input_path: str, output_path: str,
+                  process_name: str = "cmx_runtime") -> int:
+    """Convert a binary trace dump file to Chrome trace JSON.
+
+    Args:
+        input_path: Path to the binary dump captured from the device
+        output_path: Path for the Chrome trace JSON file
+        process_name: Name shown for the process track
+
+    Returns:
+        Number of events converted
+
+    Raises:
+        TraceFormatError: If the input is not a valid trace dump
+        OSError: If file I/O fails
+    """
+    with open(input_path, "rb") as f:
+        parsed = parse_trace_dump(f.read())
+
+    chrome_trace = to_chrome_trace(parsed, process_name)
+    with open(output_path, "w") as f:
+        json.dump(chrome_trace, f, indent=2)
+
+    event_count = len(parsed["events"])
+    logger.info(f"Converted {event_count} events to {output_path}")
+    return event_count